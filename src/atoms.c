@@ -0,0 +1,90 @@
+/*============================================================================
+  epub2txt v2 
+  atoms.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <string.h>
+#include <strings.h>
+#include "atoms.h"
+#include "atoms_hash.h"
+#include "phash.h"
+
+#define ATOMS_HASH_MASK ((1u << ATOMS_HASH_BITS) - 1)
+
+static const char *const atom_names[ATOM_COUNT] =
+  {
+  "",
+#define X(id, name) name,
+  ATOM_LIST
+#undef X
+  };
+
+static const unsigned char atom_lengths[ATOM_COUNT] =
+  {
+  0,
+#define X(id, name) sizeof (name) - 1,
+  ATOM_LIST
+#undef X
+  };
+
+/*============================================================================
+  atoms_candidate
+  The only atom that name could be. The table is built from the
+    case-folded names, so the same slot serves both kinds of lookup 
+============================================================================*/
+static Atom atoms_candidate (const char *name, int len)
+  {
+  if (len <= 0 || len > 255) return ATOM_NONE;
+  Atom atom = atoms_hash_slots 
+    [phash_fold (ATOMS_HASH_SEED, name, len) & ATOMS_HASH_MASK];
+  if (atom_lengths[atom] != len) return ATOM_NONE;
+  return atom;
+  }
+
+/*============================================================================
+  atoms_lookup
+============================================================================*/
+Atom atoms_lookup (const char *name, int len)
+  {
+  Atom atom = atoms_candidate (name, len);
+  if (atom != ATOM_NONE && memcmp (atom_names[atom], name, len) == 0)
+    return atom;
+  return ATOM_NONE;
+  }
+
+/*============================================================================
+  atoms_lookup_fold
+============================================================================*/
+Atom atoms_lookup_fold (const char *name, int len)
+  {
+  Atom atom = atoms_candidate (name, len);
+  if (atom != ATOM_NONE && strncasecmp (atom_names[atom], name, len) == 0)
+    return atom;
+  return ATOM_NONE;
+  }
+
+/*============================================================================
+  atoms_xml
+============================================================================*/
+int atoms_xml (const char *name, int len)
+  {
+  return atoms_lookup (name, len);
+  }
+
+/*============================================================================
+  atoms_xml_fold
+============================================================================*/
+int atoms_xml_fold (const char *name, int len)
+  {
+  return atoms_lookup_fold (name, len);
+  }
+
+/*============================================================================
+  atoms_name
+============================================================================*/
+const char *atoms_name (Atom atom)
+  {
+  if (atom <= ATOM_NONE || atom >= ATOM_COUNT) return "";
+  return atom_names[atom];
+  }
@@ -0,0 +1,170 @@
+/*============================================================================
+  epub2txt v2 
+  atoms.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Interned names ("atoms") for the OPF, NCX, container and XHTML
+  vocabulary: element local names, namespace prefixes and attribute
+  names. The XML parser tags each node and attribute with the atom for
+  its name, so that code that walks a document can compare integers
+  rather than strings, and does not have to care about namespace
+  prefixes.
+
+  The lookup uses a static perfect hash. After changing ATOM_LIST, run
+  tools/mkphash.py to regenerate atoms_hash.h.
+============================================================================*/
+
+#pragma once
+
+#include "defs.h"
+
+// Keep this list in alphabetical order, ignoring case. Two names may not
+//   differ only in case, because atoms_lookup_fold() cannot tell them apart
+#define ATOM_LIST \
+  X (A, "a") \
+  X (ALT, "alt") \
+  X (ARTICLE, "article") \
+  X (ASIDE, "aside") \
+  X (B, "b") \
+  X (BLOCKQUOTE, "blockquote") \
+  X (BODY, "body") \
+  X (BR, "br") \
+  X (CALIBRE, "calibre") \
+  X (CAPTION, "caption") \
+  X (CITE, "cite") \
+  X (CLASS, "class") \
+  X (CODE, "code") \
+  X (CONTAINER, "container") \
+  X (CONTENT, "content") \
+  X (CONTRIBUTOR, "contributor") \
+  X (COVERAGE, "coverage") \
+  X (CREATOR, "creator") \
+  X (DATE, "date") \
+  X (DC, "dc") \
+  X (DCTERMS, "dcterms") \
+  X (DESCRIPTION, "description") \
+  X (DIR, "dir") \
+  X (DIV, "div") \
+  X (DOCAUTHOR, "docAuthor") \
+  X (DOCTITLE, "docTitle") \
+  X (EM, "em") \
+  X (EPUB, "epub") \
+  X (EVENT, "event") \
+  X (FIGCAPTION, "figcaption") \
+  X (FIGURE, "figure") \
+  X (FILE_AS, "file-as") \
+  X (FOOTER, "footer") \
+  X (FORMAT, "format") \
+  X (FULL_PATH, "full-path") \
+  X (GUIDE, "guide") \
+  X (H1, "h1") \
+  X (H2, "h2") \
+  X (H3, "h3") \
+  X (H4, "h4") \
+  X (H5, "h5") \
+  X (H6, "h6") \
+  X (HEAD, "head") \
+  X (HEADER, "header") \
+  X (HR, "hr") \
+  X (HREF, "href") \
+  X (HTML, "html") \
+  X (I, "i") \
+  X (ID, "id") \
+  X (IDENTIFIER, "identifier") \
+  X (IDREF, "idref") \
+  X (IMAGE, "image") \
+  X (IMG, "img") \
+  X (ITEM, "item") \
+  X (ITEMREF, "itemref") \
+  X (LANG, "lang") \
+  X (LANGUAGE, "language") \
+  X (LI, "li") \
+  X (LINEAR, "linear") \
+  X (LINK, "link") \
+  X (MAIN, "main") \
+  X (MANIFEST, "manifest") \
+  X (MATH, "math") \
+  X (MEDIA_TYPE, "media-type") \
+  X (META, "meta") \
+  X (METADATA, "metadata") \
+  X (NAME, "name") \
+  X (NAV, "nav") \
+  X (NAVLABEL, "navLabel") \
+  X (NAVLIST, "navList") \
+  X (NAVMAP, "navMap") \
+  X (NAVPOINT, "navPoint") \
+  X (NCX, "ncx") \
+  X (OL, "ol") \
+  X (OPF, "opf") \
+  X (OPS, "ops") \
+  X (P, "p") \
+  X (PACKAGE, "package") \
+  X (PAGELIST, "pageList") \
+  X (PAGETARGET, "pageTarget") \
+  X (PLAYORDER, "playOrder") \
+  X (PRE, "pre") \
+  X (PROPERTIES, "properties") \
+  X (PROPERTY, "property") \
+  X (PUBLISHER, "publisher") \
+  X (REFERENCE, "reference") \
+  X (REFINES, "refines") \
+  X (RELATION, "relation") \
+  X (RIGHTS, "rights") \
+  X (ROLE, "role") \
+  X (ROOTFILE, "rootfile") \
+  X (ROOTFILES, "rootfiles") \
+  X (RP, "rp") \
+  X (RT, "rt") \
+  X (RUBY, "ruby") \
+  X (SCHEME, "scheme") \
+  X (SCRIPT, "script") \
+  X (SECTION, "section") \
+  X (SOURCE, "source") \
+  X (SPAN, "span") \
+  X (SPINE, "spine") \
+  X (SRC, "src") \
+  X (STRONG, "strong") \
+  X (STYLE, "style") \
+  X (SUB, "sub") \
+  X (SUBJECT, "subject") \
+  X (SUP, "sup") \
+  X (SVG, "svg") \
+  X (TABLE, "table") \
+  X (TD, "td") \
+  X (TEXT, "text") \
+  X (TH, "th") \
+  X (TITLE, "title") \
+  X (TOC, "toc") \
+  X (TR, "tr") \
+  X (TYPE, "type") \
+  X (UL, "ul") \
+  X (UNIQUE_IDENTIFIER, "unique-identifier") \
+  X (VERSION, "version") \
+  X (XLINK, "xlink") \
+  X (XML, "xml") \
+  X (XMLNS, "xmlns")
+
+typedef enum
+  {
+  ATOM_NONE = 0,
+#define X(id, name) ATOM_##id,
+  ATOM_LIST
+#undef X
+  ATOM_COUNT
+  } Atom;
+
+/** Returns the atom for the first len bytes of name, or ATOM_NONE if the
+    name is not in the vocabulary. The comparison is case-sensitive, as
+    XML requires. */
+Atom        atoms_lookup (const char *name, int len);
+
+/** As atoms_lookup(), but ignores ASCII case, as HTML requires. */
+Atom        atoms_lookup_fold (const char *name, int len);
+
+/** atoms_lookup() and atoms_lookup_fold(), with the signature of an sxmlc
+    atom function (XML_ATOM_FN). */
+int         atoms_xml (const char *name, int len);
+int         atoms_xml_fold (const char *name, int len);
+
+/** Returns the name of an atom, or "" for ATOM_NONE. */
+const char *atoms_name (Atom atom);
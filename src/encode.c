@@ -0,0 +1,103 @@
+/*============================================================================
+  epub2txt v2 
+  encode.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include "defs.h"
+#include "encode.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*============================================================================
+  encode_utf8_char
+============================================================================*/
+static inline BYTE *encode_utf8_char (uint32_t c, BYTE *p)
+  {
+  if (c < 0x80)
+    {
+    *p++ = c;
+    }
+  else if (c < 0x800)
+    {
+    *p++ = 0xC0 | (c >> 6);
+    *p++ = 0x80 | (c & 0x3F);
+    }
+  else if (c < 0x10000)
+    {
+    if (c >= 0xD800 && c <= 0xDFFF) c = 0xFFFD;
+    *p++ = 0xE0 | (c >> 12);
+    *p++ = 0x80 | ((c >> 6) & 0x3F);
+    *p++ = 0x80 | (c & 0x3F);
+    }
+  else if (c <= 0x10FFFF)
+    {
+    *p++ = 0xF0 | (c >> 18);
+    *p++ = 0x80 | ((c >> 12) & 0x3F);
+    *p++ = 0x80 | ((c >> 6) & 0x3F);
+    *p++ = 0x80 | (c & 0x3F);
+    }
+  else
+    p = encode_utf8_char (0xFFFD, p);
+  return p;
+  }
+
+/*============================================================================
+  encode_utf8
+  With SSE2, eight code points are tested at once; if they are all 
+    ASCII, the two saturating packs narrow them from 32 bits to 8 
+    without changing them. Otherwise those eight are encoded one at a
+    time.
+============================================================================*/
+int encode_utf8 (const uint32_t *s, int len, char *out)
+  {
+  BYTE *p = (BYTE *)out;
+  int i = 0;
+
+#if defined(__SSE2__)
+  const __m128i high = _mm_set1_epi32 (~0x7F);
+  const __m128i zero = _mm_setzero_si128 ();
+  for (; len - i >= 8; i += 8)
+    {
+    __m128i a = _mm_loadu_si128 ((const __m128i *)(s + i));
+    __m128i b = _mm_loadu_si128 ((const __m128i *)(s + i + 4));
+    __m128i h = _mm_and_si128 (_mm_or_si128 (a, b), high);
+    if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (h, zero)) == 0xFFFF)
+      {
+      __m128i v = _mm_packus_epi16 (_mm_packs_epi32 (a, b), zero);
+      _mm_storel_epi64 ((__m128i *)p, v);
+      p += 8;
+      }
+    else
+      {
+      int k;
+      for (k = 0; k < 8; k++)
+        p = encode_utf8_char (s[i + k], p);
+      }
+    }
+#endif
+
+  for (; i < len; i++)
+    p = encode_utf8_char (s[i], p);
+
+  return p - (BYTE *)out;
+  }
+
+/*============================================================================
+  encode_utf8_write
+============================================================================*/
+void encode_utf8_write (const uint32_t *s, int len, FILE *f)
+  {
+  char buff[256 * ENCODE_UTF8_MAX];
+  while (len > 0)
+    {
+    int n = len < 256 ? len : 256;
+    fwrite (buff, 1, encode_utf8 (s, n, buff), f);
+    s += n;
+    len -= n;
+    }
+  }
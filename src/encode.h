@@ -0,0 +1,27 @@
+/*============================================================================
+  epub2txt v2 
+  encode.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Fast encoding of UTF-32 text as UTF-8, for output. Runs of ASCII, 
+  which are most of the text in most books, are packed eight code 
+  points at a time with SSE2, where the CPU has it. 
+============================================================================*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+// The most bytes that one code point can take in UTF-8
+#define ENCODE_UTF8_MAX 4
+
+/** Encodes len code points from s as UTF-8 at out, which must have room
+    for ENCODE_UTF8_MAX * len bytes, and returns the number of bytes 
+    written. No terminating zero is added. Surrogates and values above
+    U+10FFFF are written as U+FFFD. */
+int encode_utf8 (const uint32_t *s, int len, char *out);
+
+/** Encodes len code points from s as UTF-8, as encode_utf8() does, and
+    writes them to f, a piece at a time, so that nothing is allocated. */
+void encode_utf8_write (const uint32_t *s, int len, FILE *f);
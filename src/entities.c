@@ -0,0 +1,35 @@
+/*============================================================================
+  epub2txt v2 
+  entities.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <string.h>
+#include "entities.h"
+#include "entities_hash.h"
+#include "phash.h"
+
+#define ENTITIES_BUCKET_MASK ((1u << ENTITIES_BUCKET_BITS) - 1)
+#define ENTITIES_HASH_MASK ((1u << ENTITIES_HASH_BITS) - 1)
+
+/*============================================================================
+  entities_lookup
+  The first hash picks a bucket, and the bucket's displacement seeds the
+    second hash, which picks the only slot the name could be in
+============================================================================*/
+int entities_lookup (const char *name, int len, uint32_t *out)
+  {
+  if (len <= 0 || len > 255) return 0;
+  uint32_t bucket = phash (ENTITIES_HASH_SEED, name, len) 
+    & ENTITIES_BUCKET_MASK;
+  int e = entities_hash_slots 
+    [phash (entities_hash_disp[bucket], name, len) & ENTITIES_HASH_MASK];
+  if (e == 0 || entities_lengths[e] != len 
+      || memcmp (entities_names[e], name, len) != 0)
+    return 0;
+  out[0] = entities_chars[e][0];
+  if (entities_chars[e][1] == 0) return 1;
+  out[1] = entities_chars[e][1];
+  return 2;
+  }
+
@@ -0,0 +1,23 @@
+/*============================================================================
+  epub2txt v2 
+  entities.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  The HTML5 named character references (&amp;, &mdash;, ...), looked
+  up in a static perfect hash. The tables are generated from the WHATWG 
+  list by tools/mkphash.py, into entities_hash.h.
+============================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// The most code points that any entity stands for
+#define ENTITIES_MAX_CHARS 2
+
+/** Look up the entity name, of len bytes, without the & and ;. Names are
+    case-sensitive, as in HTML5. Stores the characters it stands for in
+    out, and returns how many there are, or 0 if the name is unknown. */
+int entities_lookup (const char *name, int len, uint32_t *out);
+
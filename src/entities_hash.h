@@ -0,0 +1,1104 @@
+/* Generated by tools/mkphash.py from the WHATWG entity list -- do not edit */
+
+#pragma once
+
+#define ENTITIES_COUNT 2126
+#define ENTITIES_HASH_SEED 1u
+#define ENTITIES_BUCKET_BITS 10
+#define ENTITIES_HASH_BITS 12
+
+// Bucket -> seed for the second-level hash
+static const unsigned short entities_hash_disp[1024] =
+  {
+  4, 0, 4, 0, 2, 2, 1, 2, 0, 1, 2, 1, 0, 1, 3, 3,
+  2, 2, 1, 2, 1, 4, 6, 1, 1, 1, 2, 0, 2, 2, 4, 2,
+  1, 2, 1, 6, 2, 2, 2, 2, 4, 2, 2, 0, 2, 1, 0, 2,
+  0, 3, 3, 2, 2, 1, 2, 1, 4, 2, 1, 2, 1, 21, 2, 1,
+  1, 1, 2, 3, 3, 4, 2, 0, 1, 0, 2, 0, 4, 2, 1, 3,
+  3, 0, 6, 2, 1, 2, 1, 2, 0, 1, 2, 2, 3, 0, 14, 2,
+  5, 3, 2, 0, 1, 3, 2, 3, 1, 2, 2, 2, 4, 1, 1, 24,
+  1, 2, 5, 2, 1, 2, 3, 4, 0, 2, 0, 3, 2, 0, 2, 0,
+  4, 2, 2, 1, 2, 1, 2, 2, 2, 2, 2, 7, 2, 1, 2, 2,
+  2, 1, 1, 2, 0, 1, 1, 1, 2, 2, 3, 0, 2, 0, 4, 2,
+  0, 2, 3, 3, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 2, 0,
+  2, 0, 2, 2, 1, 2, 2, 1, 3, 1, 1, 2, 2, 2, 2, 6,
+  3, 1, 2, 1, 1, 0, 2, 8, 0, 4, 5, 2, 2, 1, 10, 3,
+  2, 4, 2, 1, 8, 3, 1, 2, 1, 2, 4, 2, 5, 2, 9, 3,
+  1, 0, 1, 1, 2, 1, 2, 3, 3, 2, 1, 0, 3, 1, 2, 2,
+  1, 1, 4, 2, 3, 0, 1, 1, 1, 1, 2, 0, 6, 14, 1, 2,
+  2, 2, 1, 2, 1, 2, 0, 1, 2, 0, 1, 4, 2, 1, 1, 0,
+  2, 1, 3, 1, 0, 1, 1, 0, 2, 2, 1, 1, 1, 2, 2, 2,
+  0, 2, 3, 1, 2, 5, 1, 4, 6, 1, 1, 0, 7, 7, 1, 0,
+  2, 1, 0, 4, 3, 3, 1, 2, 2, 1, 2, 2, 4, 0, 1, 1,
+  2, 2, 9, 0, 1, 2, 3, 1, 7, 4, 5, 1, 2, 1, 3, 2,
+  2, 2, 2, 2, 4, 2, 2, 2, 1, 3, 2, 2, 0, 4, 1, 2,
+  1, 2, 2, 1, 0, 5, 1, 6, 1, 2, 4, 1, 1, 1, 3, 3,
+  2, 2, 2, 1, 1, 1, 0, 27, 1, 2, 2, 1, 2, 1, 2, 2,
+  3, 12, 1, 2, 2, 3, 2, 2, 2, 2, 2, 7, 4, 1, 2, 5,
+  2, 4, 4, 0, 3, 4, 2, 18, 2, 3, 3, 4, 1, 3, 4, 7,
+  4, 7, 1, 2, 3, 4, 3, 2, 1, 1, 7, 0, 1, 2, 1, 4,
+  3, 0, 1, 1, 4, 1, 3, 0, 3, 2, 4, 2, 2, 1, 1, 2,
+  1, 1, 2, 1, 2, 10, 8, 1, 2, 26, 7, 2, 2, 0, 1, 2,
+  3, 4, 1, 3, 0, 1, 0, 1, 10, 3, 3, 3, 1, 4, 2, 2,
+  66, 4, 1, 2, 2, 2, 2, 0, 4, 0, 1, 0, 1, 0, 3, 2,
+  1, 4, 3, 1, 0, 19, 0, 1, 1, 2, 6, 2, 2, 0, 1, 2,
+  2, 3, 6, 3, 0, 2, 1, 2, 6, 2, 7, 2, 1, 1, 2, 3,
+  2, 1, 1, 1, 8, 2, 0, 3, 2, 1, 0, 2, 4, 6, 1, 6,
+  4, 2, 4, 1, 3, 2, 1, 1, 1, 20, 9, 1, 1, 4, 2, 14,
+  2, 1, 1, 2, 5, 2, 3, 5, 2, 2, 2, 5, 0, 10, 5, 1,
+  5, 2, 2, 1, 1, 2, 0, 8, 1, 3, 7, 11, 1, 3, 1, 1,
+  3, 3, 3, 11, 1, 2, 2, 2, 16, 2, 2, 2, 0, 1, 9, 2,
+  0, 2, 1, 1, 3, 2, 4, 2, 1, 4, 2, 3, 3, 2, 5, 0,
+  3, 0, 2, 2, 2, 1, 1, 0, 65, 1, 4, 1, 1, 1, 2, 6,
+  2, 6, 0, 0, 1, 1, 3, 2, 1, 1, 2, 4, 1, 1, 2, 2,
+  1, 2, 0, 1, 1, 0, 5, 3, 0, 3, 1, 5, 1, 2, 1, 1,
+  2, 2, 0, 2, 1, 4, 1, 3, 2, 2, 1, 2, 1, 1, 3, 2,
+  4, 0, 8, 5, 3, 2, 43, 2, 2, 3, 3, 3, 4, 2, 1, 0,
+  1, 0, 1, 4, 3, 2, 3, 68, 8, 2, 2, 2, 1, 2, 5, 2,
+  1, 2, 7, 2, 1, 1, 1, 2, 3, 1, 3, 6, 0, 3, 0, 2,
+  3, 3, 2, 0, 2, 1, 25, 4, 1, 3, 2, 3, 2, 8, 10, 2,
+  0, 1, 2, 2, 5, 11, 1, 0, 0, 2, 1, 7, 11, 1, 3, 1,
+  2, 2, 1, 2, 2, 4, 2, 1, 3, 2, 1, 1, 2, 4, 4, 4,
+  3, 2, 0, 2, 3, 2, 0, 3, 5, 1, 1, 12, 3, 1, 0, 8,
+  2, 2, 1, 1, 5, 4, 4, 2, 3, 2, 7, 1, 1, 0, 1, 1,
+  1, 1, 1, 3, 2, 9, 8, 0, 10, 3, 59, 4, 0, 1, 1, 2,
+  2, 1, 3, 1, 0, 0, 8, 1, 1, 8, 1, 64, 0, 2, 1, 8,
+  1, 2, 3, 0, 1, 7, 5, 3, 3, 1, 2, 4, 3, 2, 6, 1,
+  0, 2, 4, 65, 2, 5, 0, 2, 1, 1, 0, 4, 4, 8, 0, 4,
+  3, 1, 0, 1, 3, 3, 2, 1, 1, 66, 45, 2, 1, 1, 1, 0,
+  1, 8, 3, 3, 6, 2, 1, 10, 5, 6, 1, 1, 1, 2, 1, 64,
+  2, 0, 0, 5, 1, 15, 18, 2, 0, 6, 0, 0, 0, 0, 2, 5,
+  1, 8, 28, 1, 1, 1, 11, 1, 2, 3, 1, 2, 7, 2, 13, 0,
+  4, 2, 3, 3, 3, 1, 2, 1, 1, 6, 3, 1, 0, 1, 1, 4,
+  4, 65, 2, 2, 10, 2, 5, 7, 2, 4, 1, 6, 0, 1, 3, 5,
+  2, 64, 4, 3, 3, 2, 64, 1, 1, 1, 2, 2, 5, 1, 4, 1,
+  3, 2, 1, 67, 2, 1, 3, 1, 2, 1, 2, 2, 2, 5, 2, 0,
+  4, 5, 7, 3, 2, 4, 4, 4, 16, 4, 1, 3, 2, 2, 5, 3
+  };
+
+// Slot -> entity, 0 for an empty slot
+static const unsigned short entities_hash_slots[4096] =
+  {
+  0, 0, 355, 0, 814, 0, 1538, 0, 618, 0, 1275, 0, 0, 1620, 0, 0,
+  0, 597, 34, 0, 0, 1525, 0, 1763, 1805, 959, 0, 533, 523, 1730, 0, 539,
+  0, 247, 842, 0, 0, 0, 897, 0, 1294, 0, 0, 0, 994, 664, 0, 0,
+  0, 775, 1532, 2102, 1468, 0, 1273, 0, 1644, 1001, 1527, 341, 962, 0, 1898, 0,
+  872, 1928, 0, 31, 0, 0, 639, 0, 1703, 0, 0, 0, 0, 507, 843, 985,
+  741, 2023, 2044, 229, 576, 1474, 770, 1422, 1346, 1324, 1725, 0, 662, 1173, 0, 0,
+  0, 0, 0, 216, 413, 0, 0, 2114, 1161, 515, 0, 0, 0, 0, 0, 0,
+  0, 0, 932, 1510, 1698, 60, 0, 1970, 0, 1627, 735, 0, 0, 1790, 0, 1267,
+  13, 23, 493, 0, 2112, 1818, 0, 0, 1052, 1938, 0, 0, 0, 0, 0, 0,
+  480, 0, 0, 0, 1039, 0, 1768, 615, 658, 406, 1927, 2028, 0, 0, 1618, 0,
+  0, 0, 0, 400, 0, 0, 1521, 2089, 399, 11, 0, 393, 0, 894, 0, 1573,
+  0, 1506, 1994, 0, 1078, 0, 968, 1342, 0, 0, 828, 1947, 0, 0, 2010, 703,
+  2061, 827, 0, 0, 0, 0, 0, 1220, 258, 0, 396, 0, 0, 1330, 180, 511,
+  516, 0, 461, 0, 0, 503, 2073, 981, 913, 0, 0, 0, 491, 1503, 0, 0,
+  0, 1144, 0, 0, 249, 0, 0, 0, 1291, 0, 0, 0, 1943, 358, 0, 0,
+  0, 619, 0, 0, 0, 0, 572, 1571, 924, 1603, 1934, 997, 0, 0, 0, 0,
+  1392, 1363, 3, 0, 0, 1552, 0, 14, 0, 882, 916, 571, 1108, 318, 1062, 0,
+  1269, 982, 0, 26, 0, 723, 0, 0, 0, 0, 70, 0, 1159, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 439, 82, 0, 447, 0, 157, 5, 1806,
+  0, 2029, 0, 1983, 653, 1821, 202, 1298, 702, 0, 0, 0, 740, 0, 0, 0,
+  0, 892, 0, 1230, 1517, 561, 0, 612, 0, 2096, 0, 295, 0, 1105, 0, 1820,
+  1777, 0, 1407, 228, 0, 0, 0, 0, 1999, 631, 1211, 1302, 0, 685, 1702, 0,
+  0, 0, 0, 506, 0, 121, 1759, 0, 0, 0, 1826, 0, 150, 0, 0, 2014,
+  0, 236, 0, 44, 1413, 124, 565, 846, 0, 171, 0, 602, 30, 0, 0, 402,
+  0, 0, 441, 0, 0, 0, 1127, 0, 225, 277, 700, 865, 1462, 1984, 1639, 1933,
+  1916, 1444, 0, 0, 1401, 42, 0, 0, 1978, 1074, 0, 0, 0, 0, 0, 547,
+  2119, 164, 2030, 0, 0, 0, 626, 311, 1047, 1566, 1045, 0, 601, 1990, 255, 458,
+  876, 0, 0, 1583, 0, 367, 1464, 0, 0, 710, 705, 898, 0, 1675, 1234, 570,
+  0, 1483, 0, 712, 1286, 0, 1213, 66, 1493, 497, 333, 0, 0, 0, 1568, 599,
+  0, 0, 896, 1118, 0, 0, 1960, 0, 1218, 1081, 0, 266, 1835, 0, 1288, 0,
+  0, 1414, 1987, 1177, 0, 1366, 0, 0, 79, 0, 0, 0, 803, 1151, 0, 866,
+  1526, 0, 0, 0, 0, 362, 0, 1748, 1095, 0, 657, 574, 0, 0, 0, 314,
+  0, 303, 2050, 0, 284, 0, 1664, 187, 1179, 269, 1599, 0, 0, 1515, 0, 347,
+  379, 517, 0, 999, 0, 0, 0, 0, 0, 1908, 0, 0, 0, 0, 1669, 0,
+  0, 27, 0, 941, 334, 0, 540, 2092, 0, 1172, 0, 381, 1523, 806, 1607, 0,
+  0, 346, 0, 0, 0, 0, 0, 118, 394, 0, 0, 0, 0, 0, 0, 1850,
+  0, 0, 800, 0, 0, 0, 0, 0, 0, 0, 1065, 428, 6, 0, 0, 1840,
+  0, 0, 1227, 0, 486, 0, 177, 375, 0, 0, 222, 587, 0, 1993, 1655, 0,
+  0, 1049, 0, 0, 0, 0, 313, 1542, 1746, 1650, 0, 0, 0, 0, 0, 0,
+  1040, 0, 0, 141, 0, 349, 538, 0, 1352, 2016, 0, 39, 1964, 1238, 178, 0,
+  1084, 1094, 0, 0, 0, 1264, 134, 1046, 0, 0, 0, 1029, 0, 288, 0, 0,
+  629, 1863, 0, 963, 1931, 0, 780, 0, 512, 524, 308, 143, 1961, 899, 0, 2120,
+  0, 0, 0, 0, 1251, 820, 442, 1439, 1832, 0, 0, 0, 582, 1524, 1281, 0,
+  2110, 592, 0, 1890, 1054, 1334, 0, 0, 0, 0, 630, 0, 905, 650, 1107, 0,
+  1028, 0, 1282, 416, 0, 1608, 0, 0, 542, 0, 0, 0, 0, 948, 445, 0,
+  0, 0, 2105, 0, 320, 1008, 1248, 275, 0, 0, 0, 429, 0, 0, 0, 1484,
+  1241, 468, 1682, 0, 1221, 0, 848, 0, 1397, 219, 646, 1747, 0, 952, 0, 1371,
+  755, 112, 0, 0, 0, 0, 682, 1897, 819, 0, 947, 283, 0, 1657, 1884, 1204,
+  0, 0, 0, 769, 661, 0, 1169, 1189, 0, 331, 0, 1986, 0, 0, 1576, 1945,
+  0, 0, 0, 0, 1150, 1448, 92, 747, 0, 956, 0, 0, 0, 1667, 1812, 0,
+  1874, 0, 1630, 0, 0, 0, 0, 2121, 1437, 162, 1190, 0, 884, 0, 0, 271,
+  1914, 1344, 1958, 2045, 0, 123, 1604, 0, 2109, 0, 0, 373, 714, 203, 0, 0,
+  562, 870, 0, 0, 610, 1085, 1488, 1865, 1857, 0, 943, 1633, 0, 1259, 975, 844,
+  713, 760, 1587, 1817, 1482, 0, 1438, 0, 1383, 0, 147, 0, 606, 935, 1513, 0,
+  0, 1417, 0, 281, 0, 0, 668, 63, 0, 0, 0, 496, 0, 1717, 0, 2071,
+  0, 0, 554, 1249, 2034, 545, 708, 1935, 0, 0, 0, 0, 267, 1091, 0, 0,
+  1839, 695, 754, 518, 0, 0, 1125, 0, 0, 1901, 0, 132, 0, 912, 0, 861,
+  76, 0, 0, 0, 0, 1660, 0, 0, 0, 0, 0, 2075, 0, 0, 274, 829,
+  0, 0, 0, 2051, 1186, 1867, 398, 0, 0, 0, 0, 0, 478, 0, 2069, 0,
+  832, 0, 0, 158, 0, 0, 0, 0, 2022, 0, 767, 1398, 1090, 532, 591, 1305,
+  0, 149, 1013, 0, 471, 1004, 1056, 0, 879, 0, 1742, 1354, 407, 0, 1598, 0,
+  0, 1070, 0, 0, 0, 0, 78, 0, 1032, 1967, 0, 0, 0, 73, 1687, 1797,
+  0, 0, 2036, 0, 0, 0, 0, 1689, 530, 1766, 176, 1957, 0, 0, 205, 0,
+  2017, 0, 1949, 0, 0, 614, 0, 0, 645, 0, 0, 1745, 1375, 1236, 508, 623,
+  182, 1537, 0, 0, 699, 0, 2000, 2041, 0, 1963, 1403, 114, 0, 1676, 0, 0,
+  0, 0, 1946, 0, 0, 519, 0, 1304, 1014, 1359, 1547, 0, 0, 951, 1456, 0,
+  1136, 0, 1317, 426, 0, 0, 0, 1854, 2083, 69, 0, 659, 0, 163, 578, 191,
+  0, 0, 1520, 2078, 0, 809, 0, 1114, 50, 1649, 1508, 513, 0, 1453, 0, 0,
+  617, 2122, 0, 0, 246, 0, 1714, 0, 0, 1421, 0, 1183, 1245, 0, 1198, 0,
+  8, 305, 0, 1771, 1585, 169, 0, 1228, 0, 0, 672, 0, 0, 0, 465, 0,
+  0, 1558, 0, 1212, 706, 0, 131, 0, 0, 0, 1073, 0, 467, 1486, 0, 1791,
+  0, 353, 0, 0, 0, 0, 0, 1434, 0, 1845, 0, 2094, 2020, 0, 0, 155,
+  628, 0, 0, 1031, 2088, 1616, 1540, 1895, 1652, 0, 268, 0, 0, 1950, 0, 1631,
+  1455, 1322, 57, 0, 0, 1331, 1624, 159, 0, 0, 363, 0, 0, 0, 377, 0,
+  0, 1232, 730, 0, 989, 0, 0, 0, 0, 0, 0, 1982, 1019, 0, 1952, 0,
+  0, 0, 0, 0, 649, 0, 0, 0, 1619, 197, 1042, 0, 2098, 1043, 1851, 0,
+  0, 408, 1716, 0, 1164, 0, 902, 1033, 0, 0, 0, 1656, 0, 464, 1879, 640,
+  0, 0, 322, 1224, 1215, 0, 38, 0, 37, 1872, 0, 762, 0, 0, 1130, 1143,
+  1731, 0, 0, 46, 0, 307, 711, 673, 0, 0, 207, 0, 0, 93, 1185, 0,
+  1149, 746, 0, 1369, 0, 0, 0, 1829, 1847, 877, 1022, 0, 0, 0, 777, 1196,
+  1233, 2009, 0, 2002, 0, 0, 1408, 0, 0, 1297, 873, 1752, 0, 0, 0, 1498,
+  1223, 1781, 0, 0, 763, 175, 748, 2091, 0, 0, 0, 1864, 0, 1562, 684, 849,
+  260, 0, 0, 782, 0, 0, 53, 0, 0, 1101, 890, 0, 0, 0, 460, 0,
+  473, 1750, 0, 345, 0, 0, 0, 0, 0, 910, 0, 450, 0, 1900, 0, 794,
+  0, 1891, 0, 0, 0, 0, 0, 0, 0, 1718, 759, 0, 1762, 805, 0, 0,
+  0, 95, 145, 922, 0, 0, 0, 613, 0, 0, 1757, 1799, 0, 0, 1254, 1214,
+  553, 1727, 0, 0, 0, 387, 0, 0, 2001, 298, 1926, 1802, 0, 0, 1020, 0,
+  0, 0, 0, 1492, 1651, 1846, 0, 681, 0, 789, 0, 2068, 359, 991, 0, 0,
+  1075, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1904, 1229, 1257, 448,
+  0, 0, 1913, 0, 0, 0, 1684, 130, 0, 1260, 285, 1357, 1410, 0, 1754, 1088,
+  978, 0, 961, 0, 0, 262, 0, 212, 0, 0, 0, 0, 0, 0, 457, 537,
+  972, 988, 1977, 2090, 0, 378, 0, 1641, 0, 0, 0, 585, 0, 1203, 1293, 679,
+  1477, 743, 0, 2087, 915, 0, 0, 0, 0, 59, 0, 1670, 1712, 0, 65, 0,
+  2, 0, 319, 0, 0, 1473, 0, 1894, 0, 0, 172, 389, 1807, 1841, 1878, 0,
+  72, 0, 0, 1596, 563, 1388, 0, 0, 0, 0, 1906, 0, 1861, 0, 0, 0,
+  1886, 0, 624, 1372, 0, 1693, 433, 0, 352, 535, 1270, 0, 474, 0, 200, 1937,
+  0, 0, 0, 0, 0, 0, 1217, 845, 804, 986, 0, 1962, 0, 148, 0, 0,
+  20, 110, 1272, 0, 0, 0, 0, 911, 0, 243, 0, 0, 1126, 1833, 339, 0,
+  505, 488, 0, 1337, 0, 0, 1210, 326, 725, 0, 0, 2019, 0, 403, 370, 0,
+  0, 0, 839, 0, 1654, 718, 0, 0, 1622, 0, 1726, 593, 0, 1738, 0, 1940,
+  0, 1060, 0, 0, 1274, 0, 796, 654, 0, 0, 0, 84, 1794, 1673, 1555, 1824,
+  1760, 146, 1386, 1539, 0, 0, 0, 0, 1543, 0, 534, 0, 0, 1723, 0, 0,
+  901, 0, 0, 1093, 0, 0, 0, 330, 451, 0, 462, 0, 103, 0, 727, 0,
+  799, 0, 2067, 0, 0, 188, 594, 434, 0, 1848, 1948, 100, 1367, 1207, 0, 1415,
+  1575, 0, 790, 0, 119, 0, 1665, 1429, 1544, 299, 0, 0, 115, 2026, 2116, 51,
+  856, 1918, 793, 939, 392, 0, 0, 0, 0, 596, 1680, 1930, 0, 312, 1724, 995,
+  16, 1167, 0, 0, 0, 0, 1912, 0, 495, 0, 841, 0, 0, 0, 0, 1612,
+  0, 0, 336, 0, 0, 0, 1290, 1310, 1, 566, 1148, 0, 0, 89, 1896, 1803,
+  67, 0, 0, 0, 466, 1277, 2085, 0, 0, 0, 660, 1647, 1200, 1868, 410, 0,
+  0, 0, 1922, 0, 0, 472, 1626, 0, 0, 409, 21, 0, 354, 536, 479, 0,
+  1419, 75, 1206, 0, 1564, 1638, 0, 0, 678, 0, 0, 1134, 0, 795, 604, 357,
+  0, 883, 1496, 1380, 1823, 0, 2066, 954, 0, 1137, 1411, 2008, 0, 0, 1648, 0,
+  895, 1784, 2038, 165, 783, 0, 1124, 1076, 0, 2046, 1710, 1452, 0, 0, 0, 2055,
+  233, 0, 1998, 0, 0, 0, 0, 0, 1350, 2053, 0, 1119, 0, 1709, 420, 0,
+  788, 321, 83, 928, 0, 0, 0, 2033, 1364, 1009, 0, 287, 0, 0, 0, 1478,
+  0, 1044, 206, 0, 0, 88, 0, 0, 0, 1582, 0, 0, 0, 0, 1921, 0,
+  0, 139, 0, 1831, 893, 1522, 0, 0, 1384, 2065, 1487, 1677, 1578, 1038, 1617, 609,
+  2018, 600, 74, 0, 590, 0, 0, 128, 122, 781, 430, 1625, 509, 292, 1416, 1460,
+  1433, 555, 1609, 0, 0, 0, 0, 99, 1634, 0, 1471, 0, 1021, 1348, 0, 0,
+  2070, 1577, 0, 927, 0, 0, 1722, 0, 0, 0, 291, 0, 0, 210, 2063, 0,
+  738, 0, 1911, 0, 881, 0, 998, 802, 0, 0, 1597, 1307, 1681, 0, 0, 315,
+  160, 107, 0, 289, 0, 808, 0, 992, 0, 0, 337, 0, 0, 1956, 0, 0,
+  2084, 361, 0, 752, 878, 926, 871, 388, 1516, 611, 726, 469, 261, 0, 1546, 0,
+  0, 854, 0, 1951, 0, 1852, 818, 1632, 0, 1563, 0, 786, 0, 0, 1465, 1152,
+  564, 1985, 0, 0, 0, 0, 227, 0, 825, 655, 0, 1461, 0, 680, 0, 1261,
+  0, 0, 1011, 0, 0, 0, 0, 1881, 863, 2037, 1661, 0, 0, 1929, 417, 979,
+  1057, 0, 1800, 0, 0, 1157, 0, 0, 527, 371, 1735, 116, 1765, 0, 0, 0,
+  0, 811, 0, 0, 0, 0, 0, 751, 1442, 1329, 0, 1734, 91, 0, 0, 0,
+  1055, 946, 0, 263, 0, 101, 1199, 0, 1034, 840, 129, 1356, 0, 1058, 0, 690,
+  0, 2011, 1643, 1360, 356, 0, 1300, 482, 0, 1567, 1973, 1678, 0, 0, 2031, 0,
+  1668, 0, 644, 1497, 0, 886, 1176, 0, 231, 218, 0, 0, 0, 1082, 0, 0,
+  0, 0, 372, 0, 0, 0, 721, 1924, 0, 0, 0, 557, 0, 1276, 810, 1697,
+  869, 1828, 1556, 0, 0, 1258, 1128, 1554, 648, 0, 226, 0, 0, 166, 0, 689,
+  0, 1404, 0, 603, 0, 0, 0, 0, 0, 1154, 688, 833, 742, 1253, 220, 0,
+  0, 0, 0, 0, 1772, 1109, 2079, 1988, 0, 0, 1481, 0, 0, 0, 483, 836,
+  0, 641, 1490, 252, 722, 0, 1959, 0, 0, 1810, 0, 0, 494, 0, 1519, 0,
+  0, 0, 0, 1783, 0, 1155, 787, 0, 476, 1299, 0, 0, 0, 0, 194, 2117,
+  0, 0, 1528, 0, 0, 675, 1535, 1720, 0, 1796, 1600, 0, 0, 0, 0, 0,
+  0, 1628, 0, 0, 0, 427, 0, 192, 214, 0, 0, 0, 0, 0, 837, 0,
+  0, 0, 0, 105, 342, 0, 914, 2039, 0, 1780, 0, 0, 855, 0, 1880, 1629,
+  1182, 140, 598, 1798, 0, 0, 453, 785, 1194, 1271, 309, 0, 455, 0, 0, 1147,
+  0, 1296, 0, 1111, 1428, 273, 1683, 1640, 0, 0, 2004, 0, 0, 2076, 1834, 0,
+  0, 0, 1989, 0, 1893, 0, 0, 1133, 419, 481, 921, 0, 1450, 0, 0, 61,
+  0, 694, 1827, 830, 335, 2080, 386, 965, 0, 1262, 0, 0, 1658, 395, 317, 1472,
+  0, 2086, 0, 607, 1870, 2101, 2125, 96, 0, 0, 144, 0, 54, 28, 1972, 0,
+  1873, 1142, 0, 454, 0, 0, 522, 0, 577, 1327, 1741, 0, 2111, 0, 0, 0,
+  0, 0, 52, 1132, 0, 0, 1104, 0, 1954, 1980, 0, 0, 0, 1425, 0, 0,
+  0, 0, 0, 77, 0, 1068, 0, 1308, 0, 1138, 1018, 642, 0, 0, 1955, 1869,
+  0, 0, 1584, 0, 1843, 1614, 2021, 1494, 821, 0, 1158, 0, 749, 715, 0, 45,
+  1024, 0, 0, 0, 0, 857, 0, 0, 1175, 0, 1235, 0, 0, 1786, 401, 0,
+  1102, 0, 17, 1623, 0, 1915, 1445, 0, 1981, 1129, 71, 0, 0, 1613, 636, 1560,
+  238, 2123, 1588, 56, 0, 1778, 0, 1595, 500, 908, 0, 1336, 0, 638, 632, 822,
+  1353, 0, 0, 0, 0, 436, 0, 1002, 0, 0, 1801, 0, 0, 1740, 0, 0,
+  514, 791, 0, 739, 411, 0, 43, 22, 0, 270, 0, 0, 0, 1026, 0, 798,
+  874, 0, 1193, 0, 0, 0, 0, 0, 1691, 282, 1135, 1592, 0, 304, 0, 0,
+  1475, 0, 868, 0, 0, 382, 0, 1285, 0, 1365, 0, 1370, 0, 1140, 1905, 1925,
+  348, 0, 925, 2047, 0, 1876, 0, 0, 1476, 2060, 1882, 1591, 0, 463, 797, 0,
+  241, 0, 0, 0, 170, 953, 0, 1071, 0, 0, 1581, 405, 1191, 0, 0, 1936,
+  2043, 0, 1100, 1853, 0, 0, 0, 716, 2093, 1072, 1902, 0, 0, 579, 1518, 1447,
+  0, 888, 0, 0, 852, 0, 0, 0, 1328, 0, 133, 2064, 0, 0, 0, 1287,
+  756, 0, 677, 1202, 0, 0, 0, 62, 0, 2097, 230, 0, 2095, 824, 0, 1197,
+  1975, 0, 0, 0, 376, 0, 0, 0, 397, 256, 0, 0, 0, 1509, 771, 0,
+  1671, 1368, 950, 1393, 0, 0, 864, 0, 720, 0, 0, 0, 0, 0, 766, 504,
+  0, 1146, 501, 0, 0, 0, 0, 484, 35, 0, 0, 498, 0, 0, 0, 0,
+  1099, 0, 1005, 616, 0, 1247, 0, 40, 1181, 0, 0, 1505, 936, 889, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1319, 344, 0, 0, 173, 0, 0,
+  1250, 1283, 1744, 0, 0, 0, 224, 0, 0, 940, 817, 0, 0, 1163, 490, 0,
+  0, 0, 0, 18, 656, 1579, 0, 595, 0, 0, 0, 415, 2013, 126, 0, 0,
+  580, 0, 0, 1814, 1909, 151, 0, 0, 68, 1910, 815, 1855, 1491, 0, 0, 1423,
+  0, 1086, 423, 744, 0, 0, 24, 957, 0, 0, 1069, 0, 1495, 1139, 0, 816,
+  0, 1690, 853, 1574, 1883, 0, 184, 0, 2077, 676, 167, 0, 0, 0, 1007, 0,
+  634, 0, 1103, 0, 0, 0, 215, 0, 1166, 0, 0, 208, 0, 929, 1246, 1338,
+  0, 0, 0, 1793, 1991, 0, 0, 1000, 0, 0, 923, 0, 0, 94, 0, 1037,
+  528, 0, 0, 778, 0, 2074, 938, 0, 906, 0, 0, 1170, 0, 239, 0, 0,
+  0, 2035, 1572, 0, 0, 1333, 1225, 0, 1530, 1303, 0, 0, 0, 0, 0, 919,
+  0, 0, 637, 0, 1239, 1106, 278, 0, 0, 1500, 692, 1480, 1089, 1849, 0, 0,
+  1844, 1010, 195, 0, 1379, 431, 0, 1395, 90, 891, 0, 1378, 0, 350, 0, 1187,
+  930, 1321, 0, 1996, 1501, 1966, 967, 232, 0, 1602, 1789, 223, 0, 0, 0, 1653,
+  0, 0, 1316, 969, 0, 1311, 0, 0, 1306, 0, 0, 977, 993, 1769, 316, 1216,
+  1323, 161, 1773, 0, 1822, 0, 2003, 502, 0, 731, 1402, 652, 0, 0, 0, 2054,
+  1431, 0, 1457, 1672, 1446, 437, 136, 0, 581, 0, 1836, 1420, 0, 0, 1551, 569,
+  0, 0, 875, 1565, 0, 0, 0, 0, 0, 709, 2048, 0, 1862, 0, 0, 1265,
+  0, 1201, 964, 0, 245, 1559, 0, 237, 0, 0, 1432, 1504, 0, 1899, 1920, 510,
+  138, 1751, 1171, 196, 0, 0, 0, 0, 183, 435, 0, 0, 0, 297, 0, 0,
+  1637, 0, 807, 0, 0, 0, 1385, 0, 0, 1788, 909, 0, 974, 0, 560, 265,
+  1739, 0, 0, 0, 0, 1809, 1871, 0, 0, 0, 0, 1704, 696, 0, 1153, 1006,
+  1685, 0, 1758, 0, 0, 204, 526, 1761, 0, 0, 1003, 1015, 0, 0, 0, 1858,
+  0, 973, 1059, 286, 0, 0, 1813, 1837, 0, 0, 838, 1590, 1974, 1345, 0, 1168,
+  0, 0, 1965, 440, 477, 0, 0, 0, 0, 0, 736, 0, 49, 1023, 0, 1077,
+  1711, 1701, 190, 0, 0, 0, 0, 1919, 1923, 1737, 707, 0, 1394, 489, 0, 949,
+  1733, 0, 0, 966, 0, 0, 0, 1440, 0, 0, 0, 556, 0, 2040, 0, 1606,
+  958, 0, 0, 1499, 0, 1541, 643, 0, 971, 0, 0, 0, 0, 0, 0, 412,
+  850, 0, 0, 907, 0, 0, 2081, 310, 0, 154, 0, 764, 0, 1485, 234, 0,
+  0, 651, 0, 1534, 36, 0, 1295, 903, 1907, 1514, 761, 0, 0, 0, 1877, 0,
+  0, 0, 687, 1120, 0, 0, 2058, 1860, 931, 1696, 0, 0, 0, 0, 0, 0,
+  0, 1792, 2007, 351, 589, 0, 0, 0, 0, 586, 0, 384, 0, 0, 0, 1782,
+  0, 1097, 0, 1903, 1700, 422, 2049, 2062, 2099, 1601, 0, 0, 0, 0, 1145, 0,
+  0, 737, 1721, 0, 1436, 1561, 2100, 1332, 0, 784, 0, 0, 0, 1362, 0, 0,
+  0, 1811, 546, 1079, 456, 0, 0, 0, 0, 2059, 0, 1320, 0, 1389, 625, 734,
+  1580, 0, 0, 211, 1280, 0, 1219, 470, 0, 276, 1451, 1699, 1992, 0, 0, 0,
+  0, 1035, 0, 1621, 0, 0, 0, 521, 575, 0, 0, 0, 1866, 0, 847, 0,
+  1184, 0, 0, 1808, 0, 0, 425, 0, 608, 937, 235, 1679, 0, 0, 0, 1708,
+  1278, 0, 0, 1707, 0, 0, 438, 120, 0, 0, 0, 826, 0, 0, 0, 0,
+  0, 1787, 0, 550, 259, 704, 0, 549, 327, 0, 729, 0, 1263, 1875, 0, 980,
+  1838, 0, 2005, 324, 1776, 858, 0, 0, 0, 338, 0, 0, 1589, 1347, 1479, 1610,
+  1087, 0, 567, 244, 774, 109, 0, 254, 174, 1098, 1489, 1064, 0, 834, 0, 0,
+  1666, 0, 0, 1292, 0, 1243, 1427, 0, 0, 0, 209, 1289, 0, 2107, 0, 1646,
+  1842, 1743, 0, 0, 2118, 0, 1944, 1470, 4, 0, 0, 0, 0, 432, 1706, 1373,
+  475, 0, 19, 1382, 0, 0, 0, 0, 0, 369, 0, 186, 0, 1688, 117, 0,
+  0, 0, 1719, 0, 0, 0, 1051, 0, 0, 0, 683, 635, 199, 0, 0, 1412,
+  1390, 1244, 0, 1231, 0, 1995, 1110, 0, 0, 1736, 0, 1942, 757, 0, 1226, 1256,
+  1553, 279, 0, 1376, 0, 181, 1017, 0, 0, 674, 0, 0, 152, 294, 1502, 0,
+  1932, 0, 1531, 0, 0, 0, 0, 1815, 0, 290, 0, 1188, 0, 0, 1692, 1418,
+  1856, 0, 0, 1756, 584, 0, 1115, 0, 0, 0, 1242, 0, 1454, 0, 732, 0,
+  48, 1284, 1405, 0, 0, 0, 984, 2072, 0, 0, 98, 1387, 0, 0, 0, 558,
+  0, 0, 0, 697, 487, 1536, 1063, 0, 1969, 0, 0, 0, 0, 1209, 1449, 0,
+  0, 168, 1605, 1025, 193, 1892, 0, 0, 0, 0, 0, 0, 0, 1549, 1165, 0,
+  987, 0, 1335, 1343, 0, 0, 0, 1266, 0, 125, 1674, 253, 1117, 1083, 1976, 0,
+  0, 0, 0, 1339, 0, 0, 920, 1435, 414, 0, 0, 0, 1767, 867, 1131, 29,
+  0, 0, 0, 443, 0, 0, 1426, 0, 1785, 1391, 0, 0, 1396, 544, 955, 719,
+  2103, 1694, 0, 1180, 0, 452, 1156, 1443, 0, 0, 325, 0, 0, 0, 1096, 0,
+  960, 0, 1240, 0, 0, 64, 0, 1116, 0, 583, 0, 0, 499, 0, 0, 0,
+  390, 153, 0, 366, 0, 0, 945, 0, 548, 0, 1361, 1406, 1092, 0, 1112, 0,
+  701, 1533, 1355, 1663, 0, 2056, 0, 25, 1968, 0, 1774, 792, 733, 0, 47, 559,
+  0, 0, 568, 0, 0, 1349, 385, 0, 1729, 2042, 0, 300, 1160, 0, 724, 0,
+  0, 0, 106, 779, 1313, 449, 0, 1550, 1113, 1162, 113, 996, 33, 0, 1941, 142,
+  0, 0, 1511, 1458, 2006, 2012, 0, 812, 1755, 647, 306, 1061, 0, 0, 0, 0,
+  1594, 1066, 1997, 0, 0, 0, 2113, 0, 0, 1804, 0, 1208, 1048, 365, 1012, 0,
+  0, 0, 885, 0, 2024, 1312, 0, 1615, 0, 0, 1205, 835, 0, 1713, 758, 0,
+  1642, 541, 0, 1377, 323, 293, 0, 1255, 0, 0, 1971, 108, 0, 58, 0, 0,
+  15, 0, 329, 667, 1887, 97, 0, 0, 1315, 0, 728, 0, 0, 1830, 87, 0,
+  242, 0, 0, 1819, 1141, 1399, 1795, 380, 0, 622, 0, 0, 880, 831, 1374, 1053,
+  605, 860, 81, 0, 1705, 459, 2057, 773, 851, 1466, 0, 0, 1430, 0, 551, 374,
+  0, 0, 0, 543, 32, 1548, 189, 0, 1400, 0, 859, 1301, 0, 2115, 0, 0,
+  0, 1381, 1586, 1728, 0, 520, 669, 0, 0, 0, 302, 2082, 185, 666, 0, 1686,
+  0, 0, 0, 2104, 0, 1036, 0, 0, 0, 1469, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 588, 485, 0, 0, 627, 0, 0, 0, 1545, 55, 0, 0,
+  1529, 364, 0, 944, 0, 0, 217, 0, 0, 1358, 360, 0, 0, 1512, 1770, 0,
+  0, 0, 0, 990, 240, 1749, 213, 0, 1953, 0, 2025, 2015, 137, 383, 0, 1122,
+  917, 1080, 0, 156, 0, 1753, 0, 0, 552, 0, 1459, 0, 573, 0, 0, 0,
+  1816, 0, 444, 2124, 1016, 1569, 0, 492, 0, 1174, 1340, 1635, 529, 446, 1695, 0,
+  0, 0, 813, 768, 0, 0, 1326, 0, 0, 0, 0, 0, 0, 0, 1123, 0,
+  111, 201, 0, 933, 693, 0, 1050, 0, 1351, 2052, 0, 328, 621, 0, 753, 0,
+  0, 343, 1636, 272, 0, 0, 0, 745, 671, 404, 391, 1507, 0, 1318, 1775, 663,
+  368, 1570, 0, 41, 104, 1195, 1859, 1222, 0, 942, 0, 1939, 0, 332, 0, 0,
+  0, 9, 765, 1030, 620, 0, 686, 0, 983, 0, 0, 970, 0, 1662, 0, 1659,
+  0, 0, 418, 0, 0, 0, 0, 1645, 421, 691, 7, 1409, 0, 0, 1341, 1041,
+  0, 904, 0, 1888, 257, 0, 900, 1237, 0, 887, 198, 918, 801, 251, 0, 0,
+  179, 221, 0, 1463, 698, 0, 665, 525, 250, 1279, 0, 264, 1557, 0, 0, 1593,
+  2108, 102, 0, 0, 1067, 0, 0, 0, 0, 976, 1424, 1611, 0, 1979, 0, 776,
+  1268, 12, 424, 0, 633, 750, 1309, 1027, 717, 0, 1252, 1715, 1825, 1732, 1178, 0,
+  0, 0, 670, 0, 1917, 0, 0, 0, 2032, 80, 0, 2106, 934, 0, 0, 0,
+  0, 296, 0, 0, 0, 0, 0, 248, 0, 0, 862, 531, 0, 1889, 0, 1779,
+  0, 0, 0, 0, 0, 0, 0, 1121, 0, 0, 0, 1325, 0, 0, 86, 0,
+  1314, 0, 0, 127, 340, 1885, 0, 0, 1192, 280, 0, 0, 0, 0, 0, 0,
+  1764, 0, 0, 1441, 0, 301, 0, 0, 0, 823, 10, 2027, 772, 1467, 0, 135
+  };
+
+static const char *const entities_names[ENTITIES_COUNT] =
+  {
+  "", "AElig", "AMP", "Aacute", "Abreve", "Acirc", "Acy", "Afr",
+  "Agrave", "Alpha", "Amacr", "And", "Aogon", "Aopf", "ApplyFunction", "Aring",
+  "Ascr", "Assign", "Atilde", "Auml", "Backslash", "Barv", "Barwed", "Bcy",
+  "Because", "Bernoullis", "Beta", "Bfr", "Bopf", "Breve", "Bscr", "Bumpeq",
+  "CHcy", "COPY", "Cacute", "Cap", "CapitalDifferentialD", "Cayleys", "Ccaron", "Ccedil",
+  "Ccirc", "Cconint", "Cdot", "Cedilla", "CenterDot", "Cfr", "Chi", "CircleDot",
+  "CircleMinus", "CirclePlus", "CircleTimes", "ClockwiseContourIntegral", "CloseCurlyDoubleQuote", "CloseCurlyQuote", "Colon", "Colone",
+  "Congruent", "Conint", "ContourIntegral", "Copf", "Coproduct", "CounterClockwiseContourIntegral", "Cross", "Cscr",
+  "Cup", "CupCap", "DD", "DDotrahd", "DJcy", "DScy", "DZcy", "Dagger",
+  "Darr", "Dashv", "Dcaron", "Dcy", "Del", "Delta", "Dfr", "DiacriticalAcute",
+  "DiacriticalDot", "DiacriticalDoubleAcute", "DiacriticalGrave", "DiacriticalTilde", "Diamond", "DifferentialD", "Dopf", "Dot",
+  "DotDot", "DotEqual", "DoubleContourIntegral", "DoubleDot", "DoubleDownArrow", "DoubleLeftArrow", "DoubleLeftRightArrow", "DoubleLeftTee",
+  "DoubleLongLeftArrow", "DoubleLongLeftRightArrow", "DoubleLongRightArrow", "DoubleRightArrow", "DoubleRightTee", "DoubleUpArrow", "DoubleUpDownArrow", "DoubleVerticalBar",
+  "DownArrow", "DownArrowBar", "DownArrowUpArrow", "DownBreve", "DownLeftRightVector", "DownLeftTeeVector", "DownLeftVector", "DownLeftVectorBar",
+  "DownRightTeeVector", "DownRightVector", "DownRightVectorBar", "DownTee", "DownTeeArrow", "Downarrow", "Dscr", "Dstrok",
+  "ENG", "ETH", "Eacute", "Ecaron", "Ecirc", "Ecy", "Edot", "Efr",
+  "Egrave", "Element", "Emacr", "EmptySmallSquare", "EmptyVerySmallSquare", "Eogon", "Eopf", "Epsilon",
+  "Equal", "EqualTilde", "Equilibrium", "Escr", "Esim", "Eta", "Euml", "Exists",
+  "ExponentialE", "Fcy", "Ffr", "FilledSmallSquare", "FilledVerySmallSquare", "Fopf", "ForAll", "Fouriertrf",
+  "Fscr", "GJcy", "GT", "Gamma", "Gammad", "Gbreve", "Gcedil", "Gcirc",
+  "Gcy", "Gdot", "Gfr", "Gg", "Gopf", "GreaterEqual", "GreaterEqualLess", "GreaterFullEqual",
+  "GreaterGreater", "GreaterLess", "GreaterSlantEqual", "GreaterTilde", "Gscr", "Gt", "HARDcy", "Hacek",
+  "Hat", "Hcirc", "Hfr", "HilbertSpace", "Hopf", "HorizontalLine", "Hscr", "Hstrok",
+  "HumpDownHump", "HumpEqual", "IEcy", "IJlig", "IOcy", "Iacute", "Icirc", "Icy",
+  "Idot", "Ifr", "Igrave", "Im", "Imacr", "ImaginaryI", "Implies", "Int",
+  "Integral", "Intersection", "InvisibleComma", "InvisibleTimes", "Iogon", "Iopf", "Iota", "Iscr",
+  "Itilde", "Iukcy", "Iuml", "Jcirc", "Jcy", "Jfr", "Jopf", "Jscr",
+  "Jsercy", "Jukcy", "KHcy", "KJcy", "Kappa", "Kcedil", "Kcy", "Kfr",
+  "Kopf", "Kscr", "LJcy", "LT", "Lacute", "Lambda", "Lang", "Laplacetrf",
+  "Larr", "Lcaron", "Lcedil", "Lcy", "LeftAngleBracket", "LeftArrow", "LeftArrowBar", "LeftArrowRightArrow",
+  "LeftCeiling", "LeftDoubleBracket", "LeftDownTeeVector", "LeftDownVector", "LeftDownVectorBar", "LeftFloor", "LeftRightArrow", "LeftRightVector",
+  "LeftTee", "LeftTeeArrow", "LeftTeeVector", "LeftTriangle", "LeftTriangleBar", "LeftTriangleEqual", "LeftUpDownVector", "LeftUpTeeVector",
+  "LeftUpVector", "LeftUpVectorBar", "LeftVector", "LeftVectorBar", "Leftarrow", "Leftrightarrow", "LessEqualGreater", "LessFullEqual",
+  "LessGreater", "LessLess", "LessSlantEqual", "LessTilde", "Lfr", "Ll", "Lleftarrow", "Lmidot",
+  "LongLeftArrow", "LongLeftRightArrow", "LongRightArrow", "Longleftarrow", "Longleftrightarrow", "Longrightarrow", "Lopf", "LowerLeftArrow",
+  "LowerRightArrow", "Lscr", "Lsh", "Lstrok", "Lt", "Map", "Mcy", "MediumSpace",
+  "Mellintrf", "Mfr", "MinusPlus", "Mopf", "Mscr", "Mu", "NJcy", "Nacute",
+  "Ncaron", "Ncedil", "Ncy", "NegativeMediumSpace", "NegativeThickSpace", "NegativeThinSpace", "NegativeVeryThinSpace", "NestedGreaterGreater",
+  "NestedLessLess", "NewLine", "Nfr", "NoBreak", "NonBreakingSpace", "Nopf", "Not", "NotCongruent",
+  "NotCupCap", "NotDoubleVerticalBar", "NotElement", "NotEqual", "NotEqualTilde", "NotExists", "NotGreater", "NotGreaterEqual",
+  "NotGreaterFullEqual", "NotGreaterGreater", "NotGreaterLess", "NotGreaterSlantEqual", "NotGreaterTilde", "NotHumpDownHump", "NotHumpEqual", "NotLeftTriangle",
+  "NotLeftTriangleBar", "NotLeftTriangleEqual", "NotLess", "NotLessEqual", "NotLessGreater", "NotLessLess", "NotLessSlantEqual", "NotLessTilde",
+  "NotNestedGreaterGreater", "NotNestedLessLess", "NotPrecedes", "NotPrecedesEqual", "NotPrecedesSlantEqual", "NotReverseElement", "NotRightTriangle", "NotRightTriangleBar",
+  "NotRightTriangleEqual", "NotSquareSubset", "NotSquareSubsetEqual", "NotSquareSuperset", "NotSquareSupersetEqual", "NotSubset", "NotSubsetEqual", "NotSucceeds",
+  "NotSucceedsEqual", "NotSucceedsSlantEqual", "NotSucceedsTilde", "NotSuperset", "NotSupersetEqual", "NotTilde", "NotTildeEqual", "NotTildeFullEqual",
+  "NotTildeTilde", "NotVerticalBar", "Nscr", "Ntilde", "Nu", "OElig", "Oacute", "Ocirc",
+  "Ocy", "Odblac", "Ofr", "Ograve", "Omacr", "Omega", "Omicron", "Oopf",
+  "OpenCurlyDoubleQuote", "OpenCurlyQuote", "Or", "Oscr", "Oslash", "Otilde", "Otimes", "Ouml",
+  "OverBar", "OverBrace", "OverBracket", "OverParenthesis", "PartialD", "Pcy", "Pfr", "Phi",
+  "Pi", "PlusMinus", "Poincareplane", "Popf", "Pr", "Precedes", "PrecedesEqual", "PrecedesSlantEqual",
+  "PrecedesTilde", "Prime", "Product", "Proportion", "Proportional", "Pscr", "Psi", "QUOT",
+  "Qfr", "Qopf", "Qscr", "RBarr", "REG", "Racute", "Rang", "Rarr",
+  "Rarrtl", "Rcaron", "Rcedil", "Rcy", "Re", "ReverseElement", "ReverseEquilibrium", "ReverseUpEquilibrium",
+  "Rfr", "Rho", "RightAngleBracket", "RightArrow", "RightArrowBar", "RightArrowLeftArrow", "RightCeiling", "RightDoubleBracket",
+  "RightDownTeeVector", "RightDownVector", "RightDownVectorBar", "RightFloor", "RightTee", "RightTeeArrow", "RightTeeVector", "RightTriangle",
+  "RightTriangleBar", "RightTriangleEqual", "RightUpDownVector", "RightUpTeeVector", "RightUpVector", "RightUpVectorBar", "RightVector", "RightVectorBar",
+  "Rightarrow", "Ropf", "RoundImplies", "Rrightarrow", "Rscr", "Rsh", "RuleDelayed", "SHCHcy",
+  "SHcy", "SOFTcy", "Sacute", "Sc", "Scaron", "Scedil", "Scirc", "Scy",
+  "Sfr", "ShortDownArrow", "ShortLeftArrow", "ShortRightArrow", "ShortUpArrow", "Sigma", "SmallCircle", "Sopf",
+  "Sqrt", "Square", "SquareIntersection", "SquareSubset", "SquareSubsetEqual", "SquareSuperset", "SquareSupersetEqual", "SquareUnion",
+  "Sscr", "Star", "Sub", "Subset", "SubsetEqual", "Succeeds", "SucceedsEqual", "SucceedsSlantEqual",
+  "SucceedsTilde", "SuchThat", "Sum", "Sup", "Superset", "SupersetEqual", "Supset", "THORN",
+  "TRADE", "TSHcy", "TScy", "Tab", "Tau", "Tcaron", "Tcedil", "Tcy",
+  "Tfr", "Therefore", "Theta", "ThickSpace", "ThinSpace", "Tilde", "TildeEqual", "TildeFullEqual",
+  "TildeTilde", "Topf", "TripleDot", "Tscr", "Tstrok", "Uacute", "Uarr", "Uarrocir",
+  "Ubrcy", "Ubreve", "Ucirc", "Ucy", "Udblac", "Ufr", "Ugrave", "Umacr",
+  "UnderBar", "UnderBrace", "UnderBracket", "UnderParenthesis", "Union", "UnionPlus", "Uogon", "Uopf",
+  "UpArrow", "UpArrowBar", "UpArrowDownArrow", "UpDownArrow", "UpEquilibrium", "UpTee", "UpTeeArrow", "Uparrow",
+  "Updownarrow", "UpperLeftArrow", "UpperRightArrow", "Upsi", "Upsilon", "Uring", "Uscr", "Utilde",
+  "Uuml", "VDash", "Vbar", "Vcy", "Vdash", "Vdashl", "Vee", "Verbar",
+  "Vert", "VerticalBar", "VerticalLine", "VerticalSeparator", "VerticalTilde", "VeryThinSpace", "Vfr", "Vopf",
+  "Vscr", "Vvdash", "Wcirc", "Wedge", "Wfr", "Wopf", "Wscr", "Xfr",
+  "Xi", "Xopf", "Xscr", "YAcy", "YIcy", "YUcy", "Yacute", "Ycirc",
+  "Ycy", "Yfr", "Yopf", "Yscr", "Yuml", "ZHcy", "Zacute", "Zcaron",
+  "Zcy", "Zdot", "ZeroWidthSpace", "Zeta", "Zfr", "Zopf", "Zscr", "aacute",
+  "abreve", "ac", "acE", "acd", "acirc", "acute", "acy", "aelig",
+  "af", "afr", "agrave", "alefsym", "aleph", "alpha", "amacr", "amalg",
+  "amp", "and", "andand", "andd", "andslope", "andv", "ang", "ange",
+  "angle", "angmsd", "angmsdaa", "angmsdab", "angmsdac", "angmsdad", "angmsdae", "angmsdaf",
+  "angmsdag", "angmsdah", "angrt", "angrtvb", "angrtvbd", "angsph", "angst", "angzarr",
+  "aogon", "aopf", "ap", "apE", "apacir", "ape", "apid", "apos",
+  "approx", "approxeq", "aring", "ascr", "ast", "asymp", "asympeq", "atilde",
+  "auml", "awconint", "awint", "bNot", "backcong", "backepsilon", "backprime", "backsim",
+  "backsimeq", "barvee", "barwed", "barwedge", "bbrk", "bbrktbrk", "bcong", "bcy",
+  "bdquo", "becaus", "because", "bemptyv", "bepsi", "bernou", "beta", "beth",
+  "between", "bfr", "bigcap", "bigcirc", "bigcup", "bigodot", "bigoplus", "bigotimes",
+  "bigsqcup", "bigstar", "bigtriangledown", "bigtriangleup", "biguplus", "bigvee", "bigwedge", "bkarow",
+  "blacklozenge", "blacksquare", "blacktriangle", "blacktriangledown", "blacktriangleleft", "blacktriangleright", "blank", "blk12",
+  "blk14", "blk34", "block", "bne", "bnequiv", "bnot", "bopf", "bot",
+  "bottom", "bowtie", "boxDL", "boxDR", "boxDl", "boxDr", "boxH", "boxHD",
+  "boxHU", "boxHd", "boxHu", "boxUL", "boxUR", "boxUl", "boxUr", "boxV",
+  "boxVH", "boxVL", "boxVR", "boxVh", "boxVl", "boxVr", "boxbox", "boxdL",
+  "boxdR", "boxdl", "boxdr", "boxh", "boxhD", "boxhU", "boxhd", "boxhu",
+  "boxminus", "boxplus", "boxtimes", "boxuL", "boxuR", "boxul", "boxur", "boxv",
+  "boxvH", "boxvL", "boxvR", "boxvh", "boxvl", "boxvr", "bprime", "breve",
+  "brvbar", "bscr", "bsemi", "bsim", "bsime", "bsol", "bsolb", "bsolhsub",
+  "bull", "bullet", "bump", "bumpE", "bumpe", "bumpeq", "cacute", "cap",
+  "capand", "capbrcup", "capcap", "capcup", "capdot", "caps", "caret", "caron",
+  "ccaps", "ccaron", "ccedil", "ccirc", "ccups", "ccupssm", "cdot", "cedil",
+  "cemptyv", "cent", "centerdot", "cfr", "chcy", "check", "checkmark", "chi",
+  "cir", "cirE", "circ", "circeq", "circlearrowleft", "circlearrowright", "circledR", "circledS",
+  "circledast", "circledcirc", "circleddash", "cire", "cirfnint", "cirmid", "cirscir", "clubs",
+  "clubsuit", "colon", "colone", "coloneq", "comma", "commat", "comp", "compfn",
+  "complement", "complexes", "cong", "congdot", "conint", "copf", "coprod", "copy",
+  "copysr", "crarr", "cross", "cscr", "csub", "csube", "csup", "csupe",
+  "ctdot", "cudarrl", "cudarrr", "cuepr", "cuesc", "cularr", "cularrp", "cup",
+  "cupbrcap", "cupcap", "cupcup", "cupdot", "cupor", "cups", "curarr", "curarrm",
+  "curlyeqprec", "curlyeqsucc", "curlyvee", "curlywedge", "curren", "curvearrowleft", "curvearrowright", "cuvee",
+  "cuwed", "cwconint", "cwint", "cylcty", "dArr", "dHar", "dagger", "daleth",
+  "darr", "dash", "dashv", "dbkarow", "dblac", "dcaron", "dcy", "dd",
+  "ddagger", "ddarr", "ddotseq", "deg", "delta", "demptyv", "dfisht", "dfr",
+  "dharl", "dharr", "diam", "diamond", "diamondsuit", "diams", "die", "digamma",
+  "disin", "div", "divide", "divideontimes", "divonx", "djcy", "dlcorn", "dlcrop",
+  "dollar", "dopf", "dot", "doteq", "doteqdot", "dotminus", "dotplus", "dotsquare",
+  "doublebarwedge", "downarrow", "downdownarrows", "downharpoonleft", "downharpoonright", "drbkarow", "drcorn", "drcrop",
+  "dscr", "dscy", "dsol", "dstrok", "dtdot", "dtri", "dtrif", "duarr",
+  "duhar", "dwangle", "dzcy", "dzigrarr", "eDDot", "eDot", "eacute", "easter",
+  "ecaron", "ecir", "ecirc", "ecolon", "ecy", "edot", "ee", "efDot",
+  "efr", "eg", "egrave", "egs", "egsdot", "el", "elinters", "ell",
+  "els", "elsdot", "emacr", "empty", "emptyset", "emptyv", "emsp", "emsp13",
+  "emsp14", "eng", "ensp", "eogon", "eopf", "epar", "eparsl", "eplus",
+  "epsi", "epsilon", "epsiv", "eqcirc", "eqcolon", "eqsim", "eqslantgtr", "eqslantless",
+  "equals", "equest", "equiv", "equivDD", "eqvparsl", "erDot", "erarr", "escr",
+  "esdot", "esim", "eta", "eth", "euml", "euro", "excl", "exist",
+  "expectation", "exponentiale", "fallingdotseq", "fcy", "female", "ffilig", "fflig", "ffllig",
+  "ffr", "filig", "fjlig", "flat", "fllig", "fltns", "fnof", "fopf",
+  "forall", "fork", "forkv", "fpartint", "frac12", "frac13", "frac14", "frac15",
+  "frac16", "frac18", "frac23", "frac25", "frac34", "frac35", "frac38", "frac45",
+  "frac56", "frac58", "frac78", "frasl", "frown", "fscr", "gE", "gEl",
+  "gacute", "gamma", "gammad", "gap", "gbreve", "gcirc", "gcy", "gdot",
+  "ge", "gel", "geq", "geqq", "geqslant", "ges", "gescc", "gesdot",
+  "gesdoto", "gesdotol", "gesl", "gesles", "gfr", "gg", "ggg", "gimel",
+  "gjcy", "gl", "glE", "gla", "glj", "gnE", "gnap", "gnapprox",
+  "gne", "gneq", "gneqq", "gnsim", "gopf", "grave", "gscr", "gsim",
+  "gsime", "gsiml", "gt", "gtcc", "gtcir", "gtdot", "gtlPar", "gtquest",
+  "gtrapprox", "gtrarr", "gtrdot", "gtreqless", "gtreqqless", "gtrless", "gtrsim", "gvertneqq",
+  "gvnE", "hArr", "hairsp", "half", "hamilt", "hardcy", "harr", "harrcir",
+  "harrw", "hbar", "hcirc", "hearts", "heartsuit", "hellip", "hercon", "hfr",
+  "hksearow", "hkswarow", "hoarr", "homtht", "hookleftarrow", "hookrightarrow", "hopf", "horbar",
+  "hscr", "hslash", "hstrok", "hybull", "hyphen", "iacute", "ic", "icirc",
+  "icy", "iecy", "iexcl", "iff", "ifr", "igrave", "ii", "iiiint",
+  "iiint", "iinfin", "iiota", "ijlig", "imacr", "image", "imagline", "imagpart",
+  "imath", "imof", "imped", "in", "incare", "infin", "infintie", "inodot",
+  "int", "intcal", "integers", "intercal", "intlarhk", "intprod", "iocy", "iogon",
+  "iopf", "iota", "iprod", "iquest", "iscr", "isin", "isinE", "isindot",
+  "isins", "isinsv", "isinv", "it", "itilde", "iukcy", "iuml", "jcirc",
+  "jcy", "jfr", "jmath", "jopf", "jscr", "jsercy", "jukcy", "kappa",
+  "kappav", "kcedil", "kcy", "kfr", "kgreen", "khcy", "kjcy", "kopf",
+  "kscr", "lAarr", "lArr", "lAtail", "lBarr", "lE", "lEg", "lHar",
+  "lacute", "laemptyv", "lagran", "lambda", "lang", "langd", "langle", "lap",
+  "laquo", "larr", "larrb", "larrbfs", "larrfs", "larrhk", "larrlp", "larrpl",
+  "larrsim", "larrtl", "lat", "latail", "late", "lates", "lbarr", "lbbrk",
+  "lbrace", "lbrack", "lbrke", "lbrksld", "lbrkslu", "lcaron", "lcedil", "lceil",
+  "lcub", "lcy", "ldca", "ldquo", "ldquor", "ldrdhar", "ldrushar", "ldsh",
+  "le", "leftarrow", "leftarrowtail", "leftharpoondown", "leftharpoonup", "leftleftarrows", "leftrightarrow", "leftrightarrows",
+  "leftrightharpoons", "leftrightsquigarrow", "leftthreetimes", "leg", "leq", "leqq", "leqslant", "les",
+  "lescc", "lesdot", "lesdoto", "lesdotor", "lesg", "lesges", "lessapprox", "lessdot",
+  "lesseqgtr", "lesseqqgtr", "lessgtr", "lesssim", "lfisht", "lfloor", "lfr", "lg",
+  "lgE", "lhard", "lharu", "lharul", "lhblk", "ljcy", "ll", "llarr",
+  "llcorner", "llhard", "lltri", "lmidot", "lmoust", "lmoustache", "lnE", "lnap",
+  "lnapprox", "lne", "lneq", "lneqq", "lnsim", "loang", "loarr", "lobrk",
+  "longleftarrow", "longleftrightarrow", "longmapsto", "longrightarrow", "looparrowleft", "looparrowright", "lopar", "lopf",
+  "loplus", "lotimes", "lowast", "lowbar", "loz", "lozenge", "lozf", "lpar",
+  "lparlt", "lrarr", "lrcorner", "lrhar", "lrhard", "lrm", "lrtri", "lsaquo",
+  "lscr", "lsh", "lsim", "lsime", "lsimg", "lsqb", "lsquo", "lsquor",
+  "lstrok", "lt", "ltcc", "ltcir", "ltdot", "lthree", "ltimes", "ltlarr",
+  "ltquest", "ltrPar", "ltri", "ltrie", "ltrif", "lurdshar", "luruhar", "lvertneqq",
+  "lvnE", "mDDot", "macr", "male", "malt", "maltese", "map", "mapsto",
+  "mapstodown", "mapstoleft", "mapstoup", "marker", "mcomma", "mcy", "mdash", "measuredangle",
+  "mfr", "mho", "micro", "mid", "midast", "midcir", "middot", "minus",
+  "minusb", "minusd", "minusdu", "mlcp", "mldr", "mnplus", "models", "mopf",
+  "mp", "mscr", "mstpos", "mu", "multimap", "mumap", "nGg", "nGt",
+  "nGtv", "nLeftarrow", "nLeftrightarrow", "nLl", "nLt", "nLtv", "nRightarrow", "nVDash",
+  "nVdash", "nabla", "nacute", "nang", "nap", "napE", "napid", "napos",
+  "napprox", "natur", "natural", "naturals", "nbsp", "nbump", "nbumpe", "ncap",
+  "ncaron", "ncedil", "ncong", "ncongdot", "ncup", "ncy", "ndash", "ne",
+  "neArr", "nearhk", "nearr", "nearrow", "nedot", "nequiv", "nesear", "nesim",
+  "nexist", "nexists", "nfr", "ngE", "nge", "ngeq", "ngeqq", "ngeqslant",
+  "nges", "ngsim", "ngt", "ngtr", "nhArr", "nharr", "nhpar", "ni",
+  "nis", "nisd", "niv", "njcy", "nlArr", "nlE", "nlarr", "nldr",
+  "nle", "nleftarrow", "nleftrightarrow", "nleq", "nleqq", "nleqslant", "nles", "nless",
+  "nlsim", "nlt", "nltri", "nltrie", "nmid", "nopf", "not", "notin",
+  "notinE", "notindot", "notinva", "notinvb", "notinvc", "notni", "notniva", "notnivb",
+  "notnivc", "npar", "nparallel", "nparsl", "npart", "npolint", "npr", "nprcue",
+  "npre", "nprec", "npreceq", "nrArr", "nrarr", "nrarrc", "nrarrw", "nrightarrow",
+  "nrtri", "nrtrie", "nsc", "nsccue", "nsce", "nscr", "nshortmid", "nshortparallel",
+  "nsim", "nsime", "nsimeq", "nsmid", "nspar", "nsqsube", "nsqsupe", "nsub",
+  "nsubE", "nsube", "nsubset", "nsubseteq", "nsubseteqq", "nsucc", "nsucceq", "nsup",
+  "nsupE", "nsupe", "nsupset", "nsupseteq", "nsupseteqq", "ntgl", "ntilde", "ntlg",
+  "ntriangleleft", "ntrianglelefteq", "ntriangleright", "ntrianglerighteq", "nu", "num", "numero", "numsp",
+  "nvDash", "nvHarr", "nvap", "nvdash", "nvge", "nvgt", "nvinfin", "nvlArr",
+  "nvle", "nvlt", "nvltrie", "nvrArr", "nvrtrie", "nvsim", "nwArr", "nwarhk",
+  "nwarr", "nwarrow", "nwnear", "oS", "oacute", "oast", "ocir", "ocirc",
+  "ocy", "odash", "odblac", "odiv", "odot", "odsold", "oelig", "ofcir",
+  "ofr", "ogon", "ograve", "ogt", "ohbar", "ohm", "oint", "olarr",
+  "olcir", "olcross", "oline", "olt", "omacr", "omega", "omicron", "omid",
+  "ominus", "oopf", "opar", "operp", "oplus", "or", "orarr", "ord",
+  "order", "orderof", "ordf", "ordm", "origof", "oror", "orslope", "orv",
+  "oscr", "oslash", "osol", "otilde", "otimes", "otimesas", "ouml", "ovbar",
+  "par", "para", "parallel", "parsim", "parsl", "part", "pcy", "percnt",
+  "period", "permil", "perp", "pertenk", "pfr", "phi", "phiv", "phmmat",
+  "phone", "pi", "pitchfork", "piv", "planck", "planckh", "plankv", "plus",
+  "plusacir", "plusb", "pluscir", "plusdo", "plusdu", "pluse", "plusmn", "plussim",
+  "plustwo", "pm", "pointint", "popf", "pound", "pr", "prE", "prap",
+  "prcue", "pre", "prec", "precapprox", "preccurlyeq", "preceq", "precnapprox", "precneqq",
+  "precnsim", "precsim", "prime", "primes", "prnE", "prnap", "prnsim", "prod",
+  "profalar", "profline", "profsurf", "prop", "propto", "prsim", "prurel", "pscr",
+  "psi", "puncsp", "qfr", "qint", "qopf", "qprime", "qscr", "quaternions",
+  "quatint", "quest", "questeq", "quot", "rAarr", "rArr", "rAtail", "rBarr",
+  "rHar", "race", "racute", "radic", "raemptyv", "rang", "rangd", "range",
+  "rangle", "raquo", "rarr", "rarrap", "rarrb", "rarrbfs", "rarrc", "rarrfs",
+  "rarrhk", "rarrlp", "rarrpl", "rarrsim", "rarrtl", "rarrw", "ratail", "ratio",
+  "rationals", "rbarr", "rbbrk", "rbrace", "rbrack", "rbrke", "rbrksld", "rbrkslu",
+  "rcaron", "rcedil", "rceil", "rcub", "rcy", "rdca", "rdldhar", "rdquo",
+  "rdquor", "rdsh", "real", "realine", "realpart", "reals", "rect", "reg",
+  "rfisht", "rfloor", "rfr", "rhard", "rharu", "rharul", "rho", "rhov",
+  "rightarrow", "rightarrowtail", "rightharpoondown", "rightharpoonup", "rightleftarrows", "rightleftharpoons", "rightrightarrows", "rightsquigarrow",
+  "rightthreetimes", "ring", "risingdotseq", "rlarr", "rlhar", "rlm", "rmoust", "rmoustache",
+  "rnmid", "roang", "roarr", "robrk", "ropar", "ropf", "roplus", "rotimes",
+  "rpar", "rpargt", "rppolint", "rrarr", "rsaquo", "rscr", "rsh", "rsqb",
+  "rsquo", "rsquor", "rthree", "rtimes", "rtri", "rtrie", "rtrif", "rtriltri",
+  "ruluhar", "rx", "sacute", "sbquo", "sc", "scE", "scap", "scaron",
+  "sccue", "sce", "scedil", "scirc", "scnE", "scnap", "scnsim", "scpolint",
+  "scsim", "scy", "sdot", "sdotb", "sdote", "seArr", "searhk", "searr",
+  "searrow", "sect", "semi", "seswar", "setminus", "setmn", "sext", "sfr",
+  "sfrown", "sharp", "shchcy", "shcy", "shortmid", "shortparallel", "shy", "sigma",
+  "sigmaf", "sigmav", "sim", "simdot", "sime", "simeq", "simg", "simgE",
+  "siml", "simlE", "simne", "simplus", "simrarr", "slarr", "smallsetminus", "smashp",
+  "smeparsl", "smid", "smile", "smt", "smte", "smtes", "softcy", "sol",
+  "solb", "solbar", "sopf", "spades", "spadesuit", "spar", "sqcap", "sqcaps",
+  "sqcup", "sqcups", "sqsub", "sqsube", "sqsubset", "sqsubseteq", "sqsup", "sqsupe",
+  "sqsupset", "sqsupseteq", "squ", "square", "squarf", "squf", "srarr", "sscr",
+  "ssetmn", "ssmile", "sstarf", "star", "starf", "straightepsilon", "straightphi", "strns",
+  "sub", "subE", "subdot", "sube", "subedot", "submult", "subnE", "subne",
+  "subplus", "subrarr", "subset", "subseteq", "subseteqq", "subsetneq", "subsetneqq", "subsim",
+  "subsub", "subsup", "succ", "succapprox", "succcurlyeq", "succeq", "succnapprox", "succneqq",
+  "succnsim", "succsim", "sum", "sung", "sup", "sup1", "sup2", "sup3",
+  "supE", "supdot", "supdsub", "supe", "supedot", "suphsol", "suphsub", "suplarr",
+  "supmult", "supnE", "supne", "supplus", "supset", "supseteq", "supseteqq", "supsetneq",
+  "supsetneqq", "supsim", "supsub", "supsup", "swArr", "swarhk", "swarr", "swarrow",
+  "swnwar", "szlig", "target", "tau", "tbrk", "tcaron", "tcedil", "tcy",
+  "tdot", "telrec", "tfr", "there4", "therefore", "theta", "thetasym", "thetav",
+  "thickapprox", "thicksim", "thinsp", "thkap", "thksim", "thorn", "tilde", "times",
+  "timesb", "timesbar", "timesd", "tint", "toea", "top", "topbot", "topcir",
+  "topf", "topfork", "tosa", "tprime", "trade", "triangle", "triangledown", "triangleleft",
+  "trianglelefteq", "triangleq", "triangleright", "trianglerighteq", "tridot", "trie", "triminus", "triplus",
+  "trisb", "tritime", "trpezium", "tscr", "tscy", "tshcy", "tstrok", "twixt",
+  "twoheadleftarrow", "twoheadrightarrow", "uArr", "uHar", "uacute", "uarr", "ubrcy", "ubreve",
+  "ucirc", "ucy", "udarr", "udblac", "udhar", "ufisht", "ufr", "ugrave",
+  "uharl", "uharr", "uhblk", "ulcorn", "ulcorner", "ulcrop", "ultri", "umacr",
+  "uml", "uogon", "uopf", "uparrow", "updownarrow", "upharpoonleft", "upharpoonright", "uplus",
+  "upsi", "upsih", "upsilon", "upuparrows", "urcorn", "urcorner", "urcrop", "uring",
+  "urtri", "uscr", "utdot", "utilde", "utri", "utrif", "uuarr", "uuml",
+  "uwangle", "vArr", "vBar", "vBarv", "vDash", "vangrt", "varepsilon", "varkappa",
+  "varnothing", "varphi", "varpi", "varpropto", "varr", "varrho", "varsigma", "varsubsetneq",
+  "varsubsetneqq", "varsupsetneq", "varsupsetneqq", "vartheta", "vartriangleleft", "vartriangleright", "vcy", "vdash",
+  "vee", "veebar", "veeeq", "vellip", "verbar", "vert", "vfr", "vltri",
+  "vnsub", "vnsup", "vopf", "vprop", "vrtri", "vscr", "vsubnE", "vsubne",
+  "vsupnE", "vsupne", "vzigzag", "wcirc", "wedbar", "wedge", "wedgeq", "weierp",
+  "wfr", "wopf", "wp", "wr", "wreath", "wscr", "xcap", "xcirc",
+  "xcup", "xdtri", "xfr", "xhArr", "xharr", "xi", "xlArr", "xlarr",
+  "xmap", "xnis", "xodot", "xopf", "xoplus", "xotime", "xrArr", "xrarr",
+  "xscr", "xsqcup", "xuplus", "xutri", "xvee", "xwedge", "yacute", "yacy",
+  "ycirc", "ycy", "yen", "yfr", "yicy", "yopf", "yscr", "yucy",
+  "yuml", "zacute", "zcaron", "zcy", "zdot", "zeetrf", "zeta", "zfr",
+  "zhcy", "zigrarr", "zopf", "zscr", "zwj", "zwnj"
+  };
+
+static const unsigned char entities_lengths[ENTITIES_COUNT] =
+  {
+  0, 5, 3, 6, 6, 5, 3, 3, 6, 5, 5, 3, 5, 4, 13, 5,
+  4, 6, 6, 4, 9, 4, 6, 3, 7, 10, 4, 3, 4, 5, 4, 6,
+  4, 4, 6, 3, 20, 7, 6, 6, 5, 7, 4, 7, 9, 3, 3, 9,
+  11, 10, 11, 24, 21, 15, 5, 6, 9, 6, 15, 4, 9, 31, 5, 4,
+  3, 6, 2, 8, 4, 4, 4, 6, 4, 5, 6, 3, 3, 5, 3, 16,
+  14, 22, 16, 16, 7, 13, 4, 3, 6, 8, 21, 9, 15, 15, 20, 13,
+  19, 24, 20, 16, 14, 13, 17, 17, 9, 12, 16, 9, 19, 17, 14, 17,
+  18, 15, 18, 7, 12, 9, 4, 6, 3, 3, 6, 6, 5, 3, 4, 3,
+  6, 7, 5, 16, 20, 5, 4, 7, 5, 10, 11, 4, 4, 3, 4, 6,
+  12, 3, 3, 17, 21, 4, 6, 10, 4, 4, 2, 5, 6, 6, 6, 5,
+  3, 4, 3, 2, 4, 12, 16, 16, 14, 11, 17, 12, 4, 2, 6, 5,
+  3, 5, 3, 12, 4, 14, 4, 6, 12, 9, 4, 5, 4, 6, 5, 3,
+  4, 3, 6, 2, 5, 10, 7, 3, 8, 12, 14, 14, 5, 4, 4, 4,
+  6, 5, 4, 5, 3, 3, 4, 4, 6, 5, 4, 4, 5, 6, 3, 3,
+  4, 4, 4, 2, 6, 6, 4, 10, 4, 6, 6, 3, 16, 9, 12, 19,
+  11, 17, 17, 14, 17, 9, 14, 15, 7, 12, 13, 12, 15, 17, 16, 15,
+  12, 15, 10, 13, 9, 14, 16, 13, 11, 8, 14, 9, 3, 2, 10, 6,
+  13, 18, 14, 13, 18, 14, 4, 14, 15, 4, 3, 6, 2, 3, 3, 11,
+  9, 3, 9, 4, 4, 2, 4, 6, 6, 6, 3, 19, 18, 17, 21, 20,
+  14, 7, 3, 7, 16, 4, 3, 12, 9, 20, 10, 8, 13, 9, 10, 15,
+  19, 17, 14, 20, 15, 15, 12, 15, 18, 20, 7, 12, 14, 11, 17, 12,
+  23, 17, 11, 16, 21, 17, 16, 19, 21, 15, 20, 17, 22, 9, 14, 11,
+  16, 21, 16, 11, 16, 8, 13, 17, 13, 14, 4, 6, 2, 5, 6, 5,
+  3, 6, 3, 6, 5, 5, 7, 4, 20, 14, 2, 4, 6, 6, 6, 4,
+  7, 9, 11, 15, 8, 3, 3, 3, 2, 9, 13, 4, 2, 8, 13, 18,
+  13, 5, 7, 10, 12, 4, 3, 4, 3, 4, 4, 5, 3, 6, 4, 4,
+  6, 6, 6, 3, 2, 14, 18, 20, 3, 3, 17, 10, 13, 19, 12, 18,
+  18, 15, 18, 10, 8, 13, 14, 13, 16, 18, 17, 16, 13, 16, 11, 14,
+  10, 4, 12, 11, 4, 3, 11, 6, 4, 6, 6, 2, 6, 6, 5, 3,
+  3, 14, 14, 15, 12, 5, 11, 4, 4, 6, 18, 12, 17, 14, 19, 11,
+  4, 4, 3, 6, 11, 8, 13, 18, 13, 8, 3, 3, 8, 13, 6, 5,
+  5, 5, 4, 3, 3, 6, 6, 3, 3, 9, 5, 10, 9, 5, 10, 14,
+  10, 4, 9, 4, 6, 6, 4, 8, 5, 6, 5, 3, 6, 3, 6, 5,
+  8, 10, 12, 16, 5, 9, 5, 4, 7, 10, 16, 11, 13, 5, 10, 7,
+  11, 14, 15, 4, 7, 5, 4, 6, 4, 5, 4, 3, 5, 6, 3, 6,
+  4, 11, 12, 17, 13, 13, 3, 4, 4, 6, 5, 5, 3, 4, 4, 3,
+  2, 4, 4, 4, 4, 4, 6, 5, 3, 3, 4, 4, 4, 4, 6, 6,
+  3, 4, 14, 4, 3, 4, 4, 6, 6, 2, 3, 3, 5, 5, 3, 5,
+  2, 3, 6, 7, 5, 5, 5, 5, 3, 3, 6, 4, 8, 4, 3, 4,
+  5, 6, 8, 8, 8, 8, 8, 8, 8, 8, 5, 7, 8, 6, 5, 7,
+  5, 4, 2, 3, 6, 3, 4, 4, 6, 8, 5, 4, 3, 5, 7, 6,
+  4, 8, 5, 4, 8, 11, 9, 7, 9, 6, 6, 8, 4, 8, 5, 3,
+  5, 6, 7, 7, 5, 6, 4, 4, 7, 3, 6, 7, 6, 7, 8, 9,
+  8, 7, 15, 13, 8, 6, 8, 6, 12, 11, 13, 17, 17, 18, 5, 5,
+  5, 5, 5, 3, 7, 4, 4, 3, 6, 6, 5, 5, 5, 5, 4, 5,
+  5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 6, 5,
+  5, 5, 5, 4, 5, 5, 5, 5, 8, 7, 8, 5, 5, 5, 5, 4,
+  5, 5, 5, 5, 5, 5, 6, 5, 6, 4, 5, 4, 5, 4, 5, 8,
+  4, 6, 4, 5, 5, 6, 6, 3, 6, 8, 6, 6, 6, 4, 5, 5,
+  5, 6, 6, 5, 5, 7, 4, 5, 7, 4, 9, 3, 4, 5, 9, 3,
+  3, 4, 4, 6, 15, 16, 8, 8, 10, 11, 11, 4, 8, 6, 7, 5,
+  8, 5, 6, 7, 5, 6, 4, 6, 10, 9, 4, 7, 6, 4, 6, 4,
+  6, 5, 5, 4, 4, 5, 4, 5, 5, 7, 7, 5, 5, 6, 7, 3,
+  8, 6, 6, 6, 5, 4, 6, 7, 11, 11, 8, 10, 6, 14, 15, 5,
+  5, 8, 5, 6, 4, 4, 6, 6, 4, 4, 5, 7, 5, 6, 3, 2,
+  7, 5, 7, 3, 5, 7, 6, 3, 5, 5, 4, 7, 11, 5, 3, 7,
+  5, 3, 6, 13, 6, 4, 6, 6, 6, 4, 3, 5, 8, 8, 7, 9,
+  14, 9, 14, 15, 16, 8, 6, 6, 4, 4, 4, 6, 5, 4, 5, 5,
+  5, 7, 4, 8, 5, 4, 6, 6, 6, 4, 5, 6, 3, 4, 2, 5,
+  3, 2, 6, 3, 6, 2, 8, 3, 3, 6, 5, 5, 8, 6, 4, 6,
+  6, 3, 4, 5, 4, 4, 6, 5, 4, 7, 5, 6, 7, 5, 10, 11,
+  6, 6, 5, 7, 8, 5, 5, 4, 5, 4, 3, 3, 4, 4, 4, 5,
+  11, 12, 13, 3, 6, 6, 5, 6, 3, 5, 5, 4, 5, 5, 4, 4,
+  6, 4, 5, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 5, 5, 4, 2, 3, 6, 5, 6, 3, 6, 5, 3, 4,
+  2, 3, 3, 4, 8, 3, 5, 6, 7, 8, 4, 6, 3, 2, 3, 5,
+  4, 2, 3, 3, 3, 3, 4, 8, 3, 4, 5, 5, 4, 5, 4, 4,
+  5, 5, 2, 4, 5, 5, 6, 7, 9, 6, 6, 9, 10, 7, 6, 9,
+  4, 4, 6, 4, 6, 6, 4, 7, 5, 4, 5, 6, 9, 6, 6, 3,
+  8, 8, 5, 6, 13, 14, 4, 6, 4, 6, 6, 6, 6, 6, 2, 5,
+  3, 4, 5, 3, 3, 6, 2, 6, 5, 6, 5, 5, 5, 5, 8, 8,
+  5, 4, 5, 2, 6, 5, 8, 6, 3, 6, 8, 8, 8, 7, 4, 5,
+  4, 4, 5, 6, 4, 4, 5, 7, 5, 6, 5, 2, 6, 5, 4, 5,
+  3, 3, 5, 4, 4, 6, 5, 5, 6, 6, 3, 3, 6, 4, 4, 4,
+  4, 5, 4, 6, 5, 2, 3, 4, 6, 8, 6, 6, 4, 5, 6, 3,
+  5, 4, 5, 7, 6, 6, 6, 6, 7, 6, 3, 6, 4, 5, 5, 5,
+  6, 6, 5, 7, 7, 6, 6, 5, 4, 3, 4, 5, 6, 7, 8, 4,
+  2, 9, 13, 15, 13, 14, 14, 15, 17, 19, 14, 3, 3, 4, 8, 3,
+  5, 6, 7, 8, 4, 6, 10, 7, 9, 10, 7, 7, 6, 6, 3, 2,
+  3, 5, 5, 6, 5, 4, 2, 5, 8, 6, 5, 6, 6, 10, 3, 4,
+  8, 3, 4, 5, 5, 5, 5, 5, 13, 18, 10, 14, 13, 14, 5, 4,
+  6, 7, 6, 6, 3, 7, 4, 4, 6, 5, 8, 5, 6, 3, 5, 6,
+  4, 3, 4, 5, 5, 4, 5, 6, 6, 2, 4, 5, 5, 6, 6, 6,
+  7, 6, 4, 5, 5, 8, 7, 9, 4, 5, 4, 4, 4, 7, 3, 6,
+  10, 10, 8, 6, 6, 3, 5, 13, 3, 3, 5, 3, 6, 6, 6, 5,
+  6, 6, 7, 4, 4, 6, 6, 4, 2, 4, 6, 2, 8, 5, 3, 3,
+  4, 10, 15, 3, 3, 4, 11, 6, 6, 5, 6, 4, 3, 4, 5, 5,
+  7, 5, 7, 8, 4, 5, 6, 4, 6, 6, 5, 8, 4, 3, 5, 2,
+  5, 6, 5, 7, 5, 6, 6, 5, 6, 7, 3, 3, 3, 4, 5, 9,
+  4, 5, 3, 4, 5, 5, 5, 2, 3, 4, 3, 4, 5, 3, 5, 4,
+  3, 10, 15, 4, 5, 9, 4, 5, 5, 3, 5, 6, 4, 4, 3, 5,
+  6, 8, 7, 7, 7, 5, 7, 7, 7, 4, 9, 6, 5, 7, 3, 6,
+  4, 5, 7, 5, 5, 6, 6, 11, 5, 6, 3, 6, 4, 4, 9, 14,
+  4, 5, 6, 5, 5, 7, 7, 4, 5, 5, 7, 9, 10, 5, 7, 4,
+  5, 5, 7, 9, 10, 4, 6, 4, 13, 15, 14, 16, 2, 3, 6, 5,
+  6, 6, 4, 6, 4, 4, 7, 6, 4, 4, 7, 6, 7, 5, 5, 6,
+  5, 7, 6, 2, 6, 4, 4, 5, 3, 5, 6, 4, 4, 6, 5, 5,
+  3, 4, 6, 3, 5, 3, 4, 5, 5, 7, 5, 3, 5, 5, 7, 4,
+  6, 4, 4, 5, 5, 2, 5, 3, 5, 7, 4, 4, 6, 4, 7, 3,
+  4, 6, 4, 6, 6, 8, 4, 5, 3, 4, 8, 6, 5, 4, 3, 6,
+  6, 6, 4, 7, 3, 3, 4, 6, 5, 2, 9, 3, 6, 7, 6, 4,
+  8, 5, 7, 6, 6, 5, 6, 7, 7, 2, 8, 4, 5, 2, 3, 4,
+  5, 3, 4, 10, 11, 6, 11, 8, 8, 7, 5, 6, 4, 5, 6, 4,
+  8, 8, 8, 4, 6, 5, 6, 4, 3, 6, 3, 4, 4, 6, 4, 11,
+  7, 5, 7, 4, 5, 4, 6, 5, 4, 4, 6, 5, 8, 4, 5, 5,
+  6, 5, 4, 6, 5, 7, 5, 6, 6, 6, 6, 7, 6, 5, 6, 5,
+  9, 5, 5, 6, 6, 5, 7, 7, 6, 6, 5, 4, 3, 4, 7, 5,
+  6, 4, 4, 7, 8, 5, 4, 3, 6, 6, 3, 5, 5, 6, 3, 4,
+  10, 14, 16, 14, 15, 17, 16, 15, 15, 4, 12, 5, 5, 3, 6, 10,
+  5, 5, 5, 5, 5, 4, 6, 7, 4, 6, 8, 5, 6, 4, 3, 4,
+  5, 6, 6, 6, 4, 5, 5, 8, 7, 2, 6, 5, 2, 3, 4, 6,
+  5, 3, 6, 5, 4, 5, 6, 8, 5, 3, 4, 5, 5, 5, 6, 5,
+  7, 4, 4, 6, 8, 5, 4, 3, 6, 5, 6, 4, 8, 13, 3, 5,
+  6, 6, 3, 6, 4, 5, 4, 5, 4, 5, 5, 7, 7, 5, 13, 6,
+  8, 4, 5, 3, 4, 5, 6, 3, 4, 6, 4, 6, 9, 4, 5, 6,
+  5, 6, 5, 6, 8, 10, 5, 6, 8, 10, 3, 6, 6, 4, 5, 4,
+  6, 6, 6, 4, 5, 15, 11, 5, 3, 4, 6, 4, 7, 7, 5, 5,
+  7, 7, 6, 8, 9, 9, 10, 6, 6, 6, 4, 10, 11, 6, 11, 8,
+  8, 7, 3, 4, 3, 4, 4, 4, 4, 6, 7, 4, 7, 7, 7, 7,
+  7, 5, 5, 7, 6, 8, 9, 9, 10, 6, 6, 6, 5, 6, 5, 7,
+  6, 5, 6, 3, 4, 6, 6, 3, 4, 6, 3, 6, 9, 5, 8, 6,
+  11, 8, 6, 5, 6, 5, 5, 5, 6, 8, 6, 4, 4, 3, 6, 6,
+  4, 7, 4, 6, 5, 8, 12, 12, 14, 9, 13, 15, 6, 4, 8, 7,
+  5, 7, 8, 4, 4, 5, 6, 5, 16, 17, 4, 4, 6, 4, 5, 6,
+  5, 3, 5, 6, 5, 6, 3, 6, 5, 5, 5, 6, 8, 6, 5, 5,
+  3, 5, 4, 7, 11, 13, 14, 5, 4, 5, 7, 10, 6, 8, 6, 5,
+  5, 4, 5, 6, 4, 5, 5, 4, 7, 4, 4, 5, 5, 6, 10, 8,
+  10, 6, 5, 9, 4, 6, 8, 12, 13, 12, 13, 8, 15, 16, 3, 5,
+  3, 6, 5, 6, 6, 4, 3, 5, 5, 5, 4, 5, 5, 4, 6, 6,
+  6, 6, 7, 5, 6, 5, 6, 6, 3, 4, 2, 2, 6, 4, 4, 5,
+  4, 5, 3, 5, 5, 2, 5, 5, 4, 4, 5, 4, 6, 6, 5, 5,
+  4, 6, 6, 5, 4, 6, 6, 4, 5, 3, 3, 3, 4, 4, 4, 4,
+  4, 6, 6, 3, 4, 6, 4, 3, 4, 7, 4, 4, 3, 4
+  };
+
+static const uint32_t entities_chars[ENTITIES_COUNT][2] =
+  {
+  { 0, 0 }, { 0x00C6, 0x0000 }, { 0x0026, 0x0000 }, { 0x00C1, 0x0000 }, { 0x0102, 0x0000 }, { 0x00C2, 0x0000 },
+  { 0x0410, 0x0000 }, { 0x1D504, 0x0000 }, { 0x00C0, 0x0000 }, { 0x0391, 0x0000 }, { 0x0100, 0x0000 }, { 0x2A53, 0x0000 },
+  { 0x0104, 0x0000 }, { 0x1D538, 0x0000 }, { 0x2061, 0x0000 }, { 0x00C5, 0x0000 }, { 0x1D49C, 0x0000 }, { 0x2254, 0x0000 },
+  { 0x00C3, 0x0000 }, { 0x00C4, 0x0000 }, { 0x2216, 0x0000 }, { 0x2AE7, 0x0000 }, { 0x2306, 0x0000 }, { 0x0411, 0x0000 },
+  { 0x2235, 0x0000 }, { 0x212C, 0x0000 }, { 0x0392, 0x0000 }, { 0x1D505, 0x0000 }, { 0x1D539, 0x0000 }, { 0x02D8, 0x0000 },
+  { 0x212C, 0x0000 }, { 0x224E, 0x0000 }, { 0x0427, 0x0000 }, { 0x00A9, 0x0000 }, { 0x0106, 0x0000 }, { 0x22D2, 0x0000 },
+  { 0x2145, 0x0000 }, { 0x212D, 0x0000 }, { 0x010C, 0x0000 }, { 0x00C7, 0x0000 }, { 0x0108, 0x0000 }, { 0x2230, 0x0000 },
+  { 0x010A, 0x0000 }, { 0x00B8, 0x0000 }, { 0x00B7, 0x0000 }, { 0x212D, 0x0000 }, { 0x03A7, 0x0000 }, { 0x2299, 0x0000 },
+  { 0x2296, 0x0000 }, { 0x2295, 0x0000 }, { 0x2297, 0x0000 }, { 0x2232, 0x0000 }, { 0x201D, 0x0000 }, { 0x2019, 0x0000 },
+  { 0x2237, 0x0000 }, { 0x2A74, 0x0000 }, { 0x2261, 0x0000 }, { 0x222F, 0x0000 }, { 0x222E, 0x0000 }, { 0x2102, 0x0000 },
+  { 0x2210, 0x0000 }, { 0x2233, 0x0000 }, { 0x2A2F, 0x0000 }, { 0x1D49E, 0x0000 }, { 0x22D3, 0x0000 }, { 0x224D, 0x0000 },
+  { 0x2145, 0x0000 }, { 0x2911, 0x0000 }, { 0x0402, 0x0000 }, { 0x0405, 0x0000 }, { 0x040F, 0x0000 }, { 0x2021, 0x0000 },
+  { 0x21A1, 0x0000 }, { 0x2AE4, 0x0000 }, { 0x010E, 0x0000 }, { 0x0414, 0x0000 }, { 0x2207, 0x0000 }, { 0x0394, 0x0000 },
+  { 0x1D507, 0x0000 }, { 0x00B4, 0x0000 }, { 0x02D9, 0x0000 }, { 0x02DD, 0x0000 }, { 0x0060, 0x0000 }, { 0x02DC, 0x0000 },
+  { 0x22C4, 0x0000 }, { 0x2146, 0x0000 }, { 0x1D53B, 0x0000 }, { 0x00A8, 0x0000 }, { 0x20DC, 0x0000 }, { 0x2250, 0x0000 },
+  { 0x222F, 0x0000 }, { 0x00A8, 0x0000 }, { 0x21D3, 0x0000 }, { 0x21D0, 0x0000 }, { 0x21D4, 0x0000 }, { 0x2AE4, 0x0000 },
+  { 0x27F8, 0x0000 }, { 0x27FA, 0x0000 }, { 0x27F9, 0x0000 }, { 0x21D2, 0x0000 }, { 0x22A8, 0x0000 }, { 0x21D1, 0x0000 },
+  { 0x21D5, 0x0000 }, { 0x2225, 0x0000 }, { 0x2193, 0x0000 }, { 0x2913, 0x0000 }, { 0x21F5, 0x0000 }, { 0x0311, 0x0000 },
+  { 0x2950, 0x0000 }, { 0x295E, 0x0000 }, { 0x21BD, 0x0000 }, { 0x2956, 0x0000 }, { 0x295F, 0x0000 }, { 0x21C1, 0x0000 },
+  { 0x2957, 0x0000 }, { 0x22A4, 0x0000 }, { 0x21A7, 0x0000 }, { 0x21D3, 0x0000 }, { 0x1D49F, 0x0000 }, { 0x0110, 0x0000 },
+  { 0x014A, 0x0000 }, { 0x00D0, 0x0000 }, { 0x00C9, 0x0000 }, { 0x011A, 0x0000 }, { 0x00CA, 0x0000 }, { 0x042D, 0x0000 },
+  { 0x0116, 0x0000 }, { 0x1D508, 0x0000 }, { 0x00C8, 0x0000 }, { 0x2208, 0x0000 }, { 0x0112, 0x0000 }, { 0x25FB, 0x0000 },
+  { 0x25AB, 0x0000 }, { 0x0118, 0x0000 }, { 0x1D53C, 0x0000 }, { 0x0395, 0x0000 }, { 0x2A75, 0x0000 }, { 0x2242, 0x0000 },
+  { 0x21CC, 0x0000 }, { 0x2130, 0x0000 }, { 0x2A73, 0x0000 }, { 0x0397, 0x0000 }, { 0x00CB, 0x0000 }, { 0x2203, 0x0000 },
+  { 0x2147, 0x0000 }, { 0x0424, 0x0000 }, { 0x1D509, 0x0000 }, { 0x25FC, 0x0000 }, { 0x25AA, 0x0000 }, { 0x1D53D, 0x0000 },
+  { 0x2200, 0x0000 }, { 0x2131, 0x0000 }, { 0x2131, 0x0000 }, { 0x0403, 0x0000 }, { 0x003E, 0x0000 }, { 0x0393, 0x0000 },
+  { 0x03DC, 0x0000 }, { 0x011E, 0x0000 }, { 0x0122, 0x0000 }, { 0x011C, 0x0000 }, { 0x0413, 0x0000 }, { 0x0120, 0x0000 },
+  { 0x1D50A, 0x0000 }, { 0x22D9, 0x0000 }, { 0x1D53E, 0x0000 }, { 0x2265, 0x0000 }, { 0x22DB, 0x0000 }, { 0x2267, 0x0000 },
+  { 0x2AA2, 0x0000 }, { 0x2277, 0x0000 }, { 0x2A7E, 0x0000 }, { 0x2273, 0x0000 }, { 0x1D4A2, 0x0000 }, { 0x226B, 0x0000 },
+  { 0x042A, 0x0000 }, { 0x02C7, 0x0000 }, { 0x005E, 0x0000 }, { 0x0124, 0x0000 }, { 0x210C, 0x0000 }, { 0x210B, 0x0000 },
+  { 0x210D, 0x0000 }, { 0x2500, 0x0000 }, { 0x210B, 0x0000 }, { 0x0126, 0x0000 }, { 0x224E, 0x0000 }, { 0x224F, 0x0000 },
+  { 0x0415, 0x0000 }, { 0x0132, 0x0000 }, { 0x0401, 0x0000 }, { 0x00CD, 0x0000 }, { 0x00CE, 0x0000 }, { 0x0418, 0x0000 },
+  { 0x0130, 0x0000 }, { 0x2111, 0x0000 }, { 0x00CC, 0x0000 }, { 0x2111, 0x0000 }, { 0x012A, 0x0000 }, { 0x2148, 0x0000 },
+  { 0x21D2, 0x0000 }, { 0x222C, 0x0000 }, { 0x222B, 0x0000 }, { 0x22C2, 0x0000 }, { 0x2063, 0x0000 }, { 0x2062, 0x0000 },
+  { 0x012E, 0x0000 }, { 0x1D540, 0x0000 }, { 0x0399, 0x0000 }, { 0x2110, 0x0000 }, { 0x0128, 0x0000 }, { 0x0406, 0x0000 },
+  { 0x00CF, 0x0000 }, { 0x0134, 0x0000 }, { 0x0419, 0x0000 }, { 0x1D50D, 0x0000 }, { 0x1D541, 0x0000 }, { 0x1D4A5, 0x0000 },
+  { 0x0408, 0x0000 }, { 0x0404, 0x0000 }, { 0x0425, 0x0000 }, { 0x040C, 0x0000 }, { 0x039A, 0x0000 }, { 0x0136, 0x0000 },
+  { 0x041A, 0x0000 }, { 0x1D50E, 0x0000 }, { 0x1D542, 0x0000 }, { 0x1D4A6, 0x0000 }, { 0x0409, 0x0000 }, { 0x003C, 0x0000 },
+  { 0x0139, 0x0000 }, { 0x039B, 0x0000 }, { 0x27EA, 0x0000 }, { 0x2112, 0x0000 }, { 0x219E, 0x0000 }, { 0x013D, 0x0000 },
+  { 0x013B, 0x0000 }, { 0x041B, 0x0000 }, { 0x27E8, 0x0000 }, { 0x2190, 0x0000 }, { 0x21E4, 0x0000 }, { 0x21C6, 0x0000 },
+  { 0x2308, 0x0000 }, { 0x27E6, 0x0000 }, { 0x2961, 0x0000 }, { 0x21C3, 0x0000 }, { 0x2959, 0x0000 }, { 0x230A, 0x0000 },
+  { 0x2194, 0x0000 }, { 0x294E, 0x0000 }, { 0x22A3, 0x0000 }, { 0x21A4, 0x0000 }, { 0x295A, 0x0000 }, { 0x22B2, 0x0000 },
+  { 0x29CF, 0x0000 }, { 0x22B4, 0x0000 }, { 0x2951, 0x0000 }, { 0x2960, 0x0000 }, { 0x21BF, 0x0000 }, { 0x2958, 0x0000 },
+  { 0x21BC, 0x0000 }, { 0x2952, 0x0000 }, { 0x21D0, 0x0000 }, { 0x21D4, 0x0000 }, { 0x22DA, 0x0000 }, { 0x2266, 0x0000 },
+  { 0x2276, 0x0000 }, { 0x2AA1, 0x0000 }, { 0x2A7D, 0x0000 }, { 0x2272, 0x0000 }, { 0x1D50F, 0x0000 }, { 0x22D8, 0x0000 },
+  { 0x21DA, 0x0000 }, { 0x013F, 0x0000 }, { 0x27F5, 0x0000 }, { 0x27F7, 0x0000 }, { 0x27F6, 0x0000 }, { 0x27F8, 0x0000 },
+  { 0x27FA, 0x0000 }, { 0x27F9, 0x0000 }, { 0x1D543, 0x0000 }, { 0x2199, 0x0000 }, { 0x2198, 0x0000 }, { 0x2112, 0x0000 },
+  { 0x21B0, 0x0000 }, { 0x0141, 0x0000 }, { 0x226A, 0x0000 }, { 0x2905, 0x0000 }, { 0x041C, 0x0000 }, { 0x205F, 0x0000 },
+  { 0x2133, 0x0000 }, { 0x1D510, 0x0000 }, { 0x2213, 0x0000 }, { 0x1D544, 0x0000 }, { 0x2133, 0x0000 }, { 0x039C, 0x0000 },
+  { 0x040A, 0x0000 }, { 0x0143, 0x0000 }, { 0x0147, 0x0000 }, { 0x0145, 0x0000 }, { 0x041D, 0x0000 }, { 0x200B, 0x0000 },
+  { 0x200B, 0x0000 }, { 0x200B, 0x0000 }, { 0x200B, 0x0000 }, { 0x226B, 0x0000 }, { 0x226A, 0x0000 }, { 0x000A, 0x0000 },
+  { 0x1D511, 0x0000 }, { 0x2060, 0x0000 }, { 0x0020, 0x0000 }, { 0x2115, 0x0000 }, { 0x2AEC, 0x0000 }, { 0x2262, 0x0000 },
+  { 0x226D, 0x0000 }, { 0x2226, 0x0000 }, { 0x2209, 0x0000 }, { 0x2260, 0x0000 }, { 0x2242, 0x0338 }, { 0x2204, 0x0000 },
+  { 0x226F, 0x0000 }, { 0x2271, 0x0000 }, { 0x2267, 0x0338 }, { 0x226B, 0x0338 }, { 0x2279, 0x0000 }, { 0x2A7E, 0x0338 },
+  { 0x2275, 0x0000 }, { 0x224E, 0x0338 }, { 0x224F, 0x0338 }, { 0x22EA, 0x0000 }, { 0x29CF, 0x0338 }, { 0x22EC, 0x0000 },
+  { 0x226E, 0x0000 }, { 0x2270, 0x0000 }, { 0x2278, 0x0000 }, { 0x226A, 0x0338 }, { 0x2A7D, 0x0338 }, { 0x2274, 0x0000 },
+  { 0x2AA2, 0x0338 }, { 0x2AA1, 0x0338 }, { 0x2280, 0x0000 }, { 0x2AAF, 0x0338 }, { 0x22E0, 0x0000 }, { 0x220C, 0x0000 },
+  { 0x22EB, 0x0000 }, { 0x29D0, 0x0338 }, { 0x22ED, 0x0000 }, { 0x228F, 0x0338 }, { 0x22E2, 0x0000 }, { 0x2290, 0x0338 },
+  { 0x22E3, 0x0000 }, { 0x2282, 0x20D2 }, { 0x2288, 0x0000 }, { 0x2281, 0x0000 }, { 0x2AB0, 0x0338 }, { 0x22E1, 0x0000 },
+  { 0x227F, 0x0338 }, { 0x2283, 0x20D2 }, { 0x2289, 0x0000 }, { 0x2241, 0x0000 }, { 0x2244, 0x0000 }, { 0x2247, 0x0000 },
+  { 0x2249, 0x0000 }, { 0x2224, 0x0000 }, { 0x1D4A9, 0x0000 }, { 0x00D1, 0x0000 }, { 0x039D, 0x0000 }, { 0x0152, 0x0000 },
+  { 0x00D3, 0x0000 }, { 0x00D4, 0x0000 }, { 0x041E, 0x0000 }, { 0x0150, 0x0000 }, { 0x1D512, 0x0000 }, { 0x00D2, 0x0000 },
+  { 0x014C, 0x0000 }, { 0x03A9, 0x0000 }, { 0x039F, 0x0000 }, { 0x1D546, 0x0000 }, { 0x201C, 0x0000 }, { 0x2018, 0x0000 },
+  { 0x2A54, 0x0000 }, { 0x1D4AA, 0x0000 }, { 0x00D8, 0x0000 }, { 0x00D5, 0x0000 }, { 0x2A37, 0x0000 }, { 0x00D6, 0x0000 },
+  { 0x203E, 0x0000 }, { 0x23DE, 0x0000 }, { 0x23B4, 0x0000 }, { 0x23DC, 0x0000 }, { 0x2202, 0x0000 }, { 0x041F, 0x0000 },
+  { 0x1D513, 0x0000 }, { 0x03A6, 0x0000 }, { 0x03A0, 0x0000 }, { 0x00B1, 0x0000 }, { 0x210C, 0x0000 }, { 0x2119, 0x0000 },
+  { 0x2ABB, 0x0000 }, { 0x227A, 0x0000 }, { 0x2AAF, 0x0000 }, { 0x227C, 0x0000 }, { 0x227E, 0x0000 }, { 0x2033, 0x0000 },
+  { 0x220F, 0x0000 }, { 0x2237, 0x0000 }, { 0x221D, 0x0000 }, { 0x1D4AB, 0x0000 }, { 0x03A8, 0x0000 }, { 0x0022, 0x0000 },
+  { 0x1D514, 0x0000 }, { 0x211A, 0x0000 }, { 0x1D4AC, 0x0000 }, { 0x2910, 0x0000 }, { 0x00AE, 0x0000 }, { 0x0154, 0x0000 },
+  { 0x27EB, 0x0000 }, { 0x21A0, 0x0000 }, { 0x2916, 0x0000 }, { 0x0158, 0x0000 }, { 0x0156, 0x0000 }, { 0x0420, 0x0000 },
+  { 0x211C, 0x0000 }, { 0x220B, 0x0000 }, { 0x21CB, 0x0000 }, { 0x296F, 0x0000 }, { 0x211C, 0x0000 }, { 0x03A1, 0x0000 },
+  { 0x27E9, 0x0000 }, { 0x2192, 0x0000 }, { 0x21E5, 0x0000 }, { 0x21C4, 0x0000 }, { 0x2309, 0x0000 }, { 0x27E7, 0x0000 },
+  { 0x295D, 0x0000 }, { 0x21C2, 0x0000 }, { 0x2955, 0x0000 }, { 0x230B, 0x0000 }, { 0x22A2, 0x0000 }, { 0x21A6, 0x0000 },
+  { 0x295B, 0x0000 }, { 0x22B3, 0x0000 }, { 0x29D0, 0x0000 }, { 0x22B5, 0x0000 }, { 0x294F, 0x0000 }, { 0x295C, 0x0000 },
+  { 0x21BE, 0x0000 }, { 0x2954, 0x0000 }, { 0x21C0, 0x0000 }, { 0x2953, 0x0000 }, { 0x21D2, 0x0000 }, { 0x211D, 0x0000 },
+  { 0x2970, 0x0000 }, { 0x21DB, 0x0000 }, { 0x211B, 0x0000 }, { 0x21B1, 0x0000 }, { 0x29F4, 0x0000 }, { 0x0429, 0x0000 },
+  { 0x0428, 0x0000 }, { 0x042C, 0x0000 }, { 0x015A, 0x0000 }, { 0x2ABC, 0x0000 }, { 0x0160, 0x0000 }, { 0x015E, 0x0000 },
+  { 0x015C, 0x0000 }, { 0x0421, 0x0000 }, { 0x1D516, 0x0000 }, { 0x2193, 0x0000 }, { 0x2190, 0x0000 }, { 0x2192, 0x0000 },
+  { 0x2191, 0x0000 }, { 0x03A3, 0x0000 }, { 0x2218, 0x0000 }, { 0x1D54A, 0x0000 }, { 0x221A, 0x0000 }, { 0x25A1, 0x0000 },
+  { 0x2293, 0x0000 }, { 0x228F, 0x0000 }, { 0x2291, 0x0000 }, { 0x2290, 0x0000 }, { 0x2292, 0x0000 }, { 0x2294, 0x0000 },
+  { 0x1D4AE, 0x0000 }, { 0x22C6, 0x0000 }, { 0x22D0, 0x0000 }, { 0x22D0, 0x0000 }, { 0x2286, 0x0000 }, { 0x227B, 0x0000 },
+  { 0x2AB0, 0x0000 }, { 0x227D, 0x0000 }, { 0x227F, 0x0000 }, { 0x220B, 0x0000 }, { 0x2211, 0x0000 }, { 0x22D1, 0x0000 },
+  { 0x2283, 0x0000 }, { 0x2287, 0x0000 }, { 0x22D1, 0x0000 }, { 0x00DE, 0x0000 }, { 0x2122, 0x0000 }, { 0x040B, 0x0000 },
+  { 0x0426, 0x0000 }, { 0x0009, 0x0000 }, { 0x03A4, 0x0000 }, { 0x0164, 0x0000 }, { 0x0162, 0x0000 }, { 0x0422, 0x0000 },
+  { 0x1D517, 0x0000 }, { 0x2234, 0x0000 }, { 0x0398, 0x0000 }, { 0x205F, 0x200A }, { 0x2009, 0x0000 }, { 0x223C, 0x0000 },
+  { 0x2243, 0x0000 }, { 0x2245, 0x0000 }, { 0x2248, 0x0000 }, { 0x1D54B, 0x0000 }, { 0x20DB, 0x0000 }, { 0x1D4AF, 0x0000 },
+  { 0x0166, 0x0000 }, { 0x00DA, 0x0000 }, { 0x219F, 0x0000 }, { 0x2949, 0x0000 }, { 0x040E, 0x0000 }, { 0x016C, 0x0000 },
+  { 0x00DB, 0x0000 }, { 0x0423, 0x0000 }, { 0x0170, 0x0000 }, { 0x1D518, 0x0000 }, { 0x00D9, 0x0000 }, { 0x016A, 0x0000 },
+  { 0x005F, 0x0000 }, { 0x23DF, 0x0000 }, { 0x23B5, 0x0000 }, { 0x23DD, 0x0000 }, { 0x22C3, 0x0000 }, { 0x228E, 0x0000 },
+  { 0x0172, 0x0000 }, { 0x1D54C, 0x0000 }, { 0x2191, 0x0000 }, { 0x2912, 0x0000 }, { 0x21C5, 0x0000 }, { 0x2195, 0x0000 },
+  { 0x296E, 0x0000 }, { 0x22A5, 0x0000 }, { 0x21A5, 0x0000 }, { 0x21D1, 0x0000 }, { 0x21D5, 0x0000 }, { 0x2196, 0x0000 },
+  { 0x2197, 0x0000 }, { 0x03D2, 0x0000 }, { 0x03A5, 0x0000 }, { 0x016E, 0x0000 }, { 0x1D4B0, 0x0000 }, { 0x0168, 0x0000 },
+  { 0x00DC, 0x0000 }, { 0x22AB, 0x0000 }, { 0x2AEB, 0x0000 }, { 0x0412, 0x0000 }, { 0x22A9, 0x0000 }, { 0x2AE6, 0x0000 },
+  { 0x22C1, 0x0000 }, { 0x2016, 0x0000 }, { 0x2016, 0x0000 }, { 0x2223, 0x0000 }, { 0x007C, 0x0000 }, { 0x2758, 0x0000 },
+  { 0x2240, 0x0000 }, { 0x200A, 0x0000 }, { 0x1D519, 0x0000 }, { 0x1D54D, 0x0000 }, { 0x1D4B1, 0x0000 }, { 0x22AA, 0x0000 },
+  { 0x0174, 0x0000 }, { 0x22C0, 0x0000 }, { 0x1D51A, 0x0000 }, { 0x1D54E, 0x0000 }, { 0x1D4B2, 0x0000 }, { 0x1D51B, 0x0000 },
+  { 0x039E, 0x0000 }, { 0x1D54F, 0x0000 }, { 0x1D4B3, 0x0000 }, { 0x042F, 0x0000 }, { 0x0407, 0x0000 }, { 0x042E, 0x0000 },
+  { 0x00DD, 0x0000 }, { 0x0176, 0x0000 }, { 0x042B, 0x0000 }, { 0x1D51C, 0x0000 }, { 0x1D550, 0x0000 }, { 0x1D4B4, 0x0000 },
+  { 0x0178, 0x0000 }, { 0x0416, 0x0000 }, { 0x0179, 0x0000 }, { 0x017D, 0x0000 }, { 0x0417, 0x0000 }, { 0x017B, 0x0000 },
+  { 0x200B, 0x0000 }, { 0x0396, 0x0000 }, { 0x2128, 0x0000 }, { 0x2124, 0x0000 }, { 0x1D4B5, 0x0000 }, { 0x00E1, 0x0000 },
+  { 0x0103, 0x0000 }, { 0x223E, 0x0000 }, { 0x223E, 0x0333 }, { 0x223F, 0x0000 }, { 0x00E2, 0x0000 }, { 0x00B4, 0x0000 },
+  { 0x0430, 0x0000 }, { 0x00E6, 0x0000 }, { 0x2061, 0x0000 }, { 0x1D51E, 0x0000 }, { 0x00E0, 0x0000 }, { 0x2135, 0x0000 },
+  { 0x2135, 0x0000 }, { 0x03B1, 0x0000 }, { 0x0101, 0x0000 }, { 0x2A3F, 0x0000 }, { 0x0026, 0x0000 }, { 0x2227, 0x0000 },
+  { 0x2A55, 0x0000 }, { 0x2A5C, 0x0000 }, { 0x2A58, 0x0000 }, { 0x2A5A, 0x0000 }, { 0x2220, 0x0000 }, { 0x29A4, 0x0000 },
+  { 0x2220, 0x0000 }, { 0x2221, 0x0000 }, { 0x29A8, 0x0000 }, { 0x29A9, 0x0000 }, { 0x29AA, 0x0000 }, { 0x29AB, 0x0000 },
+  { 0x29AC, 0x0000 }, { 0x29AD, 0x0000 }, { 0x29AE, 0x0000 }, { 0x29AF, 0x0000 }, { 0x221F, 0x0000 }, { 0x22BE, 0x0000 },
+  { 0x299D, 0x0000 }, { 0x2222, 0x0000 }, { 0x00C5, 0x0000 }, { 0x237C, 0x0000 }, { 0x0105, 0x0000 }, { 0x1D552, 0x0000 },
+  { 0x2248, 0x0000 }, { 0x2A70, 0x0000 }, { 0x2A6F, 0x0000 }, { 0x224A, 0x0000 }, { 0x224B, 0x0000 }, { 0x0027, 0x0000 },
+  { 0x2248, 0x0000 }, { 0x224A, 0x0000 }, { 0x00E5, 0x0000 }, { 0x1D4B6, 0x0000 }, { 0x002A, 0x0000 }, { 0x2248, 0x0000 },
+  { 0x224D, 0x0000 }, { 0x00E3, 0x0000 }, { 0x00E4, 0x0000 }, { 0x2233, 0x0000 }, { 0x2A11, 0x0000 }, { 0x2AED, 0x0000 },
+  { 0x224C, 0x0000 }, { 0x03F6, 0x0000 }, { 0x2035, 0x0000 }, { 0x223D, 0x0000 }, { 0x22CD, 0x0000 }, { 0x22BD, 0x0000 },
+  { 0x2305, 0x0000 }, { 0x2305, 0x0000 }, { 0x23B5, 0x0000 }, { 0x23B6, 0x0000 }, { 0x224C, 0x0000 }, { 0x0431, 0x0000 },
+  { 0x201E, 0x0000 }, { 0x2235, 0x0000 }, { 0x2235, 0x0000 }, { 0x29B0, 0x0000 }, { 0x03F6, 0x0000 }, { 0x212C, 0x0000 },
+  { 0x03B2, 0x0000 }, { 0x2136, 0x0000 }, { 0x226C, 0x0000 }, { 0x1D51F, 0x0000 }, { 0x22C2, 0x0000 }, { 0x25EF, 0x0000 },
+  { 0x22C3, 0x0000 }, { 0x2A00, 0x0000 }, { 0x2A01, 0x0000 }, { 0x2A02, 0x0000 }, { 0x2A06, 0x0000 }, { 0x2605, 0x0000 },
+  { 0x25BD, 0x0000 }, { 0x25B3, 0x0000 }, { 0x2A04, 0x0000 }, { 0x22C1, 0x0000 }, { 0x22C0, 0x0000 }, { 0x290D, 0x0000 },
+  { 0x29EB, 0x0000 }, { 0x25AA, 0x0000 }, { 0x25B4, 0x0000 }, { 0x25BE, 0x0000 }, { 0x25C2, 0x0000 }, { 0x25B8, 0x0000 },
+  { 0x2423, 0x0000 }, { 0x2592, 0x0000 }, { 0x2591, 0x0000 }, { 0x2593, 0x0000 }, { 0x2588, 0x0000 }, { 0x003D, 0x20E5 },
+  { 0x2261, 0x20E5 }, { 0x2310, 0x0000 }, { 0x1D553, 0x0000 }, { 0x22A5, 0x0000 }, { 0x22A5, 0x0000 }, { 0x22C8, 0x0000 },
+  { 0x2557, 0x0000 }, { 0x2554, 0x0000 }, { 0x2556, 0x0000 }, { 0x2553, 0x0000 }, { 0x2550, 0x0000 }, { 0x2566, 0x0000 },
+  { 0x2569, 0x0000 }, { 0x2564, 0x0000 }, { 0x2567, 0x0000 }, { 0x255D, 0x0000 }, { 0x255A, 0x0000 }, { 0x255C, 0x0000 },
+  { 0x2559, 0x0000 }, { 0x2551, 0x0000 }, { 0x256C, 0x0000 }, { 0x2563, 0x0000 }, { 0x2560, 0x0000 }, { 0x256B, 0x0000 },
+  { 0x2562, 0x0000 }, { 0x255F, 0x0000 }, { 0x29C9, 0x0000 }, { 0x2555, 0x0000 }, { 0x2552, 0x0000 }, { 0x2510, 0x0000 },
+  { 0x250C, 0x0000 }, { 0x2500, 0x0000 }, { 0x2565, 0x0000 }, { 0x2568, 0x0000 }, { 0x252C, 0x0000 }, { 0x2534, 0x0000 },
+  { 0x229F, 0x0000 }, { 0x229E, 0x0000 }, { 0x22A0, 0x0000 }, { 0x255B, 0x0000 }, { 0x2558, 0x0000 }, { 0x2518, 0x0000 },
+  { 0x2514, 0x0000 }, { 0x2502, 0x0000 }, { 0x256A, 0x0000 }, { 0x2561, 0x0000 }, { 0x255E, 0x0000 }, { 0x253C, 0x0000 },
+  { 0x2524, 0x0000 }, { 0x251C, 0x0000 }, { 0x2035, 0x0000 }, { 0x02D8, 0x0000 }, { 0x00A6, 0x0000 }, { 0x1D4B7, 0x0000 },
+  { 0x204F, 0x0000 }, { 0x223D, 0x0000 }, { 0x22CD, 0x0000 }, { 0x005C, 0x0000 }, { 0x29C5, 0x0000 }, { 0x27C8, 0x0000 },
+  { 0x2022, 0x0000 }, { 0x2022, 0x0000 }, { 0x224E, 0x0000 }, { 0x2AAE, 0x0000 }, { 0x224F, 0x0000 }, { 0x224F, 0x0000 },
+  { 0x0107, 0x0000 }, { 0x2229, 0x0000 }, { 0x2A44, 0x0000 }, { 0x2A49, 0x0000 }, { 0x2A4B, 0x0000 }, { 0x2A47, 0x0000 },
+  { 0x2A40, 0x0000 }, { 0x2229, 0xFE00 }, { 0x2041, 0x0000 }, { 0x02C7, 0x0000 }, { 0x2A4D, 0x0000 }, { 0x010D, 0x0000 },
+  { 0x00E7, 0x0000 }, { 0x0109, 0x0000 }, { 0x2A4C, 0x0000 }, { 0x2A50, 0x0000 }, { 0x010B, 0x0000 }, { 0x00B8, 0x0000 },
+  { 0x29B2, 0x0000 }, { 0x00A2, 0x0000 }, { 0x00B7, 0x0000 }, { 0x1D520, 0x0000 }, { 0x0447, 0x0000 }, { 0x2713, 0x0000 },
+  { 0x2713, 0x0000 }, { 0x03C7, 0x0000 }, { 0x25CB, 0x0000 }, { 0x29C3, 0x0000 }, { 0x02C6, 0x0000 }, { 0x2257, 0x0000 },
+  { 0x21BA, 0x0000 }, { 0x21BB, 0x0000 }, { 0x00AE, 0x0000 }, { 0x24C8, 0x0000 }, { 0x229B, 0x0000 }, { 0x229A, 0x0000 },
+  { 0x229D, 0x0000 }, { 0x2257, 0x0000 }, { 0x2A10, 0x0000 }, { 0x2AEF, 0x0000 }, { 0x29C2, 0x0000 }, { 0x2663, 0x0000 },
+  { 0x2663, 0x0000 }, { 0x003A, 0x0000 }, { 0x2254, 0x0000 }, { 0x2254, 0x0000 }, { 0x002C, 0x0000 }, { 0x0040, 0x0000 },
+  { 0x2201, 0x0000 }, { 0x2218, 0x0000 }, { 0x2201, 0x0000 }, { 0x2102, 0x0000 }, { 0x2245, 0x0000 }, { 0x2A6D, 0x0000 },
+  { 0x222E, 0x0000 }, { 0x1D554, 0x0000 }, { 0x2210, 0x0000 }, { 0x00A9, 0x0000 }, { 0x2117, 0x0000 }, { 0x21B5, 0x0000 },
+  { 0x2717, 0x0000 }, { 0x1D4B8, 0x0000 }, { 0x2ACF, 0x0000 }, { 0x2AD1, 0x0000 }, { 0x2AD0, 0x0000 }, { 0x2AD2, 0x0000 },
+  { 0x22EF, 0x0000 }, { 0x2938, 0x0000 }, { 0x2935, 0x0000 }, { 0x22DE, 0x0000 }, { 0x22DF, 0x0000 }, { 0x21B6, 0x0000 },
+  { 0x293D, 0x0000 }, { 0x222A, 0x0000 }, { 0x2A48, 0x0000 }, { 0x2A46, 0x0000 }, { 0x2A4A, 0x0000 }, { 0x228D, 0x0000 },
+  { 0x2A45, 0x0000 }, { 0x222A, 0xFE00 }, { 0x21B7, 0x0000 }, { 0x293C, 0x0000 }, { 0x22DE, 0x0000 }, { 0x22DF, 0x0000 },
+  { 0x22CE, 0x0000 }, { 0x22CF, 0x0000 }, { 0x00A4, 0x0000 }, { 0x21B6, 0x0000 }, { 0x21B7, 0x0000 }, { 0x22CE, 0x0000 },
+  { 0x22CF, 0x0000 }, { 0x2232, 0x0000 }, { 0x2231, 0x0000 }, { 0x232D, 0x0000 }, { 0x21D3, 0x0000 }, { 0x2965, 0x0000 },
+  { 0x2020, 0x0000 }, { 0x2138, 0x0000 }, { 0x2193, 0x0000 }, { 0x2010, 0x0000 }, { 0x22A3, 0x0000 }, { 0x290F, 0x0000 },
+  { 0x02DD, 0x0000 }, { 0x010F, 0x0000 }, { 0x0434, 0x0000 }, { 0x2146, 0x0000 }, { 0x2021, 0x0000 }, { 0x21CA, 0x0000 },
+  { 0x2A77, 0x0000 }, { 0x00B0, 0x0000 }, { 0x03B4, 0x0000 }, { 0x29B1, 0x0000 }, { 0x297F, 0x0000 }, { 0x1D521, 0x0000 },
+  { 0x21C3, 0x0000 }, { 0x21C2, 0x0000 }, { 0x22C4, 0x0000 }, { 0x22C4, 0x0000 }, { 0x2666, 0x0000 }, { 0x2666, 0x0000 },
+  { 0x00A8, 0x0000 }, { 0x03DD, 0x0000 }, { 0x22F2, 0x0000 }, { 0x00F7, 0x0000 }, { 0x00F7, 0x0000 }, { 0x22C7, 0x0000 },
+  { 0x22C7, 0x0000 }, { 0x0452, 0x0000 }, { 0x231E, 0x0000 }, { 0x230D, 0x0000 }, { 0x0024, 0x0000 }, { 0x1D555, 0x0000 },
+  { 0x02D9, 0x0000 }, { 0x2250, 0x0000 }, { 0x2251, 0x0000 }, { 0x2238, 0x0000 }, { 0x2214, 0x0000 }, { 0x22A1, 0x0000 },
+  { 0x2306, 0x0000 }, { 0x2193, 0x0000 }, { 0x21CA, 0x0000 }, { 0x21C3, 0x0000 }, { 0x21C2, 0x0000 }, { 0x2910, 0x0000 },
+  { 0x231F, 0x0000 }, { 0x230C, 0x0000 }, { 0x1D4B9, 0x0000 }, { 0x0455, 0x0000 }, { 0x29F6, 0x0000 }, { 0x0111, 0x0000 },
+  { 0x22F1, 0x0000 }, { 0x25BF, 0x0000 }, { 0x25BE, 0x0000 }, { 0x21F5, 0x0000 }, { 0x296F, 0x0000 }, { 0x29A6, 0x0000 },
+  { 0x045F, 0x0000 }, { 0x27FF, 0x0000 }, { 0x2A77, 0x0000 }, { 0x2251, 0x0000 }, { 0x00E9, 0x0000 }, { 0x2A6E, 0x0000 },
+  { 0x011B, 0x0000 }, { 0x2256, 0x0000 }, { 0x00EA, 0x0000 }, { 0x2255, 0x0000 }, { 0x044D, 0x0000 }, { 0x0117, 0x0000 },
+  { 0x2147, 0x0000 }, { 0x2252, 0x0000 }, { 0x1D522, 0x0000 }, { 0x2A9A, 0x0000 }, { 0x00E8, 0x0000 }, { 0x2A96, 0x0000 },
+  { 0x2A98, 0x0000 }, { 0x2A99, 0x0000 }, { 0x23E7, 0x0000 }, { 0x2113, 0x0000 }, { 0x2A95, 0x0000 }, { 0x2A97, 0x0000 },
+  { 0x0113, 0x0000 }, { 0x2205, 0x0000 }, { 0x2205, 0x0000 }, { 0x2205, 0x0000 }, { 0x2003, 0x0000 }, { 0x2004, 0x0000 },
+  { 0x2005, 0x0000 }, { 0x014B, 0x0000 }, { 0x2002, 0x0000 }, { 0x0119, 0x0000 }, { 0x1D556, 0x0000 }, { 0x22D5, 0x0000 },
+  { 0x29E3, 0x0000 }, { 0x2A71, 0x0000 }, { 0x03B5, 0x0000 }, { 0x03B5, 0x0000 }, { 0x03F5, 0x0000 }, { 0x2256, 0x0000 },
+  { 0x2255, 0x0000 }, { 0x2242, 0x0000 }, { 0x2A96, 0x0000 }, { 0x2A95, 0x0000 }, { 0x003D, 0x0000 }, { 0x225F, 0x0000 },
+  { 0x2261, 0x0000 }, { 0x2A78, 0x0000 }, { 0x29E5, 0x0000 }, { 0x2253, 0x0000 }, { 0x2971, 0x0000 }, { 0x212F, 0x0000 },
+  { 0x2250, 0x0000 }, { 0x2242, 0x0000 }, { 0x03B7, 0x0000 }, { 0x00F0, 0x0000 }, { 0x00EB, 0x0000 }, { 0x20AC, 0x0000 },
+  { 0x0021, 0x0000 }, { 0x2203, 0x0000 }, { 0x2130, 0x0000 }, { 0x2147, 0x0000 }, { 0x2252, 0x0000 }, { 0x0444, 0x0000 },
+  { 0x2640, 0x0000 }, { 0xFB03, 0x0000 }, { 0xFB00, 0x0000 }, { 0xFB04, 0x0000 }, { 0x1D523, 0x0000 }, { 0xFB01, 0x0000 },
+  { 0x0066, 0x006A }, { 0x266D, 0x0000 }, { 0xFB02, 0x0000 }, { 0x25B1, 0x0000 }, { 0x0192, 0x0000 }, { 0x1D557, 0x0000 },
+  { 0x2200, 0x0000 }, { 0x22D4, 0x0000 }, { 0x2AD9, 0x0000 }, { 0x2A0D, 0x0000 }, { 0x00BD, 0x0000 }, { 0x2153, 0x0000 },
+  { 0x00BC, 0x0000 }, { 0x2155, 0x0000 }, { 0x2159, 0x0000 }, { 0x215B, 0x0000 }, { 0x2154, 0x0000 }, { 0x2156, 0x0000 },
+  { 0x00BE, 0x0000 }, { 0x2157, 0x0000 }, { 0x215C, 0x0000 }, { 0x2158, 0x0000 }, { 0x215A, 0x0000 }, { 0x215D, 0x0000 },
+  { 0x215E, 0x0000 }, { 0x2044, 0x0000 }, { 0x2322, 0x0000 }, { 0x1D4BB, 0x0000 }, { 0x2267, 0x0000 }, { 0x2A8C, 0x0000 },
+  { 0x01F5, 0x0000 }, { 0x03B3, 0x0000 }, { 0x03DD, 0x0000 }, { 0x2A86, 0x0000 }, { 0x011F, 0x0000 }, { 0x011D, 0x0000 },
+  { 0x0433, 0x0000 }, { 0x0121, 0x0000 }, { 0x2265, 0x0000 }, { 0x22DB, 0x0000 }, { 0x2265, 0x0000 }, { 0x2267, 0x0000 },
+  { 0x2A7E, 0x0000 }, { 0x2A7E, 0x0000 }, { 0x2AA9, 0x0000 }, { 0x2A80, 0x0000 }, { 0x2A82, 0x0000 }, { 0x2A84, 0x0000 },
+  { 0x22DB, 0xFE00 }, { 0x2A94, 0x0000 }, { 0x1D524, 0x0000 }, { 0x226B, 0x0000 }, { 0x22D9, 0x0000 }, { 0x2137, 0x0000 },
+  { 0x0453, 0x0000 }, { 0x2277, 0x0000 }, { 0x2A92, 0x0000 }, { 0x2AA5, 0x0000 }, { 0x2AA4, 0x0000 }, { 0x2269, 0x0000 },
+  { 0x2A8A, 0x0000 }, { 0x2A8A, 0x0000 }, { 0x2A88, 0x0000 }, { 0x2A88, 0x0000 }, { 0x2269, 0x0000 }, { 0x22E7, 0x0000 },
+  { 0x1D558, 0x0000 }, { 0x0060, 0x0000 }, { 0x210A, 0x0000 }, { 0x2273, 0x0000 }, { 0x2A8E, 0x0000 }, { 0x2A90, 0x0000 },
+  { 0x003E, 0x0000 }, { 0x2AA7, 0x0000 }, { 0x2A7A, 0x0000 }, { 0x22D7, 0x0000 }, { 0x2995, 0x0000 }, { 0x2A7C, 0x0000 },
+  { 0x2A86, 0x0000 }, { 0x2978, 0x0000 }, { 0x22D7, 0x0000 }, { 0x22DB, 0x0000 }, { 0x2A8C, 0x0000 }, { 0x2277, 0x0000 },
+  { 0x2273, 0x0000 }, { 0x2269, 0xFE00 }, { 0x2269, 0xFE00 }, { 0x21D4, 0x0000 }, { 0x200A, 0x0000 }, { 0x00BD, 0x0000 },
+  { 0x210B, 0x0000 }, { 0x044A, 0x0000 }, { 0x2194, 0x0000 }, { 0x2948, 0x0000 }, { 0x21AD, 0x0000 }, { 0x210F, 0x0000 },
+  { 0x0125, 0x0000 }, { 0x2665, 0x0000 }, { 0x2665, 0x0000 }, { 0x2026, 0x0000 }, { 0x22B9, 0x0000 }, { 0x1D525, 0x0000 },
+  { 0x2925, 0x0000 }, { 0x2926, 0x0000 }, { 0x21FF, 0x0000 }, { 0x223B, 0x0000 }, { 0x21A9, 0x0000 }, { 0x21AA, 0x0000 },
+  { 0x1D559, 0x0000 }, { 0x2015, 0x0000 }, { 0x1D4BD, 0x0000 }, { 0x210F, 0x0000 }, { 0x0127, 0x0000 }, { 0x2043, 0x0000 },
+  { 0x2010, 0x0000 }, { 0x00ED, 0x0000 }, { 0x2063, 0x0000 }, { 0x00EE, 0x0000 }, { 0x0438, 0x0000 }, { 0x0435, 0x0000 },
+  { 0x00A1, 0x0000 }, { 0x21D4, 0x0000 }, { 0x1D526, 0x0000 }, { 0x00EC, 0x0000 }, { 0x2148, 0x0000 }, { 0x2A0C, 0x0000 },
+  { 0x222D, 0x0000 }, { 0x29DC, 0x0000 }, { 0x2129, 0x0000 }, { 0x0133, 0x0000 }, { 0x012B, 0x0000 }, { 0x2111, 0x0000 },
+  { 0x2110, 0x0000 }, { 0x2111, 0x0000 }, { 0x0131, 0x0000 }, { 0x22B7, 0x0000 }, { 0x01B5, 0x0000 }, { 0x2208, 0x0000 },
+  { 0x2105, 0x0000 }, { 0x221E, 0x0000 }, { 0x29DD, 0x0000 }, { 0x0131, 0x0000 }, { 0x222B, 0x0000 }, { 0x22BA, 0x0000 },
+  { 0x2124, 0x0000 }, { 0x22BA, 0x0000 }, { 0x2A17, 0x0000 }, { 0x2A3C, 0x0000 }, { 0x0451, 0x0000 }, { 0x012F, 0x0000 },
+  { 0x1D55A, 0x0000 }, { 0x03B9, 0x0000 }, { 0x2A3C, 0x0000 }, { 0x00BF, 0x0000 }, { 0x1D4BE, 0x0000 }, { 0x2208, 0x0000 },
+  { 0x22F9, 0x0000 }, { 0x22F5, 0x0000 }, { 0x22F4, 0x0000 }, { 0x22F3, 0x0000 }, { 0x2208, 0x0000 }, { 0x2062, 0x0000 },
+  { 0x0129, 0x0000 }, { 0x0456, 0x0000 }, { 0x00EF, 0x0000 }, { 0x0135, 0x0000 }, { 0x0439, 0x0000 }, { 0x1D527, 0x0000 },
+  { 0x0237, 0x0000 }, { 0x1D55B, 0x0000 }, { 0x1D4BF, 0x0000 }, { 0x0458, 0x0000 }, { 0x0454, 0x0000 }, { 0x03BA, 0x0000 },
+  { 0x03F0, 0x0000 }, { 0x0137, 0x0000 }, { 0x043A, 0x0000 }, { 0x1D528, 0x0000 }, { 0x0138, 0x0000 }, { 0x0445, 0x0000 },
+  { 0x045C, 0x0000 }, { 0x1D55C, 0x0000 }, { 0x1D4C0, 0x0000 }, { 0x21DA, 0x0000 }, { 0x21D0, 0x0000 }, { 0x291B, 0x0000 },
+  { 0x290E, 0x0000 }, { 0x2266, 0x0000 }, { 0x2A8B, 0x0000 }, { 0x2962, 0x0000 }, { 0x013A, 0x0000 }, { 0x29B4, 0x0000 },
+  { 0x2112, 0x0000 }, { 0x03BB, 0x0000 }, { 0x27E8, 0x0000 }, { 0x2991, 0x0000 }, { 0x27E8, 0x0000 }, { 0x2A85, 0x0000 },
+  { 0x00AB, 0x0000 }, { 0x2190, 0x0000 }, { 0x21E4, 0x0000 }, { 0x291F, 0x0000 }, { 0x291D, 0x0000 }, { 0x21A9, 0x0000 },
+  { 0x21AB, 0x0000 }, { 0x2939, 0x0000 }, { 0x2973, 0x0000 }, { 0x21A2, 0x0000 }, { 0x2AAB, 0x0000 }, { 0x2919, 0x0000 },
+  { 0x2AAD, 0x0000 }, { 0x2AAD, 0xFE00 }, { 0x290C, 0x0000 }, { 0x2772, 0x0000 }, { 0x007B, 0x0000 }, { 0x005B, 0x0000 },
+  { 0x298B, 0x0000 }, { 0x298F, 0x0000 }, { 0x298D, 0x0000 }, { 0x013E, 0x0000 }, { 0x013C, 0x0000 }, { 0x2308, 0x0000 },
+  { 0x007B, 0x0000 }, { 0x043B, 0x0000 }, { 0x2936, 0x0000 }, { 0x201C, 0x0000 }, { 0x201E, 0x0000 }, { 0x2967, 0x0000 },
+  { 0x294B, 0x0000 }, { 0x21B2, 0x0000 }, { 0x2264, 0x0000 }, { 0x2190, 0x0000 }, { 0x21A2, 0x0000 }, { 0x21BD, 0x0000 },
+  { 0x21BC, 0x0000 }, { 0x21C7, 0x0000 }, { 0x2194, 0x0000 }, { 0x21C6, 0x0000 }, { 0x21CB, 0x0000 }, { 0x21AD, 0x0000 },
+  { 0x22CB, 0x0000 }, { 0x22DA, 0x0000 }, { 0x2264, 0x0000 }, { 0x2266, 0x0000 }, { 0x2A7D, 0x0000 }, { 0x2A7D, 0x0000 },
+  { 0x2AA8, 0x0000 }, { 0x2A7F, 0x0000 }, { 0x2A81, 0x0000 }, { 0x2A83, 0x0000 }, { 0x22DA, 0xFE00 }, { 0x2A93, 0x0000 },
+  { 0x2A85, 0x0000 }, { 0x22D6, 0x0000 }, { 0x22DA, 0x0000 }, { 0x2A8B, 0x0000 }, { 0x2276, 0x0000 }, { 0x2272, 0x0000 },
+  { 0x297C, 0x0000 }, { 0x230A, 0x0000 }, { 0x1D529, 0x0000 }, { 0x2276, 0x0000 }, { 0x2A91, 0x0000 }, { 0x21BD, 0x0000 },
+  { 0x21BC, 0x0000 }, { 0x296A, 0x0000 }, { 0x2584, 0x0000 }, { 0x0459, 0x0000 }, { 0x226A, 0x0000 }, { 0x21C7, 0x0000 },
+  { 0x231E, 0x0000 }, { 0x296B, 0x0000 }, { 0x25FA, 0x0000 }, { 0x0140, 0x0000 }, { 0x23B0, 0x0000 }, { 0x23B0, 0x0000 },
+  { 0x2268, 0x0000 }, { 0x2A89, 0x0000 }, { 0x2A89, 0x0000 }, { 0x2A87, 0x0000 }, { 0x2A87, 0x0000 }, { 0x2268, 0x0000 },
+  { 0x22E6, 0x0000 }, { 0x27EC, 0x0000 }, { 0x21FD, 0x0000 }, { 0x27E6, 0x0000 }, { 0x27F5, 0x0000 }, { 0x27F7, 0x0000 },
+  { 0x27FC, 0x0000 }, { 0x27F6, 0x0000 }, { 0x21AB, 0x0000 }, { 0x21AC, 0x0000 }, { 0x2985, 0x0000 }, { 0x1D55D, 0x0000 },
+  { 0x2A2D, 0x0000 }, { 0x2A34, 0x0000 }, { 0x2217, 0x0000 }, { 0x005F, 0x0000 }, { 0x25CA, 0x0000 }, { 0x25CA, 0x0000 },
+  { 0x29EB, 0x0000 }, { 0x0028, 0x0000 }, { 0x2993, 0x0000 }, { 0x21C6, 0x0000 }, { 0x231F, 0x0000 }, { 0x21CB, 0x0000 },
+  { 0x296D, 0x0000 }, { 0x200E, 0x0000 }, { 0x22BF, 0x0000 }, { 0x2039, 0x0000 }, { 0x1D4C1, 0x0000 }, { 0x21B0, 0x0000 },
+  { 0x2272, 0x0000 }, { 0x2A8D, 0x0000 }, { 0x2A8F, 0x0000 }, { 0x005B, 0x0000 }, { 0x2018, 0x0000 }, { 0x201A, 0x0000 },
+  { 0x0142, 0x0000 }, { 0x003C, 0x0000 }, { 0x2AA6, 0x0000 }, { 0x2A79, 0x0000 }, { 0x22D6, 0x0000 }, { 0x22CB, 0x0000 },
+  { 0x22C9, 0x0000 }, { 0x2976, 0x0000 }, { 0x2A7B, 0x0000 }, { 0x2996, 0x0000 }, { 0x25C3, 0x0000 }, { 0x22B4, 0x0000 },
+  { 0x25C2, 0x0000 }, { 0x294A, 0x0000 }, { 0x2966, 0x0000 }, { 0x2268, 0xFE00 }, { 0x2268, 0xFE00 }, { 0x223A, 0x0000 },
+  { 0x00AF, 0x0000 }, { 0x2642, 0x0000 }, { 0x2720, 0x0000 }, { 0x2720, 0x0000 }, { 0x21A6, 0x0000 }, { 0x21A6, 0x0000 },
+  { 0x21A7, 0x0000 }, { 0x21A4, 0x0000 }, { 0x21A5, 0x0000 }, { 0x25AE, 0x0000 }, { 0x2A29, 0x0000 }, { 0x043C, 0x0000 },
+  { 0x2014, 0x0000 }, { 0x2221, 0x0000 }, { 0x1D52A, 0x0000 }, { 0x2127, 0x0000 }, { 0x00B5, 0x0000 }, { 0x2223, 0x0000 },
+  { 0x002A, 0x0000 }, { 0x2AF0, 0x0000 }, { 0x00B7, 0x0000 }, { 0x2212, 0x0000 }, { 0x229F, 0x0000 }, { 0x2238, 0x0000 },
+  { 0x2A2A, 0x0000 }, { 0x2ADB, 0x0000 }, { 0x2026, 0x0000 }, { 0x2213, 0x0000 }, { 0x22A7, 0x0000 }, { 0x1D55E, 0x0000 },
+  { 0x2213, 0x0000 }, { 0x1D4C2, 0x0000 }, { 0x223E, 0x0000 }, { 0x03BC, 0x0000 }, { 0x22B8, 0x0000 }, { 0x22B8, 0x0000 },
+  { 0x22D9, 0x0338 }, { 0x226B, 0x20D2 }, { 0x226B, 0x0338 }, { 0x21CD, 0x0000 }, { 0x21CE, 0x0000 }, { 0x22D8, 0x0338 },
+  { 0x226A, 0x20D2 }, { 0x226A, 0x0338 }, { 0x21CF, 0x0000 }, { 0x22AF, 0x0000 }, { 0x22AE, 0x0000 }, { 0x2207, 0x0000 },
+  { 0x0144, 0x0000 }, { 0x2220, 0x20D2 }, { 0x2249, 0x0000 }, { 0x2A70, 0x0338 }, { 0x224B, 0x0338 }, { 0x0149, 0x0000 },
+  { 0x2249, 0x0000 }, { 0x266E, 0x0000 }, { 0x266E, 0x0000 }, { 0x2115, 0x0000 }, { 0x0020, 0x0000 }, { 0x224E, 0x0338 },
+  { 0x224F, 0x0338 }, { 0x2A43, 0x0000 }, { 0x0148, 0x0000 }, { 0x0146, 0x0000 }, { 0x2247, 0x0000 }, { 0x2A6D, 0x0338 },
+  { 0x2A42, 0x0000 }, { 0x043D, 0x0000 }, { 0x2013, 0x0000 }, { 0x2260, 0x0000 }, { 0x21D7, 0x0000 }, { 0x2924, 0x0000 },
+  { 0x2197, 0x0000 }, { 0x2197, 0x0000 }, { 0x2250, 0x0338 }, { 0x2262, 0x0000 }, { 0x2928, 0x0000 }, { 0x2242, 0x0338 },
+  { 0x2204, 0x0000 }, { 0x2204, 0x0000 }, { 0x1D52B, 0x0000 }, { 0x2267, 0x0338 }, { 0x2271, 0x0000 }, { 0x2271, 0x0000 },
+  { 0x2267, 0x0338 }, { 0x2A7E, 0x0338 }, { 0x2A7E, 0x0338 }, { 0x2275, 0x0000 }, { 0x226F, 0x0000 }, { 0x226F, 0x0000 },
+  { 0x21CE, 0x0000 }, { 0x21AE, 0x0000 }, { 0x2AF2, 0x0000 }, { 0x220B, 0x0000 }, { 0x22FC, 0x0000 }, { 0x22FA, 0x0000 },
+  { 0x220B, 0x0000 }, { 0x045A, 0x0000 }, { 0x21CD, 0x0000 }, { 0x2266, 0x0338 }, { 0x219A, 0x0000 }, { 0x2025, 0x0000 },
+  { 0x2270, 0x0000 }, { 0x219A, 0x0000 }, { 0x21AE, 0x0000 }, { 0x2270, 0x0000 }, { 0x2266, 0x0338 }, { 0x2A7D, 0x0338 },
+  { 0x2A7D, 0x0338 }, { 0x226E, 0x0000 }, { 0x2274, 0x0000 }, { 0x226E, 0x0000 }, { 0x22EA, 0x0000 }, { 0x22EC, 0x0000 },
+  { 0x2224, 0x0000 }, { 0x1D55F, 0x0000 }, { 0x00AC, 0x0000 }, { 0x2209, 0x0000 }, { 0x22F9, 0x0338 }, { 0x22F5, 0x0338 },
+  { 0x2209, 0x0000 }, { 0x22F7, 0x0000 }, { 0x22F6, 0x0000 }, { 0x220C, 0x0000 }, { 0x220C, 0x0000 }, { 0x22FE, 0x0000 },
+  { 0x22FD, 0x0000 }, { 0x2226, 0x0000 }, { 0x2226, 0x0000 }, { 0x2AFD, 0x20E5 }, { 0x2202, 0x0338 }, { 0x2A14, 0x0000 },
+  { 0x2280, 0x0000 }, { 0x22E0, 0x0000 }, { 0x2AAF, 0x0338 }, { 0x2280, 0x0000 }, { 0x2AAF, 0x0338 }, { 0x21CF, 0x0000 },
+  { 0x219B, 0x0000 }, { 0x2933, 0x0338 }, { 0x219D, 0x0338 }, { 0x219B, 0x0000 }, { 0x22EB, 0x0000 }, { 0x22ED, 0x0000 },
+  { 0x2281, 0x0000 }, { 0x22E1, 0x0000 }, { 0x2AB0, 0x0338 }, { 0x1D4C3, 0x0000 }, { 0x2224, 0x0000 }, { 0x2226, 0x0000 },
+  { 0x2241, 0x0000 }, { 0x2244, 0x0000 }, { 0x2244, 0x0000 }, { 0x2224, 0x0000 }, { 0x2226, 0x0000 }, { 0x22E2, 0x0000 },
+  { 0x22E3, 0x0000 }, { 0x2284, 0x0000 }, { 0x2AC5, 0x0338 }, { 0x2288, 0x0000 }, { 0x2282, 0x20D2 }, { 0x2288, 0x0000 },
+  { 0x2AC5, 0x0338 }, { 0x2281, 0x0000 }, { 0x2AB0, 0x0338 }, { 0x2285, 0x0000 }, { 0x2AC6, 0x0338 }, { 0x2289, 0x0000 },
+  { 0x2283, 0x20D2 }, { 0x2289, 0x0000 }, { 0x2AC6, 0x0338 }, { 0x2279, 0x0000 }, { 0x00F1, 0x0000 }, { 0x2278, 0x0000 },
+  { 0x22EA, 0x0000 }, { 0x22EC, 0x0000 }, { 0x22EB, 0x0000 }, { 0x22ED, 0x0000 }, { 0x03BD, 0x0000 }, { 0x0023, 0x0000 },
+  { 0x2116, 0x0000 }, { 0x2007, 0x0000 }, { 0x22AD, 0x0000 }, { 0x2904, 0x0000 }, { 0x224D, 0x20D2 }, { 0x22AC, 0x0000 },
+  { 0x2265, 0x20D2 }, { 0x003E, 0x20D2 }, { 0x29DE, 0x0000 }, { 0x2902, 0x0000 }, { 0x2264, 0x20D2 }, { 0x003C, 0x20D2 },
+  { 0x22B4, 0x20D2 }, { 0x2903, 0x0000 }, { 0x22B5, 0x20D2 }, { 0x223C, 0x20D2 }, { 0x21D6, 0x0000 }, { 0x2923, 0x0000 },
+  { 0x2196, 0x0000 }, { 0x2196, 0x0000 }, { 0x2927, 0x0000 }, { 0x24C8, 0x0000 }, { 0x00F3, 0x0000 }, { 0x229B, 0x0000 },
+  { 0x229A, 0x0000 }, { 0x00F4, 0x0000 }, { 0x043E, 0x0000 }, { 0x229D, 0x0000 }, { 0x0151, 0x0000 }, { 0x2A38, 0x0000 },
+  { 0x2299, 0x0000 }, { 0x29BC, 0x0000 }, { 0x0153, 0x0000 }, { 0x29BF, 0x0000 }, { 0x1D52C, 0x0000 }, { 0x02DB, 0x0000 },
+  { 0x00F2, 0x0000 }, { 0x29C1, 0x0000 }, { 0x29B5, 0x0000 }, { 0x03A9, 0x0000 }, { 0x222E, 0x0000 }, { 0x21BA, 0x0000 },
+  { 0x29BE, 0x0000 }, { 0x29BB, 0x0000 }, { 0x203E, 0x0000 }, { 0x29C0, 0x0000 }, { 0x014D, 0x0000 }, { 0x03C9, 0x0000 },
+  { 0x03BF, 0x0000 }, { 0x29B6, 0x0000 }, { 0x2296, 0x0000 }, { 0x1D560, 0x0000 }, { 0x29B7, 0x0000 }, { 0x29B9, 0x0000 },
+  { 0x2295, 0x0000 }, { 0x2228, 0x0000 }, { 0x21BB, 0x0000 }, { 0x2A5D, 0x0000 }, { 0x2134, 0x0000 }, { 0x2134, 0x0000 },
+  { 0x00AA, 0x0000 }, { 0x00BA, 0x0000 }, { 0x22B6, 0x0000 }, { 0x2A56, 0x0000 }, { 0x2A57, 0x0000 }, { 0x2A5B, 0x0000 },
+  { 0x2134, 0x0000 }, { 0x00F8, 0x0000 }, { 0x2298, 0x0000 }, { 0x00F5, 0x0000 }, { 0x2297, 0x0000 }, { 0x2A36, 0x0000 },
+  { 0x00F6, 0x0000 }, { 0x233D, 0x0000 }, { 0x2225, 0x0000 }, { 0x00B6, 0x0000 }, { 0x2225, 0x0000 }, { 0x2AF3, 0x0000 },
+  { 0x2AFD, 0x0000 }, { 0x2202, 0x0000 }, { 0x043F, 0x0000 }, { 0x0025, 0x0000 }, { 0x002E, 0x0000 }, { 0x2030, 0x0000 },
+  { 0x22A5, 0x0000 }, { 0x2031, 0x0000 }, { 0x1D52D, 0x0000 }, { 0x03C6, 0x0000 }, { 0x03D5, 0x0000 }, { 0x2133, 0x0000 },
+  { 0x260E, 0x0000 }, { 0x03C0, 0x0000 }, { 0x22D4, 0x0000 }, { 0x03D6, 0x0000 }, { 0x210F, 0x0000 }, { 0x210E, 0x0000 },
+  { 0x210F, 0x0000 }, { 0x002B, 0x0000 }, { 0x2A23, 0x0000 }, { 0x229E, 0x0000 }, { 0x2A22, 0x0000 }, { 0x2214, 0x0000 },
+  { 0x2A25, 0x0000 }, { 0x2A72, 0x0000 }, { 0x00B1, 0x0000 }, { 0x2A26, 0x0000 }, { 0x2A27, 0x0000 }, { 0x00B1, 0x0000 },
+  { 0x2A15, 0x0000 }, { 0x1D561, 0x0000 }, { 0x00A3, 0x0000 }, { 0x227A, 0x0000 }, { 0x2AB3, 0x0000 }, { 0x2AB7, 0x0000 },
+  { 0x227C, 0x0000 }, { 0x2AAF, 0x0000 }, { 0x227A, 0x0000 }, { 0x2AB7, 0x0000 }, { 0x227C, 0x0000 }, { 0x2AAF, 0x0000 },
+  { 0x2AB9, 0x0000 }, { 0x2AB5, 0x0000 }, { 0x22E8, 0x0000 }, { 0x227E, 0x0000 }, { 0x2032, 0x0000 }, { 0x2119, 0x0000 },
+  { 0x2AB5, 0x0000 }, { 0x2AB9, 0x0000 }, { 0x22E8, 0x0000 }, { 0x220F, 0x0000 }, { 0x232E, 0x0000 }, { 0x2312, 0x0000 },
+  { 0x2313, 0x0000 }, { 0x221D, 0x0000 }, { 0x221D, 0x0000 }, { 0x227E, 0x0000 }, { 0x22B0, 0x0000 }, { 0x1D4C5, 0x0000 },
+  { 0x03C8, 0x0000 }, { 0x2008, 0x0000 }, { 0x1D52E, 0x0000 }, { 0x2A0C, 0x0000 }, { 0x1D562, 0x0000 }, { 0x2057, 0x0000 },
+  { 0x1D4C6, 0x0000 }, { 0x210D, 0x0000 }, { 0x2A16, 0x0000 }, { 0x003F, 0x0000 }, { 0x225F, 0x0000 }, { 0x0022, 0x0000 },
+  { 0x21DB, 0x0000 }, { 0x21D2, 0x0000 }, { 0x291C, 0x0000 }, { 0x290F, 0x0000 }, { 0x2964, 0x0000 }, { 0x223D, 0x0331 },
+  { 0x0155, 0x0000 }, { 0x221A, 0x0000 }, { 0x29B3, 0x0000 }, { 0x27E9, 0x0000 }, { 0x2992, 0x0000 }, { 0x29A5, 0x0000 },
+  { 0x27E9, 0x0000 }, { 0x00BB, 0x0000 }, { 0x2192, 0x0000 }, { 0x2975, 0x0000 }, { 0x21E5, 0x0000 }, { 0x2920, 0x0000 },
+  { 0x2933, 0x0000 }, { 0x291E, 0x0000 }, { 0x21AA, 0x0000 }, { 0x21AC, 0x0000 }, { 0x2945, 0x0000 }, { 0x2974, 0x0000 },
+  { 0x21A3, 0x0000 }, { 0x219D, 0x0000 }, { 0x291A, 0x0000 }, { 0x2236, 0x0000 }, { 0x211A, 0x0000 }, { 0x290D, 0x0000 },
+  { 0x2773, 0x0000 }, { 0x007D, 0x0000 }, { 0x005D, 0x0000 }, { 0x298C, 0x0000 }, { 0x298E, 0x0000 }, { 0x2990, 0x0000 },
+  { 0x0159, 0x0000 }, { 0x0157, 0x0000 }, { 0x2309, 0x0000 }, { 0x007D, 0x0000 }, { 0x0440, 0x0000 }, { 0x2937, 0x0000 },
+  { 0x2969, 0x0000 }, { 0x201D, 0x0000 }, { 0x201D, 0x0000 }, { 0x21B3, 0x0000 }, { 0x211C, 0x0000 }, { 0x211B, 0x0000 },
+  { 0x211C, 0x0000 }, { 0x211D, 0x0000 }, { 0x25AD, 0x0000 }, { 0x00AE, 0x0000 }, { 0x297D, 0x0000 }, { 0x230B, 0x0000 },
+  { 0x1D52F, 0x0000 }, { 0x21C1, 0x0000 }, { 0x21C0, 0x0000 }, { 0x296C, 0x0000 }, { 0x03C1, 0x0000 }, { 0x03F1, 0x0000 },
+  { 0x2192, 0x0000 }, { 0x21A3, 0x0000 }, { 0x21C1, 0x0000 }, { 0x21C0, 0x0000 }, { 0x21C4, 0x0000 }, { 0x21CC, 0x0000 },
+  { 0x21C9, 0x0000 }, { 0x219D, 0x0000 }, { 0x22CC, 0x0000 }, { 0x02DA, 0x0000 }, { 0x2253, 0x0000 }, { 0x21C4, 0x0000 },
+  { 0x21CC, 0x0000 }, { 0x200F, 0x0000 }, { 0x23B1, 0x0000 }, { 0x23B1, 0x0000 }, { 0x2AEE, 0x0000 }, { 0x27ED, 0x0000 },
+  { 0x21FE, 0x0000 }, { 0x27E7, 0x0000 }, { 0x2986, 0x0000 }, { 0x1D563, 0x0000 }, { 0x2A2E, 0x0000 }, { 0x2A35, 0x0000 },
+  { 0x0029, 0x0000 }, { 0x2994, 0x0000 }, { 0x2A12, 0x0000 }, { 0x21C9, 0x0000 }, { 0x203A, 0x0000 }, { 0x1D4C7, 0x0000 },
+  { 0x21B1, 0x0000 }, { 0x005D, 0x0000 }, { 0x2019, 0x0000 }, { 0x2019, 0x0000 }, { 0x22CC, 0x0000 }, { 0x22CA, 0x0000 },
+  { 0x25B9, 0x0000 }, { 0x22B5, 0x0000 }, { 0x25B8, 0x0000 }, { 0x29CE, 0x0000 }, { 0x2968, 0x0000 }, { 0x211E, 0x0000 },
+  { 0x015B, 0x0000 }, { 0x201A, 0x0000 }, { 0x227B, 0x0000 }, { 0x2AB4, 0x0000 }, { 0x2AB8, 0x0000 }, { 0x0161, 0x0000 },
+  { 0x227D, 0x0000 }, { 0x2AB0, 0x0000 }, { 0x015F, 0x0000 }, { 0x015D, 0x0000 }, { 0x2AB6, 0x0000 }, { 0x2ABA, 0x0000 },
+  { 0x22E9, 0x0000 }, { 0x2A13, 0x0000 }, { 0x227F, 0x0000 }, { 0x0441, 0x0000 }, { 0x22C5, 0x0000 }, { 0x22A1, 0x0000 },
+  { 0x2A66, 0x0000 }, { 0x21D8, 0x0000 }, { 0x2925, 0x0000 }, { 0x2198, 0x0000 }, { 0x2198, 0x0000 }, { 0x00A7, 0x0000 },
+  { 0x003B, 0x0000 }, { 0x2929, 0x0000 }, { 0x2216, 0x0000 }, { 0x2216, 0x0000 }, { 0x2736, 0x0000 }, { 0x1D530, 0x0000 },
+  { 0x2322, 0x0000 }, { 0x266F, 0x0000 }, { 0x0449, 0x0000 }, { 0x0448, 0x0000 }, { 0x2223, 0x0000 }, { 0x2225, 0x0000 },
+  { 0x00AD, 0x0000 }, { 0x03C3, 0x0000 }, { 0x03C2, 0x0000 }, { 0x03C2, 0x0000 }, { 0x223C, 0x0000 }, { 0x2A6A, 0x0000 },
+  { 0x2243, 0x0000 }, { 0x2243, 0x0000 }, { 0x2A9E, 0x0000 }, { 0x2AA0, 0x0000 }, { 0x2A9D, 0x0000 }, { 0x2A9F, 0x0000 },
+  { 0x2246, 0x0000 }, { 0x2A24, 0x0000 }, { 0x2972, 0x0000 }, { 0x2190, 0x0000 }, { 0x2216, 0x0000 }, { 0x2A33, 0x0000 },
+  { 0x29E4, 0x0000 }, { 0x2223, 0x0000 }, { 0x2323, 0x0000 }, { 0x2AAA, 0x0000 }, { 0x2AAC, 0x0000 }, { 0x2AAC, 0xFE00 },
+  { 0x044C, 0x0000 }, { 0x002F, 0x0000 }, { 0x29C4, 0x0000 }, { 0x233F, 0x0000 }, { 0x1D564, 0x0000 }, { 0x2660, 0x0000 },
+  { 0x2660, 0x0000 }, { 0x2225, 0x0000 }, { 0x2293, 0x0000 }, { 0x2293, 0xFE00 }, { 0x2294, 0x0000 }, { 0x2294, 0xFE00 },
+  { 0x228F, 0x0000 }, { 0x2291, 0x0000 }, { 0x228F, 0x0000 }, { 0x2291, 0x0000 }, { 0x2290, 0x0000 }, { 0x2292, 0x0000 },
+  { 0x2290, 0x0000 }, { 0x2292, 0x0000 }, { 0x25A1, 0x0000 }, { 0x25A1, 0x0000 }, { 0x25AA, 0x0000 }, { 0x25AA, 0x0000 },
+  { 0x2192, 0x0000 }, { 0x1D4C8, 0x0000 }, { 0x2216, 0x0000 }, { 0x2323, 0x0000 }, { 0x22C6, 0x0000 }, { 0x2606, 0x0000 },
+  { 0x2605, 0x0000 }, { 0x03F5, 0x0000 }, { 0x03D5, 0x0000 }, { 0x00AF, 0x0000 }, { 0x2282, 0x0000 }, { 0x2AC5, 0x0000 },
+  { 0x2ABD, 0x0000 }, { 0x2286, 0x0000 }, { 0x2AC3, 0x0000 }, { 0x2AC1, 0x0000 }, { 0x2ACB, 0x0000 }, { 0x228A, 0x0000 },
+  { 0x2ABF, 0x0000 }, { 0x2979, 0x0000 }, { 0x2282, 0x0000 }, { 0x2286, 0x0000 }, { 0x2AC5, 0x0000 }, { 0x228A, 0x0000 },
+  { 0x2ACB, 0x0000 }, { 0x2AC7, 0x0000 }, { 0x2AD5, 0x0000 }, { 0x2AD3, 0x0000 }, { 0x227B, 0x0000 }, { 0x2AB8, 0x0000 },
+  { 0x227D, 0x0000 }, { 0x2AB0, 0x0000 }, { 0x2ABA, 0x0000 }, { 0x2AB6, 0x0000 }, { 0x22E9, 0x0000 }, { 0x227F, 0x0000 },
+  { 0x2211, 0x0000 }, { 0x266A, 0x0000 }, { 0x2283, 0x0000 }, { 0x00B9, 0x0000 }, { 0x00B2, 0x0000 }, { 0x00B3, 0x0000 },
+  { 0x2AC6, 0x0000 }, { 0x2ABE, 0x0000 }, { 0x2AD8, 0x0000 }, { 0x2287, 0x0000 }, { 0x2AC4, 0x0000 }, { 0x27C9, 0x0000 },
+  { 0x2AD7, 0x0000 }, { 0x297B, 0x0000 }, { 0x2AC2, 0x0000 }, { 0x2ACC, 0x0000 }, { 0x228B, 0x0000 }, { 0x2AC0, 0x0000 },
+  { 0x2283, 0x0000 }, { 0x2287, 0x0000 }, { 0x2AC6, 0x0000 }, { 0x228B, 0x0000 }, { 0x2ACC, 0x0000 }, { 0x2AC8, 0x0000 },
+  { 0x2AD4, 0x0000 }, { 0x2AD6, 0x0000 }, { 0x21D9, 0x0000 }, { 0x2926, 0x0000 }, { 0x2199, 0x0000 }, { 0x2199, 0x0000 },
+  { 0x292A, 0x0000 }, { 0x00DF, 0x0000 }, { 0x2316, 0x0000 }, { 0x03C4, 0x0000 }, { 0x23B4, 0x0000 }, { 0x0165, 0x0000 },
+  { 0x0163, 0x0000 }, { 0x0442, 0x0000 }, { 0x20DB, 0x0000 }, { 0x2315, 0x0000 }, { 0x1D531, 0x0000 }, { 0x2234, 0x0000 },
+  { 0x2234, 0x0000 }, { 0x03B8, 0x0000 }, { 0x03D1, 0x0000 }, { 0x03D1, 0x0000 }, { 0x2248, 0x0000 }, { 0x223C, 0x0000 },
+  { 0x2009, 0x0000 }, { 0x2248, 0x0000 }, { 0x223C, 0x0000 }, { 0x00FE, 0x0000 }, { 0x02DC, 0x0000 }, { 0x00D7, 0x0000 },
+  { 0x22A0, 0x0000 }, { 0x2A31, 0x0000 }, { 0x2A30, 0x0000 }, { 0x222D, 0x0000 }, { 0x2928, 0x0000 }, { 0x22A4, 0x0000 },
+  { 0x2336, 0x0000 }, { 0x2AF1, 0x0000 }, { 0x1D565, 0x0000 }, { 0x2ADA, 0x0000 }, { 0x2929, 0x0000 }, { 0x2034, 0x0000 },
+  { 0x2122, 0x0000 }, { 0x25B5, 0x0000 }, { 0x25BF, 0x0000 }, { 0x25C3, 0x0000 }, { 0x22B4, 0x0000 }, { 0x225C, 0x0000 },
+  { 0x25B9, 0x0000 }, { 0x22B5, 0x0000 }, { 0x25EC, 0x0000 }, { 0x225C, 0x0000 }, { 0x2A3A, 0x0000 }, { 0x2A39, 0x0000 },
+  { 0x29CD, 0x0000 }, { 0x2A3B, 0x0000 }, { 0x23E2, 0x0000 }, { 0x1D4C9, 0x0000 }, { 0x0446, 0x0000 }, { 0x045B, 0x0000 },
+  { 0x0167, 0x0000 }, { 0x226C, 0x0000 }, { 0x219E, 0x0000 }, { 0x21A0, 0x0000 }, { 0x21D1, 0x0000 }, { 0x2963, 0x0000 },
+  { 0x00FA, 0x0000 }, { 0x2191, 0x0000 }, { 0x045E, 0x0000 }, { 0x016D, 0x0000 }, { 0x00FB, 0x0000 }, { 0x0443, 0x0000 },
+  { 0x21C5, 0x0000 }, { 0x0171, 0x0000 }, { 0x296E, 0x0000 }, { 0x297E, 0x0000 }, { 0x1D532, 0x0000 }, { 0x00F9, 0x0000 },
+  { 0x21BF, 0x0000 }, { 0x21BE, 0x0000 }, { 0x2580, 0x0000 }, { 0x231C, 0x0000 }, { 0x231C, 0x0000 }, { 0x230F, 0x0000 },
+  { 0x25F8, 0x0000 }, { 0x016B, 0x0000 }, { 0x00A8, 0x0000 }, { 0x0173, 0x0000 }, { 0x1D566, 0x0000 }, { 0x2191, 0x0000 },
+  { 0x2195, 0x0000 }, { 0x21BF, 0x0000 }, { 0x21BE, 0x0000 }, { 0x228E, 0x0000 }, { 0x03C5, 0x0000 }, { 0x03D2, 0x0000 },
+  { 0x03C5, 0x0000 }, { 0x21C8, 0x0000 }, { 0x231D, 0x0000 }, { 0x231D, 0x0000 }, { 0x230E, 0x0000 }, { 0x016F, 0x0000 },
+  { 0x25F9, 0x0000 }, { 0x1D4CA, 0x0000 }, { 0x22F0, 0x0000 }, { 0x0169, 0x0000 }, { 0x25B5, 0x0000 }, { 0x25B4, 0x0000 },
+  { 0x21C8, 0x0000 }, { 0x00FC, 0x0000 }, { 0x29A7, 0x0000 }, { 0x21D5, 0x0000 }, { 0x2AE8, 0x0000 }, { 0x2AE9, 0x0000 },
+  { 0x22A8, 0x0000 }, { 0x299C, 0x0000 }, { 0x03F5, 0x0000 }, { 0x03F0, 0x0000 }, { 0x2205, 0x0000 }, { 0x03D5, 0x0000 },
+  { 0x03D6, 0x0000 }, { 0x221D, 0x0000 }, { 0x2195, 0x0000 }, { 0x03F1, 0x0000 }, { 0x03C2, 0x0000 }, { 0x228A, 0xFE00 },
+  { 0x2ACB, 0xFE00 }, { 0x228B, 0xFE00 }, { 0x2ACC, 0xFE00 }, { 0x03D1, 0x0000 }, { 0x22B2, 0x0000 }, { 0x22B3, 0x0000 },
+  { 0x0432, 0x0000 }, { 0x22A2, 0x0000 }, { 0x2228, 0x0000 }, { 0x22BB, 0x0000 }, { 0x225A, 0x0000 }, { 0x22EE, 0x0000 },
+  { 0x007C, 0x0000 }, { 0x007C, 0x0000 }, { 0x1D533, 0x0000 }, { 0x22B2, 0x0000 }, { 0x2282, 0x20D2 }, { 0x2283, 0x20D2 },
+  { 0x1D567, 0x0000 }, { 0x221D, 0x0000 }, { 0x22B3, 0x0000 }, { 0x1D4CB, 0x0000 }, { 0x2ACB, 0xFE00 }, { 0x228A, 0xFE00 },
+  { 0x2ACC, 0xFE00 }, { 0x228B, 0xFE00 }, { 0x299A, 0x0000 }, { 0x0175, 0x0000 }, { 0x2A5F, 0x0000 }, { 0x2227, 0x0000 },
+  { 0x2259, 0x0000 }, { 0x2118, 0x0000 }, { 0x1D534, 0x0000 }, { 0x1D568, 0x0000 }, { 0x2118, 0x0000 }, { 0x2240, 0x0000 },
+  { 0x2240, 0x0000 }, { 0x1D4CC, 0x0000 }, { 0x22C2, 0x0000 }, { 0x25EF, 0x0000 }, { 0x22C3, 0x0000 }, { 0x25BD, 0x0000 },
+  { 0x1D535, 0x0000 }, { 0x27FA, 0x0000 }, { 0x27F7, 0x0000 }, { 0x03BE, 0x0000 }, { 0x27F8, 0x0000 }, { 0x27F5, 0x0000 },
+  { 0x27FC, 0x0000 }, { 0x22FB, 0x0000 }, { 0x2A00, 0x0000 }, { 0x1D569, 0x0000 }, { 0x2A01, 0x0000 }, { 0x2A02, 0x0000 },
+  { 0x27F9, 0x0000 }, { 0x27F6, 0x0000 }, { 0x1D4CD, 0x0000 }, { 0x2A06, 0x0000 }, { 0x2A04, 0x0000 }, { 0x25B3, 0x0000 },
+  { 0x22C1, 0x0000 }, { 0x22C0, 0x0000 }, { 0x00FD, 0x0000 }, { 0x044F, 0x0000 }, { 0x0177, 0x0000 }, { 0x044B, 0x0000 },
+  { 0x00A5, 0x0000 }, { 0x1D536, 0x0000 }, { 0x0457, 0x0000 }, { 0x1D56A, 0x0000 }, { 0x1D4CE, 0x0000 }, { 0x044E, 0x0000 },
+  { 0x00FF, 0x0000 }, { 0x017A, 0x0000 }, { 0x017E, 0x0000 }, { 0x0437, 0x0000 }, { 0x017C, 0x0000 }, { 0x2128, 0x0000 },
+  { 0x03B6, 0x0000 }, { 0x1D537, 0x0000 }, { 0x0436, 0x0000 }, { 0x21DD, 0x0000 }, { 0x1D56B, 0x0000 }, { 0x1D4CF, 0x0000 },
+  { 0x200D, 0x0000 }, { 0x200C, 0x0000 }
+  };
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -21,10 +22,17 @@
 #include "list.h"
 #include "string.h"
 #include "sxmlc.h"
+#include "atoms.h"
+#include "entities.h"
 #include "xhtml.h"
+#include "selector.h"
 #include "util.h"
+#include "hyph.h"
 
 static char *tempdir = NULL;
+// One parser serves every spine item of every file, so that the buffers
+//   it grows are allocated only once
+static XhtmlParser *parser = NULL;
 
 /*============================================================================
   epub2txt_unescape_html
@@ -37,54 +45,53 @@ static char *tempdir = NULL;
 ============================================================================*/
 static char *epub2txt_unescape_html (const char *s)
   {
-  typedef enum {MODE_ANY=0, MODE_AMP=1} Mode;
-
-  Mode mode = MODE_ANY;
-
   String *out = string_create_empty();
-  WString *in = wstring_create_from_utf8(s);
-  WString *ent = wstring_create_empty();
 
-  int i, l = wstring_length (in);
-  for (i = 0; i < l; i++)
+  while (*s)
     {
-    const uint32_t *ws = wstring_wstr (in);
-    int c = ws[i];
-
-    if (mode == MODE_AMP)
+    if (*s == '&') 
       {
-      if (c == ';') 
-        {
-        WString *trans = xhtml_translate_entity (ent);
-        char *trans_utf8 = wstring_to_utf8 (trans); 
-        string_append (out, trans_utf8);
-        free (trans_utf8);
-        wstring_destroy (trans);
-        wstring_clear (ent);
-        mode = MODE_ANY; 
-        }
+      // Everything up to the next semicolon is the entity name; if 
+      //   there isn't one, the rest of the text is lost
+      const char *semi = strchr (s, ';');
+      if (!semi) break;
+      uint32_t chars[ENTITIES_MAX_CHARS];
+      int n = xhtml_translate_entity (s + 1, semi - s - 1, chars);
+      if (n > 0)
+        string_append_utf32_span (out, chars, n);
       else
         {
-        wstring_append_c (ent, c);
+        // Not an entity, so keep the text as it is
+        string_append_bytes (out, s, semi - s + 1);
         }
+      s = semi + 1;
       }
     else
       {
-      if (c == '&') 
-        mode = MODE_AMP; 
-      else
-        string_append_c (out, c);
+      string_append_byte (out, (BYTE)*s);
+      s++;
       }
     }
 
-  wstring_destroy (ent);
-  wstring_destroy (in);
   char *ret = strdup (string_cstr (out));
   string_destroy (out);
   return ret;
   }
 
 
+/*============================================================================
+  epub2txt_parse_xml
+  Parse the text in buff into doc, which the caller must free. The parse
+    is in-situ: the nodes point into buff, which must outlive doc
+============================================================================*/
+static BOOL epub2txt_parse_xml (String *buff, XMLDoc *doc)
+  {
+  XMLDoc_init (doc);
+  doc->atom_fn = atoms_xml;
+  return XMLDoc_parse_buffer_DOM_in_situ (string_cstr_mutable (buff),
+    APPNAME, doc);
+  }
+
 /*============================================================================
   epub2txt_format_meta
 ============================================================================*/
@@ -110,51 +117,107 @@ static void epub2txt_format_meta (const Epub2TxtOptions *options,
   }
 
 
+/*============================================================================
+  epub2txt_dump_calibre_meta
+  Format the series and title-sort information that Calibre stores in
+  <meta name="calibre:..." content="..."/> elements
+============================================================================*/
+static void epub2txt_dump_calibre_meta (const Epub2TxtOptions *options, 
+     const XMLNode *meta)
+  {
+  int k, nattrs = meta->n_attributes;
+  for (k = 0; k < nattrs; k++)
+    {
+    const char *value = meta->attributes[k].value;
+    if (strcmp (value, "calibre:series") == 0)
+      {
+      int j; 
+      for (j = 0; j < nattrs; j++)
+        {
+        if (meta->attributes[j].name_atom == ATOM_CONTENT)
+          epub2txt_format_meta (options, 
+            "Calibre series", meta->attributes[j].value);
+        }
+      }
+    else if (strcmp (value, "calibre:series_index") == 0)
+      {
+      int j;
+      for (j = 0; j < nattrs; j++)
+        {
+        if (meta->attributes[j].name_atom == ATOM_CONTENT)
+          {
+          char *s = strdup (meta->attributes[j].value);
+          // For some reason, Calibre stores the series index
+          //  as a decimal. Remove fraction.
+          char *p = strchr (s, '.');
+          if (p) *p = 0;
+          epub2txt_format_meta (options, 
+            "Calibre series index", s);
+          free (s);
+          }
+        }
+      }
+    else if (strcmp (value, "calibre:title_sort") == 0)
+      {
+      int j;
+      for (j = 0; j < nattrs; j++)
+        {
+        if (meta->attributes[j].name_atom == ATOM_CONTENT)
+          {
+          char *s = strdup (meta->attributes[j].value);
+          epub2txt_format_meta (options, 
+            "Calibre title sort", s);
+          free (s);
+          }
+        }
+      }
+    }
+  }
+
 /*============================================================================
   epub2txt_dump_metadata
-  Parse the OPF file to print document metadata 
+  Parse the text of the OPF file to print document metadata 
 ============================================================================*/
-static List *epub2txt_dump_metadata (const char *opf, 
+static List *epub2txt_dump_metadata (String *buff, 
         const Epub2TxtOptions *options, char **error)
   {
   IN
   List *ret = NULL;
-  String *buff = NULL;
-  if (string_create_from_utf8_file (opf, &buff, error))
+  XMLNode *metadata = NULL;
+  XMLDoc doc;
+  if (epub2txt_parse_xml (buff, &doc))
     {
-    const char *buff_cstr = string_cstr (buff);
-    log_debug ("Read OPF, size %d", string_length (buff));
-    XMLNode *metadata = NULL;
-    XMLDoc doc;
-    XMLDoc_init (&doc);
-    if (XMLDoc_parse_buffer_DOM (buff_cstr, APPNAME, &doc))
-      {
-      XMLNode *root = XMLDoc_root (&doc);
+    XMLNode *root = XMLDoc_root (&doc);
 
-      int i, l = root->n_children;
-      for (i = 0; i < l; i++)
+    int i, l = root->n_children;
+    for (i = 0; i < l; i++)
+      {
+      XMLNode *r1 = root->children[i];
+      if (r1->tag_atom == ATOM_METADATA)
 	{
-	XMLNode *r1 = root->children[i];
-	if (strcmp (r1->tag, "metadata") == 0 || strstr (r1->tag, ":metadata"))
+	metadata = r1;
+        int i, l = metadata->n_children;
+        for (i = 0; i < l; i++)
 	  {
-	  metadata = r1;
-          int i, l = metadata->n_children;
-          for (i = 0; i < l; i++)
-	    {
-	    XMLNode *r2 = metadata->children[i];
-            const char *mdtag = r2->tag;
-            const char *mdtext = r2->text;
-            // Don't try to print anything if the metadata text is null
-            if (!mdtext) continue;
-            if (strstr (mdtag, "creator"))
+	  XMLNode *r2 = metadata->children[i];
+          const char *mdtext = r2->text;
+          // Don't try to print anything if the metadata text is null
+          if (!mdtext) continue;
+          switch (r2->tag_atom)
+            {
+            case ATOM_CREATOR:
               epub2txt_format_meta (options, "Creator", mdtext);
-            else if (strstr (mdtag, "publisher"))
+              break;
+            case ATOM_PUBLISHER:
               epub2txt_format_meta (options, "Publisher", mdtext);
-            else if (strstr (mdtag, "contributor"))
+              break;
+            case ATOM_CONTRIBUTOR:
               epub2txt_format_meta (options, "Contributor", mdtext);
-            else if (strstr (mdtag, "identifier"))
+              break;
+            case ATOM_IDENTIFIER:
               epub2txt_format_meta (options, "Identifier", mdtext);
-            else if (strstr (mdtag, "date"))
+              break;
+            case ATOM_DATE:
               {
               char *mdate = strdup (mdtext);
               char *p = strchr (mdate, '-');
@@ -162,74 +225,34 @@ static List *epub2txt_dump_metadata (const char *opf,
               epub2txt_format_meta (options, "Date", mdate);
               free (mdate);
               }
-            else if (strstr (mdtag, "description"))
+              break;
+            case ATOM_DESCRIPTION:
               epub2txt_format_meta (options, "Description", mdtext);
-            else if (strstr (mdtag, "subject"))
+              break;
+            case ATOM_SUBJECT:
               epub2txt_format_meta (options, "Subject", mdtext);
-            else if (strstr (mdtag, "language"))
+              break;
+            case ATOM_LANGUAGE:
               epub2txt_format_meta (options, "Language", mdtext);
-            else if (strstr (mdtag, "title"))
+              break;
+            case ATOM_TITLE:
               epub2txt_format_meta (options, "Title", mdtext);
-            else if (strstr (mdtag, "meta") && options->calibre)
-              {
-	      int k, nattrs = r2->n_attributes;
-              for (k = 0; k < nattrs; k++)
-                {
-		const char *value= r2->attributes[k].value;
-                if (strcmp (value, "calibre:series") == 0)
-                  {
-	          int j; 
-                  for (j = 0; j < r2->n_attributes; j++)
-                    {
-                    if (strcmp (r2->attributes[j].name, "content") == 0)
-                      epub2txt_format_meta (options, 
-                        "Calibre series", r2->attributes[j].value);
-                    }
-                  }
-                else if (strcmp (value, "calibre:series_index") == 0)
-                  {
-	          int j;
-                  for (j = 0; j < r2->n_attributes; j++)
-                    {
-                    if (strcmp (r2->attributes[j].name, "content") == 0)
-                      {
-                      char *s = strdup (r2->attributes[j].value);
-                      // For some reason, Calibre stores the series index
-                      //  as a decimal. Remove fraction.
-                      char *p = strchr (s, '.');
-                      if (p) *p = 0;
-                      epub2txt_format_meta (options, 
-                        "Calibre series index", s);
-                      free (s);
-                      }
-                    }
-                  }
-                else if (strcmp (value, "calibre:title_sort") == 0)
-                  {
-	          int j;
-                  for (j = 0; j < r2->n_attributes; j++)
-                    {
-                    if (strcmp (r2->attributes[j].name, "content") == 0)
-                      {
-                      char *s = strdup (r2->attributes[j].value);
-                      epub2txt_format_meta (options, 
-                        "Calibre title sort", s);
-                      free (s);
-                      }
-                    }
-                  }
-                }
-              }
+              break;
+            case ATOM_META:
+              if (options->calibre)
+                epub2txt_dump_calibre_meta (options, r2);
+              break;
+            default:
+              break;
             }
-	  }
-        }
-      XMLDoc_free (&doc);
-      }
-    else
-      {
-      asprintf (error, "Can't parse OPF XML");
+          }
+	}
       }
-    string_destroy (buff);
+    XMLDoc_free (&doc);
+    }
+  else
+    {
+    asprintf (error, "Can't parse OPF XML");
     }
 
   OUT
@@ -237,28 +260,90 @@ static List *epub2txt_dump_metadata (const char *opf,
   }
 
 
+/*============================================================================
+  SpineItem
+  A document in the spine, with what the manifest says about it
+============================================================================*/
+typedef struct _SpineItem
+  {
+  char *href;        // Decoded, relative to the OPF file
+  char *media_type;  // May be NULL, if the manifest doesn't say
+  BOOL linear;       // FALSE for linear="no", e.g., notes and covers
+  } SpineItem;
+
+/*============================================================================
+  epub2txt_spine_item_destroy
+============================================================================*/
+static void epub2txt_spine_item_destroy (void *p)
+  {
+  SpineItem *self = p;
+  free (self->href);
+  free (self->media_type);
+  free (self);
+  }
+
+/*============================================================================
+  epub2txt_attribute
+  Returns the value of the attribute of node, or NULL
+============================================================================*/
+static const char *epub2txt_attribute (const XMLNode *node, Atom atom)
+  {
+  int i;
+  for (i = 0; i < node->n_attributes; i++)
+    {
+    if (node->attributes[i].name_atom == atom)
+      return node->attributes[i].value;
+    }
+  return NULL;
+  }
+
+/*============================================================================
+  epub2txt_is_xhtml
+  Whether a spine item of this media type is a document that we can
+    extract text from. The spine should only contain XHTML, but some 
+    EPUBs have HTML or DTBook; and fixed-layout books often have images
+    or SVG pages, which have no text. An item with no type is given the
+    benefit of the doubt.
+============================================================================*/
+static BOOL epub2txt_is_xhtml (const char *media_type)
+  {
+  static const char *const types[] = { "application/xhtml+xml", 
+    "text/html", "application/x-dtbook+xml", "text/x-oeb1-document", 
+    NULL };
+  if (!media_type || !media_type[0]) return TRUE;
+  // Ignore parameters, as in "text/html; charset=utf-8"
+  int i, len = strcspn (media_type, "; \t");
+  for (i = 0; types[i]; i++)
+    {
+    if ((int)strlen (types[i]) == len 
+        && strncasecmp (media_type, types[i], len) == 0)
+      return TRUE;
+    }
+  return FALSE;
+  }
+
 /*============================================================================
   epub2txt_get_items
-  Parse the OPF file to get the spine items 
+  Parse the OPF file to get the spine items, as a list of SpineItem, 
+    in reading order, and the first dc:language, if there is one, into
+    *language, which the caller must free
 ============================================================================*/
-List *epub2txt_get_items (const char *opf, char **error)
+List *epub2txt_get_items (const char *opf, char **language, char **error)
   {
   IN
   List *ret = NULL;
   String *buff = NULL;
   if (string_create_from_utf8_file (opf, &buff, error))
     {
-    const char *buff_cstr = string_cstr (buff);
     log_debug ("Read OPF, size %d", string_length (buff));
     BOOL got_manifest = FALSE;
     XMLNode *manifest = NULL;
     XMLDoc doc;
-    XMLDoc_init (&doc);
-    if (XMLDoc_parse_buffer_DOM (buff_cstr, APPNAME, &doc))
+    if (epub2txt_parse_xml (buff, &doc))
       {
       XMLNode *root = XMLDoc_root (&doc);
 
-      int l;
+      int l = 0;
       if (root)
         {
 	int i;
@@ -266,12 +351,22 @@ List *epub2txt_get_items (const char *opf, char **error)
 	for (i = 0; i < l; i++)
 	  {
 	  XMLNode *r1 = root->children[i];
-	  // Add workaround for bug #4 
-	  if (strcmp (r1->tag, "manifest") == 0 || strstr (r1->tag, ":manifest"))
+	  // Namespace prefixes (bug #4) are split off by the parser
+	  if (r1->tag_atom == ATOM_MANIFEST)
 	    {
 	    manifest = r1;
 	    got_manifest = TRUE;
 	    }
+	  if (r1->tag_atom == ATOM_METADATA)
+	    {
+	    int j;
+	    for (j = 0; j < r1->n_children && !*language; j++)
+	      {
+	      XMLNode *r2 = r1->children[j];
+	      if (r2->tag_atom == ATOM_LANGUAGE && r2->text)
+	        *language = strdup (r2->text);
+	      }
+	    }
 	  }
         }
       else
@@ -282,55 +377,42 @@ List *epub2txt_get_items (const char *opf, char **error)
       if (!got_manifest)
 	{
 	asprintf (error, "File %s has no manifest", opf);
+        XMLDoc_free (&doc);
+        string_destroy (buff);
 	OUT
 	return NULL; 
 	}
    
-      ret = list_create_strings();
+      ret = list_create (epub2txt_spine_item_destroy);
 
       for (int i = 0; i < l; i++)
 	{
 	XMLNode *r1 = root->children[i];
-	// Add workaround for bug #4
-	if (strcmp (r1->tag, "spine") == 0 || strstr (r1->tag, ":spine"))
+	if (r1->tag_atom == ATOM_SPINE)
 	  {
 	  int j, l2 = r1->n_children;
 	  for (j = 0; j < l2; j++)
 	    {
 	    XMLNode *r2 = r1->children[j]; // itemref
-	    int k, nattrs = r2->n_attributes;
-	    for (k = 0; k < nattrs; k++)
+	    const char *idref = epub2txt_attribute (r2, ATOM_IDREF);
+	    if (!idref) continue;
+	    const char *linear = epub2txt_attribute (r2, ATOM_LINEAR);
+	    int m;
+	    for (m = 0; m < manifest->n_children; m++)
 	      {
-	      char *name = r2->attributes[k].name;
-	      if (strcmp (name, "idref") == 0)
-		{
-		char *value= r2->attributes[k].value;
-		int m;
-		for (m = 0; m < manifest->n_children; m++)
-		  {
-		  XMLNode *r3 = manifest->children[m]; // item
-		  int n, nattrs = r3->n_attributes;
-		  for (n = 0; n < nattrs; n++)
-		    {
-		    char *name2 = r3->attributes[n].name;
-		    char *val2 = r3->attributes[n].value;
-		    if (strcmp (name2, "id") == 0 && 
-			strcmp (val2, value) == 0)
-		      {
-		      int p;
-		      for (p = 0; p < nattrs; p++)
-			{
-			char *name2 = r3->attributes[p].name;
-			char *val2 = r3->attributes[p].value;
-			if (strcmp (name2, "href") == 0)
-			  {
-                          char *decoded_val2 = decode_url (val2);
-			  list_append (ret, decoded_val2);
-			  }
-			}
-		      }
-		    }
-		  }
+	      XMLNode *r3 = manifest->children[m]; // item
+	      const char *id = epub2txt_attribute (r3, ATOM_ID);
+	      if (!id || strcmp (id, idref) != 0) continue;
+	      const char *href = epub2txt_attribute (r3, ATOM_HREF);
+	      if (href)
+	        {
+		const char *media_type = 
+		  epub2txt_attribute (r3, ATOM_MEDIA_TYPE);
+		SpineItem *item = malloc (sizeof (SpineItem));
+		item->href = decode_url (href);
+		item->media_type = media_type ? strdup (media_type) : NULL;
+		item->linear = !(linear && strcmp (linear, "no") == 0);
+		list_append (ret, item);
 		}
 	      }
 	    }
@@ -352,72 +434,154 @@ List *epub2txt_get_items (const char *opf, char **error)
 
 /*============================================================================
   epub2txt_get_root_file 
-  Parse the OPF file to get the root document
+  Parse the text of container.xml to get the root document
 ============================================================================*/
-String *epub2txt_get_root_file (const char *opf, char **error)
+String *epub2txt_get_root_file (String *buff, char **error)
   {
   IN
   String *ret = NULL;
-  String *buff = NULL;
-  if (string_create_from_utf8_file (opf, &buff, error))
+  XMLDoc doc;
+  if (epub2txt_parse_xml (buff, &doc))
     {
-    const char *buff_cstr = string_cstr (buff);
-    log_debug ("Read OPF, size %d", string_length (buff));
-    XMLDoc doc;
-    XMLDoc_init (&doc);
-    if (XMLDoc_parse_buffer_DOM (buff_cstr, APPNAME, &doc))
+    XMLNode *root = XMLDoc_root (&doc);
+    if (root)
       {
-      XMLNode *root = XMLDoc_root (&doc);
-      if (root)
-        {
-        int i, l = root->n_children;
-	for (i = 0; i < l; i++)
+      int i, l = root->n_children;
+      for (i = 0; i < l; i++)
+	{
+	XMLNode *r1 = root->children[i];
+	if (r1->tag_atom == ATOM_ROOTFILES)
 	  {
-	  XMLNode *r1 = root->children[i];
-	  if (strcmp (r1->tag, "rootfiles") == 0)
+	  XMLNode *rootfiles = r1;
+	  int i, l = rootfiles->n_children;
+	  for (i = 0; i < l; i++)
 	    {
-	    XMLNode *rootfiles = r1;
-	    int i, l = rootfiles->n_children;
-	    for (i = 0; i < l; i++)
+	    XMLNode *r1 = rootfiles->children[i];
+	    if (r1->tag_atom == ATOM_ROOTFILE)
 	      {
-	      XMLNode *r1 = rootfiles->children[i];
-	      if (strcmp (r1->tag, "rootfile") == 0)
+	      int k, nattrs = r1->n_attributes;
+	      for (k = 0; k < nattrs; k++)
 		{
-		int k, nattrs = r1->n_attributes;
-		for (k = 0; k < nattrs; k++)
+		char *value = r1->attributes[k].value;
+		if (r1->attributes[k].name_atom == ATOM_FULL_PATH)
 		  {
-		  char *name = r1->attributes[k].name;
-		  char *value = r1->attributes[k].value;
-		  if (strcmp (name, "full-path") == 0)
-		    {
-		    ret = string_create (value);
-		    }
+		  ret = string_create (value);
 		  }
 		}
 	      }
 	    }
 	  }
-        }
-      else
-        {
-        log_warning ("No root element in '%s' -- corrupt EPUB?", opf);
-        }
-
-      if (ret == NULL)
-        asprintf (error, "container.xml does not specify a root file");
-      XMLDoc_free (&doc);
+	}
       }
     else
       {
-      asprintf (error, "Can't parse OPF XML");
+      log_warning ("No root element in container.xml -- corrupt EPUB?");
       }
-    string_destroy (buff);
+
+    if (ret == NULL)
+      asprintf (error, "container.xml does not specify a root file");
+    XMLDoc_free (&doc);
+    }
+  else
+    {
+    asprintf (error, "Can't parse OPF XML");
+    }
+
+  OUT
+  return ret;
+  }
+
+/*============================================================================
+  epub2txt_read_entry
+  Inflate a single file from the EPUB archive into memory, without 
+    extracting anything to disk
+============================================================================*/
+static String *epub2txt_read_entry (const char *file, const char *entry, 
+     char **error)
+  {
+  IN
+  String *ret = NULL;
+  // unzip treats the entry name as a wildcard pattern
+  String *pattern = string_create_empty();
+  const char *p;
+  for (p = entry; *p; p++)
+    {
+    if (*p == '*' || *p == '?' || *p == '[')
+      {
+      string_append_byte (pattern, '[');
+      string_append_byte (pattern, *p);
+      string_append_byte (pattern, ']');
+      }
+    else
+      string_append_byte (pattern, *p);
+    }
+
+  int length;
+  char *buff = run_command_output ((const char *[]){"unzip", "-p", "-qq", 
+    file, string_cstr (pattern), NULL}, &length);
+  if (buff)
+    {
+    log_debug ("Read %s, size %d", entry, length);
+    // Skip any UTF-8 byte-order mark, as string_create_from_utf8_file does
+    if (length >= 3 && buff[0] == (char)0xEF && buff[1] == (char)0xBB 
+        && buff[2] == (char)0xBF)
+      ret = string_create_from_bytes (buff + 3, length - 3);
+    else
+      ret = string_create_from_bytes (buff, length);
+    free (buff);
     }
+  else
+    asprintf (error, "Can't read \"%s\" from EPUB", entry);
 
+  string_destroy (pattern);
   OUT
   return ret;
   }
 
+/*============================================================================
+  epub2txt_read_opf
+  Read the OPF file, via container.xml, without extracting anything to 
+    disk
+============================================================================*/
+String *epub2txt_read_opf (const char *file, char **error)
+  {
+  IN
+  String *opf = NULL;
+  String *container = epub2txt_read_entry (file, "META-INF/container.xml", 
+    error);
+  if (container)
+    {
+    String *rootfile = epub2txt_get_root_file (container, error);
+    string_destroy (container);
+    if (rootfile)
+      {
+      log_debug ("OPF rootfile is: %s", string_cstr (rootfile));
+      opf = epub2txt_read_entry (file, string_cstr (rootfile), error);
+      string_destroy (rootfile);
+      }
+    }
+  OUT
+  return opf;
+  }
+
+/*============================================================================
+  epub2txt_dump_metadata_only
+  The --meta --notext case: only container.xml and the OPF file are 
+    read from the archive
+============================================================================*/
+static void epub2txt_dump_metadata_only (const char *file, 
+     const Epub2TxtOptions *options, char **error)
+  {
+  IN
+  String *opf = epub2txt_read_opf (file, error);
+  if (opf)
+    {
+    epub2txt_dump_metadata (opf, options, error);
+    string_destroy (opf);
+    }
+  OUT
+  }
+
 /*============================================================================
   epub2txt_cleanup
 ============================================================================*/
@@ -432,6 +596,15 @@ void epub2txt_cleanup (void)
     }
   }
 
+/*============================================================================
+  epub2txt_finish
+============================================================================*/
+void epub2txt_finish (void)
+  {
+  xhtml_parser_destroy (parser);
+  parser = NULL;
+  }
+
 /*============================================================================
   epub2txt 
 ============================================================================*/
@@ -441,7 +614,11 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
   IN
 
   log_debug ("epub2txt_do_file: %s", file);
-  if (access (file, R_OK) == 0)
+  if (access (file, R_OK) == 0 && options->meta && options->notext)
+    {
+    epub2txt_dump_metadata_only (file, options, error);
+    }
+  else if (access (file, R_OK) == 0)
     {
     log_debug ("File access OK");
 
@@ -483,7 +660,13 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
       char *opf, *tmp;
       asprintf (&opf, "%s/META-INF/container.xml", tempdir);
       log_debug ("OPF path is: %s", opf);
-      String *rootfile = epub2txt_get_root_file (opf, error);
+      String *rootfile = NULL;
+      String *container = NULL;
+      if (string_create_from_utf8_file (opf, &container, error))
+        {
+        rootfile = epub2txt_get_root_file (container, error);
+        string_destroy (container);
+        }
       if (*error == NULL)
         {
         log_debug ("OPF rootfile is: %s", string_cstr(rootfile));
@@ -512,7 +695,12 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
 
         if (options->meta)
           {
-          epub2txt_dump_metadata (opf, options, error);
+          String *buff = NULL;
+          if (string_create_from_utf8_file (opf, &buff, error))
+            {
+            epub2txt_dump_metadata (buff, options, error);
+            string_destroy (buff);
+            }
           if (*error)
             {
             // Log it as a warning, but don't give up reading the document
@@ -524,14 +712,41 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
 
         if (!options->notext)
           {
-          List *list = epub2txt_get_items (opf, error);
+          Selector *selector = NULL;
+          if (options->select)
+            selector = selector_create (options->select, error);
+          List *list = NULL;
+          char *language = NULL;
+          if (*error == NULL)
+            list = epub2txt_get_items (opf, &language, error);
+          log_debug ("Document language is %s", language ? language : "unknown");
+          // Words are hyphenated by the patterns for the language of the
+          //   document, which is most likely English if it doesn't say. 
+          //   The spine items share the Hyphenator, and so the words it 
+          //   remembers
+          Epub2TxtOptions doc_options = *options;
+          if (options->hyphenate && options->width > 0 && !options->raw)
+            doc_options.hyphenator = hyph_create (language ? language : "en");
           if (*error == NULL)
 	    {
 	    log_debug ("EPUB spine has %d items", list_length (list));
 	    int i, l = list_length (list);
 	    for (i = 0; i < l; i++)
 	      {
-	      const char *item = (const char *)list_get (list, i);
+	      const SpineItem *spine_item = list_get (list, i);
+	      const char *item = spine_item->href;
+	      if (!options->all_items 
+	          && !epub2txt_is_xhtml (spine_item->media_type))
+	        {
+	        log_debug ("Skipping EPUB file \"%s\" of type %s", item, 
+	          spine_item->media_type);
+	        continue;
+	        }
+	      if (options->linear_only && !spine_item->linear)
+	        {
+	        log_debug ("Skipping non-linear EPUB file \"%s\"", item);
+	        continue;
+	        }
 	      free (opf);
 	      asprintf (&tmp, "%s/%s", content_dir, item);
 	      opf = realpath (tmp, NULL);
@@ -551,10 +766,24 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
 	      if (options->section_separator)
 	        printf ("%s\n", options->section_separator);
 
-	      xhtml_file_to_stdout (opf, options, error);
+	      if (selector)
+	        selector_file_to_stdout (selector, opf, item, options, error);
+	      else
+	        {
+	        if (parser)
+	          xhtml_parser_reset (parser, &doc_options);
+	        else
+	          parser = xhtml_parser_create (&doc_options);
+	        xhtml_parser_read_file (parser, opf, error);
+	        }
 	      }
 	    list_destroy (list);
 	    }
+          // The parser outlives doc_options and the hyphenator
+          if (parser) xhtml_parser_release (parser);
+          hyph_destroy (doc_options.hyphenator);
+          free (language);
+          selector_destroy (selector);
           }
         free (content_dir);
         free (opf);
@@ -7,6 +7,20 @@
 #pragma once
 
 #include "defs.h"
+#include "string.h"
+
+typedef enum 
+  {
+  META_FORMAT_TEXT = 0, // Formatted "Key: value" lines
+  META_FORMAT_NDJSON, // One JSON object per line
+  META_FORMAT_CSV
+  } MetaFormat;
+
+typedef enum 
+  {
+  WRAP_GREEDY = 0, // Fill each line in turn
+  WRAP_OPTIMAL // Break each paragraph to make its lines as even as possible
+  } WrapMode;
 
 typedef struct _Epub2TxtOptions
   {
@@ -18,6 +32,14 @@ typedef struct _Epub2TxtOptions
   BOOL notext; // Don't dump text 
   BOOL calibre; // Show Calibre metadata 
   char *section_separator; // Section separator; may be NULL
+  char *select; // Elements to extract, instead of the text; may be NULL
+  MetaFormat meta_format; // Batch metadata export format
+  BOOL all_items; // Extract spine items of any media type, not just XHTML
+  BOOL linear_only; // Skip spine items marked linear="no"
+  WrapMode wrap; // How to break lines, when the width is limited
+  BOOL hyphenate; // Hyphenate words at the ends of lines
+  struct _Hyphenator *hyphenator; // For the language of the document,
+    // if it is to be hyphenated; NULL otherwise
   } Epub2TxtOptions;
 
 void epub2txt_do_file (const char *file, const Epub2TxtOptions *options, 
@@ -25,3 +47,11 @@ void epub2txt_do_file (const char *file, const Epub2TxtOptions *options,
 
 void epub2txt_cleanup (void);
 
+/** Free the buffers that are kept from one file to the next, after the
+    last call to epub2txt_do_file(). */
+void epub2txt_finish (void);
+
+/** Read the OPF file of an EPUB into memory, without extracting anything
+    else. Returns NULL and sets *error on failure. */
+String *epub2txt_read_opf (const char *file, char **error);
+
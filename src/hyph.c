@@ -0,0 +1,221 @@
+/*============================================================================
+  epub2txt v2 
+  hyph.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "hyph.h"
+#include "log.h"
+
+/*============================================================================
+  HyphPatterns
+  The patterns of one language, as generated in hyph_table.h
+============================================================================*/
+typedef struct _HyphPatterns
+  {
+  const char *const *languages; // dc:language codes, NULL-terminated
+  int left_min;                 // The fewest letters before a hyphen
+  int right_min;                // and after it
+  int nchars;
+  const uint32_t *chars;        // The letters, in order of code point
+  const unsigned char *codes;   // and their numbers in the trie
+  uint32_t root;                // The base of the root node
+  const uint32_t *trie;         // (next base << 8) | (letter + 1)
+  const unsigned short *ops;    // Offset in values, or 0
+  const unsigned char *values;  // Count, then (distance, value) pairs
+  } HyphPatterns;
+
+#include "hyph_table.h"
+
+// Words remembered; must be a power of two
+#define HYPH_CACHE_SIZE 4096
+
+// Letters below this are looked up directly, rather than searched for
+#define HYPH_DIRECT 0x250
+
+typedef struct _HyphCacheEntry
+  {
+  int len;                             // 0 if the entry is empty
+  unsigned char word[HYPH_WORD_MAX];   // Letter numbers
+  uint64_t points;                     // Bit k: a hyphen before letter k
+  } HyphCacheEntry;
+
+struct _Hyphenator
+  {
+  const HyphPatterns *patterns;
+  HyphCacheEntry *cache;
+  unsigned char direct[HYPH_DIRECT]; // Code point -> letter number, or 0
+  };
+
+/*============================================================================
+  hyph_create
+============================================================================*/
+Hyphenator *hyph_create (const char *language)
+  {
+  IN
+  // Only the language matters, not the region or script
+  char code[8];
+  int i, j, k, n = 0;
+  while (isspace ((unsigned char)*language)) language++;
+  while (language[n] && language[n] != '-' && language[n] != '_' 
+         && n < (int)sizeof (code) - 1)
+    {
+    code[n] = tolower ((unsigned char)language[n]);
+    n++;
+    }
+  code[n] = 0;
+
+  Hyphenator *self = NULL;
+  for (i = 0; i < (int)(sizeof (hyph_patterns) / sizeof (hyph_patterns[0])) 
+        && !self; i++)
+    {
+    for (j = 0; hyph_patterns[i].languages[j]; j++)
+      {
+      if (strcmp (hyph_patterns[i].languages[j], code) == 0)
+        {
+        self = malloc (sizeof (Hyphenator));
+        self->patterns = &hyph_patterns[i];
+        self->cache = calloc (HYPH_CACHE_SIZE, sizeof (HyphCacheEntry));
+        memset (self->direct, 0, sizeof (self->direct));
+        for (k = 0; k < hyph_patterns[i].nchars; k++)
+          {
+          if (hyph_patterns[i].chars[k] < HYPH_DIRECT)
+            self->direct[hyph_patterns[i].chars[k]] = hyph_patterns[i].codes[k];
+          }
+        break;
+        }
+      }
+    }
+  if (!self)
+    log_debug ("No hyphenation patterns for language '%s'", language);
+  OUT
+  return self;
+  }
+
+/*============================================================================
+  hyph_destroy
+============================================================================*/
+void hyph_destroy (Hyphenator *self)
+  {
+  IN
+  if (self)
+    {
+    free (self->cache);
+    free (self);
+    }
+  OUT
+  }
+
+/*============================================================================
+  hyph_code
+  The number of the letter c in the patterns, or 0 if it is not a letter 
+    of the language
+============================================================================*/
+static inline int hyph_code (const Hyphenator *self, uint32_t c)
+  {
+  if (c < HYPH_DIRECT) return self->direct[c];
+  const HyphPatterns *p = self->patterns;
+  int lo = 0, hi = p->nchars;
+  while (lo < hi)
+    {
+    int mid = (lo + hi) / 2;
+    if (p->chars[mid] < c)
+      lo = mid + 1;
+    else
+      hi = mid;
+    }
+  return (lo < p->nchars && p->chars[lo] == c) ? p->codes[lo] : 0;
+  }
+
+/*============================================================================
+  hyph_liang
+  Apply every pattern that matches part of the m letters of word, and
+    return the odd positions, as a bit mask
+============================================================================*/
+static uint64_t hyph_liang (const HyphPatterns *p, const unsigned char *word,
+     int m)
+  {
+  // The word with a "." (0) at each end, and the values between letters:
+  //   values[k] is before w[k]
+  unsigned char w[HYPH_WORD_MAX + 2];
+  unsigned char values[HYPH_WORD_MAX + 3];
+  int i, j, k;
+  w[0] = 0;
+  memcpy (w + 1, word, m);
+  w[m + 1] = 0;
+  memset (values, 0, m + 3);
+
+  for (i = 0; i <= m + 1; i++)
+    {
+    uint32_t base = p->root;
+    for (j = i; j <= m + 1; j++)
+      {
+      uint32_t slot = base + w[j];
+      uint32_t e = p->trie[slot];
+      if ((e & 0xFF) != (uint32_t)w[j] + 1) break;
+      if (p->ops[slot])
+        {
+        // The pattern for w[i..j]
+        const unsigned char *v = p->values + p->ops[slot];
+        int n = *v++;
+        while (n--)
+          {
+          int pos = j + 1 - v[0];
+          if (v[1] > values[pos]) values[pos] = v[1];
+          v += 2;
+          }
+        }
+      base = e >> 8;
+      }
+    }
+
+  uint64_t points = 0;
+  for (k = p->left_min; k <= m - p->right_min; k++)
+    {
+    if (values[k + 1] & 1) points |= (uint64_t)1 << k;
+    }
+  return points;
+  }
+
+/*============================================================================
+  hyph_points
+============================================================================*/
+int hyph_points (Hyphenator *self, const uint32_t *s, int len, int *points)
+  {
+  const HyphPatterns *p = self->patterns;
+  unsigned char word[HYPH_WORD_MAX];
+  int start = 0, end = len, m, k, n = 0;
+
+  // The word is what is left when the punctuation around it is taken 
+  //   off, and it must all be letters
+  while (start < end && hyph_code (self, s[start]) == 0) start++;
+  while (end > start && hyph_code (self, s[end - 1]) == 0) end--;
+  m = end - start;
+  if (m < p->left_min + p->right_min || m > HYPH_WORD_MAX) return 0;
+  uint32_t hash = 2166136261u;
+  for (k = 0; k < m; k++)
+    {
+    int code = hyph_code (self, s[start + k]);
+    if (code == 0) return 0;
+    word[k] = code;
+    hash = (hash ^ code) * 16777619u;
+    }
+
+  HyphCacheEntry *entry = &self->cache[hash & (HYPH_CACHE_SIZE - 1)];
+  if (entry->len != m || memcmp (entry->word, word, m) != 0)
+    {
+    entry->len = m;
+    memcpy (entry->word, word, m);
+    entry->points = hyph_liang (p, word, m);
+    }
+
+  for (k = 0; k < m; k++)
+    {
+    if (entry->points & ((uint64_t)1 << k)) points[n++] = start + k;
+    }
+  return n;
+  }
+
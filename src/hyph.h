@@ -0,0 +1,34 @@
+/*============================================================================
+  epub2txt v2 
+  hyph.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Hyphenation by Liang's algorithm, as in TeX. The patterns for each 
+  language are packed into a trie by tools/mkhyph.py, in hyph_table.h.
+  A Hyphenator is for one language, and remembers the words that it has
+  hyphenated, because a book uses the same words over and over.
+============================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// Longer words, in letters, are not hyphenated
+#define HYPH_WORD_MAX 63
+
+struct _Hyphenator;
+typedef struct _Hyphenator Hyphenator;
+
+/** Returns NULL if there are no patterns for the language, which is a 
+    code such as "en", "en-GB" or "eng", as in dc:language. */
+Hyphenator *hyph_create (const char *language);
+void        hyph_destroy (Hyphenator *self);
+
+/** Where the len characters of s can be hyphenated: each entry of 
+    points is the offset of a character that can start the next line. 
+    Punctuation before and after the word is ignored. points must have
+    room for HYPH_WORD_MAX entries. Returns how many there are. */
+int         hyph_points (Hyphenator *self, const uint32_t *s, int len, 
+              int *points);
+
@@ -0,0 +1,9906 @@
+/* Generated by tools/mkhyph.py -- do not edit */
+
+#pragma once
+
+// de: 23390 patterns, 42 letters, 33223 slots
+static const uint32_t hyph_de_chars[83] =
+  {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+  77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+  89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+  107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+  119, 120, 121, 122, 192, 193, 194, 196, 199, 200, 201, 202,
+  203, 205, 209, 211, 212, 214, 220, 223, 224, 225, 226, 228,
+  231, 232, 233, 234, 235, 237, 241, 243, 244, 246, 252
+  };
+
+static const unsigned char hyph_de_codes[83] =
+  {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+  11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+  23, 24, 25, 26, 28, 29, 30, 31, 32, 33, 34, 35,
+  36, 37, 38, 39, 40, 41, 42, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42
+  };
+
+static const uint32_t hyph_de_trie[33223] =
+  {
+  0, 11009, 21762, 32515, 43268, 53509, 64262, 75015, 85768, 96521, 107274, 113419,
+  119052, 129805, 140558, 151311, 162064, 172817, 2066, 183571, 194324, 205077, 215830, 226583,
+  237336, 248089, 258586, 266523, 277276, 168470, 4894, 5407, 288032, 8494095, 14626, 294691,
+  14372, 15141, 16678, 16167, 15656, 8494101, 301098, 307755, 314370, 319747, 28676, 232453,
+  323590, 252935, 328968, 38409, 330762, 16907, 318476, 331277, 335886, 337167, 341264, 338449,
+  8494084, 343315, 348180, 350485, 354070, 27927, 356632, 19225, 20762, 359451, 8494094, 8494095,
+  8494097, 8494095, 26912, 8494099, 8494101, 8494093, 8494096, 345619, 8494086, 589584, 623362, 933386,
+  38954, 25643, 362754, 368131, 377092, 381957, 387334, 391431, 397832, 403465, 410634, 29195,
+  416524, 423693, 429582, 440079, 58128, 449809, 640771, 455955, 463380, 469781, 480790, 295959,
+  18968, 49177, 376346, 309787, 29724, 425730, 589062, 787714, 8494112, 8494113, 8494094, 790790,
+  462857, 947974, 1011458, 633875, 659216, 652565, 8494122, 8494123, 487938, 47619, 8494084, 48901,
+  494598, 30983, 39944, 31497, 501002, 39691, 8494092, 505101, 8494094, 61455, 510480, 41233,
+  8494098, 516115, 517908, 434965, 475414, 8494103, 8494104, 511746, 37658, 41499, 8494112, 679942,
+  8494085, 8494082, 524064, 582154, 1036294, 1195782, 1077506, 8494097, 636173, 622352, 8494100, 1101574,
+  60458, 70955, 529154, 8494083, 49668, 43013, 533766, 8494087, 8494088, 539401, 547594, 8494091,
+  552972, 90637, 79886, 8494096, 561680, 8494097, 8494098, 343571, 241428, 79637, 358166, 990726,
+  8494104, 967426, 8494106, 8494107, 958470, 8494086, 1034253, 8494086, 48416, 1056522, 1154569, 8494115,
+  1034003, 8494100, 965904, 8494102, 8494100, 8494121, 567042, 101379, 58628, 331013, 573190, 8494087,
+  71688, 230665, 578826, 8494091, 8494092, 464653, 8494094, 71183, 584464, 114705, 8494098, 589843,
+  594196, 601109, 606486, 8494103, 72984, 8494087, 79130, 8494107, 8494090, 8494089, 8494083, 1744143,
+  611360, 1031938, 8494087, 864017, 8494100, 8494099, 860948, 1025557, 1117965, 1045770, 124458, 92203,
+  617218, 622851, 626692, 631813, 639494, 644871, 651272, 656649, 664842, 8494091, 669964, 675853,
+  683790, 691215, 699152, 704529, 8494098, 709907, 720660, 727573, 735766, 124951, 169240, 742681,
+  57626, 582939, 72476, 8494083, 8494084, 1264642, 8494112, 8494086, 1133064, 1502214, 1386498, 1313034,
+  2136582, 8494119, 1408006, 1776650, 8494122, 8494123, 748802, 82179, 81156, 72197, 755206, 761351,
+  82952, 8494089, 766986, 80651, 84492, 771085, 92942, 91151, 773136, 8494097, 8494098, 775699,
+  781844, 787221, 792598, 8494103, 8494104, 8494086, 93722, 383515, 1234186, 8494093, 1768450, 8494095,
+  796192, 8494089, 1774086, 8494115, 1412884, 1841414, 8494096, 1805314, 1238038, 8494102, 135210, 146219,
+  802818, 358659, 8494084, 808197, 816134, 91911, 547336, 613897, 821770, 8494091, 8494092, 827405,
+  8494094, 838415, 846352, 8494097, 8494098, 780051, 851732, 633109, 808982, 8494103, 8494104, 1272326,
+  91418, 93467, 1444355, 1253898, 1932802, 1831690, 99360, 8494082, 1976074, 1196816, 2129414, 8494095,
+  2141954, 2127889, 1445391, 1208598, 155946, 370987, 859394, 103939, 8494084, 94981, 866310, 115207,
+  105224, 99849, 872970, 8494091, 137228, 878605, 880910, 885775, 893712, 8494097, 8494098, 900627,
+  908052, 910357, 915734, 103447, 147736, 1250054, 156442, 239643, 8494097, 2192912, 2153235, 2142978,
+  522784, 8494102, 8494114, 2153478, 2183682, 2320394, 8494100, 2649862, 2181894, 1255958, 395050, 446763,
+  921090, 926723, 828676, 930565, 938502, 943879, 949768, 952841, 645642, 101131, 956684, 964621,
+  971790, 977935, 984080, 990993, 8494098, 996371, 1002516, 1008917, 165910, 740887, 8494104, 305177,
+  1017346, 1014811, 104988, 2753552, 831750, 1334530, 177184, 2220802, 322314, 8494102, 2759682, 2169350,
+  2776066, 8494119, 1022736, 2175498, 176170, 8494123, 2181389, 1336080, 1026070, 8494103, 1031170, 187139,
+  8494084, 8494085, 1036550, 8494087, 126472, 110601, 1042954, 8494091, 115980, 1045005, 116494, 633615,
+  1053200, 8494097, 8494098, 1058579, 1060884, 1063189, 1071382, 8494103, 126232, 2150146, 8494085, 127003,
+  8494087, 1720326, 8494082, 2749442, 197920, 1731594, 1442061, 2749702, 8494095, 2848262, 3215366, 1731088,
+  8494099, 1444628, 135722, 199723, 1076738, 1083139, 283396, 1086981, 1094918, 1047815, 1100552, 137737,
+  1105930, 8494091, 1111564, 1116685, 1124622, 506895, 1130000, 412945, 8494098, 223763, 1135124, 1141269,
+  1149206, 372247, 8494104, 8494105, 932890, 1153307, 8494087, 8494109, 8494087, 2218242, 1159968, 8494092,
+  8494093, 2226694, 8494093, 8494086, 3193098, 8494089, 1912595, 2939402, 1165866, 212779, 1172994, 443139,
+  137476, 1139461, 1179910, 136967, 8494088, 8494089, 1186058, 8494091, 143884, 714765, 1191182, 127247,
+  1199376, 1204753, 8494098, 8494099, 1206804, 1209109, 1215766, 144919, 312856, 8494083, 324634, 8494107,
+  8494095, 8494122, 2321666, 1924105, 1218080, 3280912, 2356486, 8494115, 3351298, 8494095, 2333194, 3558662,
+  3354374, 8494099, 879914, 693803, 1224706, 292611, 599812, 1230341, 1238278, 1245191, 1250568, 149257,
+  1258506, 8494091, 1262604, 170765, 500750, 1232143, 1273616, 397073, 8494098, 652819, 1279252, 1286165,
+  1294358, 178967, 8494104, 8494087, 473370, 1299995, 8494082, 3710995, 8494102, 8494093, 1304864, 2315021,
+  8494094, 8494115, 8494096, 2336785, 3775234, 8494101, 8494101, 8494101, 944682, 433451, 1310210, 1315843,
+  1322244, 1316357, 271622, 1325575, 1267976, 1330953, 1085450, 149003, 1191948, 1336845, 1342734, 1348111,
+  1166352, 1355025, 8494098, 1361683, 1370644, 1377557, 1381654, 232727, 282136, 871961, 167450, 403739,
+  191516, 2767374, 8494095, 3804166, 8494112, 8494113, 1761030, 2600468, 3394818, 8494096, 1916170, 8494119,
+  3423494, 8494100, 8494122, 8494123, 1388546, 8494083, 8494084, 157957, 1395718, 1401095, 153864, 1406985,
+  1414922, 8494091, 153356, 717069, 8494094, 8494095, 1419792, 1425169, 1732384, 1430547, 683284, 1431317,
+  1439510, 8494103, 160536, 8494092, 156186, 8494107, 8494095, 4021510, 3464710, 8494094, 729888, 2696468,
+  8494097, 8494115, 2724371, 8494093, 2890005, 8494096, 3468560, 4025090, 201258, 209707, 1446402, 1453571,
+  254212, 1457413, 1468166, 1475335, 1481224, 1485321, 1493770, 8494091, 1497868, 1504269, 1510158, 1515535,
+  1526032, 1518609, 8494098, 1531411, 1537556, 1542933, 1548310, 178711, 319000, 8494105, 296218, 1553947,
+  8494108, 4124176, 2731792, 8494087, 1559072, 8494113, 4230922, 8494115, 2730774, 3690502, 8494118, 4296976,
+  8494106, 3659530, 1564458, 222507, 1570050, 203267, 1576708, 516613, 1582086, 182791, 213768, 1587721,
+  1595658, 8494091, 1601548, 1159181, 244494, 403983, 1612560, 1619729, 8494098, 235539, 1625108, 1633301,
+  1644054, 186903, 213016, 8494084, 270618, 1648155, 2849550, 2855695, 3781891, 8494084, 1655072, 2857491,
+  2874388, 8494115, 2858255, 4031234, 8494118, 4508166, 2858515, 3987206, 1155114, 1459755, 1660674, 446211,
+  558340, 295429, 1667590, 8494087, 463112, 1673993, 1682186, 8494091, 8494092, 623117, 359950, 224015,
+  1689104, 189713, 8494098, 1695251, 1704212, 1709589, 1717782, 189463, 212248, 8494087, 390682, 1588251,
+  8494082, 8494109, 8494082, 3787021, 1722656, 3135747, 3135236, 8494085, 4060418, 4127238, 4317194, 3167753,
+  4035590, 4260362, 1650218, 1486379, 1728514, 1299459, 656388, 1101061, 1733382, 1738503, 1743880, 1696521,
+  1606666, 8494091, 1747724, 1756429, 1763598, 1769487, 901648, 1775377, 8494098, 1780755, 1788180, 1795605,
+  231958, 202775, 8494104, 343065, 211738, 360219, 218140, 3974147, 4024068, 8494102, 344352, 3044866,
+  8494082, 4011017, 8494086, 3084550, 4211206, 8494084, 3982094, 3979791, 254762, 8494123, 1803778, 8494083,
+  8494084, 8494085, 1809158, 8494087, 8494088, 8494089, 1815306, 3054358, 8494092, 263437, 223502, 8494095,
+  950800, 8494097, 1274114, 435475, 758292, 8494101, 283670, 8494103, 8494104, 598274, 8494082, 8494107,
+  4487431, 1844742, 3672070, 8494122, 8494096, 435210, 3658762, 4500238, 8494102, 4094978, 8494102, 1080592,
+  8494096, 4175878, 224810, 8494123, 1820930, 230147, 8494084, 8494085, 1825798, 433946, 8494088, 329481,
+  1830410, 8494082, 8494092, 8494093, 8494094, 239375, 854032, 8494097, 8494082, 240659, 417812, 244757,
+  959254, 8494087, 8494104, 8494096, 8494090, 8494107, 4603156, 8494096, 4112898, 2341654, 1046304, 8494104,
+  4064774, 4099882, 4100651, 1309717, 4065546, 8494090, 8494082, 4632322, 487466, 527147, 1836290, 8494083,
+  375044, 247045, 1792006, 8494087, 8494088, 8494089, 1839626, 8494091, 247308, 305933, 8494094, 8494095,
+  399376, 251153, 8494098, 8494099, 8494100, 1845269, 588054, 8494103, 8494104, 472838, 316954, 8494107,
+  4629264, 677130, 3796742, 8494085, 474125, 3874825, 8494090, 475152, 8494092, 8494093, 8494092, 8494100,
+  4652041, 482326, 8494122, 1850370, 8494083, 256004, 260869, 1712134, 8494087, 371976, 261385, 8494090,
+  8494091, 338956, 972557, 404238, 505615, 1252880, 1854481, 8494098, 1372947, 1859860, 840725, 261654,
+  8494103, 8494104, 8494086, 8494106, 272155, 4650259, 4530698, 8494099, 8494099, 269600, 1865218, 320003,
+  8494084, 423429, 1870854, 274439, 274696, 284425, 1876490, 8494091, 8494092, 351757, 284686, 8494095,
+  1882128, 8494097, 8494098, 8494099, 928276, 1136405, 1887510, 8494103, 1891608, 3531781, 337690, 614171,
+  4687878, 8494093, 8494094, 4126479, 1751840, 8494101, 8494094, 3534351, 8494100, 4700166, 4699910, 8494099,
+  3538196, 3568917, 661290, 421675, 8494082, 8494083, 8494084, 8494085, 1894150, 8494087, 293128, 8494089,
+  668938, 8494091, 8494092, 296717, 8494094, 8494095, 279824, 8494097, 8494098, 286995, 355860, 369941,
+  409366, 8494103, 8494104, 3669254, 8494082, 8494107, 8494089, 8494090, 8494100, 4557830, 8494112, 3160329,
+  4705542, 4713990, 8494092, 8494093, 4701194, 4572430, 8494096, 8494102, 8494122, 8494123, 8494082, 365827,
+  469508, 591109, 297478, 1326855, 1899528, 1903369, 351498, 8494091, 523276, 1909261, 1908750, 1914895,
+  383760, 760593, 8494098, 1921555, 988692, 1122581, 1929494, 8494103, 3377414, 8494105, 4746758, 8494107,
+  310300, 8494083, 8494084, 4171010, 8494112, 1123074, 328200, 8494089, 8494084, 930310, 8494122, 332301,
+  4745990, 8494090, 8494096, 8494097, 8494106, 8494099, 8494100, 8494101, 8494102, 8494103, 8494099, 4172310,
+  3949844, 8494107, 607747, 395524, 544261, 8494086, 361223, 451080, 791049, 434186, 8494105, 647180,
+  1935373, 339214, 786447, 361488, 492305, 8494082, 1942035, 1923860, 685589, 2618630, 8494103, 8494104,
+  8494086, 8494090, 372507, 413468, 1462787, 420612, 810501, 391942, 1946375, 725512, 1951753, 1008386,
+  8494101, 8494092, 1311501, 698126, 1555471, 4793606, 518161, 8494090, 1957139, 891412, 1193493, 3269122,
+  8494103, 8494096, 8494112, 3302918, 8494107, 8494108, 1213187, 8494102, 379141, 8494086, 380423, 701704,
+  1041179, 384266, 8494081, 400140, 1006861, 405006, 1962255, 8494102, 458001, 832002, 1012499, 484628,
+  743957, 1640982, 430082, 4040198, 8494105, 502026, 556038, 4690182, 509453, 8494100, 424202, 603664,
+  8494082, 4015120, 509715, 8494100, 470800, 505366, 445699, 3949334, 443653, 3281922, 404758, 446472,
+  451849, 1244426, 410906, 535052, 1070349, 452110, 718095, 8494101, 8494093, 8494103, 1761299, 600340,
+  455445, 693526, 686082, 8494100, 463897, 8494085, 1451526, 8494090, 4695083, 8494082, 8494082, 653314,
+  8494090, 488973, 8494086, 763910, 488720, 8494089, 8494096, 745738, 8494100, 503310, 1280015, 495376,
+  8494096, 703248, 491027, 532756, 500501, 1339394, 498967, 546582, 8494085, 770822, 528386, 8494102,
+  4736770, 796938, 616710, 563714, 8494112, 8494094, 732426, 609798, 8494087, 4657414, 8494089, 4741645,
+  517392, 508694, 530946, 597251, 8494093, 627472, 520470, 535815, 545555, 8494100, 904194, 8494100,
+  8494100, 8494086, 1023750, 1285638, 526624, 542481, 565258, 779795, 555028, 8494101, 8494085, 8494096,
+  968464, 1228048, 8494094, 543003, 8494101, 1104898, 751126, 559620, 8494100, 1366534, 8494102, 8494106,
+  569353, 634378, 888322, 568588, 540960, 8494112, 1947654, 567312, 632337, 8494089, 941578, 4710662,
+  619797, 574998, 550698, 580395, 1056016, 8494083, 8494094, 644371, 629780, 580103, 572950, 4745730,
+  4770580, 4749828, 591874, 586765, 822542, 1777935, 1432326, 8494106, 8494082, 1504019, 598538, 653077,
+  8494086, 624130, 1934854, 4206594, 599312, 670214, 8494090, 4211718, 4516870, 672778, 609046, 8494097,
+  1938192, 4798727, 1241364, 649987, 659716, 4219408, 4539408, 8494093, 664584, 773398, 1954074, 637208,
+  667660, 669453, 4508696, 676879, 4811541, 8494107, 8494098, 1965075, 8494100, 981781, 8494102, 1005314,
+  717827, 8494093, 8494085, 1967366, 8494087, 682504, 8494089, 842506, 8494100, 8494092, 1970445, 8494083,
+  8494095, 1203728, 4748810, 8494082, 1267475, 1138708, 722965, 736790, 4815366, 8494104, 4656138, 688154,
+  8494107, 8494093, 8494093, 8494099, 8494100, 701984, 8494086, 971266, 8494099, 8494089, 8494082, 932102,
+  8494084, 8494093, 765190, 8494122, 8494123, 1976585, 8494090, 942350, 1698060, 8494093, 4846598, 8494123,
+  691984, 953364, 8494101, 8494102, 8494081, 1984258, 8494102, 8494084, 8494085, 1828358, 8494087, 8494082,
+  8494089, 727050, 8494091, 1890822, 705549, 777486, 8494101, 746512, 8494097, 8494098, 700179, 725012,
+  755733, 8494095, 8494103, 8494083, 709636, 8494085, 8494100, 1897494, 8494100, 8494104, 8494090, 8494112,
+  8494092, 1786893, 8494094, 8494082, 8494096, 8494097, 1089026, 744467, 858132, 8494083, 913926, 780295,
+  8494104, 8494105, 797450, 8494122, 8494090, 708877, 4302097, 8494081, 804112, 8494100, 2367492, 1550867,
+  1652244, 1985301, 712214, 2357769, 3428866, 4800521, 8494081, 1399042, 4798988, 8494087, 1411845, 1488902,
+  722720, 737032, 2359828, 795658, 8494085, 8494086, 922125, 8494094, 1024527, 3419923, 3428116, 731179,
+  1112083, 1281044, 748309, 753174, 8494081, 764162, 8494099, 4068866, 8494082, 1049606, 3693574, 4850197,
+  8494086, 759562, 3655690, 4114186, 1482509, 820494, 1286415, 773904, 3660304, 4066320, 827923, 4675857,
+  997653, 8494102, 4850705, 8494104, 4860436, 8494106, 4847381, 8494107, 8494081, 769538, 760835, 8494112,
+  768005, 771846, 784391, 8494088, 8494094, 4760079, 3045378, 790284, 1577229, 8494122, 958223, 8494087,
+  4817414, 3218697, 783891, 927508, 8494101, 8494101, 865815, 8494081, 1990402, 8494083, 8494084, 8494085,
+  1288966, 8494101, 8494102, 4817685, 801802, 8494086, 789516, 809229, 8494089, 804879, 8494096, 8494092,
+  3055392, 823827, 812564, 1991957, 1144086, 8494083, 8494084, 4822025, 8494101, 813595, 4823308, 4692994,
+  1998082, 2003459, 8494112, 1379589, 2005510, 815879, 1376264, 4693258, 832778, 4743187, 1542412, 1590541,
+  850446, 8494123, 1801232, 945937, 4854544, 824083, 1474324, 2010901, 2016278, 4859669, 8494081, 1971970,
+  8494106, 962331, 4857108, 2009350, 8494087, 8494112, 975136, 1219338, 4855561, 8494092, 8494093, 1620238,
+  828175, 8494081, 1956625, 8494083, 823594, 2021396, 2023701, 832534, 1081090, 4854038, 8494082, 4807176,
+  8494086, 4862982, 4535814, 8494089, 1091082, 8494112, 8494090, 3486483, 8494100, 8494101, 8494100, 4806676,
+  8494096, 1099027, 8494100, 8494122, 2029570, 851971, 838916, 1878021, 2035206, 2036999, 2043144, 8494089,
+  2047498, 8494091, 2051596, 834573, 859918, 1838863, 2052624, 843537, 3173126, 839187, 2019092, 2057749,
+  848406, 8494123, 855576, 3149581, 4164866, 2062107, 4863494, 2546691, 4163590, 8494099, 854560, 8494087,
+  3175958, 2374921, 4863766, 4167693, 3150618, 8494081, 8494082, 8494096, 8494122, 8494123, 913670, 949255,
+  8494100, 868361, 8494090, 4803334, 4166682, 1171725, 4865030, 8494095, 870160, 874001, 8494093, 871699,
+  879124, 8494101, 8494102, 8494094, 8494099, 8494081, 2070274, 2072323, 883460, 1496581, 2077702, 890887,
+  1509896, 8494089, 2081546, 8494115, 1858572, 886285, 1431054, 1101839, 2086416, 886801, 8494100, 1069075,
+  1355540, 2091285, 896022, 8494103, 889624, 4851217, 8494106, 2091803, 8494100, 4857858, 4184322, 2098434,
+  8494112, 907780, 4212998, 2103558, 1399810, 4861450, 888073, 1401866, 1309446, 892940, 8494122, 8494123,
+  1317642, 2097936, 1246481, 8494099, 8494094, 2105108, 2109205, 924694, 8494101, 898840, 8494100, 938266,
+  2113538, 8494083, 8494084, 8494086, 2118662, 897568, 4761353, 2083593, 1636618, 8494092, 4859912, 995085,
+  1113358, 8494081, 987152, 8494122, 8494123, 2058003, 2094100, 2124053, 971030, 8494089, 4858644, 4875533,
+  1108484, 1745947, 8494086, 8494087, 8494096, 4872467, 910880, 8494099, 8494100, 1099533, 1366030, 1426703,
+  8494104, 4875030, 4873747, 2191891, 2041876, 8494123, 8494081, 8494082, 1018627, 8494084, 928773, 1152774,
+  2126087, 2030856, 8494089, 997130, 8494091, 899084, 1181197, 2130190, 2131471, 8494096, 914449, 4856067,
+  1016339, 2137620, 2143253, 8494102, 918807, 8494104, 8494105, 4877844, 1039643, 926236, 8494081, 8494084,
+  1994499, 1082884, 1461765, 4879618, 8494087, 4857365, 953097, 943370, 4600589, 1737996, 1741581, 1092878,
+  2148623, 4880653, 4601875, 8494086, 2152979, 1438484, 1002261, 2155798, 8494086, 4809991, 8494105, 957210,
+  8494081, 1103874, 977155, 978948, 1111813, 1212166, 982535, 994312, 1011721, 2159626, 4807444, 8494092,
+  2163725, 1057294, 2166031, 8494096, 1010193, 4886799, 2173459, 2179348, 1069333, 1118998, 8494103, 8494104,
+  8494105, 8494082, 8494107, 1019907, 8494084, 3394566, 1288454, 8494089, 8494096, 8494090, 8494086, 4886274,
+  1231884, 1968141, 1025294, 2110479, 8494096, 8494081, 2158338, 1031443, 1520404, 1904917, 2184454, 8494094,
+  4660998, 2985218, 2186506, 8494107, 8494085, 2989062, 8494092, 8494112, 1137424, 2992906, 4680464, 4887554,
+  4889346, 8494100, 1261846, 1047298, 1065475, 1051908, 8494085, 1064966, 1072391, 2996502, 1089289, 1070858,
+  1267232, 8494106, 1125901, 4895765, 1707535, 1088272, 8494097, 4876813, 2190867, 1230612, 1327637, 8494123,
+  8494081, 2192386, 1074201, 3998466, 4879382, 2198278, 8494123, 4002566, 1532162, 1936138, 1204484, 4009482,
+  2172934, 8494086, 4833031, 1605648, 1110538, 8494090, 1118732, 8494093, 8494099, 2145814, 1564176, 1299729,
+  4833553, 4899349, 8494100, 2202389, 1083926, 4765442, 2344965, 1164832, 2349319, 1145627, 8494084, 8494085,
+  8494100, 2349068, 1157152, 8494089, 4769805, 8494122, 1082411, 8494093, 2346771, 2355476, 8494099, 2441750,
+  8494122, 1112595, 8494100, 8494089, 1129238, 1121283, 8494084, 8494093, 8494086, 8494095, 8494088, 8494089,
+  4900884, 4615955, 4894735, 1335053, 8494094, 1141775, 8494082, 1147153, 4894997, 1599507, 1149716, 1153045,
+  8494084, 1155589, 1157638, 8494087, 8494106, 8494100, 1164042, 8494086, 8494092, 1157901, 8494086, 1194255,
+  8494096, 8494101, 4867341, 1167123, 1169684, 1171989, 8494102, 8494081, 2205954, 8494083, 8494084, 8494085,
+  2212870, 8494087, 8494088, 8494089, 2000394, 8494091, 8494092, 1177357, 8494094, 1175823, 2015504, 8494097,
+  4897798, 1916691, 1249812, 1174293, 2215190, 8494103, 8494104, 4801286, 8494106, 8494107, 4907286, 4802570,
+  8494096, 8494111, 1183776, 1980674, 1176322, 8494115, 8494084, 1987590, 1180678, 4796180, 8494096, 8494102,
+  1261354, 8494123, 2088461, 1189645, 8494095, 1251855, 4890388, 4892437, 8494099, 8494100, 8494100, 8494101,
+  8494081, 2220034, 8494083, 8494084, 8494085, 2223366, 8494087, 8494088, 8494089, 1349130, 8494100, 8494092,
+  8494093, 8494094, 8494095, 1192208, 8494097, 4856326, 8494099, 1675796, 1306389, 1383702, 8494103, 8494104,
+  4858125, 8494106, 8494107, 8494100, 4902421, 4318729, 4858387, 8494112, 8494092, 8494093, 4912905, 8494082,
+  4170000, 1210628, 1341445, 8494099, 1213447, 8494122, 8494123, 1216010, 8494083, 1217036, 1377805, 1216270,
+  1220111, 4905986, 1226001, 4906500, 1806867, 1225748, 1350165, 8494081, 8494082, 2058243, 1301508, 1322757,
+  4901651, 1321735, 1307656, 1329929, 1727754, 8494082, 1242380, 1915149, 1814030, 2229775, 4913930, 1343249,
+  8494098, 2236435, 1624596, 2176021, 2242326, 4911126, 8494104, 8494105, 1552898, 1257731, 1429252, 1357061,
+  8494086, 1412359, 1265928, 2141705, 2245642, 4914692, 1254156, 2249485, 2251790, 2256655, 1394704, 1647633,
+  4923155, 2262547, 2268436, 1589013, 1831190, 1273879, 1356034, 1368089, 1639684, 1518341, 2121990, 8494087,
+  1391112, 8494083, 4909060, 4919558, 1291532, 1293837, 1390350, 2275599, 1931280, 1302289, 8494082, 2206995,
+  2274836, 2280725, 1746694, 8494103, 8494082, 1319171, 1745674, 8494107, 4879887, 1323527, 4881425, 8494089,
+  1752848, 8494100, 8494083, 1371917, 1443598, 1348367, 8494082, 1401617, 8494104, 2285587, 2286868, 1422357,
+  1322518, 2289410, 1330200, 8494105, 8494112, 2293766, 8494082, 8494095, 8494089, 2300682, 4748294, 4923663,
+  4643092, 4887055, 4759562, 2305552, 4924425, 8494099, 1897986, 8494083, 1457156, 1511190, 2311174, 8494099,
+  8494100, 1407497, 1452042, 8494100, 1421068, 1349901, 8494082, 1498656, 1473296, 2315793, 4897542, 8494083,
+  8494100, 2315285, 1411094, 8494086, 3325186, 1340970, 1533739, 1352987, 3336454, 2234370, 4873478, 3349257,
+  1472800, 1355270, 8494092, 4860691, 1818377, 4861973, 3315728, 4924947, 8494083, 8494097, 8494122, 1453840,
+  8494102, 4878101, 1363987, 1419028, 8494101, 1433622, 1406466, 1366787, 1363460, 8494106, 4888849, 1375239,
+  4889619, 8494089, 8494090, 4795910, 1381388, 1388813, 2321166, 2325519, 1384976, 8494084, 4798221, 2328851,
+  1401364, 8494122, 8494123, 8494084, 8494099, 8494100, 4903181, 8494088, 8494089, 4926739, 8494081, 1990914,
+  4754946, 1425934, 1465103, 2007558, 8494097, 8494098, 1427219, 2015242, 4747274, 1434646, 8494093, 4896003,
+  8494105, 2065155, 8494084, 1478661, 8494099, 2017556, 1475592, 8494102, 4741398, 8494104, 1447180, 2078221,
+  1540622, 1786127, 4914182, 4897299, 8494100, 1842195, 1799188, 2130965, 1686806, 8494103, 1485826, 4198914,
+  4912656, 4883463, 2333958, 4325894, 8494122, 8494089, 8494090, 4224522, 4885774, 1952269, 4925193, 8494093,
+  1487632, 8494082, 4883220, 1452307, 2254100, 8494086, 1479446, 4199702, 2337033, 1472266, 1454362, 1516300,
+  8494093, 8494082, 4903692, 8494096, 1457952, 8494086, 8494099, 8494100, 8494101, 8494082, 4899092, 4912386,
+  1476357, 2222598, 1460778, 8494122, 3045634, 1856266, 2123526, 4914954, 3057926, 2094345, 2109450, 8494096,
+  2780170, 4911880, 1479955, 2342932, 8494096, 1479190, 2986256, 8494099, 8494100, 1484570, 4928774, 4930580,
+  2901270, 8494093, 4910101, 8494082, 1490435, 1592580, 1523717, 8494086, 1501959, 8494088, 2787360, 1539850,
+  8494086, 8494122, 1554189, 2076174, 2345231, 8494096, 1495569, 8494123, 2350099, 1972500, 2330901, 8494102,
+  1701634, 1507352, 8494105, 8494082, 2351110, 1884167, 4921610, 8494086, 1699850, 8494088, 8494089, 1617677,
+  4917264, 8494086, 8494096, 8494094, 8494095, 1748243, 1518868, 1538837, 1509398, 2469908, 2472469, 8494096,
+  8494086, 1554946, 8494099, 8494100, 8494085, 2178310, 1510688, 3428354, 8494082, 8494090, 4890115, 3465478,
+  1563149, 8494089, 1544719, 1521680, 4887817, 8494123, 1557523, 2355732, 1528341, 1569046, 2267394, 8494084,
+  8494100, 8494099, 2280198, 4890644, 4507145, 8494090, 1530634, 4450828, 8494093, 1815565, 1579278, 1536783,
+  1578768, 3438368, 8494086, 2358035, 1549332, 1626645, 1585174, 4924173, 8494104, 8494087, 8494106, 3433258,
+  3445035, 8494099, 8494092, 4743949, 8494112, 8494095, 8494082, 1654531, 1601284, 2166789, 2299398, 1725191,
+  2362120, 1561353, 1531178, 1546027, 1769740, 2367757, 2229006, 2371087, 8494096, 1568273, 8494099, 1642003,
+  2376724, 2379029, 8494082, 1574679, 4755976, 8494085, 1988102, 1597467, 8494092, 8494093, 8494094, 8494095,
+  8494101, 8494093, 4925453, 8494095, 1572624, 4926470, 4926996, 8494099, 1573652, 2042645, 1575446, 4927510,
+  8494104, 2384386, 4927759, 8494107, 1808645, 2390022, 1896711, 1602568, 8494112, 2244362, 4871430, 1575948,
+  2394125, 1593870, 8494095, 2344208, 8494097, 4875789, 4882179, 2116116, 1893141, 2237462, 4882439, 8494100,
+  8494100, 1597722, 1851419, 8494082, 4882957, 8494081, 3756546, 8494112, 2324482, 1737475, 4885523, 1608965,
+  2396166, 3757321, 3759626, 8494082, 2400522, 1601066, 8494123, 4817158, 1631502, 3758865, 1979152, 1607441,
+  8494100, 3802389, 2022164, 8494101, 1619222, 4878350, 3750170, 3765275, 8494099, 4812820, 4815125, 4878612,
+  8494101, 2405890, 1669920, 1625860, 2411525, 2414342, 1664775, 2420488, 8494101, 2424842, 8494122, 1729804,
+  8494083, 8494123, 1981455, 2430992, 8494088, 4940815, 3321097, 2432532, 2437141, 1711382, 3302157, 1604376,
+  8494095, 8494106, 2067995, 8494099, 8494082, 8494101, 3304469, 1603616, 4831238, 1677059, 1630468, 1636101,
+  4832010, 8494087, 8494088, 8494089, 4949254, 1631018, 1615915, 1674765, 8494094, 2441231, 8494096, 1641489,
+  8494102, 2309139, 1693460, 1648917, 1649174, 1723650, 4891912, 8494095, 4946198, 1651974, 8494087, 8494099,
+  8494099, 2445322, 8494102, 8494102, 1656589, 8494090, 4892948, 1833744, 2044433, 4892695, 8494099, 1661204,
+  1666325, 1662230, 2449922, 1789443, 1673732, 2456837, 2458886, 2002951, 2440200, 1806345, 2464522, 8494092,
+  2467596, 1864205, 2027534, 2069263, 2471440, 8494097, 8494102, 1940243, 2477588, 2421781, 2480406, 8494084,
+  1679384, 8494086, 8494087, 1680155, 8494099, 8494081, 3770882, 8494092, 2395424, 4929538, 3773958, 8494096,
+  8494097, 4870149, 3769866, 8494100, 4869896, 4929802, 2143786, 1681707, 2484994, 1693955, 1752068, 8494095,
+  2490118, 8494087, 3729430, 1824009, 1928458, 4872981, 2491404, 8494093, 8494094, 4936454, 1849872, 2495249,
+  8494112, 8494099, 2498068, 2503189, 2257686, 8494095, 8494104, 4825606, 8494106, 1695771, 8494099, 2506754,
+  8494083, 4945926, 8494093, 2500102, 8494095, 8494088, 2508809, 1870090, 8494101, 4821524, 3770372, 3782661,
+  8494122, 1877264, 8494107, 4943124, 2088979, 2264852, 2512917, 1713174, 4896260, 1701912, 8494086, 1696794,
+  1697819, 8494099, 8494100, 3812117, 4896524, 1709088, 8494099, 8494082, 8494083, 1711876, 1856773, 1880070,
+  1910279, 2478344, 8494089, 1722890, 8494123, 1713676, 2035469, 2515470, 2361359, 8494096, 1720593, 8494094,
+  2112019, 2102548, 2378517, 2944514, 8494099, 8494099, 8494105, 2988038, 1955611, 8494081, 2010114, 2618122,
+  8494084, 8494085, 2185734, 8494082, 8494081, 2597136, 2400010, 8494086, 8494099, 8494093, 8494089, 2759958,
+  4891396, 8494097, 8494083, 8494087, 8494100, 2517781, 1732630, 8494096, 8494099, 8494112, 8494106, 2522371,
+  1754116, 1982213, 1760006, 8494089, 8494097, 1782025, 1768714, 4891671, 2192652, 2515981, 1758990, 2527503,
+  4906247, 8494097, 4907017, 2532115, 2095380, 1923605, 1943574, 8494103, 4908303, 1773337, 8494081, 1778178,
+  8494108, 1785860, 1785605, 1950470, 4958735, 8494086, 1910025, 1959434, 8494089, 8494092, 2214413, 1988622,
+  2534671, 8494084, 1790225, 8494086, 2539027, 1827604, 2202901, 1798422, 8494082, 8494104, 8494105, 2530818,
+  8494107, 4775175, 8494097, 2543878, 8494087, 8494095, 4567317, 2037770, 8494093, 4888066, 2524429, 4776721,
+  8494107, 1788432, 4776468, 4892168, 2053139, 2161428, 8494101, 1794326, 8494081, 1857538, 4890895, 8494095,
+  1797381, 1972742, 8494094, 8494095, 8494096, 8494101, 8494081, 2546444, 2549517, 1797902, 2552079, 1802000,
+  8494081, 2294018, 2084371, 2409492, 2248981, 2555142, 1813271, 8494100, 1822489, 2182154, 1943299, 4895501,
+  4928260, 4895247, 8494087, 2554128, 4928520, 8494095, 4893204, 2565634, 1876237, 2303254, 2559247, 2570502,
+  8494097, 4929297, 2560019, 2575370, 1837077, 8494099, 8494100, 2117152, 8494105, 2443792, 8494090, 8494082,
+  2664962, 8494082, 4900613, 1843478, 2670086, 1866026, 1823531, 2569474, 2674698, 2324228, 8494102, 2496518,
+  4947213, 1892640, 2676496, 1851914, 8494083, 1847820, 4901141, 8494100, 2678806, 1995280, 2360849, 1846570,
+  8494123, 8494100, 2576661, 2030102, 2579202, 8494086, 2278688, 8494106, 2584582, 4804106, 8494099, 1863433,
+  2028298, 1855008, 4808975, 8494081, 2079530, 2129963, 2230800, 4810516, 8494086, 2254867, 2588180, 4801030,
+  2007318, 8494101, 1868824, 8494084, 4962060, 1870619, 4803597, 8494088, 8494089, 8494102, 1869600, 1871116,
+  4804371, 8494094, 2590223, 8494102, 8494085, 8494084, 2211091, 1878292, 8494101, 8494123, 1899273, 8494087,
+  4950022, 8494094, 1900301, 1888796, 8494092, 4893965, 4952588, 8494098, 2013971, 1902868, 1904149, 1913366,
+  4894228, 8494101, 8494105, 8494101, 8494081, 1918236, 2592771, 8494084, 2310661, 8494086, 1924615, 1935112,
+  8494084, 8494082, 4962575, 1964556, 2596621, 2465294, 2601999, 8494100, 1949201, 8494098, 2608915, 2610196,
+  2339349, 2615062, 2563330, 4952083, 8494100, 2597890, 2589190, 8494084, 2125573, 2150918, 8494087, 8494082,
+  8494089, 2217738, 8494090, 4824582, 2023952, 2142734, 2693903, 8494099, 8494100, 8494101, 2331411, 2606868,
+  2536213, 8494096, 8494089, 8494086, 8494099, 8494100, 8494101, 8494102, 8494112, 8494082, 2271491, 1964804,
+  8494085, 2109958, 2611719, 1998856, 1970185, 2619402, 8494122, 1974028, 2622221, 2348302, 2625551, 2089232,
+  8494097, 8494099, 2630931, 2637076, 2524181, 2046998, 4960262, 1974552, 8494105, 2022660, 8494082, 2641158,
+  2025735, 2021128, 8494086, 8494082, 4990466, 2042380, 2035981, 2045710, 2638863, 2087952, 8494102, 8494090,
+  8494096, 2048276, 2119701, 2053910, 8494081, 2646018, 8494083, 8494082, 8494100, 2651654, 8494082, 4960006,
+  8494084, 2656522, 2402310, 8494090, 8494090, 2850313, 2404618, 2661648, 2536716, 2413837, 2663682, 8494100,
+  4886531, 2566678, 4965397, 8494104, 8494088, 8494106, 8494102, 8494090, 2675468, 5026818, 4888589, 2055456,
+  8494093, 8494097, 4983566, 4986127, 2677524, 2993173, 4889877, 8494103, 8494104, 2200106, 2059563, 8494081,
+  2629378, 8494083, 8494084, 8494085, 2381062, 8494087, 8494088, 8494089, 2547722, 8494089, 8494092, 8494093,
+  8494094, 4691974, 2261520, 8494097, 4688393, 8494099, 8494100, 8494101, 2061334, 8494103, 8494104, 4687376,
+  8494106, 8494107, 8494099, 8494093, 8494101, 4928015, 8494112, 2068482, 2202627, 8494099, 4931348, 8494101,
+  8494087, 8494088, 2069513, 2075146, 8494102, 8494123, 2133005, 8494122, 2171919, 8494096, 2356241, 4988674,
+  2273811, 2314260, 2135317, 8494102, 2683650, 5006338, 2581252, 8494106, 2645254, 2082055, 8494101, 2098697,
+  2682378, 4987920, 2103308, 4564740, 8494094, 8494095, 2488848, 2688273, 4570377, 2109715, 8494100, 2689557,
+  4620557, 8494102, 8494104, 8494090, 8494106, 8494082, 4673299, 8494084, 8494101, 8494100, 2100768, 2692355,
+  2197508, 2370565, 8494086, 2479879, 2134792, 2132233, 2140938, 8494091, 2152460, 2699277, 2193422, 2704655,
+  8494101, 2659601, 8494096, 2709523, 2653972, 2614293, 2710806, 2136343, 8494102, 8494087, 8494081, 8494101,
+  8494108, 8494082, 2403075, 2225668, 2167557, 2424070, 2715143, 2156808, 2164489, 2717450, 8494093, 2167052,
+  2721549, 2627598, 2725647, 2208528, 2511377, 8494100, 2731283, 2723860, 2671893, 2500886, 8494081, 8494082,
+  2221849, 8494106, 8494081, 2417410, 8494101, 2258692, 2195205, 2284038, 2203911, 8494092, 8494093, 8494101,
+  8494096, 2212364, 2369293, 2733582, 2737167, 2386960, 2372369, 8494102, 2740243, 2430740, 2700565, 8494106,
+  2204695, 2740994, 8494083, 8494102, 8494085, 2746630, 8494087, 3297795, 8494084, 2748426, 2751234, 8494087,
+  8494093, 8494094, 2755078, 2585360, 8494092, 8494093, 2725130, 2752532, 8494101, 2318614, 5034261, 3294483,
+  2235920, 8494097, 8494107, 5038345, 2244116, 2757634, 2235670, 2448928, 8494085, 2760198, 2245383, 5048326,
+  2247689, 2764554, 5056519, 8494092, 2395168, 2223914, 2236971, 2249232, 8494082, 4915720, 5061898, 2744084,
+  2248725, 2285334, 2241834, 8494082, 4915471, 4840452, 8494107, 4842502, 4917523, 5059330, 4916501, 2262304,
+  2266626, 2277123, 2456324, 8494085, 8494086, 2765831, 5045779, 5042196, 8494090, 4844052, 4845589, 2769677,
+  2270222, 2773007, 2305296, 2277905, 8494089, 2776339, 2574356, 2762005, 5065218, 5057806, 8494104, 8494105,
+  8494106, 8494107, 2289692, 2779906, 8494083, 8494084, 8494085, 2782214, 8494083, 8494088, 8494101, 2663946,
+  8494087, 8494092, 8494093, 8494094, 8494101, 2786320, 4903427, 4902916, 8494099, 2789908, 2792213, 2418198,
+  4564499, 4440852, 4434453, 8494106, 8494107, 4903950, 8494105, 8494082, 2794754, 2270752, 2339076, 4905236,
+  2799622, 4904214, 5062153, 2293257, 2541322, 2807810, 2299916, 2286378, 2292779, 2814214, 2387216, 2803217,
+  2332169, 2755594, 8494100, 2803733, 2299670, 8494081, 2302991, 2819600, 8494095, 8494084, 2767891, 2821140,
+  2304533, 2510102, 2364448, 2824195, 8494084, 8494093, 8494107, 2311943, 4946959, 2658313, 8494097, 2302496,
+  2706444, 2824461, 2505998, 2828815, 5099029, 2313745, 8494086, 2410515, 2521364, 2830613, 8494123, 8494082,
+  8494083, 2377988, 2445573, 4952834, 2383367, 2388744, 8494089, 8494086, 8494091, 2431756, 2837517, 2398478,
+  2843407, 8494096, 2389521, 8494098, 2604051, 2831380, 2844949, 2390294, 8494103, 2408450, 2396931, 8494086,
+  8494082, 2579462, 4958212, 4719618, 8494086, 2436362, 8494099, 8494100, 2465805, 5083910, 8494089, 8494096,
+  2852354, 8494092, 2846483, 2451220, 2856710, 2456598, 4720401, 8494122, 2563594, 8494082, 8494099, 8494084,
+  5105423, 2416399, 2472720, 8494086, 8494107, 2415891, 2518548, 8494101, 8494102, 3087118, 3093007, 3097360,
+  8494106, 8494122, 8494102, 8494100, 8494101, 8494081, 8494112, 8494082, 2794243, 2484740, 2595845, 8494086,
+  2860551, 2631944, 2474761, 2419978, 8494122, 8494093, 2864397, 2425614, 2868751, 8494096, 8494082, 8494086,
+  2875923, 2881044, 2882837, 2510870, 2490626, 2428184, 8494105, 4918798, 2805766, 2854151, 8494085, 8494081,
+  8494087, 4919828, 4920085, 2595341, 4992262, 8494092, 8494093, 4990217, 8494100, 2428947, 2797332, 2884373,
+  8494099, 8494082, 8494101, 2640386, 8494106, 5033734, 8494085, 2889478, 4540675, 8494095, 2447648, 2454282,
+  8494093, 4584968, 2553869, 2453250, 2778639, 2449168, 4579341, 2892550, 2612243, 2891284, 8494097, 2462742,
+  4643603, 8494090, 4531989, 8494094, 8494095, 5107727, 2894850, 8494106, 8494099, 8494100, 2900230, 2463510,
+  8494082, 8494104, 2808586, 8494085, 8494086, 2737677, 4587524, 2477839, 2862352, 8494087, 8494096, 2900755,
+  2547988, 2616853, 2634006, 4575757, 4995842, 4624911, 4962324, 8494100, 4995334, 4645139, 4585748, 8494101,
+  2480160, 2903554, 2470915, 2478852, 2905349, 2907142, 2842631, 2483208, 8494089, 2910218, 2470698, 8494123,
+  2677773, 2874638, 8494104, 2912016, 8494082, 4906755, 5120014, 2528788, 2485269, 2847510, 8494103, 8494089,
+  8494094, 5102351, 2598683, 8494083, 4908558, 2914050, 2489091, 2484256, 4681730, 2917894, 8494084, 4905749,
+  4683014, 2652170, 8494093, 8494095, 4659210, 2554638, 8494123, 2554896, 2605841, 8494100, 4683792, 2489876,
+  2734869, 2517270, 8494100, 8494083, 8494081, 2923522, 8494094, 8494095, 2925061, 2932998, 2528519, 2938376,
+  2624777, 2926602, 8494102, 2638348, 5116425, 2493966, 2861071, 2935824, 8494082, 8494122, 2497299, 2941716,
+  2941461, 2531094, 2688791, 8494089, 8494087, 8494106, 2943515, 8494084, 8494085, 8494086, 2506247, 2699040,
+  8494089, 8494099, 8494100, 2517516, 2524941, 2668046, 2949647, 8494096, 2568465, 2499370, 2951699, 2952212,
+  2693141, 8494102, 8494103, 4787206, 8494105, 5081102, 2537755, 8494081, 2539266, 4781324, 5079059, 8494100,
+  2538758, 2545671, 8494097, 8494089, 2555402, 4789268, 4790037, 8494102, 5115151, 5118466, 8494097, 2956817,
+  8494082, 8494099, 2878740, 2560533, 8494102, 2916866, 2558979, 2560772, 8494090, 2705414, 8494082, 2562312,
+  2572553, 2716682, 4960774, 2671372, 2572813, 2958862, 2609167, 2574096, 2576913, 8494095, 2616339, 2814740,
+  2581525, 2718742, 8494100, 8494099, 8494100, 2957826, 8494083, 2677252, 5111046, 2963462, 8494087, 2586656,
+  8494089, 2898698, 8494115, 2682636, 2590733, 2627342, 8494096, 2966032, 2969617, 8494122, 8494123, 2929940,
+  2970133, 2710550, 8494086, 4927245, 8494094, 4929039, 2972162, 8494085, 8494092, 4849421, 2975494, 2717984,
+  8494102, 2713097, 2980362, 8494093, 4849684, 4851477, 2595086, 8494090, 2982928, 5123590, 8494123, 2947347,
+  2768148, 2983445, 2985494, 5141261, 4853514, 2989570, 4854796, 2728731, 4855310, 2829574, 5121811, 8494082,
+  2772000, 2620170, 4855060, 4855829, 8494083, 8494084, 8494089, 2633744, 5089538, 8494107, 2653705, 8494123,
+  5085958, 2639638, 2660877, 2640152, 2824719, 5142790, 2650907, 5088269, 2658579, 2789396, 8494101, 2651424,
+  8494082, 2681603, 5082900, 2690053, 4902658, 4901379, 4904452, 4953090, 8494090, 8494122, 8494081, 4957190,
+  4904714, 2690575, 2704899, 4904973, 8494123, 2701075, 2693652, 2712840, 2702358, 8494090, 4905492, 8494092,
+  8494093, 8494097, 2748687, 8494102, 8494099, 8494100, 2744595, 2705684, 2713621, 2712578, 2998275, 8494084,
+  3001093, 8494112, 2885639, 2835720, 2726409, 2725898, 8494090, 2880268, 3004941, 2728206, 3010319, 8494096,
+  5119750, 5115654, 3018259, 3003156, 3012629, 2882070, 8494100, 2739971, 8494084, 2746373, 8494107, 2819335,
+  2793480, 2781449, 3022090, 5148428, 5120278, 3027213, 2797070, 3029519, 8494096, 2747665, 8494086, 3037971,
+  2960404, 2995477, 2818070, 2743063, 5103878, 8494105, 8494106, 2784514, 5104394, 8494084, 2892293, 2954758,
+  2776583, 8494122, 8494081, 3021314, 8494104, 8494092, 2925325, 3047430, 3043343, 2813456, 8494104, 3049738,
+  8494099, 2910740, 2935042, 8494089, 2755863, 3052816, 3151878, 8494093, 8494107, 4592655, 8494090, 3054870,
+  8494100, 3091981, 4630804, 8494106, 8494102, 4957450, 8494100, 3142675, 3006996, 2809120, 2999062, 2877186,
+  2902531, 8494089, 4957971, 8494100, 2826503, 8494102, 2836489, 3032106, 2774571, 2788364, 2963213, 2851086,
+  3056655, 4920325, 3062289, 8494085, 3064339, 3010836, 3064597, 2792726, 3068930, 2799384, 8494105, 4920847,
+  3071494, 4919313, 8494096, 8494089, 3075338, 3080706, 8494097, 2804228, 8494104, 3082246, 3076880, 5127958,
+  2806537, 2945546, 3089410, 2811148, 2844438, 8494094, 3091462, 2978320, 3083537, 8494089, 3094538, 8494100,
+  3086357, 2815510, 3077152, 5154566, 2827024, 8494090, 2822171, 3095059, 3098900, 8494101, 3100182, 2828064,
+  2801706, 5057026, 5138946, 8494107, 8494099, 5054982, 8494082, 4867587, 2857760, 8494122, 2828546, 4869639,
+  8494084, 2830085, 8494090, 5054736, 8494088, 2837257, 8494086, 8494123, 5139988, 3100941, 2999822, 3106063,
+  4866580, 2845201, 8494100, 3107603, 2918164, 2849045, 8494081, 2863106, 3112963, 2952708, 3118853, 8494096,
+  3120391, 3125768, 2864137, 8494090, 8494088, 3127820, 2971405, 3128078, 3133455, 8494096, 3066641, 8494083,
+  3140371, 3144980, 3147285, 3153174, 2930711, 2872856, 8494083, 8494106, 3017218, 2871555, 4862478, 4865551,
+  3024134, 4865809, 5103369, 4865299, 2911754, 5106956, 5170708, 3154957, 3560453, 8494086, 2879760, 3166722,
+  8494095, 2887187, 3157268, 3170054, 3005974, 8494094, 3559695, 2931466, 8494083, 2889243, 8494099, 3593748,
+  3594517, 3055632, 2887968, 8494093, 3106323, 2905876, 3096597, 2922774, 8494095, 2894616, 8494082, 5158677,
+  8494099, 5156627, 8494086, 8494102, 8494102, 2969888, 2991362, 2995971, 2895364, 8494100, 2895878, 2919687,
+  3172616, 3118089, 3176458, 8494122, 2961164, 3035149, 3179022, 3184655, 2974480, 3186449, 5174274, 3190547,
+  3196692, 3133973, 3202070, 2928407, 2981378, 2907417, 8494082, 8494085, 3038470, 5051906, 4459270, 5179917,
+  8494090, 5053446, 4368650, 2922253, 5178634, 5053706, 8494096, 8494097, 4395024, 2939923, 4907779, 4364819,
+  2933782, 3105794, 2937603, 3032836, 3139589, 3203846, 8494095, 3122696, 4907533, 4910350, 8494099, 3205132,
+  2944013, 3048462, 3210511, 2946832, 3015185, 4912150, 5177353, 3216660, 3182357, 8494102, 3147031, 3214850,
+  2957337, 4953346, 3155739, 2956294, 5119238, 8494086, 8494082, 8494094, 8494090, 8494090, 3135501, 2970894,
+  2971663, 2962704, 8494101, 8494096, 2972947, 3103252, 8494101, 3219458, 8494083, 2977796, 8494085, 3224582,
+  8494087, 8494088, 5077270, 3040522, 8494107, 8494092, 8494093, 8494094, 8494095, 3225872, 8494092, 8494090,
+  8494112, 3114516, 3085845, 3019798, 8494123, 8494095, 8494082, 8494106, 8494107, 8494099, 4792582, 8494102,
+  8494093, 3036704, 3229186, 2978819, 8494084, 8494085, 3232006, 5157122, 4785168, 5104143, 2991114, 8494099,
+  4792852, 4789525, 8494100, 8494101, 3052560, 2984209, 5158157, 4786715, 3086868, 8494101, 3030550, 3006210,
+  3234563, 3012356, 8494088, 8494086, 3018503, 3172104, 3059465, 3011850, 2980128, 3161868, 3059981, 3038222,
+  3027727, 8494096, 3181073, 5181446, 3237651, 3239444, 3197973, 3243266, 3026711, 3060484, 8494105, 3245318,
+  4725250, 8494108, 3069961, 3070218, 4731142, 3123468, 8494084, 4730633, 4728586, 3105552, 3247121, 8494084,
+  3230466, 8494100, 3249941, 3194134, 3287302, 4728851, 8494100, 3252994, 3075075, 8494082, 8494100, 3256582,
+  8494097, 3121184, 3160585, 3258378, 8494101, 3165459, 3158548, 8494101, 3163670, 3200016, 8494107, 3069738,
+  3261971, 3209748, 8494101, 3252246, 5171206, 8494123, 3164704, 8494095, 8494090, 8494097, 8494086, 8494099,
+  8494100, 3074848, 3076354, 3078403, 8494082, 3073797, 3084294, 3261191, 3264264, 8494089, 3159562, 3203114,
+  8494123, 3071245, 3269902, 3275279, 8494096, 8494083, 3277826, 3277075, 3236116, 3281429, 3214598, 5180437,
+  8494089, 8494105, 3117066, 8494084, 8494085, 8494093, 8494087, 8494090, 3102736, 5090579, 8494100, 8494092,
+  8494093, 8494101, 3149846, 3097879, 3110936, 4120834, 8494083, 8494100, 8494099, 4038406, 8494084, 8494085,
+  3190304, 4044810, 8494099, 3101705, 8494099, 8494102, 8494100, 4172048, 3108622, 3101455, 8494122, 3114001,
+  8494098, 3139859, 3127060, 8494101, 3282966, 8494106, 8494085, 8494105, 8494083, 3129860, 8494085, 8494112,
+  3127303, 8494095, 3129353, 8494088, 5181958, 8494092, 8494093, 3620620, 8494090, 3604494, 8494097, 8494102,
+  8494097, 3167252, 3599123, 3651348, 3656213, 8494089, 8494082, 5182466, 8494107, 8494108, 8494081, 8494082,
+  3285251, 3221508, 3287557, 8494086, 8494087, 3292680, 3136521, 3137546, 8494096, 3187980, 3295757, 3159822,
+  3301391, 3140112, 5193222, 8494098, 3308051, 3262740, 3310357, 3312918, 5192966, 5196819, 8494092, 3155226,
+  8494112, 8494108, 8494082, 3174147, 8494084, 3179525, 3207686, 3180551, 3201032, 3185417, 3303946, 5090310,
+  8494102, 3318285, 3240718, 3322639, 3178768, 3207441, 5095437, 3326739, 3325972, 3293205, 8494102, 8494100,
+  8494089, 3193369, 3199234, 3201795, 3276804, 3329029, 3331078, 8494087, 3205640, 8494089, 5199379, 8494100,
+  3336204, 3332109, 3228174, 3340815, 3205904, 8494097, 8494122, 3268371, 3343636, 3345173, 3350530, 8494103,
+  8494123, 3614722, 3353350, 8494093, 3213832, 3568646, 3335434, 4835074, 8494112, 3568394, 8494082, 4844806,
+  3587853, 3213073, 8494089, 3570192, 3316756, 3215125, 3288086, 3600660, 8494101, 8494101, 5205764, 8494104,
+  8494099, 8494100, 4845077, 5145357, 3216928, 8494095, 8494102, 3306499, 4842779, 3238661, 8494100, 3220743,
+  3245064, 3225353, 3222538, 3212075, 3224844, 3235341, 3241230, 3356175, 8494096, 3298833, 8494081, 3346451,
+  3236884, 3261461, 3242262, 3244546, 8494087, 8494105, 8494106, 3257350, 3286023, 5171721, 3249417, 3356674,
+  8494095, 3246852, 3250701, 3361286, 8494096, 3250448, 8494101, 8494083, 3367426, 3265044, 8494102, 8494102,
+  3365894, 3251216, 3359249, 8494089, 3368970, 8494100, 3363861, 3265302, 3263502, 8494089, 3290640, 8494106,
+  8494082, 3293715, 3374100, 8494089, 3296022, 3268640, 8494087, 5122317, 4843786, 8494107, 8494082, 8494093,
+  3270660, 5121555, 4846864, 5122837, 8494123, 8494089, 8494100, 8494086, 8494102, 3374861, 3334670, 3377167,
+  3273002, 8494123, 3312649, 3270931, 3376404, 3311893, 8494101, 5208341, 3296271, 8494096, 8494097, 8494098,
+  3308307, 5000207, 3289109, 3289366, 5208591, 8494099, 8494100, 8494101, 8494081, 8494108, 3381251, 3318020,
+  3384325, 8494086, 3307783, 3388424, 3345673, 3354890, 8494086, 3386636, 3393805, 3397134, 3402511, 3308816,
+  3407377, 8494098, 3412499, 3414292, 3419669, 3349782, 3320343, 3423234, 8494101, 8494084, 8494084, 3427846,
+  8494086, 8494082, 3506178, 3363082, 8494100, 5147654, 3507718, 8494087, 8494088, 3432720, 3398410, 8494097,
+  3405587, 3333652, 3371029, 3321622, 3511312, 3324440, 5147411, 8494106, 3509268, 3425557, 3501334, 3401239,
+  8494096, 8494081, 3372290, 3384835, 3390724, 3323653, 3409414, 3392519, 3415048, 3379465, 3434762, 3324970,
+  3415308, 3438093, 3429902, 3446287, 3439376, 3452177, 8494099, 3456531, 3462676, 3466005, 3440918, 3355415,
+  8494104, 8494105, 8494106, 8494107, 8494108, 3396866, 8494086, 4866311, 5209364, 3417862, 8494087, 5210131,
+  8494092, 3327498, 5063430, 4867855, 3335949, 8494089, 5064458, 3333136, 4867092, 4864789, 8494099, 8494100,
+  3421717, 8494102, 3468802, 5066515, 8494086, 8494085, 3470598, 8494082, 3334920, 3337993, 3343114, 8494112,
+  8494083, 3436813, 5197073, 3472655, 3391760, 4664072, 5201429, 3381011, 3453972, 3340309, 3362070, 8494094,
+  4686351, 8494084, 8494101, 3351835, 5205007, 4659476, 5206801, 8494102, 3343904, 3366914, 3368195, 3379716,
+  3474693, 3475206, 3385095, 3477256, 3373833, 8494107, 8494122, 3481100, 3397389, 3383054, 3482639, 3460624,
+  8494097, 3493634, 3406099, 3488532, 3486741, 3497222, 8494103, 8494093, 8494105, 3492618, 8494094, 8494095,
+  3490829, 8494099, 3499791, 3485456, 8494100, 5156117, 3500307, 3502356, 3503125, 3467286, 3575810, 8494123,
+  8494086, 8494093, 3598086, 5244692, 3521544, 8494089, 3577354, 3419168, 8494095, 3587341, 4932112, 8494095,
+  3580944, 5155860, 8494101, 8494082, 3588116, 3390250, 3391019, 8494081, 3403010, 3494403, 3407620, 3406853,
+  3409158, 3441671, 8494112, 3416073, 3417610, 5248522, 3447564, 3514893, 3441166, 3512847, 8494101, 3516177,
+  8494122, 3518739, 3520276, 3523861, 8494100, 8494103, 3527682, 8494105, 3451140, 8494107, 3533062, 3437831,
+  8494085, 4954626, 3536394, 4884232, 3535628, 4956422, 3449102, 8494092, 3539216, 3542801, 4887311, 3440147,
+  8494100, 3543317, 3526422, 4886036, 4955409, 8494102, 8494106, 3451419, 4959253, 3545346, 8494082, 8494086,
+  3473696, 3551238, 4961542, 3452680, 3545609, 3531274, 4959498, 5209102, 3453709, 3489038, 3453199, 3522320,
+  8494096, 8494087, 3551507, 3540244, 8494101, 3490326, 8494082, 5143055, 8494094, 4962831, 8494107, 5145619,
+  8494100, 5143573, 8494100, 3476256, 8494102, 3461122, 3458307, 8494084, 3454981, 3456006, 3463175, 8494088,
+  3504137, 8494090, 8494123, 3473164, 3465741, 3557134, 3562255, 8494096, 8494097, 8494100, 3560979, 3554324,
+  3564565, 8494102, 4319235, 3567874, 8494105, 4504326, 8494107, 3570438, 8494081, 4328970, 8494090, 3502090,
+  4388365, 8494093, 3475469, 4375312, 5211657, 3510544, 4364051, 4443412, 4325653, 8494100, 8494102, 8494083,
+  8494084, 3564056, 8494086, 8494087, 8494088, 3574793, 8494090, 8494101, 8494086, 3546144, 8494094, 8494095,
+  8494090, 3482385, 8494098, 3480339, 3565332, 8494090, 3523350, 3467050, 3497475, 3499268, 3540997, 8494096,
+  8494082, 8494090, 8494084, 3501066, 4829958, 3513868, 3504909, 3507982, 8494095, 5259027, 8494099, 4834061,
+  8494099, 3508756, 8494101, 8494102, 8494081, 3574274, 8494083, 3520002, 8494102, 3580422, 3524357, 3591174,
+  8494100, 3511562, 8494091, 3592202, 3577613, 8494087, 8494082, 3513616, 8494095, 3566352, 3523603, 3579668,
+  3526163, 3554582, 8494101, 8494102, 8494122, 3517466, 8494082, 8494106, 8494084, 8494087, 8494086, 8494112,
+  8494086, 3584521, 8494090, 8494086, 3590412, 8494093, 5209616, 3597058, 8494095, 8494122, 3522859, 3598598,
+  3603975, 8494099, 8494102, 3555082, 4757766, 4758791, 3564301, 5160454, 4760586, 8494096, 8494089, 8494093,
+  3538451, 3604756, 3583253, 3537174, 3537922, 4759059, 8494100, 4762645, 3607302, 5158420, 8494101, 8494093,
+  8494090, 8494112, 8494096, 3606285, 3549966, 3610127, 3598864, 8494100, 8494082, 3613459, 8494100, 8494122,
+  8494102, 8494087, 8494104, 3617538, 8494106, 3580164, 3618053, 3622918, 3620359, 3622664, 8494112, 3625226,
+  5258260, 3625484, 3628557, 8494101, 8494085, 3628048, 5257748, 4893448, 3544618, 3581460, 3585301, 3583766,
+  4893709, 5208838, 3630594, 8494106, 3632667, 8494090, 3635718, 4891156, 4894485, 3585824, 3638282, 8494089,
+  8494115, 5273364, 3605518, 3589135, 3612944, 3592465, 5213456, 8494097, 3593492, 8494101, 3612694, 3640322,
+  5257986, 8494084, 3636485, 3645190, 8494087, 3644680, 8494085, 3649802, 5259530, 3600140, 3610637, 8494086,
+  3618575, 3650832, 8494090, 8494090, 8494095, 3643924, 3652629, 3637782, 8494103, 8494100, 5284358, 8494106,
+  3606811, 8494081, 3656450, 8494082, 8494082, 3596320, 3661830, 3665671, 8494086, 3615241, 3658506, 8494089,
+  8494090, 3641357, 5219334, 8494095, 3613712, 3665937, 5217802, 8494099, 3623956, 8494101, 3616790, 8494099,
+  8494100, 5250581, 8494106, 8494081, 3671298, 3618307, 3657732, 3677445, 3683334, 3631367, 3686920, 8494089,
+  3689482, 5288706, 3662860, 8494086, 3690766, 3666959, 3692816, 8494097, 8494098, 3677971, 3697428, 3699733,
+  3676950, 4910852, 8494087, 4911622, 3624474, 3625755, 4909833, 8494092, 8494093, 5245446, 3639584, 5290253,
+  4913167, 5245962, 8494099, 3628290, 4913683, 3666436, 8494101, 3699206, 8494122, 8494123, 3682057, 8494090,
+  4667650, 3704332, 3633165, 3633678, 8494086, 3635216, 3705873, 8494093, 4689162, 3709716, 3710485, 3644950,
+  8494081, 8494086, 4668944, 8494106, 3650075, 8494099, 3713538, 8494082, 8494106, 8494090, 3716870, 5203974,
+  4978445, 3704585, 3719690, 4975376, 5291797, 3649293, 4972038, 8494122, 3720720, 8494096, 4974346, 3722259,
+  3725588, 3727893, 3647510, 3656967, 3659272, 8494089, 3649546, 8494099, 8494100, 3653645, 8494094, 3653391,
+  8494112, 8494089, 8494099, 3729683, 3655444, 3667989, 8494094, 5200911, 8494112, 8494097, 8494122, 8494123,
+  8494081, 8494082, 5288962, 8494084, 3680517, 8494100, 3660551, 3670536, 3675657, 8494083, 8494099, 3695628,
+  3732493, 3681294, 3735055, 5249542, 3700753, 8494098, 3741715, 3708180, 3745813, 3697686, 8494103, 8494097,
+  8494095, 8494106, 8494083, 8494108, 8494081, 3703810, 8494083, 3681028, 3685893, 3688198, 3685383, 8494088,
+  8494093, 3718922, 8494095, 3690252, 3748621, 8494094, 3750927, 8494083, 3687185, 8494085, 3754003, 3723796,
+  3683093, 8494081, 3759874, 8494088, 8494105, 5295108, 3763974, 8494087, 8494086, 8494087, 3733514, 8494099,
+  8494097, 3748877, 8494102, 8494092, 3703056, 8494094, 5064207, 3715859, 3757076, 8494101, 3694614, 8494100,
+  8494081, 3736066, 8494083, 5277698, 8494085, 3763718, 8494087, 8494088, 3709984, 3716618, 5287181, 8494092,
+  8494093, 8494094, 8494095, 3718160, 8494099, 5275664, 3699475, 8494100, 3709461, 3726358, 5222658, 5292564,
+  4951558, 8494106, 8494107, 8494087, 8494090, 5285902, 8494095, 3730464, 3766274, 8494093, 3723012, 8494085,
+  3749894, 8494099, 3724040, 8494097, 8494102, 8494122, 8494123, 3761165, 8494094, 3770639, 3759376, 3726097,
+  8494082, 3728147, 3728404, 3769365, 8494083, 3725060, 8494085, 3736326, 5279234, 3731227, 8494089, 3740170,
+  5279494, 8494082, 3776781, 3731470, 3739663, 3743504, 3778065, 8494101, 3776531, 3742484, 3780629, 3740694,
+  3781634, 8494104, 8494105, 8494096, 3784198, 3744775, 5261075, 8494089, 3750410, 5175045, 8494086, 3757837,
+  5176840, 8494089, 3751696, 8494097, 5219842, 3786003, 3783956, 3752725, 3752214, 3767298, 8494101, 5052930,
+  3791874, 3790854, 5221388, 5054470, 3803398, 3791626, 8494096, 8494089, 3768586, 8494107, 4921352, 3797008,
+  4922634, 5049872, 3804944, 4922893, 8494122, 8494099, 3777300, 5051414, 3808022, 4923923, 8494095, 4924693,
+  8494106, 8494107, 8494099, 3797536, 8494082, 8494112, 8494084, 8494100, 8494082, 8494083, 8494084, 3769093,
+  8494090, 8494122, 3787563, 8494089, 8494123, 8494123, 3775756, 3808781, 3776014, 3794959, 5116692, 8494101,
+  5257218, 3783443, 3782420, 3800085, 5256198, 8494093, 8494084, 5290758, 5257482, 3772699, 8494081, 3814402,
+  3819267, 3823364, 3826437, 3793414, 3822343, 3829512, 3831817, 3813130, 8494102, 3833100, 3840269, 3845646,
+  3850767, 8494100, 3801361, 8494098, 3856915, 3858708, 3861013, 3865366, 4879107, 5296661, 3802137, 8494086,
+  8494085, 8494108, 5305094, 3870210, 8494083, 8494083, 4880141, 3872262, 4881167, 8494094, 5280271, 3814922,
+  4882707, 4878868, 3839757, 8494102, 8494123, 3790096, 3879426, 8494097, 3814163, 3871252, 3881222, 8494102,
+  5276681, 8494101, 3824650, 3789850, 8494083, 8494084, 4145669, 8494096, 3841296, 8494095, 8494099, 3836947,
+  3815188, 3827477, 3798294, 5106438, 8494095, 8494084, 8494085, 4821254, 3797803, 8494100, 8494093, 8494094,
+  3805984, 8494100, 8494093, 8494085, 8494099, 8494108, 8494088, 8494102, 8494099, 4817940, 8494122, 8494081,
+  3884546, 3864323, 3813636, 3888133, 8494086, 3885575, 3832328, 3889929, 3894026, 8494112, 3815948, 3898125,
+  3903758, 3909391, 3859472, 3898641, 8494082, 3915283, 3921428, 3867669, 3925782, 3822615, 3846168, 8494105,
+  4991490, 3809563, 4993284, 8494089, 3809026, 8494082, 8494112, 8494095, 3833862, 3810823, 4995596, 8494097,
+  3825930, 5280787, 8494102, 3904269, 8494093, 8494123, 3857424, 4994837, 4993046, 3836435, 3873812, 3838741,
+  8494102, 8494099, 5311238, 3887874, 5295629, 3826715, 8494085, 3927814, 8494082, 5302031, 8494099, 3848458,
+  4959750, 8494100, 3929357, 8494101, 3905039, 3919120, 8494081, 3878402, 3923731, 3931156, 8494096, 3935494,
+  4313859, 4359940, 4955668, 8494090, 8494087, 8494083, 8494089, 8494092, 8494081, 3935248, 8494100, 8494094,
+  8494097, 8494100, 8494112, 3831574, 4491027, 4951818, 4415253, 3829034, 4954381, 8494094, 4956175, 8494101,
+  8494122, 8494112, 8494093, 4956692, 3856642, 3837443, 3906308, 3892997, 3938310, 3940871, 3943688, 3830826,
+  8494123, 8494091, 3909644, 5028866, 3943182, 3948303, 3838992, 5037574, 3955202, 8494099, 3951380, 3952149,
+  3957254, 8494096, 8494085, 8494105, 3840778, 5040400, 8494089, 3958797, 8494099, 3839247, 3960848, 8494102,
+  8494081, 3897875, 3963668, 3965717, 3874070, 8494087, 8494101, 8494102, 4923394, 3968002, 8494084, 8494093,
+  8494086, 3969798, 3846688, 8494088, 4921098, 3847946, 5249299, 5250068, 5251093, 5316610, 4921872, 3849744,
+  8494122, 3849003, 8494100, 3929876, 8494101, 8494102, 8494081, 5043970, 3973122, 8494106, 8494107, 8494085,
+  3976966, 8494083, 8494084, 8494085, 3870730, 8494094, 8494093, 8494089, 8494095, 8494096, 3881744, 8494097,
+  8494099, 3851562, 3905300, 8494101, 3853334, 3979266, 8494102, 8494101, 3879173, 3983366, 8494087, 8494088,
+  5307142, 3958538, 3861792, 8494092, 8494082, 8494082, 8494095, 3987984, 8494086, 3891974, 8494087, 3969044,
+  3922197, 3863574, 5306900, 5301013, 3921933, 8494106, 8494107, 3896592, 8494096, 8494097, 3898387, 3919380,
+  8494101, 8494102, 8494096, 8494097, 8494106, 5312774, 5150228, 5152021, 8494097, 3867434, 8494123, 3986691,
+  3869956, 3877381, 8494086, 3893255, 3931912, 3943945, 3934986, 8494100, 3880204, 3965965, 3992846, 3993359,
+  3889424, 3961617, 8494089, 3998739, 3998228, 4003861, 3935766, 3978242, 8494083, 8494084, 8494106, 4007942,
+  3893788, 8494085, 3940361, 3904010, 8494094, 8494083, 5271556, 8494094, 3906831, 3982608, 5170958, 5335571,
+  8494099, 3891732, 3911701, 8494102, 8494082, 8494101, 5167126, 4012802, 8494107, 3920900, 8494100, 4016390,
+  5321474, 3914528, 3990025, 3921674, 5321734, 4018956, 8494096, 3923982, 3926031, 3970832, 3995409, 8494086,
+  8494123, 8494100, 4022037, 3936534, 4027906, 5313807, 4979462, 8494106, 4032262, 8494096, 5313044, 4009225,
+  4026890, 4974605, 8494101, 4981263, 4982544, 8494083, 4001552, 8494090, 4981524, 4004115, 4014356, 8494101,
+  4034070, 3929602, 3983875, 3939844, 3970565, 8494107, 4034823, 3940616, 3961865, 3977738, 3975456, 4947970,
+  8494089, 4039182, 4045071, 8494086, 3994129, 8494112, 4003347, 4039444, 4049173, 8494123, 8494085, 3997698,
+  5334293, 8494096, 3941915, 4047878, 5313542, 8494082, 5217549, 4049674, 4834821, 4827142, 4824839, 4828936,
+  8494099, 4006160, 8494101, 8494094, 5307919, 8494112, 4023573, 3955990, 8494083, 3993624, 8494085, 4836116,
+  3954695, 8494088, 8494089, 8494122, 8494123, 4004640, 4833307, 8494094, 4038927, 5322262, 8494097, 8494098,
+  4054547, 4046356, 4014101, 4050454, 8494122, 3960323, 8494105, 3956229, 8494087, 8494087, 8494089, 8494089,
+  5338902, 8494096, 8494092, 4055053, 3972366, 8494122, 8494097, 8494102, 8494099, 8494099, 4055828, 3966741,
+  8494087, 8494081, 8494082, 4058371, 4059140, 4048901, 8494108, 4062215, 4064264, 3982857, 4029194, 5327119,
+  4066828, 4069901, 4072206, 4077583, 8494100, 4056337, 8494098, 4084755, 4086548, 4090133, 4094230, 3989527,
+  8494086, 3992345, 8494106, 8494081, 4097282, 5363987, 4961282, 8494097, 3994886, 8494085, 4961798, 4102153,
+  8494088, 8494091, 5331714, 8494093, 5366035, 8494087, 4002832, 5381396, 8494096, 8494099, 8494100, 5325581,
+  8494102, 4059650, 4054787, 4062980, 4007685, 4105990, 4036359, 4071432, 4109065, 4115210, 8494102, 4020492,
+  4120589, 4072974, 4124687, 4018448, 4032785, 8494098, 4130323, 4136212, 4112661, 4096278, 8494081, 4134914,
+  4139289, 4347138, 5336335, 8494086, 8494082, 4485638, 8494099, 4079114, 5245190, 4322570, 4987138, 5245705,
+  8494095, 4142096, 4988422, 4300048, 8494099, 8494100, 4988938, 8494102, 4330517, 4301846, 8494086, 4370200,
+  4990992, 5311497, 8494104, 5382918, 8494092, 8494112, 4067586, 4304416, 4040708, 4089861, 4143622, 8494087,
+  4146184, 5358082, 8494082, 8494122, 4148236, 4153357, 4082958, 4156431, 4042000, 5359626, 8494083, 4053267,
+  4161556, 4076565, 4986666, 4090647, 8494081, 4160002, 8494083, 8494107, 8494086, 4151302, 8494095, 5337353,
+  8494089, 4164362, 5181715, 8494100, 4083725, 5376010, 8494095, 4166416, 8494093, 8494100, 4097043, 8494100,
+  4063765, 4129814, 8494103, 4373252, 8494089, 4348166, 8494099, 4342024, 8494093, 5395207, 8494095, 8494112,
+  4354573, 8494094, 4354319, 5164308, 5166101, 8494102, 5394448, 4506388, 4358421, 8494122, 8494123, 8494081,
+  4069122, 4140035, 8494084, 5393171, 4075782, 4091399, 4079880, 4134153, 8494090, 8494123, 8494092, 4173837,
+  4080910, 4122895, 8494096, 4147729, 8494112, 4177427, 4177172, 4096533, 4108054, 8494103, 8494104, 8494105,
+  8494086, 4083227, 8494108, 8494081, 4182786, 8494081, 4999426, 5433364, 4186630, 8494087, 5000966, 4174089,
+  4189706, 8494093, 5003274, 4191757, 8494102, 8494095, 4193808, 8494099, 4999184, 4199187, 8494100, 8494101,
+  4197142, 4203010, 8494102, 4155652, 8494106, 4208134, 8494089, 8494082, 5400326, 4210698, 4146720, 4108300,
+  8494093, 8494123, 8494097, 4202768, 4212497, 4104466, 8494101, 4111636, 4215573, 4162838, 8494122, 8494106,
+  8494099, 8494106, 5391618, 8494085, 8494106, 8494089, 5395462, 8494112, 8494081, 4223746, 8494083, 8494084,
+  8494085, 4230150, 8494087, 8494088, 4179465, 4236298, 8494091, 8494092, 8494093, 8494094, 8494095, 4241680,
+  8494097, 8494098, 4247571, 4107284, 8494101, 4255766, 8494103, 4111896, 5079308, 4215066, 8494107, 5078799,
+  5076496, 8494099, 8494086, 4217888, 5080596, 5249801, 8494085, 8494086, 4852999, 8494084, 8494087, 8494086,
+  8494096, 4246570, 4216619, 4113666, 4168451, 4114436, 8494085, 4116998, 4119303, 4853268, 8494089, 4117514,
+  8494099, 8494092, 4125965, 4259854, 4266511, 8494108, 4123921, 8494082, 4250643, 4123156, 4135445, 4269574,
+  8494103, 8494090, 8494086, 4140554, 8494093, 4351236, 8494085, 5234192, 8494087, 8494096, 8494093, 8494082,
+  8494101, 8494092, 4312077, 8494102, 8494095, 8494104, 8494089, 8494090, 5334530, 4308244, 8494101, 8494083,
+  8494084, 8494112, 8494097, 8494099, 8494088, 4138505, 8494101, 5337101, 8494086, 4137229, 8494094, 4143887,
+  8494123, 8494097, 8494098, 4142867, 5334806, 8494101, 4147222, 8494081, 4141570, 4275715, 4157188, 4280837,
+  4145414, 4269063, 4283144, 4152073, 4283658, 8494089, 4287500, 4290573, 4249102, 4295951, 4154384, 4299025,
+  8494082, 4303891, 4309524, 4311061, 4315926, 4159511, 5437954, 4162585, 8494100, 8494107, 8494081, 4322050,
+  4183811, 4199940, 4175109, 4207366, 4188423, 4183560, 4317961, 4326410, 8494102, 4186380, 4333325, 4338702,
+  4344335, 4185616, 4261905, 8494089, 4355091, 4307732, 4259605, 4327446, 4192023, 4221208, 4346137, 8494081,
+  4359426, 8494083, 8494100, 8494082, 4363782, 8494087, 5439241, 5201922, 4368138, 8494084, 8494092, 8494093,
+  4185102, 8494095, 4371472, 8494097, 5435142, 8494099, 8494100, 8494101, 4277782, 8494103, 5203217, 8494093,
+  8494106, 5485830, 5200661, 8494106, 5482246, 8494099, 4192288, 8494083, 4338434, 8494083, 4195076, 4231685,
+  4376838, 4232711, 4269832, 8494089, 8494122, 8494123, 4347404, 4379405, 4349710, 4384015, 4238096, 4197905,
+  4198674, 4289299, 4387348, 4392725, 4205846, 4369431, 8494086, 5300743, 8494088, 4220443, 8494081, 4233474,
+  4393987, 4253188, 4242693, 8494095, 4220679, 8494088, 4222985, 4246026, 8494091, 8494092, 4239373, 4395534,
+  4399375, 8494096, 4399889, 8494081, 4405267, 4407316, 4373013, 4264982, 8494086, 8494104, 8494081, 4411906,
+  8494107, 4225308, 5488906, 4417542, 8494082, 5496838, 8494089, 4423946, 4364294, 8494081, 4939266, 5435669,
+  8494090, 4428560, 4936198, 4480269, 8494094, 8494094, 4937994, 4433942, 8494085, 4540179, 8494100, 8494106,
+  8494102, 5511170, 8494104, 8494085, 4943892, 4437536, 5318159, 8494104, 8494115, 8494081, 4444674, 8494100,
+  4271364, 5319183, 4449286, 4439850, 4402219, 5315859, 4316938, 8494101, 4272652, 8494123, 8494081, 5156866,
+  4453136, 4456721, 5159941, 8494086, 8494100, 4458005, 4279062, 4464386, 4238616, 8494092, 8494106, 4467206,
+  8494089, 8494081, 4281353, 4306442, 4311840, 8494100, 4242445, 8494084, 8494085, 4250128, 8494087, 5511433,
+  4258579, 4403220, 8494122, 4247830, 8494093, 8494090, 4651279, 8494099, 8494107, 5430805, 4662291, 4666132,
+  4654613, 4256800, 8494099, 4261378, 4262659, 4267524, 4281605, 4275462, 4288519, 4287240, 4285961, 4289802,
+  8494123, 4288780, 4292621, 4472334, 4478479, 8494112, 4295185, 8494087, 4483603, 4435732, 4301077, 8494083,
+  8494084, 8494085, 8494085, 8494087, 4322312, 8494089, 5525011, 8494081, 8494088, 4332813, 4303630, 4329999,
+  8494095, 8494097, 8494098, 4381715, 8494100, 4335381, 4337942, 5337613, 5432340, 8494105, 8494083, 8494084,
+  4314885, 8494099, 5409538, 8494088, 8494112, 8494093, 5417990, 8494095, 4497933, 8494094, 4397327, 8494099,
+  8494100, 5524486, 4441363, 4365588, 4421653, 8494102, 4332548, 8494085, 4337158, 8494106, 8494088, 8494089,
+  8494099, 8494094, 8494092, 4491789, 4339982, 4513551, 8494100, 8494097, 8494082, 4518163, 8494082, 4426005,
+  4524546, 8494103, 5104646, 8494105, 4492038, 4425735, 8494090, 8494123, 4389898, 8494093, 8494096, 8494093,
+  5109762, 5388051, 4366352, 5109523, 5105926, 8494099, 4403732, 4474389, 4341782, 4529666, 5110796, 5108749,
+  8494085, 4531718, 8494086, 4488200, 4341513, 4436746, 4416544, 5109013, 4514317, 5080070, 8494095, 4535056,
+  8494082, 5082122, 4532243, 4431124, 4376582, 4466454, 5320966, 8494096, 8494090, 5526287, 8494100, 4381453,
+  8494101, 8494095, 4380176, 8494104, 5321232, 8494099, 8494084, 4540437, 4382486, 8494086, 8494102, 4741129,
+  5489929, 8494122, 8494123, 8494089, 8494094, 8494095, 4389152, 8494097, 5529609, 8494099, 4456194, 4388611,
+  4740630, 4496133, 4534278, 8494087, 8494122, 8494123, 4413450, 8494123, 4427532, 4545805, 4394766, 4394511,
+  4522256, 4399121, 8494084, 8494081, 4467988, 4528149, 4872707, 4398615, 4873221, 4869382, 8494087, 4398363,
+  5522954, 8494090, 4548354, 8494101, 4401440, 8494085, 4551686, 8494087, 8494088, 5523219, 4442378, 4868628,
+  8494092, 8494093, 4408334, 8494123, 4405776, 4424465, 4874267, 8494099, 4554516, 8494101, 4447766, 8494083,
+  8494081, 4557058, 5341186, 8494107, 4562437, 4567814, 4448519, 4571656, 4413216, 4574218, 8494090, 4576524,
+  4409869, 5344525, 4465423, 4485136, 8494082, 8494102, 8494099, 4581908, 4582677, 4432150, 4429335, 4470040,
+  8494082, 8494106, 4474651, 8494085, 4444422, 4540935, 8494088, 4429088, 8494090, 5533190, 8494082, 4446477,
+  8494099, 8494085, 8494086, 4439057, 8494088, 4454931, 4918538, 4585493, 8494081, 4588290, 4455683, 4454660,
+  4480773, 4592390, 4545287, 4594952, 4920596, 4597514, 5528853, 4452108, 8494093, 4493326, 4461839, 4462096,
+  8494097, 5527309, 4471315, 4554260, 4599061, 4474902, 5296898, 5526547, 8494081, 8494082, 4600347, 8494087,
+  5532425, 8494086, 4604162, 4544288, 4475652, 8494090, 4609286, 5445634, 8494096, 8494099, 4577290, 8494086,
+  4478220, 8494122, 8494123, 8494100, 4606480, 4612369, 8494090, 4480531, 4591380, 4614677, 4481302, 8494088,
+  8494112, 5438740, 8494105, 8494092, 4610061, 4640782, 4608271, 4614914, 4486432, 8494084, 4672787, 4619526,
+  4490247, 8494102, 4622601, 4501258, 8494105, 8494081, 4491533, 8494123, 5552916, 4622864, 5546246, 8494084,
+  4513043, 4627988, 4515861, 4500758, 8494096, 5297674, 8494083, 8494097, 4553755, 8494086, 8494087, 4989192,
+  8494097, 4501536, 8494081, 8494100, 4506627, 8494084, 4989455, 8494093, 8494087, 4513800, 4989715, 4493098,
+  8494123, 5468162, 4525581, 8494082, 4523791, 5468678, 5209861, 8494086, 4512787, 4516116, 4628245, 8494102,
+  4566274, 8494083, 5366534, 8494085, 8494101, 4526855, 8494088, 8494089, 4601354, 8494102, 8494101, 4631053,
+  4565262, 4633871, 4520976, 5369363, 8494100, 4636435, 4601620, 4527637, 8494086, 8494103, 8494104, 8494105,
+  4547586, 5330434, 8494084, 4552965, 4637446, 5332486, 8494088, 5212174, 8494090, 8494096, 5212689, 4584205,
+  4530190, 4593935, 8494101, 5328912, 5289478, 8494123, 4642324, 5331220, 8494090, 8494103, 8494082, 4537603,
+  4587780, 4529947, 8494096, 4541959, 4617480, 4541705, 8494112, 8494112, 5558790, 4647949, 5489154, 4650511,
+  8494106, 8494097, 8494086, 4570899, 4653076, 8494082, 4655107, 4543748, 8494094, 4548102, 4556039, 4655624,
+  4542217, 4660234, 8494081, 4942082, 4607245, 8494084, 4663823, 8494086, 4944135, 8494088, 4666899, 4625940,
+  4578581, 4598020, 8494085, 4639238, 8494095, 8494106, 5545492, 5551381, 4946707, 4944404, 4556301, 4559886,
+  4669711, 8494093, 8494084, 8494095, 4563731, 4668180, 4609045, 5246227, 8494100, 8494081, 8494100, 8494083,
+  8494107, 8494085, 8494086, 4604935, 8494088, 5434131, 5439764, 8494081, 5026050, 4607757, 8494094, 4669967,
+  5027590, 4613124, 4675077, 4614150, 8494100, 8494088, 8494099, 8494083, 8494081, 8494082, 4652301, 8494094,
+  4626959, 5300230, 5025300, 8494101, 8494084, 4679444, 4620053, 4861186, 4631319, 4633602, 4633347, 8494096,
+  8494100, 4678150, 4632071, 4860170, 8494089, 4640010, 4860941, 4863246, 4862223, 8494096, 8494107, 4639504,
+  4864019, 4862740, 4649235, 8494100, 8494083, 4658966, 8494083, 4647684, 8494100, 5390082, 8494089, 8494088,
+  8494089, 5387782, 8494085, 4642080, 4651021, 8494094, 4679183, 8494106, 5493011, 4685314, 4651539, 8494100,
+  8494101, 8494086, 8494087, 8494081, 5309698, 4686602, 8494107, 5391896, 8494093, 8494106, 5514502, 8494096,
+  8494095, 5047554, 5516042, 8494100, 8494101, 4664342, 4672514, 8494097, 8494084, 5048074, 4674822, 5311765,
+  5051149, 8494089, 8494099, 5047056, 8494101, 8494093, 4680974, 5053972, 5047317, 4686097, 8494081, 5473282,
+  5584646, 4689685, 4684566, 5475078, 4688131, 8494084, 8494085, 8494107, 8494087, 4688648, 4690953, 8494087,
+  8494088, 4689932, 4690701, 8494094, 4697103, 8494082, 4692241, 8494098, 4695827, 4694292, 4694037, 4699670,
+  8494081, 8494085, 4699139, 4698628, 5590790, 4697350, 4700935, 4702728, 4702217, 4703498, 8494094, 5509903,
+  4706573, 4703246, 4712207, 4699408, 8494102, 5510677, 4716307, 4721172, 4706069, 4718614, 8494102, 4704770,
+  8494105, 4708100, 4709637, 4710150, 8494081, 5010690, 8494090, 8494087, 8494092, 5009926, 4721421, 4707598,
+  4726031, 8494096, 8494083, 5512207, 4711443, 4719892, 4730133, 5511699, 8494103, 4711938, 8494083, 5011732,
+  5593108, 5007126, 8494087, 4720904, 8494089, 8494106, 5518355, 5519380, 4716557, 5319942, 4727567, 8494096,
+  4718865, 8494090, 4724243, 4716820, 8494093, 8494102, 8494082, 8494083, 4731652, 4732677, 4733190, 8494087,
+  4735240, 4732169, 8494090, 5588998, 8494092, 8494093, 4739598, 4744463, 8494096, 4735761, 4749570, 4744979,
+  4737300, 4737045, 4752902, 5590026, 5385474, 8494085, 4752138, 8494107, 5387014, 8494083, 8494084, 5388297,
+  8494096, 8494087, 8494088, 8494095, 8494090, 8494081, 4733974, 4758029, 4742414, 4758287, 5371654, 8494097,
+  8494083, 4759827, 4753940, 5593864, 4734496, 8494082, 8494094, 8494105, 8494085, 4763142, 5273101, 5270542,
+  5275151, 8494101, 4737578, 8494123, 8494093, 5272596, 8494095, 5272086, 8494082, 5592595, 4763923, 4761876,
+  4764934, 8494081, 5149442, 5594133, 4764682, 8494106, 8494086, 4768525, 8494094, 4768783, 8494090, 8494112,
+  5594388, 4768019, 8494100, 8494101, 8494102, 8494082, 8494104, 8494082, 4769539, 4769030, 8494102, 8494082,
+  8494107, 4772618, 8494086, 5516294, 8494093, 4766732, 4772109, 4770832, 4773137, 5536013, 8494097, 8494100,
+  4772885, 4772372, 4771605, 8494102, 8494081, 8494088, 5207554, 8494083, 4773637, 4771846, 4770055, 4774664,
+  5198338, 8494090, 8494100, 4775692, 8494086, 8494093, 4774415, 8494089, 5193994, 8494097, 5591302, 4777748,
+  4774933, 5211413, 5196304, 8494099, 8494100, 8494101, 8494107, 4778498, 4777987, 8494084, 4779525, 4779782,
+  4776967, 4781064, 8494081, 4779018, 8494082, 4782348, 4816388, 4783630, 4816646, 4784656, 8494122, 8494123,
+  4782867, 4784148, 4785429, 8494093, 5591565, 8494096, 8494093, 8494097, 4785691, 8494100, 4818452, 4819221,
+  8494102, 8494112, 5489414, 4794115, 8494084, 4786437, 4792326, 8494087, 4794376, 8494093, 8494083, 8494122,
+  8494123, 8494093, 4797454, 4797199, 5487636, 5562628, 8494085, 4788499, 4799252, 4798485, 5252367, 8494081,
+  8494081, 8494082, 5255443, 5253396, 8494108, 4805382, 4806919, 5165317, 5165574, 4804874, 5164040, 4807948,
+  4809229, 8494094, 4807695, 8494096, 8494099, 5167631, 8494096, 4809492, 4804629, 8494102, 5167380, 5163285,
+  5476614, 8494095, 4805659, 8494082, 4810243, 8494084, 4809733, 4813318, 4811783, 4812040, 5475856, 4808714,
+  5560582, 4812300, 8494087, 8494088, 4811023, 8494096, 4814609, 8494093, 8494082, 4815892, 4816149, 4814102,
+  4823814, 4819463, 8494112, 5535764, 8494090, 8494086, 8494087, 8494093, 4917769, 4911370, 8494096, 8494086,
+  8494093, 8494123, 4915983, 4821013, 4820758, 8494082, 4919059, 4914452, 5533450, 4826630, 8494097, 5304326,
+  8494094, 8494090, 8494112, 5302282, 4829197, 4818958, 4828431, 8494096, 8494082, 8494096, 4828691, 4826900,
+  4826133, 8494102, 8494082, 8494104, 5004806, 5005063, 4835334, 4836871, 4830984, 8494101, 8494096, 5003789,
+  4839180, 8494112, 8494096, 8494086, 4837392, 8494099, 8494104, 8494099, 4840980, 4841493, 4851714, 8494122,
+  5537039, 4851973, 4848390, 4840731, 4850440, 8494100, 4848906, 8494082, 8494092, 8494082, 8494083, 4853775,
+  8494085, 4931590, 8494087, 8494088, 4852244, 8494081, 8494092, 8494092, 8494084, 5146370, 8494086, 8494107,
+  5148165, 5147910, 4934154, 8494102, 8494101, 4933389, 4934914, 4930319, 5146125, 5605638, 4935942, 4935187,
+  4934676, 8494101, 4935434, 8494085, 8494104, 8494102, 8494088, 8494081, 8494096, 8494089, 8494082, 4997645,
+  8494092, 8494095, 8494102, 8494097, 8494095, 8494097, 4937730, 8494083, 5555475, 8494101, 4941318, 8494087,
+  8494112, 8494107, 4931082, 8494093, 8494082, 8494093, 8494094, 8494095, 4942864, 8494087, 8494122, 8494099,
+  4943380, 4946453, 4936982, 8494103, 8494104, 5421318, 8494106, 8494097, 5528070, 5421578, 8494100, 8494081,
+  8494090, 8494083, 8494084, 8494085, 8494082, 8494101, 8494088, 5418772, 4951302, 8494099, 8494122, 8494123,
+  4944654, 8494095, 8494081, 8494097, 8494081, 8494099, 8494096, 8494101, 4896790, 4953619, 4949012, 8494081,
+  4950550, 8494083, 5627919, 8494085, 8494095, 8494094, 4967682, 8494083, 8494097, 8494100, 4965638, 8494093,
+  8494094, 5628941, 4966154, 8494106, 8494082, 8494099, 8494094, 4965141, 8494122, 8494087, 8494088, 4966931,
+  4967188, 8494107, 8494089, 8494093, 8494104, 8494081, 8494093, 4967939, 8494095, 8494099, 8494100, 8494087,
+  4969224, 5604102, 8494090, 8494082, 4963852, 8494084, 8494094, 4971791, 8494093, 4967441, 8494122, 4973075,
+  4971028, 4973845, 4972822, 4969730, 5195535, 8494086, 5193489, 4970502, 5191955, 5192468, 8494081, 4974082,
+  4976131, 8494084, 8494093, 5455376, 8494087, 4973328, 8494099, 4978186, 4970259, 8494100, 8494093, 4978958,
+  4980239, 8494081, 4975633, 8494083, 4982803, 4978708, 8494094, 8494102, 4993794, 4971552, 4977433, 5588499,
+  4993542, 8494093, 8494101, 4996111, 4994058, 8494094, 5455915, 5001235, 4999700, 8494101, 4994320, 8494100,
+  8494101, 4998419, 4992788, 8494083, 8494102, 8494086, 8494083, 5196551, 8494094, 8494089, 8494087, 8494088,
+  8494084, 5198093, 8494112, 8494092, 5025538, 4998670, 5027844, 5197843, 8494100, 8494107, 8494099, 8494100,
+  8494122, 8494082, 5025804, 5003524, 8494082, 8494086, 5396740, 5030673, 8494089, 8494081, 5000450, 5027093,
+  5395722, 5625609, 5004038, 8494096, 8494097, 8494107, 5002506, 5395985, 8494102, 8494102, 8494112, 8494101,
+  5000720, 5473538, 8494097, 5006867, 8494099, 5472774, 8494102, 8494085, 8494081, 8494090, 8494083, 8494084,
+  5005573, 5628181, 5089794, 8494088, 8494112, 5584399, 5095942, 8494092, 5007629, 5009422, 5009679, 5578254,
+  8494095, 8494093, 8494122, 8494100, 5010453, 5009174, 8494081, 8494099, 5519106, 8494084, 8494102, 8494086,
+  8494086, 8494081, 5012226, 5016330, 8494090, 8494092, 8494086, 5010958, 8494095, 8494093, 8494090, 8494091,
+  5016851, 5013005, 5011989, 8494092, 5008400, 8494094, 5550863, 5016595, 8494100, 8494082, 8494102, 5180676,
+  5362178, 8494081, 5017090, 5629446, 5362950, 5178122, 5020934, 8494082, 8494112, 8494089, 5015306, 5437702,
+  8494097, 5018381, 5364752, 8494095, 5632006, 5179414, 8494093, 5019667, 5017364, 8494101, 8494085, 5019142,
+  8494099, 8494088, 5631238, 8494097, 8494093, 5017868, 8494112, 8494094, 5021455, 5015824, 8494081, 5023746,
+  8494101, 5018900, 8494081, 5022214, 8494083, 5553922, 8494085, 8494090, 8494087, 8494088, 5014797, 8494090,
+  5020175, 5022992, 5029389, 5025038, 5024531, 5024788, 8494101, 8494096, 8494099, 8494100, 8494081, 5027330,
+  5080834, 5207810, 8494100, 5029126, 8494086, 5207302, 5031945, 5031434, 5077514, 8494090, 5637398, 8494112,
+  8494088, 5029648, 5083152, 8494096, 5031187, 8494083, 5211155, 8494085, 5032454, 8494104, 8494088, 8494089,
+  5032970, 5641230, 8494092, 8494110, 8494094, 8494112, 8494112, 8494112, 8494086, 8494099, 8494100, 8494101,
+  8494090, 8494103, 5032728, 8494093, 8494106, 8494123, 8494096, 5431814, 5474562, 8494099, 8494112, 8494081,
+  5474310, 5036547, 5435405, 5033221, 5639181, 5433616, 5034504, 8494081, 5036802, 5030187, 5471248, 5036045,
+  5041158, 5035791, 5640467, 5034769, 8494090, 8494099, 5034004, 8494093, 8494102, 5432096, 8494096, 8494082,
+  8494083, 5038099, 5037332, 8494101, 8494102, 5040130, 8494083, 8494082, 8494095, 8494086, 5038855, 5296134,
+  5039113, 5043210, 8494097, 5295370, 5043725, 8494094, 5045519, 8494089, 8494082, 8494096, 5046803, 8494085,
+  5044742, 8494102, 5296405, 8494102, 5076994, 8494112, 5655306, 8494082, 5078534, 5048591, 8494096, 8494086,
+  5076234, 8494099, 5041940, 8494093, 8494102, 5054212, 8494085, 5555982, 5056263, 8494099, 8494083, 8494082,
+  8494102, 5508354, 8494093, 8494094, 8494095, 5513222, 8494097, 8494092, 8494099, 8494100, 5055234, 8494083,
+  5055490, 8494096, 5057542, 5509392, 8494086, 5058825, 8494090, 5612563, 8494090, 8494082, 8494102, 5081604,
+  8494096, 8494086, 8494082, 5058323, 5056020, 8494090, 5059606, 5060117, 8494102, 8494089, 8494104, 8494096,
+  8494097, 8494083, 8494082, 8494082, 5079573, 8494087, 8494112, 8494087, 8494088, 5531413, 8494106, 8494093,
+  8494094, 8494093, 8494094, 8494097, 8494122, 8494099, 5519618, 5057299, 8494100, 8494101, 5061398, 8494083,
+  8494084, 8494107, 5521418, 8494087, 5067522, 5657866, 5062410, 8494102, 5066246, 8494097, 5061646, 5064975,
+  8494090, 5524245, 5064716, 5062931, 8494100, 8494101, 8494096, 5065745, 5067266, 8494105, 5656578, 5069589,
+  5068550, 8494084, 8494083, 8494089, 5072394, 8494086, 8494087, 5522178, 8494089, 8494094, 5069840, 5521926,
+  8494087, 5072659, 5073923, 5149200, 5070102, 5603348, 8494087, 8494088, 8494101, 8494096, 8494103, 5065996,
+  8494093, 8494094, 8494112, 5384966, 5074193, 8494084, 8494085, 5075220, 5071125, 5076758, 8494083, 8494084,
+  8494105, 8494082, 5385745, 5660459, 8494095, 5075722, 5387541, 5386006, 5074957, 5075982, 5077775, 8494102,
+  8494097, 8494085, 5078035, 5074452, 8494101, 8494102, 5086210, 8494104, 8494105, 8494102, 5088006, 5252879,
+  5662474, 5079817, 5088770, 5248275, 5253140, 5251605, 5093894, 8494087, 8494096, 8494082, 5089290, 5081363,
+  8494100, 5084173, 8494102, 8494095, 8494096, 8494099, 5091586, 8494084, 5091348, 5093397, 5093638, 8494082,
+  8494112, 5297158, 5096714, 5097222, 8494089, 8494082, 8494095, 5096202, 5092368, 8494097, 5638407, 5670678,
+  8494100, 8494096, 5095190, 8494100, 8494101, 8494102, 8494088, 8494102, 8494100, 8494089, 5690118, 5098754,
+  8494107, 5099268, 8494085, 5101574, 8494087, 8494088, 8494093, 5098250, 5525263, 5640725, 8494093, 8494081,
+  5528339, 5097488, 5098001, 8494082, 8494099, 5102612, 5103125, 8494086, 8494081, 8494104, 8494083, 8494086,
+  8494107, 5101830, 8494085, 8494088, 8494095, 8494095, 8494089, 5661454, 8494099, 8494084, 8494093, 8494096,
+  8494087, 5690387, 5094163, 8494100, 8494123, 8494100, 8494082, 8494094, 5168655, 5112069, 8494086, 8494087,
+  5108488, 5164820, 5168917, 5100320, 5112844, 8494093, 8494085, 5113359, 8494096, 8494082, 8494092, 5113858,
+  8494100, 8494101, 5112581, 5114886, 8494104, 8494099, 8494100, 8494107, 8494093, 8494081, 8494101, 8494083,
+  8494095, 8494096, 5113094, 5116167, 8494088, 5114644, 5689107, 5671957, 8494092, 8494083, 8494084, 8494085,
+  5110299, 8494107, 8494083, 8494099, 5116948, 5120518, 8494087, 5122568, 5554178, 5152527, 8494102, 8494092,
+  5124109, 5124366, 5123855, 5151509, 5153814, 5125378, 8494104, 5125652, 5121301, 5124614, 8494087, 8494097,
+  5694214, 5126410, 5130754, 5556245, 5127693, 8494082, 5129222, 5125136, 8494088, 5338630, 5126922, 5122068,
+  8494101, 5125910, 8494088, 8494095, 5688842, 8494097, 8494095, 8494096, 5128212, 5135637, 5128470, 8494100,
+  8494081, 5698325, 5712653, 8494107, 8494081, 8494086, 8494083, 5134594, 8494083, 5129002, 8494085, 5138438,
+  8494087, 5139720, 5132297, 5129482, 5172237, 5130508, 5172495, 8494100, 5133327, 5215750, 5171987, 8494100,
+  8494101, 5137428, 5141525, 8494102, 8494093, 8494094, 5140482, 5216272, 5135131, 8494100, 5134086, 5213972,
+  5218581, 5323533, 5140234, 5325071, 8494081, 5141005, 5713158, 5323283, 5322004, 5142033, 8494102, 8494122,
+  5144084, 5145877, 8494082, 8494083, 8494084, 8494094, 5563151, 5142299, 8494088, 8494089, 5154058, 8494101,
+  5152772, 8494093, 5154310, 5151759, 8494088, 8494100, 8494093, 8494094, 5153044, 8494101, 8494102, 5153551,
+  8494099, 8494100, 8494081, 5157890, 5156372, 5155605, 5161477, 5159686, 8494081, 8494084, 8494082, 5161226,
+  8494085, 5180936, 8494086, 8494090, 8494089, 8494086, 8494089, 8494092, 8494095, 8494100, 5162005, 5161750,
+  8494086, 5181204, 5177621, 5159188, 5164565, 5529109, 8494102, 8494081, 8494101, 8494112, 5162756, 8494085,
+  5672969, 8494087, 8494088, 5668364, 5163530, 5637636, 8494092, 5163021, 8494094, 5162255, 8494096, 8494097,
+  5174530, 8494099, 5549314, 5162517, 5168134, 8494086, 8494086, 8494089, 5174794, 8494100, 8494091, 5715207,
+  8494093, 8494104, 5176080, 5182723, 5183236, 5179667, 8494082, 8494087, 8494088, 5552149, 5256454, 8494096,
+  8494092, 5182221, 5253898, 5186319, 8494096, 8494093, 5169440, 5188627, 5184020, 5185301, 5185046, 8494099,
+  5590532, 8494095, 5592838, 8494097, 8494122, 5172779, 5185539, 5184516, 5186053, 8494093, 5190663, 5533954,
+  8494089, 5187594, 5539845, 5538822, 5189901, 5189134, 5190927, 8494087, 8494099, 8494089, 5192211, 5189396,
+  5191445, 8494096, 8494094, 5200399, 8494105, 5537556, 5536533, 5197587, 8494081, 5198869, 8494083, 8494084,
+  8494085, 5663503, 5719054, 8494088, 8494082, 8494112, 8494100, 5308418, 8494093, 8494094, 8494095, 5712141,
+  8494097, 8494095, 8494099, 5201671, 8494101, 8494089, 8494090, 8494097, 5310991, 8494096, 5200142, 5202703,
+  5312275, 5307668, 5690633, 5204499, 5202196, 5690892, 8494100, 8494081, 5347074, 8494105, 8494081, 5210882,
+  8494083, 5212420, 5214469, 5210630, 8494087, 8494088, 8494089, 8494102, 8494087, 5213196, 5340944, 5345041,
+  5214735, 8494096, 5348372, 8494094, 5345814, 8494100, 5289731, 5289988, 8494085, 8494104, 8494101, 8494088,
+  5215259, 8494082, 8494083, 8494084, 5215493, 5213702, 8494095, 8494088, 8494087, 8494093, 8494087, 8494100,
+  8494093, 5218062, 8494097, 8494096, 8494105, 8494094, 8494101, 8494100, 5216533, 8494102, 8494099, 5388564,
+  5387285, 8494083, 8494107, 8494085, 5216006, 8494087, 8494088, 8494082, 5372930, 8494093, 8494092, 8494085,
+  5376262, 5217039, 8494088, 8494084, 5221893, 8494086, 8494100, 8494088, 8494094, 5379087, 8494097, 5737485,
+  8494093, 5222414, 5223439, 5378069, 5224450, 8494083, 8494086, 5222932, 5226758, 5224711, 5558026, 5738000,
+  5222154, 5223938, 8494083, 5225485, 5556752, 5225222, 5226000, 8494100, 8494099, 5227018, 5229844, 8494101,
+  5303812, 5584130, 8494086, 5225744, 8494097, 5584902, 5302538, 8494081, 5228290, 5586442, 5224224, 8494085,
+  5230854, 5306129, 5231112, 8494096, 8494090, 5306389, 5229068, 8494089, 8494086, 5585942, 5227792, 5711625,
+  5495310, 5499663, 5233940, 5234965, 8494102, 8494099, 8494081, 5235714, 5234691, 5231899, 5236997, 5239558,
+  5235207, 8494089, 4885257, 5234442, 8494095, 5238028, 5512452, 8494094, 8494099, 5237264, 8494101, 8494089,
+  8494099, 5233684, 5240853, 5240342, 5326596, 8494081, 5241346, 5513489, 5242651, 8494089, 5243910, 5513749,
+  5511958, 5324301, 5239306, 5328655, 8494099, 5744646, 8494082, 5327379, 5240592, 5244433, 5325846, 8494122,
+  5238804, 5246485, 5242902, 8494082, 8494104, 5603853, 8494085, 8494082, 5603088, 8494088, 8494082, 8494102,
+  5244960, 8494085, 8494086, 8494087, 8494088, 8494089, 5250314, 8494091, 5737734, 8494096, 5254673, 8494086,
+  8494099, 8494085, 5256725, 8494093, 8494100, 8494101, 8494082, 8494103, 8494107, 5328391, 5255942, 8494123,
+  5327626, 5256969, 5254922, 5329933, 5646868, 5327887, 8494102, 8494097, 5258512, 5330195, 5329172, 8494099,
+  8494100, 8494082, 8494102, 8494084, 8494085, 8494081, 5261831, 8494088, 5713679, 8494090, 8494086, 8494093,
+  5714707, 5738767, 8494095, 8494081, 8494092, 8494083, 8494094, 8494085, 5261333, 5744134, 8494100, 5260297,
+  8494100, 5266453, 8494092, 8494093, 5259790, 5263375, 8494083, 5763842, 8494081, 5264642, 5260052, 5262596,
+  5267478, 8494085, 8494087, 8494088, 5266697, 5269258, 8494091, 8494092, 5265165, 8494094, 8494095, 5561103,
+  8494097, 8494097, 8494099, 5271316, 5561620, 5558549, 5559830, 8494104, 8494083, 5766658, 8494107, 8494081,
+  8494082, 8494083, 8494084, 8494085, 5268486, 5267719, 8494093, 8494094, 5337871, 5772303, 8494092, 8494093,
+  8494084, 5272335, 8494101, 8494097, 5562376, 8494090, 5272852, 5263125, 8494083, 8494084, 8494085, 8494090,
+  8494099, 8494088, 5270025, 8494090, 5560852, 5560085, 5270797, 8494095, 8494081, 8494082, 8494083, 8494099,
+  8494085, 5271828, 8494101, 8494102, 8494103, 8494104, 8494083, 5594886, 8494082, 8494086, 8494087, 5596170,
+  5276937, 5277450, 8494093, 8494100, 8494101, 5277966, 5278223, 8494104, 8494099, 5284098, 5280019, 5278978,
+  5278485, 5286918, 8494103, 5283590, 8494105, 5283338, 8494089, 8494090, 8494097, 8494100, 5799696, 5285392,
+  8494101, 5281040, 5287443, 8494087, 5283091, 5282582, 8494107, 8494102, 8494092, 8494083, 5728014, 8494085,
+  8494086, 8494087, 8494088, 5274656, 8494093, 8494112, 8494092, 8494093, 8494082, 5795853, 8494083, 8494097,
+  8494086, 8494099, 5293332, 5575433, 5293573, 8494103, 8494087, 5291016, 5389581, 8494090, 5391119, 5293068,
+  5388817, 8494099, 5290498, 5389076, 5294596, 5389334, 8494099, 5292308, 8494101, 8494081, 5316354, 8494104,
+  8494092, 8494093, 8494107, 8494095, 8494086, 8494089, 8494090, 5789446, 5294868, 8494101, 8494082, 8494093,
+  8494084, 8494085, 5298182, 8494099, 8494088, 8494096, 8494102, 5667349, 8494102, 5301773, 5303554, 5297935,
+  5799443, 5803782, 5305606, 5303059, 5298708, 5299221, 8494090, 8494082, 8494104, 8494093, 8494094, 8494095,
+  5309456, 5762057, 8494089, 5295891, 5309972, 5309205, 8494102, 8494094, 8494104, 5310722, 8494088, 8494099,
+  8494099, 5312006, 8494082, 5384707, 8494112, 8494090, 5314306, 8494087, 8494084, 8494086, 5314566, 8494096,
+  8494097, 8494093, 8494122, 5383951, 5310229, 8494102, 5613058, 5386259, 8494096, 8494101, 8494086, 8494103,
+  8494100, 5313282, 5314819, 8494087, 8494085, 5316102, 8494083, 8494107, 8494093, 8494097, 8494087, 8494092,
+  8494112, 8494107, 8494102, 8494096, 5319437, 5319694, 5320463, 5315092, 8494101, 5315350, 5320723, 5324802,
+  5804804, 5320214, 8494107, 5323782, 8494084, 8494086, 8494087, 5324042, 8494082, 8494092, 5806602, 8494086,
+  5335814, 8494096, 5326865, 5638928, 5330954, 5315626, 5325333, 5573890, 8494101, 8494082, 5336848, 8494081,
+  5338370, 5521158, 8494089, 8494088, 5341446, 5520138, 8494093, 5523468, 8494090, 5573136, 8494101, 5339917,
+  5576723, 8494095, 8494112, 5575190, 8494089, 5344019, 8494100, 8494101, 8494102, 8494081, 5343234, 8494083,
+  8494122, 8494085, 5344774, 8494087, 8494082, 5775894, 8494112, 8494092, 5715462, 5715719, 8494094, 5350146,
+  5339664, 5672454, 5340421, 5348614, 5349127, 5351432, 5341705, 5350666, 5671437, 5350412, 8494093, 8494096,
+  5352207, 8494096, 8494099, 8494093, 5351955, 5356052, 5354261, 8494102, 8494081, 5351682, 8494100, 5355012,
+  8494102, 5352710, 8494122, 5808399, 5353737, 8494112, 5359362, 5352460, 8494086, 5809417, 5355782, 5525769,
+  5356561, 8494089, 5357834, 5357332, 5355285, 5356310, 8494096, 5355544, 5357072, 8494089, 5526036, 5359891,
+  5361684, 8494101, 5360918, 5635599, 5363203, 5363716, 5365509, 8494107, 8494087, 5635861, 8494093, 8494090,
+  5358624, 8494092, 8494083, 5365774, 5369103, 8494096, 8494097, 5766151, 5368339, 5366804, 8494101, 5367318,
+  8494081, 5362434, 8494095, 5369860, 8494087, 8494097, 8494099, 5767187, 5371401, 5371914, 8494096, 8494092,
+  8494093, 5374478, 5375247, 8494095, 8494097, 5374210, 5379603, 5368596, 5376789, 5383430, 5372183, 8494084,
+  5373721, 5380362, 8494083, 8494087, 8494089, 8494089, 8494087, 5379344, 8494093, 8494081, 8494094, 5380628,
+  5392397, 8494097, 5392143, 5815565, 8494100, 5481237, 5392659, 5389844, 5393941, 8494085, 5394182, 5381664,
+  8494088, 5811473, 8494092, 8494093, 8494092, 8494095, 8494094, 5396495, 5689350, 8494122, 8494100, 8494099,
+  5394708, 5393429, 8494081, 8494093, 8494083, 5396996, 5397765, 8494100, 8494087, 8494099, 8494089, 8494095,
+  8494102, 8494092, 5400589, 8494094, 5403919, 8494082, 8494097, 5558276, 5402899, 5401364, 5403157, 5405718,
+  8494089, 5400066, 8494105, 8494088, 8494107, 5406214, 5807379, 8494096, 8494097, 5816598, 8494082, 8494081,
+  8494101, 5406467, 8494084, 5398032, 5791509, 5405447, 5397523, 5408532, 5411850, 5402646, 5406732, 5408269,
+  5407758, 5406991, 8494084, 8494097, 8494090, 5415955, 5413396, 5413653, 5410326, 8494103, 8494089, 8494105,
+  5420546, 5714447, 8494102, 5756174, 5409798, 5482498, 8494123, 8494101, 8494090, 5479686, 8494101, 5831695,
+  5479945, 8494095, 8494096, 8494097, 8494081, 5411091, 5415188, 8494084, 8494085, 5410054, 5480467, 5482004,
+  8494086, 5693453, 8494094, 5414668, 5416973, 5421838, 8494095, 8494096, 8494100, 8494101, 8494099, 5416468,
+  8494101, 5852422, 8494103, 8494081, 8494082, 8494082, 5423363, 8494084, 8494086, 8494122, 8494087, 5425666,
+  5805830, 5423108, 8494102, 5426182, 8494093, 5422862, 8494096, 5424650, 8494097, 8494122, 5425171, 5419796,
+  8494101, 8494099, 5423889, 8494104, 8494102, 5426946, 5429781, 5423638, 8494085, 5429254, 5424391, 5430024,
+  5426697, 5431562, 8494094, 8494095, 5432845, 5456642, 8494095, 5428496, 8494081, 5466374, 5430291, 5434388,
+  8494085, 5458186, 8494087, 5433112, 8494089, 8494088, 8494107, 5457680, 8494093, 8494084, 5462035, 5463828,
+  8494097, 8494081, 8494099, 8494100, 8494085, 5806868, 8494093, 8494088, 5572111, 8494122, 8494097, 8494092,
+  5436685, 8494100, 8494101, 8494096, 8494096, 5730564, 8494081, 5433876, 8494101, 5438212, 5441285, 8494095,
+  5441543, 8494088, 8494089, 5441802, 5816070, 5440780, 5443853, 8494097, 5445391, 8494100, 5446161, 8494102,
+  5446675, 5448724, 5447445, 5451542, 8494103, 8494104, 8494105, 5820949, 8494107, 8494108, 5441026, 8494083,
+  8494094, 8494099, 5451014, 5739529, 8494088, 8494081, 5741580, 5444867, 5452292, 5447685, 5818127, 5446919,
+  5443600, 8494089, 5454858, 8494100, 5443092, 5456397, 5456910, 5458959, 8494106, 5450257, 8494106, 5461523,
+  5451284, 5460501, 5450518, 5455639, 5459714, 8494083, 5464324, 5464581, 5466118, 5818370, 5865231, 5597958,
+  5867278, 5814278, 5467148, 8494081, 5470978, 5471759, 8494096, 5599502, 5469190, 8494096, 5467412, 5467925,
+  8494081, 8494103, 8494101, 5462797, 8494094, 8494102, 8494081, 8494082, 5475331, 5473043, 8494081, 8494101,
+  8494087, 8494088, 8494089, 8494093, 8494093, 8494092, 5469453, 5476110, 5476367, 8494096, 8494097, 8494093,
+  5477907, 5477140, 8494096, 8494102, 5829898, 8494104, 8494105, 5477378, 8494107, 5478660, 8494082, 5479174,
+  8494086, 8494099, 5517830, 8494090, 5670402, 8494092, 5518090, 5878281, 8494086, 5672711, 8494097, 5480711,
+  8494089, 5481737, 5480213, 5520915, 5512724, 5479448, 8494094, 5483535, 8494107, 8494097, 8494099, 5673237,
+  5483796, 5486083, 5485060, 8494085, 8494093, 8494087, 5825545, 8494107, 8494089, 8494092, 8494092, 5485325,
+  5484046, 5486351, 8494099, 5487121, 8494083, 5488659, 5484308, 5486869, 5486614, 8494103, 8494084, 8494105,
+  8494090, 5490178, 8494093, 5487369, 5488138, 8494086, 8494097, 8494093, 5657619, 5492239, 5894929, 5905922,
+  8494093, 5489683, 5490452, 5850899, 5492738, 8494101, 8494102, 8494105, 5493766, 8494102, 8494083, 8494089,
+  8494090, 8494106, 8494081, 5495810, 5570313, 8494084, 5490960, 5493254, 8494090, 5494291, 5575695, 8494085,
+  8494102, 8494092, 8494099, 8494086, 5576981, 5497104, 5494545, 5505034, 8494088, 5507596, 5498901, 5500930,
+  5508623, 8494096, 8494094, 5504518, 5508115, 8494100, 8494089, 5499914, 5714196, 8494112, 8494082, 5495566,
+  5497359, 5506576, 5497603, 8494084, 5507091, 8494089, 8494087, 5498646, 8494081, 5507330, 8494093, 8494106,
+  8494093, 5500174, 5507855, 8494083, 8494100, 5508874, 8494086, 8494082, 5501973, 8494086, 8494095, 5505552,
+  8494105, 5515010, 8494089, 8494090, 8494123, 5513990, 8494095, 5792019, 8494089, 5515530, 8494081, 8494082,
+  8494083, 8494082, 8494101, 8494112, 8494087, 8494086, 8494099, 8494081, 8494082, 5515798, 8494093, 5529356,
+  5530893, 8494084, 8494123, 5823750, 5525514, 5520660, 8494094, 5528596, 5530133, 8494104, 8494082, 5895699,
+  8494099, 8494099, 8494097, 8494083, 8494102, 8494103, 5527046, 8494087, 8494088, 5624834, 5553666, 8494081,
+  8494096, 8494093, 8494086, 8494095, 5805332, 8494090, 8494090, 8494099, 8494100, 8494081, 5530370, 8494083,
+  8494104, 5532933, 5627667, 8494100, 5530632, 8494102, 8494102, 5885958, 8494092, 8494093, 5899274, 8494095,
+  5548291, 8494097, 8494085, 8494099, 8494096, 5535235, 8494084, 8494089, 8494104, 8494092, 5885461, 8494107,
+  8494090, 5911567, 5534210, 8494123, 8494099, 8494100, 5537798, 8494102, 8494082, 5533715, 8494090, 8494101,
+  5665798, 8494081, 8494086, 8494089, 8494096, 8494107, 8494081, 5544962, 5543956, 5543445, 5547525, 5549062,
+  5540103, 5538568, 5671188, 5542666, 8494100, 8494101, 5544717, 8494085, 5547023, 8494095, 5550353, 8494099,
+  5552659, 5545236, 5541653, 8494083, 8494094, 5765135, 8494086, 8494087, 8494107, 5918722, 5550602, 5765909,
+  5553410, 8494112, 5552398, 8494095, 5554950, 5804294, 8494082, 5553171, 5555210, 8494086, 8494087, 8494122,
+  5555714, 8494095, 8494096, 8494085, 5554694, 8494099, 5638159, 8494100, 5556490, 8494102, 8494082, 5638676,
+  5559566, 5874709, 8494096, 8494087, 5557768, 5862658, 8494090, 8494107, 8494092, 8494081, 8494083, 8494083,
+  5893126, 5860618, 8494086, 5919750, 5560340, 8494101, 5559306, 8494095, 5559052, 8494097, 8494096, 8494099,
+  8494097, 8494101, 5562882, 8494099, 8494104, 5562117, 5563910, 8494082, 8494108, 8494105, 5563658, 8494088,
+  8494093, 5564170, 8494112, 5920777, 5564688, 5568782, 5566991, 8494082, 8494100, 5602565, 8494102, 5565460,
+  5568277, 8494102, 8494081, 8494102, 8494092, 5567748, 8494085, 8494095, 8494100, 8494096, 8494089, 8494099,
+  8494087, 8494100, 8494102, 8494094, 5569807, 8494092, 8494097, 8494087, 8494095, 8494081, 8494101, 5571094,
+  8494084, 8494085, 8494101, 8494087, 8494088, 8494093, 5572618, 5573391, 8494092, 8494101, 8494086, 8494099,
+  8494100, 8494097, 5570070, 5922058, 5566228, 5745158, 8494102, 5569540, 8494085, 8494086, 5576194, 8494088,
+  5741069, 8494095, 5577222, 8494092, 5743889, 8494089, 5574410, 8494081, 8494097, 5580291, 5927437, 5571348,
+  5576464, 8494087, 8494088, 5578003, 8494082, 5817098, 5574678, 5581837, 8494086, 8494095, 8494095, 5651721,
+  8494097, 8494099, 5817363, 5578517, 5577504, 8494122, 8494096, 5579524, 5581573, 8494083, 8494084, 5923348,
+  5582857, 5582602, 8494088, 5577771, 5582349, 5583118, 5579791, 5585154, 8494089, 5586180, 5583635, 5586950,
+  5583381, 5724691, 5729044, 8494090, 8494105, 5933058, 5588229, 8494090, 8494087, 5587720, 5601549, 8494090,
+  5599247, 5589260, 5589781, 8494094, 8494099, 8494100, 8494087, 8494088, 8494099, 8494090, 8494101, 5855490,
+  8494093, 5826818, 5949190, 8494096, 5596930, 8494086, 5594643, 5595412, 5592085, 8494102, 8494088, 8494104,
+  5885186, 5851920, 8494107, 5595149, 5882630, 8494093, 8494099, 8494097, 5665549, 8494094, 5667855, 5598997,
+  8494102, 8494082, 8494083, 8494100, 8494085, 8494112, 8494087, 5600008, 8494081, 8494082, 5890584, 8494092,
+  8494093, 5596430, 8494101, 8494096, 8494123, 8494090, 8494099, 5600532, 8494082, 5894407, 5667588, 8494104,
+  8494086, 8494106, 8494107, 8494081, 8494082, 5921026, 8494084, 8494085, 8494081, 5600258, 5895188, 5601028,
+  8494090, 5603590, 5669652, 5669909, 8494094, 5864194, 8494096, 8494096, 8494087, 5861894, 8494100, 5598485,
+  8494102, 8494082, 8494093, 5600788, 5602837, 8494107, 8494084, 5860368, 8494099, 8494087, 8494088, 8494102,
+  8494093, 5924870, 8494092, 5872902, 8494089, 5601295, 8494099, 8494100, 5683477, 8494112, 8494100, 8494101,
+  8494085, 8494086, 8494087, 8494088, 5875219, 5956367, 8494094, 8494102, 8494093, 5604611, 5606415, 5608965,
+  5610758, 8494087, 8494099, 5607700, 5607178, 8494099, 5906946, 5611533, 8494081, 5615106, 8494086, 8494084,
+  5616645, 5612806, 5610516, 5612053, 8494082, 5617674, 8494083, 8494092, 8494085, 8494107, 8494095, 8494081,
+  8494090, 5700362, 8494084, 5618708, 5620245, 8494094, 5618946, 8494089, 8494097, 5614341, 5619206, 5636877,
+  8494122, 5637903, 5615626, 5607968, 5619980, 5620493, 5622030, 5620751, 5623568, 5828621, 8494087, 8494095,
+  5625364, 8494089, 8494102, 5831955, 5832980, 8494081, 5619714, 5616411, 5624324, 8494097, 5626374, 5908738,
+  8494100, 5626889, 8494090, 5909254, 8494085, 8494086, 8494087, 5633032, 8494089, 5625105, 8494122, 8494083,
+  5622804, 5628437, 8494090, 8494090, 8494088, 5964303, 8494090, 8494100, 8494101, 5630989, 8494103, 5630223,
+  5859091, 8494100, 5854997, 5630483, 5627156, 8494101, 8494083, 8494084, 5629189, 8494089, 5651978, 8494088,
+  5652236, 5657101, 8494094, 5651215, 8494123, 8494094, 5632527, 5657363, 8494100, 8494101, 8494102, 5634324,
+  8494082, 5634838, 8494081, 8494082, 8494083, 8494084, 8494085, 8494086, 8494085, 8494088, 8494089, 5635082,
+  8494082, 5959955, 8494084, 8494095, 5632783, 8494094, 5894671, 8494089, 5633555, 5636116, 8494082, 8494083,
+  8494103, 8494085, 5637126, 8494087, 5964563, 8494082, 5686292, 5682709, 8494092, 8494093, 8494094, 8494095,
+  8494096, 8494090, 8494086, 8494082, 8494100, 5635349, 8494082, 8494083, 5636356, 8494093, 8494099, 5636635,
+  8494096, 8494102, 8494102, 8494099, 8494092, 5747204, 8494094, 5746182, 5641987, 8494097, 5639429, 8494099,
+  8494100, 8494101, 8494089, 5963023, 5749263, 8494092, 8494081, 5640206, 5641743, 5749524, 5750037, 8494086,
+  5642771, 5644308, 8494081, 5645334, 8494083, 8494084, 5643525, 8494086, 8494087, 5644040, 5704194, 5648394,
+  5921542, 8494100, 5705222, 8494094, 5647119, 8494089, 8494090, 8494093, 8494099, 5642260, 8494101, 8494084,
+  8494103, 5643270, 8494087, 8494088, 8494100, 5650947, 8494084, 8494082, 5642509, 5879810, 5646095, 8494089,
+  8494097, 5882886, 5930249, 8494093, 8494112, 8494095, 5651463, 5966357, 8494089, 8494090, 5647636, 8494101,
+  8494099, 8494094, 5645583, 8494101, 8494097, 8494102, 8494085, 8494100, 8494101, 8494083, 5648900, 8494085,
+  8494090, 8494092, 8494093, 8494108, 8494095, 8494099, 8494092, 5652749, 5654030, 5640975, 5658645, 8494097,
+  8494102, 8494099, 5659138, 8494101, 5653014, 8494103, 5658118, 5658370, 5915398, 8494082, 5658890, 5660166,
+  5916682, 8494093, 5659401, 5662986, 5655824, 8494088, 8494082, 5656083, 8494081, 5664272, 8494086, 8494087,
+  5666835, 8494084, 8494090, 5660694, 8494086, 8494087, 5668616, 8494095, 8494090, 8494081, 8494092, 8494099,
+  8494100, 8494112, 8494099, 8494100, 8494104, 8494099, 8494100, 8494101, 8494081, 5673730, 5676291, 5661994,
+  8494123, 8494086, 5721858, 8494089, 8494082, 8494101, 5718790, 8494085, 5675021, 8494089, 8494090, 8494096,
+  8494097, 8494099, 8494100, 5678356, 5678613, 8494081, 5679106, 5678083, 8494093, 5679877, 5677062, 8494087,
+  5680136, 8494086, 8494090, 5722139, 5677324, 8494093, 8494093, 8494092, 8494096, 8494090, 5924623, 8494099,
+  5682196, 5683202, 8494083, 8494096, 8494085, 8494101, 5679367, 8494107, 8494101, 5685509, 8494087, 5687815,
+  8494088, 5685006, 5682959, 5682448, 5683724, 5940494, 5964806, 8494112, 5684757, 8494086, 8494081, 5691394,
+  5688340, 5689621, 5685275, 5692934, 8494087, 8494082, 8494099, 5694730, 8494099, 8494083, 8494093, 8494088,
+  8494086, 8494087, 8494088, 8494106, 5695763, 8494089, 8494101, 8494102, 5697550, 5695247, 8494096, 8494095,
+  5695490, 8494094, 5696020, 5693205, 5699078, 8494087, 8494104, 8494100, 8494090, 8494082, 8494081, 5699341,
+  5698830, 8494086, 5699856, 8494081, 5698562, 8494090, 8494086, 8494101, 5702662, 5701895, 5703688, 8494094,
+  8494097, 8494093, 5703948, 5734927, 5709845, 8494100, 8494095, 5731603, 5955334, 8494096, 5699604, 5704725,
+  8494102, 8494081, 5707010, 8494083, 8494122, 8494107, 5709574, 5701639, 5704456, 8494101, 5704970, 8494082,
+  5707788, 5706509, 8494104, 8494095, 5712400, 8494095, 8494100, 5712906, 8494086, 5711381, 5705494, 8494094,
+  8494090, 5717250, 5715985, 5713435, 5716997, 5718022, 8494087, 5869318, 8494089, 8494090, 8494100, 5871370,
+  8494102, 8494082, 8494095, 8494096, 5979142, 8494086, 5702442, 8494100, 5718549, 8494090, 5719304, 8494102,
+  8494082, 5720590, 5721103, 8494093, 8494082, 5722639, 8494082, 8494100, 8494101, 5871648, 8494100, 8494101,
+  5719574, 8494081, 8494082, 8494083, 8494106, 8494085, 8494086, 8494097, 8494096, 8494090, 5720842, 5736213,
+  5738262, 5723142, 8494087, 5724943, 5964040, 8494093, 8494090, 5726995, 5724436, 8494094, 5725455, 8494085,
+  8494097, 5722370, 8494088, 8494100, 8494101, 5725702, 8494092, 8494100, 8494100, 5728271, 8494081, 5727500,
+  5727245, 5732371, 8494085, 5729798, 8494085, 8494094, 8494086, 5731082, 5729557, 8494102, 5733901, 8494084,
+  5730831, 8494094, 5785103, 8494088, 5735187, 5731348, 8494083, 5783828, 8494083, 8494094, 8494105, 8494086,
+  8494087, 8494081, 8494099, 5735690, 5731861, 5736726, 8494093, 8494095, 5735951, 8494089, 5736465, 8494099,
+  5737235, 8494100, 8494084, 8494085, 8494086, 8494082, 8494105, 8494099, 8494100, 5738502, 5740295, 8494082,
+  8494094, 5792258, 5953026, 8494097, 8494093, 5797126, 5952518, 8494096, 5739010, 5791754, 8494099, 5736965,
+  5740806, 8494102, 8494088, 5793296, 8494096, 5955092, 8494092, 8494093, 8494081, 8494102, 5740048, 8494112,
+  8494085, 5740550, 8494100, 8494088, 8494089, 8494084, 5959439, 8494092, 5739290, 5743131, 5743362, 8494100,
+  8494101, 8494085, 5741318, 8494100, 8494088, 5788714, 8494123, 8494082, 6010637, 8494106, 8494093, 5859590,
+  5741840, 8494083, 8494084, 8494085, 8494099, 5746965, 8494088, 8494089, 8494090, 8494096, 5982470, 5747460,
+  8494085, 5747727, 8494087, 8494097, 8494089, 5749770, 5744404, 8494101, 5748493, 8494085, 8494103, 5978131,
+  8494097, 8494112, 5750803, 5747988, 5751573, 8494102, 8494103, 8494088, 8494089, 8494082, 8494107, 8494099,
+  8494093, 5755918, 8494095, 5755650, 5751825, 5753348, 8494099, 5754374, 8494097, 8494102, 8494089, 5754122,
+  5759490, 8494092, 8494093, 8494096, 5757190, 5755408, 5758225, 8494089, 8494101, 8494086, 8494101, 8494102,
+  5759236, 8494085, 5754640, 8494095, 8494093, 5758483, 5760276, 8494093, 8494082, 5758989, 5757710, 8494095,
+  8494086, 5827859, 5824788, 8494090, 8494100, 5761301, 5762582, 8494084, 8494086, 8494086, 8494097, 8494097,
+  5760009, 5762826, 8494112, 5856277, 5763597, 5761550, 5764111, 5769730, 8494089, 5773058, 5766419, 5770502,
+  5763349, 5775110, 8494089, 5769482, 5760537, 5771274, 6020617, 8494084, 8494082, 5768720, 8494087, 5770768,
+  5767699, 5851146, 5777683, 8494081, 8494085, 5768470, 8494095, 8494088, 8494086, 8494085, 5853203, 5773580,
+  5777165, 8494094, 5777935, 5771808, 8494097, 5868815, 5774867, 5778964, 5780501, 8494102, 8494100, 8494099,
+  8494105, 8494093, 8494123, 5780739, 5780996, 8494085, 5926148, 5781255, 8494086, 5782025, 5782538, 8494089,
+  5782284, 5786381, 5782798, 5783055, 8494099, 8494100, 8494093, 5787923, 5785876, 5781781, 8494102, 8494101,
+  8494083, 5777433, 8494085, 8494087, 8494087, 5797634, 8494090, 5787652, 8494097, 5797894, 5784077, 6001940,
+  5793033, 6028038, 5788945, 5795340, 5790227, 8494082, 8494082, 8494096, 8494097, 5799942, 5802758, 8494086,
+  5793813, 8494090, 5801738, 5961226, 8494093, 8494093, 8494086, 8494087, 8494096, 8494087, 8494099, 8494082,
+  8494100, 8494102, 5799173, 8494089, 8494087, 5803528, 5796098, 8494090, 8494081, 8494093, 5961738, 8494094,
+  8494112, 5961485, 8494090, 5961999, 8494089, 8494090, 8494101, 5962515, 8494096, 8494099, 8494122, 8494099,
+  8494097, 8494101, 8494082, 8494100, 8494101, 8494082, 8494086, 5804571, 8494081, 5807106, 8494083, 8494084,
+  8494085, 5810694, 8494087, 8494088, 6011661, 5811210, 8494091, 8494092, 5813773, 8494094, 8494095, 5811984,
+  8494097, 8494099, 8494099, 8494100, 8494101, 8494102, 8494103, 8494081, 5813250, 5876998, 8494107, 8494085,
+  5812742, 8494081, 8494081, 8494112, 8494093, 8494087, 8494086, 8494093, 5814530, 5816329, 5880851, 8494100,
+  5814790, 8494095, 5813012, 8494101, 5819402, 8494081, 8494104, 8494099, 8494100, 8494107, 5819664, 5817858,
+  8494094, 5886991, 8494093, 5820422, 8494090, 8494099, 8494100, 8494090, 8494083, 8494084, 5821709, 8494094,
+  8494095, 5818896, 5851394, 8494095, 8494099, 5822484, 5824021, 8494102, 5821199, 8494104, 8494102, 8494085,
+  8494082, 8494093, 8494101, 8494102, 8494086, 8494112, 8494105, 5851667, 5852180, 8494088, 8494086, 5819149,
+  5819918, 5821967, 5822736, 5827586, 8494081, 5827347, 5824276, 5829126, 8494087, 5910534, 8494100, 8494090,
+  8494102, 8494100, 8494093, 5871111, 8494093, 5828112, 8494082, 5906192, 5820691, 8494085, 5834758, 8494087,
+  5911829, 8494097, 5833482, 5872659, 8494100, 8494093, 8494099, 8494096, 5834256, 5825824, 8494081, 5837314,
+  5828372, 5833749, 8494085, 5839622, 8494087, 5834504, 8494089, 5832714, 8494091, 8494092, 5840653, 8494094,
+  8494095, 8494096, 8494097, 8494082, 8494099, 5842708, 5841173, 5833238, 8494103, 8494104, 5884930, 8494084,
+  8494107, 8494086, 5884422, 5835778, 5836291, 8494112, 5882378, 5843718, 8494087, 5835016, 8494106, 8494085,
+  5878544, 8494092, 8494082, 8494122, 5844751, 8494096, 5921286, 8494093, 5839891, 5843988, 5842453, 5842946,
+  5967110, 8494084, 8494100, 5844486, 8494107, 8494097, 5848066, 8494093, 5979911, 5923605, 5846534, 6075411,
+  8494082, 5850633, 5846033, 5969941, 5856774, 5847316, 5848341, 8494122, 5849872, 5981972, 5978389, 5850387,
+  5849364, 8494101, 5853456, 6075654, 8494093, 5858323, 5855252, 5847835, 5854230, 5856515, 8494099, 6074118,
+  8494101, 5862151, 5962758, 5864450, 5859338, 5863940, 8494090, 6073363, 8494082, 5862415, 5849130, 8494086,
+  8494086, 5862931, 5858580, 8494099, 8494100, 8494096, 5866257, 5863181, 6082822, 8494095, 5865493, 5866760,
+  8494099, 8494100, 6089225, 5867788, 8494102, 5863438, 5868047, 8494106, 8494082, 8494112, 5865747, 8494085,
+  5866005, 8494102, 8494099, 5869059, 8494084, 8494085, 8494107, 8494087, 5870598, 5931279, 8494090, 6010114,
+  5872138, 8494093, 8494100, 5866511, 5873411, 8494084, 8494094, 5870355, 8494091, 5871893, 8494082, 8494099,
+  6081538, 8494092, 5879302, 5876494, 5873935, 8494100, 8494090, 8494084, 5878035, 5874964, 8494112, 5878806,
+  5875472, 5877258, 6118922, 8494099, 8494093, 5880590, 5876239, 8494101, 8494122, 5879046, 5883411, 5882120,
+  5879573, 8494083, 8494085, 8494092, 8494105, 8494087, 5884687, 8494089, 5883665, 8494096, 8494097, 8494085,
+  6069263, 8494100, 6002965, 8494097, 8494090, 8494099, 8494081, 8494093, 8494102, 5889039, 8494085, 8494105,
+  6041346, 5890835, 6044164, 5886485, 5887510, 8494088, 8494082, 5889290, 8494091, 8494092, 5891853, 8494087,
+  8494095, 8494100, 8494101, 8494097, 5892115, 5892372, 5892629, 8494101, 8494102, 8494104, 5895939, 8494084,
+  8494085, 8494086, 8494081, 5899010, 8494082, 8494093, 8494094, 5900038, 5896461, 8494094, 5897743, 5897482,
+  8494085, 8494086, 5898515, 8494088, 5894165, 8494102, 8494096, 5903884, 5898771, 5899540, 5937154, 5896726,
+  5936644, 8494082, 5934342, 5907476, 5903381, 6064646, 6117648, 8494085, 8494122, 8494112, 8494112, 5901571,
+  8494084, 5935377, 8494086, 5902343, 6079502, 5938197, 5936150, 8494122, 8494123, 5901837, 8494094, 5902607,
+  8494085, 8494089, 6125071, 5905171, 5901332, 8494101, 5902870, 5907970, 5909517, 8494105, 8494081, 5903110,
+  8494090, 8494082, 8494099, 5909780, 8494101, 8494102, 5906701, 8494082, 5912066, 5900816, 5913604, 5917190,
+  5915910, 5907732, 5915145, 8494096, 8494090, 8494082, 8494092, 8494086, 8494094, 8494096, 8494085, 8494090,
+  5916179, 8494100, 8494085, 5916437, 5914646, 8494092, 5952002, 8494094, 8494095, 8494107, 5952774, 8494102,
+  8494095, 5912600, 8494081, 5917698, 8494094, 8494100, 8494085, 5919494, 5953296, 8494088, 8494081, 8494122,
+  8494081, 8494084, 5949718, 5918214, 8494095, 5916944, 8494089, 6048006, 8494089, 8494100, 6047241, 5921804,
+  5948704, 6043404, 8494097, 8494106, 8494097, 8494100, 8494101, 5918978, 8494101, 8494102, 6002189, 8494086,
+  8494087, 8494084, 8494107, 5924098, 5998867, 8494090, 8494093, 5923078, 8494081, 8494082, 6141459, 5925134,
+  8494107, 5993990, 8494097, 8494102, 5927699, 8494096, 8494101, 5928214, 8494082, 8494082, 5924373, 5923862,
+  8494086, 8494086, 8494096, 5989652, 5928457, 5928714, 8494092, 6088469, 5928973, 8494112, 5930767, 6144019,
+  8494087, 8494107, 5933331, 5927188, 5932565, 8494102, 8494093, 8494094, 5934607, 5932802, 8494097, 5940738,
+  5935123, 8494086, 8494101, 5936902, 6050818, 5936394, 6140422, 5941002, 5945091, 6139654, 8494094, 5933584,
+  8494090, 5938960, 5933843, 8494099, 5943571, 8494101, 5945357, 8494094, 5944079, 8494087, 5942289, 8494101,
+  5945619, 5939207, 8494101, 5945878, 5946378, 5937696, 8494102, 5947917, 5943822, 5944591, 8494100, 5947409,
+  8494089, 5947155, 5944852, 5938730, 8494123, 8494084, 8494085, 5946649, 8494095, 8494088, 8494097, 8494090,
+  8494099, 5948940, 5951747, 8494084, 8494095, 8494102, 8494087, 5954566, 6157076, 5948436, 5947657, 8494087,
+  5951255, 8494100, 8494101, 6009347, 8494097, 5954832, 8494089, 8494100, 5955859, 5957908, 8494083, 5950990,
+  5956623, 8494093, 8494087, 6161427, 5959187, 8494090, 8494101, 6008083, 5955597, 8494088, 5958927, 8494103,
+  8494085, 8494085, 5962259, 8494100, 8494095, 8494082, 8494097, 6158100, 8494105, 8494100, 6160399, 5957398,
+  8494089, 5963786, 5999362, 8494099, 8494100, 8494095, 6001158, 5963536, 6083590, 6001673, 8494099, 8494100,
+  8494101, 8494102, 5966083, 8494093, 8494085, 5966854, 8494087, 8494088, 8494089, 6087699, 8494102, 8494086,
+  8494100, 8494088, 8494095, 8494096, 5965062, 8494095, 8494093, 8494100, 8494101, 8494099, 8494084, 8494104,
+  8494094, 8494100, 8494107, 5971202, 8494090, 8494099, 8494085, 5970950, 8494102, 8494103, 8494096, 8494097,
+  8494087, 5971980, 5970189, 5978901, 8494102, 5967888, 8494092, 8494094, 8494095, 8494107, 5972245, 8494102,
+  5972738, 8494083, 6123793, 5972997, 8494086, 8494087, 6123029, 8494102, 5970442, 5976322, 8494092, 8494093,
+  8494092, 5978630, 5973264, 6162441, 8494089, 8494097, 5974036, 5977109, 8494102, 6007573, 8494104, 8494099,
+  8494087, 5970715, 8494099, 8494107, 8494101, 8494084, 8494112, 8494082, 5975043, 8494084, 5976581, 5976838,
+  8494086, 8494088, 8494101, 5977354, 6066191, 8494092, 8494081, 8494094, 6067475, 8494084, 5977873, 6071318,
+  8494084, 8494100, 5979413, 8494102, 8494088, 8494104, 8494099, 6153236, 6004751, 5980941, 8494094, 5982991,
+  8494099, 6001428, 6068746, 6005526, 5983252, 8494101, 5984770, 8494083, 8494086, 8494085, 5986054, 6072595,
+  8494100, 6072341, 8494081, 5980418, 6162186, 5984013, 5982725, 5988102, 8494096, 5989128, 8494096, 5987594,
+  5982228, 8494101, 5986829, 8494084, 5991183, 8494096, 8494087, 8494094, 6156559, 5990676, 5994773, 6122505,
+  8494112, 8494082, 6127628, 8494093, 8494107, 6094854, 6093831, 6006548, 8494101, 8494090, 8494122, 8494081,
+  5988610, 5984515, 8494084, 8494085, 5992710, 5994247, 5992968, 8494094, 5985546, 6161930, 5996300, 5998605,
+  8494099, 5999119, 5998096, 6125327, 6150920, 5992467, 5995284, 6118419, 8494081, 6124309, 6151438, 6151695,
+  6002693, 6000923, 8494087, 5999624, 8494089, 6002442, 8494112, 8494112, 6009092, 8494085, 8494095, 5999888,
+  8494081, 8494089, 6003203, 6004244, 8494101, 6128642, 8494094, 8494088, 8494089, 6003466, 8494099, 6165014,
+  8494084, 6006286, 6006022, 8494087, 8494088, 8494094, 6007315, 8494096, 8494097, 6003990, 8494094, 6009871,
+  8494084, 8494097, 8494087, 8494099, 6008340, 6005781, 8494090, 8494083, 8494092, 8494085, 8494083, 8494107,
+  8494088, 8494097, 6159635, 8494099, 6007060, 6010374, 8494094, 6008591, 8494084, 8494090, 8494086, 8494101,
+  8494097, 8494099, 6082579, 8494100, 8494086, 8494105, 8494086, 8494100, 6012693, 8494102, 8494081, 6168585,
+  8494100, 6005269, 8494102, 8494086, 6013959, 8494099, 8494106, 8494082, 6014467, 8494084, 6013701, 6012422,
+  6011398, 8494088, 8494106, 8494090, 8494090, 8494100, 6013205, 8494094, 6015503, 8494087, 6014225, 8494089,
+  8494107, 8494099, 8494100, 6016021, 8494085, 8494082, 8494096, 6051345, 8494089, 8494085, 8494081, 6015746,
+  8494093, 8494084, 6019589, 8494093, 8494087, 8494088, 6164750, 6019082, 6011925, 6014742, 6014989, 8494104,
+  8494095, 6181122, 8494107, 8494083, 8494084, 6016276, 6012934, 8494089, 8494103, 8494083, 6019332, 8494084,
+  8494085, 8494099, 8494082, 8494089, 8494090, 8494097, 8494092, 8494095, 6017812, 8494095, 8494095, 8494097,
+  8494083, 8494084, 8494122, 6019861, 8494102, 6018838, 8494083, 8494084, 8494100, 8494092, 6021634, 6017550,
+  8494095, 6022666, 6024454, 6165251, 8494099, 8494089, 6023439, 8494102, 8494103, 6025218, 6024211, 8494086,
+  6021904, 6026502, 8494103, 6154250, 8494105, 6026762, 6024726, 8494100, 8494100, 8494092, 6027779, 6026256,
+  8494085, 8494100, 6026003, 8494097, 8494112, 6030358, 6160661, 6028812, 8494093, 8494094, 6031887, 6120454,
+  8494107, 6030602, 6032147, 6028320, 6034445, 6031382, 6030863, 6036482, 8494085, 8494096, 6034963, 6037766,
+  6035221, 8494096, 6027051, 8494102, 8494105, 6035982, 6036239, 6034192, 8494089, 6034704, 8494082, 6037012,
+  6037525, 8494112, 6038534, 6035478, 8494083, 6198799, 8494082, 8494100, 6204688, 8494102, 8494086, 8494085,
+  6038032, 6040337, 8494090, 6038286, 6038799, 6040085, 8494087, 8494086, 6039571, 8494097, 8494095, 8494107,
+  8494123, 6040597, 8494082, 6085122, 8494085, 6042629, 6143505, 6083846, 8494088, 6041603, 8494101, 6084362,
+  6041094, 6126094, 6125583, 8494097, 6043658, 6170643, 8494092, 6122004, 6039060, 8494101, 8494096, 8494102,
+  8494104, 6206214, 6044948, 8494101, 8494081, 8494082, 6041859, 8494101, 8494085, 6043142, 8494087, 8494088,
+  8494089, 6044426, 8494087, 6148102, 8494093, 8494102, 8494095, 6046992, 6085419, 6155276, 6047507, 8494100,
+  8494085, 6042390, 6152209, 8494104, 8494082, 6078982, 8494107, 8494085, 6045190, 6201614, 8494082, 8494112,
+  8494090, 8494091, 6048262, 8494093, 8494094, 6151968, 6088723, 8494100, 8494101, 8494099, 6171650, 6125830,
+  8494102, 8494094, 6171910, 8494099, 8494100, 8494101, 8494102, 8494082, 8494095, 6182166, 8494085, 6044678,
+  6130451, 8494088, 8494084, 6045962, 8494082, 8494086, 8494093, 8494086, 8494095, 6049808, 8494106, 6047754,
+  6046474, 8494092, 8494093, 8494123, 6051598, 8494095, 6048784, 8494097, 6048531, 8494092, 8494101, 6046229,
+  6049046, 6051074, 8494099, 6115074, 6052613, 6052358, 8494087, 6052872, 6057225, 6140930, 6105865, 8494090,
+  8494093, 8494085, 8494095, 6052112, 8494097, 6142986, 6207244, 6053652, 6049301, 6112788, 6118165, 8494104,
+  6207757, 8494082, 6053147, 8494096, 6054402, 8494102, 8494084, 8494112, 6057734, 8494087, 8494088, 6210836,
+  6055178, 6120962, 6208014, 8494096, 6056718, 6119686, 6055952, 8494100, 8494099, 8494081, 6056962, 6057493,
+  8494102, 8494085, 6060038, 8494107, 8494088, 8494089, 6057994, 6059010, 8494092, 8494102, 6138630, 6060294,
+  8494096, 8494097, 6137866, 8494090, 6059796, 6062357, 8494093, 8494094, 6228230, 8494096, 6204935, 8494099,
+  6061843, 6058772, 6064149, 8494084, 8494112, 8494086, 8494123, 6065923, 6063387, 6119946, 8494099, 6062855,
+  6062600, 6069506, 8494095, 8494101, 6136066, 6074374, 6122771, 6067983, 6137606, 8494090, 8494082, 8494122,
+  6068500, 6067221, 8494086, 8494096, 8494096, 8494089, 8494090, 8494086, 8494092, 8494102, 8494085, 6185730,
+  8494096, 8494097, 6074630, 6189318, 6209546, 6075925, 8494090, 8494112, 8494094, 6076173, 8494112, 8494095,
+  6077200, 6198292, 8494092, 8494099, 8494100, 8494122, 6227714, 8494102, 8494104, 8494099, 8494100, 8494094,
+  8494083, 6075140, 8494085, 8494084, 8494087, 8494088, 8494089, 6205702, 8494099, 8494092, 8494093, 8494081,
+  6077455, 6078211, 8494093, 8494123, 6076947, 6074900, 6076693, 6077718, 6077962, 8494102, 6086146, 6079245,
+  6078734, 6081807, 6087430, 8494089, 8494086, 6082323, 6083092, 8494093, 6229254, 8494093, 6159888, 8494105,
+  8494096, 6162707, 6087171, 8494099, 8494085, 6230035, 6090503, 8494088, 8494089, 8494099, 8494081, 6089474,
+  8494093, 6086414, 6091279, 6095110, 8494112, 6230292, 8494101, 6094356, 6093077, 6231050, 8494087, 8494086,
+  6135298, 6090000, 8494097, 6090780, 8494086, 8494100, 8494102, 6095382, 8494081, 6097666, 6163985, 6094084,
+  6099461, 6099974, 8494101, 6101256, 8494082, 8494099, 6136340, 6102028, 6136598, 8494087, 6099727, 6232077,
+  8494090, 6136859, 6213126, 6100500, 6102805, 6232595, 8494112, 8494081, 6104322, 8494099, 6096155, 8494101,
+  6109446, 6106631, 6112008, 6099209, 6100234, 8494101, 6110732, 6105357, 6101006, 6114575, 8494097, 8494086,
+  8494099, 6110483, 6116116, 8494087, 6103574, 6248973, 6116632, 8494081, 6100738, 6114331, 8494094, 6182671,
+  6115334, 8494082, 8494112, 8494089, 8494090, 8494086, 6114828, 8494083, 6167049, 6164234, 8494083, 6104081,
+  8494122, 8494082, 8494087, 6118677, 8494102, 6230534, 8494104, 8494095, 8494106, 8494086, 8494087, 8494081,
+  8494090, 6126851, 6191891, 8494092, 8494093, 6128135, 6106383, 8494104, 8494093, 6127366, 6115859, 8494086,
+  8494101, 6128399, 8494082, 8494100, 8494101, 6127891, 6129172, 6124816, 8494087, 6255119, 8494090, 6128916,
+  6130197, 8494102, 6129666, 6192902, 8494095, 6127109, 6132998, 8494087, 6231827, 8494089, 6130954, 8494091,
+  6134540, 6192144, 6194449, 6258690, 6132240, 8494087, 6193941, 6263565, 6135572, 8494101, 8494102, 8494103,
+  8494086, 8494081, 8494082, 8494107, 6134276, 6202125, 6139149, 6198031, 8494095, 6135049, 8494097, 6203923,
+  6141715, 8494093, 6142211, 6263316, 6133520, 8494097, 6164490, 6144776, 8494100, 8494101, 8494086, 8494102,
+  8494096, 6145038, 6147599, 8494099, 6209801, 8494090, 6143251, 6205452, 6145301, 6146838, 6144259, 6147076,
+  8494082, 6142470, 8494087, 6150147, 8494112, 6148874, 8494099, 8494087, 6149133, 8494093, 6149903, 8494082,
+  8494097, 8494093, 6154515, 8494100, 8494083, 6152465, 8494085, 6154771, 6149401, 6157320, 8494102, 8494094,
+  8494104, 6158604, 8494097, 8494094, 6158863, 6157573, 6157841, 8494087, 6155027, 8494095, 6155541, 8494081,
+  8494082, 8494083, 8494100, 6227989, 6158342, 8494097, 8494085, 6159379, 6156308, 8494091, 8494086, 8494093,
+  6162946, 8494083, 8494084, 8494085, 6163206, 6161171, 8494088, 8494082, 6262022, 8494097, 8494092, 8494086,
+  6201364, 6199061, 8494102, 8494097, 6271765, 6163468, 8494086, 8494101, 6232330, 8494099, 6163729, 8494083,
+  8494084, 8494085, 6165781, 8494097, 8494081, 6265090, 8494112, 8494083, 8494102, 8494093, 6167310, 6166287,
+  8494100, 6175234, 6165514, 6169363, 6271503, 6171405, 6168342, 8494089, 8494089, 6172938, 6272770, 6172435,
+  6177282, 6169109, 8494096, 8494096, 6178310, 6168089, 6173971, 6272518, 6175754, 6173462, 8494083, 6269706,
+  6268688, 6179587, 6180368, 8494095, 8494089, 6177811, 8494088, 6271251, 8494102, 8494094, 6275603, 6174989,
+  6183438, 6184207, 6197011, 8494097, 8494084, 6184723, 6174496, 6181909, 6180886, 6181385, 6184458, 8494084,
+  8494085, 6183181, 6184974, 6185999, 6264845, 6179371, 6272015, 6188563, 6186772, 6185230, 6191119, 6190082,
+  8494086, 8494087, 8494082, 6193158, 8494101, 8494090, 8494086, 6189578, 8494082, 6279430, 8494096, 8494096,
+  6197254, 6191632, 8494099, 6196757, 8494090, 8494097, 8494089, 8494093, 6222356, 6224661, 8494096, 8494081,
+  6276878, 8494099, 6193428, 8494107, 8494102, 6189856, 6272277, 6196227, 8494090, 8494085, 8494086, 8494087,
+  8494088, 8494089, 8494095, 8494122, 8494092, 8494093, 8494100, 6285580, 8494099, 6198545, 8494104, 8494099,
+  8494100, 8494107, 8494102, 8494082, 8494104, 8494093, 6287638, 8494107, 8494087, 6195208, 6197506, 8494090,
+  8494100, 8494086, 6196486, 8494084, 8494089, 8494090, 8494090, 8494088, 8494099, 8494100, 8494101, 8494095,
+  8494096, 8494104, 8494095, 6199298, 8494097, 8494101, 8494102, 6202630, 8494101, 6201878, 8494083, 8494084,
+  6288141, 8494086, 8494087, 8494088, 8494093, 6203408, 6204418, 8494083, 8494099, 6201108, 8494086, 8494087,
+  8494088, 6270726, 8494082, 6210050, 8494092, 6207501, 8494094, 6208262, 8494093, 8494112, 8494090, 6209299,
+  8494100, 8494101, 8494099, 8494094, 8494083, 8494094, 8494095, 6229011, 8494099, 8494100, 8494099, 8494082,
+  8494112, 6244354, 8494099, 6212358, 6291732, 8494088, 8494097, 6210570, 8494089, 8494112, 8494093, 6214146,
+  8494095, 8494096, 6213381, 6212614, 8494085, 8494096, 6247187, 6214922, 6248725, 8494102, 6211597, 8494086,
+  8494094, 8494101, 8494097, 6265862, 8494087, 6281235, 8494101, 6208534, 8494103, 6215426, 8494083, 6217732,
+  8494085, 6215174, 6216455, 6220040, 8494089, 6210314, 8494101, 8494122, 6220301, 6287112, 8494095, 6291469,
+  8494087, 8494088, 6286605, 6221588, 6220565, 8494102, 8494093, 8494104, 6233103, 8494086, 6221851, 6222082,
+  8494083, 6229524, 8494091, 8494112, 6291989, 8494088, 8494089, 8494090, 6223618, 6218252, 6289164, 8494100,
+  6223110, 6221328, 6284546, 6294291, 8494099, 6222612, 6222869, 8494102, 6226958, 8494101, 6219792, 8494087,
+  8494107, 6289435, 6227476, 6220821, 6224406, 8494093, 8494095, 8494095, 6285076, 8494082, 8494099, 8494099,
+  6228756, 6229781, 8494112, 6231298, 8494083, 8494090, 6234117, 6232838, 6235911, 6292489, 8494099, 8494096,
+  8494097, 6235148, 8494093, 8494086, 6265621, 6236432, 6288390, 6309642, 6237186, 6236948, 6237461, 6234629,
+  6235654, 6290189, 6239240, 6322434, 6236682, 6321679, 8494092, 8494083, 6322698, 6242562, 6236176, 8494081,
+  6238210, 6241542, 6238996, 6241045, 6242822, 8494087, 6233608, 8494095, 6243338, 8494082, 6240780, 8494100,
+  6243857, 6240015, 6358029, 6246932, 6244885, 6250506, 6244628, 6240533, 6246661, 8494082, 6247707, 6251780,
+  6249221, 6244123, 8494099, 8494112, 6250253, 8494090, 6247951, 6321926, 8494083, 8494106, 6251027, 8494100,
+  6250773, 6249730, 6260998, 8494090, 8494086, 6249478, 6321425, 8494100, 8494092, 6249994, 8494107, 6264079,
+  8494093, 6283284, 8494100, 8494095, 6264340, 6259477, 8494099, 6254338, 6308884, 8494102, 6254597, 6254086,
+  6252295, 6256136, 8494089, 6253834, 8494102, 8494081, 6252802, 8494085, 6255620, 6255376, 8494086, 8494100,
+  8494082, 6255892, 8494082, 8494102, 8494086, 6267906, 8494093, 8494089, 6270981, 8494097, 8494087, 6270472,
+  6258964, 6257685, 8494096, 8494095, 8494096, 8494099, 6258196, 6258453, 8494102, 8494082, 8494083, 6309127,
+  8494101, 8494107, 8494090, 8494093, 8494094, 8494093, 6367750, 8494092, 8494093, 8494083, 6256399, 6366477,
+  6311444, 8494087, 6256659, 6256916, 6257162, 8494102, 8494086, 6260237, 8494088, 6262543, 6267141, 6265350,
+  8494090, 6263059, 6259732, 8494090, 8494102, 8494099, 6353936, 6294547, 8494100, 8494094, 8494095, 6277382,
+  8494097, 6268436, 6269973, 8494100, 8494101, 6273814, 8494085, 8494106, 8494087, 6273552, 8494082, 6273034,
+  6275091, 8494112, 6275853, 8494102, 6276367, 6277126, 8494094, 6367247, 6276115, 6274570, 6313230, 8494102,
+  8494085, 8494112, 8494105, 8494096, 8494083, 6278410, 6273299, 8494083, 6277645, 8494102, 6278927, 8494092,
+  8494085, 8494092, 6283027, 8494094, 6280725, 8494102, 8494103, 8494112, 6275347, 8494094, 8494095, 6278678,
+  8494089, 8494090, 8494099, 8494100, 6282005, 8494082, 8494123, 6279940, 8494082, 6281478, 8494099, 8494085,
+  8494090, 8494097, 8494082, 6285324, 8494100, 8494101, 8494102, 6286861, 6286341, 6283782, 8494087, 6287368,
+  6280981, 6285834, 6309898, 8494101, 8494096, 8494097, 6327302, 8494086, 6365698, 6289685, 8494102, 6310419,
+  8494100, 6289926, 8494094, 8494104, 8494089, 8494090, 8494107, 8494099, 8494093, 6293506, 6367504, 6290448,
+  8494085, 6292230, 6283539, 8494100, 6368774, 8494102, 8494082, 8494097, 8494093, 8494094, 8494093, 8494093,
+  8494095, 8494082, 8494099, 8494112, 8494099, 6292742, 8494103, 8494088, 8494096, 6291210, 8494082, 6293267,
+  8494083, 8494101, 8494086, 8494083, 8494081, 8494082, 8494099, 8494093, 6326028, 8494081, 6294786, 6293763,
+  8494112, 6295301, 6297350, 8494087, 6295560, 6366225, 6297866, 8494099, 6395912, 6296077, 8494099, 6295042,
+  8494082, 6297105, 6392847, 6300422, 6299924, 6296597, 8494102, 6299658, 8494090, 6355725, 8494106, 6359823,
+  8494095, 8494096, 8494097, 8494099, 8494112, 6297620, 6298389, 8494081, 6296322, 8494083, 6399764, 8494085,
+  6298886, 8494087, 8494088, 8494089, 8494090, 6400016, 8494092, 8494093, 6319618, 6303503, 8494096, 8494097,
+  8494086, 8494099, 8494100, 6300181, 6320650, 8494101, 8494104, 6300678, 6304263, 6304539, 6322960, 6405129,
+  6373904, 8494085, 8494112, 8494099, 6322198, 6301200, 8494099, 6323210, 8494099, 6304020, 8494081, 8494082,
+  8494095, 8494084, 8494085, 8494086, 8494099, 8494081, 8494101, 8494090, 6305540, 8494092, 6305293, 8494087,
+  8494122, 6303760, 8494086, 8494088, 6304787, 8494086, 6307093, 8494102, 8494093, 8494097, 6406661, 8494096,
+  6307348, 6307605, 8494099, 6302978, 8494100, 8494101, 6306842, 6308102, 8494089, 8494095, 8494089, 6358274,
+  8494112, 8494099, 8494100, 8494094, 8494097, 6306064, 8494096, 8494105, 8494085, 6308372, 8494087, 8494088,
+  6397192, 8494090, 8494082, 6310668, 8494099, 6357780, 6314767, 8494102, 8494097, 8494089, 6306579, 6310914,
+  6311701, 6312470, 6312965, 8494086, 8494105, 8494105, 8494081, 6312714, 8494083, 6412808, 6317069, 6315022,
+  6314255, 8494096, 8494095, 8494090, 6320403, 6318356, 6313493, 8494083, 8494084, 8494100, 8494097, 8494087,
+  8494106, 8494100, 8494082, 8494102, 8494084, 6326277, 6323718, 6314511, 6323464, 6315537, 6364162, 6317587,
+  6315796, 6316053, 8494100, 6328079, 8494083, 8494097, 6364682, 6328838, 6324244, 8494083, 6420490, 6329354,
+  6362128, 8494092, 6329101, 8494089, 8494084, 8494096, 6355974, 8494086, 8494088, 8494086, 8494087, 8494102,
+  6410518, 8494099, 8494100, 8494095, 6361376, 8494097, 8494097, 8494099, 6413572, 8494112, 8494081, 6330626,
+  8494083, 8494084, 6334725, 6333702, 8494087, 6338056, 8494089, 8494090, 8494091, 8494092, 6425346, 8494094,
+  6332687, 8494096, 8494092, 8494093, 8494123, 6336788, 6343445, 8494102, 8494103, 8494104, 8494082, 6432774,
+  6328347, 6417417, 6329606, 8494087, 6443014, 6364930, 8494090, 6365188, 6447366, 6369030, 6447882, 8494099,
+  6328592, 8494086, 8494081, 6348034, 6339843, 8494101, 6333189, 6341894, 6340103, 6330888, 6327817, 8494090,
+  8494091, 6341388, 6331661, 6339086, 6347791, 6337040, 8494090, 8494100, 8494083, 6345236, 6346005, 6342166,
+  8494103, 6346520, 8494081, 6350594, 6347035, 8494092, 8494093, 6350342, 6454797, 8494086, 8494089, 8494090,
+  6376979, 6347276, 8494099, 6413315, 6356226, 6350864, 6354193, 6349098, 6353414, 6352404, 6354965, 6357257,
+  6354698, 6412557, 6459917, 6351386, 8494099, 8494084, 8494085, 8494093, 6409236, 6392078, 8494095, 6357525,
+  8494102, 8494092, 6382867, 6361102, 6361615, 6358811, 6359562, 6461459, 6358547, 6363149, 8494086, 6362639,
+  8494103, 8494081, 8494090, 6363923, 6364436, 8494083, 6372102, 8494093, 6363664, 8494086, 8494090, 8494095,
+  8494082, 8494099, 8494102, 6369293, 6370822, 6370063, 6440470, 8494099, 8494094, 6371603, 6372884, 6371853,
+  8494102, 8494095, 8494106, 6370306, 8494102, 6373139, 6374420, 6372358, 8494081, 6375682, 8494083, 6372618,
+  8494085, 6465543, 8494087, 6373384, 8494089, 6371088, 6463764, 8494092, 8494099, 6387203, 8494101, 6374672,
+  8494097, 8494082, 8494084, 6376724, 8494101, 8494102, 8494103, 8494104, 6376194, 8494090, 6375940, 6385425,
+  6377734, 6388755, 6448390, 8494096, 8494083, 6384898, 8494099, 8494100, 6378773, 6384646, 6377232, 6378001,
+  8494096, 6384394, 8494100, 8494085, 8494102, 6376451, 8494084, 8494096, 6453011, 8494100, 6379528, 6402566,
+  8494094, 6384143, 8494112, 6379789, 8494091, 6380047, 6405645, 6380561, 8494084, 6377491, 6382100, 6380821,
+  6380310, 8494100, 6381322, 8494090, 6386434, 6381837, 6390274, 6383631, 6383878, 6466825, 6389254, 6382611,
+  6385162, 6382357, 6388482, 8494087, 8494085, 6390786, 6388998, 6464776, 6388240, 6390534, 8494095, 6403599,
+  8494082, 6389514, 6463247, 8494099, 8494096, 8494090, 6396675, 6392336, 6398213, 6389781, 6394387, 6393620,
+  6386720, 8494084, 8494099, 8494107, 6396941, 6401282, 8494095, 6399242, 8494090, 8494086, 6398989, 6393876,
+  6395663, 8494102, 6400771, 8494087, 6399507, 6400532, 8494087, 8494102, 8494097, 8494100, 8494105, 8494086,
+  6400277, 8494097, 8494081, 8494086, 8494097, 8494092, 6401555, 6401798, 8494082, 6469141, 8494093, 6405898,
+  6402822, 8494100, 8494101, 8494099, 8494090, 8494081, 6407426, 8494106, 8494084, 6407685, 8494086, 8494081,
+  8494088, 8494089, 8494100, 8494106, 8494086, 8494093, 6408462, 8494089, 8494101, 8494092, 8494092, 8494083,
+  8494100, 8494101, 6408194, 8494097, 8494093, 6470150, 6408966, 6408725, 8494102, 6405385, 6409482, 6451729,
+  8494094, 6452243, 8494100, 8494086, 6409744, 8494087, 6411779, 8494099, 8494085, 8494099, 8494122, 6414344,
+  8494094, 6438159, 8494108, 8494092, 6413837, 6428435, 6416911, 8494101, 8494112, 8494084, 6415635, 8494100,
+  6416149, 6414614, 8494103, 8494083, 8494105, 8494090, 8494123, 6443790, 6455567, 6419721, 6414090, 8494086,
+  6425090, 6419469, 6421262, 6420239, 6425606, 6417937, 6421765, 6422547, 6418954, 6419989, 8494102, 6427661,
+  8494084, 6417177, 8494093, 6420750, 6424335, 8494085, 6453506, 6428167, 6483725, 6423060, 6425877, 8494099,
+  8494106, 8494086, 8494094, 6426127, 6429954, 8494097, 6434306, 6429459, 6429190, 6459665, 6436102, 8494089,
+  6429706, 8494101, 6439690, 6464276, 8494084, 8494112, 8494096, 6444550, 6430992, 6430227, 8494093, 6431251,
+  6431756, 6441997, 6430742, 6442255, 8494123, 6443536, 8494095, 6445843, 8494099, 6435605, 8494099, 6446870,
+  6438432, 6433282, 6452738, 8494106, 8494090, 8494086, 6458118, 8494088, 6441225, 6446346, 6457866, 6432043,
+  6440973, 6439950, 6444303, 8494084, 6458640, 8494086, 6450195, 6451476, 6445333, 6445590, 8494103, 8494081,
+  8494082, 8494083, 6478348, 6467599, 6450961, 8494087, 8494088, 6460180, 8494100, 8494101, 8494100, 8494093,
+  8494094, 8494082, 8494086, 8494082, 6485260, 8494099, 8494100, 8494123, 8494082, 8494103, 8494104, 8494090,
+  8494086, 8494107, 6454280, 8494082, 8494090, 8494082, 8494092, 6461190, 8494086, 8494100, 8494084, 6461962,
+  8494090, 8494099, 8494100, 8494101, 8494107, 8494103, 8494104, 8494096, 6460420, 8494081, 8494099, 8494102,
+  8494088, 8494095, 8494100, 8494101, 8494092, 8494089, 8494100, 6460687, 8494093, 8494112, 8494096, 8494099,
+  8494100, 8494101, 8494102, 6462989, 8494100, 6462223, 6490129, 8494122, 8494122, 6462739, 6460948, 6464021,
+  6459414, 8494086, 8494083, 8494084, 8494085, 8494090, 8494093, 8494094, 8494082, 8494094, 8494095, 6478854,
+  6469382, 8494100, 6480911, 6464534, 8494090, 8494102, 8494081, 8494082, 6481935, 8494084, 8494096, 8494089,
+  8494087, 6491913, 8494092, 6466314, 8494102, 8494090, 8494082, 8494097, 6469903, 8494092, 6479622, 6470914,
+  6470675, 8494089, 6482707, 6472710, 8494103, 8494107, 6502421, 6472970, 8494107, 8494089, 8494093, 8494094,
+  8494122, 8494096, 8494086, 6503189, 8494099, 8494100, 8494101, 6473750, 8494090, 8494104, 6471682, 8494101,
+  8494096, 8494090, 6469638, 8494084, 8494097, 8494082, 6473226, 8494084, 6483989, 6473994, 8494087, 8494087,
+  6476301, 6488580, 8494095, 8494122, 6467092, 6474261, 8494112, 6476564, 8494092, 8494089, 8494099, 8494094,
+  8494105, 6474774, 8494084, 8494085, 8494089, 8494100, 8494088, 8494083, 8494084, 8494085, 8494102, 8494085,
+  8494090, 6476815, 8494090, 6482189, 6518534, 6482447, 6488077, 6474511, 8494102, 6476051, 8494097, 6477843,
+  8494100, 8494101, 6475542, 8494082, 8494096, 8494097, 6477570, 6475270, 6479108, 8494082, 6479366, 6475786,
+  6486274, 8494086, 8494093, 8494081, 6487302, 8494096, 6523910, 8494096, 8494099, 6478100, 8494101, 8494102,
+  6480650, 6481429, 6482960, 6488322, 8494094, 6486799, 6486548, 6487558, 8494102, 6487059, 8494100, 8494090,
+  8494112, 8494090, 8494082, 8494094, 6484738, 8494096, 8494112, 6521616, 6489606, 6485780, 8494083, 8494084,
+  6489866, 8494094, 6504975, 8494086, 6531341, 8494090, 6487824, 6510355, 6493709, 6490371, 6492162, 6485525,
+  6519554, 8494087, 6496006, 6489364, 8494086, 8494094, 6493962, 8494082, 8494082, 6490895, 8494093, 6495238,
+  8494096, 6491411, 6491668, 8494099, 8494081, 8494103, 8494093, 8494093, 6495750, 8494095, 8494087, 8494082,
+  6498579, 6496266, 8494101, 8494093, 8494112, 8494090, 6498054, 8494086, 8494086, 8494099, 6492691, 6492948,
+  8494092, 8494102, 8494093, 6501378, 6492441, 8494085, 8494087, 6502662, 6500627, 6494741, 8494107, 8494103,
+  6502915, 8494093, 6536194, 6499099, 8494097, 6505224, 6497811, 6500866, 8494100, 6503700, 6506253, 6501638,
+  6505743, 6538765, 8494097, 6502154, 6503443, 6503956, 8494101, 8494102, 6507523, 8494096, 6510850, 8494096,
+  8494087, 6553872, 6511878, 8494090, 8494093, 8494104, 6508045, 8494084, 6509839, 6504454, 8494097, 8494088,
+  6509331, 8494092, 8494083, 6514963, 6511124, 6529538, 6510607, 8494088, 8494099, 8494086, 8494101, 6552335,
+  6511629, 8494090, 6508303, 6521090, 8494097, 8494101, 6512659, 6522886, 6511381, 6512150, 8494084, 6523658,
+  8494086, 8494087, 8494093, 8494089, 6513162, 6517517, 8494097, 8494094, 6516750, 6516495, 6524949, 8494099,
+  8494100, 6518035, 6519062, 6513685, 8494102, 8494085, 6518790, 8494086, 8494090, 8494085, 6572307, 8494087,
+  6514700, 8494082, 8494094, 6520079, 6521356, 6525190, 8494092, 6576148, 8494089, 6576646, 6575624, 6523155,
+  8494100, 8494101, 8494100, 8494082, 8494102, 8494083, 6525715, 6524422, 8494090, 8494082, 8494089, 8494087,
+  8494082, 8494086, 6522636, 6526221, 6526470, 8494093, 8494099, 8494086, 8494099, 6520340, 6524180, 6522390,
+  8494081, 8494095, 8494093, 8494084, 8494085, 6539778, 8494087, 6575892, 6579983, 8494090, 8494100, 8494092,
+  6528781, 8494099, 8494095, 8494081, 6528258, 6528514, 6529811, 8494082, 8494086, 6546434, 8494099, 8494100,
+  6526986, 6547718, 6553609, 6530573, 8494093, 6544394, 8494096, 8494096, 8494084, 8494096, 8494099, 8494096,
+  8494101, 8494081, 8494082, 6531843, 8494097, 6531589, 8494089, 8494100, 8494088, 8494102, 8494112, 8494099,
+  6532108, 6530829, 6532366, 6533391, 8494093, 8494097, 8494095, 6529043, 8494100, 6527765, 6532630, 8494100,
+  8494104, 8494081, 6533122, 8494083, 8494082, 8494087, 6534406, 8494089, 8494086, 8494096, 6533642, 8494089,
+  6548750, 8494095, 8494082, 8494095, 8494096, 8494082, 8494100, 8494099, 6528020, 8494101, 8494102, 8494089,
+  8494104, 8494082, 8494083, 6532868, 8494090, 8494086, 6533895, 8494099, 8494089, 6535178, 8494096, 8494082,
+  6536717, 6534670, 8494087, 8494082, 8494102, 8494099, 6539283, 6536966, 6538261, 8494102, 6539529, 6542090,
+  8494090, 8494082, 6542349, 8494084, 8494095, 6542854, 6541314, 8494093, 8494099, 8494095, 6544646, 8494101,
+  8494093, 6543630, 6543119, 8494083, 8494093, 8494082, 6577679, 8494100, 6540816, 8494102, 6580499, 6588949,
+  8494102, 6541837, 6543382, 6548239, 6545432, 6547473, 6574863, 8494099, 8494082, 8494094, 8494102, 6573076,
+  8494093, 8494105, 8494087, 8494089, 8494090, 6546946, 8494092, 8494086, 6577429, 6548486, 6588687, 6551050,
+  6549001, 6547210, 8494093, 6584084, 8494095, 6584842, 8494096, 6549776, 6552595, 8494107, 6551571, 6552066,
+  6581777, 6549270, 8494105, 8494100, 6560006, 6555138, 8494094, 8494090, 8494090, 6555398, 8494093, 8494099,
+  6549513, 8494096, 8494099, 8494100, 8494099, 8494099, 8494086, 6551312, 6556930, 8494122, 6556691, 6557698,
+  6555654, 8494082, 6608649, 6559494, 6557962, 8494097, 8494089, 6560522, 6588436, 8494101, 6554640, 6558225,
+  6564867, 6564624, 8494099, 6553365, 6565651, 8494102, 8494089, 6557206, 8494082, 8494092, 8494093, 8494094,
+  6558735, 8494083, 8494112, 6606854, 8494081, 6561300, 8494083, 6562070, 6566922, 6609420, 8494084, 6564365,
+  6565902, 6567695, 8494085, 8494122, 8494083, 6567955, 8494100, 8494093, 8494094, 6567170, 8494093, 8494094,
+  6566671, 8494086, 8494100, 8494082, 8494086, 6569482, 6567441, 6598918, 6568467, 8494100, 6566402, 6570512,
+  6569988, 8494123, 6569734, 8494093, 8494086, 6565398, 8494092, 6571010, 6607106, 8494100, 6602773, 6574342,
+  8494096, 6572817, 8494089, 6571786, 6610186, 6574101, 6572038, 8494100, 8494101, 8494096, 6576906, 8494096,
+  6575379, 6577922, 6577166, 6578191, 6611466, 8494086, 8494095, 8494100, 8494085, 8494090, 8494099, 6578690,
+  6614801, 6582030, 6579205, 6579462, 8494087, 8494088, 6602511, 6579722, 6582293, 8494092, 8494093, 8494100,
+  6581519, 8494096, 6600717, 8494093, 6607375, 6582548, 6583317, 8494112, 8494085, 8494100, 8494085, 8494102,
+  6583835, 6585858, 8494083, 8494084, 8494085, 6583046, 6578439, 6585352, 8494095, 8494083, 8494095, 6588172,
+  8494101, 8494094, 6587919, 8494096, 8494097, 8494082, 8494099, 8494084, 6589973, 6587398, 8494100, 6617877,
+  8494089, 8494090, 8494107, 8494081, 6589186, 6604290, 8494099, 8494085, 6589702, 6606342, 8494099, 8494082,
+  6590986, 6593026, 8494092, 6595341, 6593797, 6592262, 6592784, 8494096, 6610701, 6591754, 6591252, 8494089,
+  8494086, 6594050, 6611219, 8494096, 8494100, 6598150, 8494094, 6596884, 6597909, 6597386, 8494112, 8494112,
+  6598413, 8494082, 8494085, 8494096, 6619906, 8494086, 6599699, 6599188, 8494086, 6596630, 8494090, 6601496,
+  8494093, 8494083, 8494085, 8494085, 8494090, 8494087, 8494090, 8494112, 8494090, 8494086, 8494092, 6608143,
+  8494094, 6599951, 8494107, 8494081, 8494100, 6603283, 8494123, 8494096, 8494102, 8494087, 8494112, 8494090,
+  6601738, 8494086, 8494083, 8494093, 6607887, 6605583, 6610459, 8494097, 6604563, 6606099, 8494100, 8494092,
+  6608909, 8494082, 8494095, 8494092, 8494097, 8494081, 6610946, 8494100, 8494089, 8494088, 8494085, 6626575,
+  6611720, 8494092, 8494089, 6630924, 8494105, 8494099, 8494081, 8494100, 6614031, 8494084, 8494090, 8494086,
+  6613268, 8494088, 6612763, 8494102, 8494107, 6612994, 6612226, 8494106, 8494095, 6613509, 8494087, 6612482,
+  8494099, 8494093, 8494090, 8494086, 8494096, 8494099, 6627345, 8494093, 6611984, 6614274, 8494093, 8494100,
+  6617621, 8494086, 8494083, 8494101, 8494089, 6615050, 8494101, 8494107, 8494082, 6628614, 8494082, 6630409,
+  6628358, 8494093, 6614543, 8494086, 6615573, 8494102, 8494082, 8494090, 8494101, 8494102, 6618125, 8494101,
+  6615311, 8494097, 8494090, 8494112, 6616083, 8494087, 8494088, 8494089, 6618640, 8494093, 8494106, 8494083,
+  8494081, 8494095, 8494102, 8494084, 8494085, 6618886, 8494083, 8494088, 8494086, 6618378, 8494088, 8494088,
+  8494112, 8494094, 6619151, 8494093, 8494101, 6622223, 8494099, 6617108, 8494085, 8494086, 8494093, 6624021,
+  8494101, 8494103, 6623235, 8494084, 8494085, 8494083, 8494085, 8494088, 8494087, 8494088, 8494091, 8494100,
+  8494101, 8494095, 8494093, 8494094, 8494092, 8494086, 8494097, 6621204, 6623509, 8494100, 6620162, 8494087,
+  8494103, 8494086, 6626310, 8494083, 8494084, 8494089, 8494090, 8494100, 6654992, 6652177, 8494090, 6655763,
+  8494096, 6625549, 6622990, 6626063, 8494101, 8494097, 8494102, 6626835, 6625806, 6625301, 6631187, 8494097,
+  6632981, 8494102, 8494100, 8494089, 8494112, 8494099, 8494104, 6627850, 8494094, 6628111, 8494090, 8494086,
+  8494094, 6627091, 8494122, 8494123, 6631686, 6628884, 8494084, 8494089, 6670082, 8494104, 8494083, 8494084,
+  6674950, 6689033, 8494096, 6638093, 6689804, 8494099, 8494100, 8494086, 8494093, 8494099, 8494092, 8494094,
+  6672143, 8494092, 8494099, 8494100, 6629890, 6633731, 6673685, 6631941, 6632710, 8494087, 8494088, 8494089,
+  8494090, 8494107, 8494092, 6635789, 6637314, 8494082, 6682912, 8494081, 6635270, 8494099, 8494100, 8494101,
+  6625030, 6727178, 8494104, 6636297, 8494106, 8494107, 8494092, 8494081, 6634498, 8494099, 8494112, 6635541,
+  6633222, 8494087, 6681103, 8494089, 6635018, 6727693, 6682131, 8494089, 6684949, 8494085, 8494096, 8494097,
+  6637574, 6636051, 8494088, 8494101, 8494081, 8494102, 8494100, 6639373, 8494094, 8494095, 8494096, 6687494,
+  8494093, 8494088, 8494086, 8494090, 6639629, 8494094, 8494095, 8494096, 8494092, 8494093, 8494100, 6725122,
+  8494101, 6683394, 6724623, 6640915, 6737411, 6640405, 6638358, 8494100, 8494082, 6680586, 8494083, 8494107,
+  6674434, 8494081, 6642434, 8494083, 6676486, 8494085, 6639878, 8494102, 6670858, 8494122, 6642698, 8494087,
+  6644236, 8494099, 6645006, 8494123, 8494094, 6645521, 8494102, 8494095, 6643732, 6645781, 8494102, 6642178,
+  6683156, 6723842, 8494106, 6645254, 8494123, 8494122, 8494123, 8494090, 8494112, 8494090, 8494089, 6648078,
+  8494095, 8494083, 8494086, 8494096, 8494122, 6647316, 6643989, 6647554, 6648323, 6768911, 6650117, 6646278,
+  8494087, 6651400, 8494100, 6648842, 6731796, 6652940, 8494093, 6651662, 6653967, 6652432, 8494097, 8494102,
+  8494099, 6655252, 6654485, 8494102, 6765844, 8494104, 6777871, 8494082, 6655515, 8494084, 8494083, 6656006,
+  8494087, 8494081, 8494082, 6657290, 6658308, 8494092, 8494083, 6737935, 6728461, 6656784, 8494081, 6660354,
+  6734356, 6735381, 8494101, 6661894, 8494101, 6652689, 8494095, 6657802, 6654747, 6661397, 8494099, 8494094,
+  8494082, 6661136, 6658074, 8494081, 8494099, 6662915, 6661653, 8494099, 6662406, 6657543, 8494088, 8494093,
+  6660123, 6723330, 8494099, 8494085, 6664462, 6687251, 6685204, 8494097, 6721289, 8494099, 6666516, 6665237,
+  8494083, 8494084, 6667525, 6672642, 6771205, 6783753, 6723091, 6673926, 6784524, 6668292, 8494093, 6666246,
+  6665999, 6727426, 6776079, 6670602, 6668051, 8494096, 6668813, 6664982, 6671887, 6677766, 6669333, 8494102,
+  6671635, 8494090, 8494094, 8494095, 6676749, 8494094, 8494081, 8494086, 6767636, 8494102, 8494099, 6673428,
+  6681365, 8494084, 8494086, 8494104, 8494087, 8494081, 6730509, 8494112, 8494095, 8494092, 8494093, 6675470,
+  6675983, 8494093, 6680842, 8494099, 6680083, 6681613, 8494094, 6682383, 6681872, 6771727, 8494085, 6682643,
+  6679572, 6775571, 8494100, 8494086, 6689543, 8494105, 6684685, 8494094, 8494081, 8494082, 8494093, 8494085,
+  8494085, 8494096, 6686997, 8494089, 6690050, 6684426, 8494092, 8494087, 6686470, 6729743, 8494095, 8494097,
+  8494090, 6730771, 6728724, 8494093, 6736130, 8494102, 6688016, 8494081, 6742022, 6690307, 8494087, 8494085,
+  6685702, 6691079, 6691336, 8494090, 8494093, 6791955, 6794773, 6692877, 6688782, 6695183, 8494100, 8494081,
+  6686210, 8494083, 6696980, 6692117, 6700294, 8494087, 6702854, 6757898, 6696202, 8494123, 6704650, 6703117,
+  6789908, 6760720, 8494096, 8494096, 6707216, 8494097, 8494100, 8494101, 8494102, 8494081, 8494102, 8494083,
+  6725634, 6693893, 6695430, 8494082, 8494082, 6755616, 6700042, 8494086, 6729226, 8494092, 6792450, 8494090,
+  8494086, 6698001, 8494092, 6740489, 6703380, 8494096, 8494102, 8494081, 6703874, 6740226, 6737680, 6704389,
+  6695686, 8494087, 6705160, 8494089, 8494090, 6744586, 8494112, 8494093, 8494094, 6706959, 8494095, 6744848,
+  8494089, 6694931, 6706452, 6709269, 8494122, 8494123, 8494081, 8494082, 6710275, 6707483, 8494085, 6711558,
+  6713351, 6715144, 6699529, 8494112, 8494094, 6716428, 6716941, 8494094, 6717199, 6712592, 8494082, 8494083,
+  6718739, 6720532, 6720277, 8494086, 8494088, 6722328, 8494081, 6708226, 6709019, 6720772, 8494082, 6721030,
+  6799881, 8494097, 8494086, 8494099, 6732034, 8494090, 8494101, 8494093, 6733574, 6722832, 6719505, 8494122,
+  6732810, 6722580, 6724117, 8494102, 6722054, 8494102, 8494088, 6802704, 6728194, 6728963, 8494084, 8494093,
+  6733078, 6724879, 6729986, 8494096, 8494082, 8494099, 6729478, 6731021, 8494102, 6727951, 6731530, 8494081,
+  8494082, 6734598, 6830093, 6732309, 6732560, 8494090, 8494088, 6764817, 8494099, 6733355, 8494102, 6769173,
+  6735889, 8494081, 8494082, 8494083, 6735637, 8494102, 8494087, 8494087, 6807300, 8494090, 6733834, 8494087,
+  8494093, 8494095, 8494093, 8494112, 6789647, 8494099, 6742535, 8494099, 8494101, 6738698, 8494101, 8494082,
+  6742797, 6793734, 6741263, 6742278, 6743047, 6830604, 6744083, 6743572, 6746882, 8494102, 8494082, 6792720,
+  6749702, 8494096, 6744326, 8494099, 8494099, 8494100, 6745109, 8494091, 8494094, 8494093, 8494093, 8494097,
+  8494095, 8494104, 6749204, 8494099, 8494099, 8494112, 8494084, 6749445, 6747910, 6746631, 6750728, 8494089,
+  6746378, 8494091, 6748940, 8494093, 6750466, 6751247, 6753028, 6755074, 8494098, 6835215, 6753300, 6751765,
+  6752778, 8494103, 6752268, 8494122, 6751502, 6838805, 6754576, 8494097, 6755843, 8494099, 8494100, 6756629,
+  8494099, 8494100, 6758165, 8494102, 6839304, 8494092, 6756109, 8494094, 8494087, 6757634, 8494099, 8494085,
+  6758675, 6756372, 6758925, 6759190, 6756879, 6760202, 8494083, 8494102, 6757395, 8494095, 8494101, 8494096,
+  8494086, 8494087, 8494093, 8494101, 8494093, 8494102, 8494095, 8494093, 6762246, 8494094, 6761491, 6761993,
+  8494082, 8494102, 8494099, 8494101, 6763526, 8494086, 8494096, 8494097, 6762762, 6779402, 8494083, 6764565,
+  6785037, 8494082, 6765072, 8494088, 8494082, 6765331, 8494084, 8494100, 6764054, 8494083, 6767887, 6831878,
+  8494102, 8494106, 8494099, 6768404, 8494097, 6768150, 8494083, 8494097, 8494085, 8494102, 8494090, 8494097,
+  8494099, 6805779, 8494107, 8494105, 6770701, 6767374, 6768655, 8494112, 6769937, 8494089, 6770451, 6769428,
+  6770197, 8494087, 8494083, 6829839, 6769674, 8494102, 8494083, 6827795, 6771461, 6774287, 8494096, 6773000,
+  6829071, 6772755, 6770964, 6771989, 6775309, 8494100, 6777615, 6794243, 6790933, 6794006, 6778387, 6773780,
+  6774037, 6773270, 8494087, 6828038, 8494094, 6779914, 8494094, 8494090, 8494107, 6780174, 6780431, 6797075,
+  8494097, 8494100, 6780691, 8494100, 6781717, 6779670, 8494085, 8494091, 8494105, 8494093, 8494089, 6799106,
+  6777360, 8494086, 6776845, 6782227, 8494100, 6861331, 8494097, 6800394, 8494099, 8494081, 6785794, 8494083,
+  6787074, 6801168, 6782470, 8494085, 8494090, 6838278, 8494085, 8494102, 6803970, 6839562, 8494092, 8494095,
+  8494086, 8494095, 8494090, 8494089, 8494100, 8494101, 8494100, 6787861, 8494099, 6785282, 6804496, 8494084,
+  8494106, 6784774, 8494089, 8494090, 6802454, 8494092, 6836495, 8494112, 6864654, 8494083, 8494099, 8494096,
+  8494101, 6789396, 6790677, 6788374, 6786581, 6788610, 6822146, 8494086, 8494107, 6788870, 6823430, 6823697,
+  6788105, 6818579, 6816778, 6840329, 8494097, 8494096, 8494100, 8494087, 6824464, 8494095, 6787347, 6789140,
+  6793493, 8494102, 8494123, 6795784, 6872842, 8494090, 8494086, 6866950, 6795021, 8494101, 8494090, 8494112,
+  6796305, 6843142, 6792211, 8494100, 6816016, 6796035, 6795543, 8494085, 8494093, 6858516, 6815510, 6820139,
+  8494081, 6840070, 6823942, 8494093, 6794510, 6798863, 6817034, 6797571, 8494089, 6798099, 8494086, 8494087,
+  8494096, 6826001, 6798346, 6843924, 8494082, 6826517, 6834451, 6801423, 6803206, 6799377, 8494107, 6802195,
+  8494090, 6802965, 6882054, 8494093, 6806786, 6798617, 6801936, 8494099, 6807814, 6803731, 6834690, 8494089,
+  6810122, 8494093, 8494086, 6835471, 8494106, 8494089, 6807568, 8494089, 8494100, 6808083, 6844428, 8494107,
+  6807062, 8494084, 8494085, 6907149, 6809091, 6810372, 8494085, 8494086, 8494087, 8494092, 8494112, 6819086,
+  6818319, 6805004, 6814221, 6813198, 6814479, 8494100, 8494092, 8494093, 8494099, 8494123, 6810645, 6814998,
+  8494086, 8494099, 6885894, 8494089, 6813450, 6860047, 8494082, 6815245, 6812174, 6817295, 8494096, 8494087,
+  6858262, 6819859, 6815764, 6827534, 6828815, 8494087, 8494097, 6817561, 6824211, 8494081, 6828309, 8494093,
+  6828564, 6831125, 8494085, 6910228, 8494087, 8494088, 8494090, 8494090, 8494090, 6835976, 8494093, 8494090,
+  6911753, 6919955, 6833421, 8494097, 8494100, 6832660, 6832404, 8494101, 6834195, 8494104, 8494082, 8494095,
+  8494107, 6832901, 6831366, 8494087, 6833160, 8494084, 6830858, 8494086, 6830348, 8494093, 8494094, 8494095,
+  8494097, 8494082, 6834946, 8494099, 6833940, 8494101, 6835718, 8494085, 8494104, 8494089, 6838543, 8494086,
+  8494097, 8494094, 6841619, 6837268, 8494096, 6837775, 8494099, 8494099, 6833684, 8494099, 8494081, 8494082,
+  8494081, 6844692, 8494101, 8494081, 6874118, 8494086, 8494084, 8494095, 8494086, 8494108, 8494086, 8494099,
+  8494093, 8494096, 8494102, 8494093, 8494097, 8494085, 6840838, 8494084, 8494096, 8494097, 6841354, 8494099,
+  6845961, 8494093, 8494094, 8494092, 6842128, 8494082, 8494112, 8494099, 8494100, 8494086, 8494087, 6907919,
+  8494099, 8494082, 6872085, 6875913, 6906900, 6844934, 8494092, 8494088, 8494112, 6845194, 8494099, 8494082,
+  6842389, 8494096, 8494095, 8494086, 6923535, 8494085, 8494099, 8494090, 8494083, 8494092, 8494081, 6846978,
+  6845699, 8494101, 8494085, 6843398, 8494101, 6876162, 8494101, 6847242, 6846722, 8494101, 6848781, 8494082,
+  6850054, 8494096, 8494100, 8494086, 8494093, 6849556, 6849301, 6886154, 6852366, 8494095, 8494099, 6850833,
+  8494107, 6915586, 8494097, 6852885, 8494081, 8494082, 8494083, 8494084, 6853381, 6849798, 8494081, 6853896,
+  8494089, 8494090, 8494085, 6852108, 8494093, 8494101, 6918931, 8494096, 8494097, 8494102, 8494086, 6854420,
+  6854165, 8494093, 8494097, 8494104, 8494099, 6917890, 8494107, 8494086, 8494081, 8494082, 8494083, 8494112,
+  8494085, 6854662, 8494094, 6854920, 8494082, 6850570, 8494084, 8494092, 6912788, 6855950, 8494102, 6853136,
+  8494090, 8494102, 8494099, 8494100, 8494101, 8494102, 6852610, 8494097, 8494082, 6912518, 6856710, 6851605,
+  6915334, 8494089, 8494090, 8494086, 8494106, 8494093, 8494094, 8494096, 6856208, 8494081, 6916624, 8494099,
+  8494084, 6857237, 8494086, 6859783, 6857480, 8494106, 8494101, 6859547, 8494084, 8494082, 8494094, 8494083,
+  8494084, 8494086, 6925577, 6858771, 6862356, 8494093, 6904334, 8494095, 6937621, 8494093, 8494094, 8494096,
+  8494108, 6942212, 8494101, 8494099, 8494081, 6861570, 8494083, 8494084, 8494085, 6866182, 8494087, 8494088,
+  8494089, 6868746, 8494100, 8494092, 6865421, 6867726, 6871311, 6868240, 8494097, 8494098, 6874899, 6871828,
+  6871573, 6860822, 8494103, 6875160, 6873098, 6955266, 8494107, 6876685, 6877698, 6878991, 6959126, 6859040,
+  6878726, 6881299, 8494100, 8494101, 6876426, 6927631, 6955778, 8494093, 8494101, 6860330, 6903554, 8494101,
+  8494083, 6880787, 8494100, 8494101, 8494082, 8494089, 6905610, 8494081, 6920710, 6996496, 8494084, 6883845,
+  7020041, 6881543, 8494088, 8494095, 8494083, 6924308, 6905366, 6883085, 8494094, 6885391, 8494106, 8494107,
+  8494122, 6881835, 8494100, 6879765, 8494081, 6884610, 8494083, 8494083, 8494090, 6889990, 6884871, 8494100,
+  7009045, 6883594, 8494082, 8494082, 8494093, 8494093, 8494086, 6887440, 8494081, 6891266, 8494083, 6882580,
+  6889477, 6890246, 8494087, 6922775, 8494104, 6889738, 8494107, 8494092, 6922260, 8494097, 8494090, 6890512,
+  7025171, 7018248, 8494089, 6895124, 6897685, 8494102, 8494081, 6896642, 6891523, 7011093, 6892315, 6899462,
+  6899207, 6893832, 6886409, 6894602, 6919181, 8494092, 8494095, 6898702, 6902031, 6899728, 8494112, 8494100,
+  8494081, 6905108, 8494086, 6904086, 8494103, 8494081, 8494082, 8494086, 8494107, 6924557, 6902790, 6923791,
+  6908429, 6897440, 8494095, 8494099, 8494092, 8494081, 8494082, 6910996, 8494099, 8494082, 6905862, 6902570,
+  6906388, 6906645, 8494090, 8494086, 8494095, 8494101, 8494091, 8494084, 8494096, 8494097, 8494087, 8494096,
+  6907395, 6906133, 8494088, 8494085, 8494095, 8494094, 6912009, 8494107, 8494097, 8494082, 6910483, 7022342,
+  8494095, 6910726, 8494085, 8494104, 6909203, 6913794, 8494089, 8494086, 8494087, 6912262, 8494095, 8494099,
+  8494093, 6911242, 8494099, 6908948, 8494099, 8494100, 8494095, 8494096, 8494099, 8494100, 8494099, 8494100,
+  8494101, 8494102, 6909955, 8494108, 6919693, 8494086, 8494095, 7026189, 8494097, 8494090, 8494099, 8494112,
+  8494093, 8494082, 8494086, 8494096, 8494085, 6945289, 6913287, 6915848, 8494089, 6914314, 8494099, 7024905,
+  8494096, 7055362, 6916367, 8494099, 8494083, 8494098, 8494085, 6915092, 8494101, 6913026, 8494103, 6916100,
+  8494102, 8494086, 6916877, 8494094, 6921231, 6914570, 8494097, 8494081, 8494099, 8494100, 6920469, 8494096,
+  8494097, 8494087, 6962190, 8494100, 8494101, 8494102, 8494092, 8494099, 8494101, 8494095, 7058451, 8494089,
+  8494082, 8494099, 6922516, 8494093, 8494094, 8494095, 7057430, 6923025, 8494090, 8494107, 8494100, 7055888,
+  8494101, 8494081, 8494104, 6923267, 8494084, 8494099, 8494086, 8494087, 8494081, 6920962, 8494082, 8494099,
+  8494085, 6924806, 8494086, 7056659, 8494095, 8494090, 6928138, 6939908, 6926605, 8494081, 7055626, 8494096,
+  8494104, 8494084, 8494085, 6925062, 6940685, 6926344, 8494089, 6927114, 8494092, 8494106, 8494094, 6973446,
+  6941973, 8494096, 8494097, 8494090, 6928416, 8494101, 6927381, 8494102, 8494082, 8494096, 6928644, 8494107,
+  8494082, 8494083, 8494088, 8494102, 7057670, 8494088, 8494092, 6930189, 8494094, 6928911, 8494081, 8494097,
+  8494087, 6930707, 7064326, 6931989, 8494102, 8494088, 8494082, 6931466, 7095828, 8494107, 8494108, 8494087,
+  6925839, 8494102, 8494097, 6929158, 6934547, 8494101, 8494101, 8494082, 8494082, 8494092, 8494093, 6931206,
+  8494107, 8494096, 8494097, 8494090, 8494090, 8494100, 8494085, 8494086, 8494093, 8494088, 8494084, 8494090,
+  8494086, 8494092, 8494093, 8494102, 6932239, 8494083, 8494097, 8494085, 6936083, 8494100, 6934805, 8494081,
+  6937090, 8494112, 8494092, 6939149, 6937862, 6930447, 8494093, 8494097, 6940938, 6939667, 7062281, 8494101,
+  7133199, 7061516, 6941712, 7135759, 6944771, 6942724, 7127574, 6957063, 8494102, 6941448, 8494090, 8494102,
+  8494091, 8494093, 6946317, 6942990, 6948111, 8494097, 6944032, 6958099, 6950163, 8494100, 6945045, 6949398,
+  6949635, 8494084, 7129614, 8494086, 8494122, 6945579, 6951177, 6948618, 8494094, 8494095, 6943245, 7132692,
+  6952463, 7062035, 6951441, 8494101, 6954259, 6950420, 6954005, 6952716, 6953741, 6952974, 6956047, 6957577,
+  8494090, 8494081, 7133455, 6953492, 6959874, 7133972, 6955536, 7096847, 6958854, 6958611, 7008772, 7107091,
+  8494090, 8494093, 8494083, 8494089, 8494085, 8494097, 8494096, 8494088, 8494100, 6961939, 7136773, 8494082,
+  6954774, 7007251, 7085826, 7005973, 8494097, 7140103, 8494099, 7130122, 7000853, 6998038, 8494112, 8494081,
+  8494082, 6964995, 8494084, 6960389, 8494096, 6962951, 6964488, 8494089, 6956842, 8494123, 6961164, 6969101,
+  6965518, 6972431, 8494099, 6966289, 7135247, 6976275, 6969876, 6974229, 6978838, 6963991, 8494101, 8494105,
+  8494081, 6965250, 8494102, 6968580, 6966021, 8494086, 8494081, 6967048, 8494089, 6979082, 8494081, 7115270,
+  6981645, 6984206, 6985743, 8494086, 6968849, 8494095, 6987795, 6988052, 6984725, 6990358, 8494103, 8494104,
+  6975001, 8494082, 8494083, 6975748, 8494099, 6992646, 8494087, 6974728, 8494100, 8494101, 7191042, 8494092,
+  8494093, 6986254, 6991887, 8494096, 6993681, 8494086, 6983955, 6979348, 6996245, 8494081, 8494103, 6985475,
+  6979844, 6987269, 7126548, 6990599, 8494097, 7196934, 7135494, 7127321, 8494092, 6993421, 6992910, 6994703,
+  8494096, 6994193, 8494107, 6998291, 6992148, 6997269, 8494102, 6999300, 8494104, 7003394, 7137046, 8494107,
+  8494108, 7007750, 8494081, 8494087, 8494093, 7009290, 8494095, 7035142, 8494099, 8494082, 8494099, 7011600,
+  8494101, 7019014, 8494087, 7038734, 8494107, 7014934, 7035409, 8494092, 8494093, 8494100, 8494101, 8494096,
+  7197715, 8494100, 7134217, 6998560, 8494101, 7138316, 8494083, 6997764, 8494085, 8494086, 8494087, 7000584,
+  8494089, 6994986, 8494123, 8494092, 8494089, 6998798, 7016975, 8494081, 7105538, 8494082, 7019539, 8494100,
+  8494101, 7019270, 7019783, 8494086, 8494081, 7010826, 7195664, 8494093, 7204354, 8494094, 8494093, 7004944,
+  8494097, 8494090, 7203341, 7023124, 8494095, 8494100, 8494101, 7012376, 7075345, 8494122, 8494081, 8494082,
+  8494101, 7145226, 7022853, 8494086, 8494087, 7023880, 8494095, 8494090, 8494081, 8494123, 7203081, 8494094,
+  7115522, 7025670, 8494087, 8494088, 7117574, 7016212, 8494101, 8494090, 7115018, 7017240, 8494093, 7180034,
+  7025423, 7177737, 8494099, 7181830, 8494099, 8494100, 8494101, 8494102, 7174928, 8494104, 8494081, 7024386,
+  8494083, 8494096, 8494085, 7025926, 8494087, 8494088, 8494089, 7021322, 8494083, 8494092, 7027213, 8494094,
+  8494095, 7192835, 8494089, 7204883, 8494099, 7023380, 8494101, 8494082, 8494095, 8494104, 8494085, 7024646,
+  8494107, 8494095, 8494101, 8494090, 8494082, 8494090, 7203850, 8494094, 7027974, 7026960, 8494088, 8494096,
+  8494099, 8494100, 8494101, 8494093, 8494092, 8494093, 8494096, 7027471, 7202818, 8494082, 7031060, 7032083,
+  8494100, 7027718, 7206669, 7192608, 7128834, 7204102, 8494087, 8494092, 8494081, 7031554, 7033603, 8494089,
+  8494085, 7030278, 7029011, 7033864, 7029269, 7033098, 7126800, 8494099, 7036941, 7035662, 8494107, 7033360,
+  7204628, 8494090, 8494081, 7034644, 7037461, 8494102, 7039746, 8494083, 8494084, 7038981, 7035910, 8494087,
+  7039496, 7037193, 8494090, 8494091, 7038220, 8494093, 8494094, 7041295, 8494096, 8494097, 7040774, 8494087,
+  7042324, 7043093, 8494082, 7215379, 7042840, 8494093, 8494082, 7045147, 7043856, 7044625, 8494094, 7214600,
+  8494112, 7048450, 7046915, 7044100, 8494085, 7045638, 7217935, 8494088, 8494089, 8494090, 8494089, 7048972,
+  8494093, 7040526, 8494085, 7046160, 7098370, 7198216, 8494084, 8494101, 7053077, 8494102, 8494081, 8494082,
+  7200783, 8494084, 7044379, 8494086, 8494081, 7052546, 8494083, 7104017, 8494081, 7054854, 7105300, 7106581,
+  8494102, 8494101, 8494097, 8494089, 8494093, 7049236, 7051029, 7050256, 7218182, 8494095, 8494099, 7054356,
+  8494101, 7057155, 7053572, 8494085, 7191574, 7059207, 7055112, 8494085, 7060738, 8494086, 8494092, 8494082,
+  8494094, 8494099, 7179020, 8494086, 7059466, 7180303, 7063828, 8494090, 8494102, 8494099, 8494093, 7211796,
+  8494093, 8494099, 8494084, 8494085, 8494099, 8494085, 8494088, 8494102, 7213832, 8494104, 8494092, 8494093,
+  8494094, 8494095, 8494112, 7214095, 8494081, 8494099, 8494100, 8494084, 8494087, 8494089, 7060231, 7134474,
+  8494122, 8494106, 8494087, 8494092, 7065869, 8494094, 7068175, 8494112, 7136275, 8494094, 7080463, 7070740,
+  8494097, 7216136, 7089939, 8494104, 8494089, 7215882, 8494107, 8494081, 7068418, 8494083, 8494101, 8494085,
+  7070982, 7062535, 8494088, 8494092, 7068938, 8494093, 8494092, 7074829, 8494107, 8494095, 7071760, 8494097,
+  7219722, 8494101, 7067156, 7072533, 8494081, 7069442, 8494083, 8494085, 8494088, 7073030, 8494088, 8494101,
+  8494095, 7074570, 8494112, 7112717, 8494094, 8494094, 8494090, 7068688, 7077137, 7114003, 8494086, 8494100,
+  8494122, 7073302, 8494081, 7076354, 8494108, 8494094, 7078917, 7081734, 8494087, 7079432, 8494082, 7081226,
+  8494102, 8494092, 7093254, 7117826, 8494095, 7075856, 8494090, 7118086, 8494088, 7084308, 7086613, 7117322,
+  7121154, 8494097, 7118605, 8494106, 8494095, 7090709, 8494094, 8494099, 7123219, 8494112, 8494102, 8494107,
+  7125262, 8494089, 8494096, 8494097, 8494092, 8494081, 8494100, 8494122, 8494081, 7091202, 7088899, 8494084,
+  7085573, 7095046, 7081479, 7096328, 7096585, 7100426, 7258125, 7077900, 7085069, 8494094, 7101455, 7088656,
+  8494097, 8494081, 7102483, 7102996, 7087893, 7087126, 8494103, 7080984, 8494088, 8494106, 7104539, 8494089,
+  8494092, 7109133, 7218444, 7108879, 8494100, 8494097, 8494081, 8494082, 8494083, 8494082, 8494102, 8494082,
+  8494087, 8494122, 8494082, 7098890, 7226378, 8494092, 8494083, 7110670, 7111183, 8494096, 8494090, 8494081,
+  7111699, 7101716, 7107332, 8494100, 7109894, 7130626, 7232518, 8494102, 7218690, 7132166, 7245075, 8494093,
+  8494094, 7106831, 8494083, 7112196, 7219210, 8494099, 8494087, 8494096, 8494089, 7234069, 8494099, 8494086,
+  7113741, 8494123, 7143689, 7257097, 8494102, 8494083, 7257868, 8494100, 7110165, 8494102, 8494103, 7111427,
+  8494099, 8494100, 8494112, 7116807, 8494088, 8494089, 8494090, 8494097, 7120130, 7117069, 8494095, 7112975,
+  7121926, 8494112, 8494088, 7118355, 7114260, 8494107, 8494102, 7119885, 7259910, 7218950, 8494096, 8494094,
+  8494108, 8494081, 7124226, 8494101, 8494102, 8494085, 7123718, 8494087, 7126024, 8494089, 7123466, 8494091,
+  7127052, 8494102, 8494100, 8494095, 7122192, 7129348, 8494107, 7130374, 7131924, 8494101, 7124758, 8494103,
+  8494122, 8494092, 8494093, 7225610, 8494085, 8494089, 8494097, 8494093, 8494099, 8494100, 7131669, 8494102,
+  7129858, 8494094, 7241999, 7221782, 8494086, 8494082, 8494102, 8494089, 8494090, 8494086, 8494083, 7136514,
+  8494086, 7224608, 8494091, 8494090, 8494093, 8494088, 8494082, 7137290, 8494102, 8494092, 8494095, 8494100,
+  8494101, 8494096, 7138562, 8494081, 7140354, 8494085, 7139846, 7138070, 7265801, 7141639, 7140874, 7141129,
+  8494100, 7220501, 7173891, 7172612, 8494099, 7195906, 8494096, 8494088, 8494104, 7200006, 8494094, 8494101,
+  8494081, 7172366, 8494106, 8494084, 7142405, 7143430, 7143943, 7144968, 7202577, 7145994, 7243281, 8494092,
+  7196437, 8494086, 7248149, 7139600, 8494089, 7271430, 8494107, 8494100, 7147797, 8494102, 8494101, 8494104,
+  8494097, 8494112, 8494081, 8494100, 8494101, 7146500, 7148805, 7142688, 7149063, 8494088, 7148553, 8494090,
+  8494085, 7149324, 7150861, 8494089, 7152399, 8494122, 8494084, 8494092, 8494086, 7148052, 7261455, 7154198,
+  8494081, 7146242, 7145731, 7154692, 8494085, 8494108, 7154951, 8494088, 8494089, 7158538, 8494095, 8494122,
+  8494093, 8494094, 7160847, 8494100, 7161617, 8494107, 8494099, 7153684, 7162901, 7153174, 8494103, 8494108,
+  8494089, 8494090, 8494107, 8494083, 7156740, 8494085, 7166214, 8494096, 7166984, 7274759, 8494082, 7271945,
+  7161100, 8494086, 7237638, 7169295, 8494082, 7151889, 8494090, 8494081, 8494093, 8494083, 7156996, 8494103,
+  8494086, 8494105, 7242515, 7155483, 8494090, 8494095, 7159820, 7159565, 7171854, 7161359, 7252486, 7162385,
+  8494084, 7288080, 7163924, 8494099, 7163414, 8494082, 8494083, 8494084, 8494106, 7255825, 8494087, 8494086,
+  8494082, 7256085, 7212036, 8494092, 8494086, 7164686, 7163663, 8494085, 8494097, 8494084, 8494085, 7164436,
+  7168533, 8494088, 8494096, 8494104, 8494094, 8494095, 8494084, 8494081, 7172111, 8494081, 7223554, 8494089,
+  8494093, 8494100, 7166485, 7172886, 8494094, 7270149, 7225858, 8494097, 7226628, 8494108, 7169556, 8494101,
+  8494083, 7174148, 8494085, 7273231, 8494100, 7224341, 7173641, 8494099, 8494096, 8494097, 7175437, 7176206,
+  7175183, 8494101, 8494082, 7290899, 8494099, 8494100, 8494083, 8494102, 8494103, 8494086, 8494087, 8494094,
+  7176969, 7175690, 8494102, 7230214, 8494099, 7178766, 7179279, 8494090, 8494097, 7276821, 8494099, 7176724,
+  7181589, 7183111, 8494103, 7287554, 7178265, 7227924, 8494082, 8494093, 8494094, 7291657, 7184642, 8494097,
+  8494102, 7181075, 7185926, 7189762, 7179542, 8494089, 7186442, 7190790, 8494094, 7261711, 8494089, 7189002,
+  7182096, 8494099, 8494100, 7182611, 7226122, 7191312, 7182870, 7229197, 7189523, 7233807, 8494086, 7186966,
+  7303175, 7230739, 8494100, 8494106, 8494112, 8494083, 7193604, 8494085, 7281154, 7183904, 7194888, 8494089,
+  7286534, 7301652, 7195404, 8494093, 7196163, 7196687, 7264258, 8494097, 7190571, 7192083, 7267078, 7197194,
+  8494094, 7255311, 7198989, 7192334, 7197967, 8494096, 8494086, 7255573, 7200275, 7199508, 8494081, 8494086,
+  7205123, 7264533, 7265046, 8494086, 8494087, 8494088, 8494089, 7247362, 8494082, 8494092, 8494093, 7248390,
+  8494086, 8494096, 8494087, 7245578, 8494099, 7209236, 8494101, 7311625, 8494112, 8494104, 8494081, 8494082,
+  8494107, 8494100, 7207173, 7205638, 8494087, 7211016, 7252738, 7208970, 8494082, 8494093, 7254278, 8494094,
+  8494095, 8494096, 8494090, 7313418, 8494090, 7210260, 8494101, 7209986, 8494103, 8494084, 7320846, 7211526,
+  8494087, 8494088, 8494083, 7214346, 8494100, 8494084, 8494085, 7207950, 8494095, 7208464, 7212809, 7216394,
+  8494112, 8494089, 8494086, 8494102, 7216911, 7246086, 8494099, 8494100, 7217171, 8494100, 7217429, 8494081,
+  8494093, 8494112, 8494084, 8494082, 8494086, 8494090, 8494088, 8494086, 8494101, 7300610, 7325194, 8494090,
+  8494090, 7302662, 7228685, 7238413, 8494094, 7244815, 8494100, 8494093, 7260674, 7244563, 8494104, 8494101,
+  7261190, 8494107, 8494081, 8494082, 8494083, 7301910, 8494085, 7223046, 8494087, 8494088, 8494089, 7223306,
+  8494082, 8494099, 7263252, 8494083, 8494095, 8494096, 8494097, 8494085, 8494099, 8494100, 8494101, 8494102,
+  8494089, 8494104, 8494094, 7331087, 8494107, 7223811, 7222020, 7331603, 8494086, 8494112, 8494099, 7224073,
+  7222282, 7326231, 7259652, 7227394, 8494086, 7225359, 8494081, 7229702, 7258378, 7225107, 8494100, 7228938,
+  7224854, 8494086, 8494093, 8494094, 8494095, 7226896, 8494099, 8494101, 8494099, 7231508, 7227157, 8494102,
+  7328275, 8494104, 8494083, 8494081, 8494082, 8494082, 7330054, 8494085, 7232262, 8494112, 7236872, 7250182,
+  8494090, 8494094, 8494092, 7250954, 7325712, 8494086, 8494096, 8494084, 8494123, 8494096, 7232770, 7237379,
+  7330317, 8494085, 7238918, 8494102, 8494088, 7236123, 7234826, 8494100, 8494100, 7239181, 8494099, 7240463,
+  8494096, 8494112, 8494087, 7228179, 7239444, 8494101, 7242262, 8494123, 7237144, 8494083, 8494090, 8494107,
+  8494083, 7238148, 8494088, 8494082, 8494112, 8494097, 8494089, 8494099, 8494082, 8494092, 7239693, 8494094,
+  7241743, 7264002, 8494122, 7338246, 8494099, 8494100, 8494101, 8494102, 7248899, 8494082, 8494085, 8494102,
+  8494086, 8494108, 8494081, 8494086, 8494082, 8494092, 7266579, 8494100, 7247119, 7253254, 8494097, 7247882,
+  8494099, 7251978, 7246861, 8494102, 7243791, 8494083, 8494084, 7249168, 7249683, 7249428, 8494101, 8494086,
+  8494093, 7264782, 8494095, 7345411, 8494094, 8494095, 7263507, 8494097, 7265557, 8494099, 8494100, 8494112,
+  8494082, 8494082, 8494087, 8494082, 7256326, 7260166, 8494086, 8494086, 7253002, 7258890, 7248683, 8494090,
+  7347463, 8494093, 8494096, 7260432, 8494101, 7347725, 8494099, 8494100, 8494102, 7259414, 7261954, 8494102,
+  7354124, 7355155, 7262470, 8494093, 8494094, 8494095, 8494090, 8494093, 8494085, 8494083, 8494085, 8494085,
+  8494096, 7293971, 7294228, 8494101, 8494100, 8494123, 8494092, 7266061, 8494081, 7266319, 8494099, 8494097,
+  8494101, 7268883, 8494087, 7266837, 7267606, 7267338, 8494086, 7305474, 7272962, 7332102, 7269391, 7302918,
+  7270918, 7330826, 7271699, 7265300, 7272714, 8494081, 8494085, 7273731, 7338772, 7304976, 7307793, 7275537,
+  8494088, 8494093, 7303701, 8494104, 7274006, 8494093, 8494094, 8494095, 7307291, 8494097, 7342351, 7278099,
+  8494100, 8494101, 8494081, 7278338, 8494101, 7368974, 8494085, 7279110, 8494087, 8494088, 8494081, 7276042,
+  8494086, 8494084, 8494082, 7285766, 8494095, 7279376, 8494086, 7374857, 8494099, 7280660, 8494082, 7276310,
+  8494103, 8494083, 7341318, 8494085, 8494107, 8494100, 8494101, 8494095, 7281930, 8494104, 8494102, 8494099,
+  7277838, 7275279, 7328790, 7280898, 7351558, 7279891, 8494100, 7282694, 8494123, 7374349, 8494089, 8494087,
+  8494088, 8494095, 7279629, 8494084, 8494092, 8494096, 8494087, 7353621, 7278611, 7282964, 8494082, 8494092,
+  8494081, 8494094, 7284230, 8494096, 8494085, 7310086, 7283219, 7278868, 8494101, 8494082, 8494103, 7286287,
+  7280400, 7377940, 7312655, 7284499, 8494100, 7287317, 8494081, 7315220, 7344909, 7287812, 8494082, 8494086,
+  8494100, 7361045, 7286790, 8494090, 8494082, 8494092, 8494090, 8494082, 7343622, 8494082, 8494097, 7341830,
+  7340554, 7289094, 7290389, 8494099, 8494100, 7291914, 8494102, 8494106, 8494107, 7292931, 8494106, 8494096,
+  7373065, 7346697, 8494099, 8494102, 8494092, 7379989, 7288332, 7288845, 8494094, 7294479, 8494112, 8494097,
+  7319302, 7292179, 7294996, 7294741, 8494102, 7295495, 8494082, 8494088, 7295754, 8494085, 7316496, 7296013,
+  8494088, 7297807, 7295238, 8494097, 7316246, 7298579, 7297290, 7300117, 8494102, 7301389, 8494084, 7301125,
+  7300358, 8494101, 7306498, 7299603, 8494100, 7359241, 7307014, 8494082, 7365388, 7302159, 8494090, 7309318,
+  8494082, 7378695, 8494084, 8494090, 8494086, 8494088, 8494082, 7305747, 7309076, 7306256, 8494093, 8494083,
+  8494095, 8494089, 8494101, 8494087, 7308296, 8494104, 7329045, 7340309, 7381269, 8494084, 7310606, 7309583,
+  8494093, 8494112, 8494089, 7308819, 8494100, 8494081, 8494093, 8494083, 8494084, 7358733, 8494097, 8494093,
+  8494089, 8494086, 7311114, 8494102, 7359508, 7360277, 7315714, 7307535, 8494100, 8494097, 7315974, 7314195,
+  7312404, 8494089, 7317002, 7315458, 8494089, 8494105, 7372315, 7322118, 7311376, 8494087, 7317769, 7318026,
+  8494093, 8494087, 8494102, 7319821, 8494094, 7318287, 7345670, 8494097, 7319059, 8494099, 8494100, 7321110,
+  7320342, 8494085, 7376660, 8494095, 8494096, 8494089, 7326474, 7372039, 8494092, 7325965, 8494094, 7326735,
+  7327747, 7377421, 7324934, 7326995, 8494100, 8494101, 8494090, 8494103, 8494102, 8494105, 7378437, 8494094,
+  8494096, 7375368, 7324689, 8494086, 7329555, 8494100, 8494102, 7327234, 8494082, 7329284, 8494106, 7327494,
+  7332870, 7379732, 8494097, 8494089, 7336458, 8494092, 7373589, 7335170, 8494084, 8494100, 7328528, 7332358,
+  8494086, 8494099, 8494100, 8494090, 8494102, 7378963, 7335938, 8494090, 8494084, 8494096, 8494086, 8494093,
+  7380244, 7328032, 7331338, 7381773, 7338498, 7337987, 7380751, 8494085, 7339014, 7337735, 8494088, 8494100,
+  7334922, 7335701, 8494092, 7342857, 8494083, 8494095, 8494085, 7343373, 8494081, 8494085, 7340052, 7341077,
+  8494102, 7343123, 8494093, 8494082, 7366415, 7383309, 8494104, 8494086, 7343874, 8494099, 8494122, 8494090,
+  8494086, 8494081, 8494088, 8494100, 7345162, 8494096, 8494097, 7380487, 7344142, 8494101, 8494096, 8494102,
+  8494100, 7348738, 8494083, 8494101, 7350021, 7345926, 7386114, 8494089, 7375892, 8494090, 7386630, 8494082,
+  8494081, 8494094, 7352325, 8494082, 8494087, 7349256, 7385866, 8494100, 7350805, 8494082, 7377670, 7351044,
+  8494095, 7382794, 8494107, 8494095, 8494089, 8494082, 8494095, 8494082, 8494096, 7348998, 8494089, 7354374,
+  7348507, 8494086, 8494102, 7353108, 8494093, 8494102, 8494093, 8494096, 8494095, 8494096, 8494099, 7352084,
+  8494099, 7355668, 7354627, 8494095, 7352581, 8494086, 7356167, 7353352, 8494094, 8494095, 8494095, 8494092,
+  8494093, 8494086, 7357199, 8494082, 8494082, 8494101, 7359749, 7357972, 7354901, 7358216, 8494095, 8494090,
+  8494102, 7361548, 7358491, 8494082, 7362051, 8494094, 7361797, 7358982, 7360775, 7364104, 7369476, 7362826,
+  8494086, 7368204, 8494082, 8494097, 8494092, 7368453, 8494085, 8494101, 7365640, 8494100, 7368725, 8494097,
+  7367948, 8494081, 7369748, 7373327, 8494082, 7384084, 8494086, 8494085, 8494100, 8494101, 8494101, 7380994,
+  8494090, 8494093, 8494095, 7381510, 8494107, 8494095, 7387146, 8494122, 8494100, 7388681, 8494090, 7378197,
+  8494102, 8494096, 8494085, 8494082, 8494082, 8494100, 8494084, 7382538, 8494086, 8494088, 8494093, 8494085,
+  7382031, 8494092, 8494086, 8494084, 7383827, 8494081, 8494096, 8494097, 8494103, 8494123, 8494100, 7374101,
+  8494102, 8494094, 7386895, 8494101, 8494083, 7387402, 8494094, 8494082, 8494101, 8494102, 7385615, 8494085,
+  8494100, 8494101, 7388435, 8494090, 8494095, 8494099, 8494082, 8494086, 8494096, 8494095, 7386374, 8494099,
+  8494086, 8494093, 8494101, 7388169, 8494081, 8494100, 8494099, 8494092, 8494090, 8494099, 8494096, 8494087,
+  7389197, 7389971, 7389711, 7391507, 8494084, 8494086, 7391747, 8494081, 8494106, 8494083, 8494095, 8494100,
+  8494081, 8494082, 8494083, 8494096, 7390228, 8494086, 8494087, 7387656, 8494094, 8494101, 8494096, 7390988,
+  8494083, 7390470, 7390729, 7388949, 8494087, 8494088, 8494099, 8494100, 7389461, 8494087, 8494102, 8494082,
+  8494095, 7391238, 7399171, 8494099, 8494099, 7415315, 8494101, 8494087, 8494093, 7413782, 8494099, 8494096,
+  8494082, 7392013, 7393282, 7395087, 8494097, 8494085, 7393798, 8494089, 7392788, 7395605, 7394058, 8494095,
+  8494099, 7398413, 8494094, 7412233, 8494096, 8494099, 7414022, 7410965, 7397908, 8494097, 8494102, 8494081,
+  7399938, 8494101, 7416586, 7415821, 7397638, 7411727, 7400968, 7416332, 8494112, 7414803, 7412500, 8494086,
+  8494100, 8494095, 7396368, 8494081, 7405570, 8494100, 7401492, 7402261, 7401990, 7400711, 7406088, 7401737,
+  7400202, 7400475, 7399692, 7409421, 7421709, 7406607, 8494086, 7409672, 8494098, 7404819, 7410196, 7410709,
+  8494093, 7409156, 7406360, 8494086, 8494086, 7410459, 8494099, 8494107, 8494096, 8494093, 7418128, 8494093,
+  7418388, 8494102, 7408657, 8494086, 8494100, 7413524, 7413269, 8494107, 7406890, 8494085, 7416070, 8494087,
+  7421199, 8494089, 7415562, 8494091, 7421967, 8494112, 8494084, 7418639, 8494096, 7423494, 7417346, 8494102,
+  7419156, 8494101, 8494086, 8494103, 7422470, 7420169, 8494100, 7420949, 8494090, 7422217, 7420426, 7424009,
+  8494096, 8494093, 8494096, 7419663, 8494090, 8494099, 7421442, 7417107, 7419924, 8494093, 7422726, 8494099,
+  8494106, 7425799, 8494102, 8494099, 7427076, 7425293, 8494099, 8494093, 8494096, 8494100, 8494081, 8494082,
+  8494083, 7428623, 7422998, 7423238, 8494087, 8494088, 8494099, 8494090, 8494099, 8494102, 8494093, 8494086,
+  7426056, 8494090, 8494107, 8494084, 8494099, 8494100, 7426818, 8494102, 8494082, 8494100, 7424262, 8494087,
+  7426568, 8494097, 7424522, 8494093, 7430659, 8494108, 8494092, 8494093, 8494085, 8494095, 8494100, 8494099,
+  8494100, 8494101, 8494100, 8494101, 8494084, 8494099, 7428879, 8494102, 8494088, 8494089, 8494089, 8494100,
+  8494095, 8494093, 8494084, 8494100, 8494086, 8494097, 8494085, 8494099, 8494100, 8494088, 8494089, 7427594,
+  8494083, 7428111, 8494093, 8494082, 8494095, 7423763, 7429652, 8494101, 8494099, 8494100, 8494093, 8494082,
+  8494082, 8494100, 7430165, 7429126, 7427846, 8494082, 8494101, 8494083, 8494090, 8494100, 7429382, 8494095,
+  8494087, 8494093, 8494096, 7430408, 7431942, 8494096, 7426324, 7429909, 8494090, 8494086, 8494082, 8494093,
+  7432212, 8494101, 8494101, 8494090, 8494104, 8494099, 7433748, 7432981, 8494102, 7435797, 8494090, 8494100,
+  7434771, 8494100, 8494095, 7437837, 8494082, 8494082, 7433990, 7434515, 7436294, 8494086, 8494090, 8494081,
+  8494086, 8494086, 7435268, 8494100, 8494093, 8494090, 8494082, 8494093, 8494086, 7436548, 8494092, 7433491,
+  7435526, 8494086, 7437071, 7438599, 8494086, 8494101, 8494095, 8494086, 7436038, 7438086, 7438342, 8494100,
+  8494086, 8494084, 8494101, 8494093, 8494082, 8494099, 8494084, 8494093, 8494086, 8494099, 7438868, 8494093,
+  8494087, 8494099, 8494100, 7437318, 7440397, 8494099, 8494101, 8494100, 8494090, 8494086, 7441423, 8494093,
+  8494094, 7440655, 8494086, 7439106, 8494086, 8494099, 8494100, 7441670, 8494083, 7442182, 8494083, 8494099,
+  8494087, 8494090, 8494086, 8494086, 8494100, 8494089, 7442950, 7443206, 7439377, 8494100, 8494097, 8494088,
+  7439893, 8494090, 8494086, 8494084, 8494100, 7440902, 7443718, 8494102, 8494086, 8494104, 7442707, 8494089,
+  8494101, 8494104, 8494082, 8494082, 8494097, 7441156, 8494086, 8494099, 8494101, 8494099, 8494090, 8494090,
+  8494093, 8494093, 8494093, 8494095, 8494096, 7442448, 8494097, 8494093, 8494093, 8494082, 8494101, 7445523,
+  8494086, 8494099, 7446285, 8494081, 8494086, 8494086, 7445764, 8494086, 7443462, 8494112, 8494088, 8494101,
+  7441937, 8494093, 8494092, 8494100, 8494102, 8494095, 8494099, 8494097, 8494093, 7445254, 7447316, 7446541,
+  8494095, 8494086, 8494099, 7443988, 8494086, 8494099, 8494095, 7448077, 8494090, 7445007, 8494081, 7448580,
+  8494090, 7446786, 7447814, 8494095, 8494094, 8494095, 8494086, 8494082, 8494082, 8494102, 8494086, 8494086,
+  7448859, 8494093, 8494084, 8494104, 8494082, 8494094, 7447558, 8494101, 8494100, 8494093, 8494093, 8494084,
+  8494090, 8494084, 7450643, 8494097, 8494093, 8494093, 8494093, 8494090, 8494086, 8494107, 8494093, 8494094,
+  7450383, 8494086, 8494086, 7452175, 7451411, 7449108, 7453449, 8494092, 7451658, 8494084, 8494082, 8494099,
+  8494090, 8494100, 8494086, 8494095, 8494095, 8494089, 7449876, 8494101, 8494084, 7455750, 8494093, 8494096,
+  8494101, 8494086, 8494101, 8494099, 8494094, 7452941, 7455238, 7457295, 8494093, 8494084, 7454730, 8494099,
+  8494090, 8494101, 8494101, 7455508, 7456533, 7454479, 8494093, 7464205, 7459087, 7458323, 7460365, 8494090,
+  7456271, 8494082, 8494086, 7460870, 7459599, 7457798, 8494099, 8494097, 7460627, 8494087, 7464723, 8494093,
+  7463430, 8494096, 8494105, 8494085, 8494100, 8494082, 7462421, 7456788, 8494082, 7462675, 7460111, 8494082,
+  7461382, 8494095, 7465235, 8494093, 7463946, 8494093, 8494084, 8494112, 8494086, 8494090, 8494096, 8494093,
+  8494093, 7463190, 8494100, 8494104, 8494099, 8494100, 8494093, 8494097, 8494086, 8494094, 8494082, 7464981,
+  8494099, 8494084, 8494099, 8494086, 7465737, 7464454, 7465482, 8494090, 8494089, 8494086, 8494086, 8494082,
+  8494122, 8494084, 8494097, 8494086, 8494093, 8494082, 8494095, 7466502, 8494104, 7466246, 8494099, 8494100,
+  8494101, 8494096, 8494094, 7465999, 8494104, 8494101, 8494101, 7470099, 8494099, 8494093, 8494095, 8494082,
+  7467014, 8494086, 8494122, 8494099, 7468034, 8494086, 7467796, 8494084, 7469574, 8494099, 7468550, 7470861,
+  8494100, 8494082, 7473165, 7473930, 8494086, 8494082, 7468308, 7474178, 8494084, 7471618, 8494100, 7470611,
+  8494102, 7473414, 8494086, 8494082, 8494100, 8494100, 8494082, 8494082, 8494100, 7474703, 8494100, 8494086,
+  8494082, 7475208, 8494099, 7471126, 7467283, 7472646, 8494092, 7472390, 8494099, 8494101, 7474451, 7472902,
+  7473674, 7478278, 7472149, 8494095, 8494094, 8494093, 7474950, 8494096, 7478540, 7475462, 8494092, 8494082,
+  8494093, 8494096, 7478031, 8494087, 8494086, 8494090, 8494086, 8494101, 8494099, 8494086, 8494100, 8494085,
+  7479046, 8494099, 8494090, 8494090, 8494084, 8494082, 8494093, 7477766, 8494097, 7475718, 8494101, 8494100,
+  8494101, 8494100, 8494093, 8494093, 8494082, 7479810, 7480853, 7479558, 7478790, 7480326, 8494099, 8494100,
+  7476746, 7481094, 8494082, 7481871, 7481364, 7483917, 8494088, 7485958, 7480083, 7477011, 8494100, 8494102,
+  8494082, 8494084, 8494101, 8494082, 8494086, 8494086, 8494086, 8494089, 7486470, 7481603, 8494123, 8494085,
+  7482370, 7486981, 7487253, 8494093, 7486726, 8494099, 8494082, 8494095, 7484934, 8494086, 8494086, 8494086,
+  8494101, 7486214, 8494096, 8494102, 8494102, 7484162, 7483395, 8494100, 8494096, 7484422, 7485446, 8494093,
+  8494100, 7485194, 7488776, 8494101, 8494086, 8494092, 8494090, 8494090, 8494093, 8494086, 8494082, 8494087,
+  7490565, 8494087, 7488527, 8494086, 8494096, 8494086, 7487498, 7487746, 8494099, 7491078, 8494090, 7488009,
+  8494084, 7489030, 7488266, 8494089, 8494086, 8494086, 8494084, 7490325, 8494082, 8494123, 8494101, 8494086,
+  8494081, 8494089, 7490822, 8494107, 8494100, 7489300, 7489545, 8494096, 8494087, 8494096, 8494101, 8494093,
+  8494102, 7491348, 8494101, 8494107, 7491605, 8494096, 8494089, 8494084, 8494086, 7492627, 8494099, 7492098,
+  8494086, 8494089, 8494082, 7492358, 8494082, 8494101, 8494086, 8494086, 7494921, 8494086, 8494082, 7495437,
+  7492884, 8494100, 7496969, 7493653, 8494099, 8494090, 8494094, 8494102, 8494086, 7493135, 7494153, 8494082,
+  7495700, 7496453, 7496212, 7498250, 8494082, 8494099, 7493909, 8494100, 8494100, 8494086, 8494099, 7497740,
+  7497492, 8494099, 8494090, 8494084, 7497218, 7495174, 8494092, 8494090, 7490054, 7501069, 8494087, 8494086,
+  8494086, 8494095, 8494099, 7497999, 7498758, 7498506, 7499785, 7496710, 7499539, 8494096, 8494082, 8494100,
+  7501580, 8494089, 8494100, 8494086, 8494082, 7501333, 8494096, 7499270, 7499024, 7500804, 8494100, 7500546,
+  8494086, 7500294, 8494102, 8494100, 8494093, 8494101, 7502086, 7501834, 8494082, 8494101, 8494099, 8494099,
+  8494085, 7504655, 8494086, 8494094, 8494090, 8494101, 8494097, 8494100, 7502862, 7505420, 7502351, 8494093,
+  8494093, 7503125, 7505173, 8494087, 7507725, 8494095, 7502613, 7505928, 7494669, 7506197, 7506453, 7503369,
+  7504140, 8494087, 7508490, 7507460, 8494093, 8494082, 8494101, 8494101, 7507988, 8494100, 7509011, 8494095,
+  8494082, 8494090, 8494101, 8494094, 8494101, 8494084, 8494085, 8494101, 7506954, 8494086, 8494085, 8494101,
+  8494088, 8494100, 8494093, 8494090, 8494095, 8494092, 8494090, 8494087, 8494090, 8494095, 8494093, 7509524,
+  8494099, 8494101, 8494102, 8494101, 8494093, 8494101, 8494100, 8494095, 8494107, 8494084, 7508755, 8494100,
+  8494081, 8494102, 8494083, 7509770, 8494099, 8494084, 8494095, 7508230, 8494082, 8494093, 8494097, 8494090,
+  7510547, 7509260, 8494090, 7511298, 8494082, 7510032, 8494099, 7510278, 8494097, 8494101, 8494097, 8494102,
+  7513109, 8494100, 8494095, 8494095, 8494084, 8494096, 7511571, 7514644, 7512083, 7512596, 8494090, 7511830,
+  7512853, 8494090, 8494102, 7513346, 8494085, 8494102, 8494090, 8494082, 7510805, 8494093, 8494093, 8494086,
+  8494099, 7512335, 7511046, 7513875, 8494081, 8494095, 8494089, 7514114, 8494081, 7515654, 8494100, 8494094,
+  8494101, 8494101, 7516938, 8494090, 7514384, 7516162, 8494085, 8494089, 7522569, 8494086, 8494097, 8494095,
+  8494101, 7516436, 7515925, 8494090, 8494107, 8494090, 8494086, 8494095, 7518991, 7515407, 8494093, 8494090,
+  7518483, 8494093, 8494100, 8494100, 7521282, 7520002, 8494099, 7520275, 8494097, 7517190, 8494105, 7519253,
+  8494100, 8494090, 8494101, 8494083, 8494099, 8494093, 8494092, 8494090, 8494090, 8494122, 7519763, 8494099,
+  8494086, 7518742, 8494100, 8494097, 8494097, 8494096, 8494082, 8494101, 8494099, 8494085, 8494081, 8494090,
+  8494088, 8494084, 8494082, 8494086, 8494088, 8494101, 7523091, 8494089, 8494102, 8494100, 8494099, 8494094,
+  7521811, 8494100, 8494094, 8494086, 8494099, 7521039, 8494101, 8494107, 8494099, 8494084, 8494082, 8494096,
+  8494090, 8494099, 8494081, 8494107, 8494090, 8494084, 7521541, 8494092, 8494095, 8494088, 8494096, 8494086,
+  8494081, 8494095, 8494083, 8494100, 8494095, 8494083, 8494087, 8494089, 8494089, 8494122, 7524117, 7522828,
+  8494093, 7524366, 7523842, 8494101, 8494094, 8494085, 8494099, 8494083, 8494101, 8494087, 8494081, 7519512,
+  7526917, 8494084, 8494082, 8494086, 8494085, 7523334, 8494098, 8494095, 8494100, 8494097, 8494083, 8494099,
+  7526159, 8494081, 8494102, 8494097, 7524883, 8494100, 7523604, 8494099, 8494096, 8494092, 8494101, 8494101,
+  8494097, 7527945, 8494101, 8494082, 7525126, 8494094, 8494092, 7524622, 8494094, 8494095, 8494095, 7520533,
+  7528723, 8494097, 7525378, 8494102, 8494083, 8494088, 8494086, 7526675, 8494102, 8494099, 8494090, 7527444,
+  8494102, 8494082, 8494089, 8494088, 8494096, 8494093, 8494087, 7525647, 8494090, 8494090, 8494099, 8494099,
+  8494085, 8494086, 8494081, 8494086, 8494082, 7528969, 8494102, 8494102, 7529226, 8494102, 8494095, 8494093,
+  8494100, 8494101, 8494090, 8494086, 8494095, 7528211, 8494096, 8494090, 8494088, 8494082, 7529482, 8494105,
+  8494081, 8494085, 8494088, 8494100, 8494084, 8494099, 7527682, 8494090, 8494089, 8494083, 7530259, 8494090,
+  7530511, 8494094, 8494089, 8494086, 7529747, 8494100, 8494099, 7530003, 8494096, 7533585, 8494105, 8494081,
+  8494086, 7530754, 8494102, 8494081, 8494083, 8494087, 8494088, 7533831, 8494082, 8494089, 8494086, 8494095,
+  7533068, 8494082, 8494102, 8494095, 8494095, 8494081, 8494100, 8494083, 8494099, 8494090, 7531533, 8494085,
+  8494096, 8494089, 8494090, 7534619, 7531795, 8494096, 8494083, 8494090, 7532546, 8494081, 8494122, 7533331,
+  8494095, 8494086, 8494100, 8494092, 7535379, 7535633, 8494095, 8494099, 8494085, 8494089, 8494096, 8494088,
+  8494097, 8494087, 8494097, 8494082, 7534089, 8494099, 8494099, 8494099, 8494082, 7532815, 8494090, 8494099,
+  7536915, 8494082, 8494112, 8494086, 8494082, 8494095, 7535882, 8494095, 8494085, 8494102, 7534352, 8494090,
+  8494090, 8494099, 7535110, 8494086, 8494095, 7537172, 8494095, 8494093, 8494083, 8494086, 8494088, 8494099,
+  8494087, 8494090, 8494100, 8494097, 8494101, 8494086, 8494092, 8494096, 8494092, 8494087, 8494093, 8494083,
+  8494096, 8494093, 8494101, 8494101, 8494102, 8494107, 8494087, 8494099, 7537677, 7536650, 8494099, 8494092,
+  8494085, 8494097, 8494095, 8494086, 8494089, 8494081, 7532307, 8494082, 8494097, 8494094, 7539983, 8494082,
+  8494102, 8494095, 8494090, 7538694, 8494095, 8494088, 8494089, 8494090, 7540243, 8494092, 8494093, 8494087,
+  7539476, 8494093, 7536394, 8494093, 7540738, 8494099, 7541523, 8494099, 8494086, 8494104, 7540502, 8494100,
+  8494100, 8494101, 8494085, 8494082, 8494099, 8494094, 8494096, 8494086, 8494095, 8494086, 7541001, 8494088,
+  8494093, 8494090, 7541772, 8494095, 8494086, 8494086, 8494085, 8494102, 8494095, 7542540, 7541267, 8494099,
+  7538438, 8494090, 8494086, 8494084, 8494102, 8494102, 8494094, 7543302, 8494122, 8494100, 7542291, 8494101,
+  8494096, 8494087, 8494088, 7545350, 8494086, 8494090, 8494100, 8494090, 8494099, 8494081, 8494082, 8494094,
+  7544588, 8494088, 7539212, 8494099, 8494082, 8494090, 8494101, 7543062, 8494095, 8494083, 8494096, 7543562,
+  8494096, 8494099, 7546125, 8494096, 8494082, 8494100, 8494099, 8494083, 7545606, 8494101, 8494087, 8494093,
+  8494090, 8494100, 7545877, 8494102, 7539734, 8494099, 7547156, 8494086, 7545094, 8494099, 7542803, 8494105,
+  8494102, 8494086, 8494093, 8494087, 8494084, 8494101, 7546384, 8494081, 7546630, 8494090, 8494088, 8494088,
+  8494082, 7547394, 8494099, 8494088, 8494083, 7549460, 7550210, 8494095, 8494095, 8494087, 7546886, 8494082,
+  8494095, 7548162, 8494095, 8494086, 8494100, 7548422, 7547668, 7544084, 7550989, 8494102, 7548681, 8494092,
+  8494101, 8494082, 7551507, 8494096, 8494090, 8494100, 8494095, 8494101, 8494102, 8494094, 8494095, 8494084,
+  8494085, 7547936, 8494112, 8494081, 8494101, 7551251, 8494084, 8494092, 8494112, 8494095, 7550735, 8494083,
+  8494090, 8494090, 8494099, 8494093, 8494102, 8494102, 7551750, 8494096, 8494095, 8494099, 7552783, 8494095,
+  8494081, 8494102, 8494081, 7552268, 8494099, 8494093, 8494102, 8494100, 7549204, 8494101, 8494089, 8494112,
+  8494083, 7550470, 8494099, 7549967, 7553295, 8494085, 8494089, 7553555, 7552019, 8494095, 8494093, 8494102,
+  8494090, 8494093, 8494096, 7552518, 8494099, 8494089, 8494122, 7554057, 8494081, 8494095, 8494099, 7553039,
+  8494099, 7553794, 8494100, 8494082, 8494089, 7557638, 8494102, 7555846, 8494122, 8494093, 8494095, 7554575,
+  8494102, 8494088, 7556371, 7556627, 7554310, 8494096, 8494100, 8494095, 8494101, 8494095, 7555078, 7558165,
+  8494090, 7557126, 8494099, 8494093, 8494082, 7558918, 8494083, 7557395, 8494086, 8494082, 8494090, 8494093,
+  8494100, 8494086, 7558402, 8494092, 8494093, 8494082, 7559174, 8494082, 8494086, 7555334, 8494083, 7559439,
+  8494085, 8494102, 8494084, 8494081, 8494093, 8494104, 8494095, 8494099, 8494082, 8494090, 8494099, 7560979,
+  7560198, 8494102, 8494095, 7558676, 8494101, 8494093, 7560467, 8494092, 8494100, 8494099, 8494084, 8494099,
+  8494084, 8494086, 8494101, 8494101, 8494101, 8494093, 8494082, 7561990, 8494082, 8494100, 8494081, 7563270,
+  8494090, 8494082, 8494093, 8494085, 8494099, 8494084, 8494086, 7564553, 8494100, 8494084, 8494101, 8494086,
+  8494088, 8494092, 8494086, 8494082, 8494095, 8494094, 8494107, 7561734, 7563795, 8494095, 8494101, 8494090,
+  8494100, 8494087, 8494101, 8494093, 7564291, 8494090, 8494100, 8494095, 7566353, 7568898, 7565071, 7569679,
+  8494101, 8494082, 7561491, 7562260, 7565332, 8494102, 8494107, 8494099, 8494099, 8494100, 8494101, 8494083,
+  8494086, 8494085, 7562502, 8494087, 8494081, 7566089, 8494094, 8494095, 8494101, 8494099, 8494083, 7564804,
+  8494100, 8494081, 7567362, 8494099, 8494100, 7568138, 7569411, 8494085, 8494104, 8494082, 7567119, 8494094,
+  7570453, 8494086, 7566867, 7568404, 8494086, 8494090, 8494097, 8494082, 8494097, 8494096, 8494099, 8494086,
+  8494122, 8494096, 7570946, 8494101, 8494086, 7571718, 7570182, 8494099, 8494081, 8494100, 7569930, 8494100,
+  8494086, 8494102, 7571221, 7572486, 7570704, 7571983, 8494090, 7564051, 8494107, 8494084, 7571478, 8494102,
+  8494102, 8494092, 8494082, 8494100, 8494086, 8494095, 8494084, 7567893, 8494081, 8494081, 8494086, 8494092,
+  8494089, 8494085, 8494088, 8494092, 8494087, 8494089, 8494081, 8494101, 8494086, 8494086, 7572998, 8494095,
+  7572742, 8494095, 8494102, 8494100, 7573524, 8494101, 8494086, 8494107, 8494096, 8494082, 8494095, 8494095,
+  8494090, 8494086, 8494095, 8494082, 8494090, 8494107, 8494102, 8494100, 8494088, 7573254, 8494101, 8494089,
+  7575823, 8494101, 8494081, 7572233, 8494087, 8494090, 8494082, 7573766, 8494099, 8494088, 7575571, 8494092,
+  7577863, 8494101, 7576341, 8494082, 8494084, 8494101, 8494085, 8494094, 8494095, 8494101, 8494085, 8494101,
+  8494099, 8494100, 8494099, 8494089, 8494101, 8494083, 8494099, 7575042, 8494081, 8494081, 8494099, 7577350,
+  8494083, 8494087, 8494088, 8494090, 7576074, 8494101, 8494092, 8494083, 8494097, 8494084, 7576853, 8494101,
+  7578118, 8494083, 8494100, 8494085, 8494092, 8494101, 8494095, 7576591, 7577103, 7579654, 8494097, 8494093,
+  8494100, 8494090, 7578370, 8494082, 8494095, 8494099, 7574790, 7578626, 8494082, 8494095, 8494090, 7577620,
+  8494100, 7580681, 8494095, 7578890, 8494096, 8494101, 8494090, 8494096, 7579405, 8494084, 8494090, 7579917,
+  8494099, 8494094, 8494092, 8494090, 7580937, 7580422, 8494084, 8494102, 8494112, 8494087, 8494088, 8494090,
+  8494081, 8494082, 8494096, 8494093, 8494085, 7580180, 8494101, 8494101, 8494081, 8494094, 7581190, 8494090,
+  8494082, 7579142, 7584262, 8494082, 7581955, 8494107, 8494097, 8494081, 7583253, 7583752, 8494100, 8494101,
+  8494096, 7585804, 8494090, 8494100, 8494082, 7581461, 8494096, 8494085, 7582982, 8494087, 8494102, 8494089,
+  7586835, 8494087, 8494082, 8494084, 7585307, 8494101, 8494085, 7581710, 8494095, 8494090, 8494100, 8494101,
+  8494096, 8494103, 8494100, 7585538, 8494087, 8494102, 8494100, 8494094, 8494082, 8494087, 8494086, 8494094,
+  8494101, 8494097, 7586054, 8494082, 8494093, 7587603, 8494101, 8494086, 8494101, 7587848, 7582217, 8494088,
+  8494082, 8494092, 7587092, 7587349, 8494095, 8494096, 8494092, 8494081, 8494099, 8494102, 7590150, 8494086,
+  8494082, 7586310, 8494092, 8494095, 7588123, 8494082, 8494090, 8494082, 8494099, 8494082, 8494086, 8494090,
+  8494095, 7589130, 7591430, 8494096, 7589639, 8494095, 8494082, 8494082, 8494081, 8494096, 8494082, 8494101,
+  8494093, 7589396, 8494086, 8494096, 8494095, 8494090, 8494099, 8494099, 8494082, 8494089, 8494082, 8494101,
+  8494095, 8494094, 8494081, 8494112, 8494090, 7590419, 8494106, 8494099, 8494096, 8494082, 8494123, 8494101,
+  8494093, 8494081, 8494101, 7588358, 8494102, 8494086, 8494083, 8494086, 8494085, 8494081, 8494092, 8494084,
+  7591173, 7588610, 8494123, 8494094, 8494083, 7592454, 8494097, 8494092, 8494084, 7593231, 8494094, 7590932,
+  8494099, 7590671, 7591946, 8494104, 8494092, 7591702, 8494094, 8494095, 8494095, 8494101, 8494086, 7589907,
+  8494094, 8494085, 7595021, 7596550, 8494100, 8494096, 7593734, 8494112, 8494096, 8494097, 7593474, 7594255,
+  7595524, 8494084, 7594758, 7594515, 8494100, 8494085, 8494083, 8494087, 8494088, 8494089, 8494087, 8494083,
+  8494093, 7598863, 8494093, 8494095, 7600917, 7597589, 7597839, 8494100, 8494097, 8494083, 7596804, 7596308,
+  8494104, 7592717, 8494097, 8494107, 7595274, 7598342, 8494089, 8494081, 8494095, 7598095, 8494089, 8494094,
+  8494101, 7599379, 8494083, 8494094, 8494102, 8494099, 7601171, 8494086, 8494089, 8494090, 8494095, 7598594,
+  7597069, 8494094, 7602447, 7601670, 8494090, 8494103, 8494095, 7599119, 8494101, 8494093, 8494085, 7601941,
+  8494099, 8494096, 8494086, 8494100, 7605011, 8494082, 8494093, 7602198, 8494089, 8494086, 8494089, 8494093,
+  7606804, 8494083, 8494089, 8494084, 7605254, 8494100, 8494090, 7601429, 8494090, 8494101, 8494082, 7603718,
+  8494092, 8494081, 8494084, 8494082, 8494100, 8494095, 7602964, 8494086, 8494086, 8494095, 8494100, 8494083,
+  8494082, 8494107, 8494095, 8494095, 8494093, 7605523, 8494086, 7607567, 7607315, 8494095, 8494099, 8494082,
+  8494086, 7604486, 8494101, 8494100, 8494102, 8494094, 8494097, 8494090, 8494085, 8494081, 8494093, 8494101,
+  8494092, 8494096, 8494099, 8494092, 8494099, 8494082, 8494082, 8494102, 8494090, 7608838, 8494083, 8494084,
+  8494102, 8494090, 8494087, 8494087, 8494100, 8494112, 8494084, 8494088, 8494086, 8494094, 8494099, 8494081,
+  8494097, 8494102, 8494084, 8494081, 8494086, 8494101, 8494086, 8494085, 8494084, 8494093, 8494084, 7609356,
+  8494099, 8494103, 8494090, 8494102, 8494101, 8494092, 7605780, 8494086, 8494100, 8494101, 8494101, 7607828,
+  8494100, 7609606, 8494086, 8494083, 8494082, 7608074, 7608584, 7606278, 7613205, 8494088, 8494099, 8494092,
+  8494093, 8494095, 8494099, 8494087, 8494087, 8494089, 8494093, 8494093, 8494092, 8494090, 8494101, 7608339,
+  8494100, 8494101, 8494084, 8494099, 8494100, 8494101, 8494090, 7609875, 8494088, 7612420, 8494093, 8494107,
+  8494096, 8494099, 8494097, 8494084, 8494095, 7609107, 8494093, 7612934, 8494100, 7610122, 7611158, 8494090,
+  7610893, 8494094, 8494095, 8494100, 8494086, 8494096, 7610643, 8494090, 8494089, 8494095, 8494090, 8494103,
+  7611398, 8494081, 7611667, 8494082, 8494093, 8494086, 8494090, 8494086, 8494082, 8494099, 8494096, 8494102,
+  8494093, 8494099, 8494089, 8494082, 7612681, 7611925, 8494101, 8494090, 8494090, 8494090, 8494090, 8494095,
+  7614214, 8494094, 7613711, 7615494, 8494081, 8494096, 7613971, 8494099, 8494095, 8494099, 8494099, 8494086,
+  8494105, 8494090, 8494099, 7614726, 7612162, 8494086, 7613455, 8494100, 8494081, 8494096, 8494099, 8494100,
+  8494082, 8494096, 7616777, 8494095, 8494082, 7614466, 8494094, 8494101, 8494106, 7614982, 8494090, 8494101,
+  8494089, 8494090, 8494099, 8494095, 8494081, 8494102, 8494083, 7615763, 7618566, 8494095, 8494099, 7616518,
+  8494093, 7617043, 7619861, 7617286, 7619074, 8494101, 7619334, 8494095, 8494090, 8494093, 8494089, 7615264,
+  8494107, 8494099, 7616021, 8494096, 8494088, 7620116, 8494088, 8494092, 8494084, 8494100, 8494095, 8494101,
+  8494100, 8494100, 8494100, 8494090, 7620884, 8494095, 8494099, 8494082, 7621647, 8494101, 8494101, 8494100,
+  7621382, 8494100, 8494099, 8494101, 8494086, 8494090, 8494087, 7621898, 8494092, 8494100, 7622410, 8494082,
+  7620354, 8494090, 8494093, 8494094, 7622918, 8494095, 8494082, 8494101, 8494095, 8494090, 7622150, 8494088,
+  8494093, 7622677, 8494096, 8494095, 8494093, 8494086, 8494095, 8494089, 8494088, 8494096, 7621141, 8494085,
+  8494087, 7623702, 8494082, 8494094, 8494101, 8494095, 8494087, 8494087, 8494106, 8494083, 8494086, 7623444,
+  7624981, 8494093, 8494099, 8494094, 8494107, 7623189, 8494095, 7624458, 8494101, 7623951, 8494086, 8494102,
+  7618831, 8494101, 8494084, 7624710, 8494099, 8494083, 8494084, 8494087, 8494090, 8494087, 8494090, 8494093,
+  8494099, 8494090, 7627272, 7625749, 8494083, 7625235, 8494100, 7626250, 8494096, 8494096, 7627782, 8494083,
+  8494094, 8494102, 8494100, 8494099, 7625491, 8494089, 8494096, 8494092, 7626754, 8494094, 8494082, 7626511,
+  8494086, 8494099, 8494099, 8494099, 8494100, 8494094, 7629327, 7628042, 8494104, 8494083, 8494099, 8494093,
+  8494095, 8494082, 8494088, 7629571, 8494102, 8494112, 8494101, 7629069, 8494099, 7630338, 8494084, 8494085,
+  7627018, 8494093, 8494086, 7630863, 8494112, 7630086, 7633424, 7632403, 7630598, 8494095, 8494102, 7634698,
+  8494122, 8494123, 8494100, 8494101, 7632902, 8494101, 8494099, 7631106, 8494100, 7634436, 7607049, 7635987,
+  8494096, 8494086, 7633936, 8494112, 7634182, 8494106, 7634960, 8494096, 8494094, 8494083, 7635714, 7638291,
+  7635220, 8494099, 7636501, 8494095, 8494099, 7637506, 8494095, 8494093, 8494099, 8494095, 8494095, 8494097,
+  8494096, 8494099, 8494094, 8494101, 8494122, 7639301, 8494083, 8494099, 7635471, 8494093, 8494082, 8494092,
+  7636742, 8494099, 8494101, 7638803, 8494099, 8494090, 8494101, 8494102, 7620615, 8494090, 8494082, 8494086,
+  8494097, 7639557, 8494086, 8494090, 8494097, 7640851, 8494100, 8494090, 7637001, 8494102, 8494094, 7642630,
+  8494099, 7638534, 8494100, 8494081, 8494100, 8494101, 8494081, 8494082, 8494104, 8494081, 7641615, 8494107,
+  8494096, 8494099, 8494086, 8494090, 8494082, 7640070, 7644947, 7646471, 7640332, 8494082, 8494097, 7646227,
+  8494090, 8494082, 8494081, 8494082, 7642388, 8494101, 8494085, 7641862, 7643655, 8494088, 8494089, 7644181,
+  8494084, 8494092, 8494093, 8494096, 7637263, 8494081, 8494094, 8494099, 8494099, 8494097, 8494097, 8494102,
+  7643914, 8494104, 7643402, 8494086, 8494099, 8494093, 8494092, 7646735, 7645194, 8494086, 8494089, 8494099,
+  8494100, 8494090, 7644422, 7644687, 8494094, 8494086, 8494086, 8494122, 8494094, 7647247, 8494084, 8494096,
+  7648015, 7649555, 7647764, 8494082, 8494092, 8494087, 8494097, 8494097, 8494082, 8494086, 7648520, 8494100,
+  8494106, 8494099, 8494096, 8494102, 8494084, 8494093, 8494100, 8494090, 8494090, 8494082, 8494102, 7650069,
+  8494085, 8494090, 8494099, 8494093, 8494104, 7650313, 8494094, 8494100, 8494100, 8494092, 8494090, 8494081,
+  8494099, 8494084, 8494083, 7650832, 8494101, 8494086, 8494084, 8494088, 7648787, 8494090, 8494093, 8494092,
+  7649039, 8494094, 8494086, 8494096, 8494097, 8494085, 8494086, 8494090, 8494092, 8494094, 8494093, 8494101,
+  8494096, 8494087, 8494087, 8494088, 7651078, 8494100, 8494101, 8494102, 7647490, 8494101, 7645453, 8494086,
+  8494093, 8494090, 8494099, 8494107, 8494101, 7646996, 8494082, 8494093, 7653908, 7651605, 8494105, 8494097,
+  8494085, 7651334, 8494093, 7652360, 8494082, 8494084, 7657235, 7658003, 7653654, 8494107, 8494095, 8494089,
+  8494081, 8494082, 8494086, 8494100, 8494085, 7653126, 7651847, 8494088, 8494089, 8494100, 8494096, 8494092,
+  8494093, 7653390, 7654671, 8494096, 8494093, 8494096, 8494099, 7656724, 7656981, 8494102, 8494085, 8494104,
+  8494082, 8494088, 7656467, 8494087, 8494082, 7657480, 8494093, 7657749, 8494090, 8494093, 7658502, 8494101,
+  7659273, 8494082, 8494085, 7658259, 7659011, 8494084, 8494083, 7660814, 8494103, 8494090, 7655696, 8494099,
+  8494096, 8494094, 8494088, 8494090, 8494095, 8494094, 7659535, 7658754, 8494082, 7660559, 7659795, 7660038,
+  7661830, 7661331, 8494089, 8494102, 8494093, 8494085, 8494095, 8494082, 8494100, 8494096, 7662099, 7661584,
+  7662342, 8494096, 8494122, 8494084, 7663626, 7662594, 8494097, 8494097, 7663891, 8494093, 8494086, 7664660,
+  8494123, 7660320, 8494086, 8494096, 8494101, 8494095, 8494101, 8494101, 7661077, 8494081, 8494090, 8494089,
+  8494123, 8494093, 8494093, 8494081, 8494095, 8494082, 8494086, 8494093, 8494084, 8494097, 8494096, 8494102,
+  8494090, 8494091, 8494083, 7667982, 7662862, 8494085, 7667206, 8494081, 8494082, 8494099, 7666182, 7668229,
+  7666700, 8494093, 7664392, 8494089, 8494087, 8494086, 8494101, 8494087, 8494081, 8494090, 8494096, 8494084,
+  8494090, 7666442, 7665171, 8494093, 8494099, 8494102, 8494099, 8494086, 8494084, 8494083, 8494084, 8494101,
+  8494086, 8494087, 8494088, 8494093, 8494101, 8494093, 7665929, 7667727, 8494081, 8494092, 8494083, 7664147,
+  7665428, 7673108, 8494102, 8494088, 8494089, 8494082, 8494083, 7665670, 7675146, 7669006, 8494095, 8494090,
+  8494081, 8494082, 7676422, 7671828, 8494099, 8494086, 8494099, 8494082, 8494097, 7673619, 8494081, 8494097,
+  8494083, 8494102, 8494089, 8494090, 7672839, 7675910, 8494089, 7669780, 7669269, 7670540, 8494093, 8494101,
+  7673871, 8494096, 7671323, 8494086, 7672083, 7674644, 8494101, 7674883, 8494103, 8494104, 8494096, 8494097,
+  8494096, 7675401, 8494083, 8494101, 7674115, 7672589, 8494095, 7675663, 8494093, 8494090, 8494112, 8494090,
+  7673357, 8494094, 8494081, 8494099, 8494083, 8494099, 8494085, 8494100, 8494099, 8494091, 8494099, 8494090,
+  8494086, 8494092, 8494093, 8494088, 8494088, 7676163, 8494106, 8494100, 7676687, 8494083, 8494101, 8494089,
+  7676947, 7677197, 7677711, 8494082, 8494093, 7678230, 7678483, 8494092, 7677450, 7678998, 8494099, 8494095,
+  8494099, 8494089, 7680271, 7678729, 7679750, 8494090, 7681290, 8494093, 7677962, 8494095, 8494083, 8494086,
+  8494085, 8494096, 7681040, 7683091, 7680005, 8494099, 8494086, 8494088, 8494100, 8494102, 8494097, 8494099,
+  7680772, 7683347, 8494089, 8494086, 8494101, 8494107, 7683601, 8494093, 8494087, 8494082, 8494092, 8494101,
+  8494094, 7684610, 7679238, 8494088, 8494096, 8494099, 7683846, 8494100, 7681551, 8494099, 8494090, 7684354,
+  8494101, 8494107, 8494092, 7682310, 8494099, 7688467, 8494086, 8494082, 8494082, 8494102, 8494101, 8494099,
+  8494093, 8494096, 8494095, 8494092, 8494093, 7684116, 7685907, 8494088, 7688979, 8494101, 7685139, 8494087,
+  7686669, 7688706, 7692304, 8494090, 8494102, 8494100, 7694351, 8494093, 8494085, 7685398, 7690755, 8494088,
+  7690510, 8494106, 8494090, 7688200, 8494093, 8494099, 8494099, 8494092, 8494097, 8494102, 7691023, 8494101,
+  8494097, 8494084, 7691283, 8494100, 8494101, 7689238, 8494099, 7689482, 8494083, 7693058, 8494093, 8494081,
+  7690255, 7693830, 8494095, 8494086, 7691539, 7687444, 8494085, 8494094, 7686153, 8494093, 8494101, 8494082,
+  7692563, 8494087, 8494092, 8494089, 8494090, 7692034, 8494089, 8494101, 7691797, 8494088, 7693590, 8494084,
+  8494100, 7694601, 8494086, 8494086, 8494094, 8494083, 8494099, 8494085, 8494090, 7697173, 8494097, 8494100,
+  8494086, 8494095, 8494092, 8494100, 8494094, 7695375, 8494094, 8494094, 8494100, 7696134, 8494100, 8494084,
+  8494102, 8494090, 8494099, 8494092, 7692815, 7696911, 8494086, 8494086, 8494099, 7697935, 8494099, 8494090,
+  8494090, 8494082, 8494096, 8494099, 8494082, 8494097, 8494100, 8494093, 7695119, 8494095, 8494082, 8494100,
+  8494099, 7695876, 7694100, 8494090, 7698189, 7700244, 8494096, 8494101, 7698694, 8494099, 8494095, 7700484,
+  8494086, 8494095, 8494088, 8494101, 8494095, 7700742, 8494093, 7698954, 8494101, 8494090, 7699462, 8494093,
+  8494099, 8494096, 8494082, 8494096, 8494086, 8494082, 8494102, 7697428, 8494099, 8494099, 8494099, 8494082,
+  8494089, 8494099, 8494083, 7701254, 8494095, 8494095, 7702534, 7699722, 7700998, 8494085, 8494093, 8494100,
+  8494088, 8494096, 8494102, 8494102, 8494099, 8494082, 7706370, 8494102, 7699989, 7701766, 7704080, 8494092,
+  7703572, 8494094, 7704851, 8494101, 8494104, 8494099, 8494099, 8494100, 7704582, 8494082, 7703059, 8494084,
+  8494087, 8494081, 8494083, 8494090, 7708166, 8494099, 7706637, 8494086, 8494081, 8494096, 8494081, 8494082,
+  8494093, 7706886, 7705359, 8494086, 8494101, 8494104, 8494083, 8494084, 8494107, 8494102, 8494082, 7702291,
+  8494088, 7705866, 7708930, 8494087, 7704333, 8494082, 7707398, 8494082, 8494100, 8494093, 7706131, 7707142,
+  7710223, 7705098, 8494090, 8494090, 8494096, 8494088, 8494100, 8494099, 7709709, 7707650, 8494092, 8494087,
+  8494086, 8494094, 8494100, 8494093, 8494100, 8494090, 8494095, 8494086, 8494095, 8494100, 8494082, 8494095,
+  7713033, 8494097, 7710726, 8494084, 8494099, 8494095, 8494093, 8494085, 8494084, 8494100, 8494095, 7713294,
+  8494100, 7710470, 8494096, 8494101, 8494086, 7712521, 8494088, 8494099, 7709205, 8494100, 8494100, 7712772,
+  8494095, 8494099, 8494123, 8494095, 8494112, 8494095, 8494100, 8494102, 8494099, 8494097, 7713538, 7714314,
+  7714054, 7711497, 7712262, 8494089, 8494101, 8494085, 8494081, 8494101, 7712009, 8494084, 8494084, 8494082,
+  8494081, 8494099, 8494100, 8494084, 8494102, 8494086, 8494087, 8494088, 8494086, 8494099, 8494101, 8494092,
+  7713794, 8494094, 8494095, 8494101, 7716358, 8494086, 8494082, 7714575, 8494099, 8494086, 8494093, 8494097,
+  8494100, 8494092, 7710982, 8494093, 8494101, 7715347, 8494093, 8494096, 8494101, 8494100, 8494101, 8494086,
+  7715859, 8494082, 8494092, 7717397, 7718677, 8494100, 8494093, 8494101, 8494090, 8494086, 8494088, 8494090,
+  8494101, 7709447, 8494090, 8494090, 8494087, 8494095, 8494092, 8494093, 8494090, 8494084, 8494100, 8494095,
+  8494089, 7719177, 8494094, 8494123, 8494089, 8494100, 7717638, 8494100, 7719426, 8494107, 8494095, 8494093,
+  7718406, 8494092, 8494093, 8494085, 7719946, 8494093, 8494089, 8494081, 8494096, 8494082, 8494099, 8494099,
+  8494082, 7720211, 8494102, 7719690, 7721237, 8494086, 7718150, 8494099, 8494084, 7722260, 8494099, 8494090,
+  8494097, 8494086, 7716896, 8494102, 8494101, 8494087, 8494084, 8494096, 8494082, 8494099, 8494082, 8494085,
+  8494082, 8494081, 8494090, 8494093, 7723014, 8494099, 8494102, 7723782, 8494102, 8494086, 8494090, 7718921,
+  8494093, 8494081, 8494086, 7721734, 8494101, 8494099, 7720468, 8494086, 8494102, 8494101, 8494090, 7722506,
+  8494100, 8494093, 8494094, 7720719, 7717139, 7721487, 8494090, 8494101, 8494101, 8494090, 8494086, 7726355,
+  8494100, 8494089, 8494095, 7723270, 8494094, 8494082, 8494099, 7722004, 7724036, 8494082, 8494103, 8494082,
+  7724564, 8494101, 8494081, 8494102, 8494092, 8494090, 8494094, 7726863, 8494097, 8494090, 7728650, 7727123,
+  7727637, 8494084, 8494088, 8494103, 8494099, 7729154, 8494107, 7728915, 7725332, 8494092, 8494093, 8494094,
+  8494085, 7727874, 7729423, 8494083, 8494099, 7725582, 8494101, 7725846, 7730178, 8494094, 8494099, 8494092,
+  8494087, 8494093, 8494089, 7728143, 7730959, 7723533, 8494086, 8494099, 8494099, 8494083, 8494112, 8494096,
+  8494099, 7732502, 8494107, 7728386, 8494101, 8494104, 7733001, 7731718, 8494083, 8494082, 8494090, 8494097,
+  8494101, 8494112, 7735567, 7733506, 8494097, 8494086, 7735309, 7731974, 8494090, 8494086, 8494089, 8494101,
+  8494099, 8494082, 8494086, 8494086, 8494081, 8494101, 8494093, 8494099, 8494100, 8494082, 8494085, 7732246,
+  8494096, 8494093, 8494102, 7734790, 8494084, 8494083, 8494092, 8494084, 8494081, 8494087, 8494086, 8494100,
+  8494101, 8494086, 8494083, 8494086, 7733766, 8494089, 8494095, 8494087, 8494107, 8494101, 8494089, 8494086,
+  7736597, 8494099, 8494101, 8494093, 8494081, 8494090, 7734534, 7734022, 8494082, 8494093, 7739141, 8494099,
+  8494101, 7737614, 8494100, 8494086, 8494090, 8494082, 8494086, 8494093, 8494086, 7741197, 8494083, 8494101,
+  8494089, 8494094, 8494087, 7738644, 8494088, 8494084, 8494088, 7738900, 8494097, 8494094, 8494086, 8494084,
+  8494101, 8494095, 7736327, 7736852, 8494089, 8494095, 8494096, 8494082, 8494081, 8494092, 8494095, 7737094,
+  7740692, 8494101, 7740934, 8494083, 8494101, 7738139, 8494093, 8494082, 8494083, 8494088, 8494093, 8494093,
+  8494099, 8494093, 8494094, 8494101, 8494101, 8494100, 8494081, 8494082, 8494099, 8494101, 8494097, 8494093,
+  8494086, 8494082, 8494086, 7741448, 8494090, 8494084, 8494086, 7738387, 8494095, 8494092, 8494084, 8494102,
+  8494101, 7739407, 8494089, 7739658, 7737871, 8494099, 7741709, 7739925, 8494090, 8494100, 8494095, 8494087,
+  7740435, 7742212, 8494085, 8494102, 8494106, 8494093, 8494094, 8494099, 8494086, 7741954, 8494100, 8494099,
+  8494081, 7742982, 8494100, 8494081, 8494099, 7742474, 8494089, 7743497, 7742726, 7744002, 7744531, 7743248,
+  7744262, 7745542, 8494082, 8494093, 8494099, 8494100, 7745032, 8494086, 8494101, 8494100, 8494096, 8494097,
+  8494089, 7740166, 8494099, 8494101, 8494099, 8494097, 8494093, 8494093, 8494095, 7745798, 8494082, 8494096,
+  8494096, 7744783, 7746566, 8494099, 7745300, 8494099, 7746314, 7747842, 8494102, 8494086, 7748358, 7748870,
+  8494082, 8494094, 8494112, 8494099, 8494092, 7748102, 8494102, 8494099, 8494093, 8494097, 8494095, 8494084,
+  8494099, 8494101, 8494083, 8494099, 8494086, 8494099, 8494100, 8494081, 8494082, 8494082, 8494094, 8494086,
+  7751430, 8494082, 8494089, 8494090, 8494099, 7747590, 8494090, 8494099, 8494083, 7749122, 8494101, 8494084,
+  7749651, 7749894, 8494082, 8494081, 8494086, 7750658, 7750157, 8494094, 8494101, 7750922, 8494086, 8494086,
+  7752977, 8494100, 8494090, 7752468, 8494096, 7750422, 8494101, 8494099, 8494096, 8494086, 8494095, 8494090,
+  8494100, 8494085, 8494082, 8494094, 7756038, 8494102, 8494086, 8494093, 7751187, 7753218, 8494100, 7753487,
+  8494082, 7753734, 8494095, 8494094, 7749378, 8494084, 7754758, 7752725, 8494082, 8494102, 8494101, 8494087,
+  8494097, 8494092, 7757314, 8494094, 8494095, 8494102, 7756291, 8494100, 8494101, 7757570, 7755522, 8494099,
+  7755285, 8494082, 7754004, 8494096, 7761926, 8494086, 7757071, 8494087, 8494082, 8494099, 7756819, 8494083,
+  8494101, 8494085, 8494097, 7762447, 8494094, 8494086, 8494099, 8494100, 8494099, 8494083, 7758340, 8494104,
+  7755021, 8494097, 8494107, 8494099, 7759882, 8494101, 7746067, 8494093, 8494083, 7760911, 8494089, 7759106,
+  8494087, 7757843, 7760659, 7758854, 8494084, 7763725, 8494090, 8494093, 8494099, 8494088, 8494097, 7763989,
+  7762186, 8494086, 8494101, 8494112, 8494101, 8494086, 8494100, 8494082, 8494095, 8494104, 8494100, 8494099,
+  8494092, 8494099, 8494094, 8494082, 8494093, 8494097, 8494095, 8494093, 8494100, 7761670, 8494084, 8494090,
+  8494097, 8494086, 7765253, 8494099, 8494085, 8494095, 8494101, 8494081, 7762690, 8494095, 7761428, 8494086,
+  7763206, 8494085, 8494090, 8494099, 8494082, 8494100, 8494082, 8494094, 8494086, 8494095, 8494088, 8494081,
+  8494107, 8494101, 8494092, 7763477, 8494099, 7761167, 7764742, 8494096, 8494090, 8494107, 7765770, 7767313,
+  7764246, 7768585, 8494104, 8494084, 8494101, 8494107, 7764500, 8494099, 7765523, 8494095, 8494085, 8494086,
+  8494082, 8494100, 8494085, 8494099, 8494101, 8494081, 8494101, 8494090, 8494088, 8494088, 8494087, 7768837,
+  7768326, 7769094, 7769604, 8494095, 7766279, 8494082, 8494096, 8494087, 8494082, 8494086, 8494096, 8494082,
+  8494107, 8494082, 7770644, 7769363, 8494094, 7767558, 8494090, 8494106, 8494099, 8494102, 8494097, 7769862,
+  8494081, 7767055, 8494099, 8494084, 8494085, 8494097, 8494092, 8494101, 8494101, 8494095, 8494082, 8494090,
+  7771407, 8494099, 7767814, 8494099, 8494102, 8494086, 8494100, 8494089, 8494081, 8494092, 7772931, 8494084,
+  8494090, 7773204, 8494087, 8494088, 8494082, 8494082, 8494102, 7772424, 8494100, 8494101, 7771663, 8494092,
+  7774221, 8494094, 8494101, 8494101, 7772181, 7773973, 7774985, 7774740, 7765013, 7770882, 8494084, 8494104,
+  8494087, 8494086, 8494107, 8494095, 8494095, 8494090, 8494082, 8494097, 8494099, 7775759, 8494101, 8494096,
+  8494083, 8494093, 8494082, 7776266, 8494100, 7772681, 8494086, 8494092, 8494093, 7775234, 7773706, 8494101,
+  8494095, 8494089, 8494085, 7774474, 8494086, 8494097, 8494099, 8494086, 7776005, 8494089, 8494101, 7775498,
+  8494082, 7777295, 8494092, 8494088, 8494099, 8494086, 8494101, 8494087, 8494088, 8494089, 7777551, 8494088,
+  8494092, 8494093, 8494093, 7778319, 7779087, 8494084, 8494086, 8494090, 8494084, 8494096, 8494094, 8494095,
+  8494104, 7781126, 8494090, 8494107, 7778063, 7777795, 8494093, 8494088, 8494099, 8494087, 8494101, 7780115,
+  8494099, 8494112, 8494084, 7773453, 8494101, 8494095, 8494122, 8494102, 8494090, 8494088, 7778818, 7779853,
+  8494102, 7781653, 7778566, 8494086, 8494099, 7780883, 8494090, 8494093, 8494081, 8494092, 8494096, 8494090,
+  8494096, 8494086, 7779590, 8494101, 7784981, 8494087, 7782921, 8494086, 8494086, 8494089, 8494087, 8494088,
+  8494107, 7784456, 8494090, 8494106, 7776781, 8494094, 8494095, 8494086, 7780354, 8494097, 8494086, 8494100,
+  7782662, 7782407, 7785749, 8494099, 7780618, 7785221, 7782150, 7777031, 7786760, 7781385, 8494086, 8494106,
+  8494100, 7787021, 8494085, 7787279, 8494090, 8494094, 8494099, 8494084, 7784724, 7790598, 7790082, 8494089,
+  7783192, 7789843, 8494100, 7787803, 8494102, 8494092, 8494095, 7791106, 7785999, 8494090, 8494093, 8494083,
+  8494100, 8494100, 7789077, 7790358, 7788804, 8494100, 7793683, 8494087, 8494093, 7791382, 8494090, 8494089,
+  8494092, 7788554, 7792646, 8494093, 8494093, 8494095, 7791631, 7789344, 8494100, 8494090, 7790867, 8494085,
+  8494093, 8494083, 8494095, 8494081, 8494099, 8494099, 7791915, 8494086, 8494090, 8494095, 8494082, 7794182,
+  8494094, 7792911, 7792134, 7794441, 8494083, 8494099, 8494084, 8494101, 8494090, 7794964, 8494089, 8494099,
+  8494096, 8494097, 8494086, 8494102, 7792399, 8494101, 8494086, 8494097, 8494083, 8494082, 8494099, 8494100,
+  8494087, 8494101, 8494086, 8494090, 8494083, 8494092, 8494093, 8494082, 7795215, 8494094, 8494095, 7793926,
+  7797779, 8494095, 8494101, 8494090, 7795469, 8494099, 8494105, 8494097, 8494099, 8494086, 8494090, 8494087,
+  8494095, 8494102, 8494088, 7798280, 8494085, 8494102, 8494102, 8494084, 8494084, 8494099, 8494092, 8494096,
+  8494100, 8494101, 8494100, 8494086, 7795731, 8494090, 8494086, 8494101, 7796243, 7798534, 8494090, 7801346,
+  8494096, 8494090, 7793171, 8494102, 8494096, 8494096, 8494100, 8494095, 7798801, 7801108, 8494112, 8494081,
+  7796757, 8494089, 8494096, 8494097, 8494099, 8494101, 8494086, 8494096, 7799050, 7799317, 8494090, 8494095,
+  8494101, 8494090, 8494095, 8494090, 7793423, 7801619, 8494082, 8494094, 8494085, 8494102, 8494086, 8494095,
+  8494084, 8494082, 8494086, 8494085, 8494083, 8494107, 8494083, 8494084, 7802118, 8494094, 8494095, 8494094,
+  8494085, 7802378, 8494090, 8494092, 8494122, 8494101, 7802639, 8494123, 8494099, 8494088, 7803923, 8494100,
+  8494097, 8494083, 8494084, 8494094, 8494082, 7807238, 7799554, 7802902, 8494086, 8494100, 8494092, 8494081,
+  8494082, 8494089, 8494084, 8494086, 8494086, 7804435, 7804932, 8494081, 8494090, 7806982, 8494092, 8494105,
+  7803658, 8494082, 8494095, 8494097, 8494090, 8494100, 8494106, 7803413, 7805199, 7805459, 7805702, 8494101,
+  7809301, 8494107, 8494086, 8494088, 7805967, 8494083, 8494086, 8494082, 7809555, 8494102, 8494095, 7806726,
+  8494097, 7808533, 8494090, 8494099, 8494101, 8494102, 8494104, 8494100, 8494094, 8494096, 8494095, 8494088,
+  8494089, 8494096, 8494102, 8494099, 8494084, 8494082, 8494100, 8494106, 7810581, 8494097, 8494085, 8494103,
+  8494087, 8494082, 8494099, 8494090, 8494097, 8494083, 8494093, 8494101, 8494101, 8494090, 8494097, 7812627,
+  7809811, 7811604, 8494107, 8494096, 7808770, 8494082, 8494095, 8494082, 8494100, 7810054, 8494094, 8494101,
+  8494088, 7812106, 8494102, 8494085, 8494095, 8494102, 7810313, 8494088, 8494082, 7813382, 8494088, 8494081,
+  8494093, 8494090, 8494086, 8494101, 8494101, 7812888, 7811846, 8494096, 7813147, 8494088, 7813651, 8494086,
+  8494082, 8494101, 8494101, 8494100, 8494086, 7815687, 8494082, 8494089, 8494087, 8494101, 7813909, 8494093,
+  8494100, 7814163, 8494096, 8494101, 8494094, 8494090, 8494095, 8494100, 8494102, 8494086, 8494123, 8494086,
+  8494082, 8494100, 8494094, 7814419, 7814676, 8494099, 8494100, 8494083, 8494100, 8494097, 8494083, 7815174,
+  7816451, 8494099, 7816199, 7814939, 8494095, 8494083, 7816725, 8494089, 8494100, 8494086, 7817474, 8494095,
+  7815439, 8494099, 8494095, 8494081, 7815955, 8494100, 8494085, 7816966, 7817223, 8494088, 8494089, 8494085,
+  8494095, 7817740, 7818511, 8494090, 7818250, 8494099, 8494099, 8494092, 7818003, 7818762, 8494100, 8494088,
+  8494097, 8494096, 8494100, 8494099, 8494107, 8494102, 8494102, 8494082, 8494089, 7820564, 8494084, 7812374,
+  7819014, 8494100, 8494101, 8494095, 8494086, 8494087, 8494087, 8494100, 8494094, 8494089, 8494082, 8494090,
+  8494093, 8494090, 8494085, 8494101, 8494087, 8494086, 7819279, 8494089, 8494086, 8494085, 7819526, 8494082,
+  8494096, 8494092, 8494107, 8494083, 8494101, 8494100, 8494084, 8494081, 8494092, 8494097, 8494086, 8494090,
+  8494095, 8494100, 8494094, 8494093, 7820810, 8494095, 7821062, 7821318, 8494100, 8494095, 8494087, 8494092,
+  8494088, 7820051, 7819796, 8494081, 8494099, 7822851, 8494107, 8494105, 8494095, 7823119, 8494082, 8494089,
+  8494083, 7822099, 7822338, 7821837, 8494099, 8494086, 7824653, 7820315, 8494087, 8494088, 8494107, 7821589,
+  8494112, 8494099, 8494093, 8494094, 8494099, 7822609, 8494082, 8494102, 8494099, 7823631, 8494101, 7823379,
+  8494100, 8494099, 8494095, 8494100, 8494112, 8494101, 7824147, 7823886, 8494089, 8494081, 8494087, 8494083,
+  7825154, 8494085, 8494081, 8494090, 8494086, 7825422, 8494107, 7828490, 7824394, 8494088, 8494099, 8494095,
+  8494093, 7825939, 8494096, 8494112, 8494086, 7827475, 8494095, 8494099, 8494095, 8494082, 8494095, 8494095,
+  8494093, 8494102, 8494095, 8494090, 8494082, 8494112, 7824928, 8494096, 8494082, 7829263, 8494090, 8494095,
+  8494088, 8494101, 8494089, 8494095, 8494092, 8494094, 7825679, 8494082, 8494093, 7829769, 8494101, 8494082,
+  8494086, 8494097, 8494102, 8494087, 8494088, 8494101, 7826690, 8494090, 8494082, 8494090, 7831814, 8494085,
+  8494100, 7834383, 7827978, 7832066, 8494088, 8494093, 7831566, 7832335, 7834901, 8494123, 7833606, 7833363,
+  8494088, 8494089, 8494100, 7833862, 7834648, 8494094, 8494094, 8494088, 8494084, 8494099, 8494096, 8494084,
+  8494099, 8494082, 7835401, 7836179, 8494096, 8494094, 8494084, 8494093, 8494101, 8494095, 8494087, 7833131,
+  8494083, 8494084, 8494100, 8494085, 8494102, 8494102, 8494099, 8494102, 8494099, 8494102, 8494082, 8494093,
+  7837199, 8494097, 7835654, 8494081, 8494086, 8494082, 8494101, 8494096, 8494097, 8494084, 8494086, 8494084,
+  8494096, 8494092, 8494097, 8494082, 7837446, 8494099, 8494102, 7836422, 8494100, 7835925, 8494100, 7836678,
+  8494101, 8494101, 8494101, 8494096, 8494082, 8494101, 7839508, 8494096, 8494097, 8494095, 8494086, 8494095,
+  8494087, 8494083, 8494102, 8494087, 8494089, 8494088, 8494083, 8494083, 8494112, 8494100, 8494084, 8494086,
+  8494094, 8494100, 8494099, 8494102, 8494122, 8494101, 8494090, 8494088, 7838468, 8494097, 7839750, 7838978,
+  7837968, 7841043, 8494086, 8494085, 8494101, 8494088, 8494100, 8494100, 7836944, 8494097, 8494100, 8494084,
+  8494086, 7840021, 7840518, 8494086, 7839239, 8494101, 8494089, 8494082, 8494100, 7840268, 8494093, 8494093,
+  7841542, 8494094, 8494101, 8494082, 7838741, 8494100, 8494095, 7841286, 8494100, 8494099, 7843599, 7840778,
+  8494100, 8494093, 8494100, 8494099, 8494081, 7841808, 8494095, 8494095, 8494099, 8494081, 8494083, 8494083,
+  8494097, 7843074, 8494090, 8494100, 8494089, 8494082, 7842310, 8494094, 8494081, 8494089, 7842063, 8494095,
+  8494093, 8494101, 7842579, 8494093, 8494102, 8494086, 8494094, 8494082, 8494082, 7842818, 8494100, 8494099,
+  8494102, 7844102, 7843334, 8494081, 8494089, 8494087, 8494082, 8494095, 8494086, 8494088, 8494086, 8494112,
+  7844614, 8494123, 7844362, 8494081, 8494096, 8494081, 8494095, 7844884, 8494090, 7845395, 8494096, 8494085,
+  8494086, 8494086, 7845908, 8494092, 8494086, 8494084, 8494102, 8494095, 8494090, 8494088, 8494100, 7849218,
+  8494099, 7851021, 8494104, 8494094, 7845642, 8494083, 8494092, 7849999, 7847170, 8494095, 8494082, 8494102,
+  7846406, 8494099, 8494094, 8494095, 8494082, 7846671, 7847942, 8494095, 8494086, 7846163, 8494090, 8494083,
+  8494092, 7854342, 8494102, 7852294, 7851266, 7849760, 7850762, 8494081, 8494082, 7850517, 7852038, 8494087,
+  8494088, 8494089, 8494093, 8494107, 7849478, 8494093, 8494096, 8494102, 7854595, 7848450, 8494085, 8494082,
+  8494100, 7853574, 8494096, 7853062, 8494104, 8494081, 8494088, 8494107, 8494083, 8494082, 7851526, 8494095,
+  7855108, 8494100, 8494090, 7854086, 7852564, 7851782, 8494093, 8494100, 8494100, 8494090, 8494092, 8494086,
+  7852805, 8494096, 8494081, 8494101, 8494096, 8494087, 8494088, 8494082, 8494099, 8494102, 8494086, 8494101,
+  8494100, 8494084, 8494101, 8494095, 8494081, 8494082, 8494088, 8494100, 8494082, 8494089, 8494094, 8494101,
+  8494107, 8494101, 8494093, 8494092, 7856390, 8494093, 8494101, 8494094, 8494086, 8494082, 8494086, 8494082,
+  7855622, 7855366, 8494093, 7855874, 8494099, 7856642, 8494090, 8494100, 8494102, 8494090, 8494093, 8494100,
+  8494094, 8494123, 8494092, 8494093, 8494099, 8494096, 8494081, 8494084, 8494090, 7856134, 8494087, 8494086,
+  8494089, 8494089, 8494102, 8494089, 8494094, 8494094, 8494101, 8494090, 8494095, 8494112, 8494085, 7858452,
+  8494087, 8494085, 8494093, 8494102, 8494088, 8494086, 8494087, 8494088, 7859471, 8494099, 8494101, 8494092,
+  8494093, 8494093, 8494093, 7857158, 8494093, 8494101, 7854863, 8494100, 8494093, 8494093, 7853328, 8494104,
+  8494101, 8494097, 8494099, 8494084, 8494093, 8494095, 8494101, 8494101, 8494099, 8494100, 8494085, 8494088,
+  8494086, 8494094, 8494101, 8494095, 8494090, 8494082, 8494099, 8494082, 8494082, 8494100, 7859733, 8494086,
+  7858183, 8494088, 8494089, 8494086, 8494107, 8494095, 8494088, 8494086, 8494090, 7857670, 8494095, 8494087,
+  8494100, 8494095, 8494095, 8494102, 8494082, 7857414, 8494100, 8494100, 8494093, 8494102, 8494095, 8494090,
+  8494099, 8494082, 8494100, 8494090, 8494100, 7858950, 8494101, 8494096, 8494093, 7858694, 8494099, 8494122,
+  8494084, 8494099, 7859977, 8494099, 8494095, 8494081, 8494100, 8494093, 8494082, 8494081, 8494100, 8494086,
+  8494095, 8494097, 8494099, 8494101, 8494096, 7861525, 8494083, 8494090, 8494081, 8494100, 8494095, 8494101,
+  8494082, 8494085, 8494096, 8494095, 7860482, 8494087, 8494099, 8494087, 7860230, 7859206, 8494093, 8494095,
+  7860746, 8494104, 8494099, 8494094, 8494090, 8494101, 8494102, 8494081, 7864083, 8494099, 8494082, 8494100,
+  8494095, 8494083, 8494086, 7863055, 8494104, 8494094, 8494089, 8494090, 8494090, 8494094, 8494083, 8494093,
+  7862022, 7865103, 8494095, 8494092, 8494082, 8494090, 7863554, 8494100, 8494093, 8494093, 8494086, 8494101,
+  8494090, 7863810, 7864326, 7862293, 7865610, 7861766, 8494093, 8494081, 8494089, 7864586, 8494096, 7865363,
+  7864838, 7867155, 8494102, 8494081, 8494095, 8494081, 8494099, 8494083, 7867652, 8494085, 8494090, 8494087,
+  8494088, 8494099, 7867412, 8494096, 8494101, 8494093, 8494099, 8494084, 7867919, 8494082, 7868162, 8494099,
+  8494100, 7868692, 7869190, 8494100, 8494104, 8494101, 7866634, 8494107, 8494085, 8494082, 8494082, 7869698,
+  8494090, 8494094, 8494090, 7869446, 8494086, 8494083, 8494092, 7865871, 8494090, 8494086, 8494081, 8494090,
+  7868422, 8494100, 8494096, 8494094, 8494096, 8494087, 8494090, 8494102, 8494095, 8494090, 8494082, 8494081,
+  8494100, 8494100, 7868934, 8494082, 8494100, 7872007, 7871240, 7871497, 8494084, 8494090, 8494095, 7873037,
+  8494086, 8494095, 8494084, 8494097, 8494083, 7869973, 7870735, 7870229, 8494100, 8494100, 7870485, 8494094,
+  8494095, 8494086, 8494100, 8494082, 8494090, 8494086, 7872781, 8494097, 7870978, 8494100, 8494081, 8494090,
+  7873542, 7875334, 7871749, 7872262, 8494087, 8494099, 8494082, 8494090, 8494081, 8494092, 7872533, 8494099,
+  8494102, 7873284, 8494100, 7873798, 8494087, 7874068, 8494101, 8494102, 8494096, 8494090, 8494090, 8494092,
+  7874580, 7875086, 8494095, 8494085, 8494095, 7874836, 7874325, 8494100, 8494100, 8494101, 8494106, 7875590,
+  8494085, 8494095, 7876866, 7878150, 8494090, 7877122, 8494106, 8494101, 7882256, 7878924, 8494097, 7879183,
+  8494094, 8494087, 7876115, 7875862, 7877389, 7876374, 8494092, 7879949, 8494088, 8494095, 7885318, 7878658,
+  8494107, 7877907, 8494097, 8494096, 8494090, 8494097, 7880984, 8494112, 8494100, 8494107, 8494102, 8494083,
+  8494084, 8494096, 8494082, 8494082, 8494099, 8494101, 7881226, 8494086, 8494082, 8494093, 7886602, 7881487,
+  7883526, 7887876, 7883021, 7882003, 8494090, 8494096, 7883266, 8494093, 8494099, 7884806, 7884294, 8494081,
+  8494082, 8494099, 8494082, 8494090, 8494123, 8494090, 7884550, 8494096, 8494093, 8494096, 8494082, 8494097,
+  7885574, 8494096, 7885062, 8494101, 8494096, 8494093, 8494090, 7884053, 8494085, 8494092, 7886352, 8494112,
+  8494096, 8494099, 8494100, 8494099, 7888655, 8494100, 7888902, 8494094, 8494100, 8494100, 8494086, 8494090,
+  8494082, 8494093, 8494081, 7886112, 8494090, 8494088, 8494101, 8494088, 7891477, 8494082, 7887366, 8494082,
+  8494082, 8494097, 7890182, 7888134, 8494086, 8494084, 8494100, 7889427, 8494082, 8494092, 8494093, 7888390,
+  8494086, 8494099, 8494086, 8494102, 7889172, 8494097, 8494100, 8494100, 8494101, 8494096, 8494099, 8494087,
+  7889922, 8494089, 8494093, 8494081, 8494082, 8494101, 7891721, 8494093, 7890694, 8494097, 8494090, 8494086,
+  8494100, 7890950, 8494093, 8494101, 8494082, 8494086, 8494100, 8494097, 8494090, 8494095, 8494086, 8494101,
+  8494102, 8494099, 8494102, 8494081, 8494085, 8494107, 8494085, 8494086, 8494107, 8494097, 8494100, 8494084,
+  8494095, 8494099, 8494083, 8494086, 8494092, 8494082, 7892486, 8494100, 8494086, 8494086, 8494094, 8494099,
+  8494099, 8494101, 8494102, 8494093, 8494083, 7892999, 8494094, 7891206, 8494089, 8494082, 8494084, 8494081,
+  8494082, 8494101, 8494086, 7891973, 7896066, 8494086, 8494100, 8494083, 8494094, 7876628, 8494085, 8494100,
+  8494087, 7893784, 7895060, 8494087, 8494107, 8494081, 8494082, 7895317, 8494083, 8494082, 7895558, 7894279,
+  7897096, 8494100, 8494099, 8494090, 8494102, 8494094, 7896334, 7894031, 8494101, 8494086, 8494082, 8494082,
+  8494087, 7894805, 7896586, 8494101, 8494084, 8494101, 8494087, 7897364, 8494085, 8494101, 8494086, 8494101,
+  8494093, 8494086, 8494100, 8494100, 8494090, 7895814, 8494086, 8494082, 8494099, 8494086, 8494086, 8494100,
+  8494095, 8494095, 8494107, 8494094, 8494095, 8494095, 8494086, 8494082, 8494086, 8494083, 8494096, 8494099,
+  8494093, 8494097, 8494099, 8494082, 8494096, 8494100, 8494100, 8494099, 8494086, 7896842, 8494088, 8494097,
+  8494094, 7807502, 8494092, 8494101, 8494086, 8494099, 8494101, 8494100, 8494090, 8494087, 8494088, 8494089,
+  8494093, 7898637, 8494092, 8494093, 7877653, 8494084, 8494090, 8494093, 8494088, 8494086, 8494100, 8494099,
+  7897603, 8494101, 8494104, 8494082, 8494087, 8494084, 7898121, 7901717, 8494097, 8494090, 8494089, 7898890,
+  8494101, 7901188, 8494093, 7898382, 8494095, 8494100, 7901461, 8494094, 7899411, 8494102, 8494093, 8494085,
+  8494088, 8494081, 8494100, 8494086, 8494082, 8494085, 8494092, 8494096, 8494101, 8494088, 8494102, 8494102,
+  8494100, 8494090, 7902225, 7902984, 8494095, 8494101, 8494123, 7901954, 8494096, 8494100, 8494092, 7903509,
+  7905031, 8494088, 8494100, 7900436, 7899925, 7904268, 8494090, 7902485, 7811087, 8494086, 8494094, 8494085,
+  8494093, 7904532, 8494088, 8494084, 8494090, 8494100, 8494093, 8494089, 8494102, 8494090, 8494086, 8494093,
+  8494090, 8494089, 7900947, 8494082, 7902722, 8494097, 8494083, 7905286, 8494081, 8494090, 8494090, 8494122,
+  8494090, 8494090, 8494086, 7905812, 7903750, 8494089, 8494095, 8494095, 8494099, 8494082, 7904772, 8494084,
+  8494095, 7905542, 8494096, 7907093, 8494086, 7906067, 8494090, 8494100, 8494088, 8494102, 8494087, 8494096,
+  8494097, 8494093, 8494089, 8494086, 7900181, 8494100, 8494084, 7906835, 8494097, 8494093, 8494099, 7906306,
+  7906566, 8494093, 8494099, 8494086, 8494082, 8494090, 7907842, 8494100, 8494085, 8494084, 8494086, 8494093,
+  8494090, 7907334, 8494086, 8494081, 7908372, 8494083, 8494081, 8494094, 8494101, 8494087, 8494088, 8494097,
+  8494086, 7908117, 8494092, 8494096, 8494090, 8494088, 8494086, 8494097, 8494101, 7908620, 7909652, 8494101,
+  8494095, 8494103, 8494104, 8494093, 8494105, 8494086, 8494101, 8494102, 7907603, 8494099, 8494101, 8494101,
+  8494102, 8494099, 7909126, 8494086, 8494082, 8494082, 8494085, 7909385, 8494099, 8494093, 7910916, 7910406,
+  8494088, 8494083, 7909907, 8494099, 8494082, 8494090, 8494099, 8494095, 7910150, 8494093, 8494104, 8494097,
+  8494090, 8494095, 8494101, 7908883, 8494102, 8494086, 8494096, 8494086, 7911187, 8494099, 8494112, 8494085,
+  8494082, 8494082, 8494090, 8494096, 8494084, 8494086, 8494097, 8494096, 8494093, 8494086, 8494100, 8494095,
+  7912198, 7910662, 8494093, 7911430, 7914501, 7911686, 8494101, 7911951, 8494101, 7914246, 8494092, 8494081,
+  8494094, 7915014, 8494102, 8494083, 8494100, 8494099, 8494093, 8494101, 8494086, 8494102, 7912966, 7915528,
+  8494095, 7916034, 8494095, 8494094, 7918086, 8494086, 8494095, 8494092, 7915778, 7916832, 8494099, 8494100,
+  7916550, 8494102, 8494096, 8494100, 8494083, 7916310, 7912717, 8494101, 8494085, 8494095, 8494100, 8494099,
+  7918598, 8494093, 7915284, 8494099, 7913487, 8494089, 7918863, 7919874, 7917331, 8494096, 8494094, 7917830,
+  8494099, 8494096, 8494086, 8494100, 7918346, 7917077, 7920134, 8494086, 8494081, 8494096, 8494097, 8494099,
+  8494086, 8494096, 8494101, 7919622, 8494093, 8494100, 8494090, 8494095, 8494095, 7923465, 8494100, 8494099,
+  8494096, 7923984, 8494084, 8494099, 8494087, 7920390, 8494096, 8494082, 8494092, 8494087, 8494086, 8494090,
+  7925257, 7912463, 8494102, 8494082, 7922707, 8494086, 7921154, 8494102, 8494086, 8494102, 7921414, 8494084,
+  8494095, 8494100, 8494100, 8494096, 8494101, 8494101, 8494099, 7922954, 8494082, 8494107, 8494082, 8494100,
+  8494086, 8494093, 7926022, 8494083, 8494101, 8494084, 8494104, 8494090, 8494082, 8494089, 8494107, 8494093,
+  8494100, 7925002, 7926274, 7923221, 8494090, 8494093, 7924230, 8494082, 8494100, 8494101, 8494101, 8494086,
+  8494099, 8494082, 8494099, 8494092, 8494096, 8494082, 8494095, 7924486, 8494089, 8494087, 8494099, 8494086,
+  7923718, 8494086, 8494100, 8494102, 8494090, 8494087, 8494100, 8494090, 8494086, 7927827, 8494099, 7927566,
+  8494095, 7930133, 8494095, 8494099, 8494086, 8494100, 8494086, 8494090, 8494089, 8494085, 8494101, 8494096,
+  8494089, 8494090, 8494101, 8494099, 8494093, 8494088, 7928584, 8494082, 8494112, 8494101, 8494100, 8494095,
+  8494082, 8494086, 8494101, 8494095, 8494100, 8494083, 8494096, 7929109, 7925510, 8494087, 8494088, 7931151,
+  8494090, 8494082, 8494092, 8494093, 8494102, 7927046, 7929606, 7928834, 8494097, 7928326, 8494100, 8494101,
+  8494099, 7932934, 7928096, 8494087, 8494095, 8494081, 8494102, 7930389, 8494082, 7930630, 8494086, 8494093,
+  8494103, 8494101, 8494100, 8494093, 8494084, 7931910, 8494099, 7931398, 7929871, 7932166, 8494083, 8494123,
+  8494082, 8494095, 8494099, 8494093, 8494082, 8494086, 8494094, 8494082, 8494092, 8494099, 8494096, 7934996,
+  7935253, 8494083, 8494094, 8494104, 8494093, 8494085, 8494089, 8494099, 8494090, 8494081, 8494101, 8494081,
+  8494085, 7931663, 8494099, 8494101, 8494097, 7936019, 8494100, 8494101, 8494090, 8494106, 8494100, 8494105,
+  8494082, 7932687, 8494102, 8494081, 8494099, 8494099, 8494099, 7935494, 7933446, 8494100, 8494090, 8494086,
+  8494089, 8494094, 8494082, 7932425, 8494082, 8494084, 8494102, 8494082, 8494081, 8494089, 8494094, 8494090,
+  8494093, 8494094, 8494090, 7934215, 7935750, 8494099, 8494094, 8494086, 8494083, 8494099, 8494085, 8494081,
+  8494087, 8494088, 8494095, 8494099, 7938061, 8494086, 8494093, 8494082, 8494082, 8494096, 8494089, 8494101,
+  8494099, 8494100, 8494094, 8494101, 8494090, 8494104, 8494101, 8494093, 8494107, 8494095, 7938311, 7936272,
+  7937812, 7938581, 8494086, 8494090, 8494093, 8494081, 8494101, 8494101, 8494101, 8494107, 7939078, 7939860,
+  8494087, 8494089, 8494090, 8494094, 8494100, 7934477, 8494084, 8494085, 7940368, 8494090, 8494101, 8494102,
+  7941908, 7941647, 8494095, 8494099, 8494082, 8494100, 8494095, 7942675, 8494081, 7940870, 8494101, 8494100,
+  8494099, 8494101, 8494102, 8494100, 8494082, 8494086, 8494088, 8494089, 7942150, 8494094, 8494095, 8494093,
+  8494084, 8494092, 8494099, 8494094, 8494095, 8494094, 7941122, 8494095, 8494100, 8494083, 8494090, 8494083,
+  8494101, 8494107, 7939586, 8494083, 8494099, 8494085, 8494090, 8494087, 8494088, 8494089, 8494094, 7943439,
+  8494092, 8494093, 8494086, 8494122, 8494083, 8494097, 8494102, 7941382, 8494092, 8494101, 8494082, 7942402,
+  8494104, 8494097, 7945478, 8494090, 8494082, 8494100, 8494122, 8494083, 8494084, 8494100, 8494101, 8494102,
+  8494082, 8494083, 7945994, 8494085, 8494099, 8494087, 8494081, 8494082, 8494090, 8494081, 8494097, 8494093,
+  7943938, 8494095, 8494082, 8494082, 8494081, 8494099, 8494100, 8494083, 8494084, 7942918, 8494104, 8494087,
+  8494088, 8494107, 7943189, 8494087, 8494123, 8494093, 8494094, 8494095, 8494122, 8494097, 8494087, 8494090,
+  8494101, 8494101, 8494102, 8494093, 8494100, 8494095, 8494082, 7944458, 8494095, 8494082, 8494099, 8494112,
+  8494103, 8494086, 8494093, 8494083, 8494093, 8494090, 8494082, 8494082, 8494088, 8494095, 8494086, 8494086,
+  8494092, 7946502, 8494099, 8494095, 7944198, 8494097, 7948051, 8494101, 8494090, 8494101, 8494088, 8494095,
+  8494099, 8494086, 8494085, 7945237, 8494095, 8494100, 8494083, 7945734, 7948290, 7947782, 8494082, 8494092,
+  8494085, 8494084, 8494088, 8494100, 8494100, 8494100, 8494101, 8494094, 8494101, 7947284, 8494087, 8494090,
+  8494084, 8494097, 7949332, 8494088, 8494095, 8494082, 8494099, 7946762, 8494102, 7938843, 8494101, 8494089,
+  8494086, 7947541, 8494092, 8494081, 8494090, 7946255, 7949062, 8494082, 8494086, 8494100, 8494093, 8494090,
+  8494086, 7949570, 8494099, 7951887, 8494093, 8494099, 8494101, 7952399, 8494084, 8494081, 7951379, 8494082,
+  8494095, 8494081, 7953417, 8494100, 8494097, 8494093, 8494082, 8494099, 8494094, 8494095, 7951622, 8494090,
+  8494094, 8494086, 8494099, 8494081, 8494088, 8494088, 8494087, 8494101, 7955221, 8494084, 7953670, 7954195,
+  7954708, 8494082, 8494094, 8494083, 8494090, 8494089, 8494100, 8494101, 7955469, 7956229, 8494089, 7950608,
+  8494088, 7952906, 8494084, 7957012, 8494102, 8494095, 8494095, 8494086, 7954453, 8494100, 8494081, 8494100,
+  8494085, 8494100, 8494101, 8494101, 8494083, 8494090, 8494093, 8494093, 8494101, 8494090, 8494093, 8494095,
+  8494095, 8494095, 8494097, 8494092, 8494101, 7953167, 8494095, 8494101, 7955974, 7956755, 7944980, 8494101,
+  8494107, 8494102, 8494097, 7957258, 8494100, 8494086, 8494082, 8494100, 8494086, 8494096, 8494082, 8494088,
+  8494101, 8494081, 8494083, 8494102, 8494093, 8494086, 8494100, 7956486, 7807751, 7957768, 8494089, 8494086,
+  8494086, 8494092, 7959565, 8494095, 7957517, 8494096, 8494096, 8494090, 7960080, 8494102, 8494094, 8494101,
+  8494087, 7959832, 8494093, 8494082, 8494107, 8494086, 8494081, 8494086, 8494102, 8494099, 8494088, 8494082,
+  8494083, 8494085, 7958274, 7958022, 8494096, 8494096, 8494099, 8494122, 8494092, 8494093, 8494122, 8494090,
+  8494090, 8494103, 8494095, 8494099, 8494099, 7958799, 7958547, 8494095, 8494099, 7960595, 8494097, 8494086,
+  8494103, 8494086, 8494090, 8494105, 8494100, 8494096, 8494107, 8494122, 7960332, 8494090, 8494093, 7959042,
+  8494088, 7961615, 8494097, 8494089, 8494092, 7961862, 8494101, 8494099, 8494100, 8494101, 8494082, 8494094,
+  7962125, 7961094, 7960838, 8494081, 8494086, 8494096, 8494089, 8494101, 8494101, 8494102, 7962630, 7961368,
+  8494093, 8494100, 8494087, 8494088, 8494089, 8494097, 7962388, 7963148, 7963405, 8494087, 7963663, 8494106,
+  8494090, 8494096, 8494086, 7964436, 7962901, 7963919, 8494093, 8494104, 8494093, 8494086, 8494107, 8494101,
+  8494087, 7965459, 8494084, 8494099, 8494084, 8494086, 8494101, 8494083, 8494088, 8494092, 8494093, 7966474,
+  8494095, 8494122, 8494100, 7972362, 7965715, 8494096, 8494099, 7965973, 7965187, 7971345, 8494094, 8494099,
+  8494101, 7967240, 7972111, 7968022, 7973653, 8494092, 7967757, 8494089, 7968271, 8494112, 7968778, 8494102,
+  8494099, 8494100, 7969813, 7964943, 8494088, 8494097, 8494084, 7969043, 8494092, 8494087, 8494102, 8494094,
+  8494095, 8494088, 8494086, 7970061, 8494094, 7972618, 8494086, 8494096, 8494104, 7970570, 8494082, 8494107,
+  8494093, 8494100, 8494082, 8494096, 8494097, 8494083, 8494095, 7973382, 7970324, 8494101, 8494093, 8494097,
+  8494088, 8494100, 8494092, 7974683, 8494094, 7974421, 8494096, 8494095, 8494094, 8494082, 8494094, 7973141,
+  8494100, 7974918, 8494082, 8494095, 8494089, 8494107, 8494100, 8494092, 7975431, 8494094, 8494095, 8494088,
+  7979014, 7975690, 8494096, 8494100, 8494101, 8494089, 8494093, 8494086, 8494100, 7972885, 8494086, 8494087,
+  8494093, 8494089, 8494090, 7975958, 8494082, 7973892, 8494084, 7976454, 8494086, 8494088, 7975170, 8494082,
+  7976202, 8494089, 8494086, 7979526, 7976710, 7976962, 8494086, 7974161, 8494089, 8494097, 8494090, 8494082,
+  7977478, 8494092, 7977734, 8494082, 8494101, 8494089, 8494082, 8494089, 8494090, 7809037, 8494087, 8494101,
+  8494099, 7979270, 7978260, 7977237, 7978004, 7978773, 8494086, 8494101, 7980312, 8494101, 8494090, 8494101,
+  8494100, 8494095, 8494082, 8494086, 8494081, 8494085, 8494083, 8494083, 8494090, 7978502, 8494087, 8494090,
+  8494101, 7980042, 8494083, 8494084, 8494107, 8494085, 7980819, 8494082, 8494089, 8494090, 8494087, 8494099,
+  8494093, 7980566, 8494099, 7981058, 8494095, 8494102, 7979795, 8494095, 8494086, 8494094, 8494083, 8494088,
+  8494101, 8494095, 8494095, 8494101, 7981331, 8494089, 8494090, 8494097, 8494094, 8494089, 8494093, 7982338,
+  8494090, 8494097, 8494107, 8494088, 8494095, 8494085, 8494099, 7981574, 7981856, 8494090, 8494090, 7983370,
+  8494090, 8494086, 8494100, 8494100, 8494099, 8494090, 8494092, 8494081, 8494081, 8494085, 8494099, 8494086,
+  8494084, 8494086, 8494092, 8494086, 8494084, 7983622, 8494090, 8494101, 8494099, 7982101, 7985161, 8494093,
+  8494086, 8494097, 8494100, 7984659, 8494101, 8494097, 8494093, 8494094, 7982607, 8494095, 8494107, 8494082,
+  7982867, 8494101, 8494094, 7983110, 8494101, 8494094, 8494102, 8494101, 8494100, 8494099, 8494101, 8494085,
+  8494094, 8494086, 8494101, 8494101, 8494090, 8494094, 8494082, 8494107, 7987215, 7986447, 7984147, 8494102,
+  8494086, 7983891, 8494100, 8494100, 8494102, 8494095, 8494086, 8494084, 8494085, 8494099, 8494101, 8494083,
+  8494084, 7984390, 8494082, 8494092, 8494095, 8494094, 8494090, 8494089, 8494094, 8494093, 8494093, 7985939,
+  8494086, 8494102, 7985414, 7987475, 7984916, 8494097, 8494088, 8494100, 7990293, 8494086, 8494085, 8494093,
+  8494101, 8494081, 8494101, 8494106, 7990036, 7989781, 8494086, 8494089, 8494085, 8494095, 8494088, 8494088,
+  8494090, 7986694, 8494083, 8494089, 8494087, 8494092, 8494100, 8494095, 8494102, 7990555, 8494082, 8494100,
+  8494101, 8494107, 8494100, 7990803, 8494095, 8494082, 7988746, 7987717, 8494082, 8494081, 8494088, 8494083,
+  8494101, 8494085, 8494099, 7992583, 8494088, 8494089, 8494086, 8494088, 7992844, 8494085, 8494100, 8494093,
+  8494088, 8494089, 8494084, 8494086, 8494100, 8494095, 8494083, 8494095, 8494084, 8494085, 8494094, 8494085,
+  8494100, 8494082, 8494101, 8494083, 7989506, 7992074, 8494095, 8494090, 8494099, 7991823, 8494086, 8494101,
+  8494101, 8494093, 8494122, 7993103, 8494082, 8494101, 7991571, 7991315, 8494082, 8494089, 8494095, 8494082,
+  7994899, 8494088, 8494082, 8494089, 8494095, 8494083, 8494085, 8494101, 8494101, 8494086, 8494099, 8494093,
+  8494094, 8494085, 8494090, 8494087, 8494088, 8494087, 8494092, 8494101, 8494099, 8494094, 8494094, 8494088,
+  7994127, 7991060, 8494099, 7993615, 8494099, 8494102, 8494101, 8494090, 8494100, 8494100, 8494102, 7993883,
+  8494089, 8494086, 8494099, 8494090, 8494123, 8494090, 8494090, 8494101, 8494082, 8494082, 8494081, 8494096,
+  8494086, 8494086, 8494082, 8494085, 8494099, 8494094, 7992335, 8494083, 7995411, 8494082, 8494090, 7993364,
+  7996175, 8494094, 7994383, 8494084, 8494099, 8494081, 8494095, 8494106, 8494082, 8494086, 8494087, 7996435,
+  8494093, 8494092, 8494087, 8494086, 8494095, 8494095, 8494099, 7996935, 8494099, 7994626, 7995919, 8494102,
+  8494094, 8494086, 8000275, 8494085, 8494100, 7997698, 8494103, 8494099, 8494095, 8494086, 8494093, 8494092,
+  8494088, 8494084, 8494084, 8494101, 7997453, 8494082, 8494096, 8494112, 8494084, 8494090, 8494095, 8494082,
+  8494087, 8494088, 7999759, 7995168, 8494097, 7998733, 8002323, 7998223, 8494092, 8494094, 8494094, 8494085,
+  8494090, 8494081, 7999507, 8494100, 8494101, 8494095, 8494094, 8494093, 8494101, 8003091, 8000020, 8494082,
+  8000790, 8494083, 8494084, 8494101, 8001026, 8494086, 8494101, 8002570, 8494086, 8494090, 8494083, 8494084,
+  8494082, 8494090, 8494083, 8494089, 8494087, 8494099, 8000528, 8004358, 8494097, 8494100, 8494095, 8494095,
+  8494093, 8494084, 8494101, 8494100, 8494089, 8494101, 8494102, 8005397, 8494095, 8494095, 8494112, 8494104,
+  8494086, 7995650, 8494095, 8494083, 8494094, 8494093, 8494082, 8494100, 8494081, 8494090, 8494081, 8007430,
+  8494101, 8494099, 8494090, 8008468, 8494086, 8494086, 8006675, 8005139, 8494100, 8007686, 8494096, 8007957,
+  8494082, 8494092, 8494102, 8494083, 8494096, 8494100, 8494086, 8494087, 8494082, 8494082, 8008966, 8494101,
+  8494099, 8006150, 8494101, 8494100, 8494107, 8005652, 8494102, 8494086, 8494089, 8494093, 8494096, 8005894,
+  8494099, 8007174, 8494099, 8494096, 8008199, 8009235, 8494099, 8494081, 8009474, 8006412, 8494122, 8494086,
+  8006927, 8009990, 8494112, 8494082, 8494093, 8494107, 8494090, 8494090, 8494090, 8494089, 8494085, 8494090,
+  8494097, 8494099, 8494100, 8494083, 8494095, 8009748, 8494082, 8494099, 8010511, 8494101, 8494102, 8494097,
+  8494082, 8494095, 8494093, 8494106, 8494086, 8494101, 8494082, 8494094, 8494090, 8494100, 8494082, 8494085,
+  8494083, 8494100, 8494090, 8494102, 8494086, 8010754, 8494095, 8494086, 8494096, 8494097, 8494096, 8494090,
+  8011010, 8011285, 8494102, 8494095, 8004115, 8494100, 8494097, 8494107, 8494104, 8011526, 8494106, 8494086,
+  8494100, 8494094, 8494095, 8494081, 8013845, 8494095, 8494082, 8494096, 8011782, 8012293, 8494100, 8494094,
+  8494095, 8494088, 8494085, 8494090, 8494085, 8494086, 8494100, 8013314, 8494086, 8012049, 8494095, 8494101,
+  8494082, 8494090, 8494082, 8012806, 8494085, 8014101, 8012550, 8494100, 8013574, 8494081, 8494102, 8494095,
+  8494086, 8494082, 8494086, 8494086, 8494095, 8494092, 8494082, 8494095, 8494097, 8494104, 8494100, 8494089,
+  8494099, 8494097, 8494102, 8008706, 8016130, 8494102, 8494095, 8494099, 8016646, 8494100, 8494089, 8494090,
+  8494099, 8014858, 8494084, 8018952, 8494090, 8015888, 8494093, 8019988, 8016403, 8017939, 8494107, 8014356,
+  8019732, 8494095, 8494101, 8015368, 8494082, 8494086, 8494086, 8494107, 8016902, 8494102, 8494112, 8494100,
+  8494101, 8494082, 8494086, 8494097, 8494096, 8494090, 8494088, 8019462, 8494088, 8494101, 8494107, 8494101,
+  8494093, 8494096, 8494088, 8494101, 8494093, 8494090, 8020243, 8494101, 8494095, 8494086, 8494100, 8017414,
+  8020486, 8494104, 8494097, 8494099, 8494107, 8494089, 8494101, 8023046, 8494099, 8494095, 8494090, 8017679,
+  8494090, 8494097, 8494090, 8022035, 8018451, 8494093, 8494086, 8010259, 8022790, 8494094, 8494090, 8494090,
+  8494097, 8494096, 8494099, 8021001, 8494096, 8494099, 8494096, 8494100, 8494086, 8021254, 8494093, 8020757,
+  8494102, 8494099, 8494086, 8494100, 8494090, 8494083, 8494100, 8023311, 8494085, 8494086, 8494081, 8022291,
+  8494096, 8494081, 8494092, 8494081, 8021518, 8494105, 8025103, 8494092, 8494086, 8494100, 8494100, 8494090,
+  8494089, 8494084, 8023554, 8023813, 8494100, 8494102, 8024070, 8494086, 8494099, 8494086, 8494082, 8494093,
+  8494099, 8494095, 8024838, 8494082, 8494093, 8494099, 8494090, 8025862, 8494102, 8494082, 8494102, 8494090,
+  8494090, 8494082, 8494093, 8494090, 8025364, 8494081, 8494081, 8021766, 8494084, 8024596, 8494089, 8494099,
+  8494102, 8494099, 8494099, 8494092, 8494090, 8494090, 8494086, 8494085, 8494099, 8027153, 8494095, 8494100,
+  8494094, 8026121, 8494104, 8494095, 8494093, 8494086, 8494082, 8494082, 8025620, 8494101, 8027654, 8494081,
+  8494092, 8494089, 8494123, 8494095, 8494090, 8494094, 8028418, 8494093, 8494096, 8494112, 8494099, 8494095,
+  8494099, 8494087, 8494090, 8494083, 8494084, 8494085, 8494088, 8494087, 8026632, 8494089, 8028166, 8494096,
+  8494086, 8494093, 8027923, 8494100, 8494089, 8494097, 8029971, 8494101, 8029716, 8494085, 8494081, 8494103,
+  8494104, 8494096, 8494086, 8494101, 8030216, 8494087, 8494082, 8030735, 8494095, 8494107, 8494100, 8494082,
+  8494085, 8030980, 8494094, 8494090, 8494081, 8494112, 8030486, 8494112, 8494097, 8494081, 8494095, 8494090,
+  8494099, 8494094, 8494102, 8029204, 8494101, 8494102, 8494095, 8494082, 8494096, 8494081, 8494099, 8494095,
+  8494082, 8494102, 8494083, 8494083, 8028678, 8494092, 8494087, 8494085, 8494097, 8028934, 8031496, 8494090,
+  8494095, 8031242, 8494082, 8494100, 8494100, 8032006, 8031759, 8494095, 8494107, 8494081, 8494092, 8494082,
+  8494102, 8494100, 8494101, 8494101, 8494102, 8494096, 8032514, 8494081, 8494081, 8033807, 8036371, 8027405,
+  8494084, 8494093, 8494101, 8033030, 8494100, 8494090, 8035078, 8035590, 8494097, 8494082, 8034317, 8494090,
+  8494100, 8494082, 8494090, 8494099, 8494095, 8494090, 8037122, 8494083, 8034067, 8034565, 8037638, 8035847,
+  8494100, 8036866, 8494083, 8494090, 8494101, 8036102, 8494087, 8494095, 8494089, 8494112, 8494087, 8494099,
+  8035348, 8039445, 8494082, 8494103, 8494102, 8494101, 8494099, 8494088, 8040469, 8494105, 8494090, 8494104,
+  8494092, 8037890, 8494094, 8494081, 8494084, 8039942, 8494084, 8494100, 8494101, 8041218, 8494123, 8494103,
+  8494088, 8494095, 8494090, 8494093, 8038658, 8494095, 8041734, 8494084, 8040198, 8038165, 8040710, 8494099,
+  8494097, 8494100, 8041482, 8494122, 8494085, 8494097, 8039687, 8494088, 8036617, 8494094, 8494100, 8494100,
+  8494093, 8494090, 8494099, 8494083, 8494104, 8042754, 8042506, 8494100, 8494092, 8494086, 8494099, 8494104,
+  8494106, 8494097, 8494107, 8494099, 8045062, 8042242, 8494112, 8044290, 8044820, 8043014, 8494099, 8046342,
+  8494086, 8494090, 8494096, 8494090, 8494090, 8042003, 8045830, 8494096, 8494081, 8494082, 8494090, 8046852,
+  8494086, 8494086, 8494100, 8494101, 8048386, 8043785, 8494089, 8494096, 8048646, 8045574, 8494123, 8043522,
+  8494097, 8043283, 8494112, 8044550, 8047637, 8494093, 8494092, 8494095, 8049171, 8047376, 8494090, 8494122,
+  8494106, 8494102, 8494085, 8494099, 8494102, 8050950, 8050703, 8494102, 8494101, 8494084, 8047112, 8051478,
+  8494094, 8047878, 8494083, 8494092, 8494095, 8494093, 8049414, 8049666, 8051732, 8051206, 8494088, 8494095,
+  8053013, 8494102, 8494088, 8048923, 8494102, 8494093, 8494088, 8054037, 8052757, 8494096, 8494095, 8494095,
+  8494090, 8494086, 8494102, 8494093, 8494090, 8494100, 8494100, 8494101, 8494101, 8494086, 8494101, 8494096,
+  8494099, 8494099, 8494093, 8494082, 8494102, 8494095, 8494102, 8494096, 8494081, 8494095, 8494086, 8494082,
+  8494082, 8494086, 8494090, 8494082, 8494081, 8052486, 8494090, 8494099, 8494093, 8052230, 8050197, 8494094,
+  8494100, 8051974, 8494102, 8494099, 8494099, 8494093, 8494100, 8055055, 8494095, 8055567, 8494088, 8055316,
+  8494112, 8494099, 8494081, 8494084, 8494090, 8494096, 8053254, 8494082, 8494099, 8494101, 8053514, 8494093,
+  8494102, 8054278, 8494096, 8494086, 8494081, 8494099, 8056077, 8494095, 8494101, 8054790, 8494102, 8056585,
+  8494099, 8494092, 8494099, 8494096, 8057107, 8494102, 8494102, 8494096, 8055825, 8494093, 8054534, 8494093,
+  8494082, 8056335, 8494093, 8494093, 8057350, 8494106, 8494086, 8057606, 8494097, 8053767, 8494102, 8494099,
+  8494095, 8057876, 8494096, 8058132, 8494100, 8494099, 8494102, 8494104, 8494094, 8494090, 8494094, 8494090,
+  8494090, 8058370, 8494100, 8494093, 8494083, 8058886, 8494102, 8494095, 8494093, 8494099, 8059407, 8494094,
+  8494090, 8494082, 8062227, 8059152, 8060437, 8059909, 8494084, 8494099, 8494090, 8494088, 8061702, 8494086,
+  8494100, 8494082, 8494084, 8494092, 8494085, 8494089, 8494082, 8494086, 8494086, 8494096, 8062735, 8061457,
+  8059669, 8494096, 8494086, 8494082, 8494089, 8494088, 8494107, 8494086, 8494093, 8494101, 8061954, 8494100,
+  8494097, 8494107, 8062470, 8494107, 8494090, 8494082, 8494093, 8494085, 8494101, 8494101, 8494101, 8494086,
+  8494090, 8494090, 8494082, 8494090, 8494085, 8494087, 8494087, 8494086, 8494099, 8494088, 8494088, 8063497,
+  8062982, 8494106, 8494086, 8494093, 8494082, 8494107, 8494081, 8494100, 8494103, 8063234, 8494096, 8494101,
+  8065295, 8063750, 8494104, 8494085, 8494099, 8494107, 8494083, 8494093, 8064002, 8494093, 8494089, 8494093,
+  8064262, 8065039, 8065538, 8494100, 8494084, 8494101, 8494095, 8494082, 8494090, 8494100, 8494094, 8494096,
+  8494095, 8494099, 8494102, 8494096, 8494102, 8494100, 8494082, 8494102, 8065802, 8494101, 8494101, 8494101,
+  8494099, 8494087, 8494100, 8494082, 8494086, 8494082, 8494086, 8494100, 8494095, 8494100, 8494102, 8494090,
+  8494086, 8494097, 8494086, 8494100, 8494099, 8494101, 8494096, 8494102, 8494087, 8494088, 8494092, 8066822,
+  8494094, 8494090, 8494095, 8494094, 8494085, 8494086, 8494097, 8494082, 8494086, 8494101, 8494101, 8494089,
+  8494088, 8494103, 8494099, 8494102, 8494107, 8494099, 8494090, 8494093, 8494099, 8494085, 8494100, 8067075,
+  8494101, 8494084, 8068362, 8070914, 8070163, 8494107, 8494099, 8069129, 8494099, 8070413, 8068618, 8066063,
+  8494093, 8069909, 8068878, 8494086, 8494100, 8069653, 8494099, 8072211, 8494101, 8494096, 8494092, 8494103,
+  8070671, 8494100, 8494097, 8494086, 8071939, 8494083, 8494101, 8494086, 8494101, 8494096, 8494088, 8072455,
+  8494087, 8074511, 8494093, 8494082, 8494082, 8494095, 8494100, 8494092, 8494094, 8494093, 8494082, 8494101,
+  8494087, 8071188, 8494088, 8077327, 8494084, 8073734, 8076551, 8494100, 8494089, 8494100, 8069397, 8494092,
+  8076813, 8075022, 8071439, 8494081, 8494107, 8494084, 8073491, 8074260, 8494092, 8494087, 8072718, 8077583,
+  8494089, 8494082, 8494107, 8076034, 8494093, 8075541, 8494093, 8078606, 8494083, 8494100, 8494097, 8078858,
+  8494082, 8494101, 8494086, 8494102, 8494105, 8494122, 8494099, 8494085, 8494094, 8494086, 8075791, 8075270,
+  8494082, 8076294, 8494097, 8494082, 8494082, 8494082, 8494090, 8494100, 8077830, 8079620, 8494096, 8494099,
+  8494086, 8494083, 8081172, 8494102, 8494093, 8494097, 8078342, 8494092, 8079110, 8494101, 8494100, 8494090,
+  8494095, 8078101, 8494093, 8494084, 8494101, 8494101, 8494086, 8494100, 8494088, 8077077, 8494089, 8494090,
+  8494100, 8494101, 8494082, 8494100, 8494093, 8494085, 8494101, 8494087, 8494088, 8079381, 8494095, 8494099,
+  8494092, 8494093, 8494100, 8494086, 8080644, 8080134, 8494101, 8494093, 8494101, 8494099, 8494099, 8494086,
+  8494104, 8494099, 8081683, 8494085, 8083471, 8494093, 8494096, 8494100, 8494100, 8494096, 8083974, 8494101,
+  8494095, 8494086, 8494101, 8494089, 8494099, 8494101, 8494101, 8494090, 8494082, 8494089, 8494082, 8082182,
+  8081922, 8494081, 8494095, 8494099, 8082451, 8494082, 8494082, 8083718, 8494086, 8494081, 8081423, 8494094,
+  8494096, 8494102, 8494092, 8494082, 8079892, 8082963, 8494100, 8494097, 8494099, 8494090, 8494093, 8494094,
+  8494082, 8494094, 8494083, 8085773, 8083206, 8494090, 8494086, 8086542, 8494099, 8494099, 8494081, 8494086,
+  8494083, 8494087, 8494098, 8494101, 8494087, 8494088, 8092687, 8494093, 8494099, 8088079, 8494096, 8090114,
+  8494086, 8087827, 8494097, 8091398, 8087044, 8494100, 8086293, 8089351, 8088578, 8494104, 8089610, 8092163,
+  8091910, 8091152, 8086030, 8494085, 8494086, 8494087, 8096783, 8088851, 8087316, 8494081, 8494102, 8494082,
+  8494081, 8494105, 8093446, 8093715, 8494086, 8085267, 8494100, 8494090, 8494106, 8494105, 8494092, 8494088,
+  8094210, 8494096, 8494092, 8091690, 8095494, 8095238, 8089878, 8094485, 8092426, 8096522, 8494095, 8094982,
+  8494122, 8090667, 8092944, 8494081, 8494093, 8494088, 8494096, 8494095, 8494086, 8494102, 8093972, 8494101,
+  8494081, 8494082, 8494093, 8494086, 8494083, 8494086, 8096006, 8494090, 8098067, 8494090, 8494081, 8494082,
+  8494086, 8494100, 8494081, 8494093, 8494081, 8494085, 8494083, 8494100, 8094725, 8097286, 8098311, 8494088,
+  8494089, 8494090, 8494083, 8494092, 8494093, 8494101, 8494095, 8494107, 8494095, 8494105, 8494099, 8101140,
+  8097045, 8494084, 8494100, 8494104, 8494087, 8494088, 8494107, 8494085, 8494093, 8104966, 8494094, 8494094,
+  8100102, 8101391, 8494099, 8494093, 8097555, 8101651, 8098836, 8494082, 8097813, 8494086, 8494100, 8102150,
+  8494102, 8494122, 8494107, 8494090, 8494085, 8494082, 8494104, 8494099, 8494085, 8494096, 8494087, 8494088,
+  8494093, 8494083, 8098581, 8494086, 8102925, 8101898, 8494095, 8100884, 8104202, 8494081, 8494099, 8494100,
+  8103190, 8103951, 8102406, 8099096, 8494099, 8494087, 8494107, 8494100, 8494101, 8494081, 8494082, 8494112,
+  8494093, 8494089, 8105222, 8494082, 8494082, 8494101, 8494094, 8494097, 8107782, 8494097, 8494092, 8494101,
+  8494095, 8108052, 8494095, 8494088, 8095787, 8108301, 8494082, 8494099, 8494081, 8106003, 8106765, 8494086,
+  8494082, 8494102, 8494081, 8494102, 8494090, 8105734, 8104469, 8494099, 8494101, 8494083, 8494099, 8494095,
+  8494081, 8494093, 8494086, 8494095, 8494082, 8494094, 8494092, 8108563, 8106256, 8494101, 8107526, 8494101,
+  8107017, 8494099, 8494093, 8110093, 8494082, 8494100, 8494092, 8111123, 8494096, 8494099, 8111636, 8494102,
+  8494099, 8494082, 8113158, 8494090, 8112645, 8494081, 8494100, 8494081, 8494097, 8494103, 8494082, 8494086,
+  8494096, 8494086, 8494100, 8494084, 8113427, 8494088, 8494086, 8494096, 8494102, 8494082, 8494082, 8494090,
+  8494090, 8494099, 8109062, 8494093, 8494086, 8109317, 8494081, 8494112, 8494096, 8494090, 8494086, 8494112,
+  8494082, 8112148, 8494082, 8494081, 8494092, 8494095, 8494081, 8494084, 8109839, 8494101, 8494099, 8494092,
+  8113676, 8111379, 8494101, 8494090, 8494096, 8494082, 8494095, 8494101, 8494107, 8114965, 8494086, 8494088,
+  8494099, 8494090, 8494100, 8494086, 8114445, 8494084, 8494112, 8494096, 8494084, 8494085, 8494099, 8494100,
+  8494095, 8494092, 8111882, 8494086, 8494095, 8114182, 8116245, 8494095, 8494084, 8116745, 8494083, 8494100,
+  8494100, 8494090, 8494105, 8494088, 8494090, 8494089, 8494091, 8112911, 8494084, 8116492, 8494123, 8494092,
+  8494097, 8494101, 8494084, 8112404, 8117251, 8494087, 8494094, 8494095, 8494093, 8494101, 8494107, 8494096,
+  8494100, 8494095, 8494093, 8494087, 8494088, 8494101, 8494082, 8494086, 8115462, 8494104, 8494082, 8494095,
+  8494096, 8118287, 8494081, 8494086, 8494100, 8494101, 8494100, 8494122, 8494099, 8494082, 8115202, 8494107,
+  8494100, 8121620, 8117781, 7899655, 8115976, 8109577, 8494096, 8494093, 8494097, 8118548, 8118798, 8118024,
+  8494099, 8122381, 8494087, 8494084, 8119572, 8494099, 8494102, 8494090, 8120344, 8119046, 8494101, 8494090,
+  8494102, 8494099, 8494088, 8494093, 8120834, 8494096, 8494092, 8494097, 8123142, 8120083, 8494094, 8494088,
+  8494102, 8494087, 8120618, 8494081, 8494086, 8494083, 8119824, 8494100, 8121862, 8494112, 8494099, 8494100,
+  8121098, 8494093, 8494090, 8494093, 8494090, 8494094, 8494094, 8494099, 8122626, 8494083, 8494112, 8123408,
+  8494097, 8124169, 8494088, 8494086, 8494090, 8494099, 8494092, 8494090, 8494122, 8494096, 8494083, 8494097,
+  8494085, 8494099, 8494087, 8494081, 8494089, 8494083, 8494101, 8494082, 8494093, 8494094, 8494095, 8494081,
+  8494090, 8494083, 8494095, 8122900, 8123654, 8494089, 8494094, 8494104, 8494090, 8494081, 8494092, 8124693,
+  8494094, 8494084, 8494085, 8494087, 8494088, 8124424, 8494100, 8494101, 8494081, 8129289, 8494093, 8494093,
+  8126223, 8494086, 8494087, 8494099, 8126996, 8494101, 8494082, 8124930, 8121357, 8130562, 8494095, 8126470,
+  8494081, 8494082, 8494090, 8494100, 8125445, 8494090, 8494081, 8494094, 8494081, 8494082, 8129539, 8494093,
+  8494084, 8126726, 8113927, 8133646, 8494101, 8127754, 8494097, 8494100, 8128277, 8494094, 8131599, 8494086,
+  8494087, 8494087, 8494083, 8494081, 8123924, 8129045, 8494087, 8494081, 8494095, 8132871, 8494088, 8494086,
+  8494086, 8494090, 8494095, 8494093, 8494086, 8494095, 8494082, 8494100, 8494101, 8494101, 8494086, 8134161,
+  8494096, 8494081, 8494086, 8494083, 8494097, 8494084, 8494086, 8494089, 8494088, 8494088, 8494090, 8494082,
+  8494099, 8494089, 8494102, 8494099, 8136975, 8494097, 8494096, 8494100, 8494100, 8494101, 8135700, 8494101,
+  8494084, 8133381, 8494106, 8134663, 8494088, 8133129, 8494090, 8494101, 8494092, 8494093, 8494084, 8132367,
+  8494081, 8494097, 8494081, 8494082, 8494100, 8494086, 8134422, 8494081, 8494087, 8494099, 8494083, 8135178,
+  8494108, 8131334, 8494089, 8494088, 8494082, 8494092, 8494097, 8494092, 8494084, 8494082, 8494101, 8134934,
+  8494088, 8494089, 8494107, 8494100, 8494095, 8494102, 8137486, 8494082, 8494083, 8136465, 8494085, 8494081,
+  8135444, 8494088, 8494081, 8494082, 8494082, 8494092, 8494085, 8494086, 8494095, 8494088, 8494097, 8494090,
+  8137222, 8494082, 8494082, 8494082, 8494095, 8494086, 8494086, 8494101, 8494090, 8494100, 8494101, 8494093,
+  8494093, 8133903, 8494095, 8494082, 8494099, 8494096, 8136198, 8494086, 8494101, 8135956, 8137734, 8137986,
+  8494082, 8494095, 8494107, 8494101, 8494086, 8494093, 8494097, 8494082, 8494100, 8494095, 8494101, 8494101,
+  8494100, 8494093, 8494099, 8494095, 8494100, 8494093, 8494090, 8494101, 8494101, 8138772, 8138498, 8138255,
+  8494084, 8494081, 8494100, 8494100, 8494096, 8494096, 8494088, 8494081, 8141327, 8494082, 8139014, 8494102,
+  8136723, 8494095, 8494101, 8494081, 8140038, 8494101, 8494092, 8494101, 8494102, 8139778, 8494097, 8494082,
+  8494099, 8140550, 8494093, 8494095, 8494082, 8140290, 8494089, 8494099, 8139526, 8494083, 8143123, 8144646,
+  8494096, 8494093, 8494082, 8494100, 8494099, 8494081, 8494086, 8494093, 8494082, 8141826, 8494099, 8139284,
+  8140819, 8145670, 8494090, 8494101, 8494081, 8494082, 8494100, 8494086, 8142857, 8143622, 8146444, 8494093,
+  8494082, 8494122, 8494099, 8494090, 8144134, 8494112, 8494093, 8146691, 8494090, 8494094, 8494102, 8494093,
+  8494099, 8494102, 8494112, 8494104, 8494092, 8494090, 8494094, 8494093, 8144390, 8494097, 8494096, 8494083,
+  8494082, 8494094, 8494102, 8494101, 8143878, 8494082, 8494096, 8494089, 8143370, 8144905, 8494123, 8494095,
+  8494086, 8147716, 8494096, 8494090, 8494082, 8494099, 8494093, 8494094, 8494095, 8145414, 8494095, 8494089,
+  8494099, 8494086, 8494094, 8494093, 8148998, 8494101, 8494088, 8494095, 8494084, 8494099, 8494081, 8146957,
+  8494081, 8494094, 8494096, 8494093, 8494086, 8494090, 8494100, 8494083, 8147460, 8494085, 8494086, 8494087,
+  8494088, 8494095, 8494082, 8494100, 8494092, 8494093, 8147206, 8494093, 8494102, 8494104, 8494081, 8494099,
+  8494100, 8494083, 8494084, 8147974, 8494104, 8494092, 8150025, 8494107, 8494081, 8128524, 8494083, 8149252,
+  8494084, 8145935, 8494083, 8494095, 8494082, 8148233, 8494099, 8494097, 8494102, 8494101, 8494094, 8150287,
+  8494102, 8148738, 8494090, 8494099, 8494100, 8149510, 8494102, 8148500, 8494095, 8494090, 8494085, 8494099,
+  8494094, 8150799, 8149766, 8151047, 8494093, 8151554, 8494081, 8152322, 8494095, 8494102, 8494087, 8494102,
+  8131853, 8494100, 8494101, 8494102, 8494093, 8494083, 8154637, 8494096, 8494097, 8494087, 8494099, 8494089,
+  8153098, 8494093, 8494094, 8494095, 8494094, 8154895, 8154118, 8494102, 8494099, 8153619, 8152084, 8157958,
+  8494083, 8494090, 8494085, 8494086, 8494082, 8494097, 8494087, 8165408, 8164611, 8151829, 8494093, 8494081,
+  8494095, 8494100, 8494100, 8494082, 8155411, 8494100, 8494083, 8494084, 8494085, 8494104, 8153360, 8494112,
+  8494107, 8494100, 8494100, 8494101, 8494093, 8494094, 8155151, 8494081, 8494097, 8494083, 8494084, 8494100,
+  8494093, 8494082, 8159234, 8163078, 8156682, 8160518, 8158214, 8166150, 8157198, 8158991, 8494090, 8494084,
+  8494093, 8158483, 8494100, 8494101, 8494096, 8494082, 8157715, 8494092, 8494081, 8160258, 8494102, 8494084,
+  8494095, 8494082, 8494081, 8159756, 8494093, 8166662, 8164111, 8494086, 8156448, 8494082, 8494083, 8164870,
+  8494082, 8165638, 8167683, 8494096, 8494100, 8165122, 8160042, 8494082, 8494090, 8165894, 8166933, 8494096,
+  8494099, 8494081, 8494081, 8494090, 8494097, 8494085, 8494092, 8494104, 8494101, 8494082, 8167187, 8494090,
+  8494085, 8494086, 8494102, 8494086, 8494085, 8494093, 8494097, 8494090, 8494081, 8494094, 8167433, 8168211,
+  8494099, 8494094, 8494086, 8494096, 8494093, 8494099, 8494099, 8494086, 8494081, 8494081, 8494082, 8494096,
+  8494100, 8168710, 8494107, 8494082, 8168975, 8494095, 8494101, 8167942, 8494093, 8494101, 8494107, 8494093,
+  8494095, 8494094, 8494099, 8494095, 8494095, 8166419, 8494099, 8170003, 8494088, 8494102, 8494082, 8168463,
+  8494102, 8494090, 8170246, 8494099, 8494093, 8494102, 8169218, 8494087, 8494090, 8494082, 8169478, 8494099,
+  8494092, 8494082, 8494094, 8494095, 8494094, 8494100, 8494101, 8175110, 8494093, 8494092, 8494090, 8494085,
+  8494093, 8494095, 8494095, 8494100, 8494112, 8174089, 8494099, 8494081, 8494082, 8494102, 8494090, 8494093,
+  8494086, 8494093, 8494089, 8494090, 8494095, 8494100, 8494099, 8494088, 8494093, 8174853, 8174351, 8173585,
+  8494099, 8494082, 8173843, 8171528, 8171286, 8494088, 8494101, 8173062, 8176660, 8494101, 8494100, 8494100,
+  8494101, 8174598, 8494112, 8494099, 8494082, 8494095, 8494095, 8177939, 8175622, 8494095, 8494089, 8494095,
+  8494090, 8494088, 8494086, 8494092, 8494090, 8494097, 8494095, 8176130, 8175891, 8494090, 8494100, 8494082,
+  8494101, 8175370, 8494095, 8494095, 8494093, 8494094, 8494095, 8176902, 8494096, 8494081, 8494082, 8494093,
+  8179209, 8494081, 8494092, 8179970, 8176399, 8494089, 8177414, 8494099, 8494086, 8494090, 8179722, 8494095,
+  8494093, 8494094, 8180742, 8494081, 8494100, 8494097, 8494101, 8494085, 8494081, 8494093, 8494088, 8494101,
+  8181763, 8494084, 8494089, 8494086, 8494087, 8494095, 8494086, 8494087, 8494089, 8494101, 8494100, 8182540,
+  8494090, 8494093, 8494097, 8494081, 8494096, 8494083, 8494084, 8494092, 8185356, 8494087, 8494088, 8494089,
+  8494081, 8181510, 8494092, 8494082, 8180997, 8494095, 8184838, 8185613, 8494086, 8494082, 8182036, 8494101,
+  8494087, 8494086, 8177679, 8494085, 8494096, 8494107, 8494096, 8494097, 8494101, 8494099, 8494092, 8494083,
+  8494081, 8494094, 8181267, 8179463, 8494101, 8494086, 8494101, 8494088, 8494101, 8494100, 8494100, 8184079,
+  8494093, 8494085, 8494089, 8180243, 8494088, 8494100, 8494090, 8494081, 8183042, 8494083, 8494112, 8494095,
+  8183302, 8494086, 8494084, 8494088, 8494090, 8494100, 8494092, 8494093, 8494086, 8184332, 8494094, 8186115,
+  8182281, 8494086, 8494100, 8494101, 8494095, 8494086, 8494100, 8184578, 8187654, 8494093, 8494093, 8186630,
+  8494102, 8494099, 8494108, 8494086, 8494097, 8494090, 8183821, 8494088, 8494101, 8187156, 8494082, 8494088,
+  8185107, 8494090, 8494096, 8188429, 8494090, 8494089, 8494090, 8494100, 8494101, 8494087, 8188173, 8494103,
+  8494084, 8494095, 8494093, 8189973, 8494096, 8494099, 8494085, 8494084, 8494083, 8494093, 8494101, 8494090,
+  8494123, 8494092, 8189461, 8188947, 8494100, 8189205, 8185871, 8189699, 8494087, 8190726, 8494082, 8494087,
+  8494088, 8192010, 8190468, 8494094, 8494092, 8190221, 8188682, 8186383, 8494090, 8494094, 8494101, 8494093,
+  8494100, 8191253, 8494090, 8191507, 8190985, 8494100, 8191750, 8494100, 8494086, 8494082, 8494101, 8494086,
+  8494102, 8494102, 8494082, 8494087, 8494087, 8494093, 8494082, 8494088, 8494082, 8494094, 8193286, 8494090,
+  8494095, 8494102, 8192522, 8494086, 8494101, 8494100, 8494087, 8192778, 8494096, 8193045, 8494096, 8494095,
+  8494086, 8494096, 8192288, 8494086, 8494083, 8193542, 8494090, 8494100, 8494101, 8494086, 8494095, 8494094,
+  8494096, 8494099, 8494112, 8494095, 8193798, 8494093, 8494086, 8494099, 8494103, 8494095, 8194050, 8494101,
+  8494084, 8494081, 8494087, 8494122, 8494081, 8494082, 8494090, 8494088, 8494083, 8494086, 8494097, 8494096,
+  8494096, 8195862, 8194575, 8194826, 8195593, 8194325, 8494103, 8494100, 8195087, 8494085, 8196354, 8494100,
+  8494099, 8494100, 8494101, 8494101, 8494103, 8494099, 8494086, 8494095, 8494086, 8494086, 8494100, 8196104,
+  8494101, 8494095, 8494090, 8494102, 8494090, 8494086, 8494082, 8494100, 8494100, 8198920, 8195348, 8198421,
+  8197135, 8199183, 8201235, 8494104, 8494100, 8494083, 8494107, 8494083, 8494085, 8198658, 8201484, 8494086,
+  8494086, 8494082, 8198159, 8202501, 8494084, 8196879, 8494101, 8494084, 8494081, 8200723, 8494093, 8494101,
+  8199942, 8202761, 8202242, 8494096, 8494095, 8494095, 8494102, 8494101, 8494084, 8494085, 8494097, 8494102,
+  8494101, 8203795, 8494090, 8494094, 8494095, 8201734, 8203541, 8204045, 8494094, 8200207, 8205076, 8202003,
+  8494100, 8204307, 8494086, 8494096, 8494097, 8494101, 8494095, 8494090, 8494101, 8494099, 8204802, 8203270,
+  8203010, 8494101, 8494086, 8206607, 8494100, 8494123, 8494081, 8494090, 8494084, 8494093, 8494084, 8494092,
+  8205826, 8494092, 8207114, 8494102, 8494086, 8494104, 8205582, 8205327, 8494093, 8494086, 8207892, 8209427,
+  8204564, 8494101, 8494089, 8494101, 8494081, 8494105, 8206868, 8494094, 8208655, 8494087, 8494096, 8494089,
+  8494100, 8494096, 8494090, 8211981, 8494083, 8207375, 8208386, 8494100, 8494083, 8494095, 8494090, 8494088,
+  8494101, 8494086, 8212234, 8214544, 8210196, 8494087, 8494095, 8494084, 8494100, 8494092, 8210442, 8494093,
+  8213011, 8494086, 8494100, 8494107, 8213269, 8494099, 8494102, 8494090, 8494088, 8494103, 8210954, 8494100,
+  8209922, 8213506, 8494095, 8494086, 8215304, 8494099, 8494107, 8212495, 8494100, 8494086, 8213770, 8216339,
+  8214278, 8214790, 8211728, 8494096, 8494100, 8494099, 8494099, 8494099, 8494102, 8212758, 8217865, 8494095,
+  8494090, 8494095, 8494094, 8494086, 8494093, 8494090, 8214031, 8494112, 8494095, 8494086, 8494099, 8215827,
+  8494083, 8494089, 8494082, 8494082, 8494100, 8494089, 8494123, 8206355, 8494102, 8494094, 8494084, 8494088,
+  8494094, 8494099, 8494090, 8494093, 8494090, 8494084, 8494093, 8494094, 8494101, 8494086, 8494095, 8217096,
+  8494086, 8494099, 8494082, 8494094, 8494100, 8494101, 8494107, 8494087, 8494088, 8494090, 8494101, 8494085,
+  8494092, 8494093, 8494082, 8494089, 8494099, 8494096, 8494094, 8494094, 8494095, 8494086, 8216586, 8494094,
+  8494104, 8217613, 8494101, 8494099, 8494083, 8494083, 8494081, 8494094, 8494094, 8494083, 8494090, 8494101,
+  8494081, 8494090, 8494092, 8494084, 8494100, 8494093, 8494085, 8494097, 8494092, 8494085, 8494082, 8494097,
+  8219155, 8494099, 8494094, 8494097, 8494097, 8494102, 8494105, 8494095, 8494101, 8494101, 8220687, 8219419,
+  8494100, 8494096, 8219923, 8494086, 8494101, 8216853, 8494096, 8494104, 8494099, 8494100, 8494101, 8217354,
+  8220425, 8494095, 8494123, 8221186, 8494101, 8221709, 8220947, 8221446, 8219667, 8218886, 8494100, 8222479,
+  8494085, 8494082, 8494101, 8223507, 8494101, 8494086, 8494090, 8221954, 8494099, 8494094, 8494085, 8494084,
+  8494086, 8222728, 8494089, 8223253, 8494087, 8494086, 8494088, 8494096, 8494082, 8224017, 8494096, 8224271,
+  8494097, 8494100, 8225288, 8494101, 8222229, 8494082, 8494089, 8223759, 8494107, 8494092, 8494082, 8494090,
+  8494089, 8494086, 8224788, 8222997, 8494085, 8224528, 8494101, 8494095, 8225551, 8494104, 8494087, 8494090,
+  8494094, 8494095, 8225813, 8494102, 8494084, 8494087, 8494101, 8225044, 8226323, 8494099, 8494101, 8494082,
+  8494099, 8494086, 8494090, 8494095, 8226826, 8494096, 8494084, 8494084, 8494097, 8494090, 8494102, 8494083,
+  8494088, 8494092, 8228354, 8494085, 8230420, 8228885, 8231430, 8494095, 8494097, 8494086, 8494090, 8230660,
+  8228610, 8227603, 8128782, 8494081, 8227334, 8494101, 8494099, 8494095, 8494084, 8494084, 8494102, 8494093,
+  8226584, 8494084, 8494087, 8494097, 8494093, 8494092, 8230150, 8231682, 8494094, 8494083, 8494104, 8228115,
+  8494100, 8494102, 8494088, 8232202, 8494095, 8494085, 8494101, 8494093, 8494088, 8494095, 8494100, 8494097,
+  8494107, 8233491, 8229908, 8230922, 8494095, 8494101, 8494093, 8494101, 8494099, 8494107, 8494082, 8494081,
+  8231187, 8494082, 8232450, 8494107, 8494086, 8494093, 8232710, 8494090, 8494095, 8234246, 8233994, 8494100,
+  8494082, 8494095, 8494082, 8494085, 8232976, 8494102, 8235273, 8494086, 8233749, 8494099, 8494086, 8494102,
+  8494086, 8235027, 8494102, 8494100, 8494100, 8494089, 8494095, 8494090, 8494095, 8494090, 8494096, 8234511,
+  8238082, 8494112, 8236303, 8494099, 8494102, 8494101, 8494085, 8234772, 8494082, 8236546, 8494095, 8494095,
+  8494093, 8494092, 8494085, 8494094, 8494095, 8235792, 8494102, 8494100, 8494093, 8236806, 8494093, 8494092,
+  8239375, 8494086, 8494090, 8494099, 8494082, 8494100, 8494082, 8494101, 8494095, 8240646, 8494086, 8494093,
+  8494082, 8239110, 8494089, 8494090, 8238598, 8494086, 8494102, 8494088, 8494090, 8237583, 8494102, 8494086,
+  8237075, 8494093, 8240902, 8240134, 8494095, 8494084, 8241926, 8494090, 8494082, 8494086, 8494100, 8494082,
+  8494090, 8237844, 8238869, 8239622, 8241418, 8494082, 8494084, 8245769, 8494099, 8242182, 8494090, 8494100,
+  8494086, 8494096, 8494086, 8494095, 8246278, 8494089, 8494082, 8239894, 8242950, 8494090, 8494099, 8494099,
+  8243718, 8494093, 8494099, 8494100, 8244742, 8494084, 8242451, 8494099, 8494099, 8494086, 8494086, 8246532,
+  8494082, 8494101, 8243462, 8494093, 8245510, 8494082, 8235540, 8494089, 8494090, 8246804, 8248326, 8247814,
+  8494099, 8494093, 8494096, 8248853, 8249101, 8494099, 8494093, 8249350, 8494082, 8494100, 8247315, 8494095,
+  8494096, 8494100, 8494102, 8494102, 8494086, 8494096, 8494081, 8494082, 8494099, 8494082, 8494082, 8494086,
+  8253190, 8248070, 8494099, 8494090, 8494089, 8494093, 8494093, 8251913, 8494095, 8494096, 8494081, 8494096,
+  8240403, 8494099, 8250899, 8494102, 8494082, 8249622, 8494102, 8249862, 8251142, 8494082, 8494093, 8252934,
+  8494090, 8494086, 8494107, 8494112, 8494100, 8494096, 8494096, 8494082, 8250644, 8494099, 8494082, 8251398,
+  8494102, 8494086, 8253446, 8494086, 8494099, 8494100, 8252164, 8494082, 8494101, 8494086, 8494086, 8494101,
+  8494112, 8494099, 8494096, 8494099, 8494100, 8494089, 8494082, 8494090, 8254997, 8494096, 8494095, 8494094,
+  8494099, 8494087, 8494096, 8494101, 8494095, 8494093, 8494083, 8494085, 8494101, 8494084, 8494100, 8494090,
+  8494086, 8494085, 8494082, 8494082, 8494101, 8494086, 8494095, 8494095, 8494082, 8494086, 8494095, 8252422,
+  8494082, 8494102, 8494090, 8256277, 8494082, 8494100, 8494086, 8494086, 8494086, 8494099, 8494096, 8494095,
+  8494085, 8494096, 8494095, 8494081, 8494101, 8494092, 8494082, 8494085, 8494086, 8494092, 8253702, 8494094,
+  8494095, 8494095, 8494101, 8494082, 8494099, 8258306, 8494096, 8494101, 8494096, 8257030, 8255508, 8256531,
+  8494086, 8494084, 8494094, 8494095, 8494101, 8256006, 8494086, 8259846, 8494083, 8256774, 8494086, 8494100,
+  8494096, 8257295, 8494093, 8260105, 8494107, 8494100, 8494097, 8494102, 8494097, 8494095, 8261638, 8494104,
+  8494085, 8259586, 8494100, 8260614, 8494086, 8261382, 8494104, 8494087, 8494093, 8494107, 8494093, 8494081,
+  8257538, 8257808, 8494081, 8494082, 8262150, 8262402, 8494089, 8494102, 8494086, 8260358, 8494122, 8494096,
+  8494090, 8260874, 8494099, 8261122, 8494082, 8494112, 8494099, 8494096, 8264710, 8494086, 8264467, 8494082,
+  8494100, 8494096, 8494090, 8494100, 8494089, 8262662, 8494100, 8494097, 8266003, 8494090, 8494090, 8494101,
+  8494082, 8494095, 8494082, 8494086, 8494122, 8494100, 8262918, 8494101, 8494095, 8494100, 8494086, 8265493,
+  8494082, 8263942, 8494086, 8494099, 8263430, 8494086, 8494086, 8494107, 8264207, 8494084, 8265238, 8494101,
+  8264981, 8494086, 8494082, 8494094, 8494099, 8263695, 8494095, 8494095, 8494099, 8494083, 8494094, 8265734,
+  8494090, 8494096, 8494081, 8494101, 8494089, 8494088, 8494093, 8494088, 8494103, 8494084, 8494093, 8494100,
+  8494090, 8494101, 8494090, 8494092, 8494081, 8268307, 8268565, 8494093, 8494086, 8494086, 8494093, 8494082,
+  8494086, 8494100, 8494099, 8494082, 8494100, 8494095, 8494122, 8494082, 8269064, 8494107, 8269315, 8494093,
+  8271113, 8494096, 8494097, 8494082, 8494100, 8268809, 8494101, 8494095, 8270090, 8494101, 8494086, 8494086,
+  8494099, 8271379, 8494099, 8270861, 8494093, 8494086, 8494086, 8494100, 8494085, 8494083, 8494086, 8270345,
+  8494087, 8269587, 8271622, 8494089, 8494099, 8494102, 8494090, 8267279, 8269843, 8494090, 8494090, 8494093,
+  8494101, 8494099, 8494099, 8494095, 8494099, 8272137, 8494084, 8494092, 8494090, 8494095, 8272405, 8494086,
+  8494093, 8494100, 8494090, 8494100, 8274185, 8494082, 8494090, 8494099, 8494086, 8494083, 8270611, 8494099,
+  8494086, 8494087, 8494088, 8494086, 8494082, 8494100, 8494086, 8494093, 8273670, 8271893, 8494095, 8494101,
+  8494090, 8494099, 8494084, 8494093, 8494094, 8494095, 8494104, 8494082, 8494086, 8494107, 8494095, 8494086,
+  8494095, 8494081, 8494104, 8494101, 8274451, 8494088, 8494099, 8494082, 8494088, 8494100, 8494088, 8276742,
+  8277781, 8494087, 8494099, 8494082, 8494082, 8278538, 8494092, 8494090, 8494100, 8494096, 8273935, 8494101,
+  8494085, 8494101, 8494082, 8494085, 8494099, 8274950, 8494090, 8494095, 8278031, 8494107, 8494093, 8494083,
+  8280083, 8494112, 8494084, 8494093, 8494095, 8494090, 8494099, 8494095, 8494095, 8494082, 8494095, 8494100,
+  8494101, 8494086, 8494095, 8494090, 8278287, 8279818, 8494107, 8494090, 8494090, 8494101, 8494095, 8494081,
+  8275987, 8281350, 8494095, 8494084, 8494095, 8494082, 8494090, 8277254, 8277519, 8281606, 8494099, 8494099,
+  8494095, 8494099, 8281870, 8279571, 8494081, 8278799, 8494082, 8494095, 8494086, 8494083, 8494099, 8494090,
+  8494099, 8494096, 8280592, 8494090, 8282118, 8494093, 8494090, 8282630, 8494096, 8494090, 8279060, 8494100,
+  8494095, 8280339, 8280847, 8494093, 8494097, 8494095, 8494099, 8494086, 8282899, 8494096, 8494081, 8494099,
+  8494101, 8494082, 8494099, 8494090, 8283140, 8494095, 8282387, 8281094, 8494086, 8283407, 8494099, 8494101,
+  8494095, 8494095, 8494086, 8494088, 8494101, 8494082, 8494081, 8494096, 8283654, 8494095, 8284420, 8287498,
+  8494100, 8283910, 8284181, 8494097, 8494099, 8285190, 8494086, 8494095, 8284949, 8494099, 8285965, 8494093,
+  8494089, 8285711, 8494086, 8286980, 8494086, 8286739, 8494082, 8286470, 8285446, 8187412, 8494084, 8494099,
+  8279303, 8286214, 8288021, 8494086, 8289555, 8494102, 8288522, 8289032, 8494086, 8287238, 8494101, 8494100,
+  8494082, 8289295, 8287750, 8288262, 8290057, 8494082, 8494082, 8494099, 8291335, 8494100, 8494082, 8494093,
+  8494099, 8494100, 8494095, 8494101, 8494099, 8494087, 8288774, 8289798, 8494100, 8494099, 8290310, 8290566,
+  8494082, 8494090, 8494101, 8494084, 8291590, 8494082, 8290825, 8494081, 8494099, 8291848, 8494095, 8494086,
+  8494090, 8494093, 8494081, 8494102, 8293383, 8292098, 8494089, 8292354, 8494101, 8494082, 8494093, 8494099,
+  8494092, 8292618, 8494099, 8291091, 8494094, 8494084, 8494099, 8494093, 8494083, 8494104, 8494092, 8293135,
+  8494100, 8494094, 8293638, 8494085, 8494090, 8494101, 8494112, 8293907, 8494082, 8494085, 8494095, 8292896,
+  8295444, 8494089, 8294927, 8494122, 8494085, 8494086, 8295176, 8494090, 8494095, 8494081, 8494086, 8494096,
+  8294413, 8494096, 8494095, 8494092, 8494086, 8494095, 8494093, 8494089, 8494095, 8494087, 8494093, 8494099,
+  8494100, 8494090, 8494093, 8494085, 8494112, 8494092, 8294675, 8297990, 8494104, 8494101, 8494104, 8296198,
+  8494092, 8298259, 8494102, 8494087, 8494101, 8494101, 8494088, 8494123, 8295697, 8494095, 8494093, 8299016,
+  8494100, 8494100, 8494095, 8494094, 8299536, 8295938, 8494082, 8494086, 8494081, 8494087, 8494100, 8494093,
+  8494101, 8494086, 8494102, 8494100, 8301076, 8301319, 8494087, 8494100, 8494100, 8494095, 8494086, 8494086,
+  8494099, 8296710, 8494104, 8494095, 8494099, 8494107, 8494095, 8494083, 8298502, 8494090, 8494085, 8494101,
+  8494086, 8494088, 8494086, 8494088, 8494086, 8298758, 8494100, 8494084, 8494086, 8494092, 8299285, 8302868,
+  8494100, 8494101, 8301837, 8494090, 8494086, 8494084, 8494094, 8494094, 8494087, 8494095, 8494086, 8494090,
+  8494090, 8494090, 8494086, 8494095, 8494086, 8494101, 8300301, 8494082, 8300819, 8294159, 8494093, 8494083,
+  8494095, 8494082, 8297747, 8494095, 8494095, 8494095, 8494088, 8494086, 8494101, 8494081, 8494090, 8494085,
+  8300554, 8303893, 8494090, 8494092, 8494101, 8494100, 8494088, 8494090, 8494101, 8494088, 8303119, 8494083,
+  8494099, 8302350, 8494081, 8494087, 8301578, 8494101, 8494089, 8494099, 8494092, 8494086, 8494099, 8494099,
+  8494092, 8494097, 8303631, 8494089, 8494090, 8494093, 8303366, 8494095, 8494104, 8494090, 8304399, 8494099,
+  8494081, 8304147, 8494101, 8494093, 8494090, 8494101, 8304642, 8494086, 8494095, 8494086, 8494100, 8494085,
+  8494100, 8494082, 8494090, 8494100, 8304902, 8494092, 8494102, 8494081, 8494086, 8494088, 8494087, 8494084,
+  8494083, 8494081, 8494083, 8494100, 8494093, 8494082, 8494099, 8494081, 8494083, 8494096, 8494112, 8494100,
+  8305418, 8494104, 8494083, 8305167, 8494095, 8494093, 8494104, 8494084, 8494100, 8305939, 8494090, 8494099,
+  8494100, 8305666, 8494099, 8494094, 8494100, 8494100, 8494086, 8306197, 8306438, 8494099, 8494082, 8494099,
+  8494095, 8494087, 8494084, 8494092, 8494095, 8494092, 8494102, 8494084, 8494086, 8494082, 8307206, 8494099,
+  8494097, 8306950, 8494095, 8494095, 8494099, 8494100, 8494099, 8494082, 8494099, 8494095, 8306707, 8494094,
+  8494083, 8307718, 8302101, 8494096, 8494099, 8494101, 8494100, 8494104, 8494100, 8494086, 8494104, 8307466,
+  8494100, 8307974, 8308486, 8494093, 8494087, 8309254, 8308230, 8494095, 8494090, 8494081, 8494086, 8494086,
+  8308742, 8494100, 8494081, 8494086, 8494095, 8494086, 8494086, 8494122, 8494083, 8494104, 8494088, 8494088,
+  8494102, 8494085, 8494099, 8494090, 8494100, 8494085, 8494095, 8309525, 8310293, 8494088, 8494081, 8494094,
+  8494099, 8494090, 8309001, 8310018, 8494094, 8310803, 8494090, 8494085, 8494085, 8309779, 8494092, 8494083,
+  8494100, 8494087, 8494112, 8494087, 8494082, 8312322, 8311565, 8312079, 8494101, 8310543, 8311814, 8494095,
+  8494096, 8494085, 8494086, 8311317, 8494101, 8494101, 8494093, 8312846, 8313090, 8494094, 8494083, 8311067,
+  8312595, 8494099, 8494081, 8315398, 8494090, 8494082, 8494105, 8313365, 8494099, 8494093, 8494094, 8494099,
+  8494088, 8494084, 8314131, 8494090, 8494100, 8494086, 8494099, 8494087, 8494090, 8494095, 8494093, 8494095,
+  8315663, 8494087, 8317976, 8494093, 8494101, 8494100, 8494093, 8494095, 8494089, 8494086, 8314645, 8494090,
+  8494090, 8494088, 8494099, 8494095, 8494099, 8494101, 8494100, 8494099, 8494089, 8494095, 8494086, 8494094,
+  8494104, 8494101, 8494101, 8494099, 8494093, 8494102, 8494082, 8494101, 8313619, 8494090, 8494099, 8494086,
+  8494099, 8494099, 8494086, 8316443, 8494095, 8317455, 8316947, 8494088, 8494090, 8494101, 8494097, 8494089,
+  8494086, 8494093, 8313866, 8494088, 8494102, 8494100, 8494086, 8494104, 8315923, 8494086, 8494099, 8494099,
+  8494099, 8494095, 8318221, 8494086, 8494095, 8494101, 8494099, 8494099, 8494095, 8318739, 8494096, 8494086,
+  8494086, 8494100, 8319508, 8494095, 8494101, 8494093, 8317715, 8494088, 8320003, 8494097, 8494081, 8494107,
+  8494087, 8494095, 8494101, 8494099, 8317203, 8494092, 8494084, 8319764, 8494107, 8494101, 8186889, 8318978,
+  8494093, 8320788, 8316179, 8494088, 8494093, 8494100, 8494082, 8319251, 8494093, 8494088, 8494082, 8494082,
+  8494100, 8494087, 8321045, 8318484, 8494102, 8494099, 8494092, 8494104, 8494101, 8494087, 8494081, 8494086,
+  8321299, 8494093, 8494086, 8494082, 8322058, 8494082, 8322579, 8494097, 8494112, 8494107, 8320276, 8494090,
+  8494086, 8494081, 8494083, 8494095, 8494081, 8494095, 8494085, 8321542, 8494100, 8494084, 8494095, 8322323,
+  8494086, 8494100, 8323078, 8494083, 8494082, 8494082, 8494088, 8494087, 8494101, 8494100, 8494100, 8494089,
+  8494101, 8321805, 8494102, 8494095, 8494112, 8494086, 8494101, 8494094, 8323604, 8494095, 8494095, 8494086,
+  8494090, 8494090, 8494086, 8494099, 8494099, 8494081, 8494081, 8494096, 8494082, 8494102, 8494081, 8494088,
+  8494100, 8323334, 8494086, 8494092, 8494083, 8494087, 8494088, 8494099, 8494086, 8494086, 8494086, 8494093,
+  8494093, 8320525, 8494097, 8494087, 8494083, 8322836, 8494093, 8324110, 8494088, 8494094, 8494092, 8494084,
+  8494093, 8494096, 8494090, 8494101, 8494088, 8324358, 8494095, 8494104, 8494092, 8494093, 8494094, 8494101,
+  8494083, 8494086, 8494081, 8494094, 8323860, 8494099, 8494086, 8494088, 8494095, 8494104, 8494086, 8494101,
+  8494100, 8494086, 8494103, 8494101, 8494081, 8324610, 8494083, 8325126, 8494095, 8494082, 8494087, 8494093,
+  8494081, 8494100, 8494090, 8494081, 8494086, 8494086, 8325636, 8494082, 8494092, 8494085, 8494099, 8494096,
+  8324885, 8494090, 8325396, 8494086, 8494090, 8494100, 8494095, 8494083, 8494086, 8494094, 8494102, 8494095,
+  8494087, 8494086, 8494082, 8494085, 8494093, 8494092, 8494100, 8494100, 8494085, 8494101, 8494101, 8494093,
+  8494088, 8494112, 8494092, 8326419, 8494102, 8325907, 8494087, 8494088, 8494089, 8494102, 8494123, 8494092,
+  8494092, 8494100, 8494093, 8494092, 8494094, 8494093, 8494102, 8494100, 8494100, 8494081, 8494092, 8494090,
+  8494083, 8494086, 8494101, 8494100, 8494100, 8494087, 8494088, 8494089, 8494083, 8494083, 8494083, 8494088,
+  8494100, 8494094, 8494088, 8328207, 8328453, 8314377, 8494084, 8494100, 8327180, 8494084, 8494090, 8494093,
+  8494100, 8494086, 8326918, 8494101, 8494099, 8494122, 8494094, 8494088, 8494082, 8330516, 8331785, 8494107,
+  8328714, 8494088, 8494085, 8494101, 8494086, 8494095, 8494100, 8494100, 8494104, 8327443, 8494084, 8494083,
+  8494097, 8494090, 8494122, 8327695, 8333833, 8494096, 8327951, 8494095, 8494081, 8494093, 8331027, 8494093,
+  8494099, 8494090, 8494094, 8494090, 8330771, 8494099, 8494089, 8331283, 8494088, 8494082, 8494088, 8494093,
+  8494088, 8494088, 8494095, 8494089, 8494083, 8494088, 8494090, 8494083, 8494090, 8494100, 8494081, 8494101,
+  8494100, 8494086, 8494095, 8494090, 8494085, 8494107, 8326665, 8494095, 8494122, 8494090, 8494082, 8494082,
+  8494086, 8494095, 8332294, 8494090, 8332041, 8494099, 8494088, 8330246, 8494100, 8494093, 8494090, 8331541,
+  8494096, 8334357, 8494095, 8494099, 8494087, 8494095, 8494100, 8494099, 8494104, 8494096, 8494095, 8494090,
+  8494086, 8494123, 8494086, 8494090, 8494087, 8332806, 8332550, 8494094, 8494101, 8334867, 8334086, 8335379,
+  8494084, 8494095, 8494083, 8494081, 8494096, 8494102, 8494097, 8494093, 8494112, 8494084, 8494102, 8494101,
+  8494095, 8494100, 8494082, 8337932, 8336405, 8494095, 8494088, 8336915, 8494086, 8494086, 8333588, 8494086,
+  8494081, 8494096, 8494085, 8494092, 8494100, 8494087, 8494088, 8494087, 8494094, 8494112, 8494095, 8494100,
+  8494086, 8494095, 8494088, 8494095, 8494101, 8494101, 8494089, 8494087, 8339718, 8494101, 8338200, 8494100,
+  8494081, 8494107, 8494100, 8494101, 8494092, 8494099, 8494099, 8494090, 8494088, 8494122, 8335622, 8494095,
+  8494099, 8340243, 8338694, 8494081, 8337670, 8494092, 8335878, 8494086, 8494101, 8494101, 8494099, 8494099,
+  8494082, 8494099, 8338438, 8494090, 8494087, 8494086, 8494101, 8494095, 8341013, 8494095, 8494104, 8494089,
+  8494083, 8494093, 8494099, 8337418, 8494084, 8494090, 8494107, 8342786, 8494089, 8494100, 8494101, 8494090,
+  8494101, 8494100, 8494100, 8494102, 8494104, 8494099, 8326159, 8494097, 8494093, 8494095, 8339987, 8342291,
+  8494090, 8494093, 8494090, 8494081, 8341775, 8494090, 8494099, 8343050, 8494095, 8494093, 8494082, 8339471,
+  8341510, 8494096, 8494086, 8494094, 8494102, 8494099, 8494088, 8494100, 8494100, 8494090, 8494093, 8494083,
+  8494095, 8494090, 8494099, 8494086, 8494099, 8494085, 8494086, 8494088, 8494100, 8494095, 8494088, 8344079,
+  8494099, 8494094, 8494093, 8494099, 8494102, 8494092, 8494087, 8494088, 8494100, 8494086, 8342531, 8345108,
+  8494112, 8494097, 8494085, 8494104, 8494087, 8494102, 8494096, 8345620, 8343302, 8343558, 8494082, 8494095,
+  8341263, 8494099, 8494101, 8494095, 8494086, 8494100, 8494100, 8494095, 8494099, 8494100, 8494086, 8344340,
+  8494112, 8343827, 8494101, 8494086, 8494086, 8494100, 8494090, 8494082, 8342036, 8494090, 8494089, 8494100,
+  8344595, 8494099, 8494086, 8494095, 8494082, 8347407, 8348422, 8494090, 8494089, 8494082, 8494093, 8494082,
+  8346374, 8348678, 8348971, 8494101, 8494093, 8494100, 8494085, 8494084, 8494095, 8494099, 8494101, 8494093,
+  8494085, 8494101, 8494095, 8494095, 8494100, 8494086, 8494090, 8494085, 8494090, 8494083, 8494093, 8494086,
+  8494083, 8494081, 8494104, 8344852, 8494095, 8494087, 8494086, 8494082, 8494107, 8494086, 8494102, 8494099,
+  8494095, 8494082, 8350218, 8494100, 8494092, 8494101, 8494082, 8494112, 8350470, 8345875, 8494085, 8494087,
+  8494093, 8347947, 8350726, 8351494, 8346886, 8352529, 8494086, 8349472, 8494099, 8352789, 8494082, 8349958,
+  8494100, 8494083, 8494112, 8349203, 8494092, 8349738, 8494095, 8494088, 8494085, 8494092, 8494090, 8494088,
+  8352014, 8348162, 8494093, 8494101, 8494088, 8494090, 8494082, 8351754, 8350982, 8494099, 8494092, 8494099,
+  8494099, 8494088, 8353556, 8494100, 8494095, 8494101, 8494083, 8494099, 8494099, 8354570, 8494087, 8353798,
+  8494089, 8494086, 8494101, 8494101, 8354069, 8494094, 8494101, 8354317, 8494083, 8494095, 8494086, 8353039,
+  8353286, 8494096, 8494085, 8494087, 8494086, 8494099, 8494088, 8355334, 8494095, 8494086, 8354823, 8355080,
+  8352263, 8494088, 8494095, 8356108, 8357389, 8494081, 8357645, 8494092, 8351251, 8494092, 8494100, 8494107,
+  8494089, 8494090, 8494082, 8494104, 8494100, 8356371, 8494086, 8494090, 8494101, 8494099, 8494089, 8494086,
+  8494107, 8494084, 8494092, 8355586, 8494085, 8494099, 8357135, 8356610, 8355846, 8494086, 8494101, 8494099,
+  8358406, 8494095, 8494090, 8356866, 8357894, 8494090, 8494083, 8494099, 8494092, 8494092, 8494086, 8494083,
+  8494123, 8494123, 8494095, 8494112, 8359434, 8494122, 8494093, 8494097, 8494090, 8494101, 8494093, 8494096,
+  8494084, 8494100, 8494085, 8494095, 8494095, 8494095, 8360972, 8359174, 8494101, 0, 8494097, 8358163,
+  8359701, 8494095, 8494095, 8494090, 8494090, 8494094, 8494086, 8494099, 8358672, 8494106, 8494095, 8494099,
+  8494094, 8494082, 8494104, 8494093, 8494097, 8494101, 8358933, 8494094, 8494101, 8494090, 8494101, 8494088,
+  8494086, 8494101, 8494086, 8494099, 8361231, 8494082, 8494107, 8494122, 8494082, 8494093, 8494094, 8494087,
+  8494083, 8494089, 8494090, 8494099, 8494086, 8494082, 8360462, 8494085, 8494104, 8494090, 8360710, 8359955,
+  8361478, 8360202, 8494101, 8362511, 8494087, 8494090, 8494123, 8494096, 8494102, 8494088, 8494092, 8494101,
+  8361994, 8494102, 8362244, 8361737, 8494100, 8494093, 8494099, 8494099, 8494089, 8494090, 8494090, 8494095,
+  8362760, 8363024, 8494093, 8494100, 8494090, 8494093, 8494095, 8494085, 8494090, 8494099, 8494123, 8363522,
+  8494099, 8494082, 8494099, 8494095, 8494100, 8494092, 8494099, 8363279, 8494086, 8494100, 8494105, 8494096,
+  8494088, 8494099, 8364557, 8494095, 8494097, 8494085, 8494100, 8494085, 8364309, 8494094, 8494100, 8364038,
+  8494081, 8494086, 8494088, 8494083, 8494095, 8494089, 8363791, 8494102, 8366339, 8494095, 8494094, 8364820,
+  8494101, 8494090, 8365839, 8365574, 8494088, 8494090, 8494084, 8494102, 8367369, 8494097, 8494101, 8494105,
+  8494102, 8365078, 8494090, 8494095, 8494095, 8494092, 8366598, 8366099, 8365331, 8494085, 8494099, 8494095,
+  8494087, 8494107, 8494099, 8494096, 8494099, 8494095, 8494086, 8494093, 8494099, 8494101, 8494094, 8367124,
+  8367631, 8494100, 8366867, 8494085, 8494090, 8494087, 8494102, 8494099, 8494086, 8494099, 8494099, 8494095,
+  8494095, 8494090, 8494105, 8494095, 8368143, 8494086, 8494099, 8494095, 8494090, 8367881, 8494086, 8494095,
+  8494084, 8494092, 8494101, 8494093, 8494090, 8494090, 8494095, 8494082, 8368902, 8494086, 8494093, 8368386,
+  8369171, 8494086, 8494086, 8494082, 8494095, 8494099, 8494099, 8373513, 8494100, 8494090, 8369414, 8494086,
+  8494081, 8371219, 8494102, 8494092, 8494081, 8494088, 8369683, 8368659, 8494088, 8494099, 8494082, 8494095,
+  8494101, 8494099, 8494082, 8370698, 8494101, 8494099, 8494096, 8494094, 8494096, 8494103, 8369926, 8494102,
+  8494102, 8494088, 8494088, 8494100, 8494088, 8494100, 8494086, 8494094, 8494092, 8494087, 8494093, 8494089,
+  8373251, 8494100, 8494093, 8494090, 8494100, 8371983, 8494084, 8494090, 8494096, 8494099, 8494100, 8494093,
+  8494112, 8494099, 8494104, 8370195, 8374025, 8494102, 8494097, 8494089, 8494112, 8494090, 8494102, 8494082,
+  8494093, 8494100, 8494090, 8494099, 8494099, 8494097, 8494095, 8494093, 8494082, 8494100, 8494099, 8494088,
+  8494094, 8494096, 8494099, 8494099, 8374287, 8494086, 8494099, 8494087, 8494102, 8372246, 8494082, 8374538,
+  8494096, 8372486, 8494090, 8494093, 8494101, 8494099, 8494095, 8494086, 8494100, 8494095, 8494093, 8494096,
+  8494093, 8494081, 8494101, 8494093, 8494092, 8494097, 8494086, 8375311, 8494089, 8494086, 8494082, 8494090,
+  8373766, 8494097, 8494100, 8494093, 8494082, 8374790, 8494086, 8494101, 8494095, 8494084, 8375561, 8494099,
+  8494086, 8494090, 8494090, 8494112, 8375059, 8494088, 8494102, 8494089, 8372998, 8494081, 8494085, 8494099,
+  8494123, 8494086, 8494099, 8494099, 8494095, 8376852, 8377875, 8494093, 8494100, 8494099, 8375817, 8494093,
+  8494101, 8494101, 8494095, 8494093, 8494090, 8494082, 8494101, 8494099, 8494107, 8494086, 8376083, 8376595,
+  8494090, 8494086, 8494101, 8494090, 8376339, 8494088, 8494081, 8494100, 8494092, 8378890, 8381723, 8494097,
+  8494094, 8494085, 8494088, 8494095, 8494112, 8494096, 8377107, 8379150, 8494095, 8494099, 8379663, 8379923,
+  8494099, 8494100, 8494104, 8494095, 8381199, 8494101, 8494099, 8494083, 8494086, 8494090, 8494100, 8494082,
+  8494099, 8494099, 8494093, 8494095, 8494084, 8494084, 8494093, 8494081, 8494090, 8377615, 8494099, 8494095,
+  8494082, 8494104, 8494087, 8381960, 8494099, 8494093, 8382466, 8494087, 8494088, 8494104, 8380166, 8494093,
+  8379409, 8494085, 8494099, 8494093, 8382227, 8494101, 8494083, 8494099, 8494100, 8494102, 8494107, 8494100,
+  8494099, 8494099, 8494095, 8380943, 8494099, 8494086, 8380422, 8494101, 8384271, 8382982, 8494100, 8494088,
+  8494081, 8494104, 8494093, 8494099, 8494097, 8494094, 8494086, 8383251, 8494082, 8384531, 8494092, 8494083,
+  8382726, 8494101, 8494093, 8494104, 8380674, 8383520, 8494095, 8494086, 8494090, 8494100, 8494099, 8494086,
+  8494099, 8494090, 8494086, 8494095, 8494100, 8494081, 8494099, 8494081, 8494088, 8494081, 8494112, 8385301,
+  8494100, 8494082, 8494092, 8494100, 8494102, 8494099, 8494099, 8494095, 8494086, 8494087, 8494099, 8494090,
+  8302611, 8494086, 8494092, 8494100, 8494090, 8494094, 8494101, 8494082, 8494100, 8494099, 8494100, 8494095,
+  8494089, 8494082, 8494104, 8494088, 8494082, 8385549, 8494082, 8494081, 8494100, 8494086, 8494090, 8385811,
+  8494090, 8494086, 8494094, 8494082, 8494086, 8494100, 8494084, 8494101, 8494088, 8386058, 8386566, 8494104,
+  8494095, 8494082, 8385026, 8494095, 8386829, 8494084, 8494083, 8494093, 8387078, 8494081, 8494081, 8494099,
+  8387590, 8494100, 8494087, 8494087, 8494101, 8386325, 8494101, 8494094, 8494086, 8494086, 8494084, 8387859,
+  8494082, 8494081, 8494095, 8494097, 8494101, 8494096, 8387350, 8494099, 8494086, 8494090, 8494093, 8383750,
+  8494100, 8494086, 8494085, 8494086, 8494081, 8494101, 8388615, 8494100, 8389384, 8388358, 8494090, 8494095,
+  8494088, 8494090, 8388111, 8389903, 8390151, 8494084, 8494086, 8494086, 8494082, 8494095, 8494097, 8494100,
+  8494082, 8494092, 8494090, 8388870, 8494089, 8494095, 8494097, 8494086, 8494086, 8389130, 8390419, 8494087,
+  8390675, 8494088, 8494102, 8494099, 8494081, 8494094, 8494086, 8494099, 8494083, 8494093, 8494095, 8389642,
+  8494094, 8391187, 8494086, 8494090, 8391443, 8494093, 8494092, 8494088, 8392213, 8393491, 8393231, 8494087,
+  8393743, 8494085, 8494088, 8494100, 8494081, 8494086, 8391700, 8391952, 8494099, 8494088, 8494089, 8394005,
+  8494095, 8494100, 8394515, 8494107, 8494088, 8494086, 8395796, 8494099, 8395016, 8494095, 8494100, 8494099,
+  8494092, 8494104, 8494084, 8494086, 8395539, 8494086, 8394758, 8392710, 8494095, 8494100, 8494082, 8494082,
+  8494104, 8494088, 8494090, 8494085, 8494093, 8494101, 8494081, 8494086, 8494088, 8494095, 8494088, 8494081,
+  8494085, 8494090, 8397848, 8494100, 8494097, 8494088, 8494087, 8494088, 8494087, 8494086, 8494082, 8494085,
+  8494101, 8397588, 8494102, 8494102, 8494102, 8494083, 8494102, 8396053, 8494086, 8398343, 8494088, 8494099,
+  8494092, 8494083, 8494092, 8494093, 8396550, 8494087, 8494099, 8494086, 8494095, 8494100, 8397076, 8494099,
+  8494101, 8494083, 8494095, 8494107, 8494090, 8494082, 8494089, 8494081, 8494081, 8494092, 8494082, 8494090,
+  8494093, 8398104, 8494084, 8494083, 8494087, 8494099, 8399373, 8398611, 8494107, 8398856, 8494085, 8494101,
+  8494093, 8494101, 8397322, 8399110, 8494094, 8494083, 8494092, 8494086, 8494097, 8494095, 8494095, 8399635,
+  8494102, 8494086, 8494086, 8494099, 8494081, 8494099, 8494099, 8395283, 8494095, 8494095, 8494099, 8494086,
+  8494088, 8494082, 8400399, 8399882, 8494090, 8494082, 8400661, 8494093, 8494094, 8494100, 8494084, 8494100,
+  8400134, 8494086, 8494099, 8494090, 8494099, 8494089, 8494083, 8494101, 8494081, 8494083, 8494093, 8494102,
+  8494090, 8494085, 8494095, 8494095, 8494086, 8394259, 8494097, 8494095, 8494085, 8401411, 8494086, 8494088,
+  8494095, 8494082, 8396303, 8401158, 8494082, 8494101, 8400915, 8494097, 8494093, 8494099, 8401685, 8494090,
+  8494088, 8401924, 8494101, 8494086, 8494093, 8494087, 8494096, 8494095, 8494087, 8402442, 8494089, 8402697,
+  8402963, 8494099, 8494094, 8402196, 8494101, 8494093, 8403215, 8494086, 8494112, 8494086, 8494101, 8494093,
+  8494081, 8403475, 8494101, 8494099, 8494090, 8494089, 8494084, 8494093, 8494084, 8494093, 8494101, 8403727,
+  8494102, 8494096, 8494102, 8494093, 8404245, 8404486, 8494100, 8494095, 8494099, 8404998, 8494107, 8494090,
+  8494099, 8494099, 8494088, 8494099, 8494096, 8403983, 8404746, 8494088, 8494112, 8494089, 8494095, 8407571,
+  8392451, 8494095, 8494088, 8405523, 8494095, 8494083, 8494090, 8494102, 8494088, 8405762, 8494090, 8494100,
+  8494095, 8407817, 8494084, 8494084, 8494104, 8494100, 8405267, 8494093, 8494105, 8494081, 8494112, 8494090,
+  8494085, 8494100, 8494084, 8494099, 8494081, 8406534, 8494082, 8494100, 8494097, 8494099, 8494093, 8494083,
+  8494104, 8406292, 8494081, 8494102, 8494095, 8409871, 8494086, 8494099, 8494086, 8494099, 8494086, 8494092,
+  8408335, 8494090, 8494086, 8494100, 8494099, 8407059, 8494105, 8494084, 8494084, 8410139, 8494096, 8494082,
+  8494094, 8494088, 8494101, 8494081, 8494099, 8494090, 8494104, 8494086, 8494101, 8411925, 8410389, 8494087,
+  8494088, 8494099, 8494101, 8494089, 8494081, 8494093, 8392975, 8494090, 8411407, 8494094, 8494086, 8494095,
+  8412180, 8494083, 8494095, 8412687, 8494104, 8412435, 8494093, 8494107, 8494095, 8494095, 8494086, 8494081,
+  8494093, 8494082, 8494082, 8494100, 8494101, 8410899, 8494086, 8494090, 8412943, 8494088, 8494083, 8494097,
+  8494086, 8494092, 8494086, 8494100, 8494100, 8413199, 8494086, 8494102, 8494093, 8494085, 8494095, 8413450,
+  8494101, 8494089, 8494082, 8494082, 8410634, 8494100, 8494090, 8494104, 8494097, 8494085, 8494082, 8494088,
+  8494112, 8494095, 8413715, 8494086, 8494096, 8494100, 8494099, 8494081, 8414223, 8415753, 8494095, 8494093,
+  8494099, 8414985, 8494100, 8494093, 8494081, 8494107, 8494081, 8494100, 8494092, 8494090, 8494101, 8494090,
+  8494095, 8494095, 8494090, 8494093, 8494101, 8494095, 8494086, 8409642, 8494086, 8413958, 8494082, 8494082,
+  8494101, 8494084, 8494089, 8494081, 8494081, 8494088, 8494097, 8408071, 8494102, 8494084, 8494094, 8494081,
+  8494090, 8494084, 8494100, 8494084, 8494089, 8494085, 8416527, 8494100, 8414730, 8494083, 8494100, 8494084,
+  8494091, 8494101, 8494085, 8494081, 8494083, 8494095, 8494094, 8494095, 8494090, 8494088, 8494100, 8494085,
+  8494101, 8494086, 8494102, 8494095, 8494093, 8494101, 8494086, 8494090, 8414483, 8494102, 8494101, 8494099,
+  8494092, 8494081, 8494093, 8494099, 8494084, 8494096, 8494100, 8494086, 8494101, 8494082, 8494088, 8494100,
+  8415254, 8494089, 8494102, 8494099, 8494081, 8494097, 8494094, 8494100, 8416008, 8415509, 8494100, 8494092,
+  8494101, 8416777, 8494094, 8494102, 8494100, 8494090, 8494084, 8494084, 8494090, 8494100, 8416262, 8494123,
+  8494090, 8494101, 8494100, 8494099, 8417038, 8494086, 8494093, 8494082, 8494099, 8494102, 8494087, 8494082,
+  8494081, 8494081, 8494099, 8494082, 8494100, 8494090, 8494088, 8494088, 8494102, 8494096, 8494086, 8494099,
+  8417798, 8417282, 8494100, 8494082, 8494100, 8494082, 8417542, 8494100, 8494100, 8494095, 8494099, 8494095,
+  8494085, 8494107, 8418310, 8494122, 8418069, 8494099, 8494086, 8418570, 8494106, 8419590, 8494082, 8494087,
+  8494099, 8494082, 8494100, 8494094, 8494101, 8494095, 8494084, 8494101, 8494095, 8494123, 8494093, 8494086,
+  8494092, 8494100, 8494101, 8494101, 8494093, 8494089, 8494097, 8419087, 8494083, 8494095, 8420360, 8494100,
+  8494101, 8494088, 8494099, 8419872, 8494099, 8494087, 8419343, 8494100, 8494096, 8420614, 8418836, 8423183,
+  8494099, 8494100, 8494083, 8494088, 8494095, 8494081, 8494100, 8494096, 8494099, 8494082, 8494081, 8494101,
+  8494086, 8494082, 8494092, 8494090, 8494083, 8494093, 8494100, 8494084, 8494087, 8494089, 8494100, 8494081,
+  8494094, 8494087, 8494086, 8494088, 8494086, 8420117, 8494123, 8494123, 8494112, 8494097, 8494100, 8494084,
+  8423443, 8494082, 8422159, 8494095, 8420883, 8494095, 8494085, 8421391, 8494090, 8494088, 8494101, 8494095,
+  8494101, 8494099, 8494101, 8494087, 8494099, 8494083, 8494095, 8494081, 8494090, 8494100, 8421141, 8494082,
+  8494092, 8494083, 8494099, 8494094, 8494090, 8494100, 8424979, 8494099, 8494081, 8494090, 8426505, 8422420,
+  8494099, 8406018, 8425740, 8422671, 8494101, 8427273, 8423695, 8423946, 8494088, 8422927, 8494088, 8494099,
+  8494081, 8494090, 8494101, 8494089, 8494088, 8494099, 8494093, 8494082, 8494095, 8494088, 8494097, 8494085,
+  8494086, 8494086, 8494088, 8494100, 8494095, 8494094, 8427530, 8494081, 8494100, 8494088, 8427027, 8427782,
+  8494096, 8494090, 8494100, 8494085, 8494086, 8494090, 8494088, 8425475, 8494092, 8494093, 8494102, 8411657,
+  8426253, 8494097, 8494095, 8494102, 8494100, 8494096, 8494094, 8494101, 8494104, 8494102, 8494099, 8494085,
+  8494100, 8494087, 8494086, 8494089, 8494104, 8494081, 8494081, 8428546, 8494089, 8494099, 8494090, 8494081,
+  8494095, 8494095, 8494093, 8494090, 8494090, 8494095, 8494085, 8494090, 8428819, 8494093, 8494102, 8494086,
+  8494099, 8494093, 8494099, 8494102, 8494090, 8494095, 8494107, 8494102, 8494101, 8494082, 8429587, 8494101,
+  8494094, 8494112, 8494081, 8428038, 8494086, 8494089, 8428294, 8494100, 8494092, 8494093, 8494093, 8429828,
+  8494123, 8494100, 8429071, 8494083, 8430860, 8494095, 8429327, 8494082, 8494095, 8494104, 8494099, 8430095,
+  8494094, 8494086, 8494083, 8494101, 8494081, 8494089, 8494093, 8494081, 8430596, 8494102, 8494090, 8494090,
+  8494086, 8494099, 8494082, 8494099, 8494081, 8494100, 8494081, 8430342, 8494082, 8494090, 8494100, 8431119,
+  8494095, 8494100, 8431878, 8494081, 8494094, 8494087, 8432134, 8494082, 8494096, 8431379, 8494086, 8494100,
+  8494081, 8494086, 8494086, 8494100, 8494086, 8494081, 8494086, 8494090, 8494083, 8494095, 8494089, 8494084,
+  8494107, 8494086, 8494083, 8494083, 8494107, 8494095, 8494087, 8494112, 8494095, 8494096, 8494092, 8494100,
+  8494095, 8494086, 8432404, 8494095, 8494095, 8494101, 8494093, 8494100, 8494085, 8494099, 8494093, 8494099,
+  8494101, 8494095, 8494100, 8494095, 8494088, 8494101, 8432659, 8494088, 8494081, 8494093, 8494092, 8494101,
+  8494095, 8494088, 8433158, 8494100, 8494100, 8494092, 8494086, 8494086, 8433418, 8434707, 8494093, 8494086,
+  8494101, 8494087, 8494090, 8436232, 8494086, 8494088, 8436495, 8494081, 8494092, 8494102, 8494090, 8494082,
+  8432918, 8494086, 8494083, 8494092, 8494095, 8494097, 8494083, 8494087, 8494101, 8494095, 8494087, 8494088,
+  8494089, 8494101, 8494101, 8494082, 8494093, 8494094, 8494084, 8494086, 8494095, 8494101, 8494085, 8437524,
+  8494086, 8494088, 8494083, 8494101, 8434197, 8494100, 8494093, 8494099, 8494086, 8494083, 8494095, 8494099,
+  8494101, 8494081, 8494090, 8435462, 8494100, 8494099, 8494101, 8494081, 8494100, 8494090, 8494095, 8434438,
+  8494087, 8494082, 8494086, 8494099, 8435718, 8494090, 8494084, 8494101, 8494100, 8494088, 8494090, 8494099,
+  8494086, 8494086, 8438037, 8494086, 8494093, 8494087, 8494088, 8431618, 8494107, 8494086, 8494092, 8494095,
+  8494099, 8494101, 8494095, 8494081, 8436742, 8494084, 8494100, 8494099, 8494083, 8438804, 8494100, 8494122,
+  8494095, 8438293, 8494095, 8494101, 8494101, 8494092, 8494081, 8494086, 8494093, 8494095, 8440852, 8494089,
+  8494087, 8494101, 8494081, 8439562, 8494097, 8494093, 8494095, 8494099, 8494087, 8494087, 8494093, 8440066,
+  8494085, 8494088, 8494100, 8494102, 8494100, 8494099, 8439311, 8494100, 8494088, 8494093, 8494094, 8494099,
+  8494096, 8437007, 8494100, 8494088, 8494107, 8494085, 8494086, 8494097, 8437267, 8494084, 8494086, 8494100,
+  8441103, 8442388, 8494095, 8438549, 8437779, 8494099, 8439055, 8494093, 8442131, 8494099, 8494099, 8494095,
+  8439821, 8442639, 8494122, 8494082, 8494081, 8494099, 8444685, 8494086, 8444180, 8494099, 8494093, 8442886,
+  8494100, 8443401, 8494093, 8445711, 8494082, 8494090, 8444431, 8494090, 8445194, 8494090, 8443921, 8494100,
+  8494084, 8494104, 8443663, 8494086, 8444941, 8445459, 8494094, 8494090, 8494090, 8494100, 8494084, 8447241,
+  8446483, 8446223, 8494093, 8494090, 8494090, 8494101, 8494099, 8443142, 8494093, 8494086, 8494099, 8494105,
+  8494086, 8445971, 8446995, 8494099, 8494090, 8494090, 8494084, 8447498, 8494099, 8494081, 8494094, 8494082,
+  8494099, 8494099, 8494083, 8494095, 8446739, 8494083, 8494081, 8448021, 8494083, 8494102, 8494095, 8494088,
+  8494090, 8447759, 8494088, 8494095, 8448258, 8449299, 8494083, 8494100, 8494095, 8494095, 8494082, 8494102,
+  8494087, 8494090, 8494099, 8494099, 8494090, 8448787, 8449807, 8494099, 8494101, 8494100, 8494099, 8494099,
+  8448518, 8494088, 8451078, 8494086, 8494101, 8494081, 8494086, 8494082, 8494093, 8494086, 8494101, 8449548,
+  8494094, 8494087, 8494093, 8450566, 8494090, 8494081, 8494090, 8451860, 8494099, 8494095, 8494094, 8494104,
+  8494090, 8494103, 8494099, 8494090, 8494099, 8452108, 8494084, 8494102, 8494082, 8452883, 8494081, 8494100,
+  8450826, 8494100, 8494099, 8494088, 8494090, 8494082, 8452612, 8494100, 8494092, 8494081, 8494089, 8494099,
+  8494083, 8494100, 8494082, 8453892, 8451334, 8494093, 8494092, 8451605, 8455189, 8457493, 8494097, 8453130,
+  8452362, 8453382, 8494099, 8455692, 8494086, 8454153, 8456453, 8494095, 8494099, 8494090, 8494088, 8494086,
+  8494099, 8494099, 8494090, 8455433, 8494086, 8494081, 8454662, 8494099, 8456710, 8454918, 8494099, 8457743,
+  8457990, 8494082, 8494099, 8494083, 8455955, 8456984, 8458515, 8458758, 8459795, 8494082, 8494093, 8460815,
+  8494099, 8494081, 8460051, 8494085, 8494093, 8494086, 8459028, 8494084, 8494086, 8494088, 8494104, 8494095,
+  8459542, 8494101, 8494081, 8460310, 8494090, 8494083, 8461845, 8494082, 8463380, 8494107, 8494083, 8494099,
+  8494099, 8494100, 8494081, 8494099, 8494082, 8494094, 8494082, 8462095, 8494088, 8494081, 8494096, 8494093,
+  8494104, 8494081, 8494095, 8464134, 8494090, 8494086, 8494095, 8494086, 8494090, 8494088, 8494088, 8494086,
+  8494099, 8494092, 8494090, 8494086, 8494093, 8494089, 8494083, 8494104, 8494086, 8494095, 8494090, 8494090,
+  8494083, 8494095, 8464394, 8494082, 8494101, 8494086, 8494088, 8494100, 8494094, 0, 8494086, 8463622,
+  8494096, 8463877, 8463123, 8494102, 0, 8464648, 8494100, 8494082, 8494086, 8461574, 8494102, 8494100,
+  8494102, 8494095, 8494099, 8494101, 8494097, 8494093, 8494088, 8494090, 8494099, 8494101, 8494096, 8494090,
+  8465417, 8494088, 8494086, 8494096, 8494086, 8494084, 8494092, 8494095, 8494086, 8494086, 8494084, 8494103,
+  8494093, 8494086, 8494081, 8494081, 8494086, 8494102, 8494101, 8494088, 8494100, 8494084, 8494084, 8494095,
+  8494095, 8494101, 8494101, 8494095, 8494093, 8494081, 0, 8494082, 8494085, 8494100, 8465161, 8494099,
+  8494097, 8494086, 8465679, 8494099, 8494099, 8494099, 8494086, 8494088, 8494087, 8494101, 8494100, 8494092,
+  8494093, 8465939, 8494086, 8494082, 8494100, 8494101, 8494101, 8494101, 8494089, 8494100, 8494092, 8494082,
+  8494095, 8494090, 8464915, 8494093, 8494095, 8494086, 8494100, 8494099, 8494099, 8494088, 8494093, 8494094,
+  8494099, 8466447, 8494102, 8494092, 8494100, 8494090, 8494089, 8494086, 8494086, 8494081, 8494090, 8462867,
+  8494099, 8494083, 8494081, 8494104, 8494093, 8494100, 8494088, 8466959, 8494101, 8494085, 8494093, 8494099,
+  8494086, 8494087, 8494088, 8494086, 8494101, 8494096, 8494095, 8494086, 8494081, 8494084, 8494095, 8494095,
+  8494102, 8466182, 8462357, 8494095, 8494093, 8494099, 8494099, 8494097, 8494086, 8494083, 8494083, 8494093,
+  8494084, 8494101, 8494081, 8494081, 8494100, 8494093, 8494083, 8494090, 8466697, 8494083, 8494102, 8494093,
+  8467202, 8494082, 8494086, 8494102, 8494082, 8494081, 8494083, 8494095, 8494100, 8494088, 8494095, 8494086,
+  8494086, 8494096, 8467718, 8467471, 8494102, 8494090, 8494086, 8494082, 8494082, 8494088, 8494086, 8467974,
+  8494081, 8494112, 8494086, 8494083, 8494099, 8494094, 8494099, 8494090, 8494102, 8494088, 8494100, 8494089,
+  8468751, 8494086, 8494099, 8494090, 8494088, 8494099, 8494085, 8494088, 8494090, 8468233, 8494081, 8494099,
+  8494095, 8494099, 8469254, 8494081, 8468493, 8494090, 8494107, 8494095, 8494088, 8494099, 8494086, 8494084,
+  8494082, 8494100, 0, 8494090, 8494102, 8494083, 8494099, 8494101, 8469011, 8494093, 8494099, 8494088,
+  8494095, 8494088, 8494083, 8494081, 8494095, 8494090, 8494104, 8494100, 8494100, 8494107, 8494082, 8494099,
+  8494095, 8494086, 8470790, 8494101, 8494086, 8494086, 8494095, 8469519, 8494088, 8494086, 8494093, 8494082,
+  8494096, 8471315, 8494081, 8494093, 8494095, 8494093, 8494093, 8494094, 8494092, 8494083, 8494095, 8494100,
+  8494099, 8494088, 8494081, 8494101, 8494088, 8494088, 8494100, 8494085, 8494100, 8494100, 8494086, 8494086,
+  8470018, 8494087, 8494099, 8494088, 8494081, 8494099, 8469779, 8494090, 8494086, 8494101, 8494088, 8494095,
+  8494086, 8494086, 8494083, 8470543, 8494088, 8494088, 8494086, 8494100, 8494092, 8494081, 8494086, 8494100,
+  8494099, 8494086, 8472329, 8494093, 8494086, 8494099, 8494086, 8494086, 8494099, 8494095, 8470291, 8494084,
+  8494090, 8494090, 8494088, 8494086, 8494082, 8494100, 8494093, 8494100, 8494100, 8494088, 8471558, 8471048,
+  8494086, 8494082, 8494086, 8471827, 8494086, 8494090, 8472083, 8494081, 8494084, 8494082, 8494090, 8494082,
+  8494090, 8494096, 8472582, 8494107, 8472838, 8474630, 8494085, 8494084, 8494095, 8494100, 8494088, 8494086,
+  8494086, 8494112, 8494090, 8494086, 8494086, 8494123, 8473094, 8494099, 8475401, 0, 0, 8494112,
+  0, 8494086, 0, 8494100, 8494095, 8494088, 8494083, 8494085, 8396824, 8494088, 8494099, 8473365,
+  8494100, 8494095, 8494100, 8475923, 8494087, 8494104, 8494099, 8494094, 8494090, 8473617, 8494093, 8494085,
+  8494104, 8494086, 8494094, 8494100, 8494082, 8494100, 8494090, 8494084, 8494088, 8494104, 8494085, 8494093,
+  8494088, 8476692, 8494088, 8494088, 8494088, 8494086, 8494101, 8494082, 8474886, 8494081, 8494093, 8494102,
+  8494092, 8494095, 8473866, 8494101, 8494095, 0, 8494123, 8494088, 0, 8494095, 8476179, 8494099,
+  8494095, 8494082, 8494099, 8494097, 8494095, 8494094, 8494090, 8494099, 8494082, 8494086, 8494097, 8494101,
+  8494095, 8494101, 8494100, 8494095, 8494101, 8494087, 8494100, 8494089, 8494089, 8494100, 8494100, 8494086,
+  8494097, 8494082, 8475142, 8494081, 8494095, 8494101, 8494101, 8494084, 8494100, 8494088, 8494095, 8494093,
+  8494085, 8494094, 8494090, 8494090, 8494088, 8494089, 8494099, 8494088, 8494092, 8476937, 8494086, 8494104,
+  8479241, 8494099, 0, 8494088, 8494101, 8494086, 8494101, 8494101, 8494083, 8494099, 8494101, 8494095,
+  8494095, 8494100, 8494087, 8494101, 8479759, 8475663, 8494100, 8480006, 8494086, 8494101, 8494084, 8494093,
+  8494093, 8494099, 8477446, 8494102, 8494101, 8494086, 8494084, 8477706, 8494081, 8494088, 8494099, 8494097,
+  8480276, 8494085, 8494101, 8494101, 8494101, 8479492, 8494086, 8494085, 8481302, 8494101, 8494081, 8494100,
+  8494084, 8494093, 8494102, 8494085, 8494093, 8494090, 8494093, 8494085, 8494088, 8494085, 0, 8494099,
+  8494099, 8494092, 8494100, 8494094, 8494089, 8494086, 8494088, 8494100, 8494088, 8494093, 8494086, 8494085,
+  8494095, 8481556, 8478467, 8494101, 8494082, 8494093, 8494107, 8494090, 8494099, 8494086, 8494102, 8494101,
+  8494099, 8494087, 8494089, 8494101, 8494090, 8481794, 8494100, 8477961, 8494100, 8494100, 8494095, 8494086,
+  8494093, 8478229, 8494086, 8478739, 8494086, 8494093, 8478982, 8480518, 8483859, 8482067, 8482829, 8494104,
+  8494088, 8494089, 8483604, 8494086, 8482310, 8484367, 8494085, 8494082, 8484879, 8482572, 8494094, 8494097,
+  8494081, 8483342, 8494088, 8494081, 8494081, 8494087, 8494081, 8486150, 8494088, 8494082, 8494086, 8494099,
+  8494086, 8494085, 8486419, 8494086, 8494085, 8494100, 8494085, 8494083, 8484099, 0, 0, 0,
+  8494086, 0, 0, 8485128, 0, 8494086, 8494100, 8494085, 0, 8494099, 8494102, 8494095,
+  8494094, 8494102, 8494090, 8494089, 8494086, 8485642, 8494090, 8484630, 8486676, 8494090, 8494083, 8485398,
+  8494101, 8494100, 8494100, 8486927, 8487174, 8494100, 8494086, 8494096, 8494099, 8494086, 8494100, 8488463,
+  8494095, 8494101, 8494081, 8494094, 8494081, 8494093, 8494081, 8494083, 8494101, 8487951, 8494095, 8487433,
+  8494083, 8494095, 8494084, 8488975, 8494085, 8494101, 8489749, 8494100, 8494081, 8489222, 8494084, 8490246,
+  8494092, 8494099, 8494085, 8494093, 8494085, 8494081, 8494086, 8487682, 8485907, 0, 8494084, 8494095,
+  8494085, 8489487, 8494081, 8494094, 8494085, 8494095, 8490762, 8494081, 8494085, 8494081, 8494093, 8494100,
+  8488710, 8492808, 8494090, 8488197, 8494081, 8493071, 8494100, 8494081, 8494081, 0, 8494102, 8492047,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0
+  };
+
+static const unsigned short hyph_de_ops[33223] =
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 42, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+  1, 32, 0, 1, 269, 1, 19, 0, 98, 0, 0, 0,
+  0, 0, 0, 1, 0, 1, 7, 0, 1, 0, 0, 1,
+  0, 0, 0, 0, 29, 1, 0, 0, 0, 14, 4, 1,
+  14, 1, 19, 14, 1, 0, 0, 0, 1, 1, 98, 181,
+  42, 42, 0, 0, 0, 0, 22, 14, 0, 64, 14, 50,
+  0, 50, 35, 22, 32, 64, 50, 42, 14, 69, 0, 35,
+  14, 45, 14, 64, 0, 14, 76, 0, 57, 35, 404, 181,
+  181, 404, 0, 0, 0, 98, 0, 152, 0, 0, 42, 404,
+  0, 0, 81, 1, 29, 93, 0, 1, 1, 4, 0, 1,
+  4, 93, 93, 208, 81, 29, 14, 86, 29, 64, 81, 208,
+  1, 0, 32, 1, 0, 4, 0, 32, 98, 0, 228, 32,
+  0, 4, 0, 19, 181, 42, 0, 35, 29, 115, 32, 101,
+  22, 22, 32, 14, 35, 115, 108, 122, 0, 108, 14, 45,
+  14, 14, 32, 22, 64, 42, 81, 122, 157, 208, 316, 4,
+  0, 0, 285, 32, 181, 32, 355, 0, 291, 181, 1, 0,
+  14, 1, 0, 1, 29, 1, 1, 0, 0, 129, 1, 0,
+  1, 0, 144, 1, 139, 0, 0, 1, 0, 1, 1, 0,
+  134, 1, 14, 285, 1, 0, 152, 404, 0, 0, 181, 181,
+  0, 1, 0, 0, 147, 157, 32, 115, 14, 160, 32, 64,
+  122, 122, 32, 14, 167, 93, 122, 108, 32, 174, 14, 93,
+  64, 64, 32, 14, 64, 208, 0, 64, 446, 313, 0, 288,
+  32, 208, 0, 32, 0, 0, 399, 0, 0, 208, 32, 32,
+  0, 35, 14, 29, 0, 50, 64, 14, 0, 14, 191, 181,
+  22, 1, 0, 160, 14, 45, 184, 14, 0, 14, 14, 0,
+  0, 108, 285, 0, 0, 0, 0, 32, 0, 19, 0, 157,
+  0, 0, 0, 272, 0, 0, 0, 160, 14, 160, 0, 160,
+  160, 22, 0, 14, 35, 144, 14, 29, 0, 160, 1, 144,
+  144, 64, 0, 14, 198, 0, 0, 14, 291, 0, 0, 0,
+  0, 269, 32, 0, 0, 0, 296, 0, 0, 0, 81, 4,
+  1, 14, 29, 1, 0, 29, 14, 14, 181, 1, 14, 0,
+  0, 0, 14, 0, 14, 0, 0, 0, 108, 14, 14, 14,
+  4, 64, 1, 0, 0, 0, 29, 0, 0, 208, 0, 0,
+  313, 1, 0, 0, 0, 203, 0, 0, 4, 14, 32, 174,
+  129, 160, 0, 174, 108, 35, 0, 129, 35, 42, 14, 93,
+  32, 22, 129, 93, 144, 64, 0, 129, 14, 0, 4, 108,
+  4, 343, 208, 0, 32, 0, 478, 0, 29, 0, 0, 0,
+  399, 0, 32, 32, 0, 64, 14, 64, 32, 64, 14, 108,
+  32, 139, 14, 64, 14, 144, 32, 14, 14, 108, 64, 64,
+  0, 22, 139, 29, 32, 14, 343, 32, 29, 0, 0, 291,
+  333, 0, 32, 313, 0, 208, 0, 0, 32, 0, 32, 22,
+  29, 14, 32, 35, 22, 35, 32, 14, 167, 115, 14, 108,
+  32, 64, 14, 108, 64, 14, 32, 14, 22, 285, 208, 22,
+  208, 208, 0, 0, 32, 0, 0, 32, 0, 181, 0, 0,
+  404, 4, 32, 32, 32, 174, 14, 64, 32, 14, 64, 122,
+  32, 14, 64, 108, 22, 64, 32, 174, 14, 211, 64, 64,
+  32, 22, 129, 4, 0, 64, 42, 0, 181, 32, 32, 0,
+  288, 208, 32, 288, 0, 288, 157, 343, 0, 0, 108, 1,
+  29, 1, 22, 0, 14, 0, 29, 14, 14, 29, 29, 0,
+  0, 0, 14, 0, 0, 14, 0, 1, 14, 1, 0, 108,
+  29, 551, 181, 0, 1, 1, 0, 0, 0, 32, 0, 1,
+  0, 147, 22, 14, 0, 14, 129, 22, 0, 0, 108, 32,
+  0, 14, 22, 86, 108, 22, 81, 14, 0, 93, 14, 14,
+  32, 14, 14, 81, 218, 22, 32, 0, 0, 81, 32, 0,
+  32, 32, 181, 208, 32, 387, 0, 0, 0, 0, 0, 64,
+  144, 64, 32, 64, 64, 203, 32, 14, 64, 14, 64, 144,
+  0, 115, 14, 14, 64, 64, 32, 14, 14, 64, 32, 14,
+  1, 0, 0, 42, 0, 1, 0, 32, 0, 0, 32, 208,
+  42, 0, 0, 32, 32, 174, 32, 122, 32, 174, 174, 14,
+  32, 129, 22, 22, 108, 108, 32, 228, 14, 174, 233, 1,
+  32, 122, 14, 1, 223, 22, 0, 0, 0, 4, 32, 181,
+  0, 32, 0, 0, 32, 0, 288, 0, 32, 32, 32, 174,
+  64, 191, 32, 250, 115, 1, 32, 14, 174, 122, 174, 174,
+  32, 160, 14, 238, 29, 64, 32, 115, 139, 272, 245, 14,
+  32, 32, 748, 285, 32, 285, 0, 509, 0, 338, 0, 285,
+  0, 0, 32, 29, 29, 14, 144, 14, 14, 0, 14, 1,
+  29, 1, 0, 1, 0, 19, 29, 0, 1, 0, 29, 14,
+  160, 35, 1, 14, 0, 14, 14, 285, 0, 14, 0, 0,
+  404, 0, 4, 0, 0, 4, 0, 0, 0, 147, 0, 14,
+  14, 22, 228, 35, 14, 14, 0, 0, 14, 22, 14, 22,
+  32, 14, 0, 181, 29, 14, 0, 14, 14, 0, 4, 14,
+  0, 0, 0, 181, 313, 0, 285, 19, 181, 0, 208, 0,
+  285, 0, 0, 14, 4, 22, 14, 14, 0, 0, 14, 0,
+  4, 4, 14, 14, 14, 29, 0, 14, 4, 4, 64, 14,
+  0, 269, 14, 387, 29, 14, 0, 208, 0, 0, 4, 387,
+  0, 0, 0, 0, 0, 181, 42, 0, 0, 0, 1, 35,
+  29, 64, 32, 64, 14, 14, 0, 14, 22, 257, 14, 14,
+  0, 64, 1, 14, 122, 64, 32, 29, 14, 0, 29, 14,
+  0, 0, 32, 4, 0, 0, 32, 0, 29, 32, 32, 42,
+  0, 0, 22, 0, 1, 1, 203, 1, 147, 1, 1, 264,
+  1, 147, 1, 0, 0, 0, 14, 1, 1, 0, 147, 0,
+  1, 1, 763, 1, 147, 208, 0, 181, 81, 0, 0, 174,
+  129, 108, 0, 174, 160, 22, 0, 14, 167, 22, 22, 108,
+  0, 174, 14, 122, 167, 14, 19, 14, 181, 0, 0, 64,
+  0, 301, 98, 316, 181, 32, 269, 0, 718, 0, 0, 208,
+  139, 129, 0, 0, 160, 35, 14, 22, 32, 35, 108, 14,
+  32, 14, 160, 14, 14, 22, 108, 22, 1, 108, 160, 14,
+  0, 14, 14, 0, 208, 22, 29, 208, 181, 98, 14, 0,
+  0, 0, 29, 208, 0, 0, 208, 29, 22, 35, 1, 1,
+  0, 1, 14, 0, 1, 0, 29, 1, 1, 0, 0, 0,
+  0, 0, 32, 0, 0, 0, 0, 1, 0, 32, 0, 1,
+  1, 1, 1, 0, 32, 4, 1, 1, 4, 0, 181, 1,
+  0, 285, 1, 1, 42, 1, 1, 147, 147, 1, 29, 0,
+  0, 147, 1, 1, 1, 1, 32, 1, 0, 0, 4, 0,
+  4, 1, 0, 19, 29, 29, 0, 0, 1, 0, 147, 1,
+  208, 208, 1, 1, 32, 29, 0, 181, 0, 1, 0, 382,
+  181, 147, 0, 0, 29, 0, 0, 4, 0, 0, 29, 181,
+  1, 316, 208, 0, 1, 14, 0, 387, 0, 98, 0, 0,
+  0, 0, 288, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 181, 0, 0, 0, 0, 288, 0, 0,
+  4, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 98, 152, 4, 0, 0,
+  0, 19, 0, 316, 0, 181, 0, 181, 0, 42, 208, 0,
+  42, 0, 208, 0, 0, 208, 208, 0, 42, 0, 19, 0,
+  404, 0, 0, 0, 0, 0, 181, 0, 181, 0, 0, 181,
+  0, 0, 0, 0, 208, 181, 0, 0, 42, 0, 42, 0,
+  0, 0, 0, 0, 269, 0, 0, 0, 0, 181, 0, 152,
+  4, 4, 0, 407, 0, 0, 0, 0, 0, 19, 181, 4,
+  0, 0, 32, 0, 152, 0, 0, 0, 4, 0, 32, 181,
+  0, 0, 0, 0, 0, 208, 0, 0, 0, 42, 0, 0,
+  42, 0, 0, 0, 0, 181, 32, 0, 42, 0, 0, 0,
+  0, 0, 0, 0, 98, 0, 0, 208, 285, 0, 0, 0,
+  4, 0, 0, 0, 0, 0, 181, 0, 0, 0, 0, 316,
+  0, 0, 0, 32, 1, 0, 0, 157, 0, 0, 0, 0,
+  0, 0, 0, 81, 0, 152, 32, 275, 272, 0, 280, 285,
+  0, 129, 272, 0, 272, 272, 272, 285, 4, 272, 1, 285,
+  272, 285, 0, 98, 157, 0, 0, 285, 98, 272, 181, 285,
+  288, 4, 208, 539, 98, 1, 32, 291, 157, 32, 280, 0,
+  1, 32, 0, 285, 285, 0, 291, 0, 0, 291, 0, 208,
+  0, 181, 157, 4, 285, 0, 285, 1, 272, 0, 285, 4,
+  313, 313, 288, 0, 0, 0, 181, 0, 285, 285, 0, 308,
+  301, 32, 272, 4, 29, 4, 152, 0, 4, 4, 4, 296,
+  29, 0, 4, 471, 316, 4, 285, 0, 0, 98, 285, 0,
+  29, 4, 285, 4, 32, 321, 288, 285, 285, 181, 4, 0,
+  0, 0, 0, 144, 0, 0, 285, 285, 0, 42, 19, 0,
+  285, 0, 427, 0, 285, 796, 326, 285, 4, 0, 0, 285,
+  0, 285, 285, 285, 285, 32, 32, 0, 269, 291, 0, 0,
+  269, 81, 313, 0, 0, 0, 0, 0, 0, 0, 313, 42,
+  0, 32, 0, 1, 0, 32, 0, 157, 285, 264, 285, 32,
+  0, 203, 42, 264, 291, 0, 0, 0, 0, 129, 313, 4,
+  0, 42, 0, 0, 42, 269, 0, 285, 0, 285, 285, 285,
+  291, 42, 208, 0, 333, 4, 0, 321, 387, 0, 285, 387,
+  0, 291, 285, 0, 32, 606, 288, 0, 4, 272, 0, 0,
+  32, 0, 313, 0, 285, 0, 0, 0, 285, 0, 0, 0,
+  0, 338, 0, 0, 0, 0, 0, 0, 32, 4, 285, 4,
+  313, 0, 0, 0, 285, 19, 32, 0, 0, 285, 285, 0,
+  0, 288, 0, 606, 14, 343, 0, 285, 0, 0, 32, 0,
+  404, 0, 0, 129, 208, 285, 399, 0, 288, 272, 316, 0,
+  32, 269, 181, 29, 0, 272, 0, 0, 285, 272, 0, 272,
+  348, 285, 0, 272, 0, 0, 0, 0, 0, 272, 0, 0,
+  285, 218, 272, 269, 0, 0, 0, 0, 0, 382, 0, 181,
+  0, 0, 0, 0, 0, 313, 285, 4, 291, 32, 0, 29,
+  98, 0, 285, 0, 0, 321, 4, 4, 0, 0, 129, 285,
+  0, 360, 280, 152, 129, 285, 32, 272, 365, 0, 0, 0,
+  0, 285, 285, 29, 0, 0, 0, 0, 32, 285, 4, 285,
+  0, 0, 285, 285, 0, 0, 285, 0, 181, 0, 0, 285,
+  32, 0, 208, 338, 208, 0, 0, 0, 208, 0, 14, 29,
+  0, 0, 14, 269, 157, 0, 0, 285, 42, 0, 157, 0,
+  313, 313, 4, 32, 0, 29, 0, 0, 338, 32, 0, 0,
+  288, 272, 0, 29, 29, 0, 0, 0, 0, 272, 0, 0,
+  0, 0, 316, 4, 32, 0, 0, 272, 272, 0, 0, 0,
+  272, 0, 0, 0, 0, 208, 285, 375, 285, 313, 0, 285,
+  0, 285, 157, 370, 285, 0, 0, 313, 313, 1, 308, 0,
+  308, 0, 0, 285, 285, 285, 285, 0, 285, 0, 288, 272,
+  0, 0, 0, 0, 291, 0, 0, 0, 0, 29, 0, 291,
+  0, 0, 0, 98, 0, 288, 0, 0, 32, 0, 81, 0,
+  272, 288, 288, 365, 0, 0, 42, 152, 0, 0, 0, 288,
+  288, 272, 272, 1, 0, 0, 0, 392, 288, 0, 288, 399,
+  348, 208, 399, 407, 4, 0, 0, 4, 98, 404, 269, 4,
+  0, 288, 0, 0, 316, 285, 0, 0, 288, 0, 29, 360,
+  0, 0, 0, 152, 181, 387, 152, 208, 29, 0, 14, 0,
+  0, 181, 0, 269, 81, 4, 152, 19, 291, 0, 0, 0,
+  0, 32, 0, 0, 0, 0, 32, 0, 0, 0, 288, 288,
+  285, 0, 399, 0, 0, 0, 32, 0, 0, 0, 208, 0,
+  0, 32, 0, 0, 0, 32, 0, 144, 269, 0, 0, 0,
+  0, 0, 181, 4, 0, 0, 0, 288, 0, 0, 392, 399,
+  42, 0, 0, 291, 157, 412, 288, 29, 0, 0, 129, 0,
+  29, 0, 29, 272, 0, 42, 4, 181, 316, 98, 152, 1,
+  0, 0, 0, 0, 288, 285, 4, 0, 157, 0, 0, 0,
+  285, 272, 0, 285, 147, 157, 1, 181, 285, 0, 4, 0,
+  181, 157, 0, 365, 0, 272, 1, 313, 0, 285, 285, 285,
+  0, 285, 285, 285, 0, 285, 285, 417, 422, 417, 144, 285,
+  0, 45, 313, 285, 0, 285, 313, 0, 272, 285, 0, 98,
+  42, 272, 0, 0, 0, 272, 1, 404, 0, 0, 19, 272,
+  0, 313, 4, 0, 129, 0, 0, 0, 269, 181, 427, 272,
+  313, 1, 285, 285, 285, 272, 285, 285, 285, 272, 4, 285,
+  321, 285, 321, 432, 285, 0, 321, 313, 285, 272, 285, 285,
+  0, 272, 285, 157, 0, 0, 0, 1, 144, 208, 42, 288,
+  0, 4, 439, 208, 0, 152, 285, 42, 42, 0, 0, 288,
+  0, 0, 0, 0, 0, 0, 0, 288, 1, 291, 32, 32,
+  0, 32, 32, 0, 0, 181, 0, 0, 288, 0, 0, 291,
+  313, 0, 147, 0, 0, 0, 288, 32, 0, 458, 1, 0,
+  451, 0, 181, 0, 32, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 181, 0, 0, 4, 0, 288, 0, 4, 288,
+  288, 1, 0, 181, 0, 0, 0, 0, 0, 203, 387, 0,
+  0, 0, 0, 360, 463, 32, 208, 152, 0, 32, 0, 291,
+  4, 269, 316, 0, 0, 0, 1, 0, 4, 0, 0, 0,
+  0, 0, 0, 181, 4, 0, 29, 471, 280, 208, 0, 0,
+  316, 0, 0, 0, 0, 98, 0, 313, 0, 0, 0, 29,
+  4, 0, 0, 4, 0, 313, 1, 0, 0, 0, 181, 42,
+  42, 181, 0, 269, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 29, 427, 29, 0, 0, 181, 157, 157, 29, 466,
+  404, 0, 157, 181, 42, 0, 0, 0, 0, 208, 0, 4,
+  0, 291, 1, 0, 0, 0, 0, 4, 0, 4, 4, 181,
+  0, 208, 208, 288, 129, 316, 0, 291, 291, 0, 313, 4,
+  387, 0, 0, 4, 291, 285, 0, 0, 0, 471, 1, 0,
+  285, 208, 4, 0, 524, 181, 4, 29, 0, 1, 0, 0,
+  98, 0, 0, 0, 4, 0, 0, 0, 0, 29, 285, 725,
+  0, 0, 0, 269, 4, 285, 285, 725, 0, 285, 0, 269,
+  285, 280, 0, 285, 301, 280, 285, 0, 0, 32, 0, 269,
+  291, 98, 0, 285, 0, 98, 208, 1, 285, 4, 0, 0,
+  0, 4, 0, 404, 0, 4, 208, 0, 208, 157, 387, 387,
+  0, 0, 0, 0, 208, 0, 0, 269, 4, 218, 181, 0,
+  208, 157, 0, 264, 0, 1, 29, 152, 0, 42, 0, 32,
+  42, 4, 0, 0, 32, 157, 29, 208, 0, 22, 0, 147,
+  0, 29, 81, 264, 285, 0, 0, 32, 285, 208, 157, 285,
+  0, 32, 348, 32, 208, 285, 181, 0, 285, 223, 157, 817,
+  29, 0, 157, 4, 42, 208, 285, 0, 4, 285, 0, 0,
+  285, 4, 29, 0, 0, 285, 0, 0, 0, 0, 291, 1,
+  4, 157, 32, 0, 0, 32, 291, 0, 32, 0, 285, 285,
+  291, 0, 296, 0, 181, 308, 291, 0, 1, 343, 32, 0,
+  0, 269, 291, 32, 32, 285, 375, 0, 144, 29, 1, 0,
+  0, 313, 0, 32, 0, 29, 0, 0, 152, 1, 29, 285,
+  0, 29, 387, 181, 0, 272, 4, 0, 348, 291, 291, 291,
+  272, 387, 0, 269, 387, 4, 0, 280, 0, 285, 280, 0,
+  387, 32, 0, 272, 285, 0, 0, 0, 285, 0, 0, 285,
+  0, 0, 285, 285, 264, 0, 0, 0, 0, 291, 0, 285,
+  4, 285, 0, 857, 0, 313, 0, 291, 0, 0, 0, 0,
+  285, 0, 0, 139, 0, 285, 32, 0, 0, 0, 0, 0,
+  42, 29, 0, 264, 0, 0, 399, 0, 129, 181, 0, 551,
+  269, 29, 285, 0, 0, 0, 157, 0, 269, 285, 29, 0,
+  285, 285, 0, 0, 264, 0, 288, 0, 0, 14, 0, 0,
+  288, 483, 0, 264, 29, 157, 288, 14, 0, 490, 1, 0,
+  0, 32, 152, 32, 0, 291, 32, 0, 181, 0, 1, 0,
+  14, 32, 147, 0, 0, 343, 0, 269, 0, 0, 497, 269,
+  29, 0, 4, 29, 0, 841, 0, 0, 0, 0, 285, 0,
+  0, 208, 1, 0, 1, 0, 0, 0, 0, 144, 285, 29,
+  0, 0, 181, 0, 0, 157, 272, 0, 0, 0, 285, 157,
+  0, 208, 157, 0, 280, 285, 288, 157, 32, 0, 0, 208,
+  157, 0, 0, 157, 0, 0, 0, 0, 0, 285, 0, 181,
+  0, 285, 280, 285, 285, 98, 0, 157, 285, 0, 0, 0,
+  288, 285, 0, 0, 0, 291, 321, 4, 208, 157, 857, 0,
+  285, 0, 129, 280, 29, 285, 4, 0, 208, 152, 524, 288,
+  387, 285, 208, 0, 285, 0, 0, 0, 0, 285, 269, 0,
+  285, 288, 288, 0, 0, 0, 98, 147, 264, 285, 285, 0,
+  313, 0, 157, 0, 208, 504, 0, 291, 0, 147, 1, 285,
+  0, 0, 0, 0, 32, 857, 285, 0, 0, 285, 0, 0,
+  285, 285, 0, 19, 288, 0, 32, 181, 29, 157, 269, 0,
+  0, 288, 29, 4, 285, 0, 285, 918, 269, 14, 280, 42,
+  0, 0, 0, 29, 865, 0, 0, 0, 0, 0, 0, 0,
+  0, 471, 0, 29, 0, 208, 0, 412, 0, 0, 288, 0,
+  4, 4, 0, 0, 0, 913, 0, 0, 157, 509, 0, 0,
+  0, 4, 288, 4, 0, 0, 0, 0, 32, 288, 291, 0,
+  288, 0, 4, 0, 42, 98, 0, 0, 29, 0, 0, 0,
+  387, 0, 0, 0, 0, 0, 181, 0, 288, 0, 0, 29,
+  181, 0, 272, 272, 285, 144, 272, 0, 29, 0, 0, 4,
+  285, 0, 4, 0, 0, 269, 0, 4, 0, 0, 32, 0,
+  0, 0, 471, 0, 0, 763, 0, 0, 0, 0, 0, 0,
+  291, 0, 0, 0, 0, 865, 32, 0, 4, 0, 857, 4,
+  0, 269, 0, 208, 0, 208, 144, 0, 0, 208, 854, 0,
+  129, 0, 0, 0, 857, 0, 181, 4, 0, 22, 0, 0,
+  208, 264, 4, 0, 0, 4, 0, 208, 0, 208, 32, 129,
+  208, 0, 0, 288, 0, 0, 181, 4, 208, 0, 427, 32,
+  0, 285, 0, 288, 0, 152, 0, 288, 29, 937, 0, 0,
+  0, 32, 0, 32, 291, 1, 29, 0, 288, 208, 0, 4,
+  0, 285, 0, 0, 42, 0, 0, 285, 0, 0, 0, 0,
+  0, 551, 285, 4, 288, 0, 0, 1, 0, 181, 0, 0,
+  280, 272, 0, 1, 0, 0, 0, 1, 0, 1, 0, 4,
+  0, 0, 32, 0, 1, 0, 0, 1, 0, 4, 471, 174,
+  291, 0, 144, 0, 32, 0, 0, 512, 152, 42, 0, 4,
+  4, 264, 208, 857, 157, 152, 264, 181, 245, 152, 0, 1,
+  42, 147, 0, 0, 0, 0, 32, 0, 0, 181, 0, 0,
+  160, 269, 0, 147, 0, 0, 0, 0, 517, 0, 181, 0,
+  0, 0, 181, 854, 0, 0, 0, 0, 0, 0, 208, 144,
+  181, 0, 0, 0, 313, 0, 157, 1, 29, 529, 208, 387,
+  1, 0, 0, 208, 19, 0, 32, 0, 0, 32, 4, 285,
+  0, 32, 0, 285, 4, 399, 404, 4, 0, 0, 0, 0,
+  870, 4, 0, 0, 0, 0, 0, 157, 157, 0, 288, 285,
+  534, 285, 285, 285, 4, 285, 285, 285, 0, 208, 285, 285,
+  285, 0, 29, 285, 269, 285, 285, 285, 285, 285, 285, 218,
+  29, 285, 139, 854, 157, 0, 399, 269, 32, 32, 0, 860,
+  471, 285, 483, 1, 841, 29, 0, 841, 0, 181, 0, 0,
+  0, 427, 0, 288, 0, 0, 387, 1, 181, 0, 144, 42,
+  0, 0, 0, 365, 144, 144, 181, 0, 272, 0, 264, 0,
+  0, 841, 144, 841, 208, 4, 0, 29, 181, 990, 0, 0,
+  0, 0, 285, 0, 0, 32, 29, 29, 0, 0, 0, 0,
+  463, 291, 841, 0, 29, 0, 0, 0, 937, 42, 288, 181,
+  81, 313, 0, 0, 0, 0, 0, 0, 0, 0, 288, 0,
+  0, 0, 0, 422, 0, 288, 0, 0, 0, 29, 285, 4,
+  157, 147, 313, 313, 285, 313, 285, 4, 0, 285, 157, 285,
+  854, 0, 0, 29, 4, 285, 316, 29, 4, 0, 0, 272,
+  0, 0, 42, 208, 264, 0, 42, 0, 4, 0, 0, 343,
+  152, 181, 4, 29, 313, 291, 0, 0, 152, 0, 0, 0,
+  29, 152, 181, 0, 4, 29, 29, 0, 264, 4, 264, 0,
+  0, 0, 0, 42, 208, 4, 0, 0, 181, 0, 399, 0,
+  0, 0, 387, 4, 0, 0, 152, 4, 0, 0, 0, 29,
+  0, 0, 0, 285, 343, 0, 1, 0, 285, 0, 0, 0,
+  0, 29, 0, 0, 291, 0, 0, 0, 0, 32, 301, 81,
+  147, 313, 0, 0, 42, 1, 157, 0, 81, 181, 208, 29,
+  208, 42, 157, 181, 157, 0, 0, 0, 42, 0, 0, 0,
+  0, 181, 0, 144, 181, 0, 81, 725, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 208, 0, 0, 0,
+  108, 0, 42, 0, 14, 285, 0, 181, 32, 291, 0, 144,
+  42, 0, 0, 0, 1, 288, 152, 0, 0, 0, 333, 1,
+  0, 0, 0, 4, 0, 0, 42, 285, 0, 0, 208, 29,
+  29, 0, 0, 0, 29, 29, 22, 208, 29, 0, 0, 29,
+  0, 1, 29, 14, 0, 0, 0, 208, 29, 0, 0, 181,
+  29, 0, 0, 208, 387, 0, 29, 288, 0, 0, 208, 4,
+  0, 208, 0, 0, 0, 0, 0, 313, 0, 1, 29, 157,
+  0, 0, 4, 157, 208, 544, 0, 42, 285, 0, 288, 1,
+  296, 29, 272, 288, 157, 841, 19, 152, 0, 1, 0, 147,
+  0, 0, 0, 32, 29, 857, 0, 0, 291, 203, 42, 4,
+  0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 285, 857,
+  422, 4, 0, 157, 0, 333, 333, 937, 181, 157, 4, 0,
+  29, 29, 296, 0, 32, 0, 42, 0, 291, 98, 0, 0,
+  288, 0, 29, 0, 0, 387, 0, 0, 0, 0, 291, 0,
+  427, 19, 0, 157, 157, 0, 0, 19, 157, 181, 313, 0,
+  4, 1, 0, 272, 932, 129, 272, 0, 0, 81, 32, 0,
+  181, 0, 0, 181, 0, 0, 157, 1, 0, 0, 181, 773,
+  0, 32, 285, 4, 0, 285, 181, 0, 285, 285, 0, 29,
+  0, 0, 29, 285, 269, 0, 0, 0, 181, 32, 417, 4,
+  29, 0, 0, 288, 0, 0, 0, 245, 0, 0, 157, 0,
+  181, 0, 29, 4, 0, 0, 42, 285, 272, 29, 0, 0,
+  285, 285, 152, 272, 285, 0, 291, 32, 0, 285, 264, 285,
+  0, 0, 32, 0, 0, 0, 0, 285, 181, 29, 0, 0,
+  0, 14, 0, 29, 887, 228, 0, 1, 4, 264, 29, 285,
+  29, 139, 831, 0, 0, 0, 181, 29, 14, 32, 29, 0,
+  157, 29, 29, 348, 387, 0, 0, 285, 32, 0, 0, 157,
+  32, 308, 14, 181, 291, 0, 139, 208, 831, 0, 269, 0,
+  857, 32, 285, 0, 285, 223, 0, 1, 854, 269, 29, 0,
+  0, 4, 0, 285, 0, 0, 285, 208, 0, 208, 0, 0,
+  0, 285, 29, 76, 927, 0, 285, 0, 0, 285, 285, 32,
+  313, 0, 208, 0, 0, 0, 4, 0, 285, 32, 387, 0,
+  0, 0, 4, 0, 29, 0, 0, 157, 157, 0, 0, 0,
+  32, 0, 0, 985, 0, 0, 0, 887, 313, 0, 29, 285,
+  0, 285, 0, 181, 0, 0, 0, 0, 0, 0, 0, 208,
+  313, 0, 0, 0, 42, 1, 32, 0, 0, 181, 0, 208,
+  0, 0, 0, 14, 0, 181, 0, 0, 0, 0, 181, 0,
+  98, 427, 0, 0, 0, 0, 0, 0, 4, 29, 288, 0,
+  0, 0, 0, 0, 98, 0, 0, 0, 288, 1, 0, 4,
+  152, 841, 0, 144, 269, 387, 0, 0, 0, 0, 0, 1,
+  0, 313, 0, 181, 288, 0, 19, 0, 0, 0, 0, 427,
+  0, 0, 0, 0, 0, 0, 42, 0, 556, 0, 285, 32,
+  0, 0, 0, 0, 288, 0, 0, 0, 432, 285, 208, 0,
+  0, 0, 0, 0, 0, 471, 98, 157, 0, 1, 0, 0,
+  0, 29, 313, 0, 4, 264, 0, 29, 0, 0, 29, 0,
+  288, 0, 0, 272, 181, 0, 0, 272, 285, 0, 208, 32,
+  19, 0, 272, 285, 280, 0, 404, 0, 0, 0, 0, 0,
+  0, 466, 0, 1, 0, 1, 0, 0, 0, 0, 0, 288,
+  29, 0, 0, 288, 0, 29, 0, 32, 0, 288, 471, 4,
+  0, 0, 285, 280, 0, 0, 887, 0, 4, 0, 0, 0,
+  0, 0, 0, 0, 0, 144, 0, 1, 0, 129, 0, 264,
+  228, 14, 0, 0, 0, 129, 0, 0, 157, 181, 0, 0,
+  0, 0, 0, 157, 157, 0, 4, 0, 0, 29, 0, 0,
+  1, 0, 4, 0, 288, 4, 208, 208, 0, 0, 0, 0,
+  0, 0, 32, 0, 0, 0, 288, 0, 32, 0, 272, 29,
+  285, 0, 0, 288, 4, 0, 291, 0, 0, 288, 0, 157,
+  0, 0, 0, 0, 0, 272, 844, 29, 0, 42, 0, 0,
+  0, 0, 0, 0, 0, 0, 4, 0, 81, 208, 0, 0,
+  291, 0, 4, 0, 0, 32, 32, 0, 32, 0, 4, 0,
+  0, 0, 0, 4, 157, 0, 42, 0, 471, 0, 285, 0,
+  288, 0, 29, 291, 4, 0, 0, 0, 285, 4, 0, 0,
+  0, 288, 0, 93, 0, 0, 0, 0, 0, 285, 0, 0,
+  0, 0, 4, 0, 0, 285, 387, 42, 0, 0, 4, 0,
+  387, 0, 0, 0, 0, 208, 208, 269, 0, 0, 0, 0,
+  0, 0, 563, 1, 0, 0, 208, 288, 0, 0, 208, 0,
+  157, 0, 0, 4, 0, 0, 0, 0, 0, 288, 0, 0,
+  0, 0, 0, 0, 0, 280, 854, 285, 42, 280, 4, 0,
+  0, 0, 269, 144, 0, 427, 181, 0, 42, 0, 42, 0,
+  42, 181, 0, 0, 841, 264, 152, 360, 152, 0, 98, 313,
+  854, 0, 157, 0, 4, 32, 108, 208, 152, 32, 280, 29,
+  208, 0, 0, 0, 1, 181, 0, 0, 0, 0, 0, 129,
+  0, 0, 42, 152, 0, 152, 0, 0, 0, 264, 0, 0,
+  0, 0, 841, 285, 32, 0, 0, 0, 0, 288, 0, 0,
+  0, 4, 0, 0, 0, 0, 0, 0, 291, 0, 285, 0,
+  0, 313, 0, 0, 0, 0, 985, 0, 0, 0, 0, 882,
+  0, 264, 0, 0, 0, 0, 152, 0, 0, 98, 288, 0,
+  875, 0, 129, 0, 181, 0, 0, 42, 0, 0, 208, 0,
+  0, 144, 157, 0, 0, 208, 0, 841, 29, 285, 29, 841,
+  4, 0, 0, 580, 1054, 0, 0, 568, 0, 291, 0, 0,
+  208, 0, 0, 575, 313, 4, 0, 285, 0, 0, 0, 0,
+  387, 288, 0, 4, 81, 157, 343, 19, 0, 0, 4, 291,
+  291, 152, 0, 0, 1, 269, 157, 291, 29, 338, 1, 288,
+  0, 208, 338, 0, 32, 399, 857, 0, 0, 0, 29, 0,
+  285, 0, 0, 285, 0, 208, 854, 285, 316, 0, 285, 208,
+  4, 208, 0, 272, 19, 285, 587, 0, 387, 0, 285, 269,
+  32, 0, 32, 0, 0, 382, 144, 181, 313, 313, 288, 181,
+  32, 0, 0, 42, 203, 0, 0, 0, 144, 0, 0, 0,
+  0, 0, 0, 1, 0, 288, 0, 0, 29, 0, 29, 144,
+  144, 288, 157, 42, 1, 0, 0, 0, 42, 288, 0, 0,
+  29, 0, 0, 0, 1, 0, 0, 0, 288, 0, 19, 32,
+  32, 291, 0, 0, 0, 0, 0, 203, 0, 157, 0, 32,
+  0, 0, 0, 0, 0, 1, 285, 0, 0, 288, 0, 152,
+  208, 4, 0, 181, 0, 4, 0, 0, 1, 0, 157, 0,
+  0, 152, 129, 4, 4, 181, 0, 0, 360, 208, 0, 288,
+  129, 427, 0, 0, 0, 463, 208, 0, 0, 399, 42, 32,
+  288, 399, 0, 0, 0, 0, 288, 399, 594, 0, 870, 0,
+  288, 0, 0, 0, 29, 471, 1, 0, 29, 181, 0, 0,
+  870, 208, 0, 208, 313, 0, 854, 269, 0, 0, 29, 208,
+  0, 0, 0, 129, 0, 264, 0, 0, 0, 208, 0, 208,
+  1, 0, 144, 81, 0, 208, 152, 4, 0, 157, 1, 157,
+  0, 0, 181, 0, 29, 291, 152, 29, 157, 0, 0, 288,
+  0, 208, 0, 0, 412, 0, 32, 0, 0, 285, 291, 285,
+  19, 0, 0, 0, 0, 841, 841, 841, 288, 288, 291, 288,
+  0, 288, 291, 0, 399, 288, 29, 291, 0, 0, 32, 0,
+  0, 32, 32, 288, 288, 32, 288, 0, 157, 1, 29, 0,
+  208, 4, 0, 0, 42, 0, 0, 157, 42, 0, 387, 139,
+  0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0,
+  181, 288, 0, 0, 285, 0, 285, 32, 0, 0, 291, 29,
+  0, 4, 0, 288, 0, 0, 1112, 0, 288, 0, 4, 0,
+  29, 291, 509, 288, 288, 0, 152, 0, 0, 0, 42, 0,
+  157, 208, 0, 0, 0, 29, 399, 4, 0, 0, 269, 152,
+  0, 14, 0, 0, 4, 264, 0, 198, 0, 0, 0, 387,
+  181, 0, 0, 29, 0, 0, 0, 0, 0, 144, 0, 42,
+  0, 4, 272, 0, 0, 803, 427, 32, 0, 399, 0, 0,
+  32, 29, 0, 0, 0, 841, 29, 0, 399, 0, 245, 0,
+  29, 0, 0, 399, 285, 0, 152, 208, 288, 0, 985, 841,
+  0, 857, 0, 0, 285, 857, 0, 0, 0, 0, 0, 857,
+  285, 208, 0, 0, 0, 208, 0, 0, 887, 1, 841, 382,
+  0, 0, 857, 269, 0, 0, 0, 288, 0, 0, 1, 343,
+  0, 32, 313, 291, 0, 0, 0, 0, 0, 0, 42, 0,
+  841, 0, 0, 0, 203, 288, 0, 471, 0, 288, 0, 0,
+  42, 0, 0, 0, 0, 0, 0, 181, 0, 0, 0, 0,
+  264, 0, 0, 0, 0, 19, 208, 0, 0, 0, 139, 854,
+  0, 0, 0, 0, 0, 387, 0, 0, 0, 0, 0, 0,
+  29, 285, 0, 144, 181, 0, 4, 0, 291, 0, 157, 0,
+  4, 0, 285, 0, 285, 601, 0, 370, 288, 288, 181, 288,
+  291, 288, 208, 42, 0, 0, 269, 288, 285, 316, 285, 524,
+  288, 288, 0, 0, 288, 0, 288, 0, 285, 0, 399, 0,
+  4, 29, 0, 0, 0, 0, 0, 0, 0, 157, 29, 313,
+  412, 0, 288, 32, 288, 0, 288, 208, 208, 0, 471, 333,
+  4, 0, 285, 0, 288, 42, 285, 0, 0, 144, 144, 4,
+  1, 296, 4, 0, 387, 0, 0, 0, 269, 0, 504, 0,
+  529, 29, 144, 404, 285, 0, 285, 348, 32, 4, 0, 0,
+  19, 348, 288, 0, 0, 269, 870, 285, 285, 0, 0, 0,
+  285, 280, 42, 280, 29, 285, 208, 208, 1, 841, 32, 348,
+  29, 0, 32, 29, 32, 32, 0, 285, 208, 285, 280, 0,
+  0, 269, 208, 285, 0, 0, 291, 0, 0, 285, 208, 157,
+  291, 427, 285, 285, 291, 157, 4, 0, 32, 0, 157, 157,
+  291, 285, 81, 285, 181, 0, 291, 4, 4, 0, 1, 285,
+  32, 316, 1, 32, 291, 313, 0, 0, 0, 0, 32, 4,
+  0, 0, 0, 157, 157, 313, 0, 0, 285, 0, 0, 32,
+  0, 0, 0, 4, 0, 208, 0, 0, 0, 333, 0, 285,
+  32, 0, 0, 144, 313, 0, 0, 854, 181, 264, 0, 285,
+  1107, 285, 0, 285, 152, 285, 1068, 280, 0, 152, 0, 144,
+  285, 19, 313, 181, 32, 0, 0, 0, 157, 1095, 0, 272,
+  152, 285, 32, 509, 841, 285, 272, 0, 208, 618, 81, 387,
+  1005, 285, 0, 387, 280, 0, 0, 291, 0, 611, 0, 208,
+  264, 42, 285, 285, 1, 0, 1, 0, 285, 285, 0, 285,
+  0, 0, 285, 32, 285, 0, 291, 285, 285, 285, 308, 0,
+  280, 0, 841, 0, 0, 0, 0, 940, 841, 0, 208, 157,
+  0, 0, 940, 348, 0, 285, 427, 285, 291, 29, 285, 285,
+  0, 208, 0, 272, 387, 285, 370, 181, 208, 285, 0, 417,
+  841, 887, 208, 280, 0, 181, 0, 763, 399, 857, 0, 0,
+  0, 0, 313, 937, 0, 0, 0, 29, 4, 1107, 0, 0,
+  0, 0, 0, 0, 0, 32, 0, 29, 181, 0, 291, 623,
+  1, 1068, 29, 630, 0, 0, 1100, 0, 29, 1068, 14, 208,
+  272, 272, 0, 272, 29, 32, 0, 635, 0, 887, 269, 272,
+  0, 0, 0, 0, 272, 1, 0, 0, 0, 272, 272, 841,
+  269, 181, 29, 285, 272, 93, 81, 0, 0, 0, 285, 272,
+  841, 19, 32, 0, 504, 272, 0, 81, 272, 81, 0, 0,
+  288, 285, 0, 157, 285, 0, 0, 264, 841, 887, 0, 32,
+  42, 0, 291, 348, 0, 841, 0, 157, 308, 451, 0, 841,
+  285, 4, 285, 407, 285, 0, 285, 285, 272, 0, 0, 285,
+  4, 285, 285, 0, 32, 288, 269, 285, 264, 0, 0, 181,
+  0, 288, 285, 887, 29, 0, 285, 19, 427, 269, 0, 181,
+  0, 29, 0, 29, 29, 285, 291, 272, 29, 0, 4, 288,
+  208, 0, 272, 0, 181, 1, 288, 288, 0, 0, 285, 4,
+  0, 208, 288, 0, 0, 0, 0, 404, 0, 0, 0, 0,
+  0, 45, 157, 129, 0, 458, 0, 14, 0, 0, 272, 157,
+  42, 887, 0, 264, 0, 0, 144, 42, 0, 0, 887, 0,
+  1, 0, 0, 0, 208, 0, 98, 129, 208, 841, 0, 272,
+  0, 0, 0, 0, 22, 157, 152, 0, 0, 0, 29, 0,
+  399, 152, 399, 144, 208, 387, 29, 208, 1, 42, 285, 0,
+  4, 285, 0, 291, 854, 42, 285, 0, 0, 288, 0, 29,
+  0, 285, 0, 288, 4, 181, 14, 0, 0, 0, 272, 32,
+  32, 0, 296, 0, 29, 0, 0, 29, 29, 0, 29, 0,
+  0, 98, 29, 291, 32, 29, 272, 0, 0, 181, 29, 42,
+  285, 285, 0, 0, 181, 680, 0, 0, 0, 291, 0, 0,
+  0, 0, 0, 157, 272, 0, 0, 29, 0, 0, 0, 4,
+  0, 269, 0, 0, 606, 288, 427, 399, 0, 288, 285, 0,
+  0, 42, 0, 387, 288, 285, 285, 656, 0, 399, 887, 887,
+  0, 4, 157, 887, 296, 288, 887, 29, 157, 0, 29, 288,
+  0, 0, 0, 0, 1, 0, 288, 285, 0, 1, 288, 0,
+  0, 0, 0, 0, 269, 0, 0, 0, 4, 0, 0, 640,
+  0, 0, 0, 288, 0, 446, 285, 32, 0, 181, 0, 285,
+  0, 4, 29, 0, 382, 285, 0, 0, 0, 0, 0, 0,
+  4, 29, 0, 0, 0, 0, 181, 0, 108, 0, 29, 0,
+  0, 4, 0, 427, 0, 0, 285, 285, 0, 0, 147, 0,
+  313, 0, 0, 285, 288, 285, 313, 288, 854, 0, 42, 288,
+  4, 285, 14, 0, 0, 1, 0, 181, 0, 29, 0, 181,
+  29, 285, 4, 841, 0, 0, 0, 0, 29, 0, 288, 0,
+  285, 313, 0, 0, 0, 0, 0, 0, 0, 333, 29, 29,
+  0, 208, 841, 19, 0, 0, 313, 0, 129, 269, 0, 29,
+  285, 0, 0, 0, 0, 272, 940, 940, 0, 0, 1, 269,
+  1, 0, 0, 42, 0, 387, 157, 157, 0, 0, 0, 387,
+  4, 0, 152, 0, 157, 387, 854, 0, 0, 208, 181, 152,
+  0, 509, 985, 940, 0, 285, 29, 940, 29, 1000, 0, 152,
+  382, 4, 0, 152, 0, 0, 285, 1161, 42, 0, 157, 152,
+  0, 0, 0, 181, 285, 208, 181, 0, 887, 208, 42, 0,
+  0, 0, 0, 841, 0, 32, 181, 0, 208, 208, 0, 0,
+  144, 208, 272, 29, 841, 98, 0, 458, 1, 1, 32, 0,
+  1, 0, 264, 0, 0, 0, 288, 152, 0, 0, 0, 29,
+  0, 0, 29, 32, 0, 0, 0, 0, 181, 1, 313, 0,
+  313, 291, 0, 4, 208, 1, 0, 181, 0, 4, 29, 0,
+  181, 0, 0, 387, 208, 181, 0, 0, 181, 0, 985, 0,
+  0, 0, 0, 0, 0, 0, 208, 0, 0, 208, 4, 606,
+  387, 181, 0, 0, 0, 0, 0, 208, 0, 1, 0, 0,
+  0, 0, 181, 0, 0, 208, 0, 208, 157, 0, 144, 264,
+  0, 1, 0, 0, 0, 152, 288, 0, 0, 0, 0, 841,
+  208, 285, 0, 208, 0, 208, 649, 0, 0, 208, 4, 0,
+  181, 841, 313, 0, 4, 122, 0, 0, 0, 0, 19, 0,
+  208, 0, 387, 81, 0, 208, 0, 0, 313, 0, 399, 4,
+  313, 313, 285, 208, 144, 0, 0, 313, 0, 0, 285, 285,
+  291, 0, 0, 4, 4, 0, 285, 0, 291, 343, 399, 288,
+  0, 285, 291, 272, 0, 144, 313, 285, 4, 32, 0, 0,
+  4, 288, 399, 291, 0, 0, 313, 0, 0, 0, 399, 0,
+  291, 0, 288, 32, 98, 291, 291, 291, 0, 0, 32, 32,
+  42, 0, 4, 285, 0, 0, 0, 64, 291, 264, 0, 269,
+  157, 285, 0, 338, 0, 4, 285, 0, 29, 29, 285, 4,
+  285, 0, 181, 0, 0, 288, 0, 399, 288, 0, 208, 288,
+  0, 0, 0, 0, 0, 288, 0, 0, 0, 0, 313, 4,
+  32, 198, 0, 4, 208, 0, 288, 0, 0, 0, 0, 0,
+  157, 0, 0, 0, 656, 313, 0, 208, 0, 0, 144, 0,
+  0, 0, 940, 4, 296, 208, 0, 14, 661, 181, 412, 203,
+  412, 0, 285, 338, 0, 0, 0, 0, 288, 0, 157, 0,
+  0, 399, 0, 0, 313, 269, 313, 181, 32, 0, 463, 0,
+  208, 0, 0, 4, 269, 0, 680, 0, 387, 4, 0, 668,
+  673, 0, 313, 0, 940, 32, 313, 208, 940, 1222, 313, 313,
+  0, 32, 0, 0, 0, 940, 208, 0, 0, 313, 313, 288,
+  0, 471, 1, 1, 0, 0, 288, 0, 288, 854, 280, 0,
+  0, 288, 157, 0, 29, 0, 288, 0, 0, 288, 288, 291,
+  144, 288, 685, 285, 0, 841, 0, 0, 0, 695, 0, 0,
+  0, 865, 0, 606, 412, 280, 0, 288, 0, 0, 338, 690,
+  0, 0, 181, 0, 313, 0, 208, 208, 0, 0, 29, 0,
+  157, 288, 1036, 0, 0, 0, 269, 264, 0, 0, 29, 272,
+  269, 208, 0, 81, 937, 181, 0, 387, 313, 29, 285, 321,
+  285, 0, 285, 285, 285, 0, 285, 285, 313, 285, 285, 29,
+  285, 285, 29, 702, 451, 4, 285, 285, 0, 285, 375, 0,
+  0, 208, 32, 296, 29, 0, 157, 181, 831, 4, 272, 208,
+  1149, 296, 0, 0, 711, 601, 288, 0, 471, 316, 291, 288,
+  272, 4, 0, 0, 4, 181, 399, 338, 0, 427, 387, 0,
+  288, 181, 4, 0, 269, 0, 471, 0, 343, 338, 32, 387,
+  463, 333, 0, 338, 288, 338, 387, 29, 0, 0, 288, 399,
+  399, 313, 29, 841, 399, 32, 269, 0, 208, 288, 291, 0,
+  338, 338, 285, 291, 0, 399, 0, 288, 313, 0, 291, 0,
+  0, 0, 288, 181, 0, 208, 0, 0, 285, 0, 181, 0,
+  4, 0, 0, 0, 0, 288, 0, 288, 4, 288, 288, 93,
+  0, 0, 0, 0, 0, 0, 285, 0, 4, 0, 0, 0,
+  288, 0, 0, 29, 0, 288, 181, 0, 0, 0, 0, 313,
+  343, 285, 288, 208, 534, 285, 0, 0, 296, 208, 285, 321,
+  673, 321, 296, 285, 0, 568, 285, 308, 0, 285, 0, 208,
+  29, 0, 0, 399, 0, 208, 285, 269, 0, 288, 285, 32,
+  0, 0, 288, 181, 338, 285, 0, 0, 0, 0, 288, 288,
+  0, 0, 288, 0, 0, 288, 288, 288, 157, 0, 288, 0,
+  0, 1, 412, 157, 0, 288, 0, 288, 288, 563, 288, 0,
+  288, 288, 0, 288, 288, 0, 0, 728, 208, 288, 285, 0,
+  288, 313, 0, 0, 4, 0, 280, 288, 753, 854, 0, 0,
+  285, 0, 0, 285, 285, 937, 0, 0, 32, 0, 42, 19,
+  29, 0, 1, 291, 0, 0, 0, 29, 733, 313, 0, 4,
+  0, 0, 0, 0, 0, 32, 0, 285, 313, 285, 857, 0,
+  0, 0, 0, 29, 743, 738, 14, 0, 144, 887, 208, 0,
+  32, 288, 0, 208, 0, 857, 0, 29, 4, 0, 29, 0,
+  0, 0, 29, 0, 29, 870, 0, 313, 152, 1000, 0, 29,
+  0, 0, 288, 288, 308, 288, 285, 288, 285, 0, 313, 0,
+  208, 0, 0, 0, 0, 29, 0, 387, 0, 288, 0, 313,
+  1, 313, 32, 29, 288, 285, 0, 854, 4, 0, 422, 0,
+  245, 333, 285, 0, 4, 29, 0, 0, 0, 285, 387, 81,
+  0, 937, 0, 4, 285, 1115, 0, 32, 0, 32, 0, 887,
+  32, 0, 0, 0, 0, 208, 0, 29, 0, 32, 29, 29,
+  841, 285, 4, 0, 0, 19, 4, 29, 937, 0, 29, 0,
+  0, 29, 0, 427, 0, 285, 14, 387, 0, 1, 937, 157,
+  0, 0, 0, 157, 0, 157, 0, 285, 0, 0, 0, 0,
+  264, 0, 144, 181, 0, 0, 0, 0, 29, 0, 139, 98,
+  4, 0, 0, 0, 81, 0, 0, 29, 32, 0, 4, 471,
+  264, 269, 0, 14, 0, 32, 291, 0, 32, 399, 144, 29,
+  181, 29, 29, 288, 291, 32, 181, 32, 0, 32, 0, 0,
+  0, 0, 285, 451, 4, 4, 0, 144, 0, 0, 0, 0,
+  0, 0, 208, 285, 0, 0, 0, 0, 0, 1, 42, 0,
+  0, 1, 0, 272, 0, 758, 0, 272, 272, 0, 0, 181,
+  272, 272, 285, 29, 0, 0, 0, 272, 0, 264, 0, 157,
+  313, 0, 0, 272, 0, 208, 181, 0, 0, 0, 4, 285,
+  0, 4, 0, 0, 29, 19, 272, 181, 272, 275, 0, 272,
+  32, 29, 285, 288, 228, 0, 288, 0, 382, 0, 152, 0,
+  181, 157, 181, 0, 157, 32, 0, 0, 313, 32, 0, 285,
+  181, 0, 285, 0, 157, 0, 0, 0, 157, 0, 0, 333,
+  264, 0, 285, 0, 181, 208, 144, 0, 288, 285, 0, 288,
+  285, 285, 0, 291, 0, 285, 0, 0, 285, 29, 0, 4,
+  0, 291, 181, 288, 0, 0, 29, 0, 0, 0, 0, 789,
+  144, 0, 32, 285, 4, 32, 29, 0, 0, 157, 0, 0,
+  0, 291, 0, 0, 291, 841, 0, 29, 0, 98, 0, 399,
+  313, 313, 0, 0, 29, 0, 291, 841, 144, 857, 285, 854,
+  144, 0, 288, 157, 291, 1, 0, 208, 203, 0, 0, 0,
+  208, 0, 0, 32, 0, 0, 0, 144, 0, 147, 144, 291,
+  0, 264, 0, 157, 831, 0, 157, 152, 0, 208, 157, 0,
+  0, 0, 0, 0, 152, 19, 19, 157, 42, 157, 157, 157,
+  0, 0, 4, 0, 0, 0, 181, 0, 285, 98, 285, 29,
+  471, 0, 1118, 181, 0, 285, 0, 0, 208, 181, 272, 0,
+  0, 157, 208, 0, 272, 272, 4, 32, 0, 272, 0, 0,
+  144, 4, 208, 0, 272, 4, 0, 0, 509, 93, 0, 272,
+  272, 0, 841, 0, 0, 288, 0, 288, 0, 841, 0, 0,
+  272, 0, 272, 4, 854, 280, 0, 29, 0, 897, 0, 0,
+  0, 887, 865, 32, 768, 0, 0, 0, 208, 272, 4, 343,
+  181, 296, 272, 0, 780, 0, 0, 841, 0, 285, 4, 0,
+  208, 1, 285, 399, 296, 157, 269, 181, 288, 29, 0, 181,
+  0, 285, 841, 841, 313, 134, 0, 0, 0, 1, 0, 29,
+  157, 0, 0, 1, 129, 0, 0, 0, 0, 147, 288, 147,
+  0, 1, 0, 152, 208, 0, 285, 575, 181, 0, 29, 29,
+  1, 0, 471, 14, 0, 81, 0, 399, 4, 181, 0, 316,
+  181, 93, 29, 288, 0, 0, 157, 0, 129, 841, 0, 98,
+  29, 0, 0, 139, 157, 181, 0, 841, 4, 0, 427, 0,
+  892, 387, 29, 0, 208, 139, 0, 0, 0, 0, 841, 0,
+  0, 0, 181, 0, 471, 1, 471, 387, 291, 0, 399, 854,
+  313, 280, 291, 471, 81, 42, 0, 32, 32, 291, 208, 0,
+  288, 285, 0, 1, 0, 147, 0, 0, 0, 0, 4, 19,
+  0, 0, 0, 0, 291, 0, 0, 0, 0, 0, 98, 0,
+  640, 0, 0, 0, 841, 0, 1275, 471, 316, 0, 29, 0,
+  0, 316, 29, 29, 0, 0, 0, 0, 181, 0, 291, 0,
+  0, 971, 32, 0, 291, 19, 0, 0, 0, 0, 0, 4,
+  0, 937, 471, 0, 29, 291, 157, 42, 288, 42, 0, 264,
+  0, 0, 181, 0, 157, 181, 0, 0, 181, 0, 0, 0,
+  264, 152, 0, 0, 0, 841, 0, 181, 0, 471, 291, 0,
+  291, 291, 471, 1270, 291, 937, 0, 0, 0, 0, 0, 471,
+  208, 0, 0, 0, 0, 14, 937, 291, 181, 0, 0, 0,
+  285, 937, 0, 291, 129, 0, 4, 181, 1, 0, 129, 0,
+  280, 870, 285, 0, 32, 296, 285, 0, 285, 0, 208, 296,
+  0, 285, 285, 285, 32, 285, 1, 32, 0, 208, 29, 4,
+  887, 0, 1263, 0, 285, 98, 0, 0, 285, 0, 316, 4,
+  0, 0, 0, 32, 285, 841, 4, 152, 0, 343, 810, 0,
+  841, 348, 1287, 0, 841, 1118, 0, 208, 0, 887, 0, 285,
+  0, 758, 0, 288, 4, 288, 285, 160, 0, 1, 285, 285,
+  0, 0, 313, 0, 29, 0, 285, 0, 0, 0, 208, 32,
+  0, 0, 285, 285, 0, 29, 32, 29, 272, 313, 0, 29,
+  208, 1, 0, 285, 1, 157, 0, 275, 272, 291, 129, 32,
+  29, 285, 285, 275, 0, 0, 4, 375, 0, 0, 0, 1046,
+  288, 147, 0, 360, 272, 0, 0, 0, 0, 0, 0, 0,
+  0, 288, 0, 181, 181, 0, 313, 181, 0, 272, 0, 0,
+  0, 181, 0, 152, 0, 1, 0, 0, 0, 0, 0, 0,
+  29, 0, 887, 288, 0, 147, 0, 4, 14, 0, 0, 42,
+  0, 0, 208, 0, 129, 4, 4, 157, 0, 0, 29, 208,
+  157, 841, 0, 0, 0, 152, 0, 4, 14, 32, 887, 0,
+  32, 203, 14, 0, 0, 0, 0, 147, 29, 208, 0, 1,
+  152, 32, 1, 1, 0, 144, 0, 0, 0, 269, 29, 0,
+  0, 288, 841, 285, 824, 208, 14, 181, 4, 0, 0, 29,
+  0, 152, 0, 0, 181, 272, 0, 29, 264, 129, 157, 0,
+  157, 0, 42, 152, 152, 844, 208, 264, 844, 208, 1, 152,
+  0, 0, 0, 29, 264, 849, 865, 0, 0, 0, 0, 841,
+  854, 836, 208, 152, 841, 29, 157, 841, 841, 208, 208, 0,
+  157, 952, 841, 280, 98, 208, 1, 841, 0, 382, 272, 841,
+  865, 870, 887, 4, 285, 157, 892, 157, 272, 285, 865, 892,
+  0, 313, 272, 841, 897, 0, 285, 285, 0, 0, 157, 841,
+  29, 854, 285, 285, 14, 269, 29, 181, 0, 29, 157, 157,
+  0, 291, 288, 857, 285, 902, 14, 841, 291, 157, 0, 288,
+  0, 945, 0, 375, 1217, 269, 0, 841, 887, 288, 0, 841,
+  940, 0, 0, 288, 399, 841, 841, 144, 29, 841, 841, 129,
+  0, 937, 288, 29, 841, 841, 288, 0, 29, 29, 887, 32,
+  0, 0, 841, 937, 0, 854, 32, 0, 387, 0, 29, 0,
+  4, 0, 32, 0, 0, 4, 0, 0, 0, 0, 844, 0,
+  32, 32, 14, 0, 338, 0, 269, 291, 0, 157, 291, 0,
+  19, 854, 4, 285, 0, 854, 285, 291, 0, 0, 0, 0,
+  0, 841, 870, 959, 0, 285, 0, 0, 1, 288, 0, 841,
+  208, 0, 0, 841, 841, 870, 264, 4, 887, 32, 129, 157,
+  208, 0, 937, 81, 0, 285, 0, 0, 29, 841, 32, 288,
+  29, 208, 0, 854, 29, 857, 0, 0, 387, 937, 22, 937,
+  0, 181, 0, 208, 208, 387, 0, 0, 29, 208, 875, 29,
+  458, 0, 285, 129, 29, 208, 14, 313, 841, 208, 841, 157,
+  854, 0, 0, 29, 14, 32, 0, 940, 0, 0, 841, 0,
+  291, 854, 29, 966, 0, 0, 854, 854, 0, 387, 208, 288,
+  387, 841, 0, 0, 4, 976, 208, 0, 854, 887, 841, 144,
+  0, 0, 0, 157, 0, 285, 0, 0, 841, 29, 387, 29,
+  0, 841, 0, 0, 0, 0, 0, 14, 857, 841, 0, 0,
+  14, 1, 4, 157, 0, 29, 144, 1, 0, 42, 157, 0,
+  29, 152, 0, 841, 1300, 0, 29, 985, 0, 4, 841, 0,
+  382, 0, 841, 0, 157, 0, 32, 841, 841, 841, 0, 98,
+  0, 0, 288, 865, 1, 841, 841, 208, 291, 940, 841, 0,
+  0, 0, 144, 0, 208, 285, 0, 0, 854, 399, 0, 412,
+  272, 841, 0, 399, 937, 841, 0, 841, 0, 937, 841, 841,
+  0, 0, 841, 937, 841, 387, 280, 285, 29, 841, 841, 841,
+  313, 841, 841, 129, 841, 208, 29, 0, 0, 144, 29, 288,
+  208, 29, 0, 152, 0, 0, 0, 841, 841, 937, 0, 280,
+  0, 841, 0, 841, 854, 841, 288, 836, 291, 0, 841, 348,
+  272, 966, 995, 945, 841, 285, 417, 29, 208, 181, 0, 0,
+  0, 0, 272, 0, 0, 854, 0, 841, 29, 285, 0, 285,
+  0, 157, 0, 108, 0, 208, 0, 208, 0, 0, 288, 144,
+  0, 29, 144, 857, 288, 854, 81, 0, 32, 313, 29, 288,
+  29, 0, 288, 157, 181, 0, 471, 841, 285, 98, 0, 841,
+  0, 288, 387, 0, 841, 0, 387, 0, 841, 29, 32, 0,
+  841, 29, 382, 157, 841, 29, 0, 937, 841, 208, 14, 14,
+  14, 208, 338, 208, 0, 32, 29, 280, 288, 29, 144, 509,
+  509, 29, 32, 81, 29, 32, 0, 0, 4, 208, 0, 313,
+  313, 313, 0, 333, 1012, 0, 0, 288, 4, 208, 0, 0,
+  387, 42, 0, 29, 144, 269, 208, 0, 1012, 313, 0, 29,
+  208, 208, 887, 1017, 0, 4, 272, 0, 887, 4, 208, 285,
+  264, 272, 0, 0, 0, 0, 14, 1022, 887, 937, 887, 0,
+  157, 288, 288, 0, 0, 985, 854, 0, 0, 291, 285, 288,
+  29, 4, 0, 0, 288, 0, 0, 0, 0, 0, 29, 288,
+  285, 382, 0, 854, 288, 29, 208, 285, 29, 208, 0, 0,
+  0, 0, 29, 0, 0, 0, 0, 42, 854, 4, 0, 0,
+  264, 0, 387, 937, 841, 139, 0, 940, 0, 264, 0, 387,
+  29, 181, 0, 4, 288, 4, 313, 0, 1, 152, 0, 0,
+  927, 29, 0, 152, 1189, 98, 285, 208, 285, 387, 0, 0,
+  313, 841, 937, 0, 937, 937, 291, 0, 0, 0, 937, 857,
+  0, 29, 0, 4, 937, 0, 0, 181, 841, 937, 841, 4,
+  937, 841, 4, 841, 857, 181, 841, 857, 887, 313, 269, 937,
+  841, 0, 0, 995, 857, 32, 4, 313, 0, 870, 387, 841,
+  272, 42, 0, 0, 0, 841, 841, 0, 4, 841, 285, 0,
+  1029, 1036, 0, 0, 841, 288, 4, 272, 223, 857, 42, 157,
+  157, 285, 0, 0, 152, 1041, 0, 0, 285, 264, 887, 288,
+  272, 841, 157, 157, 1, 0, 203, 0, 0, 0, 208, 264,
+  0, 0, 0, 0, 0, 0, 940, 0, 0, 0, 157, 14,
+  0, 387, 0, 0, 0, 14, 285, 0, 857, 208, 0, 0,
+  157, 0, 4, 157, 0, 1046, 841, 208, 285, 0, 0, 144,
+  857, 0, 0, 152, 288, 4, 4, 32, 181, 0, 157, 313,
+  42, 0, 0, 0, 0, 0, 427, 857, 0, 1123, 0, 399,
+  288, 0, 0, 313, 844, 854, 387, 0, 0, 4, 0, 0,
+  0, 0, 0, 29, 288, 0, 0, 0, 0, 0, 1, 29,
+  0, 0, 1041, 288, 857, 985, 0, 0, 288, 841, 0, 42,
+  0, 157, 285, 0, 841, 19, 285, 285, 0, 313, 288, 0,
+  32, 841, 857, 0, 285, 285, 0, 0, 313, 1, 296, 0,
+  940, 285, 29, 387, 1049, 285, 181, 668, 841, 4, 272, 0,
+  387, 0, 0, 0, 0, 0, 870, 841, 887, 144, 0, 940,
+  0, 940, 841, 0, 0, 0, 841, 0, 985, 0, 841, 940,
+  0, 313, 1263, 0, 0, 208, 857, 157, 0, 841, 841, 0,
+  4, 841, 288, 841, 0, 0, 296, 841, 1061, 0, 0, 14,
+  1068, 0, 0, 0, 857, 887, 288, 0, 0, 0, 0, 887,
+  0, 208, 0, 208, 288, 288, 264, 0, 0, 940, 937, 14,
+  841, 841, 0, 0, 0, 0, 0, 841, 129, 841, 0, 0,
+  0, 14, 841, 0, 1073, 0, 181, 841, 937, 841, 1085, 1085,
+  29, 0, 0, 1080, 81, 14, 32, 0, 841, 4, 841, 0,
+  841, 181, 551, 841, 937, 1068, 1090, 841, 0, 181, 0, 0,
+  4, 0, 0, 0, 0, 0, 285, 841, 0, 854, 870, 272,
+  841, 0, 758, 857, 841, 272, 841, 285, 291, 285, 0, 841,
+  0, 296, 0, 208, 0, 887, 0, 399, 4, 841, 280, 29,
+  0, 14, 995, 940, 0, 181, 4, 157, 272, 288, 32, 399,
+  857, 0, 288, 129, 29, 291, 288, 857, 887, 29, 32, 0,
+  4, 857, 272, 841, 152, 1137, 940, 208, 0, 313, 841, 291,
+  940, 0, 841, 870, 841, 854, 1130, 841, 285, 0, 1, 0,
+  208, 870, 0, 0, 0, 152, 181, 0, 0, 0, 0, 0,
+  0, 0, 887, 0, 147, 0, 0, 181, 285, 0, 0, 264,
+  0, 0, 181, 0, 887, 0, 0, 285, 0, 0, 0, 181,
+  0, 0, 0, 208, 29, 0, 0, 288, 32, 0, 0, 0,
+  32, 0, 0, 0, 208, 32, 313, 0, 0, 0, 0, 0,
+  42, 32, 0, 0, 313, 152, 4, 285, 1, 32, 288, 144,
+  157, 0, 0, 1144, 0, 285, 29, 1, 0, 399, 0, 0,
+  208, 29, 0, 0, 144, 4, 4, 0, 1, 14, 0, 181,
+  181, 0, 29, 4, 857, 0, 841, 22, 0, 887, 269, 288,
+  0, 887, 387, 887, 857, 887, 0, 887, 0, 841, 29, 841,
+  887, 841, 181, 129, 887, 940, 29, 887, 144, 0, 0, 857,
+  0, 0, 0, 0, 0, 0, 288, 865, 0, 841, 0, 139,
+  157, 223, 14, 887, 887, 285, 0, 887, 0, 19, 42, 285,
+  0, 0, 285, 985, 1107, 985, 841, 940, 841, 0, 524, 0,
+  157, 19, 940, 985, 0, 0, 313, 0, 854, 940, 0, 0,
+  0, 288, 940, 841, 985, 0, 313, 841, 0, 854, 844, 0,
+  844, 288, 844, 0, 0, 0, 0, 313, 4, 0, 940, 313,
+  985, 313, 1156, 313, 313, 857, 387, 4, 1196, 0, 313, 313,
+  1270, 0, 4, 841, 1270, 181, 0, 985, 940, 288, 288, 181,
+  285, 313, 0, 313, 0, 313, 0, 32, 288, 32, 288, 4,
+  288, 0, 940, 940, 940, 288, 471, 0, 29, 4, 291, 208,
+  32, 0, 841, 288, 181, 0, 0, 288, 836, 0, 0, 0,
+  269, 285, 291, 0, 285, 29, 280, 399, 157, 272, 0, 0,
+  181, 0, 0, 288, 0, 0, 887, 29, 288, 887, 0, 841,
+  1166, 841, 841, 0, 181, 285, 844, 841, 313, 0, 348, 285,
+  313, 841, 887, 0, 1175, 887, 887, 42, 0, 887, 0, 0,
+  0, 313, 0, 0, 0, 0, 841, 4, 841, 285, 4, 841,
+  887, 887, 940, 887, 42, 29, 4, 0, 0, 1182, 841, 887,
+  841, 841, 0, 269, 841, 313, 29, 0, 19, 29, 0, 0,
+  0, 0, 887, 841, 854, 841, 272, 387, 841, 157, 157, 157,
+  0, 0, 4, 157, 0, 0, 272, 841, 1, 0, 42, 144,
+  269, 0, 280, 0, 1, 29, 0, 285, 285, 181, 280, 14,
+  14, 285, 152, 0, 0, 14, 0, 291, 285, 288, 1297, 399,
+  157, 0, 0, 272, 272, 208, 471, 4, 29, 1118, 288, 157,
+  280, 841, 208, 32, 0, 32, 427, 0, 181, 0, 0, 0,
+  0, 0, 272, 208, 1, 841, 42, 0, 22, 144, 0, 1046,
+  0, 144, 0, 0, 0, 228, 181, 0, 841, 841, 0, 841,
+  841, 4, 285, 524, 0, 0, 399, 181, 841, 0, 288, 208,
+  0, 1203, 1, 0, 285, 0, 841, 841, 841, 841, 0, 841,
+  32, 264, 0, 264, 160, 0, 841, 208, 0, 0, 181, 1210,
+  0, 0, 0, 0, 0, 152, 0, 0, 0, 264, 285, 181,
+  152, 22, 296, 144, 0, 0, 0, 937, 313, 29, 181, 0,
+  144, 0, 4, 0, 0, 139, 0, 0, 4, 0, 0, 4,
+  0, 129, 0, 285, 0, 0, 1107, 0, 0, 288, 0, 0,
+  0, 42, 854, 0, 0, 0, 0, 152, 32, 0, 269, 841,
+  841, 291, 208, 81, 0, 841, 291, 32, 291, 4, 841, 0,
+  844, 288, 144, 4, 208, 285, 208, 0, 854, 841, 313, 937,
+  291, 865, 0, 208, 288, 0, 841, 181, 0, 0, 0, 313,
+  32, 0, 471, 32, 313, 32, 285, 0, 313, 288, 81, 0,
+  0, 32, 399, 0, 291, 0, 0, 0, 0, 471, 841, 0,
+  285, 288, 841, 285, 152, 291, 32, 841, 208, 4, 937, 865,
+  0, 0, 854, 129, 649, 1227, 940, 1, 313, 208, 854, 32,
+  208, 208, 32, 1090, 269, 387, 649, 0, 0, 32, 841, 0,
+  387, 0, 81, 152, 387, 0, 0, 1263, 4, 0, 208, 841,
+  129, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 291,
+  1085, 841, 29, 291, 98, 0, 841, 0, 0, 291, 288, 422,
+  0, 0, 144, 0, 0, 0, 387, 272, 387, 0, 288, 0,
+  0, 208, 4, 937, 288, 0, 0, 288, 285, 844, 0, 0,
+  4, 29, 223, 0, 0, 269, 285, 288, 4, 81, 285, 0,
+  407, 272, 288, 841, 4, 280, 291, 280, 29, 854, 285, 0,
+  0, 0, 14, 0, 208, 0, 296, 0, 291, 4, 471, 0,
+  844, 29, 0, 4, 285, 0, 0, 0, 937, 0, 937, 0,
+  0, 0, 285, 291, 0, 0, 937, 0, 272, 0, 0, 0,
+  272, 0, 272, 937, 272, 841, 937, 0, 272, 940, 0, 157,
+  272, 288, 272, 272, 865, 0, 841, 285, 1280, 841, 313, 285,
+  0, 4, 288, 288, 208, 0, 288, 937, 865, 0, 0, 32,
+  0, 4, 272, 272, 0, 285, 0, 1, 0, 272, 272, 272,
+  285, 0, 0, 0, 343, 272, 280, 0, 272, 4, 0, 937,
+  285, 285, 208, 1334, 937, 854, 0, 32, 0, 0, 29, 0,
+  0, 81, 269, 19, 0, 81, 940, 841, 854, 0, 841, 0,
+  841, 0, 0, 0, 0, 288, 844, 291, 844, 0, 0, 0,
+  0, 0, 685, 841, 0, 0, 288, 0, 0, 1292, 854, 0,
+  285, 288, 887, 0, 841, 288, 887, 272, 32, 0, 272, 743,
+  471, 272, 272, 285, 269, 1118, 272, 272, 940, 285, 81, 285,
+  680, 272, 841, 272, 0, 272, 32, 387, 272, 0, 14, 0,
+  285, 264, 0, 1107, 0, 208, 0, 0, 4, 0, 208, 0,
+  32, 0, 0, 0, 42, 0, 490, 0, 208, 857, 285, 285,
+  0, 208, 288, 471, 29, 288, 0, 280, 382, 29, 208, 0,
+  0, 0, 285, 288, 269, 0, 524, 0, 0, 4, 280, 32,
+  937, 0, 288, 0, 0, 338, 338, 29, 0, 0, 0, 0,
+  338, 0, 0, 32, 0, 144, 291, 348, 0, 208, 471, 285,
+  399, 313, 841, 0, 0, 1012, 0, 208, 841, 0, 4, 81,
+  288, 841, 291, 4, 269, 841, 841, 0, 157, 0, 0, 0,
+  29, 4, 29, 0, 0, 4, 29, 0, 0, 841, 387, 0,
+  0, 0, 42, 4, 144, 272, 940, 272, 841, 288, 269, 288,
+  841, 0, 0, 288, 887, 1237, 4, 208, 144, 4, 937, 0,
+  29, 1, 208, 296, 1232, 0, 291, 0, 129, 0, 288, 208,
+  288, 208, 181, 208, 288, 208, 129, 841, 836, 0, 288, 0,
+  0, 288, 208, 0, 0, 524, 29, 0, 0, 288, 208, 0,
+  1383, 937, 14, 1251, 841, 841, 0, 841, 841, 387, 0, 288,
+  29, 1242, 208, 841, 0, 208, 208, 870, 1251, 870, 0, 841,
+  841, 0, 0, 157, 0, 932, 288, 0, 1182, 841, 0, 854,
+  0, 272, 81, 841, 937, 0, 288, 313, 841, 399, 0, 1182,
+  1258, 0, 1, 288, 208, 288, 0, 32, 1, 0, 29, 940,
+  0, 288, 288, 157, 29, 940, 285, 32, 0, 272, 0, 285,
+  0, 42, 0, 0, 1, 181, 0, 471, 0, 29, 0, 288,
+  0, 0, 285, 471, 29, 0, 4, 291, 285, 0, 291, 0,
+  0, 14, 4, 29, 0, 42, 208, 0, 0, 285, 285, 29,
+  0, 29, 35, 157, 0, 129, 313, 313, 208, 288, 870, 1307,
+  0, 0, 29, 887, 181, 0, 208, 208, 285, 509, 291, 940,
+  0, 0, 313, 0, 4, 887, 0, 1156, 98, 1270, 937, 313,
+  343, 1270, 29, 288, 4, 0, 0, 4, 937, 313, 0, 844,
+  129, 0, 29, 0, 0, 857, 0, 841, 42, 29, 29, 0,
+  0, 4, 288, 4, 285, 0, 940, 285, 269, 865, 940, 285,
+  940, 1, 285, 269, 0, 841, 509, 412, 844, 841, 288, 0,
+  288, 288, 285, 841, 841, 291, 0, 343, 841, 288, 29, 208,
+  471, 940, 0, 0, 0, 181, 985, 940, 157, 4, 0, 841,
+  208, 937, 0, 668, 29, 208, 0, 313, 288, 0, 0, 937,
+  0, 32, 29, 269, 313, 0, 0, 0, 338, 32, 551, 42,
+  291, 81, 0, 288, 0, 854, 338, 4, 0, 32, 288, 0,
+  32, 0, 288, 0, 0, 0, 0, 0, 32, 387, 0, 181,
+  0, 0, 0, 157, 291, 208, 0, 417, 887, 42, 0, 1263,
+  29, 0, 208, 887, 285, 29, 841, 841, 841, 313, 841, 0,
+  129, 0, 0, 4, 4, 208, 272, 0, 0, 208, 887, 841,
+  0, 42, 841, 0, 0, 288, 29, 887, 0, 208, 0, 0,
+  296, 272, 841, 32, 152, 504, 841, 0, 288, 275, 0, 887,
+  841, 0, 157, 870, 272, 313, 841, 181, 157, 0, 208, 841,
+  208, 32, 272, 857, 285, 129, 841, 870, 285, 0, 4, 0,
+  387, 181, 0, 144, 887, 0, 387, 29, 1118, 208, 4, 0,
+  208, 29, 269, 152, 0, 887, 1, 0, 269, 887, 940, 208,
+  288, 0, 285, 0, 29, 0, 129, 841, 181, 857, 887, 887,
+  887, 913, 887, 144, 0, 0, 29, 4, 285, 0, 19, 0,
+  0, 157, 32, 29, 0, 32, 0, 0, 313, 208, 841, 285,
+  0, 0, 0, 0, 841, 0, 887, 264, 857, 152, 157, 313,
+  841, 208, 841, 0, 0, 857, 32, 1156, 940, 0, 0, 144,
+  4, 0, 0, 208, 0, 0, 0, 0, 32, 29, 343, 382,
+  0, 291, 387, 157, 0, 285, 0, 0, 857, 285, 0, 0,
+  288, 0, 208, 0, 841, 208, 887, 0, 841, 0, 81, 29,
+  0, 181, 399, 1, 157, 0, 14, 887, 887, 129, 841, 157,
+  0, 264, 0, 0, 0, 181, 1118, 887, 0, 129, 0, 887,
+  0, 0, 208, 19, 387, 887, 0, 313, 680, 269, 313, 0,
+  269, 0, 940, 857, 940, 288, 844, 288, 471, 940, 841, 0,
+  1319, 0, 269, 285, 288, 285, 0, 316, 844, 841, 285, 841,
+  288, 870, 285, 841, 0, 129, 0, 157, 285, 854, 285, 854,
+  285, 14, 870, 387, 841, 870, 285, 285, 285, 29, 272, 285,
+  29, 272, 404, 29, 285, 288, 285, 269, 313, 285, 0, 285,
+  841, 285, 940, 0, 288, 940, 288, 19, 0, 0, 0, 208,
+  1085, 0, 1156, 0, 313, 940, 0, 422, 940, 0, 0, 0,
+  0, 288, 0, 313, 0, 208, 4, 129, 313, 0, 288, 940,
+  288, 4, 313, 841, 382, 0, 841, 285, 0, 0, 0, 841,
+  313, 0, 0, 940, 208, 42, 0, 0, 940, 288, 0, 313,
+  285, 940, 0, 157, 985, 937, 4, 857, 940, 649, 0, 422,
+  313, 387, 288, 857, 208, 157, 649, 288, 29, 0, 0, 269,
+  313, 387, 0, 288, 0, 4, 0, 208, 0, 144, 399, 0,
+  0, 338, 0, 0, 0, 181, 4, 0, 288, 288, 4, 288,
+  208, 29, 4, 0, 4, 887, 0, 841, 1263, 272, 940, 296,
+  272, 208, 269, 288, 841, 841, 4, 841, 1314, 0, 0, 208,
+  208, 841, 0, 291, 81, 272, 0, 181, 0, 32, 4, 208,
+  854, 29, 32, 0, 0, 285, 841, 841, 4, 285, 0, 427,
+  0, 288, 841, 0, 0, 841, 129, 841, 841, 14, 0, 841,
+  0, 280, 841, 19, 285, 157, 0, 841, 264, 0, 288, 0,
+  685, 0, 0, 0, 0, 0, 0, 29, 0, 57, 285, 0,
+  0, 0, 0, 0, 841, 157, 208, 0, 509, 313, 1324, 1156,
+  272, 272, 272, 285, 841, 285, 857, 29, 29, 841, 854, 291,
+  0, 81, 0, 0, 0, 285, 272, 427, 208, 382, 272, 0,
+  0, 854, 208, 285, 152, 208, 4, 841, 0, 0, 0, 157,
+  387, 288, 0, 0, 0, 272, 32, 0, 0, 32, 0, 0,
+  139, 285, 0, 181, 29, 152, 285, 0, 0, 285, 0, 841,
+  0, 0, 14, 285, 208, 269, 4, 0, 4, 42, 0, 313,
+  387, 0, 0, 0, 0, 0, 272, 0, 272, 1005, 152, 0,
+  181, 208, 152, 208, 0, 1012, 0, 152, 0, 208, 29, 288,
+  1263, 0, 19, 4, 208, 0, 382, 4, 937, 0, 272, 272,
+  0, 288, 157, 288, 272, 288, 264, 387, 4, 29, 0, 0,
+  0, 285, 285, 0, 0, 29, 208, 288, 288, 285, 0, 288,
+  285, 0, 288, 285, 1329, 0, 288, 551, 264, 288, 288, 0,
+  0, 288, 288, 203, 343, 157, 42, 0, 0, 29, 0, 4,
+  288, 291, 1346, 288, 0, 0, 42, 0, 157, 288, 288, 316,
+  280, 841, 313, 0, 0, 0, 285, 285, 551, 208, 0, 291,
+  288, 144, 285, 285, 285, 22, 208, 854, 1339, 0, 0, 181,
+  32, 0, 29, 285, 129, 0, 14, 14, 22, 144, 129, 0,
+  857, 29, 264, 0, 14, 0, 157, 181, 854, 208, 0, 29,
+  42, 854, 157, 854, 854, 887, 0, 854, 841, 857, 32, 291,
+  181, 1036, 841, 854, 887, 0, 280, 144, 0, 854, 223, 0,
+  181, 4, 387, 208, 223, 0, 81, 504, 272, 144, 0, 285,
+  288, 0, 288, 208, 32, 0, 0, 288, 0, 144, 1156, 0,
+  288, 313, 0, 711, 269, 291, 285, 288, 288, 98, 288, 4,
+  575, 0, 313, 0, 0, 0, 269, 0, 940, 288, 144, 0,
+  0, 157, 157, 4, 0, 0, 0, 29, 32, 181, 181, 29,
+  0, 471, 0, 208, 29, 0, 0, 29, 208, 0, 0, 285,
+  208, 0, 0, 29, 291, 0, 0, 280, 29, 4, 887, 208,
+  0, 0, 29, 0, 0, 0, 0, 0, 841, 272, 0, 0,
+  0, 0, 285, 0, 285, 296, 42, 285, 208, 0, 291, 272,
+  0, 0, 272, 288, 343, 0, 529, 29, 288, 841, 0, 0,
+  0, 422, 343, 0, 285, 32, 343, 534, 348, 285, 1, 285,
+  313, 208, 272, 0, 81, 471, 0, 0, 763, 0, 0, 387,
+  0, 0, 269, 0, 208, 269, 288, 0, 0, 288, 291, 29,
+  291, 0, 19, 841, 291, 0, 181, 0, 32, 0, 0, 0,
+  0, 0, 0, 157, 32, 14, 108, 14, 29, 0, 181, 208,
+  0, 29, 0, 19, 129, 181, 1263, 152, 29, 291, 76, 272,
+  264, 29, 0, 285, 841, 181, 0, 272, 288, 29, 0, 272,
+  29, 0, 29, 4, 208, 285, 841, 0, 35, 269, 29, 129,
+  387, 4, 98, 157, 42, 269, 887, 0, 288, 1355, 1364, 288,
+  1364, 0, 288, 288, 0, 0, 288, 288, 1378, 288, 288, 0,
+  157, 887, 288, 288, 1364, 160, 288, 288, 4, 0, 1371, 407,
+  0, 288, 887, 29, 129, 841, 313, 288, 0, 524, 0, 831,
+  0, 940, 288, 288, 0, 841, 288, 937, 288, 288, 0, 1,
+  285, 0, 157, 272, 272, 32, 288, 272, 29, 399, 1, 463,
+  157, 272, 0, 844, 321, 0, 0, 272, 81, 1, 144, 887,
+  285, 129, 288, 32, 937, 1, 29, 0, 4, 887, 857, 841,
+  0, 0, 0, 0, 854, 288, 0, 0, 264, 0, 157, 4,
+  32, 269, 129, 0, 854, 0, 326, 0, 1, 264, 285, 42,
+  0, 147, 0, 0, 1, 758, 208, 1068, 0, 0, 288, 288,
+  308, 181, 288, 285, 288, 563, 288, 0, 288, 288, 0, 288,
+  288, 399, 288, 42, 288, 4, 0, 208, 288, 288, 0, 14,
+  288, 98, 0, 152, 0, 288, 0, 285, 42, 42, 42, 404,
+  0, 181, 29, 288, 272, 32, 0, 29, 0, 0, 0, 0,
+  0, 285, 940, 285, 152, 29, 1, 223, 0, 157, 0, 0,
+  139, 0, 0, 0, 0, 0, 0, 29, 0, 0, 152, 0,
+  0, 272, 0, 0, 223, 1, 0, 0, 0, 0, 32, 0,
+  152, 0, 0, 208, 0, 0, 29, 0, 509, 0, 0, 836,
+  1, 0, 0, 144, 264, 387, 208, 0, 0, 269, 0, 0,
+  382, 285, 0, 32, 1, 0, 0, 841, 4, 208, 0, 471,
+  0, 291, 29, 285, 4, 291, 288, 285, 0, 0, 291, 0,
+  0, 551, 1, 427, 285, 291, 841, 0, 841, 0, 29, 725,
+  208, 291, 0, 0, 0, 269, 181, 81, 0, 0, 208, 291,
+  1, 0, 0, 29, 32, 0, 0, 208, 285, 0, 0, 0,
+  0, 32, 291, 42, 32, 29, 0, 29, 291, 1263, 4, 181,
+  0, 157, 181, 29, 157, 291, 288, 29, 288, 0, 940, 32,
+  0, 0, 0, 144, 0, 285, 387, 0, 285, 285, 0, 887,
+  29, 288, 181, 29, 0, 0, 0, 129, 29, 285, 208, 81,
+  32, 338, 841, 181, 1005, 291, 291, 208, 0, 32, 29, 4,
+  129, 841, 0, 841, 0, 280, 208, 0, 841, 0, 208, 0,
+  0, 208, 0, 841, 181, 0, 0, 32, 29, 841, 841, 0,
+  81, 0, 288, 0, 0, 29, 0, 208, 387, 0, 29, 0,
+  32, 288, 0, 0, 0, 29, 32, 854, 0, 4, 857, 0,
+  19, 412, 32, 1, 685, 291, 29, 841, 0, 0, 0, 208,
+  0, 0, 841, 412, 4, 4, 841, 387, 144, 4, 291, 4,
+  1073, 157, 471, 0, 0, 291, 0, 291, 32, 387, 208, 4,
+  291, 0, 288, 0, 144, 291, 152, 0, 0, 288, 288, 841,
+  288, 288, 0, 4, 288, 0, 81, 32, 208, 539, 0, 0,
+  0, 0, 288, 285, 4, 288, 288, 0, 291, 4, 29, 208,
+  1, 288, 280, 0, 0, 854, 144, 0, 725, 29, 0, 0,
+  4, 272, 29, 208, 4, 22, 288, 285, 387, 157, 0, 0,
+  208, 1, 857, 0, 0, 0, 316, 0, 0, 29, 427, 0,
+  291, 841, 0, 0, 29, 399, 865, 857, 1388, 32, 285, 0,
+  0, 32, 870, 269, 0, 0, 0, 0, 0, 144, 288, 0,
+  857, 1383, 0, 32, 208, 32, 0, 81, 32, 4, 0, 854,
+  0, 0, 288, 32, 291, 0, 280, 841, 0, 4, 32, 0,
+  42, 0, 0, 0, 272, 509, 285, 291, 29, 509, 285, 937,
+  343, 0, 32, 509, 245, 181, 291, 0, 0, 0, 0, 42,
+  0, 288, 157, 0, 81, 0, 32, 29, 0, 0, 285, 0,
+  0, 313, 291, 4, 0, 32, 42, 0, 0, 291, 269, 841,
+  291, 29, 0, 157, 285, 14, 291, 0, 789, 399, 0, 32,
+  139, 0, 64, 208, 29, 285, 42, 0, 0, 144, 129, 152,
+  157, 22, 887, 29, 841, 0, 841, 841, 841, 0, 29, 4,
+  181, 841, 841, 1395, 0, 181, 940, 887, 887, 19, 870, 841,
+  887, 427, 841, 0, 19, 1395, 157, 0, 857, 841, 4, 144,
+  291, 870, 0, 129, 857, 0, 144, 288, 269, 208, 0, 29,
+  0, 841, 0, 264, 4, 841, 0, 29, 0, 0, 42, 841,
+  144, 0, 0, 0, 387, 29, 887, 0, 208, 857, 854, 269,
+  860, 0, 139, 288, 1402, 288, 857, 857, 0, 841, 285, 0,
+  29, 285, 857, 387, 0, 285, 854, 887, 0, 887, 0, 0,
+  887, 285, 0, 181, 887, 285, 32, 0, 181, 0, 29, 887,
+  313, 0, 0, 0, 365, 181, 29, 264, 29, 42, 0, 0,
+  1431, 0, 285, 1, 0, 0, 42, 0, 22, 0, 14, 0,
+  0, 313, 0, 841, 0, 29, 841, 285, 0, 0, 0, 0,
+  29, 870, 854, 29, 152, 29, 0, 0, 313, 285, 29, 285,
+  32, 0, 285, 841, 0, 0, 463, 32, 0, 0, 0, 285,
+  285, 0, 272, 0, 0, 0, 0, 0, 857, 0, 0, 0,
+  0, 181, 887, 0, 841, 285, 14, 98, 0, 940, 285, 1407,
+  844, 841, 0, 157, 887, 57, 1156, 288, 841, 0, 29, 0,
+  841, 0, 0, 285, 841, 841, 940, 857, 841, 940, 870, 285,
+  940, 285, 285, 285, 0, 0, 316, 269, 841, 285, 285, 940,
+  285, 985, 0, 288, 0, 0, 285, 0, 313, 4, 1, 42,
+  285, 333, 4, 29, 4, 841, 313, 264, 0, 29, 841, 0,
+  841, 0, 1156, 1068, 0, 1118, 841, 387, 0, 887, 0, 0,
+  0, 887, 1395, 208, 208, 892, 0, 157, 0, 887, 0, 29,
+  841, 269, 152, 0, 940, 208, 296, 0, 940, 291, 1156, 0,
+  313, 940, 0, 399, 940, 854, 0, 0, 0, 0, 0, 313,
+  288, 0, 313, 841, 940, 288, 0, 32, 288, 42, 0, 313,
+  841, 29, 181, 844, 313, 841, 313, 32, 0, 313, 313, 313,
+  387, 288, 4, 841, 288, 0, 471, 291, 181, 4, 32, 0,
+  285, 32, 288, 0, 387, 285, 0, 285, 285, 0, 32, 4,
+  0, 0, 471, 4, 285, 0, 0, 29, 1, 387, 0, 0,
+  291, 181, 0, 841, 285, 0, 1297, 0, 288, 32, 32, 0,
+  387, 0, 471, 0, 0, 291, 551, 0, 343, 208, 0, 0,
+  0, 208, 0, 412, 285, 0, 0, 0, 208, 144, 269, 29,
+  0, 412, 0, 0, 288, 0, 208, 463, 0, 208, 387, 937,
+  1, 0, 387, 0, 0, 269, 343, 181, 0, 854, 887, 81,
+  208, 0, 348, 0, 29, 0, 0, 0, 42, 0, 157, 0,
+  0, 0, 0, 285, 0, 0, 887, 0, 1414, 841, 29, 412,
+  841, 0, 0, 887, 870, 387, 841, 841, 841, 0, 854, 854,
+  841, 0, 887, 0, 1419, 285, 841, 1041, 0, 0, 0, 841,
+  291, 0, 0, 841, 887, 0, 841, 841, 0, 269, 29, 285,
+  387, 841, 0, 887, 841, 0, 0, 854, 854, 1263, 0, 0,
+  870, 399, 0, 1, 157, 264, 29, 14, 269, 0, 157, 0,
+  0, 854, 14, 0, 285, 940, 157, 181, 139, 42, 29, 0,
+  0, 285, 223, 857, 0, 841, 0, 285, 0, 841, 157, 887,
+  0, 29, 887, 0, 870, 0, 841, 0, 0, 0, 0, 4,
+  841, 857, 887, 272, 887, 0, 0, 995, 0, 0, 0, 841,
+  0, 387, 0, 32, 0, 412, 841, 1426, 0, 42, 157, 0,
+  0, 0, 0, 887, 0, 0, 29, 144, 29, 285, 0, 1036,
+  857, 854, 0, 841, 285, 841, 0, 0, 841, 144, 4, 387,
+  29, 1426, 0, 932, 0, 275, 940, 841, 0, 4, 0, 208,
+  0, 4, 0, 291, 144, 1, 144, 0, 0, 0, 291, 0,
+  937, 0, 29, 269, 0, 208, 0, 0, 0, 285, 208, 29,
+  144, 0, 208, 288, 32, 144, 208, 387, 144, 399, 32, 0,
+  208, 208, 288, 0, 0, 269, 288, 288, 157, 0, 129, 157,
+  0, 0, 844, 157, 152, 399, 0, 412, 1, 129, 1046, 291,
+  57, 29, 285, 857, 285, 4, 291, 0, 32, 291, 291, 288,
+  789, 0, 1, 157, 4, 0, 288, 291, 0, 857, 0, 0,
+  0, 0, 0, 144, 4, 0, 0, 29, 0, 29, 0, 285,
+  98, 0, 0, 269, 285, 0, 0, 887, 857, 857, 285, 0,
+  152, 0, 0, 0, 29, 0, 181, 144, 285, 0, 887, 841,
+  269, 147, 841, 0, 348, 157, 841, 29, 313, 1, 0, 0,
+  0, 0, 841, 0, 857, 139, 147, 0, 208, 857, 0, 0,
+  1434, 0, 0, 0, 0, 0, 387, 285, 291, 857, 0, 463,
+  0, 0, 272, 0, 0, 887, 181, 157, 0, 0, 285, 29,
+  285, 0, 0, 288, 0, 0, 0, 313, 0, 887, 32, 291,
+  269, 29, 14, 382, 19, 269, 208, 387, 4, 0, 789, 0,
+  887, 98, 471, 1112, 857, 0, 854, 4, 841, 854, 1441, 857,
+  19, 0, 0, 285, 887, 0, 0, 4, 32, 0, 0, 857,
+  870, 0, 841, 32, 333, 0, 0, 4, 32, 0, 1263, 0,
+  0, 4, 4, 0, 1483, 0, 0, 887, 0, 887, 0, 887,
+  0, 0, 0, 0, 0, 42, 0, 181, 0, 887, 208, 887,
+  208, 857, 387, 841, 0, 4, 0, 0, 399, 1227, 288, 0,
+  0, 887, 0, 0, 0, 29, 0, 0, 42, 857, 29, 32,
+  32, 291, 0, 288, 0, 29, 0, 0, 0, 0, 0, 288,
+  4, 0, 291, 32, 288, 0, 157, 285, 0, 14, 0, 343,
+  288, 208, 0, 29, 348, 0, 291, 32, 0, 0, 291, 887,
+  288, 0, 841, 471, 0, 0, 0, 291, 0, 285, 0, 857,
+  285, 857, 471, 0, 0, 471, 157, 181, 0, 841, 841, 296,
+  0, 857, 887, 887, 0, 285, 1448, 144, 208, 29, 854, 857,
+  0, 1080, 14, 854, 0, 0, 4, 995, 0, 29, 0, 387,
+  288, 471, 0, 887, 841, 0, 144, 471, 1263, 29, 0, 285,
+  181, 0, 0, 0, 0, 0, 181, 181, 280, 0, 0, 32,
+  4, 4, 313, 29, 285, 0, 0, 0, 0, 29, 288, 0,
+  0, 285, 0, 288, 32, 0, 42, 0, 29, 291, 4, 0,
+  32, 0, 0, 291, 4, 0, 0, 0, 291, 32, 0, 288,
+  343, 0, 0, 29, 0, 0, 427, 0, 0, 0, 0, 0,
+  887, 841, 382, 0, 157, 208, 4, 0, 14, 0, 208, 404,
+  0, 0, 269, 0, 129, 387, 208, 157, 0, 0, 29, 857,
+  0, 129, 0, 139, 29, 0, 0, 0, 857, 841, 42, 841,
+  841, 887, 333, 280, 841, 841, 857, 0, 269, 285, 857, 841,
+  887, 857, 208, 887, 887, 291, 181, 841, 887, 0, 285, 887,
+  32, 1, 0, 291, 32, 29, 29, 291, 841, 887, 841, 272,
+  29, 841, 285, 129, 291, 272, 144, 0, 285, 0, 841, 841,
+  0, 841, 937, 841, 32, 841, 0, 841, 139, 0, 285, 940,
+  841, 0, 4, 0, 841, 0, 841, 0, 157, 29, 285, 0,
+  841, 841, 29, 887, 32, 285, 29, 181, 1457, 1466, 157, 4,
+  285, 208, 382, 0, 0, 887, 32, 0, 208, 285, 208, 0,
+  382, 887, 0, 387, 887, 280, 0, 0, 0, 208, 0, 181,
+  32, 272, 285, 1068, 887, 0, 157, 42, 857, 0, 841, 0,
+  264, 0, 0, 152, 285, 0, 841, 285, 841, 0, 1471, 0,
+  887, 887, 42, 0, 0, 98, 375, 841, 0, 29, 841, 0,
+  841, 0, 841, 887, 0, 152, 860, 387, 0, 285, 0, 887,
+  0, 1227, 0, 0, 854, 0, 0, 387, 0, 208, 0, 1476,
+  272, 4, 0, 0, 0, 857, 887, 1144, 0, 208, 1, 157,
+  0, 0, 29, 0, 181, 387, 152, 0, 0, 134, 181, 208,
+  387, 857, 181, 42, 0, 857, 0, 0, 0, 0, 264, 0,
+  0, 0, 0, 0, 0, 0, 264, 280, 0, 0, 0, 985,
+  32, 0, 0, 0, 0, 157, 0, 288, 0, 208, 0, 29,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0,
+  0, 0, 208, 144, 0, 387, 0, 0, 313, 841, 0, 1,
+  0, 0, 0, 857, 144, 0, 0, 1, 157, 0, 854, 0,
+  382, 272, 157, 718, 0, 0, 208, 0, 0, 29, 0, 0,
+  0, 0, 841, 208, 208, 857, 29, 291, 0, 387, 19, 208,
+  29, 0, 14, 208, 181, 32, 291, 129, 0, 4, 42, 157,
+  0, 0, 29, 844, 844, 29, 152, 0, 14, 157, 285, 854,
+  152, 854, 1046, 288, 157, 870, 0, 291, 291, 471, 0, 0,
+  0, 291, 0, 0, 0, 291, 4, 0, 272, 0, 0, 0,
+  870, 0, 4, 4, 291, 4, 0, 1118, 285, 285, 285, 0,
+  313, 316, 0, 32, 288, 285, 517, 32, 333, 29, 98, 0,
+  0, 29, 0, 29, 4, 0, 285, 0, 0, 29, 0, 333,
+  471, 285, 313, 412, 32, 0, 412, 42, 0, 399, 0, 208,
+  343, 32, 0, 4, 0, 291, 291, 288, 32, 285, 291, 0,
+  208, 208, 471, 4, 0, 29, 144, 0, 208, 14, 269, 857,
+  98, 29, 64, 0, 857, 208, 208, 0, 0, 0, 1118, 0,
+  0, 208, 0, 857, 14, 29, 296, 32, 0, 129, 29, 0,
+  181, 0, 857, 854, 288, 857, 854, 844, 129, 0, 0, 0,
+  854, 0, 29, 1490, 0, 129, 29, 844, 1118, 1118, 29, 32,
+  887, 4, 1434, 29, 269, 0, 854, 1118, 857, 296, 857, 0,
+  285, 854, 857, 29, 285, 348, 382, 285, 32, 313, 22, 0,
+  857, 285, 313, 42, 181, 0, 0, 32, 0, 0, 841, 0,
+  387, 0, 0, 857, 0, 152, 29, 0, 387, 399, 841, 0,
+  382, 870, 272, 144, 29, 0, 887, 940, 849, 844, 0, 407,
+  0, 844, 844, 854, 841, 0, 844, 844, 0, 870, 854, 844,
+  280, 841, 1497, 0, 0, 404, 841, 0, 0, 0, 0, 0,
+  0, 29, 412, 272, 0, 0, 208, 181, 29, 0, 857, 14,
+  181, 841, 285, 285, 147, 313, 157, 1041, 0, 285, 0, 285,
+  280, 285, 29, 887, 0, 285, 841, 387, 269, 1504, 0, 296,
+  0, 0, 269, 0, 887, 152, 854, 0, 291, 399, 29, 0,
+  208, 399, 29, 854, 291, 4, 19, 313, 343, 1511, 1, 29,
+  0, 288, 1107, 291, 129, 0, 0, 208, 288, 29, 0, 0,
+  288, 32, 0, 288, 285, 157, 285, 285, 1118, 0, 0, 0,
+  0, 157, 181, 272, 0, 1516, 0, 285, 1, 4, 844, 285,
+  98, 887, 857, 854, 854, 0, 0, 0, 0, 0, 0, 32,
+  0, 0, 4, 0, 157, 854, 0, 272, 0, 129, 0, 387,
+  0, 857, 285, 29, 1, 1441, 0, 1530, 264, 29, 841, 857,
+  0, 29, 42, 285, 0, 887, 857, 181, 0, 1144, 313, 1523,
+  285, 285, 0, 0, 285, 0, 285, 139, 285, 417, 0, 285,
+  0, 458, 940, 4, 181, 0, 0, 139, 285, 285, 857, 0,
+  0, 0, 0, 841, 0, 0, 29, 0, 0, 0, 181, 144,
+  0, 181, 313, 32, 0, 42, 0, 181, 272, 945, 272, 857,
+  285, 635, 0, 0, 0, 0, 19, 29, 29, 0, 42, 0,
+  285, 0, 285, 0, 887, 208, 208, 0, 0, 29, 1012, 19,
+  0, 0, 1054, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+  208, 0, 0, 0, 288, 471, 32, 285, 0, 285, 4, 313,
+  1263, 291, 0, 0, 4, 0, 0, 0, 0, 0, 208, 412,
+  471, 870, 338, 0, 412, 157, 29, 208, 0, 208, 285, 291,
+  22, 29, 29, 32, 0, 831, 0, 382, 32, 0, 0, 0,
+  29, 29, 940, 0, 291, 0, 0, 857, 857, 285, 870, 29,
+  841, 0, 841, 857, 841, 0, 0, 971, 129, 0, 264, 857,
+  870, 857, 1, 841, 844, 280, 844, 870, 0, 29, 0, 0,
+  14, 4, 0, 4, 288, 0, 857, 264, 0, 0, 0, 29,
+  42, 0, 264, 32, 14, 0, 291, 29, 0, 1, 0, 0,
+  285, 0, 29, 288, 841, 0, 0, 0, 4, 0, 0, 0,
+  0, 1476, 0, 338, 0, 0, 0, 0, 0, 0, 0, 29,
+  0, 4, 0, 291, 32, 0, 29, 0, 208, 0, 208, 0,
+  338, 0, 0, 32, 29, 857, 0, 0, 0, 0, 1, 0,
+  0, 288, 854, 387, 0, 0, 285, 0, 338, 208, 0, 0,
+  0, 285, 4, 285, 0, 0, 285, 29, 387, 509, 29, 4,
+  42, 291, 313, 387, 285, 272, 4, 288, 870, 269, 1, 0,
+  0, 42, 272, 32, 29, 857, 4, 841, 841, 0, 387, 870,
+  887, 857, 272, 836, 427, 870, 1046, 208, 269, 208, 404, 313,
+  857, 887, 0, 129, 29, 0, 0, 0, 4, 157, 0, 0,
+  860, 0, 1, 285, 0, 288, 0, 29, 471, 29, 857, 0,
+  29, 32, 854, 387, 0, 0, 0, 285, 29, 157, 4, 4,
+  0, 0, 29, 32, 29, 208, 841, 0, 0, 29, 0, 1,
+  0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 291, 0,
+  144, 0, 288, 0, 0, 471, 0, 32, 0, 288, 0, 208,
+  399, 208, 144, 0, 0, 291, 0, 0, 288, 208, 0, 285,
+  399, 4, 29, 0, 1537, 208, 285, 0, 0, 0, 208, 0,
+  0, 0, 29, 0, 144, 208, 285, 0, 288, 0, 285, 144,
+  0, 0, 0, 144, 937, 1, 0, 927, 32, 0, 0, 0,
+  0, 0, 144, 208, 0, 208, 0, 0, 0, 98, 157, 285,
+  29, 940, 0, 0, 0, 854, 854, 0, 4, 316, 264, 841,
+  857, 144, 313, 29, 0, 841, 887, 280, 854, 887, 854, 1466,
+  1118, 940, 1544, 32, 1118, 14, 288, 0, 208, 157, 29, 0,
+  208, 841, 157, 854, 4, 854, 854, 288, 0, 288, 139, 291,
+  471, 285, 285, 854, 4, 269, 269, 285, 870, 291, 269, 285,
+  4, 285, 291, 0, 288, 0, 0, 285, 144, 0, 399, 4,
+  0, 857, 291, 291, 157, 29, 399, 29, 32, 857, 1118, 0,
+  0, 29, 0, 0, 1551, 29, 841, 841, 19, 940, 995, 387,
+  841, 0, 208, 0, 29, 269, 4, 4, 841, 387, 0, 1,
+  285, 208, 0, 272, 841, 208, 0, 0, 841, 382, 157, 157,
+  836, 1, 208, 0, 157, 1, 42, 272, 29, 1, 0, 32,
+  29, 857, 288, 288, 387, 940, 288, 157, 0, 1537, 841, 208,
+  0, 285, 427, 152, 0, 0, 32, 0, 208, 32, 940, 272,
+  288, 0, 4, 81, 32, 181, 81, 471, 291, 471, 504, 157,
+  291, 0, 291, 0, 937, 0, 0, 0, 32, 0, 471, 940,
+  1395, 471, 0, 14, 29, 14, 0, 0, 0, 208, 0, 0,
+  1, 4, 129, 288, 0, 29, 0, 29, 129, 181, 264, 29,
+  0, 0, 208, 0, 288, 0, 0, 0, 29, 0, 288, 29,
+  208, 42, 280, 937, 152, 14, 29, 0, 0, 0, 152, 208,
+  0, 285, 0, 288, 0, 157, 0, 0, 0, 0, 0, 0,
+  0, 42, 0, 0, 387, 285, 0, 29, 29, 0, 4, 0,
+  129, 29, 399, 144, 854, 81, 129, 129, 0, 29, 291, 285,
+  1, 0, 42, 29, 29, 985, 0, 208, 387, 129, 181, 1,
+  264, 108, 29, 0, 0, 208, 29, 0, 0, 0, 208, 857,
+  285, 181, 0, 0, 1, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 291, 0, 0, 0, 288, 291, 285, 29, 0, 29,
+  291, 0, 0, 291, 19, 29, 285, 316, 0, 0, 313, 288,
+  0, 841, 387, 1, 0, 0, 0, 157, 288, 280, 841, 0,
+  288, 208, 0, 1, 32, 32, 0, 0, 0, 29, 81, 0,
+  288, 285, 139, 157, 0, 0, 1, 32, 4, 427, 0, 269,
+  152, 0, 0, 0, 29, 129, 0, 412, 42, 288, 0, 285,
+  0, 208, 313, 0, 0, 0, 144, 0, 29, 0, 0, 0,
+  157, 42, 264, 14, 29, 42, 0, 0, 387, 841, 139, 1112,
+  743, 29, 0, 0, 0, 223, 98, 144, 29, 0, 1556, 0,
+  841, 181, 208, 272, 887, 387, 32, 0, 0, 887, 32, 272,
+  841, 32, 887, 841, 129, 0, 0, 280, 285, 0, 269, 4,
+  0, 0, 0, 0, 144, 208, 29, 937, 288, 29, 129, 218,
+  841, 841, 272, 1005, 857, 0, 208, 152, 296, 446, 29, 427,
+  0, 272, 29, 0, 841, 208, 288, 841, 272, 0, 841, 264,
+  887, 841, 854, 841, 269, 29, 0, 32, 387, 32, 0, 208,
+  0, 338, 208, 937, 198, 129, 509, 841, 0, 157, 841, 19,
+  841, 4, 471, 0, 399, 509, 0, 1395, 4, 0, 29, 937,
+  0, 0, 1118, 382, 144, 269, 291, 0, 0, 291, 0, 0,
+  208, 841, 29, 841, 29, 0, 0, 937, 841, 29, 0, 181,
+  854, 0, 1561, 291, 291, 985, 0, 841, 0, 841, 181, 0,
+  841, 0, 0, 0, 0, 0, 0, 343, 382, 285, 288, 0,
+  223, 291, 887, 208, 208, 0, 208, 1, 0, 0, 0, 0,
+  0, 0, 29, 0, 4, 181, 841, 0, 0, 208, 0, 313,
+  0, 0, 29, 269, 288, 0, 280, 313, 280, 29, 836, 285,
+  0, 836, 269, 269, 313, 285, 4, 399, 0, 29, 0, 1,
+  0, 181, 0, 0, 0, 387, 129, 0, 0, 144, 22, 29,
+  0, 0, 285, 129, 0, 291, 291, 0, 32, 291, 288, 288,
+  0, 285, 144, 0, 285, 4, 285, 291, 1, 0, 841, 0,
+  288, 0, 29, 285, 42, 0, 4, 937, 285, 0, 285, 471,
+  29, 208, 841, 387, 32, 0, 0, 0, 0, 1, 0, 0,
+  0, 144, 0, 208, 29, 0, 857, 1, 0, 1578, 29, 0,
+  1, 1, 129, 0, 208, 0, 181, 269, 157, 4, 42, 841,
+  129, 857, 0, 0, 0, 1041, 857, 4, 471, 387, 854, 0,
+  0, 937, 157, 0, 42, 42, 0, 0, 841, 42, 841, 4,
+  841, 1080, 0, 29, 0, 0, 0, 857, 841, 1585, 208, 272,
+  181, 937, 841, 865, 157, 0, 937, 841, 857, 32, 208, 0,
+  181, 152, 0, 1080, 1402, 1, 841, 269, 0, 1571, 181, 0,
+  1566, 937, 157, 857, 22, 0, 32, 42, 857, 0, 1566, 1597,
+  0, 0, 157, 0, 0, 0, 0, 208, 29, 0, 857, 208,
+  404, 32, 857, 14, 854, 0, 333, 0, 0, 0, 14, 208,
+  0, 208, 32, 857, 0, 208, 0, 937, 285, 181, 29, 0,
+  208, 291, 32, 285, 144, 285, 1054, 14, 32, 208, 291, 0,
+  32, 0, 208, 854, 208, 343, 937, 857, 291, 285, 32, 887,
+  285, 29, 42, 4, 0, 0, 0, 333, 0, 0, 144, 264,
+  0, 4, 157, 937, 181, 857, 0, 42, 387, 841, 844, 1614,
+  857, 985, 272, 0, 937, 29, 940, 4, 0, 1, 98, 4,
+  0, 313, 0, 313, 313, 0, 0, 4, 152, 0, 42, 0,
+  940, 29, 208, 32, 14, 269, 0, 144, 0, 29, 29, 157,
+  0, 857, 291, 269, 4, 0, 208, 152, 29, 181, 382, 4,
+  0, 29, 0, 157, 0, 14, 280, 32, 285, 32, 0, 129,
+  1590, 4, 285, 857, 0, 937, 937, 841, 0, 152, 208, 29,
+  841, 841, 280, 841, 857, 1604, 29, 841, 269, 937, 841, 4,
+  753, 937, 0, 427, 269, 0, 940, 937, 854, 4, 29, 427,
+  382, 937, 857, 841, 1609, 269, 937, 985, 937, 937, 857, 4,
+  854, 269, 937, 857, 291, 1107, 937, 0, 0, 857, 288, 841,
+  937, 98, 0, 517, 338, 29, 399, 4, 841, 0, 333, 0,
+  144, 0, 0, 854, 288, 333, 29, 0, 0, 0, 0, 4,
+  0, 937, 313, 32, 288, 181, 4, 0, 32, 0, 841, 208,
+  288, 0, 288, 288, 0, 0, 841, 129, 0, 841, 29, 841,
+  0, 0, 29, 0, 0, 144, 264, 849, 841, 940, 387, 285,
+  0, 854, 208, 291, 0, 0, 0, 841, 0, 841, 841, 841,
+  1270, 387, 841, 0, 0, 844, 0, 285, 181, 836, 1402, 841,
+  29, 0, 940, 0, 937, 841, 285, 313, 181, 157, 285, 0,
+  0, 857, 0, 857, 0, 0, 0, 208, 0, 291, 857, 857,
+  0, 64, 841, 743, 937, 98, 4, 0, 854, 29, 285, 0,
+  841, 1118, 208, 208, 0, 1292, 272, 1068, 841, 1621, 4, 0,
+  854, 0, 0, 0, 0, 0, 0, 399, 29, 144, 29, 841,
+  0, 313, 198, 264, 0, 985, 0, 144, 0, 208, 313, 285,
+  0, 269, 0, 857, 291, 0, 404, 288, 313, 288, 129, 0,
+  32, 0, 857, 0, 144, 144, 412, 285, 29, 29, 291, 285,
+  841, 285, 1628, 841, 29, 0, 887, 0, 841, 0, 0, 0,
+  841, 0, 4, 0, 0, 0, 854, 887, 0, 0, 887, 19,
+  841, 841, 0, 937, 0, 841, 4, 370, 0, 841, 343, 285,
+  417, 313, 4, 0, 0, 285, 29, 0, 0, 181, 313, 1,
+  1, 208, 841, 0, 288, 0, 32, 0, 841, 0, 208, 841,
+  14, 4, 0, 854, 269, 0, 0, 29, 0, 841, 1339, 14,
+  854, 0, 32, 4, 857, 1, 0, 857, 0, 854, 0, 0,
+  291, 288, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0,
+  0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 29,
+  0, 575, 29, 4, 157, 157, 285, 280, 0, 29, 157, 203,
+  0, 29, 208, 1, 285, 288, 0, 14, 288, 291, 471, 0,
+  32, 4, 285, 208, 0, 0, 1112, 0, 0, 0, 4, 0,
+  288, 0, 1, 857, 854, 333, 0, 849, 857, 208, 857, 471,
+  854, 857, 0, 291, 0, 841, 291, 81, 0, 0, 857, 291,
+  29, 0, 0, 203, 0, 857, 14, 285, 0, 285, 841, 841,
+  285, 0, 841, 29, 208, 0, 29, 0, 857, 272, 144, 285,
+  0, 841, 0, 0, 4, 841, 857, 288, 0, 29, 841, 285,
+  0, 0, 208, 19, 0, 854, 285, 841, 181, 313, 857, 854,
+  0, 0, 0, 280, 208, 0, 285, 285, 0, 152, 0, 280,
+  32, 0, 387, 0, 0, 280, 1085, 313, 285, 0, 0, 0,
+  0, 1046, 0, 857, 29, 0, 412, 857, 857, 0, 29, 0,
+  29, 0, 0, 0, 144, 288, 985, 181, 887, 285, 887, 181,
+  887, 272, 0, 29, 32, 272, 272, 887, 4, 32, 280, 606,
+  0, 0, 635, 208, 288, 272, 985, 29, 887, 0, 387, 857,
+  0, 208, 387, 291, 0, 285, 157, 29, 0, 0, 0, 1476,
+  0, 841, 0, 857, 0, 144, 152, 0, 0, 0, 471, 841,
+  0, 0, 0, 412, 4, 887, 0, 399, 854, 0, 0, 854,
+  4, 208, 0, 0, 0, 382, 857, 0, 1054, 0, 29, 0,
+  208, 285, 509, 841, 0, 208, 841, 841, 0, 316, 0, 288,
+  841, 208, 857, 208, 0, 32, 0, 841, 841, 14, 1046, 14,
+  32, 0, 0, 0, 0, 0, 0, 0, 841, 32, 854, 0,
+  0, 14, 0, 129, 29, 157, 0, 1046, 841, 1, 1, 841,
+  854, 14, 4, 854, 857, 29, 4, 272, 387, 887, 0, 887,
+  0, 854, 854, 841, 4, 0, 0, 4, 887, 0, 887, 841,
+  0, 887, 0, 29, 0, 0, 288, 139, 0, 288, 857, 139,
+  1073, 181, 0, 1046, 0, 291, 0, 29, 285, 0, 32, 285,
+  0, 0, 288, 0, 427, 0, 285, 29, 0, 285, 288, 29,
+  32, 841, 129, 288, 288, 29, 288, 937, 0, 857, 0, 0,
+  29, 285, 887, 841, 0, 208, 29, 29, 0, 0, 29, 0,
+  0, 387, 115, 288, 4, 129, 288, 157, 0, 313, 0, 0,
+  857, 841, 291, 0, 382, 0, 285, 288, 291, 4, 857, 333,
+  29, 0, 387, 288, 0, 0, 0, 387, 0, 208, 0, 0,
+  0, 32, 29, 0, 0, 854, 4, 0, 288, 0, 285, 0,
+  857, 0, 29, 0, 0, 32, 269, 0, 0, 0, 4, 0,
+  0, 285, 313, 42, 854, 0, 157, 4, 157, 0, 4, 0,
+  291, 285, 0, 509, 534, 29, 288, 841, 313, 4, 29, 0,
+  937, 29, 0, 0, 841, 0, 291, 0, 291, 854, 0, 841,
+  0, 288, 0, 857, 29, 0, 841, 313, 0, 0, 854, 841,
+  288, 857, 844, 338, 157, 854, 181, 0, 208, 0, 0, 841,
+  32, 0, 208, 387, 0, 1107, 0, 285, 0, 789, 285, 29,
+  285, 0, 0, 0, 0, 0, 0, 1, 844, 208, 0, 0,
+  0, 32, 0, 0, 870, 1631, 147, 29, 0, 29, 0, 157,
+  0, 208, 4, 0, 0, 29, 208, 0, 0, 280, 280, 29,
+  0, 0, 29, 288, 0, 0, 0, 471, 1, 0, 0, 0,
+  285, 0, 0, 29, 0, 29, 0, 0, 288, 208, 4, 291,
+  14, 0, 0, 0, 29, 0, 0, 4, 0, 0, 854, 0,
+  29, 4, 0, 29, 0, 0, 0, 4, 0, 0, 0, 129,
+  29, 29, 208, 0, 313, 29, 288, 32, 157, 144, 0, 854,
+  29, 288, 285, 0, 0, 0, 291, 280, 288, 181, 288, 0,
+  0, 0, 0, 32, 0, 29, 57, 181, 291, 412, 0, 0,
+  147, 269, 0, 288, 0, 0, 29, 0, 0, 427, 181, 42,
+  0, 0, 0, 0, 0, 844, 291, 0, 0, 857, 269, 269,
+  4, 0, 844, 0, 844, 844, 857, 29, 29, 0, 844, 288,
+  0, 0, 0, 4, 857, 0, 0, 29, 0, 844, 887, 42,
+  854, 841, 4, 1118, 0, 29, 1434, 181, 0, 1118, 887, 854,
+  985, 887, 0, 854, 0, 844, 42, 32, 854, 157, 0, 854,
+  4, 887, 0, 0, 167, 0, 1263, 129, 0, 98, 285, 208,
+  841, 4, 854, 285, 0, 208, 1, 42, 285, 841, 29, 841,
+  4, 32, 857, 937, 272, 854, 29, 1118, 29, 157, 288, 857,
+  0, 29, 854, 285, 0, 857, 1046, 29, 844, 144, 844, 0,
+  208, 857, 0, 0, 0, 4, 1434, 887, 4, 0, 223, 29,
+  285, 181, 269, 4, 0, 29, 296, 857, 42, 854, 870, 343,
+  857, 4, 857, 0, 1161, 0, 854, 857, 0, 841, 272, 4,
+  0, 857, 940, 4, 29, 0, 272, 0, 1046, 1118, 269, 611,
+  857, 0, 844, 0, 285, 1395, 940, 343, 870, 0, 857, 0,
+  940, 857, 857, 0, 940, 208, 0, 836, 940, 4, 4, 940,
+  0, 269, 285, 844, 269, 0, 841, 412, 985, 857, 844, 144,
+  870, 285, 887, 0, 4, 0, 887, 285, 0, 0, 857, 0,
+  1636, 844, 288, 285, 854, 115, 4, 1636, 29, 0, 0, 0,
+  98, 288, 1041, 296, 1118, 940, 841, 280, 4, 857, 203, 29,
+  857, 0, 1041, 841, 0, 841, 857, 857, 857, 844, 857, 841,
+  841, 288, 0, 0, 841, 1118, 0, 81, 0, 841, 841, 844,
+  841, 0, 857, 841, 854, 0, 854, 854, 841, 4, 841, 841,
+  841, 0, 4, 841, 313, 0, 0, 0, 854, 841, 0, 854,
+  1643, 313, 841, 0, 203, 0, 841, 29, 1, 0, 0, 285,
+  0, 0, 264, 157, 0, 181, 0, 157, 269, 0, 4, 272,
+  264, 0, 1, 157, 269, 296, 0, 841, 0, 0, 887, 0,
+  0, 0, 1118, 32, 29, 0, 0, 0, 285, 272, 29, 857,
+  129, 0, 887, 870, 285, 14, 870, 288, 208, 0, 0, 32,
+  0, 0, 4, 387, 285, 857, 42, 0, 313, 857, 285, 285,
+  0, 0, 285, 0, 285, 985, 181, 870, 0, 264, 387, 29,
+  0, 0, 181, 857, 0, 139, 313, 0, 181, 157, 0, 0,
+  0, 152, 272, 857, 0, 264, 854, 0, 0, 0, 144, 427,
+  870, 0, 296, 208, 1648, 1292, 382, 144, 272, 857, 0, 0,
+  0, 0, 854, 887, 208, 1046, 841, 0, 208, 1655, 0, 272,
+  0, 0, 285, 844, 844, 1118, 854, 844, 285, 854, 844, 844,
+  0, 0, 870, 844, 1046, 854, 0, 854, 870, 22, 0, 0,
+  1054, 0, 841, 985, 0, 0, 857, 841, 887, 0, 269, 29,
+  857, 129, 129, 0, 841, 841, 129, 98, 857, 157, 129, 157,
+  264, 29, 0, 854, 0, 4, 854, 0, 857, 857, 854, 14,
+  272, 382, 313, 857, 887, 181, 887, 0, 887, 365, 208, 0,
+  313, 854, 0, 285, 844, 887, 288, 887, 887, 29, 887, 870,
+  857, 22, 0, 844, 0, 0, 844, 870, 844, 844, 0, 296,
+  129, 870, 0, 264, 985, 29, 870, 29, 1118, 288, 0, 854,
+  913, 854, 1, 854, 854, 844, 0, 0, 854, 857, 854, 0,
+  269, 288, 854, 0, 288, 144, 288, 288, 857, 208, 841, 181,
+  857, 857, 288, 0, 181, 208, 0, 0, 0, 285, 0, 387,
+  870, 272, 940, 181, 0, 0, 32, 0, 1662, 1149, 854, 0,
+  0, 29, 857, 280, 285, 1118, 0, 144, 854, 208, 0, 1118,
+  857, 313, 841, 285, 0, 887, 841, 0, 4, 0, 940, 841,
+  4, 0, 0, 0, 841, 841, 857, 0, 0, 870, 857, 841,
+  0, 181, 264, 1667, 0, 42, 854, 854, 29, 524, 844, 854,
+  985, 857, 841, 870, 29, 844, 841, 854, 854, 841, 857, 285,
+  32, 844, 854, 844, 0, 841, 841, 841, 0, 844, 0, 854,
+  0, 854, 857, 0, 0, 841, 382, 841, 0, 985, 285, 841,
+  0, 841, 0, 0, 0, 0, 0, 0, 870, 0, 42, 887,
+  291, 288, 0, 0, 0, 313, 0, 0, 0, 1, 0, 0,
+  0, 32, 0, 1, 857, 0, 0, 0, 32, 19, 288, 0,
+  0, 0, 0, 157, 0, 0, 0, 0, 0, 0, 0, 0,
+  288, 854, 0, 0, 4, 181, 0, 0, 4, 0, 937, 0,
+  29, 865, 857, 857, 857, 854, 288, 854, 854, 0, 0, 29,
+  0, 0, 0, 937, 854, 0, 1292, 0, 0, 0, 288, 841,
+  857, 0, 29, 985, 857, 0, 841, 985, 0, 288, 841, 0,
+  0, 937, 940, 0, 0, 0, 0, 0, 0, 0, 19, 854,
+  854, 0, 32, 0, 343, 841, 285, 870, 937, 285, 857, 0,
+  285, 841, 841, 208, 0, 4, 841, 1674, 940, 870, 32, 285,
+  854, 841, 841, 0, 223, 0, 865, 841, 144, 404, 0, 940,
+  275, 865, 0, 841, 0, 208, 343, 854, 0, 841, 841, 0,
+  0, 841, 0, 937, 854, 0, 0, 0, 841, 0, 0, 854,
+  854, 0, 854, 0, 0, 0, 854, 0, 841, 0, 0, 841,
+  937, 0, 857, 81, 940, 0, 841, 857, 269, 29, 857, 0,
+  841, 42, 857, 0, 854, 937, 0, 887, 272, 857, 272, 14,
+  0, 1, 0, 0, 272, 0, 937, 0, 985, 841, 857, 841,
+  857, 937, 937, 280, 32, 0, 0, 870, 0, 14, 0, 841,
+  865, 285, 841, 854, 841, 0, 0, 854, 0, 857, 854, 147,
+  870, 1263, 0, 0, 208, 854, 854, 0, 0, 841, 857, 887,
+  181, 0, 0, 144, 1118, 0, 208, 1118, 857, 208, 0, 887,
+  0, 857, 854, 272, 0, 887, 841, 844, 0, 841, 854, 0,
+  0, 0, 272, 0, 844, 285, 854, 854, 0, 870, 854, 0,
+  887, 338, 841, 0, 854, 841, 854, 0, 841, 841, 0, 854,
+  940, 0, 841, 0, 1426, 854, 940, 272, 1161, 854, 841, 0,
+  854, 208, 841, 98, 29, 208, 0, 272, 0, 0, 1118, 280,
+  296, 387, 1681, 1319, 387, 427, 1434, 0, 0, 1263, 0, 269,
+  81, 0, 0, 0, 0, 4, 857, 887, 870, 29, 0, 32,
+  264, 857, 0, 0, 0, 0, 0, 29, 0, 0, 841, 857,
+  0, 4, 887, 0, 0, 29, 1263, 841, 857, 0, 0, 854,
+  0, 841, 313, 857, 0, 844, 272, 0, 272, 841, 313, 841,
+  272, 0, 208, 0, 0, 29, 29, 0, 0, 0, 280, 0,
+  1636, 29, 841, 841, 285, 0, 0, 157, 81, 857, 288, 0,
+  285, 887, 313, 0, 0, 0, 4, 272, 841, 29, 870, 208,
+  0, 857, 887, 404, 313, 0, 857, 0, 841, 313, 0, 0,
+  29, 272, 1118, 285, 288, 0, 857, 0, 0, 32, 29, 0,
+  841, 0, 0, 854, 0, 887, 857, 471, 857, 269, 272, 288,
+  857, 269, 343, 288, 857, 0, 0, 4, 854, 32, 157, 0,
+  4, 272, 157, 208, 288, 471, 208, 370, 0, 1, 841, 208,
+  857, 208, 857, 0, 857, 208, 269, 857, 285, 382, 0, 0,
+  857, 854, 857, 181, 870, 181, 841, 854, 0, 857, 1703, 29,
+  887, 0, 0, 272, 29, 0, 157, 857, 1686, 1691, 288, 1691,
+  0, 0, 857, 29, 0, 854, 857, 0, 857, 857, 0, 857,
+  0, 887, 857, 1691, 857, 857, 285, 29, 841, 0, 208, 854,
+  458, 29, 29, 0, 387, 841, 29, 0, 0, 0, 313, 157,
+  14, 29, 725, 147, 841, 285, 0, 0, 42, 0, 1710, 29,
+  208, 42, 1263, 0, 152, 0, 1263, 0, 32, 0, 0, 0,
+  0, 854, 0, 29, 29, 0, 32, 208, 1, 157, 32, 887,
+  854, 857, 857, 841, 854, 288, 4, 208, 985, 313, 0, 857,
+  157, 0, 0, 181, 0, 0, 0, 157, 0, 857, 0, 0,
+  313, 985, 0, 0, 42, 618, 313, 0, 870, 854, 0, 857,
+  854, 0, 0, 0, 157, 288, 937, 857, 940, 152, 844, 208,
+  940, 1696, 208, 940, 0, 313, 285, 0, 937, 857, 19, 857,
+  0, 0, 0, 1, 0, 0, 0, 288, 0, 0, 4, 940,
+  940, 288, 940, 288, 32, 940, 288, 14, 940, 0, 139, 857,
+  0, 144, 0, 32, 32, 285, 0, 1, 940, 1402, 288, 0,
+  857, 181, 32, 0, 42, 841, 14, 285, 0, 32, 427, 1483,
+  0, 29, 857, 0, 0, 280, 32, 0, 0, 0, 208, 427,
+  854, 857, 0, 42, 29, 844, 1107, 887, 0, 272, 0, 854,
+  0, 29, 4, 285, 0, 0, 841, 0, 272, 272, 208, 1118,
+  29, 208, 887, 0, 291, 32, 29, 269, 887, 42, 0, 29,
+  4, 285, 0, 208, 1144, 285, 288, 32, 208, 208, 29, 0,
+  4, 0, 841, 181, 4, 841, 4, 0, 1012, 841, 285, 272,
+  857, 857, 0, 857, 0, 181, 0, 14, 1, 0, 0, 0,
+  272, 181, 0, 940, 29, 0, 857, 313, 4, 0, 32, 1426,
+  313, 0, 208, 854, 272, 313, 0, 1036, 1, 0, 0, 1046,
+  0, 4, 0, 0, 387, 0, 387, 313, 0, 144, 280, 285,
+  4, 404, 1046, 854, 857, 857, 0, 0, 0, 985, 0, 1292,
+  32, 857, 1046, 291, 0, 29, 857, 4, 857, 0, 0, 0,
+  1161, 841, 854, 854, 940, 1715, 857, 854, 940, 0, 291, 181,
+  844, 313, 0, 291, 0, 854, 313, 0, 0, 0, 844, 471,
+  29, 4, 940, 313, 0, 618, 0, 4, 0, 0, 29, 0,
+  313, 208, 0, 0, 208, 313, 29, 857, 269, 264, 0, 1161,
+  857, 4, 0, 0, 313, 29, 0, 0, 0, 857, 0, 313,
+  288, 0, 0, 29, 0, 857, 857, 940, 1046, 0, 854, 181,
+  29, 0, 0, 854, 29, 181, 0, 471, 1292, 1046, 841, 0,
+  940, 857, 29, 854, 285, 32, 844, 272, 0, 288, 0, 841,
+  29, 854, 0, 0, 1715, 0, 0, 857, 0, 854, 857, 857,
+  208, 288, 471, 0, 272, 0, 0, 32, 14, 29, 0, 0,
+  285, 181, 208, 19, 387, 1718, 471, 285, 29, 4, 285, 280,
+  32, 0, 144, 0, 471, 0, 0, 321, 291, 0, 291, 0,
+  4, 0, 471, 98, 285, 0, 387, 288, 288, 19, 0, 291,
+  208, 4, 0, 0, 0, 285, 399, 0, 32, 0, 1727, 0,
+  285, 29, 4, 0, 264, 0, 0, 0, 0, 427, 387, 29,
+  0, 0, 181, 313, 285, 32, 29, 32, 181, 0, 29, 333,
+  93, 203, 0, 29, 0, 269, 29, 333, 0, 0, 0, 0,
+  285, 0, 288, 0, 0, 285, 857, 0, 0, 134, 857, 208,
+  0, 0, 0, 857, 844, 940, 887, 0, 387, 940, 841, 0,
+  4, 870, 42, 0, 940, 0, 940, 0, 854, 887, 857, 887,
+  940, 152, 887, 857, 940, 0, 32, 0, 208, 208, 0, 887,
+  857, 296, 29, 0, 208, 288, 844, 0, 887, 1, 0, 0,
+  264, 181, 285, 0, 857, 32, 471, 0, 857, 129, 0, 0,
+  32, 285, 181, 144, 551, 0, 269, 29, 0, 711, 4, 857,
+  29, 29, 1, 313, 857, 181, 857, 29, 382, 0, 0, 42,
+  291, 0, 0, 0, 291, 0, 1732, 285, 0, 0, 857, 291,
+  0, 854, 272, 1696, 272, 0, 272, 181, 272, 272, 272, 0,
+  42, 29, 0, 4, 272, 29, 272, 285, 272, 272, 1737, 29,
+  32, 272, 285, 269, 272, 0, 0, 0, 4, 1696, 285, 0,
+  0, 0, 0, 1, 4, 0, 285, 272, 0, 29, 144, 272,
+  0, 32, 157, 157, 157, 0, 269, 76, 321, 0, 0, 272,
+  0, 1, 841, 288, 122, 4, 0, 288, 181, 1, 0, 0,
+  399, 272, 42, 0, 0, 208, 29, 291, 157, 338, 108, 181,
+  1107, 152, 181, 313, 152, 0, 0, 181, 887, 0, 29, 288,
+  160, 333, 208, 0, 0, 264, 0, 208, 0, 841, 4, 152,
+  32, 288, 841, 29, 14, 285, 288, 291, 208, 32, 288, 288,
+  4, 1227, 4, 19, 348, 288, 4, 32, 0, 181, 471, 841,
+  19, 32, 288, 285, 4, 291, 0, 157, 0, 0, 291, 32,
+  32, 0, 0, 32, 0, 269, 208, 208, 0, 0, 29, 285,
+  291, 0, 269, 0, 208, 288, 0, 269, 4, 32, 288, 280,
+  1, 29, 4, 29, 0, 0, 29, 285, 1012, 0, 0, 370,
+  0, 269, 129, 0, 208, 0, 139, 181, 29, 0, 0, 29,
+  0, 0, 208, 32, 81, 32, 387, 129, 29, 285, 98, 291,
+  29, 0, 0, 157, 152, 144, 471, 0, 288, 0, 208, 291,
+  139, 81, 291, 288, 0, 0, 208, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 841, 937, 937, 0, 0, 0, 0,
+  29, 29, 0, 14, 0, 29, 399, 280, 0, 285, 0, 0,
+  1744, 208, 841, 29, 29, 0, 937, 841, 937, 841, 288, 0,
+  98, 1036, 208, 42, 937, 0, 208, 0, 1753, 0, 272, 0,
+  937, 4, 0, 4, 937, 288, 272, 208, 0, 272, 841, 208,
+  0, 551, 0, 0, 1760, 0, 458, 0, 42, 0, 463, 841,
+  841, 937, 0, 288, 841, 29, 870, 0, 29, 98, 22, 264,
+  288, 29, 0, 937, 285, 0, 29, 0, 399, 4, 865, 0,
+  0, 0, 0, 0, 152, 0, 841, 0, 0, 0, 208, 208,
+  841, 0, 208, 1551, 14, 208, 854, 208, 0, 122, 208, 0,
+  0, 0, 0, 208, 157, 0, 841, 854, 854, 285, 857, 64,
+  0, 0, 144, 29, 937, 0, 0, 0, 471, 0, 29, 208,
+  0, 280, 0, 0, 291, 0, 144, 841, 0, 1182, 0, 0,
+  1115, 4, 0, 291, 0, 0, 0, 0, 157, 1, 4, 0,
+  0, 887, 841, 0, 264, 0, 0, 22, 0, 0, 208, 0,
+  208, 0, 1005, 29, 1005, 841, 4, 0, 0, 0, 285, 387,
+  841, 208, 42, 338, 0, 14, 181, 0, 0, 208, 0, 0,
+  32, 29, 32, 0, 1718, 288, 288, 1537, 291, 0, 285, 4,
+  208, 272, 291, 32, 0, 427, 0, 0, 152, 288, 32, 0,
+  0, 285, 0, 0, 181, 285, 0, 0, 285, 288, 29, 0,
+  157, 937, 285, 0, 517, 0, 404, 291, 208, 291, 4, 272,
+  0, 81, 0, 129, 208, 288, 0, 937, 288, 0, 288, 427,
+  0, 0, 0, 0, 29, 399, 280, 275, 504, 291, 0, 288,
+  280, 0, 0, 1760, 0, 42, 285, 0, 22, 0, 285, 0,
+  0, 4, 14, 129, 0, 387, 144, 208, 4, 152, 0, 272,
+  42, 139, 264, 208, 14, 0, 0, 181, 4, 208, 208, 181,
+  0, 0, 208, 0, 157, 0, 288, 152, 181, 42, 264, 288,
+  208, 0, 157, 0, 841, 181, 937, 29, 870, 285, 0, 42,
+  264, 29, 157, 208, 0, 0, 427, 42, 157, 313, 208, 387,
+  181, 854, 157, 285, 208, 387, 29, 0, 181, 288, 157, 4,
+  42, 0, 841, 42, 0, 0, 0, 285, 4, 208, 0, 208,
+  272, 427, 0, 280, 288, 841, 42, 181, 0, 208, 0, 4,
+  937, 285, 857, 269, 208, 14, 157, 14, 29, 0, 29, 0,
+  0, 1115, 14, 157, 129, 208, 139, 29, 144, 22, 129, 0,
+  129, 157, 0, 157, 0, 841, 0, 0, 291, 291, 269, 264,
+  857, 285, 0, 152, 98, 285, 0, 0, 0, 0, 427, 387,
+  29, 0, 0, 108, 0, 291, 181, 0, 0, 841, 0, 0,
+  1107, 0, 4, 4, 157, 0, 42, 288, 841, 4, 0, 29,
+  0, 285, 937, 0, 157, 0, 285, 157, 157, 181, 375, 0,
+  129, 841, 29, 181, 285, 181, 0, 29, 181, 0, 19, 0,
+  139, 296, 471, 285, 29, 144, 4, 0, 29, 4, 291, 269,
+  0, 272, 98, 81, 0, 285, 198, 29, 291, 157, 152, 157,
+  29, 471, 4, 269, 1765, 42, 32, 4, 288, 181, 0, 471,
+  291, 291, 0, 269, 32, 291, 4, 19, 144, 291, 1, 32,
+  4, 157, 272, 269, 285, 181, 152, 854, 857, 208, 208, 144,
+  0, 208, 0, 0, 29, 4, 1, 857, 399, 841, 181, 285,
+  285, 1662, 841, 29, 0, 208, 841, 0, 841, 42, 870, 870,
+  857, 0, 0, 0, 575, 940, 841, 42, 0, 887, 98, 296,
+  857, 42, 0, 269, 288, 0, 887, 1770, 4, 0, 98, 208,
+  841, 181, 14, 887, 887, 157, 0, 1263, 35, 857, 0, 285,
+  208, 0, 42, 0, 14, 29, 0, 0, 181, 841, 181, 1046,
+  0, 831, 0, 0, 0, 0, 0, 181, 14, 0, 32, 4,
+  1, 157, 129, 870, 0, 288, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 870, 841, 0, 887, 0, 181, 0,
+  887, 0, 0, 1, 4, 887, 32, 887, 1263, 29, 0, 181,
+  0, 181, 29, 208, 831, 0, 0, 387, 887, 887, 4, 887,
+  870, 272, 0, 887, 4, 29, 288, 0, 269, 0, 0, 291,
+  0, 841, 42, 887, 208, 32, 264, 0, 208, 0, 0, 0,
+  167, 29, 208, 0, 42, 288, 0, 0, 0, 29, 0, 887,
+  288, 0, 208, 57, 0, 1777, 272, 208, 29, 841, 887, 4,
+  887, 0, 0, 0, 841, 841, 269, 4, 272, 269, 841, 29,
+  0, 208, 157, 1, 841, 887, 0, 4, 382, 887, 4, 42,
+  42, 887, 272, 870, 0, 841, 887, 887, 291, 887, 841, 841,
+  887, 841, 887, 887, 272, 98, 19, 42, 841, 841, 181, 203,
+  32, 841, 285, 147, 269, 841, 887, 272, 1085, 841, 841, 0,
+  264, 0, 887, 22, 887, 0, 0, 285, 887, 887, 338, 29,
+  122, 1476, 0, 29, 0, 291, 144, 157, 29, 269, 0, 269,
+  272, 29, 29, 98, 272, 144, 0, 0, 272, 387, 144, 157,
+  0, 157, 841, 1, 272, 285, 0, 0, 272, 0, 333, 831,
+  0, 157, 32, 0, 1, 208, 0, 0, 387, 208, 208, 272,
+  181, 285, 0, 42, 937, 144, 14, 29, 208, 0, 272, 0,
+  0, 4, 0, 0, 4, 181, 427, 1782, 1005, 0, 0, 1,
+  387, 14, 29, 1419, 64, 29, 14, 129, 4, 29, 0, 29,
+  144, 29, 4, 0, 0, 29, 144, 4, 291, 208, 0, 471,
+  29, 4, 208, 0, 208, 29, 29, 0, 32, 181, 32, 399,
+  32, 29, 269, 208, 4, 29, 98, 0, 0, 4, 4, 157,
+  29, 203, 19, 1789, 316, 4, 0, 29, 4, 29, 0, 937,
+  157, 29, 157, 129, 29, 0, 1, 144, 129, 144, 1, 22,
+  208, 152, 157, 4, 181, 0, 14, 129, 157, 29, 129, 0,
+  4, 29, 0, 940, 280, 4, 841, 288, 387, 29, 288, 29,
+  157, 29, 288, 1287, 208, 288, 29, 29, 1, 0, 0, 0,
+  551, 45, 285, 4, 42, 1, 98, 0, 208, 0, 288, 0,
+  32, 0, 0, 32, 32, 144, 269, 1, 208, 208, 4, 208,
+  0, 129, 208, 4, 29, 285, 4, 139, 42, 157, 129, 29,
+  19, 291, 29, 208, 129, 29, 29, 291, 181, 208, 471, 291,
+  427, 4, 4, 0, 0, 0, 0, 208, 32, 14, 147, 29,
+  29, 42, 208, 551, 98, 29, 0, 288, 157, 0, 29, 208,
+  129, 272, 29, 208, 285, 0, 0, 0, 157, 4, 0, 98,
+  291, 313, 139, 0, 0, 0, 4, 0, 0, 181, 0, 291,
+  0, 181, 208, 387, 0, 0, 269, 4, 32, 338, 0, 129,
+  0, 32, 285, 291, 4, 29, 0, 0, 22, 0, 0, 29,
+  0, 291, 0, 157, 0, 29, 208, 32, 208, 291, 29, 291,
+  471, 181, 181, 29, 29, 157, 29, 208, 4, 181, 4, 0,
+  29, 208, 181, 208, 0, 0, 0, 208, 269, 147, 387, 129,
+  29, 14, 208, 4, 152, 152, 269, 0, 14, 0, 203, 1,
+  157, 64, 157, 269, 29, 269, 29, 0, 29, 208, 157, 4,
+  0, 208, 29, 32, 0, 42, 427, 1, 0, 32, 0, 0,
+  4, 208, 0, 0, 1, 387, 42, 0, 29, 0, 264, 0,
+  29, 0, 181, 144, 42, 181, 4, 382, 42, 98, 144, 387,
+  1, 0, 29, 0, 0, 181, 139, 0, 208, 129, 0, 0,
+  0, 0, 0, 181, 19, 29, 0, 208, 0, 0, 208, 269,
+  208, 29, 144, 427, 32, 1, 387, 4, 427, 42, 157, 157,
+  181, 144, 208, 29, 157, 144, 29, 0, 29, 0, 1796, 264,
+  129, 157, 29, 29, 29, 0, 0, 0, 0, 0, 129, 157,
+  0, 0, 208, 0, 0, 0, 19, 0, 0, 64, 42, 29,
+  208, 29, 4, 382, 1297, 29, 157, 208, 0, 0, 144, 427,
+  0, 0, 0, 4, 382, 1799, 382, 181, 0, 208, 387, 208,
+  427, 1, 387, 157, 208, 0, 0, 42, 208, 0, 0, 208,
+  269, 208, 0, 144, 387, 208, 19, 19, 129, 208, 208, 19,
+  0, 181, 0, 208, 208, 181, 0, 0, 144, 0, 387, 0,
+  29, 0, 0, 269, 208, 269, 269, 0, 387, 841, 29, 208,
+  857, 4, 0, 157, 264, 0, 181, 208, 4, 208, 29, 382,
+  98, 0, 42, 4, 0, 32, 144, 1, 269, 0, 42, 0,
+  14, 269, 208, 181, 181, 144, 208, 42, 0, 208, 208, 0,
+  0, 152, 0, 0, 139, 19, 4, 29, 208, 0, 0, 382,
+  0, 0, 0, 0, 29, 29, 0, 144, 157, 144, 427, 0,
+  0, 208, 19, 1, 0, 0, 208, 29, 0, 0, 269, 208,
+  1, 208, 181, 0, 0, 4, 0, 0, 0, 32, 208, 157,
+  0, 129, 181, 98, 32, 144, 208, 29, 29, 0, 157, 0,
+  42, 42, 14, 4, 144, 157, 0, 0, 208, 269, 29, 19,
+  387, 0, 1107, 382, 208, 269, 81, 463, 19, 0, 0, 19,
+  269, 0, 0, 427, 0, 98, 0, 0, 0, 0, 0, 181,
+  0, 29, 0, 0, 157, 288, 4, 272, 0, 272, 0, 1804,
+  198, 285, 285, 841, 1804, 272, 382, 1807, 0, 14, 841, 382,
+  854, 313, 272, 857, 272, 575, 1810, 81, 1807, 841, 857, 0,
+  575, 857, 854, 313, 937, 1804, 4, 841, 575, 1815, 0, 208,
+  857, 208, 32, 32, 937, 1804, 269, 0, 272, 29, 841, 382,
+  0, 0, 181, 0, 32, 0, 1085, 0, 29, 144, 387, 208,
+  0, 269, 208, 288, 1822, 64, 0, 0, 0, 0, 288, 0,
+  0, 14, 313, 0, 841, 288, 285, 285, 0, 343, 285, 1727,
+  285, 0, 0, 0, 1827, 313, 399, 0, 313, 0, 313, 313,
+  313, 288, 0, 139, 0, 0, 841, 1476, 0, 272, 129, 32,
+  841, 0, 0, 333, 208, 1, 288, 285, 0, 0, 343, 285,
+  0, 208, 269, 157, 0, 0, 285, 0, 4, 0, 291, 0,
+  272, 29, 887, 471, 288, 285, 1804, 144, 1804, 288, 0, 29,
+  272, 0, 1804, 1804, 272, 1832, 272, 1804, 285, 1832, 857, 272,
+  841, 288, 14, 857, 288, 1835, 0, 285, 208, 272, 285, 285,
+  0, 4, 313, 29, 1822, 0, 841, 272, 144, 870, 1838, 272,
+  288, 1835, 1827, 157, 285, 1835, 0, 1636, 844, 841, 288, 285,
+  1832, 19, 887, 841, 285, 285, 887, 1807, 887, 285, 0, 0,
+  940, 272, 0, 269, 272, 272, 1843, 285, 887, 285, 288, 0,
+  0, 313, 29, 1835, 285, 0, 887, 291, 272, 291, 285, 471,
+  0, 1835, 291, 285, 0, 288, 0, 29, 285, 288, 272, 272,
+  285, 0, 42, 288, 0, 285, 291, 0, 288, 32, 285, 0,
+  0, 32, 0, 285, 272, 841, 285, 0, 285, 285, 338, 0,
+  285, 387, 854, 313, 280, 1804, 887, 0, 285, 841, 285, 285,
+  285, 4, 1804, 1850, 22, 0, 313, 725, 285, 1107, 285, 313,
+  313, 285, 19, 725, 1804, 0, 1, 313, 272, 338, 0, 291,
+  1046, 313, 288, 1804, 1855, 291, 0, 208, 144, 1804, 0, 29,
+  0, 1292, 272, 208, 0, 4, 144, 0, 29, 0, 291, 285,
+  1804, 0, 29, 1804, 1807, 288, 1835, 0, 285, 285, 208, 412,
+  0, 208, 285, 1832, 285, 1804, 854, 1807, 291, 1862, 0, 844,
+  854, 1807, 291, 0, 0, 208, 285, 285, 208, 857, 285, 0,
+  1804, 208, 844, 291, 0, 0, 285, 606, 1804, 1807, 285, 1835,
+  4, 313, 139, 29, 0, 288, 288, 285, 32, 0, 1835, 144,
+  280, 288, 208, 1804, 285, 181, 0, 1835, 285, 285, 0, 1807,
+  285, 1807, 0, 208, 269, 0, 789, 1807, 1822, 985, 887, 288,
+  288, 857, 1804, 940, 29, 280, 285, 857, 208, 272, 4, 285,
+  208, 1804, 288, 280, 285, 887, 1832, 1804, 0, 0, 272, 1804,
+  272, 285, 1804, 841, 857, 1867, 1804, 208, 29, 98, 841, 387,
+  29, 288, 1046, 4, 387, 841, 1182, 841, 0, 841, 841, 288,
+  0, 285, 0, 285, 0, 285, 0, 291, 285, 285, 0, 285,
+  264, 272, 288, 382, 29, 285, 285, 29, 285, 1835, 0, 291,
+  29, 291, 0, 313, 29, 208, 291, 291, 551, 0, 0, 280,
+  0, 1804, 285, 1804, 285, 285, 857, 0, 144, 280, 0, 288,
+  208, 269, 940, 0, 272, 272, 157, 985, 129, 1046, 144, 841,
+  0, 4, 0, 288, 285, 288, 1804, 857, 272, 29, 288, 0,
+  139, 854, 0, 285, 288, 4, 285, 288, 0, 272, 313, 29,
+  288, 937, 0, 313, 0, 29, 0, 288, 208, 288, 0, 313,
+  288, 272, 288, 272, 285, 288, 0, 857, 0, 1838, 272, 1838,
+  144, 0, 272, 288, 985, 0, 208, 1012, 42, 854, 0, 29,
+  288, 0, 181, 29, 1832, 0, 0, 0, 269, 29, 0, 1835,
+  272, 1807, 291, 29, 29, 157, 291, 269, 841, 940, 313, 1835,
+  313, 0, 288, 1832, 288, 0, 280, 333, 280, 269, 0, 285,
+  285, 285, 313, 29, 285, 313, 285, 285, 32, 509, 0, 285,
+  1804, 285, 1804, 0, 29, 285, 285, 4, 0, 288, 1804, 285,
+  1832, 0, 285, 0, 0, 285, 1832, 640, 32, 313, 1832, 285,
+  313, 285, 285, 0, 29, 291, 157, 0, 1804, 285, 32, 0,
+  285, 0, 285, 4, 333, 0, 285, 1804, 313, 517, 1804, 0,
+  291, 857, 0, 0, 0, 4, 841, 285, 382, 291, 0, 0,
+  1, 0, 291, 1872, 285, 0, 285, 0, 285, 269, 208, 208,
+  264, 42, 1, 291, 288, 64, 0, 937, 208, 0, 280, 0,
+  285, 285, 208, 288, 29, 208, 29, 29, 144, 285, 29, 0,
+  0, 29, 399, 0, 280, 32, 0, 387, 181, 288, 857, 32,
+  4, 42, 1804, 144, 269, 1877, 272, 0, 272, 19, 285, 0,
+  404, 387, 272, 272, 1872, 288, 1872, 272, 4, 208, 272, 4,
+  288, 1884, 269, 208, 291, 280, 208, 0, 0, 144, 285, 208,
+  288, 285, 223, 1804, 0, 288, 313, 208, 0, 0, 0, 0,
+  42, 387, 0, 0, 0, 29, 1835, 208, 208, 313, 313, 1872,
+  208, 1804, 0, 1804, 1835, 208, 280, 285, 937, 291, 343, 29,
+  387, 1835, 0, 269, 1872, 0, 0, 291, 1889, 4, 0, 288,
+  0, 4, 0, 0, 412, 4, 29, 208, 313, 412, 313, 269,
+  29, 29, 0, 157, 4, 0, 181, 19, 285, 157, 4, 4,
+  280, 1835, 0, 0, 0, 29, 285, 269, 208, 14, 0, 1832,
+  313, 285, 288, 285, 857, 29, 841, 0, 841, 854, 857, 1889,
+  1804, 1889, 42, 1835, 1804, 1804, 1804, 841, 857, 841, 0, 857,
+  208, 288, 1804, 1691, 0, 1804, 404, 382, 1, 29, 29, 285,
+  29, 14, 296, 29, 285, 1835, 285, 280, 313, 0, 29, 313,
+  0, 42, 1889, 0, 857, 19, 29, 0, 129, 1889, 0, 1804,
+  0, 1889, 0, 854, 854, 857, 1889, 1889, 854, 1889, 1889, 98,
+  29, 857, 144, 29, 264, 288, 4, 0, 857, 857, 32, 0,
+  854, 272, 272, 285, 0, 288, 272, 81, 285, 857, 0, 844,
+  0, 854, 272, 854, 32, 887, 181, 0, 0, 42, 841, 313,
+  333, 285, 0, 129, 1144, 854, 0, 1, 857, 285, 313, 0,
+  98, 0, 32, 0, 208, 19, 19, 404, 0, 29, 1537, 0,
+  29, 32, 29, 19, 0, 0, 1835, 157, 940, 157, 272, 272,
+  1832, 1835, 1807, 1832, 1835, 0, 157, 1804, 1835, 272, 0, 1835,
+  1894, 0, 0, 157, 0, 1832, 1804, 1807, 0, 0, 1217, 463,
+  29, 0, 4, 1835, 208, 0, 1804, 1832, 0, 1804, 1807, 1804,
+  0, 272, 387, 272, 0, 1832, 288, 0, 1835, 272, 1901, 1901,
+  285, 1901, 269, 0, 1901, 285, 272, 272, 144, 1832, 1832, 1804,
+  269, 1804, 0, 29, 29, 0, 1804, 285, 1804, 0, 0, 4,
+  157, 42, 0, 0, 285, 1906, 29, 313, 272, 285, 0, 29,
+  29, 0, 870, 870, 0, 144, 42, 157, 1877, 937, 1804, 1827,
+  269, 285, 0, 285, 0, 285, 1804, 1804, 841, 285, 29, 313,
+  29, 0, 14, 14, 19, 1804, 29, 285, 14, 29, 1889, 29,
+  269, 285, 313, 1911, 14, 0, 841, 29, 288, 285, 1426, 288,
+  285, 285, 285, 0, 144, 1832, 1832, 1804, 4, 1804, 1835, 291,
+  0, 29, 1804, 1118, 291, 181, 29, 288, 32, 0, 1804, 0,
+  29, 0, 0, 1832, 1804, 0, 1804, 285, 288, 1872, 29, 181,
+  29, 471, 0, 0, 285, 42, 0, 14, 29, 14, 0, 0,
+  0, 1804, 0, 0, 29, 1804, 4, 1832, 1872, 208, 208, 1804,
+  29, 0, 854, 1804, 181, 0, 4, 1911, 280, 343, 0, 768,
+  1804, 0, 285, 1804, 0, 0, 313, 1872, 313, 854, 32, 313,
+  269, 0, 285, 313, 291, 285, 0, 288, 422, 285, 32, 0,
+  1872, 288, 0, 0, 285, 1872, 291, 0, 285, 272, 1877, 0,
+  285, 272, 4, 285, 0, 129, 181, 0, 841, 64, 313, 288,
+  0, 288, 399, 1, 0, 4, 139, 0, 399, 1916, 288, 0,
+  285, 313, 1, 504, 264, 285, 0, 280, 272, 285, 285, 285,
+  29, 157, 19, 285, 285, 0, 1, 0, 0, 288, 285, 14,
+  285, 0, 29, 98, 19, 1804, 857, 14, 857, 854, 29, 1889,
+  1923, 29, 144, 157, 29, 139, 29, 129, 19, 0, 1804, 1889,
+  1832, 144, 854, 1832, 854, 29, 1889, 1046, 1923, 1804, 144, 1832,
+  1804, 1017, 854, 854, 1804, 854, 1889, 1928, 1923, 1889, 29, 0,
+  1804, 854, 1804, 1923, 1118, 887, 0, 288, 854, 1889, 841, 0,
+  1804, 0, 854, 887, 887, 0, 0, 0, 0, 887, 854, 285,
+  854, 841, 269, 887, 870, 841, 870, 870, 887, 272, 887, 0,
+  272, 887, 887, 272, 887, 887, 857, 285, 854, 0, 313, 841,
+  841, 285, 313, 857, 285, 0, 313, 0, 841, 857, 0, 313,
+  0, 854, 854, 272, 29, 985, 0, 854, 98, 181, 285, 272,
+  0, 841, 0, 4, 1872, 208, 1804, 144, 1872, 857, 144, 208,
+  29, 29, 98, 841, 0, 0, 19, 42, 144, 857, 995, 870,
+  0, 854, 0, 181, 854, 857, 181, 208, 42, 387, 19, 29,
+  857, 291, 32, 0, 0, 857, 0, 269, 288, 854, 854, 854,
+  313, 29, 0, 208, 208, 0, 32, 841, 1835, 0, 32, 42,
+  382, 208, 288, 134, 841, 313, 32, 0, 0, 551, 288, 0,
+  29, 0, 0, 0, 157, 4, 0, 208, 857, 285, 313, 0,
+  285, 280, 0, 285, 288, 19, 4, 870, 841, 291, 269, 152,
+  1, 157, 208, 32, 0, 399, 32, 272, 0, 937, 42, 29,
+  0, 534, 269, 285, 1933, 841, 463, 0, 1835, 887, 0, 29,
+  0, 285, 288, 288, 0, 285, 64, 841, 313, 313, 0, 29,
+  129, 0, 29, 313, 313, 29, 338, 272, 42, 313, 0, 857,
+  272, 0, 32, 272, 857, 272, 857, 887, 288, 285, 29, 0,
+  0, 1476, 32, 272, 841, 0, 313, 0, 272, 0, 272, 280,
+  0, 4, 81, 0, 728, 32, 272, 272, 285, 32, 841, 285,
+  285, 285, 0, 269, 285, 0, 157, 0, 285, 272, 0, 1804,
+  285, 313, 157, 29, 0, 1804, 313, 285, 0, 144, 412, 0,
+  1804, 291, 29, 1906, 1804, 285, 4, 0, 1804, 285, 285, 529,
+  427, 208, 291, 0, 1804, 841, 285, 0, 285, 0, 313, 4,
+  0, 285, 280, 0, 288, 0, 1804, 0, 0, 338, 285, 0,
+  1804, 1804, 680, 338, 0, 937, 854, 854, 288, 841, 0, 0,
+  1807, 29, 0, 1835, 0, 399, 272, 1807, 285, 471, 0, 0,
+  0, 285, 0, 285, 285, 0, 285, 285, 285, 285, 32, 285,
+  313, 285, 333, 313, 1835, 0, 1940, 291, 285, 343, 4, 29,
+  0, 4, 280, 0, 29, 280, 285, 288, 0, 504, 272, 29,
+  857, 0, 1395, 399, 272, 0, 288, 288, 0, 208, 841, 0,
+  288, 0, 887, 857, 1118, 887, 1889, 857, 854, 1889, 887, 887,
+  272, 29, 1, 29, 1636, 0, 0, 0, 0, 272, 1901, 0,
+  29, 157, 857, 4, 0, 887, 272, 0, 272, 841, 272, 0,
+  387, 272, 887, 208, 0, 509, 285, 285, 887, 1807, 208, 272,
+  0, 272, 0, 272, 288, 313, 841, 0, 0, 857, 29, 29,
+  288, 29, 0, 0, 285, 288, 288, 4, 269, 0, 399, 288,
+  0, 0, 4, 285, 272, 841, 272, 1947, 285, 841, 0, 272,
+  1835, 285, 887, 854, 857, 887, 887, 1838, 29, 387, 157, 0,
+  857, 291, 208, 288, 272, 0, 285, 1, 1807, 844, 42, 285,
+  285, 29, 854, 0, 272, 857, 29, 285, 0, 387, 285, 854,
+  0, 854, 399, 854, 157, 854, 288, 1867, 288, 399, 854, 854,
+  288, 841, 4, 288, 0, 269, 844, 1832, 0, 854, 1804, 144,
+  504, 841, 844, 854, 854, 0, 144, 387, 0, 1118, 285, 387,
+  285, 0, 272, 0, 272, 1434, 0, 0, 0, 208, 854, 841,
+  1827, 285, 208, 854, 887, 0, 841, 1807, 841, 887, 399, 841,
+  887, 0, 1832, 29, 288, 844, 887, 272, 887, 887, 1807, 887,
+  272, 1807, 0, 285, 29, 0, 399, 0, 272, 285, 0, 272,
+  0, 285, 285, 0, 0, 288, 285, 0, 1804, 144, 288, 29,
+  1804, 1832, 728, 285, 285, 1807, 0, 0, 1807, 0, 0, 0,
+  0, 0, 29, 1807, 399, 313, 4, 1807, 291, 1956, 0, 0,
+  0, 854, 1804, 1807, 0, 0, 1807, 29, 0, 4, 937, 0,
+  1807, 0, 1961, 1807, 32, 288, 1804, 42, 0, 1961, 285, 841,
+  4, 157, 285, 857, 29, 269, 857, 288, 288, 29, 4, 285,
+  857, 841, 285, 0, 841, 937, 0, 285, 144, 844, 0, 264,
+  0, 940, 0, 841, 288, 288, 208, 272, 857, 857, 841, 288,
+  857, 272, 0, 841, 288, 29, 288, 272, 1804, 937, 937, 288,
+  288, 4, 288, 1971, 937, 1804, 870, 0, 1966, 296, 1966, 0,
+  0, 272, 181, 272, 1832, 1118, 272, 841, 0, 0, 841, 19,
+  857, 857, 0, 0, 288, 1, 1832, 504, 841, 0, 1804, 285,
+  1804, 854, 29, 1434, 288, 0, 887, 0, 0, 841, 841, 841,
+  0, 1085, 857, 29, 0, 272, 841, 0, 1804, 1804, 4, 4,
+  844, 0, 1807, 269, 0, 0, 57, 0, 269, 1804, 1807, 288,
+  0, 1804, 1827, 841, 272, 1835, 841, 1804, 1804, 1804, 288, 887,
+  1804, 272, 272, 1804, 288, 0, 288, 32, 0, 288, 272, 1832,
+  0, 0, 0, 4, 29, 0, 0, 288, 1807, 0, 29, 1804,
+  288, 42, 0, 0, 0, 288, 0, 29, 0, 288, 32, 4,
+  4, 285, 0, 0, 272, 1796, 288, 42, 831, 1832, 387, 844,
+  0, 0, 285, 854, 288, 272, 0, 940, 288, 399, 285, 285,
+  285, 0, 0, 857, 288, 285, 0, 288, 940, 272, 313, 0,
+  29, 288, 4, 0, 285, 0, 208, 857, 291, 115, 285, 870,
+  857, 157, 985, 285, 841, 285, 0, 291, 0, 285, 0, 285,
+  0, 0, 0, 1807, 285, 940, 0, 285, 285, 0, 0, 854,
+  0, 1807, 296, 0, 937, 285, 288, 32, 841, 288, 0, 288,
+  937, 285, 937, 1815, 937, 0, 157, 0, 32, 0, 937, 313,
+  854, 0, 1118, 208, 0, 0, 152, 940, 0, 844, 854, 29,
+  0, 854, 841, 841, 272, 0, 29, 272, 0, 854, 0, 288,
+  313, 0, 285, 285, 313, 343, 269, 285, 285, 0, 208, 42,
+  269, 551, 280, 940, 4, 0, 313, 291, 1, 0, 29, 285,
+  285, 288, 285, 288, 0, 0, 144, 285, 399, 181, 288, 285,
+  313, 208, 285, 857, 272, 64, 313, 285, 181, 333, 1862, 285,
+  144, 0, 0, 404, 0, 0, 272, 42, 0, 504, 285, 0,
+  208, 887, 1476, 841, 285, 0, 285, 0, 1976, 321, 0, 29,
+  937, 841, 4, 285, 288, 14, 42, 0, 29, 285, 29, 14,
+  29, 1872, 937, 0, 181, 1115, 0, 0, 0, 841, 1, 157,
+  1872, 29, 208, 208, 129, 29, 0, 129, 0, 0, 0, 1850,
+  0, 1804, 0, 4, 1872, 854, 291, 285, 0, 387, 29, 1107,
+  1889, 841, 285, 841, 0, 269, 0, 4, 841, 841, 1804, 208,
+  285, 0, 0, 316, 181, 1889, 343, 285, 1889, 285, 854, 0,
+  313, 1835, 0, 854, 854, 139, 0, 854, 1297, 854, 0, 0,
+  0, 0, 887, 181, 64, 272, 157, 157, 0, 0, 272, 575,
+  208, 29, 157, 285, 291, 208, 285, 269, 291, 285, 29, 313,
+  0, 29, 0, 208, 313, 285, 285, 1046, 854, 1414, 1928, 0,
+  857, 0, 1, 181, 144, 0, 857, 1804, 0, 1979, 854, 0,
+  313, 208, 288, 313, 29, 288, 1804, 208, 399, 285, 0, 0,
+  0, 0, 0, 29, 144, 857, 1807, 1804, 0, 857, 854, 64,
+  854, 129, 152, 857, 208, 854, 1, 854, 288, 1118, 841, 152,
+  0, 1804, 1804, 854, 0, 365, 887, 0, 870, 841, 285, 841,
+  887, 288, 0, 313, 288, 0, 857, 841, 887, 841, 857, 296,
+  0, 272, 272, 288, 0, 272, 272, 288, 272, 29, 272, 272,
+  1118, 0, 272, 1263, 854, 272, 272, 887, 1161, 854, 272, 985,
+  288, 0, 313, 288, 313, 854, 0, 288, 0, 887, 19, 1872,
+  0, 272, 272, 157, 0, 29, 181, 313, 29, 29, 291, 129,
+  29, 0, 29, 0, 0, 937, 0, 285, 1804, 0, 1804, 144,
+  14, 269, 0, 14, 29, 288, 285, 208, 1872, 4, 208, 1872,
+  14, 841, 1872, 288, 0, 285, 1804, 0, 1872, 404, 1872, 0,
+  208, 509, 208, 0, 940, 29, 0, 288, 14, 1804, 313, 0,
+  1297, 313, 680, 0, 0, 19, 288, 42, 98, 272, 1872, 1,
+  157, 208, 272, 0, 223, 208, 1872, 0, 288, 208, 4, 208,
+  0, 29, 313, 313, 1850, 4, 1804, 0, 4, 29, 0, 0,
+  4, 333, 1804, 285, 269, 0, 208, 0, 0, 313, 338, 313,
+  288, 0, 0, 343, 313, 0, 313, 0, 0, 285, 29, 208,
+  1804, 280, 382, 0, 0, 0, 404, 649, 29, 285, 937, 208,
+  404, 0, 208, 0, 1872, 1804, 42, 0, 280, 288, 144, 285,
+  382, 208, 0, 269, 937, 29, 0, 1984, 144, 1835, 208, 19,
+  280, 4, 4, 208, 285, 32, 285, 29, 463, 29, 1804, 0,
+  313, 1889, 1804, 0, 14, 1838, 1832, 854, 1835, 1872, 857, 313,
+  285, 857, 1889, 857, 0, 1889, 1827, 1804, 1989, 264, 1804, 181,
+  0, 29, 1822, 1804, 1838, 208, 0, 0, 29, 1889, 0, 29,
+  1804, 0, 313, 1, 29, 129, 857, 144, 1804, 0, 1889, 854,
+  144, 1889, 157, 0, 4, 1, 1827, 0, 144, 1804, 1889, 1889,
+  29, 1827, 0, 0, 1889, 1889, 208, 29, 1804, 857, 857, 0,
+  854, 1889, 0, 854, 857, 0, 29, 844, 288, 4, 870, 144,
+  129, 854, 854, 854, 854, 870, 857, 854, 1994, 854, 844, 4,
+  857, 844, 370, 0, 601, 285, 1292, 857, 857, 870, 4, 844,
+  42, 857, 857, 0, 0, 857, 857, 0, 19, 854, 857, 857,
+  4, 0, 854, 937, 285, 857, 857, 313, 313, 144, 157, 857,
+  272, 0, 272, 841, 854, 0, 29, 0, 181, 0, 0, 0,
+  0, 208, 144, 1872, 29, 157, 0, 937, 272, 42, 14, 29,
+  208, 0, 144, 144, 313, 29, 285, 382, 4, 0, 29, 285,
+  144, 0, 0, 29, 0, 865, 0, 0, 285, 841, 0, 0,
+  29, 285, 937, 129, 144, 0, 29, 29, 285, 29, 285, 937,
+  1999, 29, 313, 29, 144, 129, 157, 937, 208, 29, 285, 269,
+  841, 144, 29, 937, 285, 0, 937, 857, 937, 29, 937, 29,
+  29, 841, 29, 285, 387, 0, 0, 1872, 139, 0, 524, 288,
+  0, 937, 288, 0, 1832, 0, 285, 139, 272, 208, 285, 291,
+  857, 285, 144, 399, 181, 285, 285, 285, 0, 0, 831, 0,
+  157, 0, 291, 272, 0, 32, 0, 0, 313, 280, 272, 313,
+  157, 285, 0, 857, 285, 144, 0, 313, 313, 1804, 0, 29,
+  181, 4, 0, 1080, 0, 208, 19, 1804, 208, 937, 0, 387,
+  789, 285, 285, 0, 208, 937, 208, 937, 181, 343, 0, 1889,
+  0, 1832, 857, 649, 0, 285, 0, 285, 649, 0, 208, 0,
+  313, 0, 0, 0, 1835, 0, 181, 316, 208, 285, 313, 0,
+  157, 857, 313, 1796, 985, 841, 288, 14, 152, 14, 181, 382,
+  288, 29, 288, 14, 288, 288, 134, 285, 509, 0, 288, 29,
+  181, 387, 0, 29, 857, 857, 937, 1046, 0, 285, 841, 29,
+  0, 272, 854, 313, 129, 272, 208, 854, 313, 285, 841, 857,
+  272, 269, 285, 0, 285, 0, 0, 399, 857, 285, 0, 0,
+  0, 0, 272, 854, 841, 854, 0, 509, 0, 857, 857, 208,
+  29, 4, 857, 857, 81, 857, 854, 857, 288, 313, 144, 0,
+  0, 0, 0, 288, 0, 313, 144, 887, 382, 181, 1149, 313,
+  857, 285, 0, 0, 857, 0, 291, 1832, 208, 285, 291, 0,
+  285, 0, 29, 285, 285, 285, 285, 288, 157, 2004, 208, 285,
+  0, 285, 0, 288, 285, 937, 288, 870, 854, 854, 0, 857,
+  19, 0, 857, 844, 887, 937, 937, 0, 181, 181, 0, 285,
+  0, 285, 272, 854, 0, 0, 0, 157, 0, 0, 291, 285,
+  333, 854, 285, 285, 285, 854, 288, 285, 291, 0, 285, 854,
+  285, 343, 29, 0, 272, 0, 29, 887, 841, 0, 0, 854,
+  285, 841, 841, 0, 887, 29, 1118, 857, 0, 841, 870, 0,
+  844, 0, 4, 940, 940, 841, 841, 887, 887, 841, 0, 272,
+  887, 887, 285, 272, 0, 841, 313, 857, 857, 841, 288, 937,
+  887, 288, 857, 841, 0, 0, 841, 285, 887, 841, 887, 0,
+  841, 841, 937, 0, 841, 1686, 841, 940, 937, 841, 0, 937,
+  940, 0, 0, 288, 288, 0, 313, 841, 857, 870, 854, 940,
+  181, 857, 0, 841, 0, 272, 0, 296, 887, 1434, 841, 887,
+  857, 0, 887, 841, 0, 887, 272, 288, 0, 841, 1434, 887,
+  0, 0, 0, 854, 0, 0, 0, 0, 0, 272, 841, 844,
+  1118, 0, 854, 0, 854, 288, 285, 1161, 0, 0, 181, 29,
+  0, 0, 857, 0, 313, 288, 1161, 0, 857, 29, 940, 285,
+  887, 844, 288, 288, 288, 940, 0, 854, 841, 0, 288, 285,
+  841, 0, 387, 285, 285, 2011, 0, 0, 940, 291, 427, 285,
+  313, 291, 483, 285, 841, 285, 0, 208, 291, 280, 129, 0,
+  285, 0, 0, 0, 937, 291, 14, 285, 285, 269, 937, 857,
+  14, 29, 42, 29, 0, 29, 841, 288, 870, 870, 208, 208,
+  857, 272, 42, 857, 471, 288, 857, 4, 0, 857, 870, 0,
+  0, 285, 2018, 4, 285, 471, 857, 14, 29, 854, 285, 887,
+  940, 285, 887, 0, 841, 841, 940, 288, 940, 285, 940, 32,
+  887, 841, 887, 313, 0, 32, 208, 940, 0, 0, 208, 0,
+  285, 14, 29, 854, 1095, 64, 870, 29, 0, 0, 269, 1832,
+  0, 285, 208, 4, 29, 285, 280, 285, 0, 0, 285, 280,
+  157, 1727, 291, 32, 0, 0, 144, 4, 272, 285, 285, 291,
+  139, 208, 144, 4, 343, 208, 471, 32, 0, 285, 338, 313,
+  285, 0, 937, 285, 32, 144, 854, 338, 313, 32, 0, 42,
+  285, 32, 857, 144, 857, 0, 0, 0, 857, 313, 870, 857,
+  1144, 857, 1144, 208, 1441, 0, 0, 857, 208, 0, 387, 857,
+  0, 412, 285, 1441, 841, 42, 857, 0, 0, 399, 0, 285,
+  4, 1144, 1297, 313, 0, 789, 29, 313, 0, 313, 285, 854,
+  285, 29, 338, 272, 285, 285, 208, 471, 940, 280, 272, 887,
+  272, 285, 280, 285, 272, 288, 313, 285, 0, 291, 285, 313,
+  280, 285, 285, 333, 208, 841, 343, 940, 4, 338, 285, 0,
+  0, 4, 208, 285, 0, 144, 272, 29, 887, 0, 844, 272,
+  854, 0, 985, 288, 313, 841, 0, 29, 313, 0, 42, 272,
+  313, 313, 29, 272, 288, 0, 0, 338, 272, 1118, 288, 272,
+  29, 272, 288, 887, 2025, 1476, 887, 1476, 887, 841, 0, 1085,
+  841, 0, 841, 985, 313, 504, 313, 841, 1012, 288, 412, 280,
+  399, 313, 272, 0, 0, 29, 854, 841, 272, 272, 857, 0,
+  0, 285, 0, 0, 272, 841, 272, 144, 157, 280, 181, 1407,
+  0, 285, 29, 857, 288, 4, 887, 0, 272, 1085, 1476, 887,
+  285, 0, 0, 32, 0, 32, 399, 285, 272, 0, 857, 42,
+  291, 144, 272, 285, 285, 291, 285, 285, 940, 0, 841, 0,
+  0, 887, 841, 272, 841, 841, 887, 272, 887, 1319, 29, 841,
+  887, 285, 887, 887, 841, 288, 19, 288, 29, 857, 0, 288,
+  288, 272, 887, 841, 288, 887, 29, 1804, 1807, 285, 208, 144,
+  288, 1807, 841, 285, 0, 285, 0, 0, 285, 1804, 841, 854,
+  841, 0, 0, 1046, 285, 0, 1807, 1807, 208, 0, 288, 285,
+  1807, 399, 0, 0, 382, 208, 0, 0, 291, 291, 857, 0,
+  208, 285, 291, 285, 1804, 0, 1807, 1804, 32, 0, 280, 0,
+  1807, 144, 269, 288, 288, 181, 0, 29, 181, 1804, 1807, 285,
+  0, 1804, 1804, 19, 2034, 0, 288, 0, 0, 1807, 285, 1804,
+  181, 0, 144, 288, 313, 0, 208, 285, 269, 509, 857, 285,
+  208, 280, 208, 285, 313, 1832, 0, 370, 144, 269, 291, 269,
+  291, 313, 144, 551, 285, 285, 0, 42, 269, 0, 129, 4,
+  288, 854, 285, 288, 4, 1118, 0, 208, 122, 338, 870, 285,
+  1843, 0, 0, 0, 264, 841, 841, 0, 0, 313, 0, 0,
+  272, 841, 157, 0, 0, 1835, 887, 272, 272, 841, 841, 333,
+  285, 288, 0, 0, 29, 285, 313, 937, 272, 269, 272, 0,
+  313, 387, 98, 29, 937, 313, 208, 288, 288, 288, 144, 937,
+  29, 157, 0, 272, 208, 157, 937, 29, 272, 857, 296, 285,
+  937, 1118, 841, 64, 0, 288, 313, 0, 152, 0, 272, 0,
+  272, 272, 841, 841, 1324, 857, 0, 854, 208, 181, 144, 940,
+  288, 288, 288, 854, 422, 32, 285, 789, 208, 272, 343, 144,
+  288, 288, 2039, 288, 285, 313, 313, 285, 0, 285, 0, 0,
+  0, 29, 272, 272, 272, 272, 272, 841, 0, 29, 841, 157,
+  841, 0, 0, 208, 0, 887, 272, 841, 575, 0, 272, 887,
+  0, 985, 264, 29, 0, 157, 285, 0, 4, 313, 1112, 0,
+  264, 29, 4, 4, 1872, 152, 1877, 181, 139, 1832, 285, 264,
+  285, 14, 4, 291, 333, 1804, 0, 1804, 841, 144, 0, 285,
+  129, 1872, 0, 144, 1872, 1804, 1804, 387, 937, 0, 517, 1872,
+  285, 0, 0, 1872, 1872, 29, 1012, 285, 313, 1835, 841, 1804,
+  0, 1804, 937, 841, 1804, 285, 285, 4, 29, 0, 14, 575,
+  269, 1804, 0, 208, 2048, 32, 208, 285, 4, 288, 1872, 0,
+  208, 0, 1804, 338, 0, 471, 1850, 0, 0, 291, 29, 32,
+  0, 291, 285, 208, 4, 19, 0, 285, 4, 0, 208, 343,
+  387, 0, 285, 0, 0, 0, 0, 841, 1804, 0, 0, 1804,
+  1872, 208, 285, 208, 0, 1872, 29, 1804, 0, 0, 272, 29,
+  1872, 0, 841, 0, 1804, 937, 29, 1804, 333, 208, 0, 1804,
+  0, 1889, 2053, 0, 4, 0, 313, 157, 181, 1872, 152, 1872,
+  1804, 157, 857, 937, 144, 937, 857, 29, 29, 1872, 1804, 857,
+  208, 841, 1872, 841, 857, 1923, 42, 4, 29, 1928, 1804, 841,
+  1804, 1112, 129, 854, 4, 181, 1804, 285, 1297, 181, 288, 29,
+  0, 0, 285, 0, 285, 0, 1804, 857, 208, 19, 29, 1889,
+  1804, 285, 1889, 1889, 29, 913, 1804, 1889, 857, 238, 857, 1889,
+  1889, 854, 1804, 1835, 1889, 1804, 1118, 285, 1804, 129, 285, 0,
+  285, 285, 841, 1804, 887, 285, 841, 841, 0, 285, 870, 841,
+  841, 285, 285, 0, 841, 887, 0, 841, 313, 313, 0, 841,
+  1691, 285, 841, 841, 857, 285, 841, 841, 272, 272, 285, 288,
+  144, 841, 272, 272, 208, 1118, 841, 32, 272, 152, 841, 313,
+  0, 272, 887, 29, 157, 42, 288, 14, 272, 0, 288, 854,
+  1, 288, 985, 208, 29, 0, 841, 288, 29, 940, 19, 29,
+  313, 208, 272, 285, 841, 0, 98, 144, 29, 4, 29, 841,
+  1, 387, 0, 29, 1850, 1832, 285, 1835, 412, 285, 181, 841,
+  1835, 29, 841, 285, 285, 0, 285, 291, 1835, 269, 285, 157,
+  14, 288, 285, 313, 29, 1807, 285, 285, 0, 0, 29, 288,
+  0, 1804, 285, 285, 937, 313, 313, 1804, 0, 129, 1804, 264,
+  291, 81, 841, 0, 14, 1872, 269, 857, 291, 313, 509, 285,
+  0, 0, 285, 29, 280, 313, 0, 285, 517, 313, 313, 208,
+  144, 2060, 0, 0, 0, 0, 208, 1807, 29, 0, 29, 0,
+  0, 0, 313, 1804, 269, 1838, 129, 1872, 0, 1804, 399, 1804,
+  1804, 129, 19, 1804, 841, 1804, 29, 1, 0, 1504, 0, 1804,
+  1872, 0, 0, 887, 1804, 870, 0, 1804, 841, 1263, 288, 0,
+  181, 272, 854, 0, 208, 32, 399, 0, 208, 288, 1832, 940,
+  0, 272, 857, 272, 844, 887, 1263, 1, 2067, 504, 144, 857,
+  288, 841, 0, 208, 887, 0, 0, 272, 841, 887, 144, 870,
+  509, 870, 841, 1476, 291, 0, 0, 0, 42, 1476, 0, 313,
+  841, 280, 313, 1, 1, 387, 0, 157, 1, 32, 841, 285,
+  0, 0, 841, 854, 285, 1804, 29, 285, 1804, 1832, 0, 285,
+  285, 0, 157, 0, 937, 0, 1804, 841, 144, 288, 291, 1804,
+  0, 0, 288, 422, 313, 0, 854, 288, 1835, 1835, 1804, 0,
+  291, 338, 0, 0, 937, 0, 1872, 2011, 0, 0, 937, 0,
+  29, 1804, 0, 0, 0, 0, 1872, 0, 285, 1804, 0, 0,
+  208, 0, 285, 285, 285, 285, 1827, 1804, 343, 1804, 285, 343,
+  129, 1872, 1838, 841, 841, 288, 0, 1804, 841, 285, 0, 0,
+  0, 0, 937, 0, 1804, 841, 0, 841, 208, 0, 1923, 854,
+  937, 841, 854, 144, 841, 288, 0, 29, 1872, 29, 272, 1850,
+  0, 1804, 0, 1850, 1906, 285, 29, 4, 288, 1835, 0, 29,
+  272, 1, 181, 272, 0, 285, 0, 288, 288, 841, 285, 280,
+  4, 272, 313, 0, 841, 42, 285, 4, 0, 285, 0, 272,
+  115, 42, 0, 0, 288, 14, 42, 0, 144, 272, 288, 0,
+  285, 288, 509, 1872, 0, 29, 157, 42, 42, 115, 288, 285,
+  0, 285, 285, 841, 841, 32, 0, 1804, 0, 285, 288, 208,
+  285, 0, 285, 1804, 285, 157, 4, 1804, 98, 725, 857, 1804,
+  1872, 313, 285, 857, 288, 1804, 272, 387, 208, 272, 285, 288,
+  285, 509, 427, 313, 841, 399, 0, 985, 857, 857, 272, 285,
+  208, 841, 857, 208, 285, 0, 854, 0, 272, 29, 272, 857,
+  144, 288, 272, 0, 0, 841, 272, 841, 272, 0, 887, 291,
+  854, 0, 285, 272, 272, 857, 29, 0, 854, 288, 285, 0,
+  0, 272, 285, 836, 285, 4, 0, 0, 2072, 296, 272, 857,
+  272, 0, 0, 272, 272, 288, 887, 0, 272, 854, 288, 272,
+  887, 288, 4, 4, 144, 0, 285, 14, 285, 313, 285, 272,
+  285, 313, 887, 208, 29, 399, 313, 288, 288, 1118, 269, 285,
+  857, 841, 841, 272, 208, 4, 181, 382, 857, 0, 857, 854,
+  269, 0, 857, 285, 285, 269, 285, 181, 272, 841, 841, 841,
+  285, 0, 841, 841, 0, 841, 857, 857, 272, 285, 841, 887,
+  1112, 870, 841, 857, 313, 857, 0, 0, 313, 313, 857, 857,
+  841, 0, 857, 0, 854, 841, 0, 313, 0, 725, 313, 285,
+  285, 1471, 272, 854, 272, 157, 288, 940, 288, 272, 19, 857,
+  272, 208, 0, 0, 272, 1118, 940, 0, 42, 887, 1118, 272,
+  0, 870, 857, 0, 0, 0, 854, 285, 0, 857, 313, 854,
+  157, 0, 854, 288, 1434, 288, 288, 29, 288, 288, 291, 343,
+  285, 399, 0, 64, 0, 208, 471, 157, 272, 19, 285, 285,
+  14, 285, 1807, 0, 0, 29, 19, 291, 157, 139, 0, 14,
+  288, 0, 115, 0, 841, 0, 272, 313, 789, 313, 789, 14,
+  64, 285, 1476, 1636, 129, 272, 285, 181, 285, 181, 333, 0,
+  656, 285, 870, 937, 1426, 841, 0, 4, 285, 288, 4, 285,
+  285, 0, 139, 285, 0, 285, 285, 4, 280, 285, 285, 1835,
+  1906, 0, 285, 208, 841, 29, 1, 285, 1804, 32, 0, 285,
+  285, 285, 285, 1877, 313, 29, 280, 285, 0, 285, 285, 2077,
+  285, 841, 0, 841, 1872, 937, 157, 29, 29, 144, 0, 0,
+  1832, 343, 0, 1872, 144, 1872, 269, 29, 0, 870, 1804, 29,
+  144, 285, 144, 0, 29, 854, 144, 208, 0, 144, 1804, 1804,
+  29, 181, 1, 1804, 208, 387, 208, 288, 887, 264, 288, 285,
+  0, 0, 313, 0, 0, 0, 1838, 0, 42, 0, 285, 1804,
+  1804, 0, 291, 285, 1877, 285, 1872, 42, 29, 1838, 0, 0,
+  19, 0, 29, 285, 0, 208, 338, 288, 854, 0, 208, 313,
+  0, 208, 29, 174, 343, 0, 0, 42, 288, 1804, 152, 269,
+  0, 285, 0, 1832, 0, 854, 0, 1906, 0, 29, 208, 0,
+  32, 272, 288, 1, 0, 0, 0, 29, 285, 64, 29, 208,
+  288, 338, 29, 0, 285, 157, 29, 291, 285, 19, 269, 285,
+  144, 0, 29, 29, 285, 841, 1804, 29, 264, 338, 1872, 19,
+  0, 0, 288, 404, 19, 285, 0, 29, 4, 1872, 0, 208,
+  272, 157, 887, 272, 272, 32, 504, 0, 144, 272, 122, 42,
+  285, 208, 0, 272, 463, 208, 404, 854, 288, 272, 144, 19,
+  157, 0, 0, 0, 288, 291, 0, 208, 887, 272, 223, 269,
+  285, 4, 285, 285, 29, 129, 29, 0, 208, 32, 285, 208,
+  0, 887, 272, 382, 29, 272, 313, 288, 157, 0, 29, 0,
+  940, 0, 854, 288, 849, 940, 1118, 272, 285, 841, 841, 841,
+  857, 857, 841, 288, 857, 288, 0, 887, 509, 854, 272, 272,
+  272, 208, 272, 181, 272, 887, 288, 272, 0, 887, 887, 0,
+  2084, 399, 887, 887, 288, 0, 288, 0, 14, 0, 887, 887,
+  308, 0, 0, 333, 313, 1832, 32, 0, 1, 0, 269, 19,
+  2093, 98, 269, 29, 14, 0, 285, 0, 0, 0, 288, 144,
+  272, 288, 285, 551, 208, 144, 285, 387, 1872, 285, 285, 0,
+  0, 285, 208, 1976, 208, 285, 29, 313, 208, 841, 285, 288,
+  285, 0, 404, 313, 144, 0, 181, 32, 1884, 841, 269, 32,
+  1827, 844, 32, 841, 1804, 2098, 285, 937, 0, 285, 29, 841,
+  29, 285, 841, 0, 144, 14, 338, 144, 857, 841, 1832, 1911,
+  181, 285, 32, 0, 0, 288, 285, 387, 1832, 285, 1832, 854,
+  1832, 1832, 29, 29, 0, 887, 1832, 1796, 841, 841, 841, 854,
+  1832, 1827, 272, 288, 841, 1832, 841, 841, 1832, 272, 0, 0,
+  0, 0, 29, 836, 157, 1046, 841, 32, 940, 887, 0, 0,
+  841, 285, 1046, 313, 157, 0, 841, 841, 0, 841, 940, 288,
+  0, 0, 940, 285, 4, 841, 412, 0, 1804, 0, 285, 288,
+  1832, 1835, 1835, 42, 14, 1107, 1832, 1832, 0, 1804, 2105, 1832,
+  509, 1832, 288, 1832, 288, 313, 0, 285, 285, 1804, 841, 471,
+  313, 1832, 0, 1911, 1835, 1911, 208, 1911, 937, 1911, 269, 19,
+  1911, 937, 387, 1827, 1911, 1911, 285, 0, 208, 1911, 4, 0,
+  1911, 387, 0, 937, 1976, 937, 1872, 285, 285, 1911, 1911, 937,
+  2110, 1911, 0, 1832, 1835, 1832, 841, 1872, 2119, 1835, 285, 1911,
+  0, 1832, 4, 288, 841, 1976, 1911, 343, 285, 0, 1827, 280,
+  285, 1832, 0, 937, 1804, 412, 285, 285, 841, 280, 291, 285,
+  1872, 841, 285, 285, 272, 29, 291, 2124, 1832, 272, 291, 1872,
+  291, 285, 422, 285, 285, 208, 338, 208, 2138, 313, 288, 208,
+  32, 0, 2131, 291, 0, 1850, 0, 42, 14, 1877, 870, 285,
+  208, 296, 272, 144, 887, 870, 42, 1046, 0, 0, 382, 313,
+  285, 841, 887, 272, 285, 887, 272, 313, 857, 0, 272, 940,
+  288, 208, 0, 42, 313, 387, 313, 0, 208, 0, 940, 2011,
+  288, 0, 313, 2143, 288, 0, 0, 29, 1832, 831, 2150, 208,
+  285, 0, 285, 0, 285, 285, 1804, 0, 29, 841, 0, 288,
+  313, 288, 0, 269, 144, 285, 29, 285, 313, 285, 0, 288,
+  285, 29, 272, 272, 854, 272, 272, 1832, 0, 208, 0, 0,
+  0, 144, 841, 313, 272, 272, 272, 841, 0, 0, 272, 0,
+  857, 0, 313, 0, 841, 857, 940, 1636, 0, 887, 854, 288,
+  181, 841, 841, 841, 313, 272, 841, 285, 288, 29, 940, 288,
+  841, 285, 288, 285, 887, 0, 285, 32, 0, 0, 0, 29,
+  940, 313, 285, 0, 272, 208, 29, 4, 29, 285, 841, 841,
+  208, 285, 857, 285, 887, 144, 285, 0, 0, 0, 285, 64,
+  208, 285, 0, 854, 0, 285, 844, 272, 0, 208, 313, 157,
+  887, 0, 841, 285, 4, 42, 288, 841, 285, 285, 313, 144,
+  1835, 285, 4, 0, 285, 1835, 269, 29, 887, 288, 285, 1850,
+  223, 285, 285, 412, 1324, 0, 0, 280, 1, 308, 280, 29,
+  1804, 181, 19, 285, 157, 857, 382, 1835, 0, 887, 841, 0,
+  870, 831, 313, 313, 857, 0, 841, 269, 4, 841, 198, 841,
+  0, 285, 0, 841, 841, 841, 841, 285, 42, 857, 0, 0,
+  4, 285, 887, 272, 841, 841, 0, 887, 0, 285, 0, 841,
+  841, 854, 144, 272, 0, 181, 870, 887, 870, 857, 841, 288,
+  841, 0, 285, 29, 285, 313, 1118, 841, 4, 313, 285, 0,
+  1292, 841, 887, 0, 0, 841, 313, 0, 0, 0, 313, 313,
+  382, 0, 0, 0, 0, 32, 0, 841, 427, 841, 0, 208,
+  857, 841, 0, 0, 285, 285, 985, 0, 313, 857, 313, 857,
+  985, 285, 857, 0, 857, 0, 208, 1263, 285, 0, 144, 313,
+  1118, 887, 1636, 29, 285, 870, 269, 0, 0, 272, 288, 157,
+  841, 313, 272, 0, 870, 0, 857, 1118, 1156, 181, 1292, 1036,
+  887, 0, 208, 181, 313, 870, 19, 313, 0, 313, 313, 854,
+  0, 0, 288, 313, 313, 29, 313, 313, 2157, 29, 42, 844,
+  1827, 844, 19, 272, 288, 0, 288, 0, 1292, 313, 0, 14,
+  0, 841, 509, 181, 0, 0, 412, 1046, 887, 857, 857, 139,
+  0, 208, 0, 272, 382, 887, 29, 841, 887, 272, 272, 841,
+  841, 0, 0, 0, 0, 0, 288, 272, 0, 76, 288, 144,
+  269, 940, 144, 288, 857, 264, 854, 4, 288, 0, 1807, 288,
+  854, 0, 269, 1815, 208, 269, 0, 208, 32, 32, 4, 4,
+  4, 0, 841, 0, 854, 841, 0, 98, 14, 42, 1118, 285,
+  382, 272, 291, 841, 0, 208, 208, 208, 313, 29, 382, 288,
+  285, 208, 1807, 272, 313, 181, 29, 0, 0, 887, 14, 98,
+  296, 272, 272, 272, 288, 288, 272, 857, 857, 343, 517, 4,
+  288, 857, 208, 288, 333, 1, 32, 313, 269, 0, 0, 285,
+  288, 288, 157, 181, 768, 32, 285, 285, 0, 313, 575, 29,
+  181, 269, 313, 181, 144, 333, 288, 272, 152, 285, 42, 291,
+  285, 272, 887, 387, 285, 285, 280, 272, 0, 0, 0, 404,
+  208, 0, 4, 887, 285, 551, 280, 291, 285, 29, 272, 471,
+  517, 0, 387, 291, 288, 208, 291, 29, 285, 285, 29, 0,
+  1263, 291, 0, 0, 0, 208, 272, 887, 887, 272, 857, 272,
+  19, 1046, 854, 1434, 0, 0, 272, 575, 272, 288, 887, 288,
+  296, 0, 841, 208, 288, 208, 269, 285, 841, 0, 285, 272,
+  887, 575, 4, 0, 288, 272, 0, 0, 288, 857, 285, 887,
+  857, 272, 854, 0, 272, 841, 285, 157, 0, 854, 152, 1835,
+  288, 854, 4, 841, 272, 399, 285, 285, 272, 288, 313, 4,
+  854, 4, 29, 291, 0, 0, 19, 32, 285, 0, 29, 272,
+  269, 343, 272, 0, 1407, 382, 269, 0, 841, 288, 285, 208,
+  0, 288, 29, 272, 285, 841, 940, 940, 387, 1807, 288, 157,
+  844, 2164, 399, 4, 854, 272, 1263, 313, 288, 32, 4, 272,
+  0, 0, 285, 0, 291, 285, 285, 19, 269, 181, 285, 0,
+  296, 870, 285, 208, 272, 1, 288, 1804, 1804, 288, 1827, 870,
+  1, 288, 272, 841, 338, 285, 0, 291, 285, 1115, 144, 0,
+  0, 285, 269, 471, 857, 509, 313, 288, 387, 29, 272, 0,
+  285, 291, 285, 285, 291, 285, 285, 0, 4, 0, 269, 291,
+  291, 208, 0, 272, 269, 0, 348, 422, 228, 857, 285, 1843,
+  313, 285, 288, 313, 0, 285, 313, 857, 2171, 285, 313, 32,
+  208, 285, 0, 0, 291, 0, 29, 285, 285, 313, 285, 285,
+  32, 857, 0, 269, 313, 4, 854, 288, 272, 0, 0, 64,
+  0, 223, 288, 285, 0, 857, 272, 0, 208, 887, 1118, 1118,
+  144, 1118, 272, 288, 288, 333, 0, 0, 375, 288, 382, 857,
+  2178, 288, 280, 1118, 288, 288, 313, 0, 288, 29, 208, 1118,
+  29, 0, 285, 285, 313, 272, 412, 422, 272, 288, 285, 0,
+  285, 285, 313, 0, 42, 42, 0, 0, 2185, 0, 98, 0,
+  1, 1476, 412, 887, 144, 285, 887, 887, 29, 29, 181, 157,
+  285, 0, 338, 144, 887, 0, 285, 404, 382, 208, 14, 0,
+  29, 0, 29, 1807, 0, 1804, 1804, 1807, 0, 0, 1804, 208,
+  0, 0, 29, 1832, 1804, 1804, 288, 269, 313, 517, 4, 1807,
+  14, 144, 2190, 285, 1807, 0, 387, 291, 269, 285, 285, 208,
+  387, 478, 288, 1835, 269, 422, 4, 29, 4, 313, 4, 1537,
+  4, 208, 2195, 285, 1807, 0, 288, 1804, 1054, 4, 1835, 1804,
+  0, 0, 1807, 4, 181, 1, 1835, 208, 1804, 0, 181, 288,
+  272, 272, 272, 857, 0, 272, 1324, 1, 0, 0, 1182, 272,
+  313, 313, 937, 288, 152, 64, 1901, 1, 1804, 0, 98, 841,
+  157, 313, 29, 0, 285, 0, 0, 152, 0, 1835, 288, 1835,
+  4, 208, 1835, 4, 291, 291, 144, 285, 157, 29, 157, 29,
+  291, 387, 291, 0, 313, 272, 280, 32, 0, 272, 29, 1835,
+  1, 0, 1118, 0, 29, 0, 288, 0, 1835, 504, 887, 181,
+  1835, 854, 288, 1804, 157, 208, 4, 1804, 0, 32, 285, 1832,
+  32, 857, 854, 854, 1835, 1434, 2178, 0, 288, 1804, 1807, 463,
+  857, 29, 857, 1872, 29, 285, 0, 1118, 285, 288, 272, 288,
+  0, 1118, 29, 291, 1118, 517, 1324, 0, 291, 463, 285, 0,
+  285, 313, 1807, 0, 0, 29, 841, 29, 0, 313, 285, 404,
+  1804, 1835, 1835, 0, 1727, 291, 285, 463, 412, 0, 4, 0,
+  285, 208, 285, 42, 1804, 338, 285, 0, 285, 1, 1889, 0,
+  870, 1889, 32, 1804, 0, 288, 0, 208, 1832, 157, 269, 285,
+  2200, 1835, 0, 0, 269, 208, 0, 841, 285, 1, 854, 865,
+  1835, 285, 854, 1804, 985, 285, 1838, 0, 285, 208, 139, 1807,
+  841, 1804, 841, 4, 157, 841, 841, 0, 937, 181, 937, 29,
+  841, 288, 29, 285, 1850, 1923, 288, 313, 1804, 0, 19, 285,
+  285, 0, 208, 208, 1804, 208, 285, 1804, 288, 1827, 854, 1835,
+  29, 857, 29, 285, 291, 2150, 0, 857, 144, 208, 509, 382,
+  1804, 272, 14, 1804, 2209, 1804, 841, 1804, 1804, 1804, 0, 1804,
+  208, 1804, 1, 463, 272, 29, 0, 841, 1804, 360, 857, 1804,
+  1804, 4, 387, 272, 0, 841, 4, 0, 285, 841, 288, 288,
+  422, 0, 313, 285, 940, 854, 0, 313, 208, 937, 841, 19,
+  285, 285, 208, 0, 857, 857, 857, 272, 1095, 285, 288, 937,
+  387, 841, 887, 208, 0, 272, 841, 157, 208, 0, 0, 272,
+  887, 0, 272, 509, 854, 0, 0, 285, 841, 288, 285, 208,
+  144, 288, 144, 288, 841, 208, 0, 841, 1804, 19, 0, 0,
+  285, 288, 288, 0, 288, 1804, 0, 0, 4, 387, 0, 1835,
+  1832, 29, 1832, 285, 1832, 387, 4, 1804, 0, 0, 0, 1804,
+  152, 0, 1832, 291, 1872, 0, 1804, 1832, 1804, 1835, 1832, 1827,
+  0, 0, 42, 575, 29, 1804, 1804, 288, 0, 1804, 509, 1804,
+  285, 0, 1832, 1804, 1, 0, 313, 1804, 1832, 0, 181, 841,
+  1872, 1884, 1835, 288, 0, 338, 0, 1804, 0, 0, 0, 208,
+  1804, 285, 0, 29, 1804, 4, 1804, 1872, 0, 313, 42, 1877,
+  1872, 29, 288, 285, 29, 0, 0, 1872, 1270, 854, 1838, 1804,
+  1838, 291, 1804, 841, 0, 0, 29, 2214, 0, 29, 1838, 0,
+  937, 1838, 1804, 841, 1872, 29, 937, 1838, 2119, 1872, 937, 208,
+  841, 841, 1827, 1911, 1804, 0, 422, 29, 0, 1832, 29, 272,
+  1804, 0, 1872, 0, 29, 1835, 291, 1835, 0, 0, 288, 1804,
+  285, 1832, 1872, 269, 285, 0, 0, 1906, 841, 288, 0, 0,
+  313, 0, 841, 887, 144, 29, 0, 0, 0, 0, 841, 841,
+  0, 208, 285, 0, 841, 940, 841, 0, 0, 841, 288, 857,
+  29, 29, 313, 313, 29, 288, 940, 841, 1804, 208, 285, 29,
+  313, 144, 29, 272, 29, 285, 285, 285, 288, 19, 181, 1,
+  387, 1832, 288, 208, 272, 0, 285, 285, 343, 208, 0, 1832,
+  157, 0, 144, 285, 129, 2221, 288, 0, 285, 0, 285, 0,
+  313, 285, 285, 144, 1, 29, 0, 29, 1838, 1804, 0, 29,
+  285, 0, 29, 1832, 1838, 29, 0, 288, 144, 0, 1804, 0,
+  29, 1835, 1872, 399, 0, 937, 181, 29, 0, 1804, 0, 870,
+  129, 0, 129, 272, 0, 1838, 272, 0, 272, 0, 288, 139,
+  288, 0, 144, 0, 313, 14, 313, 887, 313, 504, 940, 288,
+  285, 0, 841, 285, 269, 0, 841, 285, 285, 285, 0, 285,
+  313, 29, 0, 0, 0, 1046, 1263, 285, 272, 940, 0, 288,
+  157, 29, 841, 887, 272, 940, 181, 841, 313, 753, 0, 0,
+  0, 4, 857, 144, 887, 288, 272, 285, 887, 32, 0, 264,
+  887, 841, 0, 269, 296, 854, 887, 313, 1118, 844, 841, 288,
+  288, 841, 272, 844, 285, 208, 854, 272, 343, 285, 1118, 0,
+  0, 288, 285, 1118, 4, 841, 1835, 854, 285, 0, 144, 1118,
+  0, 42, 1118, 285, 483, 854, 412, 285, 0, 280, 208, 285,
+  0, 0, 0, 181, 14, 285, 285, 272, 285, 4, 285, 280,
+  285, 139, 285, 4, 14, 313, 29, 338, 0, 144, 288, 29,
+  233, 272, 4, 1046, 29, 29, 29, 269, 285, 285, 208, 1046,
+  29, 854, 887, 288, 288, 1118, 857, 288, 854, 844, 313, 0,
+  854, 841, 841, 288, 285, 144, 854, 272, 272, 285, 288, 841,
+  313, 870, 857, 857, 288, 285, 985, 285, 854, 854, 272, 0,
+  854, 313, 0, 857, 0, 841, 313, 0, 288, 0, 0, 0,
+  313, 0, 0, 857, 841, 0, 313, 181, 854, 841, 29, 285,
+  841, 272, 841, 285, 0, 870, 841, 387, 288, 841, 887, 0,
+  841, 272, 887, 144, 841, 272, 203, 387, 285, 288, 887, 272,
+  844, 0, 854, 0, 4, 0, 0, 844, 272, 264, 0, 272,
+  0, 0, 0, 1046, 157, 288, 0, 272, 854, 32, 0, 0,
+  313, 285, 272, 0, 29, 0, 288, 0, 272, 1585, 857, 0,
+  280, 887, 940, 841, 288, 841, 285, 272, 272, 313, 98, 0,
+  4, 0, 1, 1827, 64, 29, 181, 272, 0, 0, 857, 29,
+  937, 285, 0, 285, 1804, 14, 64, 1046, 0, 144, 181, 313,
+  285, 0, 333, 870, 1046, 857, 1046, 157, 272, 0, 288, 19,
+  285, 841, 29, 887, 139, 887, 272, 887, 887, 0, 857, 841,
+  272, 887, 1, 1835, 269, 0, 1835, 285, 285, 285, 144, 2119,
+  887, 181, 0, 291, 0, 208, 285, 42, 1804, 285, 0, 285,
+  280, 29, 157, 1073, 285, 2098, 288, 2098, 2228, 1832, 144, 0,
+  0, 1835, 288, 285, 0, 857, 29, 0, 854, 1832, 0, 285,
+  144, 29, 144, 857, 0, 0, 157, 208, 1827, 32, 313, 285,
+  1976, 2233, 1827, 0, 0, 19, 144, 0, 1827, 29, 1835, 387,
+  1827, 1835, 1804, 32, 1832, 1832, 0, 1838, 1832, 0, 1832, 0,
+  208, 0, 29, 0, 0, 1832, 0, 0, 0, 1827, 854, 0,
+  0, 0, 0, 269, 269, 854, 0, 854, 1835, 1804, 841, 4,
+  288, 1832, 0, 0, 4, 0, 1835, 4, 1804, 1804, 387, 280,
+  0, 4, 285, 0, 0, 0, 0, 0, 0, 0, 1877, 0,
+  1804, 0, 0, 288, 2221, 285, 1872, 291, 4, 1835, 0, 1872,
+  288, 32, 285, 208, 285, 4, 0, 1107, 0, 392, 1872, 208,
+  208, 4, 1804, 2098, 2247, 288, 1804, 272, 0, 2240, 0, 1832,
+  1889, 1804, 285, 1804, 1804, 870, 1804, 208, 285, 1872, 1832, 0,
+  0, 32, 1872, 1804, 285, 2150, 1889, 313, 1872, 0, 291, 1832,
+  0, 19, 382, 288, 285, 0, 0, 841, 0, 1976, 313, 0,
+  208, 1804, 313, 854, 348, 4, 208, 841, 1804, 841, 1832, 1911,
+  208, 343, 181, 854, 0, 0, 1832, 0, 0, 841, 208, 1911,
+  0, 2247, 0, 1804, 841, 1832, 1804, 1877, 937, 1838, 1804, 208,
+  285, 313, 0, 1872, 272, 1827, 29, 2233, 0, 313, 2098, 285,
+  288, 0, 280, 42, 937, 0, 382, 382, 841, 0, 0, 144,
+  285, 208, 841, 29, 285, 1, 181, 272, 144, 291, 29, 19,
+  841, 291, 1, 181, 1, 313, 285, 0, 0, 285, 0, 144,
+  0, 285, 285, 0, 285, 285, 1832, 0, 1872, 129, 181, 285,
+  285, 1827, 0, 29, 0, 841, 1827, 1835, 1835, 1838, 208, 29,
+  144, 208, 157, 208, 0, 1889, 181, 64, 313, 1911, 29, 291,
+  285, 29, 0, 285, 1877, 19, 841, 1832, 1, 1838, 841, 208,
+  1804, 0, 1889, 509, 1804, 854, 1835, 1835, 0, 288, 1835, 1832,
+  0, 1832, 1835, 1804, 1804, 841, 1832, 1835, 1804, 0, 1832, 1838,
+  1832, 937, 841, 841, 0, 1838, 1804, 1804, 1923, 1832, 841, 1804,
+  841, 1804, 0, 1838, 841, 0, 0, 2119, 841, 0, 1804, 4,
+  1889, 19, 1804, 1832, 313, 144, 1832, 0, 1835, 0, 1804, 1046,
+  1832, 841, 1835, 0, 0, 1804, 1804, 841, 208, 854, 1804, 208,
+  1832, 1835, 841, 841, 854, 288, 285, 157, 0, 857, 4, 285,
+  854, 0, 857, 272, 854, 285, 854, 29, 269, 208, 0, 854,
+  857, 0, 0, 285, 0, 0, 399, 841, 841, 0, 0, 0,
+  887, 0, 272, 285, 0, 285, 313, 285, 0, 0, 285, 857,
+  42, 313, 854, 857, 0, 841, 288, 870, 0, 0, 1832, 841,
+  313, 1835, 0, 1835, 1434, 1804, 0, 1835, 0, 857, 841, 272,
+  0, 1835, 296, 1804, 272, 1832, 1807, 1923, 1804, 1889, 857, 19,
+  272, 0, 854, 854, 1441, 129, 1804, 854, 857, 296, 1804, 272,
+  854, 272, 1804, 857, 854, 1804, 42, 841, 1804, 854, 2252, 854,
+  1835, 854, 313, 0, 0, 1807, 1923, 1804, 1832, 854, 854, 0,
+  854, 1804, 272, 1804, 1804, 1835, 2257, 854, 1804, 0, 1804, 854,
+  0, 857, 857, 1923, 0, 854, 272, 0, 285, 0, 1804, 0,
+  1046, 144, 272, 1804, 0, 1923, 1832, 1835, 1867, 129, 0, 29,
+  208, 0, 0, 0, 1923, 0, 1804, 417, 0, 1832, 0, 1807,
+  1832, 854, 272, 1804, 0, 0, 854, 1804, 272, 0, 841, 1867,
+  854, 208, 857, 841, 1662, 1804, 272, 841, 2262, 387, 1804, 0,
+  1804, 1832, 1832, 854, 1804, 1832, 1804, 1832, 2267, 1867, 1804, 288,
+  181, 1832, 1807, 1804, 0, 1804, 1804, 1889, 1804, 1804, 2034, 1804,
+  1804, 1827, 854, 0, 1867, 1835, 1832, 1835, 1832, 1804, 1804, 0,
+  1832, 1807, 1804, 854, 1807, 1832, 0, 272, 1832, 285, 1804, 0,
+  1835, 0, 1832, 2267, 1835, 1923, 1804, 1979, 857, 1889, 1804, 0,
+  857, 1923, 1835, 1928, 285, 1804, 0, 1804, 1804, 0, 854, 854,
+  1804, 1804, 1804, 288, 854, 1835, 1807, 1804, 1804, 1804, 1832, 940,
+  0, 208, 857, 285, 1832, 404, 857, 854, 285, 1804, 1804, 285,
+  1822, 0, 1832, 857, 285, 285, 0, 1804, 1822, 0, 0, 0,
+  1838, 42, 1838, 1877, 2272, 937, 841, 1804, 42, 280, 1889, 937,
+  269, 1835, 285, 1804, 1832, 285, 471, 1827, 1832, 0, 0, 19,
+  157, 272, 272, 288, 285, 115, 288, 1832, 0, 29, 0, 841,
+  0, 32, 285, 1872, 29, 144, 1832, 288, 208, 0, 285, 937,
+  471, 0, 937, 2119, 1, 208, 208, 865, 0, 208, 0, 0,
+  841, 29, 1911, 152, 269, 841, 1838, 1832, 1804, 0, 29, 0,
+  0, 0, 1832, 313, 841, 937, 285, 841, 0, 0, 0, 1835,
+  1835, 22, 1804, 841, 0, 841, 285, 1804, 1835, 285, 1835, 2195,
+  291, 1872, 1804, 14, 288, 1889, 1804, 269, 0, 208, 841, 343,
+  836, 285, 841, 1832, 0, 1835, 144, 1838, 937, 0, 1832, 285,
+  1827, 0, 144, 32, 14, 29, 1471, 285, 1835, 0, 285, 1835,
+  291, 387, 427, 29, 0, 285, 1832, 1877, 285, 29, 285, 1832,
+  1827, 285, 857, 32, 1804, 285, 42, 1872, 1835, 1804, 841, 1832,
+  1827, 1835, 29, 42, 937, 1832, 0, 285, 285, 272, 841, 1804,
+  1827, 208, 32, 841, 1928, 387, 0, 1832, 937, 0, 937, 0,
+  32, 288, 285, 32, 208, 0, 471, 285, 32, 285, 1804, 0,
+  285, 0, 291, 285, 157, 208, 285, 0, 313, 208, 313, 291,
+  387, 0, 0, 1804, 285, 208, 1911, 4, 338, 1832, 1867, 1804,
+  0, 313, 313, 208, 1911, 471, 0, 1715, 1867, 285, 382, 285,
+  208, 313, 32, 338, 269, 19, 208, 1832, 854, 0, 0, 0,
+  937, 854, 1832, 208, 208, 4, 333, 0, 0, 0, 1827, 1835,
+  1827, 4, 4, 144, 0, 1872, 4, 387, 285, 1867, 0, 854,
+  1832, 1804, 1872, 1872, 272, 4, 0, 1835, 280, 343, 285, 387,
+  288, 208, 0, 0, 0, 0, 0, 0, 2209, 1835, 2281, 387,
+  208, 1835, 1835, 285, 841, 288, 0, 4, 841, 0, 841, 2286,
+  1090, 854, 854, 0, 1804, 0, 0, 841, 0, 387, 1872, 0,
+  1872, 0, 0, 854, 1827, 0, 0, 4, 208, 0, 42, 404,
+  285, 841, 1835, 4, 1850, 857, 264, 208, 285, 1923, 0, 841,
+  1804, 854, 208, 854, 857, 857, 1835, 854, 854, 1804, 0, 0,
+  1835, 854, 285, 98, 4, 208, 857, 1832, 1835, 285, 157, 854,
+  157, 0, 1889, 1835, 0, 285, 387, 0, 1835, 285, 1804, 2221,
+  285, 285, 29, 399, 285, 0, 285, 0, 343, 313, 285, 0,
+  313, 285, 0, 285, 285, 1804, 1, 288, 1, 14, 0, 285,
+  288, 1872, 285, 280, 29, 1835, 990, 0, 139, 285, 98, 1835,
+  14, 313, 29, 157, 285, 0, 29, 1838, 857, 1872, 285, 285,
+  1827, 29, 399, 208, 285, 269, 285, 4, 285, 0, 0, 0,
+  504, 29, 181, 0, 0, 42, 29, 0, 0, 2291, 269, 857,
+  1835, 0, 841, 228, 144, 333, 285, 0, 0, 313, 275, 285,
+  1804, 338, 313, 285, 32, 285, 285, 0, 0, 841, 157, 1832,
+  285, 0, 1827, 313, 285, 285, 288, 0, 285, 1911, 208, 181,
+  0, 1889, 857, 0, 0, 937, 1976, 29, 1827, 1835, 0, 1832,
+  2301, 1804, 0, 1923, 2296, 1804, 29, 1832, 854, 157, 1832, 2247,
+  0, 1832, 1835, 854, 854, 857, 1832, 1976, 857, 1832, 2247, 854,
+  19, 1832, 1804, 854, 1832, 1923, 1832, 854, 0, 1832, 1889, 1889,
+  854, 0, 854, 208, 1976, 1827, 0, 0, 1804, 29, 1889, 1832,
+  1835, 854, 0, 857, 1976, 857, 1889, 1835, 857, 857, 1976, 1976,
+  1832, 208, 157, 0, 1889, 1804, 1804, 2247, 1835, 857, 19, 0,
+  208, 857, 29, 29, 1832, 937, 208, 2301, 0, 1832, 857, 1827,
+  0, 1976, 1804, 1832, 29, 1827, 1832, 1832, 32, 0, 1835, 0,
+  0, 288, 1832, 1832, 272, 285, 1832, 0, 0, 841, 857, 857,
+  32, 285, 1832, 857, 854, 857, 857, 272, 1118, 0, 272, 42,
+  0, 841, 288, 0, 887, 841, 887, 285, 887, 272, 0, 870,
+  841, 870, 285, 0, 841, 870, 857, 844, 1046, 841, 313, 857,
+  857, 870, 0, 272, 272, 841, 0, 0, 857, 0, 841, 841,
+  854, 0, 0, 857, 288, 0, 0, 0, 854, 313, 854, 313,
+  854, 0, 1976, 0, 0, 4, 0, 272, 29, 854, 272, 272,
+  841, 285, 144, 313, 272, 285, 144, 854, 144, 841, 0, 844,
+  272, 841, 0, 313, 285, 887, 854, 0, 1, 0, 29, 285,
+  285, 29, 0, 313, 157, 0, 285, 854, 285, 285, 285, 272,
+  272, 285, 122, 288, 0, 1324, 4, 870, 272, 29, 0, 272,
+  1872, 1835, 1804, 285, 1835, 857, 29, 291, 471, 1835, 4, 1850,
+  29, 0, 285, 285, 0, 0, 1804, 285, 0, 285, 0, 269,
+  291, 313, 606, 854, 348, 272, 887, 19, 285, 285, 269, 0,
+  272, 285, 272, 29, 841, 857, 208, 937, 1118, 0, 0, 0,
+  0, 0, 0, 272, 4, 870, 1732, 4, 870, 0, 0, 29,
+  887, 64, 0, 0, 288, 0, 313, 288, 937, 2304, 272, 870,
+  0, 0, 0, 157, 285, 2309, 288, 42, 32, 841, 32, 181,
+  940, 0, 32, 208, 32, 0, 0, 0, 841, 0, 0, 0,
+  857, 29, 157, 29, 29, 42, 208, 42, 181, 285, 0, 0,
+  0, 269, 181, 0, 152, 857, 857, 857, 285, 29, 208, 313,
+  0, 29, 0, 29, 144, 29, 0, 0, 42, 288, 0, 0,
+  0, 285, 857, 1112, 857, 857, 0, 857, 0, 841, 285, 887,
+  887, 285, 272, 0, 4, 0, 0, 152, 32, 313, 841, 841,
+  841, 285, 0, 0, 0, 887, 841, 854, 887, 887, 0, 887,
+  0, 288, 288, 841, 0, 841, 841, 288, 841, 841, 0, 854,
+  0, 0, 313, 208, 0, 285, 288, 0, 841, 285, 0, 0,
+  0, 0, 0, 144, 285, 313, 412, 2312, 313, 288, 0, 269,
+  1, 285, 285, 4, 291, 285, 0, 288, 313, 29, 291, 0,
+  272, 575, 272, 285, 272, 29, 412, 0, 32, 313, 291, 272,
+  285, 208, 313, 272, 285, 841, 854, 854, 4, 1, 887, 0,
+  272, 285, 4, 841, 887, 841, 272, 887, 272, 285, 841, 272,
+  857, 887, 29, 272, 333, 285, 285, 313, 338, 291, 0, 285,
+  272, 0, 1807, 280, 841, 4, 288, 285, 291, 4, 285, 4,
+  1832, 208, 208, 1804, 269, 288, 291, 313, 854, 288, 144, 285,
+  0, 285, 285, 4, 208, 285, 285, 288, 208, 285, 0, 0,
+  288, 288, 0, 285, 1807, 0, 285, 1807, 288, 291, 285, 0,
+  0, 269, 1807, 0, 870, 181, 0, 0, 29, 144, 940, 19,
+  313, 857, 887, 0, 1000, 29, 144, 144, 64, 313, 857, 857,
+  313, 272, 285, 0, 272, 841, 272, 285, 144, 0, 208, 0,
+  288, 463, 0, 940, 0, 272, 1036, 0, 272, 157, 285, 285,
+  285, 272, 0, 0, 841, 0, 285, 208, 0, 841, 272, 29,
+  285, 285, 0, 285, 1810, 333, 181, 0, 0, 291, 19, 285,
+  269, 288, 285, 285, 0, 285, 208, 291, 291, 29, 42, 1118,
+  841, 288, 0, 857, 0, 0, 0, 285, 285, 887, 857, 0,
+  0, 0, 0, 272, 0, 854, 285, 272, 841, 870, 857, 887,
+  0, 272, 285, 841, 937, 870, 0, 0, 285, 291, 272, 0,
+  887, 288, 269, 0, 399, 841, 857, 29, 841, 269, 285, 285,
+  985, 0, 0, 0, 841, 887, 937, 841, 841, 285, 272, 272,
+  0, 4, 157, 841, 272, 288, 0, 29, 269, 0, 0, 841,
+  4, 272, 288, 854, 0, 841, 0, 144, 841, 288, 1118, 407,
+  144, 0, 285, 1, 98, 285, 291, 288, 313, 285, 208, 0,
+  0, 208, 0, 29, 404, 285, 313, 0, 208, 0, 313, 1804,
+  288, 181, 288, 313, 333, 0, 333, 313, 387, 0, 1804, 313,
+  0, 404, 208, 157, 14, 269, 181, 387, 280, 0, 181, 427,
+  14, 0, 517, 285, 0, 313, 937, 509, 29, 0, 285, 288,
+  0, 29, 181, 0, 2319, 157, 0, 14, 129, 387, 285, 14,
+  1, 0, 0, 0, 0, 22, 4, 0, 285, 0, 1, 269,
+  656, 144, 269, 288, 0, 29, 4, 0, 0, 333, 29, 208,
+  0, 29, 29, 42, 0, 208, 0, 269, 129, 404, 2324, 0,
+  122, 269, 0, 29, 181, 29, 0, 144, 157, 0, 0, 404,
+  181, 29, 144, 0, 0, 139, 29, 0, 272, 157, 0, 181,
+  338, 4, 1807, 1807, 387, 129, 1807, 14, 29, 14, 29, 1807,
+  0, 0, 129, 29, 29, 29, 129, 0, 29, 29, 1807, 115,
+  0, 2329, 0, 29, 64, 0, 139, 0, 181, 285, 1807, 0,
+  144, 45, 269, 29, 316, 29, 167, 29, 0, 157, 1, 0,
+  29, 208, 0, 269, 157, 42, 0, 29, 1807, 208, 269, 1807,
+  144, 285, 29, 139, 152, 269, 29, 285, 0, 14, 285, 291,
+  29, 1476, 42, 285, 272, 1085, 264, 19, 854, 288, 857, 19,
+  288, 19, 272, 285, 157, 285, 940, 208, 313, 208, 181, 0,
+  29, 841, 19, 857, 208, 1804, 387, 98, 42, 29, 854, 1877,
+  4, 1877, 19, 288, 32, 208, 14, 887, 144, 1850, 0, 1804,
+  285, 291, 42, 208, 291, 208, 841, 1877, 144, 0, 0, 29,
+  181, 333, 399, 19, 313, 0, 841, 0, 343, 0, 841, 152,
+  841, 0, 854, 0, 208, 313, 1804, 208, 4, 841, 0, 29,
+  285, 0, 157, 0, 937, 0, 1804, 29, 272, 1804, 854, 1835,
+  0, 0, 841, 2336, 0, 181, 288, 1872, 29, 0, 1889, 313,
+  1827, 0, 313, 272, 29, 1872, 129, 144, 0, 181, 0, 4,
+  1804, 4, 285, 157, 272, 0, 288, 29, 404, 14, 208, 29,
+  29, 338, 29, 42, 1804, 831, 0, 32, 285, 1297, 181, 0,
+  29, 0, 144, 181, 0, 288, 854, 1118, 19, 288, 0, 1118,
+  0, 4, 313, 985, 285, 0, 32, 181, 985, 1804, 1872, 0,
+  29, 1850, 272, 1804, 42, 841, 1872, 1835, 1804, 841, 1804, 269,
+  272, 269, 29, 1804, 841, 0, 0, 1872, 1, 1956, 29, 139,
+  269, 1804, 2343, 129, 42, 269, 313, 412, 0, 1804, 0, 285,
+  0, 14, 29, 29, 4, 0, 29, 208, 0, 463, 2048, 208,
+  412, 0, 509, 0, 1807, 280, 841, 269, 841, 285, 1, 0,
+  42, 0, 0, 313, 288, 288, 4, 0, 0, 1, 285, 157,
+  272, 32, 32, 269, 181, 0, 14, 272, 139, 98, 0, 208,
+  157, 427, 291, 272, 0, 288, 19, 285, 887, 870, 0, 29,
+  1476, 4, 1085, 887, 892, 272, 208, 1085, 181, 0, 841, 841,
+  841, 285, 14, 966, 892, 841, 285, 144, 269, 870, 841, 208,
+  1994, 857, 841, 841, 32, 887, 288, 22, 4, 157, 887, 0,
+  0, 841, 29, 208, 29, 0, 1085, 291, 870, 29, 427, 887,
+  285, 841, 29, 887, 29, 0, 208, 285, 0, 1085, 316, 288,
+  0, 29, 144, 841, 291, 288, 288, 4, 269, 29, 509, 157,
+  42, 14, 313, 313, 0, 0, 152, 144, 412, 98, 157, 313,
+  0, 0, 313, 338, 313, 139, 338, 0, 98, 0, 144, 313,
+  208, 208, 0, 42, 313, 0, 144, 412, 269, 313, 139, 313,
+  695, 313, 0, 313, 0, 144, 313, 0, 144, 313, 0, 313,
+  313, 0, 0, 338, 313, 2350, 338, 208, 0, 144, 313, 139,
+  288, 269, 509, 313, 0, 208, 0, 0, 269, 0, 288, 288,
+  313, 313, 144, 98, 313, 144, 313, 338, 0, 338, 0, 0,
+  313, 0, 0, 144, 288, 0, 157, 269, 0, 144, 313, 338,
+  382, 0, 1217, 0, 288, 0, 288, 0, 0, 0, 208, 1796,
+  0, 0, 0, 157, 0, 139, 0, 0, 144, 0, 144, 269,
+  139, 0, 0, 0, 0, 144, 144, 313, 0, 313, 144, 139,
+  313, 1115, 313, 313, 157, 313, 0, 0, 208, 144, 0, 0,
+  144, 269, 98, 139, 42, 313, 0, 313, 144, 0, 338, 857,
+  1835, 144, 288, 144, 1832, 0, 2355, 0, 144, 42, 2355, 288,
+  313, 0, 144, 0, 313, 144, 313, 1832, 313, 2355, 313, 0,
+  269, 313, 0, 985, 338, 313, 313, 0, 144, 844, 313, 0,
+  0, 844, 0, 1832, 854, 269, 0, 313, 313, 1835, 42, 269,
+  0, 313, 269, 313, 269, 288, 844, 854, 844, 1835, 144, 857,
+  1827, 144, 313, 857, 2367, 288, 0, 0, 1046, 844, 2360, 0,
+  313, 0, 854, 2374, 844, 854, 288, 313, 0, 844, 854, 0,
+  313, 157, 313, 288, 0, 0, 144, 1832, 1832, 844, 2381, 288,
+  844, 854, 509, 288, 0, 0, 844, 854, 264, 288, 144, 2384,
+  2384, 0, 2360, 288, 313, 844, 844, 269, 0, 1827, 288, 208,
+  288, 288, 288, 854, 725, 0, 313, 288, 288, 854, 0, 0,
+  269, 269, 0, 313, 1827, 1832, 1832, 313, 1832, 288, 208, 2387,
+  857, 854, 844, 985, 269, 208, 0, 144, 0, 0, 412, 313,
+  288, 288, 0, 313, 313, 854, 854, 1835, 288, 2381, 139, 288,
+  288, 0, 288, 854, 844, 313, 2384, 288, 288, 2392, 0, 844,
+  313, 0, 313, 844, 0, 2384, 844, 42, 844, 2048, 1319, 42,
+  844, 288, 0, 338, 338, 313, 0, 313, 854, 313, 0, 313,
+  313, 0, 288, 269, 313, 844, 0, 288, 831, 1046, 269, 844,
+  854, 338, 144, 854, 0, 208, 2381, 313, 854, 313, 338, 144,
+  313, 313, 313, 288, 313, 1217, 313, 1835, 854, 144, 1161, 208,
+  0, 313, 313, 0, 288, 854, 844, 208, 269, 42, 313, 680,
+  288, 0, 844, 313, 42, 844, 382, 0, 0, 313, 144, 695,
+  1832, 2301, 1832, 288, 2397, 288, 1827, 854, 157, 288, 0, 157,
+  208, 857, 313, 313, 338, 269, 313, 2384, 313, 985, 42, 2381,
+  313, 0, 0, 2384, 313, 857, 2381, 157, 2404, 2381, 2381, 0,
+  2384, 0, 0, 854, 2381, 0, 0, 854, 313, 313, 857, 2416,
+  0, 313, 313, 157, 985, 857, 313, 2409, 338, 2381, 844, 269,
+  208, 288, 269, 313, 42, 844, 857, 42, 0, 2381, 2421, 144,
+  338, 208, 0, 0, 2428, 0, 844, 857, 844, 0, 854, 985,
+  2360, 269, 2381, 985, 288, 144, 0, 0, 288, 0, 0, 157,
+  288, 313, 157, 0, 269, 269, 857, 0, 0, 313, 313, 0,
+  0, 208, 857, 0, 857, 854, 313, 0, 985, 844, 844, 313,
+  854, 269, 0, 857, 844, 509, 208, 1832, 1832, 1832, 313, 854,
+  0, 857, 0, 1832, 857, 313, 1976, 1923, 1832, 854, 0, 1976,
+  1827, 1923, 313, 854, 157, 844, 313, 854, 338, 98, 854, 288,
+  1643, 844, 269, 313, 509, 288, 313, 854, 0, 412, 288, 144,
+  1832, 412, 144, 0, 313, 0, 0, 2360, 338, 854, 144, 854,
+  1832, 42, 0, 157, 338, 269, 1827, 857, 0, 844, 1727, 313,
+  288, 288, 0, 42, 313, 854, 313, 144, 313, 0, 2381, 288,
+  288, 854, 0, 854, 844, 288, 0, 2360, 0, 288, 313, 313,
+  854, 313, 854, 2384, 0, 854, 2384, 0, 854, 2384, 0, 0,
+  313, 0, 0, 854, 313, 313, 144, 0, 844, 269, 144, 1832,
+  854, 288, 0, 0, 854, 857, 288, 844, 857, 844, 857, 1835,
+  0, 139, 1832, 2433, 0, 144, 0, 269, 1827, 2360, 269, 1832,
+  313, 288, 854, 288, 1046, 288, 1046, 0, 288, 854, 1161, 0,
+  854, 854, 0, 269, 208, 854, 854, 269, 854, 463, 2360, 139,
+  844, 0, 412, 2438, 144, 1832, 985, 288, 0, 313, 1835, 1832,
+  1827, 1832, 1827, 854, 854, 2381, 854, 1827, 382, 2381, 288, 288,
+  288, 0, 288, 844, 857, 2392, 288, 313, 1046, 157, 288, 844,
+  1835, 0, 288, 288, 854, 0, 313, 0, 2384, 854, 313, 2384,
+  844, 313, 1832, 844, 288, 0, 42, 854, 844, 854, 844, 2381,
+  144, 857, 1835, 2384, 0, 1832, 208, 2360, 313, 288, 1827, 269,
+  857, 1832, 288, 313, 857, 0, 857, 0, 1832, 208, 857, 144,
+  2381, 1832, 144, 2381, 844, 1832, 0, 2381, 208, 313, 857, 1832,
+  0, 2381, 1681, 2384, 2381, 2381, 2384, 2384, 854, 2381, 2384, 2384,
+  854, 2384, 313, 2381, 2381, 854, 269, 844, 313, 844, 1835, 857,
+  2381, 2381, 2384, 0, 139, 0, 844, 2360, 2392, 1832, 2381, 854,
+  854, 1217, 857, 208, 854, 313, 313, 854, 844, 288, 854, 98,
+  854, 208, 144, 1832, 269, 313, 288, 854, 269, 854, 1832, 844,
+  844, 1832, 854, 0, 0, 0, 1046, 1832, 0, 1835, 288, 338,
+  288, 854, 0, 1832, 144, 144, 1832, 854, 144, 0, 0, 844,
+  208, 844, 98, 844, 208, 42, 854, 854, 157, 0, 144, 854,
+  382, 338, 2392, 0, 0, 1835, 0, 313, 857, 854, 0, 313,
+  139, 313, 269, 1727, 0, 338, 338, 0, 2381, 2416, 854, 288,
+  2416, 2392, 831, 313, 2428, 313, 313, 382, 208, 157, 288, 313,
+  844, 857, 288, 288, 313, 854, 0, 208, 157, 313, 1643, 42,
+  509, 313, 0, 338, 0, 313, 2011, 0, 1827, 157, 338, 0,
+  157, 0, 1832, 854, 1832, 1835, 313, 313, 1643, 1832, 1835, 1832,
+  1832, 857, 854, 854, 854, 0, 0, 854, 288, 0, 0, 42,
+  144, 313, 2381, 2443, 42, 1046, 144, 338, 208, 144, 854, 854,
+  313, 264, 338, 0, 0, 1832, 313, 42, 854, 288, 0, 288,
+  2381, 2416, 288, 854, 854, 269, 2381, 269, 313, 2428, 857, 844,
+  854, 844, 854, 313, 854, 313, 2428, 288, 0, 269, 0, 1835,
+  2448, 269, 2392, 844, 857, 844, 844, 42, 854, 157, 0, 288,
+  338, 0, 0, 1835, 0, 208, 0, 1835, 844, 854, 144, 76,
+  144, 288, 0, 854, 1832, 2247, 854, 1835, 0, 1319, 157, 1832,
+  382, 854, 288, 0, 269, 1115, 1832, 0, 1217, 1923, 854, 144,
+  288, 313, 288, 1832, 2381, 313, 208, 139, 313, 313, 0, 0,
+  313, 313, 313, 313, 0, 313, 42, 0, 313, 313, 313, 0,
+  0, 412, 313, 288, 338, 313, 844, 313, 288, 313, 313, 313,
+  313, 313, 1835, 288, 313, 288, 854, 288, 1923, 313, 313, 0,
+  288, 854, 42, 338, 313, 854, 313, 2404, 854, 854, 0, 0,
+  313, 313, 269, 854, 269, 1835, 857, 0, 0, 0, 139, 313,
+  0, 313, 1835, 98, 288, 269, 313, 288, 1827, 1832, 1835, 0,
+  2455, 0, 144, 1835, 144, 269, 208, 1827, 0, 42, 42, 854,
+  42, 313, 854, 857, 144, 0, 0, 854, 208, 1832, 1832, 144,
+  0, 0, 0, 1832, 1835, 1832, 844, 288, 313, 144, 1827, 857,
+  1832, 288, 1832, 313, 313, 854, 1923, 1835, 1827, 1835, 857, 1832,
+  1923, 854, 1827, 0, 288, 854, 854, 288, 1827, 1827, 1827, 985,
+  1923, 1832, 0, 1827, 1832, 1827, 1827, 1832, 0, 0, 857, 1832,
+  1827, 857, 0, 0, 0, 0, 857, 0, 1832, 857, 1835, 0,
+  1832, 1832, 857, 857, 1976, 0, 854, 1867, 844, 985, 844, 854,
+  0, 0, 857, 288, 844, 157, 42, 0, 0, 844, 854, 844,
+  2350, 1835, 0, 157, 313, 854, 1835, 313, 338, 0, 1835, 0,
+  1835, 313, 1835, 288, 0, 1923, 288, 0, 313, 98, 144, 0,
+  0, 313, 288, 269, 854, 313, 854, 0, 313, 269, 0, 0,
+  0, 1217, 1835, 0, 0, 313, 0, 854, 0, 157, 844, 269,
+  338, 288, 288, 313, 264, 0, 288, 208, 844, 288, 844, 313,
+  844, 844, 854, 0, 313, 1832, 0, 0, 0, 144, 844, 854,
+  0, 98, 857, 0, 0, 1923, 1923, 313, 288, 844, 288, 338,
+  1832, 144, 1046, 144, 144, 144, 1832, 313, 1832, 2360, 1832, 144,
+  404, 1832, 313, 854, 854, 857, 0, 857, 1827, 0, 208, 42,
+  288, 2093, 854, 1827, 2384, 338, 144, 2462, 0, 1827, 2384, 338,
+  2392, 2381, 844, 2384, 313, 844, 0, 2381, 2384, 313, 844, 2384,
+  854, 854, 857, 1832, 1832, 208, 288, 144, 1832, 854, 854, 1832,
+  1832, 2469, 208, 1643, 2387, 1832, 0, 854, 1643, 338, 0, 0,
+  288, 0, 1827, 42, 288, 288, 854, 1832, 208, 857, 1832, 1832,
+  0, 208, 0, 0, 1832, 288, 288, 313, 313, 313, 313, 42,
+  288, 0, 144, 42, 338, 844, 313, 98, 288, 1832, 1832, 0,
+  313, 139, 42, 313, 854, 2381, 313, 0, 854, 208, 313, 139,
+  2428, 313, 0, 269, 144, 2381, 288, 2381, 0, 2381, 854, 0,
+  2476, 313, 857, 1835, 1835, 2381, 0, 2476, 1835, 288, 1832, 0,
+  269, 313, 0, 0, 313, 313, 313, 313, 0, 1832, 144, 2381,
+  208, 2416, 157, 313, 98, 313, 0, 0, 42, 1832, 42, 42,
+  1832, 1827, 1832, 1827, 313, 98, 313, 854, 144, 144, 313, 0,
+  0, 1832, 0, 288, 288, 269, 208, 313, 854, 2384, 144, 338,
+  313, 338, 313, 338, 0, 144, 42, 313, 313, 0, 1827, 1115,
+  208, 1827, 1832, 313, 288, 208, 313, 1827, 0, 2433, 1832, 0,
+  0, 2481, 313, 2416, 313, 144, 288, 0, 831, 313, 0, 2381,
+  1835, 0, 144, 208, 1827, 2381, 0, 0, 313, 313, 288, 2381,
+  382, 313, 2381, 0, 2381, 854, 338, 2428, 2421, 2381, 0, 313,
+  313, 1835, 854, 1835, 854, 269, 1832, 2360, 463, 1832, 2416, 2384,
+  0, 844, 313, 313, 854, 0, 313, 2486, 313, 1832, 1832, 313,
+  144, 313, 2486, 157, 0, 1835, 313, 857, 2381, 1832, 98, 144,
+  313, 1287, 313, 2384, 313, 144, 313, 2381, 854, 844, 313, 857,
+  857, 144, 144, 313, 0, 1832, 208, 1832, 854, 0, 1832, 0,
+  144, 0, 1827, 854, 1827, 857, 313, 1923, 1832, 1832, 857, 1832,
+  98, 1832, 985, 1832, 844, 1835, 1832, 0, 1832, 42, 1835, 1827,
+  0, 144, 857, 313, 144, 0, 144, 844, 42, 144, 0, 288,
+  208, 313, 313, 313, 0, 844, 1835, 1827, 0, 854, 844, 695,
+  857, 208, 313, 98, 857, 269, 0, 1832, 288, 144, 0, 313,
+  144, 854, 98, 288, 313, 144, 854, 2491, 844, 98, 0, 0,
+  157, 857, 985, 338, 0, 2428, 313, 854, 338, 0, 0, 144,
+  208, 269, 854, 2416, 2381, 313, 0, 0, 313, 313, 0, 0,
+  313, 725, 313, 208, 0, 269, 42, 313, 313, 2496, 269, 854,
+  509, 313, 1832, 313, 313, 313, 313, 1827, 1827, 0, 42, 313,
+  1832, 1832, 844, 288, 854, 985, 0, 1832, 1832, 1643, 0, 1827,
+  288, 857, 844, 854, 0, 288, 2416, 1832, 1832, 313, 2360, 264,
+  313, 313, 313, 42, 98, 1835, 0, 844, 42, 0, 98, 2392,
+  313, 854, 2381, 144, 208, 854, 857, 0, 139, 0, 208, 313,
+  0, 313, 1832, 844, 0, 0, 1976, 854, 313, 1832, 98, 404,
+  313, 313, 854, 313, 2093, 2416, 313, 2503, 313, 313, 144, 0,
+  2381, 208, 208, 2416, 2416, 2381, 313, 2416, 313, 269, 208, 412,
+  0, 857, 269, 854, 313, 313, 269, 854, 2506, 269, 269, 313,
+  985, 288, 269, 288, 313, 0, 144, 857, 313, 144, 313, 0,
+  208, 1827, 1832, 857, 1832, 857, 288, 854, 854, 144, 0, 854,
+  313, 144, 857, 844, 42, 854, 98, 288, 0, 1835, 1832, 854,
+  0, 313, 1832, 1832, 857, 0, 854, 857, 857, 1827, 1832, 0,
+  1835, 1827, 313, 144, 1832, 854, 0, 857, 1827, 1832, 857, 0,
+  98, 1832, 1835, 288, 1832, 854, 0, 1832, 0, 0, 1835, 1715,
+  1832, 854, 0, 0, 0, 854, 854, 1832, 144, 313, 1832, 1832,
+  1832, 1832, 1832, 0, 857, 313, 854, 157, 2509, 0, 0, 857,
+  0, 1827, 857, 854, 313, 854, 2433, 854, 338, 1832, 42, 0,
+  857, 446, 1832, 313, 0, 2381, 269, 338, 0, 0, 208, 854,
+  0, 144, 854, 313, 1835, 288, 0, 0, 42, 854, 844, 0,
+  313, 157, 0, 288, 844, 144, 0, 854, 0, 844, 844, 313,
+  2392, 854, 857, 1832, 0, 144, 0, 0, 854, 1827, 144, 854,
+  844, 288, 509, 509, 844, 844, 288, 144, 288, 208, 844, 1835,
+  288, 854, 0, 854, 288, 2516, 844, 2360, 844, 208, 288, 288,
+  854, 0, 854, 139, 844, 288, 288, 0, 844, 288, 288, 208,
+  2360, 2360, 854, 844, 269, 2360, 857, 157, 288, 463, 0, 288,
+  288, 1832, 313, 844, 313, 857, 854, 313, 313, 854, 144, 313,
+  854, 0, 144, 338, 844, 857, 0, 0, 157, 0, 288, 288,
+  2384, 854, 0, 0, 338, 313, 844, 1832, 144, 288, 338, 42,
+  313, 2521, 2384, 269, 2384, 313, 1832, 0, 313, 42, 313, 313,
+  313, 208, 0, 0, 313, 144, 0, 288, 313, 42, 139, 2384,
+  0, 269, 42, 857, 1319, 288, 844, 854, 313, 854, 288, 42,
+  2526, 844, 288, 269, 288, 0, 857, 1161, 854, 0, 404, 844,
+  313, 313, 0, 0, 313, 854, 0, 313, 854, 338, 0, 338,
+  338, 0, 1923, 404, 313, 288, 313, 313, 288, 0, 857, 0,
+  0, 412, 288, 0, 1827, 1832, 0, 854, 139, 313, 288, 313,
+  2381, 0, 1827, 208, 313, 2384, 509, 2381, 2531, 1832, 844, 0,
+  2384, 854, 144, 288, 0, 0, 42, 1115, 2381, 0, 144, 313,
+  313, 313, 2381, 313, 2384, 0, 0, 2416, 1835, 2381, 338, 0,
+  2416, 313, 2443, 0, 2416, 1835, 854, 1832, 313, 0, 313, 313,
+  1832, 0, 313, 313, 854, 2486, 0, 854, 313, 313, 2381, 313,
+  1832, 269, 1832, 313, 857, 0, 144, 1832, 2093, 338, 313, 1832,
+  139, 0, 857, 2384, 269, 0, 854, 313, 854, 313, 208, 313,
+  0, 1832, 1727, 269, 2416, 0, 313, 854, 854, 0, 1643, 854,
+  1832, 844, 288, 313, 2384, 139, 854, 338, 382, 0, 0, 844,
+  854, 1832, 854, 1827, 2384, 844, 0, 854, 42, 313, 157, 313,
+  288, 2469, 313, 0, 844, 0, 313, 844, 313, 208, 1832, 1827,
+  288, 1832, 288, 1832, 1832, 0, 1832, 2506, 0, 288, 2538, 854,
+  1827, 1835, 1835, 269, 1827, 288, 144, 2506, 288, 854, 1923, 857,
+  269, 1827, 1832, 1827, 0, 857, 857, 288, 854, 857, 857, 288,
+  1827, 844, 0, 313, 2433, 42, 313, 854, 0, 0, 42, 313,
+  338, 0, 269, 854, 2503, 1832, 313, 1827, 854, 1835, 208, 313,
+  313, 2384, 2381, 313, 844, 338, 208, 0, 2384, 0, 2381, 288,
+  2416, 2381, 2381, 2550, 2553, 2381, 2381, 0, 2381, 313, 2543, 2381,
+  2550, 2381, 2381, 2381, 2381, 2381, 0, 2381, 0, 2381, 2550, 2381,
+  2381, 2381, 2381, 2381, 313, 2381, 288, 2381, 144, 2381, 2416, 2381,
+  2381, 269, 2381, 288, 2381, 144, 269, 157, 0, 144, 2381, 2416,
+  854, 1832, 2381, 2381, 2381, 144, 288, 854, 854, 2381, 2381, 854,
+  0, 2011, 2381, 313, 1835, 2381, 2381, 288, 0, 0, 854, 844,
+  2416, 2381, 844, 1835, 288, 208, 857, 144, 144, 269, 0, 2381,
+  857, 2428, 313, 1835, 0, 412, 288, 208, 42, 854, 844, 2384,
+  313, 288, 313, 1832, 857, 2381, 2384, 2381, 2384, 208, 2381, 269,
+  0, 0, 2381, 288, 2384, 857, 0, 313, 288, 2381, 313, 1832,
+  854, 2381, 0, 144, 0, 854, 857, 0, 2381, 0, 144, 144,
+  1827, 1835, 157, 1835, 288, 1923, 1835, 42, 1835, 857, 2381, 144,
+  288, 1923, 1923, 2381, 2381, 2565, 857, 0, 2381, 2381, 0, 2558,
+  2416, 2381, 144, 0, 313, 1832, 0, 1827, 2486, 0, 1832, 0,
+  2381, 2381, 2486, 313, 1832, 2381, 1832, 2384, 404, 2381, 2381, 2381,
+  854, 144, 1976, 2381, 2381, 2381, 264, 144, 2568, 2381, 2381, 2384,
+  2381, 2381, 2381, 854, 1832, 42, 1835, 208, 2381, 157, 854, 338,
+  42, 313, 0, 42, 0, 313, 844, 0, 208, 288, 1835, 208,
+  269, 338, 144, 854, 144, 2381, 313, 1832, 2381, 854, 0, 854,
+  2384, 2384, 2384, 313, 2381, 2486, 0, 2384, 2384, 412, 0, 42,
+  42, 0, 0, 0, 854, 0, 42, 0, 288, 0, 288, 288,
+  985, 2381, 854, 208, 313, 2384, 2416, 2416, 144, 2416, 2381, 844,
+  854, 313, 854, 854, 844, 2416, 0, 2416, 2381, 1835, 0, 0,
+  2421, 844, 854, 844, 854, 1832, 854, 0, 157, 157, 1832, 0,
+  0, 844, 1832, 1832, 854, 288, 2301, 844, 854, 1832, 313, 463,
+  2301, 2384, 313, 2384, 2301, 313, 1832, 0, 2416, 338, 1832, 288,
+  313, 288, 313, 1832, 2195, 98, 2360, 313, 0, 854, 2381, 313,
+  1832, 2381, 288, 1832, 844, 313, 854, 313, 854, 313, 42, 1835,
+  313, 1832, 854, 0, 854, 854, 0, 1115, 854, 854, 157, 0,
+  1832, 313, 0, 269, 0, 854, 0, 288, 313, 157, 338, 0,
+  313, 1835, 313, 288, 2381, 313, 288, 2503, 0, 2503, 2550, 313,
+  509, 208, 313, 313, 313, 313, 2381, 0, 144, 144, 313, 0,
+  313, 1832, 0, 313, 2387, 1832, 0, 1835, 1832, 0, 854, 313,
+  857, 854, 857, 1832, 1832, 1832, 1832, 1827, 854, 1835, 1832, 854,
+  1827, 1832, 1832, 2011, 1046, 1832, 1832, 2660, 1923, 1923, 313, 857,
+  313, 854, 0, 313, 831, 844, 269, 1832, 831, 313, 854, 1727,
+  2416, 313, 288, 42, 1827, 932, 0, 854, 857, 1832, 2384, 1923,
+  338, 854, 0, 1827, 1827, 288, 1827, 854, 0, 0, 313, 208,
+  1832, 288, 313, 0, 208, 313, 0, 313, 288, 313, 844, 139,
+  0, 1832, 854, 854, 313, 1835, 985, 1835, 2573, 854, 1835, 2392,
+  269, 2319, 382, 1832, 269, 269, 844, 1832, 857, 1835, 288, 0,
+  1832, 1217, 313, 144, 0, 1827, 269, 313, 854, 288, 313, 854,
+  844, 1835, 2496, 0, 269, 854, 854, 1827, 313, 144, 313, 0,
+  288, 2384, 382, 404, 0, 313, 269, 313, 1835, 269, 144, 42,
+  854, 144, 0, 157, 98, 288, 288, 0, 288, 1832, 288, 1832,
+  313, 382, 288, 288, 0, 313, 288, 313, 1832, 0, 42, 288,
+  854, 0, 288, 854, 854, 1832, 1835, 1832, 1832, 288, 0, 2309,
+  1832, 857, 1046, 0, 854, 288, 854, 857, 288, 1832, 313, 157,
+  854, 288, 1923, 2387, 1715, 733, 0, 313, 844, 854, 854, 313,
+  854, 0, 854, 2491, 269, 857, 313, 313, 0, 313, 313, 854,
+  1112, 0, 42, 0, 0, 2580, 0, 98, 0, 313, 313, 313,
+  0, 0, 854, 854, 857, 313, 0, 857, 0, 338, 288, 0,
+  42, 0, 1643, 0, 313, 338, 0, 157, 2585, 157, 0, 857,
+  144, 854, 0, 313, 0, 0, 313, 338, 208, 269, 2011, 0,
+  0, 0, 157, 313, 313, 144, 313, 0, 313, 857, 2350, 313,
+  854, 0, 0, 338, 854, 338, 338, 0, 139, 2381, 2381, 313,
+  338, 1832, 2416, 313, 0, 2011, 313, 0, 2381, 313, 313, 2416,
+  313, 0, 338, 313, 0, 0, 313, 1832, 313, 144, 725, 857,
+  2381, 313, 313, 313, 208, 42, 42, 338, 854, 857, 2350, 288,
+  0, 2381, 0, 2496, 2381, 1835, 157, 144, 854, 208, 288, 0,
+  288, 509, 854, 313, 144, 1835, 854, 0, 854, 313, 854, 288,
+  2387, 269, 288, 288, 157, 0, 313, 144, 313, 98, 288, 264,
+  0, 1832, 98, 2360, 313, 144, 0, 2291, 1297, 2590, 2595, 725,
+  2600, 1112, 2607, 0, 0, 725, 1297, 0, 1796, 0, 1046, 0,
+  0, 0, 725, 0, 463, 0, 509, 2595, 1112, 404, 2590, 1796,
+  1112, 1115, 2612, 0, 1297, 509, 0, 1112, 0, 0, 2617, 0,
+  0, 1796, 1112, 725, 0, 0, 0, 0, 0, 1046, 1715, 2622,
+  725, 509, 0, 1297, 725, 1796, 0, 1796, 1715, 1715, 2595, 725,
+  0, 1715, 725, 0, 2301, 2627, 0, 1796, 0, 1715, 1046, 725,
+  1715, 1715, 1046, 1046, 1046, 725, 1796, 0, 2550, 1715, 1796, 1046,
+  2595, 1976, 1976, 0, 2301, 1715, 1976, 1297, 404, 2632, 1715, 2627,
+  1976, 725, 1715, 2637, 725, 1715, 2647, 1046, 725, 2301, 2301, 2607,
+  2647, 2607, 0, 725, 2595, 1715, 2301, 2642, 2650, 0, 1796, 0,
+  1715, 0, 0, 2647, 0, 2647, 1046, 1046, 404, 0, 2595, 1715,
+  2301, 1976, 1796, 509, 1715, 1297, 1715, 725, 463, 509, 2550, 2655,
+  1715, 1715, 1715, 1715, 1046, 2660, 1715, 1715, 2663, 1046, 1796, 1715,
+  1715, 2627, 509, 1046, 1796, 2301, 2668, 2550, 1297, 1796, 1046, 2673,
+  1115, 1046, 509, 1976, 725, 509, 0, 1046, 1715, 509, 0, 725,
+  1715, 1796, 0, 725, 1976, 509, 1796, 1046, 1715, 1046, 509, 1046,
+  1046, 0, 2301, 1715, 1297, 1297, 2595, 509, 725, 1715, 1715, 1715,
+  2680, 2301, 0, 1715, 1715, 1297, 1297, 1796, 1715, 1715, 1715, 1715,
+  2301, 1112, 2668, 1715, 2647, 509, 1715, 509, 1715, 2301, 2607, 0,
+  2685, 1715, 2301, 1715, 725, 1715, 2595, 0, 1046, 2595, 1715, 725,
+  1715, 1715, 1715, 2590, 2595, 2550, 1112, 1715, 2301, 2301, 2647, 2503,
+  2663, 0, 0, 2627, 2301, 1112, 2607, 1796, 1715, 725, 2690, 725,
+  725, 2550, 2595, 725, 1297, 2550, 2550, 725, 0, 2550, 2550, 725,
+  1976, 2550, 2301, 1046, 1796, 1715, 2690, 2668, 2301, 725, 1115, 1715,
+  1715, 1796, 0, 0, 2695, 1796, 1796, 1796, 1796, 2632, 1715, 0,
+  2301, 404, 1715, 2690, 2607, 2503, 1976, 2550, 2550, 2550, 2301, 2301,
+  0, 1046, 725, 2550, 2503, 725, 1715, 2550, 1715, 0, 2705, 2550,
+  2301, 2690, 0, 1715, 0, 2590, 2700, 2637, 1715, 2301, 2550, 2595,
+  1715, 1715, 0, 725, 2663, 2690, 2595, 1796, 0, 1715, 2595, 509,
+  2595, 1297, 1715, 2647, 1715, 1297, 2595, 2291, 2695, 2595, 463, 2607,
+  1715, 2710, 0, 2660, 1112, 1976, 2715, 0, 2550, 2301, 725, 2668,
+  1715, 0, 509, 1715, 725, 1046, 1715, 1715, 1297, 2647, 2680, 2301,
+  1715, 509, 1976, 1715, 725, 2632, 2595, 2720, 2072, 509, 1046, 2663,
+  0, 1715, 2301, 725, 509, 2685, 0, 2301, 1715, 2690, 1715, 404,
+  509, 1715, 725, 0, 2632, 2695, 404, 725, 2720, 725, 509, 509,
+  725, 1046, 0, 509, 1046, 2301, 2727, 1046, 1112, 2550, 0, 2655,
+  2550, 725, 2550, 1976, 725, 2595, 1715, 509, 2727, 1297, 0, 0,
+  1715, 1046, 1796, 0, 1297, 2607, 1115, 1046, 1796, 1796, 2550, 1796,
+  1046, 725, 1046, 1715, 0, 0, 1297, 1715, 1715, 1715, 1715, 404,
+  509, 2607, 725, 2732, 509, 2660, 0, 1715, 0, 0, 0, 2750,
+  0, 1715, 0, 2595, 725, 725, 725, 2550, 0, 1715, 1297, 0,
+  1297, 1715, 2647, 0, 2720, 2595, 1112, 725, 2550, 0, 1297, 2595,
+  2595, 1715, 2637, 2595, 1976, 2720, 1112, 2301, 1715, 1297, 1715, 2550,
+  1715, 0, 1046, 2550, 2550, 463, 725, 1715, 0, 1715, 2301, 2647,
+  2647, 725, 0, 2655, 2647, 0, 1046, 725, 0, 2647, 0, 725,
+  1715, 2647, 2607, 1976, 2710, 725, 725, 1112, 2647, 725, 1796, 1715,
+  2607, 725, 1715, 2550, 1715, 2647, 2301, 2647, 2595, 1715, 1715, 2632,
+  404, 1715, 463, 1976, 1715, 1715, 1715, 1715, 1715, 1715, 2647, 2550,
+  2550, 1715, 2647, 2301, 1715, 1715, 1715, 1715, 1715, 0, 1796, 1715,
+  0, 725, 0, 725, 1715, 725, 2642, 2595, 2550, 1112, 2503, 1976,
+  2695, 1715, 2595, 2550, 0, 0, 2595, 0, 1715, 1715, 2301, 1976,
+  404, 1112, 0, 2550, 2595, 2301, 509, 0, 1046, 1715, 509, 1796,
+  0, 1715, 1715, 2301, 1715, 0, 1715, 2720, 0, 509, 1976, 1112,
+  1046, 1715, 1112, 1297, 725, 725, 1715, 2720, 1715, 2632, 0, 725,
+  1715, 1297, 2660, 2595, 1715, 1796, 1715, 1715, 2637, 463, 1715, 2595,
+  1715, 0, 0, 2632, 1046, 1715, 2595, 404, 1112, 1796, 1715, 1715,
+  1046, 2739, 1112, 1715, 2739, 0, 2632, 0, 2744, 2747, 2747, 1628,
+  2750, 0, 2753, 0, 2747, 2750, 0, 0, 0, 0, 0, 2750,
+  2758, 2758, 2758, 2758, 0, 0, 2750, 2747, 2761, 0, 2747, 2747,
+  2764, 0, 2747, 2744, 2744, 2767, 1628, 0, 2744, 2772, 2747, 2775,
+  2789, 2782, 0, 1431, 2792, 2758, 2782, 2744, 0, 0, 0, 0,
+  2797, 0, 0, 0, 0, 2789, 2506, 2764, 0, 2750, 2750, 2758,
+  1628, 2772, 2747, 2750, 2506, 0, 2750, 0, 0, 2744, 2744, 0,
+  2802, 2805, 2792, 2761, 0, 2750, 2792, 2744, 2789, 2750, 2797, 0,
+  2761, 2750, 2506, 2808, 2813, 2750, 2750, 2744, 2758, 2761, 2750, 0,
+  2750, 2750, 2775, 0, 2818, 2802, 0, 2782, 1628, 0, 2808, 0,
+  2758, 2761, 2823, 2772, 2792, 2506, 2747, 0, 0, 0, 2808, 2750,
+  2792, 0, 2565, 2750, 2750, 2761, 0, 2789, 2792, 2789, 2750, 2758,
+  0, 0, 2744, 0, 2828, 0, 2747, 2828, 2831, 0, 2789, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0
+  };
+
+static const unsigned char hyph_de_values[2834] =
+  {
+  0, 1, 1, 1, 1, 1, 2, 3, 2, 2, 1, 1,
+  0, 1, 2, 2, 2, 1, 1, 1, 0, 1, 3, 2,
+  2, 1, 1, 0, 2, 1, 2, 2, 1, 2, 1, 3,
+  2, 2, 1, 1, 0, 4, 1, 0, 4, 2, 1, 2,
+  0, 4, 3, 2, 2, 1, 5, 0, 4, 3, 2, 3,
+  1, 2, 0, 1, 2, 2, 4, 1, 1, 3, 2, 4,
+  1, 5, 0, 2, 2, 2, 4, 1, 5, 2, 2, 1,
+  1, 2, 3, 2, 1, 1, 2, 0, 2, 2, 1, 2,
+  0, 2, 1, 0, 3, 3, 2, 2, 1, 1, 0, 6,
+  3, 2, 2, 1, 3, 0, 2, 3, 2, 4, 1, 1,
+  0, 2, 3, 2, 4, 1, 3, 0, 2, 2, 2, 2,
+  1, 3, 2, 2, 2, 0, 1, 2, 2, 4, 1, 3,
+  1, 2, 4, 2, 1, 1, 0, 2, 2, 1, 3, 0,
+  2, 1, 1, 3, 3, 2, 2, 1, 3, 0, 4, 3,
+  2, 4, 1, 1, 0, 4, 3, 2, 4, 1, 3, 0,
+  4, 1, 0, 2, 3, 2, 4, 1, 2, 0, 1, 3,
+  2, 4, 1, 5, 0, 4, 2, 2, 2, 0, 2, 2,
+  1, 1, 0, 4, 1, 2, 3, 3, 2, 6, 1, 3,
+  0, 2, 2, 2, 3, 0, 1, 2, 2, 1, 1, 4,
+  2, 2, 1, 0, 2, 2, 2, 6, 1, 1, 3, 2,
+  1, 1, 2, 0, 4, 2, 2, 1, 0, 1, 3, 2,
+  6, 1, 3, 0, 6, 3, 2, 4, 1, 2, 0, 2,
+  2, 1, 3, 0, 4, 1, 1, 4, 1, 3, 1, 2,
+  3, 2, 2, 2, 2, 3, 2, 2, 3, 1, 3, 2,
+  1, 3, 3, 2, 3, 2, 2, 1, 2, 3, 1, 2,
+  2, 3, 3, 2, 1, 2, 0, 1, 2, 3, 2, 0,
+  2, 1, 3, 4, 2, 1, 2, 0, 3, 2, 3, 2,
+  1, 3, 3, 3, 2, 2, 2, 1, 1, 2, 3, 4,
+  2, 1, 2, 3, 4, 2, 3, 2, 3, 2, 1, 2,
+  3, 3, 2, 2, 3, 1, 2, 2, 2, 1, 0, 5,
+  2, 1, 5, 0, 2, 2, 3, 1, 1, 1, 2, 3,
+  2, 1, 1, 3, 3, 2, 1, 3, 0, 2, 2, 2,
+  3, 1, 4, 2, 2, 3, 1, 2, 3, 3, 3, 2,
+  2, 1, 1, 2, 3, 3, 2, 2, 1, 2, 5, 2,
+  3, 3, 0, 2, 2, 3, 3, 2, 4, 2, 3, 2,
+  0, 4, 2, 3, 4, 1, 2, 2, 1, 2, 0, 1,
+  3, 3, 2, 1, 1, 0, 2, 3, 3, 3, 1, 2,
+  0, 2, 2, 2, 3, 0, 4, 3, 3, 2, 1, 3,
+  0, 4, 2, 2, 2, 0, 4, 1, 1, 5, 2, 2,
+  3, 0, 2, 3, 3, 2, 2, 1, 1, 2, 2, 3,
+  4, 0, 1, 3, 3, 2, 2, 1, 0, 2, 3, 2,
+  1, 1, 2, 0, 1, 3, 2, 3, 1, 2, 0, 4,
+  2, 3, 1, 2, 4, 1, 3, 5, 2, 2, 1, 1,
+  3, 3, 3, 4, 2, 1, 1, 2, 2, 3, 3, 1,
+  2, 2, 2, 2, 1, 4, 2, 2, 2, 1, 2, 2,
+  3, 3, 0, 3, 3, 3, 2, 2, 2, 1, 3, 2,
+  1, 4, 0, 1, 3, 3, 2, 2, 1, 1, 1, 2,
+  3, 3, 0, 4, 3, 3, 1, 1, 2, 0, 2, 2,
+  3, 1, 1, 2, 3, 3, 4, 1, 2, 0, 3, 3,
+  3, 2, 2, 1, 0, 3, 3, 3, 3, 2, 2, 1,
+  2, 2, 3, 3, 1, 1, 2, 3, 2, 1, 4, 3,
+  3, 1, 1, 3, 0, 4, 2, 3, 4, 0, 2, 3,
+  3, 2, 2, 2, 1, 2, 2, 3, 4, 2, 4, 2,
+  3, 1, 0, 4, 4, 3, 2, 2, 1, 1, 2, 0,
+  1, 3, 3, 4, 2, 3, 1, 2, 2, 1, 4, 0,
+  2, 3, 3, 5, 2, 4, 1, 1, 2, 3, 4, 1,
+  3, 3, 3, 4, 1, 3, 0, 2, 2, 3, 4, 1,
+  4, 2, 3, 3, 1, 3, 2, 3, 2, 2, 4, 3,
+  3, 4, 2, 3, 0, 4, 4, 3, 4, 2, 4, 1,
+  3, 0, 2, 3, 3, 3, 1, 2, 0, 3, 3, 3,
+  3, 1, 4, 0, 3, 1, 3, 6, 2, 3, 5, 2,
+  2, 2, 3, 5, 2, 4, 2, 2, 1, 0, 4, 2,
+  1, 5, 0, 4, 2, 2, 5, 0, 2, 2, 3, 2,
+  2, 5, 2, 3, 1, 0, 2, 2, 2, 3, 0, 3,
+  2, 3, 1, 1, 4, 3, 3, 1, 1, 4, 0, 1,
+  4, 3, 1, 2, 2, 1, 3, 0, 2, 3, 3, 2,
+  2, 1, 1, 4, 3, 3, 2, 2, 3, 0, 4, 3,
+  2, 1, 1, 1, 0, 2, 3, 3, 2, 1, 2, 0,
+  5, 3, 3, 1, 2, 2, 0, 3, 3, 2, 1, 1,
+  2, 0, 3, 2, 1, 4, 0, 3, 2, 4, 2, 2,
+  2, 1, 4, 2, 2, 4, 4, 3, 3, 2, 4, 4,
+  2, 2, 1, 4, 4, 1, 4, 3, 2, 4, 3, 2,
+  1, 2, 4, 1, 3, 2, 2, 4, 3, 3, 2, 3,
+  4, 1, 2, 3, 1, 2, 2, 4, 1, 2, 5, 2,
+  4, 2, 3, 1, 2, 4, 2, 1, 3, 2, 4, 4,
+  1, 1, 5, 4, 4, 3, 3, 2, 2, 1, 2, 0,
+  3, 2, 2, 4, 0, 2, 4, 4, 3, 3, 2, 1,
+  2, 0, 1, 2, 1, 3, 0, 6, 2, 2, 5, 1,
+  4, 1, 4, 1, 2, 4, 2, 3, 3, 3, 4, 2,
+  1, 3, 0, 4, 3, 4, 2, 3, 3, 2, 4, 3,
+  2, 4, 1, 4, 0, 1, 2, 4, 2, 1, 1, 2,
+  4, 4, 0, 2, 4, 4, 3, 3, 2, 2, 1, 1,
+  4, 2, 4, 3, 3, 4, 2, 4, 1, 2, 1, 2,
+  4, 2, 0, 2, 2, 4, 2, 1, 4, 3, 4, 2,
+  2, 3, 1, 2, 2, 4, 2, 2, 3, 2, 3, 4,
+  2, 2, 3, 3, 5, 2, 2, 1, 3, 3, 4, 2,
+  3, 1, 0, 4, 2, 3, 1, 1, 3, 2, 4, 3,
+  1, 2, 1, 4, 5, 2, 4, 2, 3, 4, 3, 2,
+  3, 1, 2, 0, 3, 3, 4, 2, 2, 1, 1, 2,
+  2, 4, 2, 2, 1, 3, 4, 2, 2, 3, 1, 4,
+  2, 4, 1, 2, 2, 2, 4, 2, 1, 2, 2, 4,
+  4, 2, 1, 2, 4, 3, 2, 4, 3, 4, 2, 2,
+  1, 0, 3, 2, 2, 5, 1, 2, 1, 0, 6, 1,
+  0, 5, 2, 4, 4, 3, 1, 3, 2, 3, 1, 2,
+  0, 2, 3, 4, 2, 3, 1, 0, 3, 3, 4, 2,
+  3, 3, 1, 2, 2, 4, 3, 2, 3, 3, 4, 4,
+  3, 3, 2, 2, 2, 4, 2, 3, 5, 2, 4, 4,
+  3, 5, 4, 4, 2, 3, 1, 2, 2, 1, 1, 3,
+  4, 2, 3, 3, 1, 3, 3, 4, 2, 3, 1, 1,
+  3, 3, 3, 3, 1, 5, 0, 4, 3, 4, 4, 2,
+  3, 1, 2, 3, 4, 1, 2, 2, 1, 3, 3, 3,
+  4, 2, 2, 1, 1, 2, 3, 3, 1, 4, 2, 4,
+  1, 0, 4, 2, 4, 4, 1, 2, 2, 3, 1, 2,
+  6, 2, 4, 1, 2, 4, 4, 4, 2, 3, 1, 2,
+  2, 1, 5, 3, 4, 2, 3, 1, 1, 5, 2, 4,
+  3, 2, 5, 3, 4, 2, 3, 1, 2, 2, 2, 4,
+  1, 3, 4, 2, 4, 3, 0, 3, 3, 4, 1, 3,
+  4, 1, 2, 2, 1, 4, 0, 5, 2, 4, 5, 3,
+  4, 1, 1, 6, 3, 4, 2, 3, 1, 2, 1, 3,
+  4, 2, 1, 4, 0, 3, 2, 4, 2, 3, 2, 2,
+  4, 4, 2, 3, 2, 2, 2, 1, 5, 2, 3, 2,
+  0, 1, 2, 2, 2, 0, 3, 3, 4, 2, 1, 3,
+  0, 2, 4, 3, 2, 2, 1, 1, 6, 0, 3, 4,
+  3, 3, 2, 2, 1, 1, 0, 2, 3, 3, 3, 1,
+  3, 0, 4, 3, 3, 3, 1, 3, 0, 2, 2, 3,
+  5, 1, 3, 2, 2, 3, 1, 6, 3, 2, 2, 1,
+  2, 0, 3, 3, 4, 2, 3, 3, 2, 2, 2, 4,
+  2, 0, 4, 3, 2, 3, 1, 4, 0, 3, 2, 1,
+  4, 0, 4, 3, 4, 2, 2, 2, 1, 3, 2, 4,
+  2, 2, 4, 1, 1, 7, 3, 4, 4, 3, 1, 2,
+  2, 3, 4, 3, 2, 3, 1, 2, 4, 4, 4, 3,
+  1, 1, 3, 0, 2, 4, 4, 2, 3, 1, 2, 2,
+  1, 4, 2, 2, 4, 1, 2, 2, 4, 5, 3, 2,
+  3, 4, 2, 3, 1, 1, 2, 3, 2, 3, 1, 4,
+  0, 1, 3, 4, 4, 3, 3, 0, 2, 3, 4, 4,
+  3, 3, 0, 4, 3, 4, 4, 3, 1, 2, 4, 2,
+  4, 5, 0, 1, 3, 3, 3, 2, 2, 0, 1, 3,
+  3, 2, 2, 4, 1, 3, 3, 4, 3, 1, 2, 0,
+  3, 3, 3, 3, 2, 2, 1, 3, 3, 4, 3, 3,
+  2, 0, 4, 2, 4, 1, 2, 3, 2, 3, 3, 1,
+  5, 2, 4, 4, 0, 1, 2, 4, 1, 1, 4, 3,
+  2, 5, 1, 4, 0, 2, 3, 4, 1, 1, 5, 0,
+  2, 2, 4, 3, 1, 1, 3, 2, 2, 1, 2, 0,
+  1, 3, 3, 4, 2, 1, 1, 4, 2, 4, 2, 0,
+  1, 2, 4, 7, 3, 4, 3, 3, 4, 2, 1, 0,
+  1, 3, 4, 3, 2, 1, 1, 4, 1, 3, 7, 2,
+  4, 5, 2, 3, 3, 4, 2, 3, 1, 2, 4, 2,
+  4, 4, 1, 3, 3, 4, 5, 3, 4, 1, 3, 3,
+  4, 3, 3, 2, 2, 3, 2, 4, 4, 2, 4, 3,
+  4, 3, 3, 2, 1, 4, 3, 4, 4, 1, 2, 0,
+  1, 2, 1, 6, 0, 3, 2, 4, 3, 2, 2, 2,
+  4, 3, 0, 4, 3, 3, 1, 2, 2, 1, 1, 3,
+  4, 3, 2, 1, 1, 2, 2, 3, 1, 2, 1, 1,
+  4, 6, 4, 3, 2, 2, 1, 1, 2, 0, 3, 2,
+  3, 4, 2, 5, 2, 4, 3, 1, 3, 3, 3, 1,
+  1, 5, 0, 4, 4, 4, 2, 2, 2, 1, 1, 0,
+  4, 3, 4, 4, 2, 2, 1, 3, 2, 4, 1, 1,
+  2, 2, 2, 1, 0, 3, 3, 3, 2, 1, 1, 0,
+  4, 2, 2, 3, 1, 1, 3, 2, 3, 1, 4, 0,
+  4, 3, 4, 2, 2, 2, 1, 1, 1, 2, 6, 2,
+  2, 3, 1, 3, 1, 5, 2, 1, 5, 1, 2, 5,
+  3, 3, 3, 3, 4, 2, 2, 1, 1, 4, 2, 5,
+  2, 3, 3, 2, 5, 4, 4, 3, 1, 5, 4, 1,
+  5, 3, 2, 5, 3, 4, 2, 3, 4, 2, 3, 1,
+  1, 4, 2, 5, 2, 3, 2, 3, 5, 3, 3, 3,
+  2, 2, 2, 5, 1, 3, 3, 2, 5, 4, 4, 5,
+  2, 5, 2, 4, 1, 3, 5, 2, 4, 1, 3, 2,
+  2, 5, 4, 3, 2, 2, 5, 2, 4, 3, 3, 5,
+  2, 3, 1, 2, 4, 2, 5, 2, 3, 1, 2, 5,
+  2, 2, 2, 2, 5, 4, 4, 1, 3, 5, 2, 4,
+  1, 2, 1, 2, 5, 3, 4, 4, 2, 5, 2, 4,
+  5, 3, 5, 3, 4, 2, 3, 1, 3, 3, 2, 2,
+  3, 1, 4, 4, 4, 4, 3, 1, 2, 4, 1, 3,
+  2, 5, 2, 2, 4, 2, 5, 1, 4, 2, 2, 5,
+  6, 4, 3, 2, 5, 3, 3, 1, 1, 5, 5, 2,
+  5, 1, 4, 4, 2, 3, 3, 1, 6, 2, 5, 3,
+  0, 1, 2, 4, 3, 1, 4, 2, 2, 6, 1, 3,
+  3, 4, 1, 3, 2, 2, 2, 3, 3, 4, 2, 3,
+  1, 4, 3, 4, 3, 3, 2, 2, 1, 4, 4, 2,
+  3, 1, 2, 4, 1, 2, 2, 5, 2, 1, 2, 4,
+  3, 4, 2, 3, 1, 2, 0, 1, 2, 2, 7, 1,
+  4, 3, 5, 2, 4, 1, 2, 2, 3, 5, 2, 2,
+  2, 1, 1, 2, 4, 2, 0, 7, 2, 1, 5, 0,
+  6, 3, 5, 2, 4, 1, 3, 4, 4, 4, 2, 3,
+  3, 2, 2, 1, 1, 2, 5, 4, 3, 4, 3, 5,
+  4, 4, 1, 3, 2, 2, 5, 2, 0, 2, 4, 5,
+  5, 4, 2, 2, 3, 1, 2, 2, 5, 5, 4, 2,
+  3, 5, 4, 4, 1, 2, 2, 3, 5, 4, 4, 1,
+  1, 3, 2, 5, 2, 3, 4, 3, 5, 3, 4, 2,
+  3, 3, 3, 5, 2, 4, 3, 3, 2, 3, 4, 4,
+  3, 1, 1, 4, 3, 4, 1, 1, 3, 0, 4, 3,
+  3, 6, 2, 3, 1, 2, 3, 4, 4, 3, 1, 1,
+  2, 2, 1, 2, 0, 5, 2, 5, 1, 1, 1, 2,
+  5, 3, 2, 3, 4, 5, 3, 4, 4, 2, 5, 1,
+  4, 2, 5, 3, 1, 2, 3, 5, 2, 4, 3, 2,
+  2, 3, 5, 4, 4, 3, 3, 2, 2, 5, 6, 4,
+  1, 3, 5, 2, 4, 3, 3, 4, 3, 5, 2, 2,
+  3, 1, 2, 2, 5, 5, 4, 4, 2, 5, 4, 3,
+  1, 2, 4, 4, 3, 2, 2, 5, 2, 4, 2, 2,
+  5, 2, 4, 4, 4, 5, 3, 4, 2, 2, 3, 1,
+  2, 2, 5, 7, 4, 2, 2, 5, 2, 4, 6, 2,
+  1, 6, 0, 5, 2, 5, 4, 1, 2, 1, 5, 6,
+  2, 4, 3, 0, 2, 1, 0, 7, 3, 3, 2, 2,
+  3, 0, 3, 2, 5, 3, 1, 4, 2, 2, 5, 0,
+  4, 3, 5, 1, 2, 2, 1, 5, 3, 5, 2, 4,
+  1, 2, 4, 3, 5, 2, 4, 1, 1, 3, 2, 3,
+  4, 0, 4, 2, 5, 4, 3, 3, 3, 4, 4, 3,
+  3, 1, 4, 3, 6, 3, 5, 4, 4, 3, 3, 4,
+  4, 3, 3, 1, 5, 1, 6, 4, 1, 6, 3, 2,
+  5, 4, 2, 3, 2, 4, 4, 1, 4, 3, 4, 3,
+  3, 4, 2, 3, 2, 6, 4, 4, 3, 3, 6, 4,
+  4, 3, 2, 4, 2, 6, 4, 5, 3, 3, 6, 4,
+  5, 3, 3, 4, 2, 6, 4, 3, 4, 2, 5, 4,
+  2, 4, 2, 6, 3, 1, 4, 2, 6, 5, 5, 4,
+  3, 6, 4, 5, 3, 4, 4, 3, 5, 6, 4, 3,
+  2, 4, 3, 5, 4, 4, 3, 2, 4, 3, 5, 4,
+  2, 3, 1, 4, 2, 5, 3, 3, 4, 2, 2, 7,
+  1, 6, 2, 6, 3, 5, 4, 2, 3, 6, 2, 3,
+  3, 4, 4, 3, 3, 2, 4, 1, 6, 5, 1, 5,
+  7, 3, 5, 4, 4, 3, 3, 4, 2, 4, 4, 1,
+  5, 2, 2, 4, 0, 4, 2, 6, 4, 5, 5, 3,
+  3, 3, 2, 4, 1, 3, 2, 4, 4, 3, 4, 3,
+  6, 4, 3, 3, 1, 5, 1, 6, 6, 2, 6, 4,
+  3, 3, 3, 6, 4, 5, 3, 0, 4, 1, 6, 7,
+  2, 6, 3, 4, 6, 3, 5, 3, 4, 4, 3, 3,
+  2, 2, 4, 1, 4, 2, 3, 3, 2, 3, 2, 4,
+  5, 3, 6, 2, 4, 6, 3, 5, 3, 3, 6, 2,
+  5, 1, 6, 2, 3, 6, 2, 5, 2, 2, 6, 1,
+  5, 2, 4, 6, 0, 6, 2, 2, 5, 0, 6, 2,
+  5, 5, 4, 6, 2, 4, 6, 1, 6, 2, 7, 6,
+  6, 5, 2, 5, 6, 3, 5, 1, 7, 6, 2, 7,
+  6, 3, 6, 2, 6, 6, 4, 5, 1, 7, 5, 2,
+  5, 6, 2, 6, 2, 5, 6, 4, 5, 3, 6, 6,
+  5, 5, 3, 6, 2, 7, 6, 4, 6, 2, 3, 6,
+  0, 6, 2, 6, 6, 3, 6, 2, 6, 6, 5, 5,
+  2, 6, 6, 1, 6, 2, 6, 5, 4, 6, 2, 7,
+  5, 6, 6, 2, 5, 5, 3, 6, 3, 4, 6, 3,
+  5, 1, 6, 2, 6, 5, 5, 6, 3, 4, 6, 3,
+  5, 2, 6, 2, 6, 6, 3, 5, 1, 3, 8, 1,
+  5, 8, 1, 4, 8, 2, 5, 8, 2, 8, 1, 1,
+  8, 1, 0, 8, 1, 4, 7, 2, 4, 7, 3, 8,
+  1, 2, 8, 3, 5, 8, 4, 7, 2, 8, 3, 4,
+  8, 3, 7, 1, 8, 1, 7, 8, 2, 4, 8, 3,
+  7, 2, 7, 8, 6, 7, 1, 6, 8, 1, 8, 7,
+  2, 5, 8, 4, 7, 2, 7, 8, 5, 8, 2, 2,
+  7, 1, 8, 2, 6, 8, 3, 7, 1, 8, 8, 1,
+  9, 8
+  };
+
+static const char *const hyph_de_languages[] =
+  { "de", "deu", "ger", NULL };
+
+// en: 5901 patterns, 26 letters, 15905 slots
+static const uint32_t hyph_en_chars[52] =
+  {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+  77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+  89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+  107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+  119, 120, 121, 122
+  };
+
+static const unsigned char hyph_en_codes[52] =
+  {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+  11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+  23, 24, 25, 26
+  };
+
+static const uint32_t hyph_en_trie[15905] =
+  {
+  0, 6913, 13314, 19971, 25860, 32517, 38918, 45319, 50952, 57353, 63754, 70411,
+  71692, 77581, 83982, 89871, 96528, 102929, 15378, 108819, 115220, 121621, 128278, 133911,
+  136984, 142361, 148506, 153627, 158210, 164099, 164612, 169477, 174854, 180487, 181768, 185865,
+  186890, 142603, 192268, 192525, 195342, 197135, 200720, 206353, 16402, 206867, 211732, 217109,
+  131862, 218391, 221720, 21273, 44826, 23067, 224515, 172292, 228357, 23814, 26119, 232200,
+  164361, 157450, 4064779, 27916, 236045, 224782, 239375, 4064784, 243729, 24594, 249107, 254228,
+  256533, 260374, 187159, 56856, 29209, 71194, 45851, 262658, 101379, 254742, 4064773, 268038,
+  4064775, 489238, 4064777, 273674, 4064779, 4064780, 268301, 4064782, 30479, 274704, 4064785, 591622,
+  51475, 28180, 81941, 278806, 4064791, 4064792, 283650, 53530, 68868, 519703, 288006, 531481,
+  4064775, 289545, 294154, 605715, 34572, 293901, 614406, 4064783, 298256, 663830, 4064786, 302355,
+  4064788, 192789, 304918, 768522, 788998, 804880, 4064794, 37403, 310274, 4064771, 4064772, 4064773,
+  316934, 4064775, 312072, 4064777, 322826, 4064779, 4064780, 242445, 4064782, 4064783, 328208, 4064785,
+  4064778, 333843, 148756, 47637, 337686, 4064791, 4064792, 4064774, 84762, 341506, 169219, 346628,
+  351237, 353798, 218887, 357896, 46601, 360202, 45579, 135692, 364301, 366606, 371471, 376848,
+  382225, 51218, 387603, 392980, 397333, 331798, 324887, 303128, 54041, 157210, 399874, 4064771,
+  531206, 4064773, 405510, 180231, 537354, 4064777, 409610, 988422, 737802, 163853, 4064782, 4064783,
+  140560, 4064785, 4064777, 217619, 4064788, 123925, 410390, 994582, 412674, 4064771, 4064794, 4064773,
+  417030, 741915, 228872, 192009, 422922, 4064769, 801034, 318477, 56590, 363791, 428816, 4064785,
+  803856, 407059, 58388, 71445, 422166, 1018646, 4064792, 720642, 137754, 433410, 4064771, 4064785,
+  4064788, 438278, 4064775, 4064778, 4064777, 443658, 727053, 4064780, 117517, 75790, 4064783, 448016,
+  4064785, 4064788, 144403, 75284, 149781, 345878, 4064794, 81688, 1074197, 141850, 381442, 450819,
+  455684, 460293, 372486, 462343, 464904, 4064777, 4064778, 4064779, 4064780, 469517, 474126, 478991,
+  481552, 378385, 78354, 486931, 489748, 494101, 4064790, 199191, 4064792, 92185, 4064794, 243227,
+  168194, 838921, 839434, 735490, 198662, 429826, 4064771, 4064774, 890640, 498694, 4064775, 4064777,
+  4064777, 501258, 103184, 4064780, 150029, 4064782, 181007, 205072, 104470, 4064788, 104723, 256788,
+  4064789, 1091846, 4064777, 4064792, 505858, 110851, 170756, 234245, 508422, 110343, 247048, 4064777,
+  514826, 4064779, 124172, 519949, 269582, 4064783, 522512, 282897, 1098754, 4064787, 250388, 528149,
+  530710, 122903, 4064792, 1141270, 339482, 534530, 186627, 4064772, 4064781, 538886, 4064775, 4064784,
+  4064777, 544778, 4064787, 4064780, 4064781, 125710, 266511, 549392, 546833, 4064783, 4064787, 144916,
+  4064789, 493590, 972052, 4064792, 554754, 4064771, 560388, 523269, 562950, 4064775, 568072, 233737,
+  573706, 4064779, 304396, 4064781, 131342, 235535, 578576, 174097, 4064786, 130323, 584468, 571413,
+  587798, 4064791, 4064792, 4064784, 210202, 136731, 468994, 502787, 591108, 438789, 309510, 136199,
+  592392, 155145, 596490, 4064779, 239628, 599565, 605198, 605967, 609040, 612113, 4064786, 615955,
+  621332, 623637, 453654, 333335, 388120, 749830, 155418, 625922, 4064771, 752906, 4064773, 631814,
+  4064775, 4064776, 635913, 641802, 1159173, 4064780, 366093, 4064782, 4064783, 645392, 275217, 4064785,
+  529427, 253460, 650773, 653846, 1162000, 4064792, 658690, 308995, 422660, 193029, 665606, 260615,
+  624904, 199689, 671498, 4064779, 259340, 351757, 401166, 636431, 676880, 358417, 1166090, 474643,
+  682004, 520469, 683286, 405783, 4064792, 4064787, 329754, 686594, 4064771, 692484, 4064773, 695046,
+  4064775, 4064776, 647433, 700938, 1091330, 280332, 394253, 542990, 4064783, 706320, 710417, 151826,
+  4064787, 713748, 716309, 720150, 4064791, 156952, 1088784, 552730, 724482, 4064771, 176132, 4064773,
+  730886, 4064775, 4064776, 736521, 741386, 1198854, 1183746, 340237, 171534, 4064783, 746768, 4064785,
+  1208578, 702995, 225812, 344597, 752662, 4064791, 328728, 4064784, 295706, 183323, 754690, 417283,
+  755460, 760069, 287750, 225031, 214280, 4064794, 634890, 4064779, 4064780, 763405, 657422, 765711,
+  281616, 686353, 1248006, 772371, 777748, 709909, 187414, 4064791, 780546, 183833, 503820, 198939,
+  784390, 908815, 4064790, 4064785, 789514, 506643, 509460, 4064770, 796930, 4064771, 793872, 993034,
+  802054, 1266186, 996109, 200457, 783626, 4064791, 4064780, 299789, 4064794, 201231, 260880, 4064785,
+  4064783, 237843, 649492, 4064789, 1080339, 803074, 515330, 4064772, 4064794, 230150, 369926, 1054991,
+  249865, 465674, 366346, 1060627, 4064788, 1098246, 1101073, 210960, 352529, 4064788, 4064777, 4064778,
+  228117, 207126, 403222, 1096464, 4064793, 276226, 4064771, 371972, 4064773, 512262, 1095170, 231944,
+  4064777, 4064778, 1097734, 1158662, 467469, 457742, 443919, 773392, 806161, 4064785, 445715, 807956,
+  270357, 311042, 4064771, 4064792, 4064792, 472070, 4064794, 1273858, 4064770, 278026, 4064794, 4064794,
+  4064781, 4064782, 1419798, 286736, 4064770, 4064772, 610308, 1043974, 226069, 540932, 305925, 240646,
+  241415, 243464, 235035, 610061, 4064784, 681487, 411661, 370702, 813327, 4064788, 396049, 615701,
+  556051, 585748, 736021, 613910, 346391, 248344, 813058, 4064770, 825602, 1050630, 818438, 4064774,
+  257030, 1050378, 819722, 828169, 492298, 664589, 4064781, 1052944, 599312, 4064784, 831504, 483603,
+  1148676, 388371, 821014, 497666, 352790, 4064794, 974086, 836870, 343066, 263451, 970506, 837898,
+  4064774, 4064785, 564482, 4064774, 4064778, 509200, 590598, 4064787, 417555, 571913, 630026, 437014,
+  292098, 4064771, 266244, 375322, 271622, 4064778, 4064776, 582419, 323082, 582677, 631062, 536077,
+  1438473, 757775, 1255955, 314129, 288274, 351507, 303892, 317461, 340758, 358167, 428290, 464153,
+  314906, 1047302, 420614, 593666, 1159430, 1051402, 377610, 536582, 1046541, 804365, 333577, 462602,
+  320784, 4064774, 4064784, 456211, 334351, 385552, 327190, 843266, 840723, 4064794, 1200642, 845830,
+  759810, 358660, 568325, 611594, 723718, 341768, 1205258, 4064790, 731146, 849936, 359693, 431630,
+  855055, 4064782, 771088, 338198, 364051, 448532, 360725, 395034, 560898, 619522, 918530, 1349634,
+  379398, 857094, 890374, 1065738, 380170, 859914, 939530, 1351690, 867330, 1065232, 389392, 864016,
+  698374, 503315, 1066005, 582146, 766730, 383254, 892694, 640006, 4064792, 402959, 840208, 844554,
+  4064769, 1356290, 4064774, 1157126, 523798, 870160, 475651, 1156106, 403717, 407302, 434439, 435478,
+  4064778, 1153296, 1157395, 1153044, 414221, 415502, 427023, 4064792, 431889, 4064784, 672787, 430356,
+  443157, 441366, 449303, 873218, 452889, 876034, 4064770, 659462, 455431, 881158, 749577, 853002,
+  457481, 650506, 609293, 4064787, 1163796, 822032, 4064790, 883472, 568595, 471060, 4064771, 477718,
+  721154, 461078, 878596, 496410, 886790, 470554, 4064782, 680969, 675082, 4064785, 491788, 479501,
+  479758, 483855, 526864, 890897, 483090, 1479433, 1474826, 861717, 892950, 895234, 491032, 1053186,
+  544026, 897798, 532482, 1058566, 653577, 574730, 552454, 1056010, 983814, 4064775, 912138, 901136,
+  988938, 1056528, 905491, 912642, 508944, 497942, 984336, 918278, 508692, 501786, 578825, 898570,
+  985366, 4064769, 555522, 868098, 4064770, 546320, 541446, 618758, 581139, 4064772, 575498, 832266,
+  4064774, 553485, 4064777, 4064781, 558352, 689680, 628497, 561427, 583685, 594694, 559126, 1064198,
+  4064778, 911114, 1521668, 4064773, 585997, 4064792, 1063693, 596240, 641026, 4064784, 590099, 597524,
+  625414, 611862, 1244162, 4064778, 4064778, 1523987, 4064774, 4064781, 1165574, 4064783, 631568, 692994,
+  1167114, 4064774, 620293, 644358, 636182, 1248266, 4064770, 643082, 4064794, 1168147, 688653, 4064782,
+  916226, 620048, 1521418, 891397, 703750, 1271558, 665864, 4064794, 920330, 1275658, 646156, 805914,
+  4064770, 654095, 653072, 1147650, 966150, 674306, 922388, 924437, 716822, 655366, 1535251, 4064778,
+  721673, 730122, 4064784, 1535765, 4064781, 1152528, 1171458, 786960, 4064790, 1536275, 1171974, 661268,
+  4064794, 4064790, 927746, 667395, 672260, 694277, 778502, 705799, 4064784, 4064772, 925962, 4064774,
+  4064783, 1524234, 686862, 1194506, 739856, 4064785, 4064786, 677907, 690964, 4064769, 717570, 4064774,
+  1337346, 4064790, 4064777, 1334282, 1341702, 694793, 800266, 884994, 699916, 4064781, 4064772, 933126,
+  701712, 709393, 727561, 935434, 711188, 739349, 699158, 4064781, 1564429, 799504, 1366022, 4064771,
+  711443, 712724, 748565, 795158, 743944, 1371917, 4064769, 4064794, 4064794, 4064781, 743685, 714767,
+  4064782, 748296, 1575430, 4064787, 719380, 736277, 750861, 4064790, 815119, 1523223, 4064770, 4064794,
+  810003, 747540, 4064789, 4064769, 776450, 769026, 1212938, 784645, 4064795, 854790, 756744, 1583888,
+  4064784, 774666, 1182726, 795661, 4064782, 760847, 1181706, 4064784, 1531913, 1533706, 790804, 894229,
+  1186320, 776726, 4064792, 4064771, 753178, 4064773, 810758, 4064775, 1330434, 784133, 4064774, 4064787,
+  1333510, 758285, 4064772, 851215, 769552, 789773, 792334, 795407, 4064784, 929813, 1330960, 906003,
+  4064788, 930325, 800534, 810503, 815624, 4064787, 4064781, 4064789, 1413638, 816909, 817422, 814863,
+  1415690, 4064788, 1194242, 819987, 905748, 827669, 825091, 818948, 822533, 1195017, 1192714, 4064776,
+  4064777, 4064781, 1483795, 4064788, 874253, 4064790, 936207, 4064787, 832785, 4064769, 834067, 837140,
+  878101, 847365, 838679, 4064769, 875522, 4064782, 4064778, 1532176, 941318, 883725, 1478927, 938767,
+  941578, 4064785, 1477651, 843795, 915220, 849173, 4064784, 1588502, 4064792, 861442, 864258, 847893,
+  4064772, 863494, 817670, 849415, 4064770, 919050, 4064778, 1580563, 1584148, 865037, 4064782, 941839,
+  850448, 944913, 868866, 4064781, 853524, 858645, 4064774, 1473041, 867080, 4064794, 875018, 4064795,
+  1520646, 898061, 881678, 946191, 1520394, 913681, 943618, 908307, 882964, 1039618, 948742, 887319,
+  889368, 1042950, 947978, 925723, 4064777, 1043722, 1246726, 4064773, 934160, 4064775, 1246986, 1536005,
+  893962, 4064781, 889622, 945421, 949774, 4064783, 1590804, 946961, 1348866, 950035, 903700, 949525,
+  4064769, 1535507, 4064771, 921348, 1348618, 4064771, 4064775, 4064776, 4064770, 4064781, 4064784, 1269007,
+  936710, 4064782, 923151, 4064787, 4064778, 1270805, 952595, 4064791, 952341, 4064787, 928791, 4064774,
+  1586954, 4064794, 4064769, 930050, 952835, 954628, 4064773, 934662, 4064794, 1072130, 1585940, 938250,
+  1592073, 4064774, 953357, 955918, 956175, 1073418, 957201, 4064786, 958483, 960276, 936981, 1070096,
+  941079, 4064769, 950274, 4064794, 962564, 4064773, 940550, 4064775, 951304, 1585416, 1037570, 1594387,
+  1584395, 957453, 1042438, 964623, 956944, 954897, 1042698, 957971, 960020, 961301, 4064769, 4064791,
+  1039120, 4064770, 959493, 4064774, 4064775, 4064776, 4064790, 4064772, 1597199, 1467402, 964109, 962318,
+  966415, 967184, 963345, 4064784, 4064787, 4064788, 1394959, 963862, 4064791, 967426, 4064793, 1307654,
+  4064789, 968198, 4064783, 1306890, 4064785, 968970, 1035283, 4064788, 1040661, 1305616, 1595920, 966672,
+  4064770, 1599248, 969988, 1611779, 968454, 965910, 4064776, 4064770, 4064771, 4064794, 1457410, 969229,
+  971790, 4064783, 1462278, 971537, 4064771, 967940, 971269, 1201678, 1199375, 972552, 1574403, 1591309,
+  4064784, 1202196, 972813, 973070, 973583, 1613583, 1587732, 1463302, 974611, 973844, 977173, 979458,
+  978967, 976132, 4064776, 973318, 1572629, 4064784, 4064778, 980234, 1099278, 1099023, 979725, 4064790,
+  1546000, 981008, 1099540, 4064789, 980755, 4064770, 982037, 977942, 4064773, 981254, 1524994, 1372678,
+  1587464, 986122, 1528582, 1373194, 1573639, 4064772, 981509, 984080, 4064775, 4064784, 979219, 1589267,
+  1574159, 981782, 985101, 4064782, 987663, 1570836, 4064785, 986882, 1589506, 983060, 982293, 984582,
+  1588998, 1385222, 4064793, 989962, 4064777, 1382154, 4064772, 4064773, 4064783, 990992, 989192, 4064784,
+  1610256, 1613837, 1617162, 988694, 993294, 992783, 1074434, 4064794, 997122, 993811, 1070598, 994069,
+  997894, 4064775, 1072650, 1326338, 1003018, 1005314, 4064771, 1000717, 1071376, 996870, 1003280, 1330186,
+  1619219, 1008394, 994836, 998933, 998422, 1316880, 995087, 1004048, 999441, 1534466, 1617684, 1316118,
+  1001986, 1006358, 999172, 1005829, 1010950, 4064794, 1523718, 1114629, 1013258, 1527561, 1116168, 1621011,
+  1537809, 4064783, 1011728, 1115661, 1526544, 1117199, 1002516, 1010453, 1010198, 1117715, 1117460, 4064789,
+  1011482, 4064795, 4064775, 4064776, 1585167, 4064778, 1590536, 4064774, 4064781, 1583124, 1135625, 1139722,
+  1010705, 1593103, 1014035, 4064788, 1008917, 1007894, 1015298, 4064792, 1139475, 1621261, 1016070, 1138198,
+  1633284, 1012489, 4064781, 1101582, 1103631, 1017101, 1103889, 1620762, 4064784, 1100052, 1103125, 1018899,
+  1012756, 1018133, 1015574, 1020930, 1019139, 1019652, 1570050, 1023494, 1310213, 1309446, 4064777, 1028618,
+  4064787, 4064778, 1597717, 4064782, 1020175, 1029904, 1310479, 4064784, 1573136, 1020692, 1021717, 1019926,
+  1024514, 1023000, 1030916, 1619475, 1027334, 1415170, 1570330, 1028873, 1033994, 4064774, 1025036, 1608965,
+  1029134, 1415434, 1029648, 1035537, 1530118, 1024770, 1029396, 1035797, 1028374, 1034758, 4064792, 1612817,
+  1025801, 1039882, 1539344, 1541649, 1043459, 1046276, 4064783, 1032976, 1370882, 4064776, 1040915, 1044234,
+  1372422, 1033238, 1045517, 1048846, 1374730, 1033754, 4064795, 1635846, 1044499, 4064773, 1049621, 1047062,
+  4064769, 1045762, 4064771, 1049092, 4064773, 1622031, 1394438, 1077250, 4064794, 4064787, 1395722, 1074950,
+  1048077, 1047566, 1050895, 1073930, 4064784, 4064770, 1047827, 1054468, 1051909, 4064784, 4064791, 1051656,
+  1058054, 1650195, 4064776, 1078550, 1054221, 1534982, 1056783, 1536520, 1059086, 1060367, 4064775, 1050132,
+  1538061, 1059859, 1060116, 1062421, 1063181, 1062670, 1061391, 1654026, 4064789, 4064769, 1060883, 1059348,
+  1063957, 4064773, 1061126, 1472774, 1581574, 1654543, 4064795, 1469450, 1582858, 1064461, 1474061, 1067279,
+  1064720, 1591555, 1581840, 1058323, 1064980, 1066261, 1075714, 4064791, 4064769, 1066754, 4064774, 1068036,
+  1347334, 1068550, 1075978, 1350153, 1349386, 1592339, 1591828, 4064783, 4064781, 1070350, 1072399, 4064784,
+  4064788, 4064789, 1065491, 1069844, 1347862, 4064790, 4064791, 4064769, 1592580, 4064771, 4064795, 4064769,
+  4064774, 4064771, 4064776, 1653008, 1071114, 1591053, 4064776, 1614594, 1157642, 1076495, 4064784, 4064781,
+  1653510, 1075475, 1078036, 1078787, 1079556, 4064791, 1079046, 1613070, 1076744, 1655317, 1615889, 1651719,
+  1650948, 1082381, 4064782, 1082127, 1581058, 1081617, 4064772, 1084947, 1080596, 1085186, 1079830, 1086212,
+  1083141, 1654293, 1267717, 1085467, 1582350, 1651989, 1580816, 1266442, 1086477, 1083406, 1087503, 1083664,
+  4064785, 1265424, 1090323, 1084436, 1088021, 4064790, 1087746, 1269782, 1087236, 1529092, 4064773, 4064777,
+  1089800, 4064776, 1529602, 1530634, 4064789, 4064781, 1090830, 1092111, 1089040, 4064785, 1532938, 1090579,
+  1091604, 1091093, 1093125, 4064791, 4064784, 1094408, 4064793, 4064787, 1655046, 4064778, 1095949, 1097230,
+  1095695, 1096720, 1101830, 1617424, 1098515, 1096980, 1105418, 1094166, 1098007, 1104397, 1305347, 1307908,
+  4064784, 1301510, 1658122, 1104659, 1660674, 1106178, 1102614, 1102084, 4064781, 1103366, 1309967, 1593606,
+  4064777, 1108234, 1527043, 1595402, 1104909, 4064774, 4064791, 1107216, 1679882, 1596176, 1107987, 1109250,
+  1108501, 1110294, 4064773, 1109766, 1530385, 4064773, 4064769, 1111818, 4064770, 4064771, 1113869, 1114118,
+  1118215, 1112080, 1601544, 1118474, 4064787, 1119490, 4064781, 1112342, 4064770, 1114374, 4064772, 1525253,
+  1115145, 1120010, 4064789, 4064770, 4064781, 1590289, 1589778, 1116432, 1526798, 1590037, 1120531, 1122818,
+  4064773, 1119766, 1529869, 1122310, 4064775, 4064784, 1688069, 1124362, 1261325, 1666054, 1121037, 4064790,
+  4064783, 1121296, 1262099, 1263380, 1261077, 1124098, 1118997, 1121814, 4064791, 1124870, 4064783, 1385734,
+  4064785, 1126666, 1531667, 1383690, 4064789, 1666330, 1128207, 1123088, 1668867, 1383440, 1652237, 4064769,
+  1126914, 1125910, 1129476, 1128453, 1129990, 1649172, 1132808, 1382938, 1133578, 4064769, 4064780, 4064781,
+  1669907, 4064783, 1131280, 1694991, 1133064, 1696272, 1131540, 1133333, 1130774, 4064781, 4064782, 1137679,
+  4064794, 1125137, 4064778, 1134867, 4064788, 1137173, 1135126, 1141506, 1554960, 1692688, 1140485, 1141766,
+  1701398, 1140744, 1555734, 1142794, 1675010, 4064769, 1143554, 1142030, 1143044, 1142288, 1139974, 4064775,
+  1668362, 1145865, 1146378, 1142550, 4064780, 1146125, 1143822, 1704714, 1145616, 1146897, 1567240, 1152002,
+  1149716, 1150485, 1145366, 1149446, 1693200, 1564943, 4064777, 1155594, 1223693, 4064782, 4064783, 1563669,
+  4064785, 1151248, 1693978, 1574660, 1150227, 4064790, 4064789, 1156630, 4064773, 4064774, 1667600, 4064776,
+  1147163, 1572110, 4064769, 1670165, 1159693, 4064772, 1160463, 1719571, 1576981, 1264642, 4064787, 1157908,
+  1156373, 1262342, 1160205, 4064782, 1163535, 1262858, 4064785, 1622282, 1721105, 1161748, 1164035, 1164292,
+  1164805, 1622544, 4064787, 1163272, 4064774, 1263126, 1722387, 4064770, 1168387, 1164558, 1166351, 4064770,
+  1166599, 1172232, 1166867, 1165844, 1168661, 1727754, 1167895, 1169166, 1172495, 1580045, 1170705, 1728529,
+  1173267, 1173524, 4064774, 1582611, 1174551, 4064789, 1581334, 1171738, 1174786, 1174019, 1176324, 1180677,
+  1618180, 1177607, 1180168, 1528851, 4064788, 4064789, 4064780, 4064781, 1181966, 1184271, 1175568, 1616143,
+  4064786, 1621521, 1179156, 1184021, 1177858, 1182231, 1390594, 1621783, 1187334, 4064795, 1390342, 1734666,
+  1181450, 4064769, 1393930, 1188099, 1187076, 1233410, 1185296, 4064775, 1187848, 1231110, 1641221, 1388819,
+  1377556, 1235722, 1190158, 1190415, 1187600, 1190673, 1640461, 1193235, 1193748, 1194005, 1190934, 4064791,
+  1194754, 1231894, 1645077, 1235480, 1195526, 1328898, 1698573, 1195785, 1197322, 1334790, 4064770, 1195267,
+  1198340, 1337098, 1196038, 4064775, 1699351, 4064787, 1199882, 1336080, 1192214, 1734922, 1199118, 1720328,
+  1196560, 4064785, 4064771, 1203460, 1196820, 4064789, 1733140, 1202440, 4064777, 1203210, 4064773, 1586182,
+  1203981, 1724182, 1202959, 1584650, 4064785, 4064769, 1204499, 1206548, 1207317, 1208069, 1596431, 1600272,
+  4064776, 1727503, 1533954, 1598996, 1533188, 1206029, 1206798, 1211151, 1200912, 4064777, 1417730, 1207059,
+  1207572, 1212693, 1417990, 4064791, 4064769, 4064770, 1416970, 1534227, 1213445, 1736723, 1534742, 4064776,
+  1418768, 1219842, 1705742, 1709327, 1211917, 1217286, 1216527, 1210384, 1222665, 1223434, 1734413, 1215764,
+  1213717, 1213956, 4064773, 1221136, 1735187, 1214216, 4064795, 1214474, 1220373, 4064780, 1217805, 1218318,
+  1218831, 4064794, 4064772, 1734146, 1219603, 1219092, 1219349, 1220630, 4064791, 1218051, 1227268, 4064781,
+  1724943, 1433615, 1222920, 1541892, 1725971, 1435411, 4064780, 1223949, 1225486, 1227791, 4064781, 1543948,
+  4064783, 1228563, 1228820, 1230869, 1228054, 1229079, 1226754, 4064788, 1542421, 1737229, 1229318, 1618949,
+  4064781, 1233161, 1230090, 4064769, 1227522, 1232131, 1234948, 4064773, 1229584, 1618447, 1237768, 4064787,
+  1738000, 1620499, 4064790, 1238029, 1236238, 1237519, 4064784, 1235985, 4064786, 1239315, 1241108, 1237013,
+  1241346, 1240087, 4064792, 1739027, 1239046, 1614086, 1669382, 1242633, 1242890, 1611530, 1667338, 1243917,
+  4064781, 1259522, 1238800, 1612560, 1672976, 1256198, 1243412, 1736198, 1239830, 1260042, 1243138, 1244675,
+  4064794, 1243653, 1244422, 1245191, 1244936, 4064770, 1254163, 4064788, 4064780, 1258518, 1245966, 1247503,
+  4064784, 4064781, 1715726, 1714959, 1245716, 1247765, 1247235, 1249028, 4064773, 4064774, 1730310, 1249800,
+  1738517, 1248522, 1732362, 1732610, 1250317, 1250574, 1253391, 1731334, 1250833, 1644548, 1254675, 1255188,
+  1254933, 1251862, 1255447, 1253144, 1256962, 1739274, 4064772, 1645582, 1252870, 1736970, 1739792, 4064772,
+  1257226, 1645844, 4064774, 4064781, 4064782, 4064770, 1257744, 1257489, 4064773, 1258758, 1257991, 1259029,
+  1542929, 1259274, 1738242, 1543444, 1544725, 1262606, 4064783, 4064784, 1735426, 1543194, 4064774, 1266946,
+  1256469, 1264393, 1265162, 1268742, 1733898, 1265677, 1735696, 1270538, 1265936, 4064787, 1266701, 1267475,
+  1271311, 1263637, 1264918, 1594125, 1270035, 1273348, 1273605, 1271830, 1274375, 4064776, 1595156, 1269274,
+  1595670, 1741587, 1274893, 1275138, 1274639, 1596955, 1275909, 1276166, 1276679, 1274132, 1275413, 1281290,
+  4064792, 1554189, 1277197, 4064790, 1555472, 1278480, 1277457, 1555219, 1554452, 1554709, 4064789, 1284118,
+  4064791, 1280514, 1282819, 4064794, 1288706, 1283590, 1279492, 1280005, 1286918, 1288970, 1272840, 1741322,
+  1289994, 1276430, 1282060, 1284880, 1285649, 1664770, 1290256, 1292037, 4064769, 1665798, 1287444, 1289749,
+  1290774, 1278231, 4064780, 1608451, 4064770, 4064772, 1605894, 1283089, 1294086, 1293587, 1287956, 1295369,
+  1292298, 1664534, 4064773, 4064782, 1545479, 1607185, 1292816, 1296130, 4064794, 4064787, 1740806, 1296646,
+  4064790, 1291784, 4064783, 1299210, 4064794, 1541140, 1545749, 1295886, 1297167, 1298704, 1299473, 1623044,
+  1298451, 1299732, 1299989, 1297942, 1300226, 1745160, 1302276, 4064794, 4064778, 1622798, 1625615, 1746451,
+  1300490, 1301762, 1625107, 4064781, 1626133, 1304582, 4064784, 1303569, 1306633, 1308938, 1355782, 1304853,
+  1312772, 4064773, 1361930, 1303312, 1313032, 4064781, 1310986, 1740045, 1357584, 4064781, 4064784, 1314575,
+  1744390, 1308177, 4064790, 1315091, 4064790, 1315605, 4064774, 4064791, 4064769, 1312002, 4064794, 4064772,
+  1315845, 1309190, 4064776, 4064783, 4064784, 4064781, 4064782, 4064780, 1318157, 1741071, 1314831, 1315344,
+  4064769, 1316610, 1318419, 1364482, 1320213, 1319686, 1739526, 1374214, 1478669, 1324042, 1479695, 1376010,
+  4064781, 4064781, 1479187, 1322256, 1481493, 1369872, 1480727, 4064788, 4064789, 4064790, 4064771, 4064790,
+  1319426, 4064794, 1322756, 1325829, 1324806, 1744642, 1321736, 1646608, 1647121, 4064774, 4064783, 1323533,
+  1648149, 1328655, 1323024, 1648408, 4064772, 1327877, 1328390, 1327381, 4064776, 4064769, 1326602, 1742607,
+  4064784, 1324557, 1407238, 1329935, 1750029, 4064785, 1410058, 1326867, 1328148, 1333781, 1330710, 1336834,
+  1412880, 4064777, 1682694, 4064774, 1684232, 4064781, 4064777, 1335562, 4064792, 1524497, 1712386, 1684751,
+  4064771, 4064789, 1711366, 4064774, 4064775, 1681685, 1711882, 1337622, 1747978, 4064792, 1339405, 4064782,
+  4064783, 1485570, 1485315, 1750805, 1337875, 4064788, 1340181, 1340419, 1341188, 1482762, 1751315, 1341959,
+  1660933, 1656070, 4064778, 1482000, 4064785, 1339917, 1342734, 1344271, 1752070, 1346321, 1661711, 1346579,
+  4064788, 1342229, 1340694, 1348375, 1661205, 1552130, 4064774, 1346843, 4064769, 1350402, 1347075, 1350916,
+  1351941, 1553418, 1355527, 1351432, 1755394, 1352202, 1748746, 1553936, 1354253, 4064781, 1352463, 4064784,
+  1354769, 1553686, 1356051, 1358100, 1359381, 1353750, 1362199, 1357080, 1363202, 1363971, 1364996, 1351173,
+  1362950, 1653762, 1365512, 4064772, 4064773, 1654790, 1757449, 1362445, 1368078, 1368335, 4064784, 1367825,
+  4064786, 1695749, 1370644, 1372181, 1694472, 1371671, 1373443, 1371140, 1655573, 4064774, 1377799, 1696527,
+  4064787, 4064774, 4064789, 1374988, 1376525, 1379086, 1381647, 1379344, 1381137, 1692418, 1379859, 1380116,
+  1382677, 1370370, 1384983, 4064772, 4064793, 1387270, 4064770, 1740298, 1388297, 1385482, 1390086, 1695504,
+  1388552, 4064784, 1389834, 1386512, 4064785, 1691670, 1391374, 1393167, 4064771, 1396996, 1486342, 4064792,
+  1395476, 1392405, 1489162, 4064778, 4064778, 4064781, 1399821, 1740550, 1399567, 1487377, 4064785, 1744138,
+  4064770, 1489685, 1401621, 4064790, 1393431, 4064792, 1398786, 4064777, 4064783, 4064771, 1402374, 4064773,
+  1745939, 1394697, 1402890, 4064769, 1401858, 1403917, 1403652, 1406725, 1404176, 1756170, 1396488, 4064778,
+  4064778, 4064787, 4064790, 1407757, 1404686, 1409807, 4064787, 1397521, 1634565, 1411347, 1410324, 1636360,
+  1399318, 1409047, 1403160, 4064793, 4064771, 1411844, 1414917, 4064778, 4064772, 1409544, 1635603, 1465602,
+  1639701, 1760787, 1413389, 1466374, 1416463, 1414416, 4064774, 1468170, 1418259, 4064788, 1416725, 4064790,
+  4064791, 1468432, 1421060, 4064783, 4064795, 1417479, 4064778, 1464598, 1746964, 4064781, 4064790, 1422605,
+  4064782, 1423887, 1497602, 1421329, 1422850, 1423635, 1501190, 4064777, 1422342, 1417239, 1500170, 1424137,
+  1425418, 4064781, 4064777, 1420301, 1503760, 1424642, 1425168, 4064772, 4064788, 1426950, 1761552, 4064780,
+  4064773, 1429514, 4064769, 1429762, 1420813, 4064770, 4064783, 1426438, 1425937, 4064771, 1430025, 1434378,
+  4064789, 1423126, 1432333, 4064792, 4064781, 1435920, 1433346, 4064771, 1433875, 1756943, 4064787, 1765898,
+  4064776, 4064792, 1432074, 4064794, 1750278, 4064781, 1433102, 4064783, 4064778, 1687565, 4064769, 4064787,
+  1437699, 1436164, 1434885, 1685523, 4064775, 1687829, 1688342, 1435146, 4064794, 1763087, 1440781, 1437454,
+  1441295, 1767187, 1442065, 1761798, 1444627, 1441556, 1440277, 1438230, 4064791, 4064792, 1441817, 4064769,
+  1443330, 1760272, 1444868, 1444357, 4064774, 1763846, 1445896, 4064776, 1752589, 4064794, 4064783, 1447437,
+  1448462, 1449999, 4064784, 1446417, 1753621, 1448211, 1449492, 1450517, 4064790, 4064769, 1447938, 4064793,
+  4064794, 1762566, 1451782, 1544201, 4064777, 4064781, 1452298, 1764102, 1543694, 4064781, 1544464, 1544977,
+  1452560, 1757958, 4064773, 1545237, 4064788, 1452802, 4064771, 1453828, 1453317, 1449222, 1449735, 1452040,
+  1758223, 4064784, 4064787, 4064778, 1451533, 1454094, 1458447, 1457680, 1766408, 4064786, 4064777, 1458708,
+  1457173, 4064790, 1454615, 4064771, 1458948, 1457925, 1460251, 4064775, 1459464, 1762818, 1463562, 4064790,
+  4064774, 4064774, 1464334, 1462799, 4064777, 1659142, 4064770, 1465363, 4064788, 1659914, 1460758, 1766932,
+  1464856, 1464066, 1467651, 1659664, 4064773, 4064774, 4064775, 4064787, 1661973, 4064778, 4064771, 4064772,
+  4064770, 4064782, 1467919, 1769231, 1470993, 4064784, 1472275, 4064788, 1476106, 1585666, 1472527, 1475597,
+  1586437, 4064778, 1475347, 1588744, 4064789, 4064787, 4064791, 1764618, 4064790, 4064773, 1473286, 4064776,
+  4064794, 4064790, 1478410, 4064788, 1583381, 1768202, 4064783, 1481730, 1473552, 1480964, 1483013, 1481222,
+  1477140, 1480456, 4064790, 1484298, 1482242, 4064790, 1484813, 4064782, 1485062, 4064784, 1632516, 1638405,
+  1486602, 1484052, 1483541, 1482518, 4064791, 4064772, 4064773, 1637645, 1640206, 1640975, 1484564, 1490453,
+  4064790, 1768456, 1642260, 4064772, 4064794, 4064795, 1492482, 1491715, 4064772, 4064773, 1492998, 1492231,
+  1769493, 4064773, 1494026, 4064790, 4064776, 1491469, 4064787, 1490191, 1489936, 1494801, 4064782, 1530895,
+  1493268, 1497365, 4064790, 1497858, 4064788, 1493508, 1754370, 1495046, 4064780, 4064788, 4064774, 1499658,
+  1768975, 4064769, 1494285, 4064771, 1500676, 4064789, 4064785, 1754895, 1500424, 1495316, 1498901, 1496342,
+  1756436, 1504013, 1498382, 1502223, 4064769, 1503505, 4064770, 1504275, 4064773, 4064789, 4064774, 4064776,
+  4064778, 1520141, 4064778, 1522447, 1507597, 4064772, 1504527, 4064787, 1521172, 1520917, 1509907, 1508628,
+  1508885, 1509378, 1755149, 4064795, 1510405, 4064776, 4064775, 1492744, 1753875, 1751572, 1771018, 4064780,
+  1505805, 1770499, 1515279, 1511184, 4064785, 4064769, 1498643, 1506580, 1512213, 4064785, 4064791, 4064770,
+  1770242, 1765141, 4064778, 4064774, 4064780, 1517069, 1507342, 1515011, 4064772, 4064778, 4064781, 1517331,
+  1517832, 1517589, 1508362, 4064784, 1765651, 1519373, 4064782, 1759490, 4064771, 4064772, 4064776, 1514771,
+  1515540, 1518869, 1516290, 1519127, 1762062, 1518341, 1519622, 4064785, 1524740, 1748495, 4064788, 1594626,
+  1522952, 1518093, 4064789, 1586694, 4064769, 4064789, 4064782, 4064787, 1519892, 4064785, 1531398, 4064791,
+  4064788, 1592848, 4064778, 4064772, 1771285, 4064774, 4064787, 1593366, 1531152, 1532682, 1766659, 1742100,
+  4064789, 1532437, 4064790, 4064784, 1773063, 1767946, 4064795, 4064788, 1533461, 1529366, 1540098, 1546244,
+  4064772, 4064783, 1536774, 4064776, 4064776, 4064787, 1538570, 4064770, 1767685, 4064774, 1549839, 1539087,
+  1538320, 4064778, 1546515, 1546772, 1548565, 1541397, 1547522, 1550595, 4064778, 1549317, 4064778, 1772309,
+  1549059, 1551625, 1551109, 4064777, 4064774, 1552392, 1551886, 1555973, 4064787, 1558279, 1552909, 1552659,
+  1550356, 1553168, 1772806, 1550871, 1663754, 1558543, 1551381, 1662477, 1665294, 1560339, 1559060, 1556501,
+  1559812, 1664019, 1664276, 1666837, 1772554, 1550107, 4064770, 4064781, 1562370, 1559309, 1560846, 1561871,
+  1563910, 1562641, 1771786, 1562899, 1565450, 1563157, 1561110, 1561613, 4064784, 1564162, 1564688, 1567492,
+  1568517, 4064774, 4064772, 1566472, 1569033, 4064775, 1774342, 1569292, 1567757, 1566990, 1569807, 1742349,
+  1565713, 1743631, 1570579, 1571092, 1572373, 1568278, 1575682, 1569560, 1575940, 1774096, 1577474, 1575175,
+  1578756, 1775362, 4064770, 1576199, 4064770, 1578253, 1577742, 1579275, 4064784, 1599490, 1638149, 1579027,
+  1579540, 1600006, 1775893, 1579795, 1578516, 1602058, 1640717, 4064794, 1643791, 1777154, 1604613, 1598736,
+  1638931, 1644052, 4064772, 1604106, 1641990, 1601046, 1604365, 1603854, 1605391, 1646091, 4064769, 1646349,
+  1606163, 1603338, 1606421, 1776646, 1605133, 1605646, 4064770, 1645333, 1607441, 4064778, 1606931, 4064788,
+  4064789, 1609478, 1767426, 1781770, 1608217, 4064773, 1765382, 1608716, 1607949, 1610766, 1611279, 1663492,
+  4064783, 4064774, 1604883, 4064769, 1612309, 1609750, 4064791, 1615364, 1613317, 4064774, 1616647, 1661456,
+  1662993, 1625346, 1665043, 4064780, 4064789, 4064783, 1784085, 1626376, 1614353, 1627146, 1769748, 1614868,
+  1615637, 1615126, 4064783, 1778186, 4064785, 1627655, 1628936, 1701890, 1623317, 1625878, 4064791, 1704966,
+  1626638, 1628431, 1627920, 1626897, 1624594, 1627395, 4064771, 1628181, 4064770, 1702928, 1629448, 1784339,
+  1706515, 1631499, 4064782, 1703190, 4064778, 1630479, 1629712, 1633796, 1628690, 4064771, 4064787, 1633544,
+  1630742, 1632023, 4064776, 1634060, 1634317, 4064776, 1634831, 1649413, 1646854, 4064787, 1636115, 1630996,
+  1635349, 1745427, 1745684, 1743125, 1630233, 1651215, 1647632, 1658373, 1770754, 1649683, 1658632, 1647893,
+  1656586, 1649943, 4064771, 1660173, 1672451, 4064772, 1674501, 1776397, 1671687, 1660435, 4064784, 1658901,
+  1784591, 1684994, 1778447, 1669134, 1673231, 1685766, 4064777, 1772042, 1689353, 1689866, 1677077, 1677314,
+  1678359, 1677828, 1678597, 1680390, 1678855, 1781510, 1686035, 1681418, 4064769, 1683459, 4064774, 1675278,
+  1682191, 1687066, 1681169, 1759235, 4064772, 1679380, 1679125, 1680662, 4064781, 1682968, 1685264, 1687300,
+  4064786, 1758733, 1683220, 4064774, 1684502, 4064785, 1686808, 4064770, 1691917, 1693454, 4064783, 4064773,
+  1689105, 1700098, 1693715, 1690132, 1690901, 1701126, 1691159, 1746182, 1699849, 1700874, 1708035, 1746698,
+  1775118, 4064783, 4064781, 1700368, 4064787, 1744912, 1700627, 1707523, 1774614, 1702670, 1764362, 1709575,
+  1706257, 4064787, 1706771, 1699092, 1710092, 1709069, 1711620, 4064787, 1785365, 1710865, 1732101, 1708563,
+  4064792, 4064778, 1712918, 1712653, 1710350, 1713935, 1731597, 1781264, 1733647, 1714451, 1709844, 1710613,
+  1729811, 1730836, 1733397, 1711129, 1716493, 1717774, 1718031, 1715472, 1716753, 1713426, 1718530, 4064769,
+  4064770, 1715222, 1720070, 4064773, 4064774, 1715994, 1720586, 1773578, 4064778, 1788692, 4064771, 1718274,
+  1716240, 1721604, 1722629, 1719046, 1719815, 1773844, 4064789, 1721866, 4064770, 4064780, 1741828, 1783568,
+  1737734, 4064784, 1726212, 1724421, 1722886, 1728005, 4064770, 4064790, 1724682, 1725705, 4064784, 1725197,
+  4064770, 1726477, 1785866, 4064789, 4064790, 4064781, 1722132, 1726739, 1726996, 1725463, 1747208, 1729303,
+  1727234, 1728771, 4064771, 1742861, 1729542, 4064772, 1777684, 4064789, 1729034, 1748243, 4064772, 1747477,
+  1747718, 4064775, 1786895, 4064782, 4064770, 1730067, 1749252, 4064777, 1749006, 1750543, 4064784, 4064785,
+  1751042, 4064776, 1743892, 4064789, 4064790, 4064783, 1757186, 1749521, 1752330, 4064774, 1756678, 4064789,
+  1749782, 4064778, 4064784, 1752836, 1755909, 4064787, 4064782, 1758479, 4064784, 4064774, 4064792, 4064770,
+  4064781, 1754638, 1755663, 4064775, 4064785, 1768714, 4064777, 4064795, 1754133, 4064790, 4064791, 4064792,
+  1761028, 4064784, 4064787, 4064769, 1758984, 1770006, 4064769, 4064770, 4064771, 4064772, 4064795, 1763343,
+  4064775, 4064773, 4064774, 1763603, 1759764, 1785105, 1776138, 4064791, 1787924, 1760528, 4064772, 4064775,
+  4064774, 1784836, 1761301, 4064784, 4064778, 1771541, 1777410, 4064789, 1777922, 4064773, 4064794, 1787150,
+  1780230, 1791754, 1783816, 4064789, 4064783, 1775629, 1778958, 1780495, 1781007, 4064784, 4064784, 1782035,
+  4064774, 4064770, 4064789, 4064777, 1783306, 4064774, 4064778, 4064776, 4064795, 1779988, 1787413, 1782530,
+  4064778, 4064775, 4064773, 4064770, 1789442, 1788181, 4064771, 4064774, 4064789, 4064783, 1789962, 4064778,
+  1790474, 4064774, 4064788, 1786133, 4064794, 4064773, 1787669, 4064787, 4064791, 1786634, 1789186, 1786378,
+  4064780, 1792522, 4064769, 4064784, 1791234, 1788944, 1790218, 4064784, 4064770, 1791490, 4064781, 1793290,
+  1789712, 4064776, 4064794, 4064774, 4064778, 1790736, 4064784, 4064769, 4064777, 4064774, 4064772, 1792277,
+  4064790, 4064782, 1792783, 4064778, 4064790, 1794050, 1795605, 4064788, 4064778, 4064774, 4064784, 4064770,
+  1792010, 4064770, 4064789, 1793813, 4064790, 1797126, 4064769, 4064778, 1794562, 1790986, 4064773, 4064785,
+  4064789, 1794320, 4064773, 1794818, 4064778, 4064789, 1795336, 4064771, 4064778, 1796881, 4064770, 4064774,
+  4064785, 1798164, 1795846, 4064781, 4064783, 4064781, 1799427, 4064792, 4064774, 4064789, 4064774, 1799690,
+  1796614, 1797382, 1797638, 4064773, 4064770, 1800213, 4064772, 4064789, 1797894, 4064785, 4064770, 1796112,
+  1800970, 1804557, 4064780, 4064783, 4064785, 1800468, 1799942, 4064788, 4064789, 1801481, 1801738, 1801237,
+  1802498, 1800710, 4064773, 4064771, 1807629, 4064778, 4064778, 1803271, 1804294, 1805058, 4064790, 4064784,
+  1804047, 4064774, 4064782, 4064778, 4064781, 1803022, 1805839, 1805325, 1802006, 1804821, 1807123, 4064787,
+  4064788, 4064770, 4064771, 1807876, 4064781, 4064778, 4064783, 4064770, 4064789, 1808659, 4064794, 1809171,
+  4064787, 4064782, 1806084, 4064781, 1809428, 4064771, 4064772, 4064769, 4064789, 4064794, 4064781, 4064781,
+  4064781, 1808911, 4064795, 4064787, 4064787, 1809679, 4064771, 4064789, 4064775, 4064776, 4064773, 4064789,
+  4064774, 1809925, 4064788, 4064777, 4064770, 4064783, 4064777, 4064769, 1810954, 1803796, 4064772, 4064770,
+  1808131, 4064772, 4064773, 4064770, 4064773, 1812744, 4064781, 4064776, 4064794, 1810703, 1814274, 1817097,
+  4064783, 4064778, 4064789, 1810197, 4064787, 4064788, 4064792, 1811737, 1811971, 1813508, 4064772, 1810438,
+  4064784, 1812232, 4064776, 1815822, 1813007, 4064776, 4064772, 4064782, 1812495, 4064784, 4064776, 1814033,
+  1814799, 1813268, 1817866, 4064792, 4064791, 1815311, 1815556, 1816589, 4064774, 4064783, 1811464, 4064770,
+  1818626, 1818370, 4064770, 4064769, 4064775, 1815055, 4064774, 1817609, 4064784, 4064789, 1814548, 4064776,
+  4064774, 1817348, 4064782, 4064774, 4064777, 4064795, 4064774, 1816083, 1816852, 1816341, 4064781, 4064788,
+  4064792, 4064784, 4064791, 4064778, 1819408, 1818132, 4064789, 4064790, 1819919, 4064781, 4064778, 1818895,
+  4064795, 1822470, 1821194, 1823509, 1821706, 1819157, 4064771, 1823753, 1825286, 4064781, 1825034, 1820688,
+  1826054, 1824258, 4064769, 1822210, 4064784, 1821956, 1823247, 4064781, 4064789, 4064771, 4064787, 1822730,
+  1820437, 1827336, 1825549, 1822990, 1826831, 1830154, 4064792, 4064786, 1826308, 1824020, 4064789, 4064770,
+  4064770, 1824516, 1835792, 1824774, 1828870, 4064771, 4064772, 1830671, 1827586, 4064778, 1834762, 1827091,
+  1826575, 4064784, 1828621, 1832723, 1833999, 4064770, 4064789, 4064790, 1825815, 4064787, 4064772, 1831685,
+  4064790, 4064787, 1829640, 1831938, 4064790, 1838351, 1829894, 4064782, 4064782, 4064783, 1830410, 1834250,
+  1835535, 4064784, 1828372, 4064784, 4064790, 1832208, 4064772, 1833491, 1832467, 4064772, 1836805, 4064770,
+  4064776, 4064785, 4064774, 4064774, 1835028, 4064770, 1836298, 1838090, 1833231, 4064773, 4064769, 4064774,
+  4064787, 1837328, 1836053, 4064787, 1837581, 4064781, 1838607, 4064783, 4064781, 4064781, 1839379, 1839887,
+  4064774, 4064783, 4064787, 4064791, 1840653, 4064789, 4064770, 4064770, 1839125, 4064770, 1838861, 4064778,
+  4064788, 1840917, 1837834, 4064784, 1841161, 1841925, 4064788, 4064787, 4064774, 4064794, 1842438, 4064784,
+  1841673, 4064783, 4064789, 4064769, 1841410, 1843471, 1844757, 1842708, 1840134, 1844997, 4064788, 4064778,
+  1843978, 4064770, 1843725, 1844499, 4064773, 4064774, 4064789, 4064776, 4064770, 4064781, 4064788, 4064781,
+  4064790, 4064789, 4064783, 4064794, 1842178, 4064781, 1845514, 4064774, 1842950, 4064778, 4064778, 4064770,
+  4064778, 4064769, 1848084, 1845258, 1843206, 4064788, 4064783, 4064794, 4064788, 4064784, 4064778, 1847573,
+  4064777, 1844234, 4064784, 1845770, 4064784, 4064778, 1846018, 4064795, 4064782, 4064777, 4064781, 4064787,
+  4064790, 4064783, 1811210, 4064784, 4064784, 1849354, 1846294, 4064794, 4064784, 4064787, 1847302, 4064784,
+  4064783, 4064769, 4064794, 4064781, 1850629, 1850388, 4064794, 4064771, 1850888, 4064769, 4064787, 4064783,
+  4064776, 4064774, 1846549, 4064788, 4064783, 4064784, 4064770, 4064788, 4064788, 1848837, 1846794, 4064769,
+  1853445, 4064783, 4064778, 4064789, 1847824, 4064778, 1849620, 4064775, 1853203, 4064770, 4064783, 4064789,
+  1851921, 4064777, 4064781, 4064790, 4064782, 1851394, 1852676, 1855237, 4064783, 4064794, 1854216, 4064789,
+  1849098, 4064781, 4064780, 1852930, 4064788, 4064770, 1854981, 4064773, 1856258, 4064789, 4064784, 1854741,
+  4064785, 1852418, 1855501, 4064787, 4064785, 4064778, 1855761, 1858566, 1856525, 4064787, 1856021, 4064784,
+  1854466, 1858051, 4064784, 4064783, 1859078, 4064777, 1857030, 4064770, 1858831, 1857286, 1859337, 1859603,
+  4064781, 4064783, 1856784, 4064784, 4064785, 4064783, 4064787, 1857546, 4064774, 4064770, 1857794, 4064788,
+  4064794, 4064789, 4064774, 4064770, 4064773, 4064788, 1860102, 4064774, 1858306, 1861908, 1860870, 4064774,
+  4064787, 1862159, 4064783, 1861137, 1859850, 4064785, 4064783, 1861642, 1864204, 4064794, 4064774, 4064788,
+  1862406, 4064777, 1860627, 1861397, 4064790, 4064789, 4064772, 4064789, 4064788, 4064774, 1860362, 4064770,
+  4064778, 4064783, 1866259, 4064778, 4064778, 4064784, 4064790, 1863955, 4064772, 4064770, 4064790, 4064789,
+  4064783, 4064773, 4064782, 4064774, 1865986, 4064785, 1866773, 1867027, 4064788, 4064794, 4064778, 1867535,
+  1865730, 1868049, 4064794, 1868815, 4064774, 1868557, 4064782, 1868310, 4064784, 4064794, 4064788, 4064787,
+  4064774, 4064782, 1864464, 4064774, 4064784, 4064770, 4064773, 4064789, 4064790, 4064770, 4064769, 4064792,
+  4064772, 4064774, 1867283, 1871379, 1870596, 1869062, 4064774, 4064771, 1869589, 4064771, 4064783, 4064787,
+  1870338, 4064789, 4064774, 4064778, 1867797, 4064789, 4064787, 4064781, 4064771, 4064783, 1870853, 4064776,
+  4064787, 4064770, 4064771, 4064789, 4064794, 4064786, 1871624, 4064782, 4064787, 4064783, 4064787, 4064777,
+  1872147, 1872901, 4064791, 4064784, 1870095, 1869843, 1873677, 1869332, 4064789, 1872397, 4064789, 1871119,
+  4064778, 1871878, 4064795, 4064774, 1873165, 4064789, 4064772, 4064790, 4064791, 4064774, 4064770, 4064769,
+  4064769, 4064770, 1873414, 4064774, 1873939, 1872660, 4064778, 4064777, 4064788, 1874445, 4064788, 4064789,
+  4064784, 1874198, 4064778, 4064784, 4064787, 1874690, 4064790, 4064788, 1875989, 1874950, 4064777, 4064778,
+  4064787, 4064778, 1875475, 4064772, 4064774, 4064784, 4064781, 4064770, 4064774, 4064771, 4064772, 1876230,
+  1877253, 4064778, 4064775, 1877002, 1877765, 4064776, 1875722, 4064787, 4064781, 4064777, 4064776, 4064781,
+  1880079, 1876738, 1878274, 4064788, 4064771, 4064769, 4064773, 4064788, 1875221, 4064787, 4064788, 4064788,
+  1881358, 4064778, 4064795, 1877520, 1879810, 4064788, 1882370, 1883394, 1879558, 4064788, 1878549, 4064774,
+  4064769, 4064787, 1881603, 4064778, 4064786, 4064794, 1878797, 4064776, 1883923, 4064788, 4064782, 4064783,
+  1881107, 4064782, 4064783, 4064770, 1882639, 1884420, 4064794, 1880834, 4064789, 4064776, 4064773, 1886227,
+  1885717, 4064789, 1880589, 4064782, 1886989, 4064784, 4064781, 4064784, 1881869, 1882132, 1886479, 4064776,
+  4064789, 4064773, 1886739, 4064778, 4064788, 4064788, 4064794, 1888277, 4064781, 4064769, 4064777, 4064784,
+  4064788, 1887237, 1884166, 4064794, 4064776, 4064783, 4064777, 4064774, 1888010, 4064778, 4064783, 4064774,
+  1887493, 1884678, 4064784, 4064770, 4064784, 4064776, 1885954, 4064778, 1888514, 4064783, 1887750, 1890067,
+  4064778, 4064778, 1883658, 4064794, 1889045, 4064789, 4064788, 4064769, 4064769, 4064777, 4064774, 4064772,
+  1891330, 1891078, 4064776, 1888772, 4064774, 4064770, 4064776, 4064787, 4064778, 1889286, 4064787, 4064778,
+  4064776, 4064788, 4064784, 4064776, 4064789, 4064786, 4064782, 1892884, 1890314, 1891590, 4064775, 1890835,
+  4064788, 1889557, 1889808, 1891842, 4064781, 4064770, 4064788, 1894677, 4064790, 1890566, 4064777, 1892611,
+  4064794, 4064778, 4064785, 1893126, 4064792, 4064769, 4064778, 4064770, 1895187, 1896207, 1895439, 1895686,
+  4064784, 4064785, 1895946, 4064778, 4064781, 1893644, 4064773, 4064770, 4064789, 4064772, 1894914, 4064773,
+  4064789, 4064776, 4064778, 1892114, 4064783, 1897482, 4064781, 1893398, 4064783, 4064792, 1894150, 4064784,
+  1899270, 4064776, 4064789, 1892362, 4064778, 4064790, 1894402, 4064769, 4064782, 4064770, 1899023, 4064771,
+  1896966, 4064770, 1898506, 4064774, 4064789, 1898767, 4064776, 1901075, 1896464, 4064778, 1896720, 4064789,
+  4064778, 1899791, 1897734, 4064789, 4064783, 4064770, 4064783, 4064787, 1900051, 4064777, 4064778, 4064773,
+  4064787, 4064778, 4064788, 1901845, 4064788, 4064783, 1901583, 4064774, 4064784, 4064774, 4064770, 4064789,
+  4064773, 4064783, 1900810, 4064773, 1902090, 1900553, 4064789, 4064783, 1902346, 4064781, 1902602, 1901325,
+  1903620, 1900301, 4064774, 4064769, 4064781, 4064774, 1903375, 1898261, 4064777, 1902858, 1903888, 4064791,
+  1905162, 4064784, 4064791, 4064789, 1904898, 4064789, 1907988, 1905925, 4064774, 1906197, 1906946, 1904403,
+  4064778, 4064770, 4064774, 1910026, 4064794, 1907465, 4064781, 4064776, 4064789, 4064777, 1898004, 1906709,
+  4064783, 4064770, 1906438, 1908243, 4064773, 1907718, 4064784, 1908488, 1911827, 4064781, 1908742, 1911060,
+  4064774, 1913858, 1909254, 1908998, 1911304, 1909525, 1912586, 4064777, 4064789, 4064790, 4064775, 4064789,
+  1910288, 1910786, 4064785, 4064790, 4064770, 1912066, 1913350, 1914643, 1911558, 4064787, 1913114, 4064788,
+  1912851, 1913620, 1915914, 1912342, 4064791, 4064783, 4064769, 4064770, 1914378, 4064787, 4064788, 1916164,
+  1915413, 4064789, 4064772, 4064772, 4064774, 1914890, 4064774, 4064780, 4064778, 1915138, 4064787, 4064781,
+  4064782, 4064787, 4064789, 4064772, 1918484, 4064789, 4064770, 4064783, 1916437, 1920276, 1916678, 1915664,
+  1916950, 4064789, 1917706, 4064778, 1917204, 4064771, 4064787, 4064774, 4064783, 4064775, 4064790, 4064780,
+  1917954, 4064770, 4064778, 4064774, 4064774, 1921034, 1920514, 4064784, 4064784, 1917450, 4064774, 4064789,
+  4064769, 4064774, 4064778, 4064771, 4064781, 4064795, 1920015, 4064770, 4064782, 4064771, 1921555, 4064787,
+  4064770, 4064791, 4064771, 4064770, 4064785, 4064777, 4064769, 4064778, 4064789, 4064783, 4064783, 4064792,
+  4064785, 1921290, 4064781, 4064789, 1918218, 1922818, 1923334, 4064787, 4064776, 4064787, 4064777, 1919754,
+  1924877, 4064783, 1924117, 4064774, 1921811, 1920784, 4064789, 4064781, 4064787, 4064778, 1925898, 4064789,
+  1922324, 1925122, 4064791, 1924624, 4064784, 1924368, 1926658, 4064770, 4064783, 1922058, 4064772, 4064781,
+  4064774, 1925382, 4064794, 1926918, 4064771, 4064788, 1926416, 4064773, 4064772, 4064774, 4064776, 1927682,
+  1928967, 4064778, 4064771, 4064789, 4064771, 1926163, 4064787, 1927174, 4064775, 1928718, 1925653, 4064783,
+  1927430, 4064783, 4064773, 4064778, 1927951, 4064774, 4064785, 4064789, 4064774, 4064778, 4064771, 4064781,
+  1923846, 1929474, 4064781, 1929743, 4064775, 4064773, 4064772, 1928464, 1929986, 1931789, 4064781, 1929237,
+  4064774, 1932806, 4064787, 1932307, 1928202, 4064787, 4064784, 1930244, 4064776, 4064770, 1933077, 4064787,
+  4064774, 1932565, 1933327, 4064784, 4064783, 4064794, 4064787, 1930506, 4064784, 4064778, 4064771, 1930758,
+  1931270, 4064783, 4064788, 4064789, 4064775, 1931014, 4064776, 1934086, 4064774, 4064774, 4064782, 1939974,
+  1933840, 4064790, 4064770, 4064783, 4064778, 1935637, 1938698, 1935381, 1933588, 1937928, 4064781, 4064787,
+  1936916, 4064789, 4064770, 1941258, 1936644, 1938949, 4064777, 4064775, 4064787, 1940998, 4064781, 4064784,
+  4064774, 4064781, 4064771, 1937423, 4064784, 4064778, 1939733, 4064781, 1939476, 1938453, 1941768, 4064791,
+  1940751, 1939214, 4064783, 4064778, 1936403, 4064783, 1937173, 4064788, 4064770, 4064772, 1942276, 4064773,
+  1940243, 4064783, 4064772, 1942790, 1941509, 1942545, 1938196, 1943050, 4064783, 1940495, 4064790, 4064789,
+  4064774, 1942030, 4064784, 4064782, 4064778, 4064773, 4064788, 4064773, 4064790, 1943298, 1943823, 4064769,
+  4064783, 1943558, 1945602, 4064790, 4064789, 1944340, 4064776, 4064778, 4064774, 1944851, 4064778, 1945357,
+  4064770, 1944079, 1945860, 4064775, 4064777, 4064774, 1946374, 4064782, 1945108, 4064774, 1946633, 4064781,
+  4064792, 4064783, 4064784, 4064781, 4064774, 4064770, 1946134, 1944597, 4064790, 4064789, 1947394, 4064783,
+  1946901, 4064790, 1947152, 4064794, 4064789, 4064787, 1948426, 4064784, 1948173, 1947910, 4064788, 4064781,
+  4064781, 4064778, 1949715, 4064788, 1953796, 1949449, 4064773, 4064775, 1949188, 4064773, 4064783, 1950214,
+  4064788, 1949973, 1950739, 4064781, 4064778, 4064770, 1951746, 4064790, 4064788, 4064774, 1950996, 4064783,
+  4064770, 1956866, 1956098, 4064772, 1948934, 1954053, 1954310, 1955347, 1953542, 4064774, 1952266, 1956361,
+  4064789, 1958922, 4064770, 1960194, 4064783, 4064778, 1965326, 1951253, 1932053, 1956627, 1958154, 1955082,
+  4064794, 1959443, 1957894, 1960974, 4064783, 4064784, 1955850, 4064771, 4064783, 1959183, 1958677, 4064790,
+  4064791, 4064787, 1963284, 4064772, 1962506, 4064774, 4064772, 1962767, 4064770, 1964051, 4064783, 4064787,
+  4064774, 4064784, 1961743, 4064769, 4064778, 4064783, 4064769, 1959700, 4064794, 1964297, 4064773, 4064783,
+  1961231, 4064770, 4064795, 1961498, 1960468, 1960710, 4064782, 4064776, 4064778, 4064784, 4064790, 4064788,
+  4064794, 4064789, 4064783, 4064770, 4064783, 4064773, 4064771, 1965843, 1966106, 1964804, 1964564, 1965062,
+  1967367, 4064781, 1969412, 4064783, 4064771, 1968135, 1967629, 4064787, 4064774, 4064789, 4064782, 4064781,
+  4064787, 1966868, 1967893, 4064772, 4064791, 1963791, 1968660, 4064789, 1966342, 4064769, 1965588, 4064787,
+  4064787, 4064778, 4064791, 1970185, 1968391, 4064784, 1967110, 4064781, 1971210, 4064787, 4064778, 1968917,
+  1969158, 4064789, 1970696, 4064787, 4064778, 4064789, 4064789, 4064772, 1969670, 1970950, 4064784, 1969929,
+  1971458, 1970442, 1971978, 4064771, 1971718, 4064771, 4064775, 4064770, 4064776, 4064783, 4064782, 1972230,
+  1975315, 4064770, 1972751, 1980678, 4064781, 1972486, 4064774, 4064781, 1974282, 4064783, 1973770, 4064789,
+  1974800, 1973011, 1973519, 1974547, 1975810, 4064791, 4064792, 4064778, 1975046, 1976330, 4064789, 1977109,
+  4064778, 4064769, 4064778, 1975568, 1979413, 4064777, 4064781, 4064790, 4064784, 4064790, 4064787, 1976582,
+  4064789, 4064783, 4064790, 1976074, 4064794, 1977873, 1978882, 4064772, 1978388, 1979157, 1979910, 4064771,
+  1978643, 4064770, 1980170, 1980938, 4064776, 1977346, 1979663, 1981186, 1980432, 4064774, 1981711, 4064788,
+  4064789, 1982986, 4064787, 4064778, 4064789, 1981442, 1985794, 4064784, 4064787, 4064773, 4064774, 1984777,
+  4064776, 4064778, 4064769, 1984013, 4064789, 4064772, 4064772, 4064784, 1984273, 1986050, 4064777, 1985030,
+  4064774, 1986310, 4064773, 4064778, 1985290, 1987082, 4064785, 4064776, 4064790, 1991701, 4064787, 4064783,
+  1984518, 4064781, 4064772, 1983507, 4064781, 1982486, 1989382, 1974036, 1986831, 4064784, 4064787, 4064774,
+  4064789, 4064777, 4064789, 1986570, 1985542, 4064794, 4064788, 4064789, 4064778, 4064791, 1987330, 4064778,
+  1988102, 4064782, 4064774, 4064785, 1990666, 4064784, 1987594, 1990417, 4064789, 1990921, 4064788, 4064770,
+  4064770, 1991439, 4064771, 1988870, 4064772, 1989653, 4064783, 4064775, 4064784, 4064788, 1989124, 4064788,
+  4064770, 1987855, 4064794, 4064791, 4064784, 1992723, 4064783, 4064789, 1988372, 4064771, 4064778, 1992452,
+  4064781, 1994259, 4064788, 4064776, 1992208, 4064791, 4064781, 4064783, 4064783, 1993743, 4064784, 4064771,
+  1993226, 4064773, 1991174, 1993489, 4064776, 4064780, 4064772, 4064772, 1996040, 1992973, 1995792, 1994765,
+  4064770, 4064783, 1991957, 4064784, 1989908, 1995539, 1994004, 4064791, 4064780, 1995010, 4064772, 1996549,
+  4064794, 4064787, 4064791, 1995283, 4064770, 4064789, 1996815, 4064782, 4064785, 4064782, 4064773, 4064784,
+  1996298, 4064774, 4064791, 4064778, 4064789, 4064774, 4064778, 4064775, 4064774, 4064778, 1997071, 4064788,
+  4064790, 4064788, 4064784, 4064792, 4064774, 1994513, 1998096, 4064789, 4064774, 4064775, 1997590, 4064781,
+  1997314, 2000134, 4064772, 4064773, 1997830, 4064769, 4064776, 4064787, 1999114, 4064777, 4064772, 4064791,
+  2001423, 4064791, 4064783, 4064784, 4064785, 4064781, 4064774, 2000405, 4064784, 4064789, 4064791, 1998861,
+  2000646, 4064783, 4064770, 1999383, 1998346, 1999635, 1998598, 2002703, 4064776, 4064770, 4064789, 2001930,
+  2004751, 4064778, 4064794, 2005506, 4064789, 2002197, 2000909, 4064781, 4064783, 4064783, 2004237, 2002453,
+  4064774, 4064789, 2005762, 4064778, 2005001, 4064773, 4064769, 4064770, 4064772, 4064773, 2006026, 4064778,
+  2003206, 4064776, 2006543, 4064784, 4064783, 4064794, 4064787, 2006790, 4064773, 2008595, 4064784, 4064791,
+  4064781, 4064783, 2005263, 4064784, 4064788, 4064787, 4064781, 4064789, 2006287, 2004486, 2007059, 4064774,
+  4064776, 2008340, 4064789, 2010904, 2002957, 4064781, 2007310, 2008847, 4064774, 4064785, 2012418, 4064769,
+  4064770, 2010133, 2009092, 4064778, 4064774, 4064775, 2012682, 4064781, 2009348, 4064788, 4064789, 4064784,
+  2009610, 2009871, 2010637, 4064778, 4064784, 4064787, 2012174, 2011407, 2014726, 4064785, 4064794, 2011667,
+  2012941, 4064770, 4064784, 2011920, 4064783, 2010374, 2014469, 2015498, 4064774, 4064778, 2013702, 4064780,
+  2013197, 2014218, 2014981, 2013456, 4064770, 4064781, 4064772, 2013974, 4064774, 4064774, 2015765, 4064778,
+  2008074, 2016006, 4064769, 4064774, 4064794, 4064778, 4064789, 2015234, 4064772, 4064773, 4064769, 4064778,
+  4064789, 2016514, 2018058, 4064772, 4064773, 2016262, 4064783, 2017295, 2017026, 4064788, 2019593, 4064783,
+  2021380, 4064771, 2021893, 4064791, 2017546, 2017812, 2022157, 4064770, 2016789, 4064781, 4064778, 2019855,
+  4064794, 4064784, 4064780, 4064789, 2021139, 4064790, 4064784, 2020117, 4064785, 4064772, 4064770, 4064770,
+  4064790, 2020630, 2024966, 4064774, 4064781, 4064770, 4064778, 4064783, 2023951, 2022406, 4064784, 4064782,
+  4064769, 4064784, 4064785, 2023426, 4064773, 2026515, 2023189, 4064787, 4064772, 4064770, 4064771, 2022914,
+  4064787, 4064770, 4064789, 4064771, 2026756, 4064784, 4064778, 2025748, 2026261, 2025994, 4064775, 4064788,
+  4064770, 4064787, 2028036, 4064794, 4064788, 2024718, 4064778, 2025226, 4064788, 4064794, 4064769, 2027031,
+  4064782, 2025486, 2027279, 4064788, 2027793, 4064770, 2028815, 2027540, 4064774, 4064791, 4064791, 4064774,
+  2028298, 4064778, 4064777, 2030854, 2024450, 4064781, 4064784, 4064773, 4064771, 4064774, 4064783, 2028563,
+  4064778, 4064787, 2029076, 4064783, 4064794, 4064791, 4064772, 4064778, 2030086, 2031370, 4064774, 4064789,
+  2030342, 2029322, 4064789, 4064776, 4064770, 2030598, 4064771, 4064782, 4064778, 2033417, 4064788, 4064789,
+  4064788, 2032149, 2031110, 4064770, 4064783, 2031874, 2032390, 4064781, 4064778, 4064771, 2035215, 2033683,
+  2029845, 2034954, 4064789, 4064778, 2029583, 2036499, 2031629, 4064788, 4064790, 2034196, 4064770, 4064787,
+  4064782, 4064783, 4064792, 2037762, 2034451, 2035472, 2035732, 2033926, 2039050, 4064791, 4064769, 2037263,
+  4064774, 2035970, 2036230, 2037002, 4064784, 4064776, 2036742, 4064788, 4064790, 4064770, 2038023, 4064778,
+  4064774, 4064783, 2038538, 4064787, 4064778, 4064788, 4064783, 4064784, 4064771, 4064781, 2037510, 4064773,
+  4064789, 2040329, 2040586, 4064770, 2038278, 4064772, 4064795, 4064787, 4064769, 4064783, 4064774, 4064785,
+  4064784, 4064784, 4064789, 2039562, 2041101, 4064787, 2042383, 2041360, 4064781, 2038794, 2040847, 4064788,
+  4064775, 4064776, 4064778, 4064790, 2043146, 2043402, 4064795, 2043662, 4064783, 4064769, 4064784, 2046730,
+  2042640, 4064769, 2044938, 4064790, 4064790, 4064778, 2044438, 2043910, 4064784, 2042893, 4064773, 2046214,
+  4064784, 2048006, 4064790, 2045194, 2046477, 4064778, 4064783, 2044686, 4064789, 2045973, 4064794, 4064781,
+  4064778, 2045460, 2045717, 4064794, 4064770, 4064787, 4064772, 4064773, 4064790, 4064787, 4064776, 4064770,
+  2046978, 4064770, 4064781, 4064774, 4064794, 2048262, 2047494, 4064769, 4064778, 4064789, 4064774, 2047750,
+  4064789, 2048531, 4064781, 2049301, 4064784, 4064783, 4064789, 4064774, 4064791, 4064777, 2050317, 2049029,
+  4064794, 4064783, 4064776, 2049542, 4064789, 4064789, 4064791, 4064788, 4064774, 4064774, 4064778, 2053397,
+  4064784, 2048790, 4064781, 4064778, 4064784, 4064774, 4064787, 2053135, 4064774, 2041610, 2049796, 4064773,
+  4064782, 2050050, 4064775, 4064770, 2051344, 2050569, 4064772, 4064789, 4064772, 2050822, 4064773, 4064770,
+  4064782, 4064770, 2054404, 4064770, 4064787, 2051850, 4064772, 2059027, 2054917, 4064781, 4064784, 4064788,
+  4064787, 2056450, 4064784, 2054150, 2054662, 2052614, 4064788, 2057990, 2052112, 2056970, 2051606, 2011153,
+  2053904, 2058246, 4064789, 2058505, 2055440, 2055952, 2053658, 2056196, 2057753, 2057226, 2060558, 4064782,
+  2055702, 2058765, 4064774, 2059526, 2055181, 2056724, 2060042, 2062089, 2061570, 2060309, 2062602, 2062857,
+  2064130, 2061830, 2063626, 2061318, 2064661, 2063374, 2065423, 2062357, 2064912, 2063888, 4064782, 2068486,
+  2065674, 2066957, 4064794, 2065164, 2063123, 2066192, 2064403, 4064770, 2067728, 2065929, 2067461, 2069519,
+  2070020, 2066698, 2067202, 2071565, 2069251, 2066444, 4064770, 2072074, 2072842, 4064782, 2072339, 2073608,
+  2070550, 2076174, 2074118, 2067992, 2069781, 2076431, 2075149, 2078978, 2075406, 2074395, 2076687, 2073108,
+  2076943, 2073875, 2075920, 2074636, 2077197, 2073359, 2075672, 2077967, 2074901, 2078471, 2077462, 2078728,
+  2078228, 2077720, 2079236, 2079498, 2082069, 2079753, 2080774, 2080269, 4064772, 2081282, 2081026, 2083074,
+  2080528, 2080020, 2083597, 2082822, 4064770, 2082321, 2083338, 2085648, 2085122, 2084367, 2086148, 2083857,
+  2081808, 2084115, 2084622, 2085890, 2085389, 2081557, 4064787, 2082573, 2084884, 2086676, 2086418, 2087689,
+  2087174, 2088719, 2087430, 2087942, 2088973, 2092049, 2089223, 2092296, 2094598, 2090522, 2093062, 2090754,
+  2091283, 2089494, 2091024, 2086927, 2090244, 2088207, 2092817, 2089748, 2090005, 2095111, 2096390, 2094342,
+  2091541, 2097156, 2096912, 2095369, 2098708, 2099970, 2098186, 2100231, 2091796, 2095878, 2095618, 2097933,
+  2101005, 4064770, 2101254, 2072597, 2097418, 4064772, 2101773, 2099465, 2102534, 2098954, 2102032, 2104835,
+  2100492, 2104324, 2103313, 4064771, 2103565, 2103044, 2102805, 2101525, 2104583, 2103815, 2107151, 2105873,
+  2106894, 2102274, 2107413, 2105617, 2107917, 4064778, 2107654, 2108164, 2108684, 2106639, 2117893, 2110995,
+  2106133, 2105367, 2105108, 4064782, 2108949, 4064782, 2109461, 2109702, 2109200, 2111247, 2110218, 2109973,
+  2111504, 4064778, 2110733, 2112006, 2112514, 2106374, 2114069, 2111759, 2114317, 2112275, 2110470, 2115597,
+  2122242, 2114579, 2120966, 2115350, 2115082, 2116110, 2114838, 2112787, 2117640, 2118662, 2113813, 2116368,
+  2118163, 2119438, 2115854, 2119686, 2113306, 2119192, 2121232, 2120468, 2119957, 2117391, 2118412, 2123014,
+  2120212, 2121492, 2118935, 2121989, 4064789, 2122754, 4064776, 2126090, 2121742, 2125589, 2126351, 2123526,
+  2122510, 2127381, 2125846, 2124052, 2127119, 2126850, 2120724, 2123285, 2129415, 2127623, 2127882, 2128133,
+  2128899, 2128399, 2129924, 2129162, 2129666, 2132746, 4064780, 2134018, 2126611, 2130691, 2130445, 2132240,
+  2137620, 2130964, 2134286, 4064787, 2133008, 2134535, 2131985, 2136844, 2136336, 2134790, 2130188, 2131462,
+  2137859, 2135046, 2137103, 2135571, 2137359, 2135814, 2138370, 2133264, 2138889, 4064784, 2138128, 4064781,
+  2136586, 2139658, 2140680, 2139408, 2142982, 2141190, 2138640, 4064778, 2139152, 2140170, 2139926, 2123798,
+  2141450, 2144520, 2140930, 2140438, 2142485, 2141973, 2144262, 2145039, 2142732, 2142227, 2146838, 2143746,
+  2143234, 2145286, 2144789, 2145552, 2147606, 2148884, 2145805, 2146056, 2149382, 2148367, 2149141, 2147855,
+  2147344, 2150666, 2146324, 2151428, 2149903, 2152196, 2148613, 2151175, 2149652, 2150150, 2150406, 2152452,
+  4064777, 2153237, 2151692, 2150918, 4064770, 4064794, 2154502, 2155030, 2153737, 2152976, 2154246, 2151945,
+  2153488, 2153999, 2155284, 2156035, 2155528, 2157580, 2152725, 2154762, 2155782, 2156290, 4064770, 2157846,
+  2158595, 2158082, 2157318, 4064770, 2159366, 2156804, 2159892, 2162712, 4064772, 2163458, 2163978, 2164243,
+  2162185, 2156560, 2160136, 4064784, 2157075, 2164482, 2159116, 2169102, 2170118, 2158868, 2165250, 2158358,
+  2162453, 2168333, 2162950, 2160405, 2165766, 2165001, 2172678, 2166022, 2166538, 2171408, 2167044, 2166282,
+  2167558, 2167820, 2169346, 2161683, 2168591, 2171652, 2167302, 2176002, 2172949, 2172179, 2170640, 2166806,
+  2172425, 2171910, 2061077, 2170389, 2173456, 2173193, 2174983, 2170898, 2174211, 2169877, 2176777, 2179086,
+  2174726, 2177811, 2177551, 2177297, 2178822, 2180614, 2182150, 2179330, 2180368, 2180117, 2181395, 2179846,
+  2181892, 2178580, 2177044, 2175754, 2181144, 2182413, 2184469, 2183946, 2184717, 2181652, 2178065, 4064774,
+  2183432, 2176532, 2187278, 2180886, 2183690, 2187535, 2187023, 2185993, 2179611, 2188051, 4064781, 2185488,
+  2185237, 2187781, 2188549, 2184979, 2185734, 2186255, 2186498, 2193154, 2188809, 2189058, 2188294, 2189591,
+  2189314, 2191623, 4064774, 2191887, 2195213, 2194703, 2190090, 2195970, 2197257, 2194950, 2192660, 2193429,
+  4064783, 2194178, 2198276, 2190611, 2195458, 2197512, 2200070, 2190869, 2209796, 2199311, 2199573, 2201104,
+  2199046, 2193679, 2202374, 2200346, 2200853, 2202645, 2200578, 2198037, 2206470, 2201349, 2199824, 2202119,
+  2210575, 2210070, 2210824, 2211343, 2212361, 2201613, 4064782, 2211843, 2212615, 2203921, 2203652, 2213140,
+  2205460, 2201877, 2206984, 2203401, 2203160, 2204939, 2208524, 2212101, 2207502, 2213385, 2211594, 2208017,
+  2210314, 2216458, 2209300, 2209045, 4064789, 2208279, 2209560, 2212873, 2213642, 2214406, 2211092, 2214666,
+  2215181, 2214154, 2214922, 2217220, 2215941, 2215440, 2213907, 2218500, 2217730, 2216208, 2215701, 2217481,
+  2219279, 2220307, 2218262, 2218006, 2220053, 2216974, 2218768, 2219786, 2222100, 2219539, 2224398, 2220553,
+  2222344, 2221063, 4064790, 2220816, 2222611, 4064773, 2224143, 4064789, 2225155, 2221830, 2224902, 2227727,
+  2223622, 2225674, 2224661, 2227476, 2228230, 2223374, 4064774, 2226454, 2225418, 2229523, 2228501, 2227974,
+  2227221, 2229263, 2225936, 4064775, 2228738, 2226195, 2231829, 2229778, 2228998, 2230541, 2230040, 2232328,
+  2231306, 2232842, 2231574, 2236433, 2232070, 2233862, 2236691, 2233104, 2232601, 2237199, 2235144, 2234390,
+  2238228, 2238476, 2230807, 2234129, 2236934, 2233619, 2235670, 2236166, 2238980, 2237446, 2233368, 2239492,
+  2238724, 2237962, 2240771, 2242822, 2241546, 2241292, 2246418, 2243588, 2234902, 2239245, 2239759, 2240271,
+  2237715, 2241794, 2243087, 2244620, 2248718, 2242310, 2240019, 2242562, 2242069, 2244881, 2245638, 2243334,
+  2246670, 2244373, 2249224, 2243850, 2245893, 1766150, 2244115, 2246929, 2248964, 2245136, 2249997, 2248467,
+  2247687, 2249734, 2245391, 2251276, 2247942, 2249495, 2252305, 2246164, 2247189, 2251779, 2250249, 2251526,
+  2252034, 2250769, 2253058, 2254869, 2255635, 2256653, 2252813, 2253843, 2254357, 2252563, 4064776, 2253318,
+  2256388, 2253583, 4064780, 2254082, 4064770, 2255885, 2258198, 4064778, 2250518, 4064784, 2255376, 4064788,
+  2256898, 2257424, 2256138, 2259715, 2259970, 2261270, 2257158, 2255119, 2260748, 2261506, 4064774, 2262287,
+  2258965, 2260243, 2258694, 2259479, 2262035, 2258449, 2261008, 2264325, 2260495, 2263318, 2264581, 2263042,
+  2262530, 2266634, 2262794, 2264070, 2268182, 2264842, 2265621, 2267149, 2267396, 2268418, 2267653, 2272776,
+  2267917, 2266133, 2268942, 2265875, 2269446, 2270728, 2265365, 2269713, 2271494, 2269965, 2269205, 2270476,
+  2266895, 2266380, 2272260, 2270982, 2270223, 4064778, 2274308, 2273028, 2268685, 2272021, 2271253, 2271752,
+  2274068, 2274567, 2272517, 2277141, 2275345, 2275850, 2276106, 2273557, 4064773, 2276876, 2276373, 2278413,
+  2278914, 2275093, 4064789, 2273802, 4064776, 4064773, 4064771, 4064783, 4064775, 4064790, 4064789, 4064769,
+  4064783, 4064770, 4064787, 4064774, 4064784, 4064781, 4064778, 4064773, 4064783, 4064787, 4064783, 4064769,
+  4064772, 4064769, 2276618, 4064770, 4064777, 4064791, 4064772, 4064770, 4064784, 4064789, 4064784, 2277909,
+  4064783, 4064778, 4064774, 4064794, 4064772, 4064794, 4064773, 4064778, 4064774, 4064774, 4064778, 4064792,
+  4064788, 4064778, 4064788, 4064774, 2263573, 4064778, 4064788, 4064777, 4064784, 4064784, 4064774, 4064770,
+  4064781, 4064787, 4064795, 4064787, 4064784, 4064770, 2280461, 2277638, 4064778, 2278154, 4064789, 4064788,
+  4064774, 4064776, 2279426, 4064789, 2277386, 4064781, 2279170, 4064790, 4064788, 4064769, 2279951, 4064789,
+  4064781, 4064778, 4064783, 4064770, 4064788, 4064783, 4064789, 4064789, 4064781, 4064784, 4064784, 4064777,
+  4064769, 4064782, 4064770, 2282255, 2278666, 4064776, 4064789, 4064782, 4064783, 4064785, 4064770, 4064783,
+  4064771, 4064790, 4064784, 2281487, 4064770, 2265094, 2281730, 4064770, 4064787, 4064787, 4064778, 4064778,
+  4064770, 4064787, 4064776, 4064770, 4064789, 4064783, 4064795, 4064795, 4064777, 4064772, 4064787, 2549273,
+  4064784, 4064778, 4064787, 4064777, 4064794, 4064785, 4064789, 2280198, 4064778, 4064774, 4064774, 4064789,
+  4064784, 4064789, 4064783, 4064783, 4064770, 4064772, 2280966, 4064782, 4064791, 4064794, 2282762, 4064781,
+  2279690, 4064787, 2283793, 4064784, 4064789, 2284554, 4064783, 4064782, 2285066, 4064788, 4064778, 4064785,
+  4064774, 4064769, 2286086, 2286340, 4064795, 4064789, 4064778, 4064782, 4064769, 4064772, 4064770, 2281986,
+  4064795, 4064789, 4064772, 4064774, 4064787, 4064787, 4064778, 4064772, 4064788, 4064783, 4064769, 4064789,
+  4064770, 4064781, 4064778, 4064776, 4064784, 4064774, 4064778, 2285834, 4064771, 4064790, 2282506, 4064770,
+  4064778, 4064774, 4064789, 4064794, 4064789, 4064791, 4064783, 4064783, 4064782, 4064781, 4064790, 4064774,
+  2286852, 2283023, 2286602, 4064781, 2283530, 4064787, 4064791, 4064787, 4064778, 4064781, 2284821, 4064786,
+  4064769, 4064782, 4064795, 4064778, 4064769, 4064787, 4064795, 4064787, 2284048, 4064787, 4064789, 2287117,
+  4064769, 4064787, 4064774, 4064774, 4064787, 4064790, 4064772, 4064787, 4064787, 4064774, 4064788, 4064788,
+  4064775, 4064783, 4064778, 4064781, 4064783, 4064769, 4064772, 4064788, 2288148, 2288394, 4064782, 4064774,
+  4064782, 4064772, 4064788, 2287633, 4064770, 4064782, 4064770, 4064770, 4064778, 4064783, 4064789, 4064784,
+  4064788, 4064794, 4064774, 4064774, 2287366, 2290694, 4064784, 2285322, 4064776, 4064773, 4064770, 4064778,
+  2285578, 2291219, 4064770, 4064774, 4064769, 4064770, 4064769, 4064776, 2291466, 4064771, 4064787, 4064777,
+  4064770, 4064770, 2292243, 4064774, 4064777, 4064770, 2287882, 4064778, 4064795, 4064795, 4064789, 2288646,
+  4064772, 2288902, 4064778, 4064788, 4064784, 4064784, 4064777, 2291720, 4064772, 4064787, 4064771, 2289162,
+  4064771, 4064789, 4064788, 4064781, 2293514, 4064787, 2292484, 4064773, 4064770, 4064789, 4064773, 4064777,
+  4064781, 4064774, 4064781, 4064769, 4064784, 4064770, 4064783, 4064788, 4064784, 4064770, 4064780, 2292740,
+  4064774, 4064774, 4064783, 2294534, 4064788, 4064789, 4064787, 4064790, 4064788, 4064789, 4064789, 4064787,
+  4064787, 4064783, 4064772, 4064795, 4064789, 2294805, 4064783, 2295063, 2291974, 2295567, 2293781, 4064783,
+  4064790, 4064770, 4064787, 4064774, 2295827, 4064771, 4064783, 4064783, 4064776, 4064784, 4064773, 4064773,
+  4064784, 4064787, 4064782, 2296086, 4064774, 2293258, 4064770, 4064772, 4064776, 4064781, 4064775, 4064771,
+  4064789, 4064776, 4064781, 4064778, 4064777, 4064784, 4064776, 4064774, 4064788, 4064774, 4064788, 4064777,
+  4064774, 4064769, 4064783, 4064789, 4064770, 4064781, 4064787, 4064783, 4064774, 4064781, 4064774, 2294026,
+  4064774, 2295317, 4064789, 4064778, 4064789, 4064788, 4064770, 4064789, 4064789, 4064794, 4064772, 4064783,
+  4064783, 4064770, 4064791, 4064788, 4064769, 4064788, 4064783, 4064789, 4064789, 4064789, 2297115, 4064774,
+  4064795, 4064784, 4064778, 4064790, 4064795, 4064770, 2297865, 4064773, 2296340, 4064782, 4064778, 4064769,
+  2296582, 4064795, 4064774, 4064774, 4064783, 4064774, 2296838, 2297350, 4064789, 4064788, 4064784, 4064770,
+  4064785, 2297610, 4064794, 4064770, 4064773, 4064783, 4064774, 4064781, 2298118, 0, 0, 4064789,
+  4064787, 4064778, 4064790, 4064787, 4064774, 4064794, 4064774, 4064789, 4064783, 4064781, 4064795, 2294282,
+  4064788, 4064784, 4064783, 4064774, 4064789, 4064791, 2299914, 4064770, 4064769, 4064769, 4064770, 2298645,
+  4064770, 4064774, 4064770, 4064770, 4064770, 4064781, 4064783, 4064772, 4064790, 4064778, 4064787, 4064769,
+  4064771, 4064784, 4064789, 4064770, 4064778, 4064774, 4064770, 4064783, 4064774, 4064770, 4064778, 4064774,
+  4064770, 2298882, 4064789, 0, 4064781, 2298389, 2299402, 2300418, 0, 4064794, 4064787, 2299658,
+  4064783, 2301446, 4064788, 4064775, 4064773, 2300170, 4064774, 2301971, 4064774, 4064783, 2299155, 4064789,
+  4064769, 4064783, 4064790, 2300682, 4064783, 2301698, 4064785, 4064783, 4064789, 4064794, 2301190, 4064781,
+  4064783, 4064769, 4064781, 4064778, 4064770, 4064788, 4064770, 4064781, 4064794, 4064782, 4064782, 4064789,
+  4064778, 4064769, 4064769, 4064769, 4064780, 4064774, 4064789, 2303242, 4064769, 4064774, 4064772, 2302228,
+  4064791, 4064783, 4064789, 4064784, 4064774, 4064781, 2302733, 4064769, 4064774, 2303764, 4064771, 4064794,
+  4064778, 4064784, 4064769, 2302474, 4064784, 2304277, 2307347, 4064784, 4064787, 4064769, 2303494, 4064787,
+  4064770, 4064781, 4064770, 4064787, 4064770, 2306564, 2304789, 4064776, 2305558, 4064787, 4064781, 4064772,
+  4064789, 4064787, 4064795, 4064769, 2304533, 4064774, 4064773, 4064770, 4064776, 2306833, 4064774, 4064770,
+  4064769, 4064790, 4064789, 4064770, 2308628, 2306058, 4064774, 4064790, 4064778, 2309130, 4064776, 4064783,
+  4064794, 4064774, 4064776, 4064770, 4064772, 4064783, 2308879, 4064774, 4064794, 4064788, 4064774, 4064783,
+  4064788, 4064774, 4064770, 4064778, 4064795, 4064774, 4064795, 2309659, 4064778, 4064781, 4064770, 2309898,
+  4064794, 2310931, 4064774, 2308109, 4064778, 2292994, 4064774, 4064774, 4064770, 4064769, 4064781, 2307604,
+  4064769, 2305299, 4064789, 4064794, 2311426, 4064778, 4064794, 4064788, 2307850, 4064770, 4064788, 4064787,
+  4064778, 4064788, 2310164, 4064778, 2312467, 4064781, 4064778, 4064778, 2311694, 4064795, 4064789, 4064774,
+  4064789, 4064769, 4064784, 4064781, 4064771, 4064774, 2312979, 4064772, 2314500, 2313749, 4064788, 4064774,
+  2311957, 4064769, 4064784, 4064778, 4064795, 4064770, 4064778, 4064795, 4064787, 4064787, 4064784, 4064781,
+  4064774, 2312712, 4064772, 4064776, 4064771, 2313229, 4064772, 4064778, 2313475, 4064781, 4064795, 4064789,
+  4064774, 2313997, 4064776, 4064774, 4064774, 4064774, 4064772, 4064788, 2309395, 4064776, 4064787, 4064770,
+  4064788, 4064795, 4064782, 2315795, 4064789, 4064774, 4064773, 4064777, 4064774, 4064774, 2311178, 2315029,
+  2316309, 4064788, 4064787, 4064789, 4064784, 2314246, 2314758, 4064795, 4064783, 4064772, 4064774, 4064789,
+  4064788, 4064787, 4064769, 4064776, 4064769, 4064774, 4064774, 2315530, 4064774, 2315274, 4064770, 2316564,
+  4064777, 2312211, 2316042, 4064769, 4064770, 4064778, 4064774, 4064789, 2317071, 4064778, 4064784, 4064781,
+  4064775, 2316810, 2317570, 0, 4064776, 2318344, 4064770, 4064783, 4064778, 4064783, 4064777, 4064794,
+  2317322, 4064776, 4064787, 4064794, 4064781, 4064778, 2318090, 2318854, 4064769, 4064783, 2319893, 2319622,
+  4064784, 4064794, 2317841, 4064781, 4064778, 4064781, 4064778, 2318613, 2319380, 4064794, 4064794, 4064789,
+  4064769, 4064770, 2319119, 4064788, 4064787, 4064774, 4064783, 4064788, 4064789, 4064789, 4064778, 2320131,
+  4064789, 4064788, 4064781, 4064794, 2320648, 4064787, 4064781, 2300938, 2321674, 4064770, 4064774, 4064772,
+  2320916, 4064769, 4064783, 2320387, 4064778, 2321410, 4064783, 4064778, 4064776, 4064774, 4064795, 4064794,
+  4064784, 4064769, 4064776, 4064774, 4064774, 2321154, 4064770, 2322453, 4064778, 4064787, 4064789, 4064771,
+  4064770, 4064789, 4064789, 2321930, 4064778, 4064774, 2322178, 4064770, 4064774, 4064782, 4064784, 4064789,
+  2322694, 4064784, 4064770, 4064774, 2323974, 2322954, 4064778, 4064787, 2323210, 4064774, 4064788, 4064774,
+  4064789, 4064775, 3456281, 4064784, 4064774, 4064781, 4064778, 4064774, 4064787, 2325512, 4064781, 2323728,
+  4064776, 2323458, 4064774, 4064777, 4064794, 4064772, 4064787, 4064787, 4064770, 4064787, 2324493, 2324238,
+  4064774, 4064788, 4064789, 4064788, 2324738, 2325779, 4064783, 4064778, 2326548, 2326026, 4064778, 4064787,
+  4064776, 4064778, 4064781, 4064788, 4064772, 4064795, 4064781, 4064781, 2325005, 4064787, 4064773, 4064774,
+  2329107, 4064783, 4064783, 4064787, 4064774, 4064769, 4064774, 2328586, 4064771, 4064789, 4064787, 2329605,
+  4064795, 4064772, 4064781, 4064788, 2330120, 4064783, 4064787, 4064769, 4064781, 4064770, 4064789, 4064781,
+  2329365, 2329875, 4064781, 4064772, 2326278, 4064781, 4064774, 4064788, 4064769, 4064789, 4064776, 4064789,
+  4064787, 4064778, 4064769, 4064777, 4064773, 4064789, 4064778, 4064769, 4064787, 4064781, 2330385, 4064781,
+  4064783, 4064778, 4064774, 4064778, 4064774, 4064773, 4064794, 4064769, 4064773, 4064789, 4064794, 4064787,
+  4064773, 4064784, 4064787, 4064769, 4064794, 4064781, 4064773, 4064770, 4064789, 2330899, 4064789, 4064783,
+  4064770, 4064784, 4064781, 4064783, 4064781, 4064777, 4064777, 4064789, 4064795, 4064773, 4064788, 4064784,
+  4064774, 4064771, 4064776, 4064772, 4064776, 2330634, 4064773, 4064787, 4064776, 4064769, 2328845, 4064770,
+  4064787, 4064794, 4064778, 4064773, 4064769, 2331151, 2331407, 4064784, 4064770, 4064794, 4064776, 4064780,
+  4064780, 4064770, 4064774, 4064774, 4064783, 4064773, 4064773, 4064783, 2326790, 4064784, 4064795, 2332173,
+  4064776, 2328074, 4064774, 4064770, 4064772, 2341910, 0, 2331650, 4064778, 2327317, 4064769, 0,
+  4064787, 4064787, 4064794, 4064788, 2328326, 2331914, 4064789, 4064783, 4064789, 4064787, 4064774, 4064788,
+  4064769, 4064770, 4064788, 4064789, 4064788, 4064780, 4064788, 4064774, 2332426, 4064781, 4064784, 2334474,
+  2332682, 2334747, 4064769, 2334214, 2334986, 4064769, 4064783, 4064769, 2333709, 2332930, 4064778, 4064774,
+  4064787, 4064778, 2336015, 2335750, 4064789, 4064777, 2333194, 2333958, 4064778, 2337289, 4064788, 2336522,
+  4064776, 4064769, 4064773, 4064776, 4064785, 2335253, 4064778, 4064784, 4064795, 4064788, 4064788, 4064774,
+  4064794, 4064783, 4064789, 4064781, 4064774, 4064788, 2337811, 4064771, 4064787, 4064795, 4064777, 4064787,
+  4064770, 4064776, 4064788, 4064784, 4064777, 4064794, 4064771, 2339603, 4064788, 4064776, 4064788, 4064771,
+  4064788, 2336275, 2339082, 2338319, 4064787, 4064789, 4064787, 4064774, 4064774, 4064783, 4064788, 4064781,
+  2340371, 4064778, 2335498, 4064774, 2336770, 4064776, 4064774, 2339846, 2340111, 4064778, 4064795, 4064774,
+  4064782, 4064769, 4064774, 4064774, 2339338, 4064774, 4064771, 4064777, 4064769, 4064795, 4064787, 4064778,
+  4064773, 4064781, 4064774, 2341647, 4064789, 4064774, 2342147, 2341386, 4064788, 4064777, 4064783, 4064789,
+  4064787, 4064787, 2340618, 4064788, 4064783, 4064795, 4064770, 2340885, 4064773, 4064781, 4064770, 2341141,
+  4064787, 4064783, 2337039, 4064789, 2342406, 2342932, 2343437, 2343171, 4064787, 2343683, 2344207, 2344706,
+  2345737, 2344451, 2343956, 2342671, 2338835, 2344975, 2345478, 2345224, 2346259, 2346512, 2346754, 2347525,
+  2348554, 2346010, 2349069, 2348041, 2349833, 2349570, 2347287, 2350351, 2349318, 2348303, 4064774, 2351366,
+  2350090, 2348819, 4064788, 2350607, 2351112, 2352644, 4064787, 2351876, 2352403, 2347018, 2353424, 2347778,
+  2352145, 2471195, 2359046, 2360066, 2351636, 2353684, 2353940, 2357267, 2357774, 2354447, 2358548, 2358035,
+  2358285, 2357523, 2353171, 2358799, 2359309, 2359562, 2354697, 2357018, 2360322, 2360599, 2363152, 2360838,
+  4064784, 2361098, 2361615, 2361863, 2361354, 2362118, 2362377, 2363650, 2362626, 2362889, 2359824, 2363906,
+  2363398, 2364934, 2365712, 2364165, 2364677, 2365189, 2364433, 2367238, 2366224, 2387226, 2365454, 2365972,
+  2366726, 2368262, 2369304, 2367757, 2367494, 2370822, 2368015, 2368774, 4064771, 2368524, 2369034, 2366482,
+  2208788, 2366993, 2369798, 4064774, 2373379, 2371330, 4064778, 2369553, 4064781, 2374404, 2372627, 2375181,
+  2373642, 2371605, 2370575, 2372870, 0, 2374925, 2372120, 2370067, 2370324, 2375945, 2373904, 2373135,
+  2379266, 2371861, 2382086, 2385676, 2375701, 2374163, 2376979, 2378253, 2380303, 2377994, 2375444, 2377238,
+  2377492, 2376194, 2377747, 2380046, 2379536, 2378502, 2379782, 2383620, 2385936, 2384399, 2380819, 2380565,
+  2381075, 2384912, 2384659, 2378768, 2384148, 2382350, 2385172, 2381331, 2376469, 2376726, 2382605, 2383893,
+  2386189, 2381584, 2386442, 2385427, 2387721, 2381844, 2386956, 2388742, 2386708, 2389251, 2387476, 2388237,
+  2388482, 2390552, 2390031, 2388996, 2391572, 2390797, 2390276, 2393094, 2389770, 2391810, 2391306, 2389521,
+  4064778, 2394135, 2395155, 2396169, 2391060, 2397710, 2392074, 2394383, 2392329, 2393862, 2393620, 2395923,
+  2396435, 2396685, 2396941, 2397958, 2399238, 2398221, 2397461, 2398982, 4064777, 2397200, 2398480, 2398726,
+  2399504, 2399753, 2402323, 2400015, 2395674, 2400522, 2401286, 2401798, 2402054, 2401037, 2401546, 2400277,
+  2406413, 2402576, 2400788, 2403586, 2404610, 2405634, 2403087, 4064789, 2403343, 2402839, 2405903, 2407181,
+  2403860, 2395407, 2405396, 2407957, 2404874, 2406922, 2409750, 2407434, 2410004, 2408966, 2411534, 2408723,
+  2409224, 2387972, 2410261, 2412042, 2410502, 2409491, 2411780, 2407683, 2412554, 2411017, 2413071, 2413333,
+  2411280, 2413572, 2414342, 2412821, 2414854, 2412301, 2435331, 2415374, 2413845, 2414612, 2415881, 2417936,
+  2415125, 2417677, 2417423, 2416149, 2410778, 2418183, 2419717, 2418439, 2416403, 2420485, 2414105, 2415629,
+  2418964, 2422295, 2416905, 2423810, 2419985, 2417166, 4064778, 2421773, 2421261, 2422026, 2419220, 2422534,
+  2424585, 2422800, 2420756, 2421525, 2423312, 2423050, 2424344, 2425861, 2424840, 2424070, 2425346, 2426901,
+  2428421, 4064778, 2429972, 2426384, 2430744, 2425617, 2425098, 2426643, 2428930, 2430213, 2429453, 4064794,
+  2428165, 2430485, 2428688, 2427654, 2431750, 2429200, 2433299, 2427919, 2430982, 2432531, 2432006, 2432264,
+  2416656, 2431245, 2434069, 2433798, 2436101, 2434562, 2436610, 2408468, 2434323, 2433551, 4064783, 2433042,
+  2437642, 2432789, 2435592, 2435855, 2435077, 2437397, 2438406, 2438677, 2436870, 2437136, 2439945, 2439426,
+  2440719, 2438163, 2441218, 2441748, 2436362, 2440974, 2439182, 2439682, 2438931, 2441478, 2437911, 2442250,
+  2442502, 2440468, 2443023, 2442758, 2442005, 2443529, 2443270, 2440208, 2444290, 2444038, 2443791, 2445577,
+  2444820, 2445318, 2445071, 2446093, 2445830, 4064787, 2450435, 2446854, 2447120, 2444564, 2448900, 2449922,
+  2448400, 2449414, 2446613, 2450954, 2449680, 2451202, 2452994, 2446358, 2449173, 2455305, 2452756, 2434836,
+  2451732, 2450694, 2457602, 2452493, 2450196, 2453776, 2454548, 2454804, 2453258, 2456845, 2451473, 2454026,
+  4064778, 2452240, 2456596, 2455558, 2455046, 2456326, 2454293, 2456090, 2458372, 2459911, 2460674, 2460944,
+  2457347, 2460167, 2459150, 2458125, 2457863, 2457103, 2461956, 4064787, 2458896, 2463248, 2460429, 2463746,
+  2461200, 2464521, 2459409, 2464272, 2466054, 2458644, 2461717, 2462730, 2461460, 2462484, 2459674, 2463504,
+  2462229, 2462995, 2467336, 4064778, 2464784, 2465549, 2465028, 2466586, 2468371, 2467844, 2469907, 2467078,
+  2470159, 2472202, 2466320, 2469130, 2469648, 2470678, 4064771, 2470420, 2471699, 2473482, 2469393, 2427394,
+  2470918, 2467604, 2468117, 2471959, 2474260, 2475268, 2471444, 2476814, 2474509, 2475526, 2476052, 2478086,
+  2472976, 2472723, 2455824, 2474765, 2476553, 2475013, 2477070, 2479124, 2477582, 2478346, 2478598, 2476307,
+  2473746, 2477839, 2479377, 2477333, 2478870, 2480654, 2481928, 2481671, 2479640, 2481171, 2482453, 2480394,
+  2480144, 2480898, 2479889, 2481411, 2482178, 2482960, 2482696, 4064784, 2485773, 2483473, 2483984, 2484490,
+  2485267, 2484247, 2484746, 2489346, 2483216, 2485525, 2487562, 4064781, 2487053, 2488848, 2486035, 2490375,
+  2483733, 2486275, 2486532, 2486789, 2488336, 2487303, 2485000, 4064789, 2492674, 2490128, 2491654, 2488589,
+  2490638, 2493201, 2493445, 2493712, 2492930, 2494735, 2494221, 2491162, 2496514, 2496021, 2489872, 2498054,
+  2490890, 2495242, 2498820, 2498324, 2495746, 2494982, 2501890, 2499589, 2496774, 2497032, 2499848, 2497798,
+  2499087, 2500098, 2503694, 2501126, 2504202, 2503950, 2501378, 2500625, 2497545, 2507270, 2496276, 2504464,
+  2508554, 2500867, 2509062, 2497302, 2503430, 2501653, 2502420, 2500372, 2506259, 2498582, 2505222, 2502931,
+  2505474, 2504982, 2507782, 2504721, 2505738, 2508036, 2506502, 2509578, 2506758, 2509829, 2511892, 2508307,
+  2511113, 2510086, 2507016, 2512642, 2508816, 2510597, 2515722, 2512898, 2510351, 2511370, 2510869, 2619672,
+  2513418, 2515977, 2516240, 0, 2518018, 0, 2513941, 2514451, 2514188, 2517768, 2514960, 2514708,
+  2515215, 2515469, 2518547, 2516497, 2519556, 2518281, 2518803, 2521864, 2519050, 2520066, 2519817, 2519315,
+  2520337, 2521622, 4064789, 2520586, 2523411, 2525186, 2524170, 2522370, 2526224, 2524934, 2522132, 2520848,
+  2524432, 2525459, 2523650, 2521098, 2523141, 2526733, 2526485, 2527509, 2524693, 2525702, 2528020, 2525958,
+  2526992, 2523906, 2527234, 2527757, 2528275, 2528528, 2529294, 2528774, 2529029, 2529794, 2530064, 2530832,
+  2531586, 2532361, 2532102, 2530325, 2531846, 2530581, 2531078, 2529563, 2534661, 2539027, 2532881, 2535430,
+  2533641, 2538758, 2532628, 4064774, 2535174, 2536208, 2541062, 2537494, 2522889, 2540049, 2534419, 2535700,
+  2535957, 2540290, 2536468, 2538253, 2539522, 2540806, 2540566, 2541325, 2542865, 2537236, 2539268, 2541839,
+  2542348, 2538502, 2543125, 2542086, 2541583, 2543379, 2542602, 2544133, 2544911, 2544650, 2544403, 2543885,
+  2545414, 2545685, 2546178, 2546440, 2545168, 4064781, 2547205, 2546698, 2543638, 2546957, 2545941, 2547462,
+  2548489, 2547974, 2548239, 2547729, 2549009, 2550020, 2552074, 2554370, 2551573, 2548753, 2552842, 2551829,
+  2550543, 2554626, 2552592, 2552341, 2553094, 2555662, 2554899, 2550790, 2555142, 2553609, 2556934, 2554114,
+  2555414, 2553365, 2557459, 2556162, 2555924, 2556678, 2557192, 2553872, 2556431, 2557958, 2557708, 2558480,
+  2558726, 2558995, 2559235, 4064783, 2560258, 2558227, 2561033, 2559503, 2560514, 2560782, 2561549, 2564100,
+  2559766, 2560020, 2563081, 2562572, 2561300, 2562056, 2562822, 2562314, 2565140, 2561816, 2565397, 2563846,
+  2563334, 2563605, 2567693, 2566147, 2564614, 2566677, 2565634, 2565896, 2569741, 4064787, 4064769, 2566410,
+  2571029, 2570506, 2567942, 2569235, 2564374, 2566932, 2567174, 4064774, 2569997, 2568714, 2571270, 2568962,
+  2568467, 2572546, 2574089, 2572309, 2574601, 2572034, 2571526, 2575121, 2574852, 2573831, 4064787, 2572810,
+  2573062, 2539782, 2575892, 2579978, 2571784, 2576902, 2576660, 0, 2575626, 2576141, 2574345, 2577435,
+  2577929, 2575376, 2576400, 2573583, 2578697, 2578957, 2577158, 2579209, 2577670, 2580482, 2578196, 2580743,
+  2582025, 2578452, 2580244, 2579714, 2579476, 2582534, 2581252, 2581514, 2582282, 2582786, 2581001, 2583578,
+  4064771, 2583055, 2583828, 4064778, 4064795, 2583298, 2581781, 4064774, 4064788, 4064770, 4064784, 4064788,
+  2584322, 2584085, 4064783, 4064783, 4064776, 4064791, 4064770, 4064789, 4064776, 4064787, 4064771, 4064795,
+  4064787, 4064772, 4064769, 4064769, 4064772, 4064769, 2585365, 4064788, 4064783, 4064788, 4064775, 4064770,
+  4064784, 4064774, 2585604, 4064778, 4064774, 4064788, 4064795, 2584853, 4064769, 2584596, 4064791, 4064770,
+  4064784, 4064771, 4064788, 4064770, 4064770, 4064774, 4064787, 4064769, 4064788, 4064774, 2585877, 4064769,
+  4064769, 4064774, 4064770, 4064783, 4064770, 4064770, 4064769, 4064774, 4064772, 4064784, 4064770, 4064783,
+  4064769, 2588949, 0, 2586114, 4064791, 2585094, 4064788, 4064788, 4064774, 2587658, 4064783, 4064772,
+  4064795, 4064787, 4064769, 4064772, 4064787, 4064770, 4064788, 4064787, 2586895, 2587407, 4064787, 4064769,
+  4064784, 4064794, 4064774, 4064781, 4064778, 4064788, 4064794, 4064787, 4064774, 4064791, 2589194, 4064770,
+  4064788, 4064769, 4064770, 4064778, 4064787, 4064784, 4064769, 2587913, 4064795, 4064770, 2589711, 4064770,
+  2590470, 4064778, 4064772, 4064769, 4064774, 4064788, 4064794, 4064771, 4064788, 4064769, 4064789, 2590229,
+  4064770, 4064782, 4064769, 2586378, 2586634, 4064794, 2588162, 2587146, 4064789, 4064778, 4064794, 4064770,
+  4064769, 4064781, 4064791, 2589453, 2588426, 0, 4064774, 4064773, 4064783, 4064794, 4064787, 4064784,
+  4064776, 4064774, 4064769, 4064778, 4064774, 4064776, 4064778, 4064788, 2592275, 4064778, 4064774, 4064795,
+  4064772, 4064795, 4064772, 4064781, 4064781, 4064791, 4064795, 4064787, 4064781, 4064778, 4064773, 4064785,
+  4064769, 4064769, 4064789, 4064783, 4064771, 4064783, 2591509, 4064783, 4064781, 4064781, 4064789, 2592529,
+  4064789, 4064778, 4064769, 4064772, 4064769, 4064769, 4064769, 4064790, 4064774, 4064787, 4064770, 4064772,
+  4064788, 4064781, 4064773, 4064777, 4064790, 4064788, 4064788, 4064776, 4064778, 4064788, 4064789, 2588682,
+  4064788, 4064770, 4064772, 4064774, 2593284, 4064778, 4064783, 4064774, 4064770, 4064789, 4064795, 4064789,
+  4064769, 4064789, 4064789, 4064774, 4064788, 4064795, 4064783, 4064769, 4064772, 2594056, 4064770, 4064788,
+  4064773, 4064789, 4064789, 4064774, 2593557, 4064795, 4064772, 4064774, 4064783, 2591234, 2594330, 2594818,
+  2595093, 4064783, 2591746, 4064784, 4064784, 4064781, 2595855, 2593806, 0, 2595597, 2596368, 2596109,
+  0, 2597641, 2604803, 0, 2595345, 2597391, 2597894, 2599174, 2598419, 2594578, 2607624, 2598669,
+  2600198, 2590739, 2598933, 2598164, 2596870, 2600709, 2597141, 2599696, 2599952, 2600976, 2596634, 2601232,
+  2603791, 2602254, 2600470, 2604041, 2602769, 2601493, 2605839, 2606346, 2608134, 2604308, 2603031, 2602515,
+  2602000, 2603277, 2606101, 2603535, 2604565, 2606850, 2605585, 2605314, 2607376, 2609430, 2609158, 2607109,
+  2608644, 2608902, 2607894, 2611478, 2610958, 2612228, 2609670, 2610186, 2606608, 2610442, 2611988, 2609928,
+  2613765, 2608399, 2612490, 4064769, 2615559, 0, 2610698, 2613507, 2616069, 2614035, 2614288, 2613250,
+  2615814, 2615316, 2616326, 2613008, 2616582, 2614790, 2612756, 2617094, 2618114, 2615061, 2617617, 2618886,
+  0, 2618381, 2616851, 2614554, 2623494, 2618639, 2617866, 2619146, 2623753, 2625029, 2625282, 2623251,
+  2622217, 2621718, 2624275, 2619412, 2622991, 2624002, 2620688, 2625555, 2625801, 2626307, 2626569, 2626832,
+  2624531, 2631176, 2627079, 2624789, 2626054, 2627347, 2621446, 2628371, 2628620, 2628870, 2621958, 4064778,
+  2629140, 2628112, 2629382, 2617350, 2627600, 2627861, 2630928, 2631942, 2630666, 2632964, 4064769, 2633219,
+  2634771, 2633491, 2632463, 2632719, 2635541, 2632207, 2633999, 2631430, 2635010, 2636298, 2635786, 2629903,
+  2636802, 2633747, 2634259, 2637066, 2636554, 2634515, 2637574, 2636049, 2635281, 2637320, 2637828, 4064787,
+  2638853, 2639369, 2638092, 2639632, 2638343, 2640654, 2639114, 2641161, 2630416, 2639882, 2641922, 2642434,
+  2663945, 2641421, 2638612, 2641666, 2640919, 2640408, 2640144, 2642189, 2643472, 2642698, 2643733, 2643974,
+  2644243, 2644495, 4064769, 2643204, 2645269, 2642946, 2644752, 2645523, 4064784, 2646274, 2645766, 4064769,
+  2645013, 2648339, 2646018, 2646804, 2647828, 2647046, 2649346, 2647558, 2647302, 2648083, 2648586, 2649861,
+  4064769, 2646534, 2649092, 2648842, 2650381, 2649620, 2651908, 4064769, 4064769, 2651652, 2656282, 0,
+  2652943, 2651153, 2652174, 2653186, 0, 2650640, 0, 2655748, 2657028, 2658570, 2651411, 2650905,
+  2652436, 2650135, 2652689, 2654225, 2653716, 2655505, 2654736, 2658310, 2655234, 2659338, 4064769, 2661391,
+  2656006, 2659850, 2656789, 2659078, 2657552, 2659604, 2658050, 2657290, 2660623, 2660868, 2660362, 2660112,
+  2661638, 2662658, 2661901, 2662157, 2665748, 2661140, 2663173, 2664464, 2665477, 2662409, 2664965, 2664717,
+  2665222, 2683930, 4064787, 0, 2663699, 2664213, 2666256, 2668298, 2666502, 2669578, 2662918, 2672642,
+  2666004, 2672138, 2671878, 2683400, 2666773, 2668821, 2668052, 2668565, 2667539, 2669333, 2667024, 2667290,
+  2667789, 2671124, 2671376, 2672911, 2669847, 2670346, 2674190, 2671618, 2670867, 2672397, 2622740, 2673677,
+  4064769, 2674698, 2622485, 2673410, 2675473, 2670102, 2673168, 2675215, 2674950, 2670608, 2674453, 2675983,
+  2673938, 2676742, 2676241, 2679049, 2677005, 2675734, 2676501, 2677257, 2677524, 2678282, 2679569, 2681094,
+  4064769, 2679829, 2678545, 2678022, 2677762, 2682122, 2682630, 2680336, 2680078, 2684435, 2682889, 2684933,
+  2680596, 4064769, 2679316, 2682374, 2727451, 2683157, 2685711, 2686217, 2685965, 2683654, 2684678, 2685194,
+  2686740, 2686466, 2692610, 2686995, 2688270, 2687248, 2681866, 2684176, 2687498, 2685462, 2688006, 2702609,
+  2688773, 2687764, 2689037, 2690056, 2688531, 2690582, 2691085, 2689802, 2689542, 2694675, 2693136, 2691846,
+  2691344, 2692356, 2690320, 2691608, 2694922, 2697220, 2690839, 2689299, 2692885, 2695956, 2695439, 2692115,
+  2696981, 2700292, 2696719, 2696453, 2695700, 2693395, 2697744, 2698767, 2696198, 2700815, 2698500, 2694420,
+  2698008, 2701585, 2699541, 2695188, 2697488, 2699285, 2700551, 2698260, 2699027, 2701826, 2702345, 2701332,
+  2703112, 2702100, 2702853, 2699797, 2701080, 4064769, 2703376, 2704649, 2704143, 2703876, 2705162, 2703636,
+  4064769, 4064769, 2705670, 2704405, 2707725, 2705429, 2705939, 2706178, 2706438, 2707215, 2704898, 2706948,
+  2708239, 2708503, 2709008, 2707972, 2709762, 2710286, 2731022, 2708749, 2709252, 2711060, 2707458, 2709514,
+  2710786, 2711312, 2710032, 2711561, 2710544, 2712834, 2714117, 4064769, 2715661, 0, 2711825, 2718470,
+  2712341, 2712078, 2713615, 2714886, 2715143, 2713361, 2716693, 2717448, 2716941, 2715400, 2717186, 2717971,
+  2719242, 2713104, 2717720, 2718978, 2721044, 2714388, 2719503, 2720269, 2716442, 2721540, 2715928, 2722573,
+  2720009, 2724357, 2719766, 2722831, 2718228, 2721286, 2720521, 2724881, 2722320, 2726168, 2722058, 2720789,
+  2723082, 2721808, 2723344, 2726919, 2725642, 2725898, 2727185, 2726406, 2724106, 2729989, 2726658, 2725382,
+  2730516, 2724625, 2730261, 2723864, 2727690, 2729736, 2723606, 2728198, 2730773, 2731526, 2727946, 2728710,
+  2729494, 2732297, 2731268, 2731792, 2732554, 2728454, 2732048, 2733080, 2734851, 2734082, 2733322, 2712586,
+  2734338, 2733840, 2732819, 2734598, 2736386, 2733589, 2735366, 2735887, 2736145, 2736659, 2737671, 2737925,
+  2738692, 2738946, 2737423, 2736917, 2737172, 2739722, 2738444, 2739206, 2729232, 2738191, 2739978, 2735126,
+  2739471, 2741001, 2740245, 2741258, 2740494, 2741779, 2743046, 2740752, 2741517, 2744584, 2743298, 2742792,
+  2746125, 2742029, 2744326, 2744853, 2744084, 2747658, 2742538, 2745101, 2746894, 2748677, 2743575, 2748429,
+  2742288, 2745876, 2749198, 2747145, 2747400, 2749972, 2750477, 2743823, 2749450, 2752521, 2750723, 2747920,
+  2750224, 2748949, 2749705, 2750978, 2751234, 2753295, 2751490, 2753551, 2752275, 2754306, 2752002, 2753039,
+  4064769, 2757133, 2755076, 2752789, 2756883, 2753813, 2757908, 2755587, 2751753, 2756118, 2758675, 2756366,
+  2754064, 2759426, 2757653, 2757379, 2759682, 2755844, 2758410, 2756628, 2758163, 2758931, 2754842, 2761218,
+  2760720, 2759951, 2759194, 2760981, 2760205, 2760474, 2761477, 2762754, 2763279, 2763523, 2762255, 2762515,
+  2761988, 2755347, 2763018, 2766612, 2764557, 2766338, 2763796, 2765076, 2766093, 2761748, 2769670, 2770948,
+  2769930, 2768399, 2770714, 2770192, 2764053, 2764819, 2768904, 2767874, 2772500, 2771462, 2772757, 2773004,
+  2769428, 2774786, 2771989, 2771210, 2605062, 2765594, 2777100, 2768137, 2773512, 2775316, 2778383, 2776066,
+  2773776, 2778640, 2775574, 2769174, 2779654, 2774547, 2771732, 2773269, 2776339, 2777615, 2778895, 2764298,
+  2780944, 2781188, 2781454, 2780173, 2779910, 2780685, 2777858, 2777364, 2779151, 2778122, 2779395, 4064769,
+  4064789, 2782739, 2780419, 2781703, 2784021, 2784529, 2783750, 2784260, 2782223, 4064769, 2782470, 2784774,
+  2787093, 2782992, 2785796, 2786837, 2796314, 2783247, 2785290, 0, 2785043, 2786319, 2787341, 2783500,
+  2787601, 2786061, 2789381, 2791171, 2786580, 2789134, 2790154, 2789901, 2788368, 2788116, 2785560, 2790922,
+  2787862, 2790410, 2790665, 2735638, 2788885, 2792723, 2793990, 2788627, 2789651, 2792970, 2791434, 2791957,
+  2792464, 2791701, 2793482, 2795530, 2794764, 2793742, 2794242, 2795025, 2792206, 2794506, 4064769, 2795270,
+  2797834, 2795779, 2797570, 2800136, 2796053, 2799622, 2796805, 2798613, 2797062, 4064769, 2798872, 2797332,
+  2799110, 2799891, 2800906, 2802950, 2801158, 2793236, 2799366, 2800400, 2834712, 0, 2800650, 2798352,
+  2803464, 2803220, 2798095, 2804482, 2801677, 2801418, 2802704, 2802185, 2806274, 2803981, 2802453, 2803726,
+  2805267, 2808328, 2805012, 2804756, 2805517, 2809609, 2807056, 2804244, 2808578, 2806549, 2810888, 2809348,
+  2806804, 2811141, 2801937, 2812165, 2810645, 2812424, 2811655, 2811411, 2811907, 2812675, 2813203, 2805780,
+  2812933, 2813446, 2813710, 2814214, 4064769, 2814992, 2813962, 2815234, 2814474, 2814739, 0, 2815754,
+  0, 2816533, 2815511, 0, 2816778, 2820102, 2820870, 2817795, 2809877, 2817043, 2816022, 2816275,
+  2817296, 2818822, 2819859, 2818054, 2820627, 2820368, 2817556, 2818318, 2821130, 2819078, 2821392, 2819338,
+  2823189, 2822679, 2825730, 2824964, 2826249, 2827010, 2824723, 2821896, 2821652, 2810128, 2825236, 2822939,
+  2824468, 2822163, 2819593, 2823430, 2826513, 4064789, 4064769, 2826767, 2825491, 2828563, 2826007, 2828314,
+  2829058, 2827274, 2827526, 2829845, 2829583, 2830355, 2829335, 2828813, 2831380, 2830602, 2827796, 4064769,
+  2832137, 4064769, 2830858, 2832397, 2830082, 2831121, 2834954, 2832902, 2831631, 2831876, 2832653, 2833686,
+  2833414, 2834195, 2833172, 2836232, 2833932, 2835206, 2834447, 2835462, 2835733, 2837508, 2810374, 2836482,
+  2837766, 0, 2838788, 2838287, 2837011, 2835989, 2838036, 2836753, 2837265, 2839044, 2841354, 2841609,
+  2842129, 2844681, 2845189, 2839571, 2843652, 2839312, 2840339, 4064774, 0, 2842882, 4064774, 2844943,
+  2842389, 2843923, 2839827, 2841872, 2842634, 4064787, 2843146, 4064772, 4064776, 4064787, 4064776, 4064788,
+  4064787, 4064772, 2840074, 4064769, 4064787, 4064774, 2840586, 4064774, 4064778, 4064788, 4064791, 4064770,
+  4064774, 4064795, 4064789, 4064770, 4064774, 4064769, 4064794, 2851600, 2848525, 4064795, 4064795, 2849538,
+  2846730, 2846474, 2846229, 2844420, 2849798, 2847241, 2850054, 2848782, 2848013, 2846990, 2849285, 2850306,
+  2850822, 2851330, 2852102, 2849038, 2850582, 2848282, 2847498, 2854928, 2852874, 2853636, 2852372, 2847763,
+  2854149, 2854405, 2851091, 2853389, 2855434, 2853134, 2856454, 2852627, 2855942, 2857990, 2855170, 2859530,
+  2851866, 2855690, 2857224, 2853911, 2860290, 2857474, 2856962, 2862356, 2860048, 2859024, 2862089, 2854682,
+  4064769, 2859280, 2859795, 2864134, 2866178, 3028754, 2856720, 2864397, 2860566, 2864661, 2861326, 2861576,
+  2864910, 2863110, 2866696, 2862870, 2863622, 2861846, 2867204, 2863892, 2866451, 2862609, 2865942, 2866959,
+  2869260, 2869012, 2868741, 2870284, 4064769, 2870535, 2867733, 2867464, 2865424, 2871821, 2868230, 2872073,
+  2868497, 4064769, 2871061, 2871317, 2870794, 4064769, 2881799, 2872330, 2874626, 2869781, 2875157, 2872589,
+  2873875, 2869524, 2874131, 2870036, 2874388, 2874895, 2876170, 2875408, 2873620, 2873364, 2872838, 4064769,
+  4064769, 2875668, 2875906, 4064769, 2878485, 2878728, 4064769, 2878227, 4064769, 2877187, 2876432, 2880276,
+  2882057, 2882836, 2877446, 2879758, 2881286, 2880518, 2877716, 2877972, 2929688, 2930202, 2881546, 2879251,
+  2876934, 2882313, 2879501, 2878996, 2880019, 2881034, 4064769, 2883086, 2884356, 2882579, 2884098, 2884616,
+  2880789, 4064769, 2885381, 2883859, 2886150, 2885894, 2883605, 2883349, 2887444, 2886402, 2886662, 2886922,
+  2888962, 2894103, 2887188, 2889226, 2887939, 2889486, 2887696, 2890504, 2885140, 2892034, 2890760, 2891526,
+  0, 2891024, 2889734, 2892290, 2890262, 2890005, 2888719, 2894601, 2891284, 2888202, 2892552, 2895366,
+  2891796, 2893328, 2892820, 2893071, 2884874, 2893578, 2894863, 2896135, 2894338, 2896388, 2899202, 2897154,
+  2895636, 2896656, 2899970, 2897410, 0, 2898963, 2895894, 2895124, 2897924, 2898446, 2896917, 2897685,
+  2898709, 2899477, 2900226, 2902793, 2900483, 2898195, 2901011, 2901770, 2902018, 2906626, 2899732, 2903053,
+  2903816, 2901526, 2905365, 2901268, 2900756, 2903317, 2904330, 2904084, 2907402, 2907658, 2906388, 2906885,
+  2905109, 2908170, 2907157, 2908429, 2907920, 2908688, 2910729, 2904854, 2908937, 2909957, 2906138, 2912262,
+  2909715, 2910485, 2909459, 2910222, 4064769, 2910990, 2911234, 2913289, 2914317, 2912783, 2913027, 2915845,
+  2912533, 2911504, 2914575, 4064769, 2913799, 2911746, 2913546, 2915603, 2917384, 2912019, 2915337, 2915075,
+  2919170, 2914831, 2916367, 2916866, 2916618, 2914061, 2917645, 2920708, 2920458, 2921218, 2920970, 2918921,
+  2921474, 2922245, 2918154, 4064769, 2924563, 2918422, 2921741, 2919946, 2919440, 2922511, 2923530, 2918676,
+  2919686, 2921986, 2924038, 2925066, 2922758, 2925322, 2925841, 2923024, 2923797, 2924804, 2926346, 2927109,
+  2925588, 4064769, 2927370, 2928390, 2928911, 2924307, 2926096, 2926594, 2928650, 2929158, 2929935, 2928143,
+  2931458, 2927638, 2930439, 2931202, 2931727, 2932232, 2929427, 4064769, 2926868, 0, 2930960, 2934278,
+  2933260, 2936068, 2931990, 2932499, 2932762, 2933518, 2930711, 2933780, 2934544, 2933011, 2934026, 2934793,
+  2935300, 2935050, 2935568, 2937363, 2936597, 2935813, 2936324, 2936846, 2937104, 2937606, 2938133, 2937858,
+  4064769, 2938889, 2939661, 2939157, 2938370, 2939394, 2940674, 4064769, 2945045, 2939906, 2940175, 2941194,
+  2940947, 2941459, 2942978, 2941971, 0, 0, 2940436, 2938644, 2944271, 2943490, 2941710, 2942730,
+  2943242, 2946308, 2945295, 2942235, 2945549, 2947590, 2944533, 2942485, 2946058, 2943754, 2944784, 2948868,
+  2946579, 2947345, 2948110, 2945794, 2950658, 4064769, 2950170, 4064769, 2951183, 2947860, 2949652, 2949139,
+  2950416, 2949910, 2950932, 2952202, 2952710, 2952968, 2953221, 2954242, 2951686, 2954005, 2954498, 2953484,
+  2954773, 2951426, 4064769, 2956051, 2955797, 2955537, 2957314, 2958343, 2957062, 2958596, 2957826, 2955018,
+  2956821, 2957578, 2956308, 4064769, 2956563, 2958090, 2951962, 2958858, 2960130, 2953754, 2962182, 2959626,
+  2960388, 2959374, 2959124, 2955290, 2962697, 2959891, 2960898, 2961669, 2964226, 2961941, 2960659, 2963213,
+  2965507, 2961168, 2962441, 2963734, 2962946, 2964746, 4064769, 2961428, 2963987, 2967053, 2966538, 2967813,
+  2970114, 2965270, 2967565, 2968067, 2988293, 2967315, 4064769, 2968335, 2966293, 2971654, 2966035, 2965776,
+  2970372, 2968834, 2969361, 2968586, 2964500, 2969094, 2969872, 2972426, 2970643, 2971142, 2972176, 2966799,
+  2974470, 2974982, 2969610, 2970901, 2971918, 2974739, 2973962, 2973446, 2973716, 4064769, 2972945, 2979586,
+  2976522, 2972688, 2974222, 2975242, 2977293, 2977043, 2973204, 2975497, 2975750, 2976262, 4064769, 2976019,
+  2976781, 2979330, 2977811, 2977557, 2979087, 4064769, 2981892, 2982414, 2978580, 2982658, 2983682, 2981389,
+  2978829, 2978325, 2982932, 2985492, 2981645, 2984469, 2983949, 2985226, 4064769, 4064769, 2981141, 2984721,
+  2984198, 2984964, 4064769, 2980874, 2985734, 2983174, 2983444, 2986515, 2986005, 2987283, 2986758, 2988566,
+  2987783, 2988045, 2993686, 2990340, 2987022, 2989322, 2988809, 2986256, 2989574, 2990597, 2987536, 2989839,
+  2992646, 2993413, 2991117, 2991366, 2994437, 2994949, 4064769, 2990101, 2992903, 2989077, 2991878, 2990864,
+  2995733, 2992138, 2991632, 2993158, 2997000, 2998534, 2993936, 2996738, 3051547, 2995215, 0, 2997256,
+  2998790, 2995471, 2999821, 2994708, 2997776, 2997518, 3001096, 2998024, 3000069, 3000845, 3000326, 3004169,
+  2995990, 3001360, 2996502, 3003146, 3001606, 2999318, 3002114, 3002886, 3002644, 3003650, 3005205, 3003921,
+  3000597, 3005456, 3004422, 3004934, 3006214, 3006466, 3005712, 3004698, 3007498, 3007239, 3008275, 3005962,
+  3009043, 3006978, 3010063, 4064769, 3008528, 3008013, 3011848, 3013638, 3008773, 3009295, 3009540, 3012622,
+  3012368, 3007753, 3011603, 3010582, 4064769, 3013891, 3013122, 3011330, 3012879, 4064769, 3012116, 3014415,
+  3015181, 3014914, 3011098, 3013390, 3015443, 3017226, 3018500, 3017485, 3018245, 3018773, 3016202, 3019012,
+  3020826, 3015951, 3017990, 3016458, 3019778, 3019284, 0, 3021574, 0, 0, 3020053, 3017745,
+  3038979, 3020565, 3021841, 3021322, 3021066, 3016718, 3024642, 3022100, 3019542, 3023893, 3020292, 3025421,
+  3024390, 3024136, 3022358, 3023629, 3025685, 3028484, 4064769, 3023130, 3027988, 3025174, 3024922, 3028997,
+  3029506, 3026181, 3022612, 3028231, 3026440, 3029254, 4064769, 3026960, 3030293, 3032593, 3030031, 3025935,
+  3029766, 3033101, 3030810, 3034114, 3031566, 3030545, 3035652, 3031046, 3027480, 3032340, 3031315, 3035925,
+  3032848, 3038217, 3035155, 3034387, 3037715, 3036166, 4064770, 3038734, 3033878, 3039236, 3037967, 3033354,
+  3039504, 3036420, 3037448, 4064769, 3040774, 3036674, 3037186, 3040262, 3042324, 3039754, 3041812, 3040514,
+  3041557, 3043085, 4064769, 3041034, 3044117, 4064769, 3040022, 3045378, 3044870, 3041286, 3044367, 3046916,
+  3042064, 4064769, 3047688, 3047185, 3047426, 3045638, 3046146, 3049235, 3048213, 3043345, 3047949, 3045898,
+  3045136, 3046410, 3048464, 3048713, 3049478, 3051012, 3048973, 3049738, 3053058, 3049994, 3050757, 3051266,
+  3050257, 4064769, 3052294, 4064769, 3057670, 3043599, 3053327, 3056643, 3051792, 3054101, 3052053, 3050523,
+  3053831, 3046670, 3054355, 3057412, 3055375, 3052558, 3054602, 3057162, 3054868, 3053583, 3055875, 3055117,
+  3057937, 3058189, 3056906, 3056135, 4064769, 3055622, 3059202, 3058961, 3058451, 3063564, 3056394, 3059974,
+  3059716, 3058708, 3060237, 3061525, 3061258, 4064769, 4064769, 3062026, 3059478, 3064083, 3062799, 3060489,
+  3060742, 3064330, 4064769, 3067140, 4064769, 3063818, 3064842, 3071507, 3068678, 3065623, 3064597, 3065357,
+  3063060, 3065882, 3066382, 3067657, 3066888, 3065105, 3067413, 3068166, 3068418, 3066132, 3069192, 3066648,
+  3063320, 3067924, 3069961, 3069460, 3070470, 3068934, 3070214, 3070722, 3069705, 3071239, 3070982, 3072778,
+  3074818, 3071750, 3076371, 3083027, 3073037, 3072264, 3075338, 3073293, 3098135, 3076873, 3077634, 3076102,
+  3073805, 0, 3075850, 3076611, 3075599, 3077390, 3074576, 3062538, 3077133, 3078154, 3074074, 4064769,
+  4064769, 3078671, 3078420, 3077890, 3080458, 3079941, 3081231, 3081477, 3079173, 3079700, 3081734, 3080962,
+  3078934, 3081986, 3080726, 3082260, 3082502, 3083285, 3080212, 3079426, 4064769, 3082768, 4064769, 3084570,
+  3083526, 3083795, 3084034, 3086100, 3084294, 3084806, 3086350, 3086597, 4064769, 3087125, 3085826, 3089930,
+  3085328, 3089689, 3089156, 3088898, 4064769, 3091464, 3090447, 3090703, 4064769, 3088394, 3091210, 4064769,
+  4064769, 3089428, 4064769, 3087892, 3094536, 3088141, 3093769, 4064769, 3092495, 3090963, 3091714, 3096582,
+  3087629, 3091987, 3094794, 4064769, 3090192, 3095816, 4064769, 3096070, 3094018, 0, 0, 3095317,
+  3095573, 3095053, 3092243, 3096340, 3097865, 3098894, 3097619, 3098634, 3097366, 3100937, 3097108, 3099411,
+  3099138, 3099667, 3099921, 3101698, 3096852, 3101190, 3100692, 3100176, 3101459, 3098387, 3100432, 3102985,
+  4064769, 3103493, 4064769, 3102479, 3101961, 3104517, 3102746, 4064784, 4064795, 4064784, 4064795, 4064772,
+  3102214, 4064789, 4064769, 3103242, 4064769, 3103749, 3104266, 3104021, 4064769, 4064769, 3105540, 3105798,
+  3105034, 3105296, 3106058, 3108880, 4064769, 4064769, 3109908, 3106570, 3107594, 3108101, 0, 3104788,
+  3106835, 3108614, 3106319, 3107342, 3109130, 3107855, 3111178, 3111694, 3111956, 3114244, 3113482, 3112717,
+  3108372, 3110416, 3115525, 3111440, 4064769, 3110672, 3115014, 3116049, 3117325, 3116303, 3113242, 3113748,
+  3118868, 3119364, 3114004, 3116803, 3119631, 3120147, 3115801, 3120392, 3119893, 3120654, 3121166, 3117844,
+  3120900, 3118086, 3118608, 4064769, 4064769, 3118357, 3121410, 3122946, 3119120, 3121923, 3122197, 3117073,
+  3123987, 3122703, 3123202, 3121674, 3124485, 3124738, 3126805, 3124244, 3123718, 3122448, 3123477, 4064769,
+  4064769, 3125263, 3126029, 3125510, 4064769, 4064769, 3125014, 4064769, 4064769, 3130884, 3128073, 3129107,
+  3128336, 3129876, 3128851, 3130630, 3127558, 4064769, 4064769, 4064769, 4064769, 3132181, 4064769, 3132437,
+  3127828, 3131405, 3128591, 3130388, 3129350, 3134222, 3131908, 3131144, 3134995, 4064769, 4064769, 3134479,
+  4064769, 4064769, 4064769, 3135493, 3133194, 3132948, 3133711, 3135757, 3134739, 3135253, 3133958, 3136272,
+  3136002, 3133446, 4064769, 3137302, 3137797, 3138306, 3136528, 3132688, 3138822, 4064769, 0, 3139078,
+  3138575, 3139334, 4064769, 3137045, 3139600, 3137557, 3140098, 3138074, 3142154, 3136788, 3144706, 4064769,
+  3140618, 3139861, 3142415, 3140373, 3142931, 3143188, 3144461, 3144195, 3107074, 3143951, 3141135, 3143430,
+  3142669, 3144964, 3150349, 3152923, 3141898, 3147540, 3141642, 3145481, 4064769, 3145738, 3145238, 3143690,
+  3148053, 3146506, 3149075, 3146767, 3149826, 3145999, 3147782, 3148802, 3152652, 3154438, 3155718, 3151362,
+  3149588, 3151891, 3151125, 3152142, 3150099, 3148307, 3150600, 3150861, 3155977, 3153165, 3153935, 3153667,
+  3151626, 3157766, 3154947, 3154186, 3156234, 3159810, 0, 3157514, 3157008, 3154709, 3156501, 4064769,
+  3159061, 3160072, 3160322, 3160591, 4064769, 3159558, 3161108, 3162897, 3163654, 4064769, 3160838, 3157270,
+  4064769, 3161365, 3162131, 3159317, 3163140, 3164170, 3165442, 3165954, 3161862, 3164422, 3163394, 3162372,
+  3161620, 3162630, 3164941, 3166229, 3164692, 4064769, 4064769, 3166470, 3165710, 3169799, 3170314, 3166737,
+  4064769, 3170058, 3166993, 3163924, 3167754, 3167251, 3171590, 3171846, 4064769, 3168514, 3172111, 3172367,
+  3168020, 3172618, 4064769, 3172877, 3173128, 3173637, 3170581, 3171092, 4064769, 3175430, 3176706, 3175949,
+  3174938, 3173397, 3173909, 4064769, 3176964, 3175188, 3174163, 3176207, 3175706, 3174658, 3176450, 3178250,
+  3168787, 3177475, 3177231, 4064769, 3177989, 3177736, 3174422, 3179029, 3179525, 3179280, 3178762, 3181572,
+  3181844, 3178518, 3180038, 3180294, 3182095, 3182340, 3182596, 3184132, 3182858, 4064769, 3183633, 3183123,
+  3180550, 3183886, 3181066, 3183366, 3185926, 3185155, 3186693, 3184403, 3180804, 3184642, 3184911, 3189509,
+  3187460, 3186196, 3185417, 3187980, 3190534, 3186438, 3189764, 3187220, 4064769, 3191558, 3188493, 3188230,
+  4064769, 0, 3189002, 3190031, 3190794, 3191811, 3192578, 3193098, 3188746, 4064769, 3193858, 3186966,
+  3189264, 3192077, 4064769, 3191306, 3192838, 3192336, 3193346, 4064769, 3196421, 3195916, 3191059, 3195664,
+  3194370, 3195142, 3197702, 3194901, 3197444, 3196162, 4064769, 3193619, 4064769, 3201797, 3198210, 3194645,
+  3194128, 3196698, 3197205, 3196941, 3197969, 3195412, 3201297, 3198984, 3202308, 3202562, 3201552, 3199750,
+  3204356, 3201044, 3202061, 3200262, 3198483, 3200006, 4064769, 3198741, 3204628, 3205903, 3206154, 3199253,
+  3206402, 3202822, 3205642, 3206926, 4064769, 3205395, 3206668, 3208198, 4064769, 3205130, 3203589, 3208457,
+  3171334, 3207170, 4064769, 4064769, 3208972, 3209480, 3207450, 4064769, 4064769, 3207686, 3209222, 3210243,
+  4064769, 3210769, 4064769, 3209734, 3210502, 3207946, 3213837, 3212821, 3211526, 3208724, 3209999, 3212038,
+  4064769, 3214596, 3213578, 4064769, 3214090, 3211793, 3211028, 3214850, 3213329, 3211284, 3212303, 3214351,
+  3215116, 3170826, 4064769, 0, 3216642, 4064769, 1966598, 3131669, 3216386, 3217679, 3204117, 3215632,
+  3218191, 3213077, 3217154, 3216145, 3212552, 3217434, 3217942, 3216906, 3218709, 3215878, 4064769, 3220237,
+  3221509, 3218454, 3218965, 3222537, 3221766, 3222031, 3219718, 3222798, 3219210, 3221258, 3219464, 3223059,
+  3223555, 3223322, 3222285, 3223817, 4064769, 3225877, 3224846, 3228936, 3225615, 3226381, 3227652, 3220500,
+  3225095, 3227157, 3225360, 4064769, 3229461, 3227394, 3226118, 3224595, 3226899, 3228433, 3227910, 3230220,
+  3228176, 4064769, 3233540, 3229698, 3231509, 3235334, 3232789, 3234054, 3232015, 3229207, 3233807, 3232521,
+  3231760, 3235844, 3234580, 3233306, 3234323, 3232266, 3236106, 3235088, 3237646, 3237904, 4064769, 3236877,
+  3236368, 3235610, 3238148, 3238922, 3234825, 3236614, 3239172, 3239437, 3237125, 4064769, 4064769, 3241478,
+  3242246, 3242005, 3245079, 3241738, 3242505, 3238676, 4064769, 3243023, 3243273, 3242773, 3244053, 3244298,
+  3243784, 3238415, 3243525, 3244557, 3240980, 3245322, 3246090, 3239696, 3246342, 3244821, 3245584, 3245835,
+  3248389, 3246602, 4064769, 3247376, 3246860, 4064769, 3240468, 3247629, 3247123, 4064769, 3248646, 4064769,
+  3249930, 3249172, 3247889, 3248898, 3249684, 3251987, 3250445, 4064769, 3250197, 3248143, 4064769, 3252748,
+  3249428, 4064769, 3250950, 3251480, 3253008, 3250708, 3251220, 3254530, 3252240, 3255822, 3255057, 3254037,
+  3254786, 3256079, 3255309, 3254282, 3257354, 3252489, 3256847, 3256586, 3253524, 3253264, 3257103, 4064769,
+  3241222, 4064769, 3258383, 3256339, 3258124, 3259663, 3258633, 4064769, 3258895, 3259917, 3257622, 3260169,
+  3259405, 3257871, 3259149, 3262212, 3260930, 3251719, 4064769, 3266310, 3260433, 3261710, 3266052, 3260691,
+  4064769, 3264532, 3261204, 3265542, 3262997, 3265812, 4064769, 3262474, 3262737, 3267078, 3266822, 3267603,
+  4064769, 3265300, 3265050, 4064769, 3261461, 3263498, 3261962, 3266580, 3268627, 3269647, 3267348, 3270662,
+  3269903, 3270413, 3267856, 3271170, 3268106, 3270925, 3264016, 4064769, 3272710, 3272450, 4064769, 3270150,
+  3271951, 3277070, 3271430, 4064769, 3268890, 3274517, 3272198, 3272981, 4064769, 4064769, 3273235, 3273478,
+  3271700, 4064769, 3276303, 3268365, 4064769, 3275539, 4064769, 3274768, 3280134, 3275279, 3275028, 3275798,
+  3274001, 3276565, 3276048, 3276806, 3278342, 3278861, 3277589, 3277322, 4064769, 3279375, 3280650, 3277844,
+  3281425, 3278612, 3279120, 3281926, 3283220, 3281670, 3279882, 3282186, 3283731, 3280912, 3286035, 3286536,
+  3279632, 3282458, 3286282, 3284495, 3284239, 3282690, 3287053, 3287558, 3287318, 3289107, 3284756, 3285521,
+  3287813, 3286800, 3283478, 3288084, 3288322, 3285776, 3290634, 3288593, 3289876, 3288842, 3291418, 3290114,
+  4064769, 3289612, 3291924, 3290370, 3290893, 3289346, 3291656, 3292955, 3292420, 3293965, 4064769, 3296259,
+  3285261, 3295509, 3295253, 3294733, 3294485, 3294978, 3292694, 3298054, 3297039, 3296014, 3293706, 4064769,
+  3300102, 3299334, 4064769, 3297557, 3297286, 3292180, 3296787, 3299605, 3299845, 3300618, 4064769, 4064769,
+  3296534, 4064769, 3299075, 4064769, 3302414, 3300365, 3298836, 3297798, 3298562, 3300880, 3308058, 3303176,
+  3304720, 3302675, 3303690, 3302154, 3302933, 3301652, 3301908, 3301385, 3303437, 3303942, 3304201, 3305990,
+  3304975, 3301124, 4064769, 3305487, 3306260, 4064769, 3308296, 3306516, 3308806, 3306771, 3307018, 3307539,
+  3307281, 3309331, 3310088, 4064769, 3307789, 3308550, 3310341, 3309828, 3311125, 3311629, 3311366, 3312646,
+  3313425, 4064769, 0, 3314193, 3310602, 3313929, 3312405, 3312154, 3313666, 3313173, 3316997, 3312906,
+  3315473, 4064769, 3314961, 3315728, 3314440, 4064769, 3317268, 3317768, 3314694, 3309075, 3318533, 3319060,
+  4064769, 4064769, 3315206, 3315970, 3318022, 3316752, 3316482, 3319309, 3320070, 3330071, 3320335, 3318804,
+  3317524, 3319568, 3320580, 3321610, 3319818, 3322372, 3322118, 3320834, 4064769, 3318291, 3323411, 3322639,
+  3322895, 3323658, 3324166, 3324422, 3321877, 3325443, 3323920, 3321108, 4064769, 3324678, 3327238, 3325203,
+  3321364, 3323155, 3326212, 3325972, 3327504, 3325715, 3324934, 3328781, 3326466, 3327752, 3326722, 3329038,
+  3328271, 3329794, 3331338, 3330573, 3331588, 3329546, 3326997, 3329286, 4064769, 3330320, 3331091, 3333638,
+  3330822, 4064769, 3331857, 0, 3333128, 3332371, 3332890, 3332616, 4064769, 3335953, 0, 3332117,
+  3334165, 3336719, 3333901, 3336198, 3333390, 3336468, 3334922, 3336974, 3338498, 3338242, 3334672, 4064769,
+  3335445, 3339277, 4064769, 3337236, 3334424, 3337491, 3337747, 3335188, 3339027, 4064769, 3340049, 3340290,
+  3338768, 3339542, 3337990, 3341065, 3341581, 3341317, 3339796, 3340552, 3335695, 3341830, 3340808, 3342352,
+  3342102, 3342598, 3343386, 3343114, 4064769, 3342864, 3343622, 4064769, 4064769, 3345669, 3344152, 4064769,
+  4064769, 3345173, 4064769, 3346186, 3351311, 3343881, 3346946, 3345930, 3347226, 4064769, 3347464, 3345414,
+  3348485, 3348234, 3349506, 3344916, 3350278, 3351558, 3350018, 3350532, 3351810, 3349781, 3353605, 3352324,
+  3352079, 4064769, 3352596, 4064769, 3350804, 3352838, 3354120, 4064769, 4064769, 3354886, 3354629, 3348758,
+  3349270, 0, 0, 3353107, 3357190, 3354388, 3357956, 3389443, 3355906, 4064769, 4064769, 3355151,
+  3353879, 3355402, 3351062, 3356426, 4064769, 3356170, 3357715, 3355670, 3353364, 3358735, 3358484, 4064769,
+  3357442, 3356930, 3359238, 3359770, 3358993, 4064769, 3360788, 3358222, 3362054, 3362564, 3359501, 3361559,
+  3361286, 3361043, 3362310, 4064769, 3361802, 3360002, 3360276, 3364102, 3362822, 3363334, 3363842, 4064769,
+  3363592, 3363082, 3364879, 4064769, 3364629, 4064769, 3364354, 3356685, 4064769, 3365636, 3368202, 3370768,
+  3368454, 3366402, 3365894, 3366150, 3365391, 3369218, 3368979, 4064769, 3369734, 3371014, 3370245, 3367437,
+  4064769, 3368726, 3367957, 3365140, 3369990, 3367696, 3370502, 3372303, 3360532, 3369492, 4064769, 3375880,
+  3376134, 3371780, 4064769, 3371283, 3373077, 3372564, 3373585, 3376399, 3372802, 3376659, 4064769, 3373830,
+  4064769, 4064769, 3377678, 3375362, 3374094, 3374612, 3374863, 4064769, 4064769, 3375622, 4064769, 3375114,
+  3379722, 3379221, 3379987, 4064769, 4064769, 3380748, 4064769, 4064769, 4064769, 3376901, 3381258, 3378957,
+  3383565, 4064769, 3381766, 3379461, 3382799, 4064769, 4064769, 3453467, 3384088, 3382022, 0, 0,
+  3383055, 3385606, 3382298, 3381012, 3382545, 3381520, 3383302, 3384333, 3386374, 3386122, 3384596, 3384834,
+  3383828, 4064769, 4064769, 3385875, 3386886, 3385363, 3385109, 4064769, 4064769, 3387397, 3387157, 3389968,
+  3388429, 3387670, 3349013, 3388682, 3387924, 3388181, 3388941, 4064769, 3393797, 4064769, 3390740, 3394324,
+  3389190, 4064769, 3386644, 3391248, 3392270, 3391509, 3392021, 3391765, 3395846, 3395349, 3390983, 3396614,
+  3394820, 3394050, 3397139, 4064769, 3395089, 3398146, 3397902, 3393302, 3395604, 3398406, 4064769, 3394576,
+  3399685, 3400211, 3398666, 4064769, 4064769, 3401745, 3401493, 3402253, 3400458, 3402775, 3397652, 4064769,
+  3403277, 3403012, 3396882, 3399946, 4064769, 3399188, 3400730, 4064769, 3398928, 3404302, 3400980, 3401236,
+  4064769, 3401994, 3406341, 3403799, 3402505, 3406869, 3397382, 3405583, 3406594, 3405837, 4064769, 3406100,
+  3408403, 3407626, 4064769, 3410436, 3408905, 4064769, 3409684, 4064769, 4064769, 3407123, 3409941, 3411974,
+  3410708, 3410964, 3411726, 4064769, 3407380, 3409434, 3409161, 3411477, 3412234, 3413514, 4064769, 3412495,
+  3411222, 3413762, 3414020, 4064769, 3414287, 4064769, 4064769, 4064769, 4064769, 3414533, 3414786, 4064769,
+  3413274, 3412757, 3419925, 3415302, 3413008, 3415814, 4064769, 4064769, 4064769, 4064769, 3415050, 3415562,
+  3416330, 4064769, 3447831, 3416582, 3454235, 3418126, 3419400, 3419663, 3420418, 3416084, 3417352, 3417862,
+  4064769, 3417609, 3418374, 3416852, 3418893, 3417104, 3420179, 3420682, 4064769, 4064769, 4064769, 4064769,
+  4064769, 3423759, 4064769, 3421716, 3425540, 3426573, 3422722, 3423508, 3424275, 3424531, 4064769, 3420954,
+  3421449, 3422996, 3425801, 3426840, 3422474, 3427333, 4064769, 3427590, 3427853, 3425044, 3427092, 3426063,
+  3428102, 3428362, 3429126, 4064769, 3430150, 3428627, 3422221, 4064769, 3426314, 3430918, 3430676, 4064769,
+  3430420, 3428870, 3431690, 3432463, 3432211, 4064769, 3431953, 3432724, 4064769, 3429898, 3433994, 3435022,
+  3433488, 3429378, 3432973, 4064769, 4064769, 3434767, 3431444, 4064769, 3437066, 3437570, 3435539, 3434257,
+  3434512, 3435284, 3435797, 3433738, 3433222, 3436308, 3436810, 3436563, 3438089, 3437329, 3437845, 3436052,
+  4064769, 3439626, 3438338, 4064769, 3438611, 3443714, 3431173, 3439885, 3439107, 3439381, 3441158, 3441942,
+  3438858, 4064769, 3440148, 3443219, 3443482, 3441412, 3444250, 3440664, 3441666, 3446532, 3442179, 3442435,
+  3442690, 4064769, 3445514, 3440405, 4064769, 3447572, 4064769, 3447306, 3443985, 4064769, 3448326, 4064769,
+  3448838, 3453978, 3448591, 0, 4064769, 4064769, 3447066, 3446022, 4064769, 3449364, 3446292, 3446790,
+  3449101, 3451394, 3449875, 3451910, 3450131, 3455753, 3449606, 3452678, 3450900, 3448070, 3452168, 3451157,
+  3450374, 3451667, 3452938, 3452436, 4064769, 3454469, 3456002, 4064769, 3453706, 3454980, 3453201, 3455247,
+  3454746, 3457038, 3455494, 4064769, 3457811, 3457295, 3456529, 3457546, 4064769, 4064769, 3460612, 3459330,
+  4064769, 4064769, 4064769, 3456788, 3463174, 3464206, 3462916, 3458069, 3459860, 3461910, 3458822, 3462154,
+  3464469, 3460362, 3458580, 3460117, 3462413, 3465734, 3461382, 3459604, 3461140, 3462676, 3460878, 3465222,
+  3463434, 3463695, 3465986, 3461642, 3465481, 3466262, 3466517, 3463951, 3464710, 3467284, 3468045, 3466769,
+  3470594, 3467793, 3464976, 3470090, 4064769, 3467024, 4064769, 4064769, 3471112, 4064769, 3471379, 4064769,
+  3471877, 3472142, 4064769, 4064769, 3473167, 3472392, 3468304, 3473415, 4064769, 3472902, 3469318, 4064769,
+  4064769, 3468554, 3470868, 4064769, 3471636, 3470342, 3473670, 3475204, 3475477, 3472660, 3476230, 3476486,
+  4064769, 3475987, 4064769, 3469846, 3477012, 4064769, 3477252, 3474964, 4064769, 3473926, 3477781, 3477510,
+  4064769, 3479571, 3474434, 3478025, 3475718, 3476738, 3482645, 3478534, 3490580, 3478789, 3478286, 3480329,
+  4064769, 3479824, 3481861, 3481352, 3480838, 4064769, 3480588, 3479060, 4064769, 4064769, 3481605, 3482890,
+  3479315, 3480081, 3483396, 3482118, 4064769, 4064769, 3483152, 3481107, 3474690, 3484943, 4064769, 4064769,
+  3483669, 4064769, 3484429, 3483930, 3482384, 4064769, 3484179, 3486212, 3486726, 3485450, 4064769, 3486485,
+  3485204, 3494164, 3485715, 3487497, 3485958, 3487242, 3488269, 3489028, 4064769, 3474186, 3488794, 3487750,
+  3489546, 4064769, 3872530, 3490306, 3492874, 3486996, 3492366, 4064769, 3488522, 3489813, 3489301, 4064769,
+  3492617, 3490064, 3493642, 3491348, 3492113, 3491093, 3494922, 3495942, 4064769, 3490835, 3493137, 4064769,
+  4064769, 4064769, 3494671, 4064769, 4064769, 3495441, 4064769, 3496966, 4064769, 3495706, 3496461, 3493908,
+  3497755, 4064769, 3493386, 3494422, 4064769, 3496710, 3497218, 3496212, 4064769, 4064769, 3500805, 3491856,
+  3499782, 3498762, 3498257, 3499029, 4064769, 3499523, 3498006, 3495184, 3501576, 3497498, 3499277, 4064769,
+  3502106, 4064769, 3502854, 3500554, 3502338, 3498522, 3500308, 3503124, 3501331, 3504388, 3505666, 3500052,
+  4064769, 3502613, 3505940, 4064769, 3501066, 3504642, 3501844, 3503376, 3505173, 4064769, 3506965, 3503635,
+  3506191, 3504136, 3507219, 3506690, 4064769, 3509511, 3507458, 3503893, 3509011, 4064769, 3510031, 3509267,
+  3507714, 3510803, 3506438, 3511053, 3508500, 3512324, 3511827, 3512590, 3513096, 3509762, 4064769, 3510292,
+  3514884, 3514118, 3505424, 3514389, 3513875, 3513606, 3515909, 3515149, 4064769, 3514640, 3511306, 3516181,
+  3516426, 3515658, 3512848, 3516930, 3517446, 4064769, 3518490, 4064769, 4064769, 3516688, 3517709, 3522054,
+  3519234, 3515413, 3517972, 3520013, 3518225, 3520533, 3518986, 3518739, 3522310, 4064769, 3523085, 3522566,
+  3517207, 3523846, 3520778, 4064769, 3521286, 3522832, 3519754, 4064769, 3525893, 3523599, 4064769, 3525125,
+  3524877, 4064769, 3524106, 4064769, 3527429, 3523344, 3526146, 3524358, 3527700, 4064769, 4064769, 3527181,
+  3526419, 3526658, 3525652, 3533065, 3528461, 3526918, 3528214, 3529990, 3529487, 3525397, 3527946, 3528711,
+  3530762, 3528975, 3531027, 3531778, 3529738, 3532808, 3531524, 3532548, 3530257, 3530506, 4064769, 4064769,
+  3532051, 3535366, 3534858, 4064769, 3531268, 3534101, 4064769, 3535629, 3533583, 3535885, 4064769, 3540746,
+  3534598, 3537929, 4064769, 3538181, 4064769, 3538694, 3537427, 4064769, 3535110, 3538436, 3537167, 3539972,
+  3536394, 3536660, 3538950, 3539462, 3532290, 3537684, 3536134, 3540239, 3539717, 4064769, 4064769, 4064769,
+  4064769, 3541519, 3539220, 4064769, 3540482, 4064769, 3541779, 3543311, 3541011, 3543566, 3542530, 3542794,
+  3544073, 3542029, 3542292, 3543818, 3541268, 3544584, 3544836, 3545865, 3545101, 3544335, 3543060, 3545346,
+  3545606, 3546122, 3546889, 3547400, 3546374, 4064769, 3548942, 3547924, 4064769, 3546645, 3549973, 3547654,
+  3549197, 4064769, 4064769, 0, 3548426, 3550741, 3548170, 3550483, 3549698, 3547156, 3551252, 3552788,
+  3550991, 3551494, 4064769, 3548685, 4064769, 3555334, 3551763, 3552021, 3549456, 3552532, 3552262, 4064769,
+  3555855, 3556111, 3555593, 3556361, 3554562, 3554325, 3554826, 3558150, 3553801, 3555093, 3558420, 3553556,
+  3558665, 4064769, 3557382, 3556866, 4064769, 3559953, 3557141, 3557897, 3557638, 3556634, 3560198, 3561475,
+  3558932, 3561986, 4064769, 3559190, 3560469, 3559703, 3564565, 3559444, 3561738, 3562509, 3563279, 3563785,
+  3565318, 3560980, 3563540, 3564047, 4064769, 3560717, 3565583, 3561238, 3564301, 3566349, 4064769, 3566606,
+  3567366, 3566863, 3565834, 3564822, 3567878, 3567119, 3568902, 4064769, 3565076, 3567623, 3568151, 3566102,
+  3569410, 3570182, 3569173, 3568650, 3569679, 3570694, 3570451, 3569924, 3572482, 4064769, 3570950, 4064769,
+  3571207, 3573250, 4064769, 3573775, 3574281, 3575567, 3572738, 3571719, 4064769, 3575046, 4064769, 4064769,
+  3572234, 3604504, 3575302, 3574538, 3576339, 3577094, 3571476, 3577862, 3571981, 3573001, 4064769, 3576072,
+  4064769, 3588358, 3577346, 3578901, 4064769, 3578383, 3578116, 3579151, 4064769, 3579407, 4064769, 3581197,
+  4064769, 3577620, 3580682, 3579923, 3579650, 3578640, 3580418, 4064769, 3591178, 3585805, 4064769, 4064769,
+  3586308, 3582484, 3583746, 4064769, 3580182, 4064769, 3581722, 3583240, 3580944, 3582996, 3581974, 3583508,
+  3588614, 3584020, 3588109, 3584276, 4064769, 3586068, 4064769, 3587078, 3589892, 3584784, 3587604, 3590147,
+  3587861, 3590406, 3589395, 3589651, 4064769, 3590927, 3588885, 3591690, 3590661, 4064769, 3592202, 3586836,
+  3592458, 3589140, 3591956, 3592708, 3593738, 3591443, 4064769, 3587348, 3593491, 3593228, 3595017, 4064769,
+  4064769, 4064769, 4064769, 3595537, 3596549, 3592975, 3596058, 3594242, 3594010, 3597069, 3597327, 3597844,
+  4064769, 3594515, 3598868, 4064769, 3599891, 3600132, 4064769, 4064769, 3596298, 3596820, 4064769, 3600661,
+  4064769, 3595270, 4064769, 4064769, 3597584, 4064769, 4064769, 3599124, 4064769, 3600393, 3599636, 3601935,
+  3598342, 4064769, 3602438, 3599362, 4064769, 4064769, 3598100, 3604233, 4064769, 3603466, 3603987, 0,
+  3601172, 0, 0, 3605261, 3602698, 3602950, 3603733, 3607302, 3603220, 4064769, 3606286, 3605012,
+  3605523, 3604749, 3609346, 3605780, 3606541, 3607814, 3608085, 3609094, 3609615, 3608842, 3608596, 4064769,
+  3608346, 3609871, 3607046, 4064769, 4064769, 4064769, 3610901, 3610129, 4064769, 3611401, 4064769, 3611662,
+  4064769, 4064769, 3614228, 4064769, 3610371, 3612176, 4064769, 3611909, 4064769, 3612934, 3614487, 3612674,
+  4064769, 4064769, 4064769, 3611156, 4064769, 3622675, 3618582, 3619343, 3615238, 4064769, 3612436, 3617286,
+  3613194, 3618054, 3613968, 3618310, 3615764, 3619846, 3620106, 3613446, 3617552, 4064769, 4064769, 3614996,
+  3619078, 3621122, 3621636, 3618837, 3620628, 3621382, 4064769, 3623180, 3619590, 3616522, 4064769, 4064769,
+  4064769, 3624966, 4064769, 4064769, 4064769, 3620884, 4064769, 4064769, 3625236, 3626004, 3626502, 3624708,
+  3622416, 4064769, 3622918, 3622150, 4064769, 3626242, 4064769, 3623444, 3627018, 4064769, 3628806, 4064769,
+  4064769, 3625492, 3625748, 4064769, 3626767, 3627535, 3623699, 3627271, 4064769, 3629071, 3629327, 3628564,
+  3628047, 4064769, 4064769, 4064769, 3631110, 4064769, 3627779, 4064769, 3629585, 3630356, 4064769, 3631366,
+  3630868, 3633427, 3632917, 3633683, 3629844, 4064769, 3634442, 3631618, 4064769, 4064769, 3630612, 4064769,
+  3632154, 4064769, 3635469, 3634946, 3635726, 3631889, 4064769, 4064769, 4064769, 4064769, 3636742, 4064769,
+  3637002, 3638042, 3637509, 4064769, 3633940, 3638278, 3635206, 4064769, 3634196, 4064769, 4064769, 3634708,
+  4064769, 3640838, 3635970, 4064769, 4064769, 3639054, 3637780, 3641094, 3641359, 3640596, 3638790, 3641858,
+  3641605, 4064769, 3638548, 3639810, 4064769, 3639316, 4064769, 3642377, 3645974, 3632656, 3640084, 3640340,
+  3642122, 3643140, 3642634, 3643413, 3642900, 3645442, 3646212, 3644937, 3643669, 3643918, 3645194, 3639556,
+  3644432, 3644686, 4064769, 3644181, 3645706, 3649542, 3646989, 3646474, 3647236, 3646740, 4064769, 4064769,
+  3647498, 3637269, 4064769, 3648004, 3649293, 3650323, 3649805, 3650573, 3652109, 3647764, 3648538, 4064769,
+  3649030, 4064769, 4064769, 4064769, 4064769, 3648788, 4064769, 4064769, 4064769, 3652885, 4064769, 3653646,
+  4064769, 4064769, 3654150, 3654419, 4064769, 4064769, 3654675, 4064769, 4064769, 3655172, 4064769, 4064769,
+  3655700, 3653903, 4064769, 3653396, 4064769, 3650825, 4064769, 4064769, 3656723, 3657225, 3657990, 3656970,
+  4064769, 4064769, 3655951, 3654932, 4064769, 4064769, 3655444, 3658252, 3656198, 3659268, 3657492, 3653125,
+  3656464, 4064769, 4064769, 4064769, 3658771, 3659018, 4064769, 3657749, 4064769, 3661830, 3660053, 3661070,
+  3660802, 3660557, 4064769, 3662084, 4064769, 3661325, 3662854, 3663637, 4064769, 4064769, 3661584, 3659529,
+  4064769, 3662608, 4064769, 3662355, 3664133, 4064769, 3664646, 3663364, 4064769, 3663888, 3664912, 3663124,
+  3664404, 3665173, 3666185, 3665670, 3666963, 3665423, 3665940, 4064769, 3666442, 4064769, 4064769, 4064769,
+  4064769, 4064769, 3668239, 3668751, 3666710, 4064769, 4064769, 3667206, 3667974, 3667462, 3668997, 3669780,
+  3669254, 3672084, 4064769, 3672340, 3672578, 3670026, 4064769, 4064769, 4064769, 3670278, 4064769, 4064769,
+  4064769, 4064769, 3674639, 3670786, 3673619, 3671573, 4064769, 3674127, 3670534, 3677717, 3675142, 4064769,
+  3673092, 3684635, 3673364, 3672851, 4064769, 3674886, 3675401, 3673861, 3676174, 3676674, 3677190, 3671060,
+  3674385, 4064769, 3671814, 3675910, 3678726, 4064769, 4064769, 3677459, 3678223, 3676426, 4064769, 3682565,
+  4064769, 4064769, 3680532, 3677978, 3675668, 3678480, 4064769, 3678985, 3679494, 4064769, 4064769, 3679248,
+  3679764, 3681026, 3685124, 4064769, 3681818, 3680789, 4064769, 3682836, 3683597, 3681300, 4064769, 3681556,
+  4064769, 3685897, 3683092, 3686671, 3684879, 3685385, 3687940, 3683344, 3682058, 3683849, 3684102, 3688452,
+  4064769, 4064769, 3688968, 3685638, 4064769, 3686166, 4064769, 3686406, 3686914, 3684372, 4064769, 3689741,
+  3690517, 3690772, 3691268, 4064769, 4064769, 3690255, 3687446, 4064769, 3691528, 3691018, 4064769, 4064769,
+  4064769, 3691797, 3692813, 3693332, 0, 3693589, 3694090, 3694853, 3692303, 3693062, 3692564, 3692042,
+  3690004, 3695117, 3695878, 4064769, 3693827, 3696134, 3695383, 4064769, 4064769, 3695626, 3698704, 3698184,
+  3697935, 4064769, 3694358, 4064769, 4064769, 3699990, 3700493, 3697178, 4064769, 3700749, 3698454, 3700231,
+  3701268, 3700996, 3701521, 3697684, 3696650, 4064769, 3702789, 4064769, 3699210, 3703046, 3699476, 3699732,
+  3701762, 3703316, 4064769, 3704070, 3702536, 3702278, 4064769, 4064769, 3704582, 3705093, 3704855, 3705348,
+  3702036, 3706122, 3705877, 3703567, 4064769, 4064769, 3708678, 0, 3705610, 3703828, 3707145, 3706889,
+  3706639, 3704340, 3707407, 3707654, 3706388, 3709190, 4064769, 4064769, 4064769, 3710479, 3708933, 3708162,
+  3709968, 4064769, 3709461, 3710724, 3710224, 3707919, 4064769, 3708430, 4064769, 4064769, 3714566, 3714319,
+  3714054, 3710996, 3711508, 4064769, 4064769, 3711248, 3715348, 3716614, 3717634, 3716371, 3716876, 4064769,
+  3715599, 4064769, 3717135, 3717391, 3719688, 3715085, 3714831, 3718660, 3718919, 4064769, 3719174, 3720196,
+  3719949, 3725828, 3718421, 3719433, 3718165, 3720454, 3720710, 3720969, 3717908, 3721218, 4064769, 3712021,
+  3721482, 3721737, 3722517, 4064769, 3723526, 3722758, 4064769, 4064769, 3722254, 3723266, 3723010, 4064769,
+  3724040, 4064769, 4064769, 3724307, 3723791, 3722004, 3724809, 3727379, 3727622, 4064769, 4064769, 4064769,
+  3728392, 3725063, 3724559, 3727884, 4064769, 4064769, 3729165, 3726082, 4064769, 0, 4064769, 3726342,
+  3726854, 0, 3731718, 3716116, 3728898, 3728660, 4064769, 3734020, 3730963, 3730709, 3726605, 3729941,
+  3734278, 3730458, 3730182, 4064769, 3735558, 3731473, 3732500, 4064769, 3735813, 3729684, 4064769, 3735315,
+  4064769, 3733274, 3732742, 3733780, 3736595, 4064769, 4064769, 3731988, 3736079, 4064769, 3735060, 3725591,
+  3737354, 3737103, 3733014, 3737626, 4064769, 3736848, 4064769, 4064769, 3736340, 3739402, 3739142, 3738644,
+  3739914, 3734790, 3733517, 4064769, 4064769, 4064769, 3739669, 3741193, 3737876, 3740685, 4064769, 3741962,
+  3740943, 3738900, 3740422, 3741442, 0, 3740172, 3742227, 3742995, 4064769, 3742474, 3744518, 4064769,
+  4064769, 3743247, 3743508, 3743764, 3744013, 3741716, 3745797, 3744782, 4064769, 3745555, 3255562, 3746053,
+  3745290, 3747082, 3746330, 3744276, 3747846, 3746566, 4064769, 3747343, 3748360, 4064769, 4064769, 3748879,
+  4064769, 3748116, 4064769, 4064769, 3746842, 3748628, 3752966, 4064769, 3752453, 3750163, 3749909, 3750419,
+  3751445, 3751695, 3752211, 3753221, 3750932, 3751188, 3753989, 3753730, 3754757, 4064769, 4064769, 3753491,
+  3749647, 3755015, 3754261, 3755781, 3754517, 4064769, 3756307, 3757318, 4064769, 3755273, 3756058, 3757066,
+  4064769, 4064769, 3756570, 3758342, 3755540, 3757577, 3757837, 3758598, 3759118, 4064769, 3761412, 4064769,
+  3756820, 3760906, 4064769, 3758869, 4064769, 3759635, 4064769, 3758100, 4064769, 4064769, 3762703, 3760149,
+  3759891, 3760661, 3745044, 4064769, 4064769, 3759386, 3761154, 3763220, 3764496, 3763983, 4064769, 4064769,
+  4064769, 4064769, 4064769, 3762953, 4064769, 4064769, 4064769, 4064769, 3761686, 4064769, 4064769, 4064769,
+  3765258, 3763458, 3752723, 4064769, 3766292, 0, 3764756, 3762182, 3766029, 4064769, 3764234, 4064769,
+  3765012, 3765524, 3766793, 3767046, 3765780, 3767306, 3766543, 4064769, 3769606, 4064769, 4064769, 4064769,
+  3767572, 3767817, 4064769, 3768085, 3768852, 3769862, 4064769, 4064769, 3768341, 4064769, 4064769, 3772180,
+  3768578, 4064769, 3770906, 4064769, 3738389, 3772422, 4064769, 3769107, 4064769, 3771914, 3772947, 4064769,
+  3771665, 3771415, 4064769, 3773188, 3772674, 3771156, 4064769, 4064769, 4064769, 4064769, 3769354, 4064769,
+  3773968, 3770378, 3770634, 4064769, 3774483, 3774726, 4064769, 4064769, 4064769, 3776517, 4064769, 3775491,
+  4064769, 3775747, 3777029, 3773460, 3775247, 4064769, 4064769, 4064769, 4064769, 4064769, 3774986, 4064769,
+  3778566, 3776020, 3778829, 3779853, 3777290, 3778324, 4064769, 3779092, 3779330, 4064769, 4064769, 3776774,
+  3781391, 3781902, 3782917, 3780628, 3780369, 3780112, 4064769, 3783439, 3782676, 4064769, 4064769, 3784981,
+  3779586, 3783950, 4064769, 3781122, 4064769, 3783188, 3782146, 4064769, 4064769, 3785487, 4064769, 3783683,
+  3780877, 3786263, 3785989, 4064769, 3788038, 4064769, 4064769, 3787795, 3785226, 3784468, 3788308, 3784724,
+  4064769, 4064769, 4064769, 4064769, 4064769, 3786516, 4064769, 3789065, 3788819, 3785734, 3786774, 3789588,
+  3789830, 3790340, 4064769, 4064769, 4064769, 3789325, 3790082, 3792136, 3791898, 4064769, 4064769, 3787536,
+  4064769, 3788564, 3790608, 3791626, 4064769, 3792661, 3790869, 4064769, 3791370, 4064769, 4064769, 4064769,
+  4064769, 3792904, 3794445, 3793685, 3795204, 4064769, 4064769, 3793178, 3793940, 3791111, 4064769, 3795477,
+  3792386, 4064769, 4064769, 4064769, 3793428, 4064769, 3796495, 3794180, 4064769, 3797263, 3796757, 4064769,
+  4064769, 4064769, 4064769, 4064769, 4064769, 3795732, 4064769, 3795982, 3804684, 3797508, 3797773, 4064769,
+  3799044, 3804186, 3794698, 3794946, 3796246, 3798026, 3799561, 0, 3800073, 3800329, 3799812, 3798790,
+  3784202, 4064769, 3798548, 3801866, 3798278, 4064769, 3800591, 3804934, 4064769, 4064769, 3801101, 4064769,
+  3801616, 3805454, 3797014, 3801364, 3802133, 3806470, 3806726, 3800858, 3802897, 3807238, 4064769, 3802645,
+  3807498, 4064769, 3803925, 4064769, 4064769, 3808532, 4064769, 4064769, 4064769, 4064769, 3809798, 4064769,
+  4064769, 3810069, 3807002, 3808262, 4064769, 3809296, 3808002, 3805962, 3810312, 4064769, 4064769, 3809542,
+  4064769, 3807750, 3808788, 3809044, 3810574, 4064769, 3811334, 4064769, 3811086, 4064769, 3802389, 3812362,
+  4064769, 3810836, 3812610, 3812872, 4064769, 4064769, 3813136, 3811594, 3813890, 4064769, 4064769, 4064769,
+  3811860, 3814159, 3814658, 3814406, 3812116, 3813647, 3814929, 3813396, 4064769, 3815182, 3816710, 3815690,
+  4064769, 3819786, 3815957, 3816208, 4064769, 4064769, 3815444, 4064769, 3821064, 3818771, 3822088, 3822596,
+  3818516, 3819028, 3817236, 3820819, 4064769, 4064769, 3819541, 3821830, 3820035, 4064769, 4064769, 3823375,
+  3822356, 3822863, 4064769, 3817988, 3824394, 3823618, 3823125, 3824916, 4064769, 3824137, 3828756, 3824656,
+  4064769, 4064769, 3826192, 4064769, 3829770, 3823892, 4064769, 3827972, 3820301, 3825427, 4064769, 3825939,
+  3826703, 4064769, 3829013, 3827477, 3825172, 3827728, 4064769, 3826964, 3828500, 4064769, 4064769, 3829258,
+  3829525, 3762453, 3830018, 3830547, 3827221, 3831566, 3830274, 4064769, 3828250, 3825683, 3831814, 3831298,
+  3832340, 4064769, 3834132, 3831050, 3830801, 3832586, 4064769, 3833365, 4064769, 3835156, 4064769, 3835669,
+  3836181, 4064769, 3836687, 3835923, 4064769, 4064769, 3836436, 4064769, 3837702, 3838724, 3834901, 3837460,
+  4064769, 3834381, 3838470, 4064769, 4064769, 3835408, 3839494, 3838210, 3837965, 4064769, 4064769, 3836948,
+  3839247, 4064769, 4064769, 3842564, 3840518, 3840269, 4064769, 3840021, 4064769, 3839764, 4064769, 3838996,
+  4064769, 3840773, 3842836, 4064769, 4064769, 3844868, 3841538, 4064769, 4064769, 3842068, 4064769, 3841030,
+  3843093, 4064769, 3841286, 3843857, 4064769, 4064769, 4064769, 3843337, 4064769, 4064769, 4064769, 4064769,
+  3844618, 3837186, 3845135, 3843586, 3845890, 0, 4064769, 0, 3845651, 0, 3842320, 3844116,
+  3847433, 3847172, 3845384, 4064769, 4064769, 4064769, 3846420, 3848198, 3844368, 3849733, 3846934, 3847951,
+  4064769, 3850756, 4064769, 3849994, 3853062, 3849491, 3847701, 3851027, 3852565, 3849242, 3851535, 3852303,
+  3850260, 4064769, 4064769, 3853583, 3854085, 4064769, 4064769, 3850522, 3851270, 4064769, 4064769, 4064769,
+  4064769, 4064769, 4064769, 4064769, 3855117, 4064769, 3858459, 3852034, 3853332, 3851782, 4064769, 3861520,
+  3855622, 3855370, 3856902, 3856645, 3854356, 3854612, 3854868, 4064769, 3856393, 4064769, 3855887, 3857414,
+  3852810, 4064769, 3859717, 4064769, 4064769, 3856138, 4064769, 3857171, 3857939, 3860488, 3865090, 3859469,
+  3858709, 3858197, 3859215, 3860998, 4064769, 4064769, 4064769, 3861258, 4064769, 4064769, 3860244, 4064769,
+  3860756, 3863311, 3863823, 3863061, 4064769, 4064769, 4064769, 3861766, 3864083, 4064769, 3859974, 3862292,
+  4064769, 3862804, 3864346, 4064769, 3864841, 3864596, 4064769, 4064769, 3865364, 3865619, 4064769, 4064769,
+  4064769, 4064769, 3863562, 3862543, 4064769, 3866884, 3866645, 3867906, 4064769, 3868948, 3868420, 3868681,
+  4064769, 4064769, 4064769, 3869459, 4064769, 3869978, 3869700, 3869199, 3862020, 3867138, 4064769, 3866132,
+  4064769, 3870469, 4064769, 3870986, 3871492, 3870229, 3866370, 4064769, 4064769, 3870724, 4064769, 3872781,
+  3888922, 3872019, 3873286, 4064769, 4064769, 4064769, 4064769, 3867654, 4064769, 3871242, 3873026, 3872277,
+  4064769, 4064769, 3881742, 4064769, 3871754, 3875080, 3873812, 3874822, 4064769, 4064769, 4064769, 3874068,
+  4064769, 4064769, 3876616, 4064769, 3873549, 4064769, 4064769, 3874310, 4064769, 4064769, 4064769, 3875850,
+  4064769, 4064769, 4064769, 4064769, 3875604, 3874567, 4064769, 4064769, 4064769, 4064769, 3879440, 4064769,
+  3876116, 4064769, 3878917, 3876372, 4064769, 4064769, 4064769, 3880710, 4064769, 4064769, 3877396, 4064769,
+  3879189, 3879957, 3878676, 3876877, 3880458, 4064769, 3878402, 3875348, 3877126, 3877898, 4064769, 3881226,
+  4064769, 3880980, 3880209, 4064769, 3882509, 4064769, 4064769, 4064769, 3879690, 4064769, 4064769, 3883012,
+  3923984, 3884052, 3881491, 3885327, 3884550, 4064769, 3853839, 3882246, 3885576, 3881994, 4064769, 3883530,
+  3882772, 4064769, 4064769, 3886602, 3887626, 3887882, 4064769, 4064769, 3886353, 3888397, 3886100, 4064769,
+  4064769, 3889668, 4064769, 4064769, 4064769, 3887370, 3889930, 3883290, 4064769, 4064769, 3890967, 3891220,
+  3889178, 3887125, 4064769, 3890447, 4064769, 3886868, 4064769, 3889428, 3891983, 3890186, 3890714, 4064769,
+  3891725, 3892493, 4064769, 3892756, 3894533, 3885844, 3894278, 3894037, 4064769, 3893007, 3895046, 4064769,
+  3895316, 4064769, 3893516, 3896073, 4064769, 4064769, 4064769, 4064769, 3896335, 4064769, 3896589, 4064769,
+  4064769, 3904772, 3895831, 4064769, 3896847, 4064769, 3895572, 4064769, 3897357, 3897097, 3897882, 3898118,
+  4064769, 4064769, 4064769, 4064769, 3898639, 3898373, 3898882, 4064769, 4064769, 3894790, 3897620, 3899156,
+  4064769, 3900943, 3900691, 3899398, 4064769, 4064769, 3893773, 4064769, 3899910, 4064769, 4064769, 4064769,
+  4064769, 3901455, 4064769, 3899667, 3900175, 4064769, 4064769, 4064769, 3902223, 3901973, 4064769, 4064769,
+  3902732, 4064769, 4064769, 4064769, 3906317, 3902474, 4064769, 3904516, 4064769, 3903770, 4064769, 3902997,
+  4064769, 4064769, 4064769, 4064769, 3904020, 3905282, 3903252, 3907348, 3905034, 3903508, 3908100, 3904276,
+  3908884, 3907859, 3907082, 3905812, 4064769, 3908362, 4064769, 4064769, 3909391, 3906580, 3906818, 3909133,
+  3910154, 4064769, 4064769, 4064769, 4064769, 3909909, 3908634, 3906070, 3911172, 4064769, 4064769, 4064769,
+  3911685, 3910415, 4064769, 4064769, 4064769, 3913221, 4064769, 4064769, 3909652, 3912975, 4064769, 4064769,
+  3914259, 3910914, 3912714, 3911956, 4064769, 4064769, 3846163, 3915270, 0, 3912468, 0, 0,
+  4064769, 3915533, 3914004, 3915028, 3912202, 3910677, 3913754, 3914510, 3917066, 3918853, 3913492, 3916559,
+  4064769, 4064769, 4064769, 3916308, 3915795, 3918351, 3919618, 3916813, 3916052, 4064769, 4064769, 3917590,
+  3917338, 3920138, 4064769, 4064769, 4064769, 3920645, 3921165, 4064769, 3919124, 4064769, 3921670, 3922970,
+  3920898, 4064769, 3917846, 3921930, 3919892, 3920404, 4064769, 3923210, 3923738, 4064769, 3923471, 3918089,
+  3922437, 3921422, 3922186, 4064769, 4064769, 4064769, 3924998, 4064769, 3925514, 3925250, 3926037, 4064769,
+  3922701, 3924752, 3832077, 4064769, 4064769, 3927322, 4064769, 3982083, 3928834, 3928586, 4064769, 3924495,
+  3924244, 3925780, 3926797, 3927055, 3927812, 4064769, 3926293, 4064769, 4064769, 4064769, 4064769, 3929866,
+  4064769, 3927562, 4064769, 4064769, 3930374, 3929620, 4064769, 4064769, 4064769, 3929350, 4064769, 4064769,
+  3931155, 3934221, 4064769, 3930132, 3932168, 3928070, 3932422, 3931919, 4064769, 3930634, 4064769, 4064769,
+  3930890, 3932680, 3926541, 4064769, 4064769, 3933190, 3932934, 4064769, 4064769, 3935236, 3933459, 3933954,
+  3933716, 4064769, 3935757, 3934483, 3935490, 4064769, 3974663, 3936271, 3934722, 3938054, 3934996, 3937293,
+  4064769, 4064769, 4064769, 3938570, 4064769, 4064769, 3936022, 4064769, 3936518, 4064769, 3928335, 3939334,
+  4064769, 4064769, 3936770, 4064769, 4064769, 4064769, 3938822, 4064769, 4064769, 4064769, 4064769, 3940365,
+  3940098, 3958280, 3942157, 3937556, 3940627, 4064769, 4064769, 4064769, 3939604, 3941126, 4064769, 3940874,
+  4064769, 4064769, 3939087, 3939855, 3943942, 4064769, 3941648, 4064769, 4064769, 4064769, 4064769, 3941395,
+  3944202, 3944970, 3944453, 4064769, 3941909, 4064769, 4064769, 4064769, 3943700, 4064769, 4064769, 4064769,
+  3946003, 3944719, 3945487, 4064769, 4064769, 3946758, 4064769, 3946259, 4064769, 3949332, 3946506, 3943440,
+  3945237, 4064769, 3948294, 4064769, 4064769, 4064769, 4064769, 4064769, 4064769, 4064769, 3945749, 3937806,
+  3947266, 4064769, 3949588, 3947796, 3947010, 4064769, 3953171, 3949066, 4064769, 3950346, 4064769, 3952390,
+  4064769, 4064769, 3948564, 3948820, 3951375, 4064769, 3952911, 4064769, 3953674, 4064769, 4064769, 4064769,
+  3950612, 3951898, 4064769, 3952148, 3951638, 3952661, 3953423, 4064769, 3954707, 4064769, 3953935, 3954453,
+  4064769, 3954950, 3955221, 4064769, 4064769, 3956228, 3955725, 4064769, 3956500, 3957001, 4064769, 4064769,
+  4064769, 3955994, 3956759, 3957777, 4064769, 3957268, 4064769, 3955476, 3950096, 4064769, 4064769, 3957520,
+  4064769, 4064769, 3958549, 3959059, 3959567, 3960068, 3958807, 3959298, 3937044, 4064769, 3958020, 4064769,
+  4064769, 4064769, 4064769, 3960322, 3960846, 3960589, 4064769, 3964437, 3961094, 3959828, 3961606, 4064769,
+  3961862, 3962118, 4064769, 3963910, 3962381, 3963162, 3964166, 4064769, 4064769, 4064769, 3965192, 4064769,
+  4064769, 4064769, 3965450, 4064769, 4064769, 4064769, 4064769, 3962630, 3963394, 4064769, 4064769, 4064769,
+  4064769, 3967494, 3964948, 4064769, 4064769, 3965972, 3966485, 3969818, 3967752, 4064769, 4064769, 3966228,
+  4064769, 3966740, 4064769, 4064769, 3965711, 4064769, 3968266, 4064769, 4064769, 4064769, 4064769, 3970566,
+  4064769, 3970324, 3966996, 3964682, 3969044, 4064769, 3970074, 4064769, 4064769, 3967250, 3968010, 4064769,
+  3970830, 4064769, 4064769, 3968518, 4064769, 4064769, 3971332, 4064769, 4064769, 3971853, 3943189, 3971605,
+  3972371, 3972868, 4064769, 3968778, 4064769, 4064769, 3974152, 4064769, 3971092, 4064769, 4064769, 3974404,
+  4064769, 4064769, 4064769, 3975183, 3974932, 4064769, 4064769, 4064769, 3972106, 3973908, 4064769, 4064769,
+  3973130, 3976218, 4064769, 3975446, 3977220, 3972618, 4064769, 3969549, 4064769, 4064769, 3977742, 4064769,
+  4064769, 3975700, 4064769, 4064769, 3979012, 3978254, 3976468, 4064769, 3975952, 3976723, 3979526, 3980292,
+  4064769, 3978522, 4064769, 4064769, 3980548, 4064769, 3980047, 3977994, 4064769, 4064769, 3980817, 3981071,
+  4064769, 3981828, 3981328, 3981578, 3978765, 4064769, 3979802, 3979277, 3982598, 3983878, 3982346, 4064769,
+  3983630, 3984388, 4064769, 3984137, 4064769, 4064769, 3985156, 3982868, 4064769, 3983120, 3984906, 4064769,
+  4064769, 4064769, 3987219, 3987738, 4064769, 3991317, 4064769, 3988230, 3985679, 3987983, 3985414, 4064769,
+  4064769, 3986438, 4064769, 3985940, 3983373, 3986178, 3986964, 3988749, 4064769, 3988499, 3989006, 4064769,
+  3991055, 3989517, 3989250, 3990029, 4064769, 4064769, 3991813, 4064769, 4064769, 4064769, 3993096, 3995662,
+  3991572, 3993348, 3989781, 4000789, 3992596, 3990278, 3990548, 3994629, 3992079, 4064769, 4064769, 3994378,
+  4064769, 3992845, 3995140, 3993602, 4064769, 3994131, 4064769, 4064769, 3994888, 4064769, 3997711, 3996932,
+  3997194, 4064769, 3995402, 4064769, 4064769, 4064769, 3992340, 4064769, 4010778, 3997956, 3998221, 3995924,
+  4064769, 3998470, 3996436, 3996177, 3993862, 4064769, 4064769, 4064769, 4000006, 4000262, 4064769, 4064769,
+  4002063, 3999494, 3996678, 3998724, 4064769, 4064769, 4064769, 4064769, 4001032, 4064769, 4064769, 4064769,
+  4044055, 4041996, 3999764, 4000525, 4064769, 4001798, 4064769, 0, 3997453, 4064769, 4001290, 3999242,
+  3998982, 4004614, 4002306, 4003588, 4064769, 4004367, 4004872, 4064769, 4064769, 4064769, 4005133, 4003092,
+  4005908, 4064769, 4003341, 4005645, 4064769, 4064769, 4064769, 4002570, 4064769, 4064769, 4010500, 4008194,
+  4006164, 4064769, 4007444, 4064769, 4007695, 4008467, 4064769, 4064769, 4008714, 4003850, 4006658, 4009226,
+  4064769, 4007956, 4008976, 4064769, 4064769, 4064769, 4064769, 4064769, 4064769, 4064769, 4011266, 4064769,
+  4009493, 4012303, 4010006, 4064769, 4006421, 4011028, 4012038, 4064769, 4064769, 4064769, 4064769, 4064769,
+  4064769, 4006928, 4064769, 4013850, 4064769, 4064769, 4013327, 4014100, 4064769, 4014356, 4064769, 4015878,
+  4064769, 4064769, 4014862, 4064769, 4013076, 4064769, 4064769, 4013588, 4064769, 4064769, 4016132, 4011522,
+  4012566, 4016655, 4064769, 4015124, 4016390, 4015380, 4064769, 4009736, 4015622, 4064769, 4064769, 4016918,
+  4064769, 4017430, 4017674, 4064769, 4017926, 4018180, 4064769, 4017168, 4012820, 4018959, 4064769, 4064769,
+  4019464, 4064769, 4064769, 4064769, 4064769, 4064769, 4018447, 4018690, 4064769, 4019994, 4020239, 4021250,
+  4064769, 4019219, 4064769, 4064769, 4064769, 4064769, 4020746, 4021517, 4064769, 4019732, 4064769, 4064769,
+  4020500, 4022287, 4064769, 4021002, 4064769, 4064769, 4023044, 4021762, 4023822, 4064769, 4022036, 4064769,
+  4023312, 4064769, 4024079, 4023554, 4064769, 4064769, 4064769, 4064769, 4026900, 4022548, 4022800, 4024592,
+  4064769, 4064769, 4064769, 4027141, 3954185, 4064769, 4025107, 4024854, 4064769, 4028420, 4025346, 4024340,
+  4026634, 4064769, 4026132, 4029203, 4027674, 4028948, 4064769, 4064769, 4064769, 4064769, 4029709, 4029449,
+  4064769, 4064769, 4025613, 4027924, 4030982, 4027418, 4064769, 4025877, 4064769, 4064769, 4064769, 4031764,
+  4031494, 4032002, 4032260, 4033293, 4033028, 3951106, 4064769, 4064769, 4064769, 0, 4028179, 4028682,
+  4064769, 4030724, 4030210, 4033562, 4064769, 4031252, 4064769, 4064769, 4064769, 4032525, 4034310, 4064769,
+  4064769, 4064769, 4035078, 4064769, 4036634, 4064769, 4034832, 4034068, 4045078, 4035334, 4036117, 4064769,
+  4033798, 4036360, 4034566, 4064769, 4030479, 4064769, 4064769, 4064769, 4011785, 4064769, 4036879, 4037380,
+  4037647, 4064769, 4038925, 4064769, 4064769, 4064769, 4040200, 4064769, 0, 4037141, 4064769, 4064769,
+  4064769, 4037904, 4040717, 4038152, 4038421, 4039194, 4039699, 4064769, 4041743, 4041229, 4064769, 4064769,
+  4042500, 4064769, 4064769, 4039951, 4064769, 4040980, 4064769, 4064769, 4042259, 4064769, 4035603, 4041493,
+  4042765, 4043014, 4064769, 4064769, 4064769, 4064769, 4043546, 4043802, 4043266, 4040452, 4064769, 4064769,
+  4064769, 4039445, 4064769, 4064769, 4045594, 4044307, 4064769, 4064769, 4038669, 4046101, 4064769, 4064769,
+  4064769, 4064769, 4046619, 4046351, 4064769, 4047117, 4046863, 4064769, 4047366, 4064769, 4064769, 4048650,
+  4064769, 4045844, 4064769, 4048906, 4064769, 4064769, 4064769, 4049167, 4064769, 4051226, 4044554, 4047618,
+  4050182, 4064769, 4044806, 4064769, 4064769, 4051462, 4047888, 4050441, 4048406, 4051994, 4048134, 4064769,
+  4064769, 4064769, 4051725, 4049428, 0, 4050954, 4064769, 4052998, 4050694, 4053766, 4054022, 4052751,
+  4052226, 4064769, 4064769, 4055300, 4053270, 4064769, 4064769, 4052506, 4055054, 4064769, 4064769, 4064769,
+  4064769, 4054804, 4064769, 4056339, 4064769, 4053526, 4055829, 4064769, 4064769, 4055567, 4057096, 4064769,
+  4064769, 4057357, 4054530, 4064769, 4054293, 4064769, 4057870, 4058630, 4064769, 4064769, 4058893, 4064769,
+  4064769, 4056596, 4064769, 4064769, 4056852, 0, 0, 4059402, 4060676, 4059657, 4064769, 4059142,
+  4058132, 4064769, 4057621, 4058389, 4061446, 4060938, 0, 4059920, 0, 0, 0, 0,
+  0, 4060179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0
+  };
+
+static const unsigned short hyph_en_ops[15905] =
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6, 0,
+  0, 15, 12, 0, 0, 0, 6, 9, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 18, 15, 33, 0,
+  30, 0, 38, 0, 12, 53, 48, 33, 38, 0, 9, 0,
+  0, 23, 30, 0, 12, 43, 63, 0, 73, 0, 0, 0,
+  53, 30, 63, 175, 79, 56, 0, 76, 63, 0, 12, 0,
+  66, 18, 0, 0, 0, 0, 63, 0, 82, 12, 76, 101,
+  0, 33, 0, 106, 0, 12, 111, 0, 12, 94, 63, 12,
+  73, 63, 87, 0, 63, 12, 12, 53, 6, 0, 18, 0,
+  0, 0, 12, 0, 101, 15, 12, 0, 0, 0, 0, 0,
+  0, 12, 0, 0, 0, 9, 0, 0, 0, 0, 63, 43,
+  53, 9, 0, 33, 0, 9, 63, 0, 0, 124, 9, 9,
+  63, 43, 30, 0, 116, 30, 121, 0, 63, 73, 63, 53,
+  0, 0, 129, 0, 0, 220, 0, 15, 12, 0, 63, 73,
+  0, 63, 15, 0, 0, 0, 73, 0, 63, 0, 12, 217,
+  53, 0, 12, 73, 12, 0, 0, 9, 94, 33, 18, 0,
+  43, 53, 136, 129, 0, 0, 9, 12, 0, 0, 18, 0,
+  0, 30, 141, 0, 30, 73, 146, 73, 9, 0, 0, 0,
+  30, 30, 0, 9, 0, 0, 12, 30, 43, 0, 9, 0,
+  153, 0, 0, 0, 63, 0, 12, 53, 0, 0, 73, 193,
+  53, 12, 0, 53, 12, 12, 0, 0, 0, 53, 0, 129,
+  76, 0, 9, 12, 0, 18, 129, 30, 0, 30, 94, 116,
+  0, 9, 0, 12, 30, 87, 0, 30, 0, 33, 87, 9,
+  0, 0, 18, 0, 63, 63, 33, 43, 175, 0, 33, 9,
+  30, 0, 121, 9, 33, 12, 33, 63, 33, 220, 38, 129,
+  9, 63, 0, 9, 63, 94, 0, 0, 0, 73, 0, 94,
+  0, 12, 156, 33, 76, 129, 0, 101, 12, 12, 87, 12,
+  0, 106, 101, 175, 0, 9, 9, 0, 0, 0, 0, 0,
+  0, 106, 15, 76, 30, 0, 0, 6, 15, 0, 12, 0,
+  0, 0, 15, 0, 0, 30, 0, 63, 33, 0, 53, 0,
+  9, 9, 0, 0, 0, 168, 161, 33, 116, 0, 33, 175,
+  15, 87, 18, 0, 0, 73, 0, 12, 12, 0, 0, 12,
+  15, 53, 0, 73, 0, 12, 12, 0, 0, 12, 0, 101,
+  156, 0, 0, 0, 12, 153, 0, 15, 43, 0, 43, 0,
+  38, 116, 6, 0, 0, 15, 106, 18, 101, 63, 0, 0,
+  12, 30, 0, 63, 9, 15, 30, 175, 63, 18, 9, 33,
+  0, 18, 33, 0, 0, 0, 193, 30, 33, 87, 63, 33,
+  0, 0, 129, 66, 63, 9, 53, 9, 63, 9, 0, 0,
+  0, 0, 0, 0, 0, 30, 178, 76, 9, 0, 0, 0,
+  0, 0, 53, 0, 30, 0, 73, 106, 63, 0, 0, 0,
+  0, 0, 53, 193, 0, 0, 0, 121, 0, 12, 0, 0,
+  0, 30, 0, 0, 15, 136, 175, 0, 175, 0, 183, 76,
+  350, 0, 0, 9, 0, 12, 0, 188, 53, 12, 0, 220,
+  12, 73, 0, 6, 271, 0, 0, 73, 73, 6, 9, 153,
+  106, 12, 0, 0, 53, 0, 12, 12, 12, 0, 0, 0,
+  38, 12, 0, 0, 0, 0, 0, 101, 0, 175, 0, 0,
+  0, 79, 9, 12, 9, 30, 9, 0, 12, 18, 9, 196,
+  153, 9, 0, 63, 153, 220, 0, 0, 0, 0, 0, 0,
+  0, 0, 129, 0, 196, 212, 0, 0, 0, 53, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 121,
+  0, 0, 0, 53, 15, 0, 175, 0, 0, 121, 0, 0,
+  0, 0, 0, 0, 0, 333, 0, 0, 0, 0, 0, 0,
+  53, 175, 0, 53, 121, 0, 0, 121, 0, 0, 199, 0,
+  0, 53, 0, 0, 0, 53, 15, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 0, 0, 193, 0, 193, 0, 0, 0,
+  0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 0,
+  0, 175, 377, 0, 0, 0, 0, 0, 0, 30, 0, 15,
+  30, 0, 0, 0, 0, 0, 0, 193, 12, 0, 0, 0,
+  79, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 30, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+  15, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  196, 0, 175, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+  53, 0, 0, 0, 0, 0, 0, 193, 0, 9, 0, 193,
+  0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0,
+  0, 0, 0, 76, 0, 0, 121, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 53, 15, 15, 53, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0,
+  15, 53, 0, 0, 15, 15, 0, 15, 0, 217, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 196, 0, 196, 223, 0, 15, 0, 0, 9, 0, 0,
+  53, 0, 53, 121, 0, 30, 0, 196, 0, 0, 0, 30,
+  121, 204, 0, 30, 0, 9, 0, 0, 0, 53, 0, 0,
+  0, 196, 53, 153, 12, 0, 53, 207, 30, 12, 30, 0,
+  53, 53, 0, 204, 0, 0, 53, 12, 9, 121, 0, 196,
+  0, 0, 53, 196, 0, 0, 204, 9, 0, 0, 0, 0,
+  293, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 53,
+  0, 0, 241, 12, 30, 0, 153, 0, 293, 0, 0, 0,
+  204, 121, 0, 0, 0, 0, 0, 0, 193, 9, 12, 30,
+  53, 15, 0, 0, 0, 6, 73, 0, 0, 196, 0, 30,
+  0, 53, 175, 0, 0, 0, 0, 30, 0, 175, 9, 0,
+  0, 0, 196, 0, 0, 0, 0, 175, 0, 0, 0, 175,
+  63, 0, 0, 30, 0, 0, 220, 30, 9, 124, 0, 0,
+  79, 0, 0, 73, 0, 0, 0, 53, 0, 0, 175, 9,
+  0, 0, 217, 196, 0, 0, 0, 226, 175, 0, 0, 0,
+  175, 0, 0, 217, 231, 0, 0, 9, 0, 0, 236, 223,
+  0, 0, 73, 6, 0, 175, 223, 241, 0, 223, 175, 53,
+  30, 217, 153, 0, 0, 0, 0, 0, 223, 6, 0, 0,
+  246, 0, 0, 0, 0, 502, 9, 153, 196, 0, 0, 175,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236,
+  251, 9, 0, 153, 0, 63, 0, 153, 0, 204, 0, 0,
+  0, 0, 0, 196, 0, 175, 223, 0, 15, 0, 0, 217,
+  0, 223, 0, 0, 0, 53, 256, 0, 53, 0, 223, 0,
+  76, 0, 0, 0, 196, 0, 196, 0, 0, 0, 204, 204,
+  0, 0, 0, 204, 0, 261, 15, 0, 204, 53, 53, 220,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 79,
+  0, 0, 15, 0, 121, 0, 0, 271, 0, 9, 0, 0,
+  9, 63, 0, 0, 0, 223, 0, 0, 0, 0, 217, 266,
+  220, 0, 274, 0, 15, 512, 196, 204, 9, 9, 175, 0,
+  0, 48, 0, 121, 12, 0, 0, 121, 223, 15, 246, 271,
+  0, 220, 204, 0, 0, 0, 261, 0, 30, 53, 0, 0,
+  0, 217, 0, 9, 217, 0, 12, 121, 0, 15, 12, 223,
+  12, 220, 281, 196, 0, 223, 0, 63, 0, 0, 0, 0,
+  0, 0, 0, 63, 217, 0, 63, 15, 79, 0, 223, 288,
+  0, 357, 0, 220, 251, 9, 153, 175, 0, 0, 0, 0,
+  0, 0, 0, 196, 9, 223, 0, 0, 175, 0, 223, 0,
+  73, 53, 153, 0, 121, 0, 0, 53, 0, 0, 0, 0,
+  298, 0, 6, 0, 0, 0, 175, 196, 196, 196, 153, 0,
+  0, 175, 0, 196, 303, 0, 79, 0, 0, 0, 0, 0,
+  153, 394, 175, 0, 0, 0, 0, 0, 0, 0, 6, 0,
+  6, 0, 175, 63, 0, 153, 175, 6, 0, 0, 0, 53,
+  0, 0, 0, 175, 63, 308, 0, 63, 313, 0, 0, 53,
+  0, 196, 0, 0, 0, 6, 0, 196, 6, 443, 0, 0,
+  0, 0, 0, 6, 0, 0, 323, 0, 0, 318, 0, 0,
+  0, 0, 153, 0, 448, 0, 153, 76, 76, 0, 15, 121,
+  0, 0, 0, 0, 0, 0, 175, 220, 63, 0, 0, 0,
+  0, 6, 63, 0, 6, 0, 76, 0, 63, 63, 0, 0,
+  76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 121, 30, 0, 0, 121, 0, 0,
+  0, 196, 196, 0, 0, 0, 0, 0, 0, 0, 0, 121,
+  0, 313, 153, 6, 0, 136, 0, 53, 121, 0, 0, 73,
+  0, 0, 63, 53, 9, 0, 30, 153, 0, 0, 0, 0,
+  0, 0, 30, 53, 30, 0, 0, 0, 63, 0, 0, 0,
+  0, 0, 0, 12, 204, 0, 0, 0, 0, 0, 12, 12,
+  175, 12, 0, 328, 0, 204, 0, 9, 0, 12, 0, 196,
+  303, 0, 6, 0, 82, 0, 0, 196, 63, 30, 0, 0,
+  0, 0, 0, 63, 0, 0, 204, 0, 0, 0, 175, 0,
+  0, 0, 0, 0, 0, 0, 196, 0, 0, 196, 0, 0,
+  30, 0, 0, 0, 0, 0, 76, 0, 220, 271, 0, 0,
+  196, 0, 175, 0, 204, 0, 175, 0, 9, 73, 0, 0,
+  0, 0, 0, 0, 121, 73, 79, 0, 0, 9, 53, 0,
+  0, 0, 196, 0, 0, 0, 204, 0, 0, 0, 53, 0,
+  0, 0, 0, 0, 0, 204, 0, 0, 73, 204, 0, 0,
+  0, 204, 0, 175, 0, 0, 196, 303, 0, 0, 0, 217,
+  217, 0, 0, 0, 0, 0, 175, 175, 220, 338, 204, 63,
+  30, 0, 0, 0, 0, 0, 193, 223, 53, 0, 0, 220,
+  223, 207, 223, 0, 0, 175, 220, 223, 0, 271, 223, 223,
+  220, 121, 343, 0, 0, 0, 153, 0, 0, 15, 220, 53,
+  0, 0, 0, 0, 0, 79, 0, 73, 0, 0, 0, 0,
+  0, 0, 175, 0, 0, 0, 175, 0, 0, 0, 0, 0,
+  9, 0, 0, 220, 0, 0, 0, 0, 0, 0, 6, 0,
+  271, 141, 0, 63, 175, 53, 0, 0, 0, 0, 76, 193,
+  0, 76, 0, 0, 193, 156, 0, 0, 0, 175, 0, 0,
+  0, 0, 0, 6, 121, 175, 220, 175, 0, 175, 0, 0,
+  0, 0, 53, 0, 0, 0, 0, 0, 0, 63, 0, 0,
+  153, 0, 0, 63, 0, 0, 0, 0, 175, 0, 0, 0,
+  196, 204, 0, 0, 0, 53, 76, 0, 0, 0, 357, 0,
+  0, 0, 76, 0, 0, 175, 196, 30, 76, 175, 0, 0,
+  0, 0, 0, 0, 9, 0, 121, 30, 76, 0, 76, 0,
+  0, 196, 196, 121, 212, 0, 0, 30, 0, 0, 0, 63,
+  193, 0, 0, 0, 76, 121, 0, 12, 0, 0, 0, 153,
+  196, 0, 0, 0, 0, 0, 0, 0, 73, 0, 175, 0,
+  175, 12, 63, 0, 53, 0, 0, 0, 0, 0, 0, 204,
+  0, 30, 0, 196, 204, 0, 0, 0, 204, 196, 196, 196,
+  0, 204, 261, 0, 0, 0, 204, 0, 12, 63, 175, 0,
+  196, 0, 15, 0, 9, 0, 0, 63, 0, 0, 0, 0,
+  0, 0, 0, 12, 0, 204, 0, 0, 362, 0, 196, 223,
+  0, 0, 0, 0, 207, 0, 0, 0, 30, 12, 0, 0,
+  367, 0, 30, 204, 0, 0, 204, 63, 0, 223, 15, 0,
+  196, 0, 0, 0, 0, 175, 196, 0, 30, 217, 0, 175,
+  0, 0, 220, 0, 0, 372, 0, 0, 0, 0, 63, 53,
+  0, 0, 0, 9, 0, 63, 175, 0, 0, 53, 0, 0,
+  0, 0, 121, 0, 193, 0, 0, 6, 0, 0, 0, 76,
+  0, 0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 0,
+  0, 15, 153, 0, 0, 175, 0, 223, 0, 0, 0, 0,
+  0, 0, 0, 63, 53, 175, 223, 382, 0, 0, 0, 0,
+  389, 0, 0, 63, 0, 0, 0, 0, 30, 63, 0, 0,
+  6, 223, 63, 0, 0, 0, 175, 196, 0, 63, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196,
+  0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 76, 0,
+  0, 0, 0, 53, 0, 63, 0, 0, 15, 0, 0, 0,
+  73, 196, 204, 0, 0, 217, 0, 0, 204, 0, 76, 0,
+  0, 0, 0, 0, 196, 196, 0, 0, 0, 204, 0, 0,
+  6, 0, 0, 0, 0, 0, 6, 217, 0, 53, 121, 0,
+  204, 0, 0, 175, 220, 73, 0, 0, 0, 0, 0, 53,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 30,
+  0, 0, 399, 0, 0, 0, 30, 0, 0, 196, 0, 0,
+  0, 30, 196, 0, 6, 15, 0, 0, 6, 404, 0, 223,
+  0, 0, 0, 0, 0, 0, 53, 0, 0, 30, 220, 0,
+  220, 0, 9, 30, 30, 0, 0, 76, 0, 0, 0, 0,
+  121, 0, 0, 204, 0, 6, 6, 204, 0, 0, 0, 63,
+  0, 0, 63, 0, 0, 217, 223, 0, 6, 63, 217, 0,
+  0, 175, 175, 196, 0, 0, 0, 0, 0, 0, 0, 0,
+  175, 0, 0, 0, 0, 0, 0, 0, 63, 6, 266, 0,
+  30, 175, 0, 0, 0, 76, 0, 175, 53, 0, 63, 63,
+  175, 53, 0, 0, 0, 30, 0, 0, 411, 223, 0, 196,
+  0, 0, 0, 0, 0, 0, 175, 0, 196, 0, 0, 0,
+  0, 217, 0, 0, 0, 0, 175, 0, 30, 0, 0, 73,
+  0, 0, 9, 30, 73, 12, 0, 0, 175, 0, 0, 0,
+  12, 0, 0, 12, 0, 9, 418, 121, 0, 0, 63, 0,
+  0, 53, 0, 63, 0, 0, 0, 0, 0, 63, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 217,
+  0, 0, 0, 63, 0, 0, 6, 0, 0, 0, 0, 6,
+  121, 0, 0, 9, 0, 0, 0, 0, 0, 0, 6, 0,
+  6, 0, 0, 30, 12, 30, 12, 204, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 223, 0, 73, 0,
+  0, 0, 175, 73, 30, 223, 0, 0, 0, 0, 0, 204,
+  0, 0, 12, 153, 0, 0, 0, 63, 153, 63, 0, 0,
+  12, 0, 63, 0, 271, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 63, 517, 175, 0, 0,
+  0, 0, 0, 175, 0, 0, 30, 0, 196, 0, 0, 0,
+  0, 9, 0, 0, 0, 63, 9, 0, 0, 9, 175, 0,
+  0, 12, 121, 0, 517, 0, 223, 53, 196, 418, 223, 6,
+  308, 9, 520, 63, 223, 121, 9, 53, 0, 0, 0, 0,
+  196, 0, 0, 0, 6, 0, 0, 0, 0, 0, 175, 0,
+  6, 153, 0, 0, 0, 53, 193, 196, 73, 220, 196, 121,
+  73, 217, 0, 9, 0, 0, 0, 0, 0, 175, 175, 0,
+  0, 6, 423, 0, 175, 0, 0, 0, 433, 204, 0, 0,
+  523, 0, 0, 0, 0, 175, 0, 428, 217, 9, 0, 0,
+  53, 121, 0, 30, 175, 175, 30, 0, 196, 0, 0, 0,
+  193, 497, 0, 53, 53, 0, 0, 0, 0, 9, 0, 175,
+  6, 0, 0, 153, 0, 220, 6, 204, 0, 63, 0, 0,
+  0, 0, 30, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+  30, 0, 0, 0, 0, 0, 271, 0, 204, 0, 0, 0,
+  308, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 12,
+  0, 0, 438, 0, 0, 15, 15, 0, 73, 9, 0, 0,
+  0, 0, 0, 73, 12, 0, 0, 0, 0, 0, 12, 0,
+  9, 0, 30, 0, 0, 0, 0, 30, 73, 175, 0, 0,
+  53, 53, 153, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 63, 0, 175, 271, 30, 73, 0, 63, 63, 0, 0,
+  0, 76, 0, 0, 63, 0, 0, 6, 261, 0, 63, 153,
+  0, 0, 0, 220, 30, 121, 0, 0, 0, 73, 63, 0,
+  9, 0, 0, 53, 0, 220, 0, 30, 220, 153, 0, 121,
+  0, 15, 0, 196, 175, 0, 0, 389, 0, 0, 6, 53,
+  220, 196, 63, 0, 0, 0, 9, 0, 0, 0, 303, 0,
+  0, 220, 0, 220, 12, 0, 0, 73, 196, 0, 0, 217,
+  0, 0, 0, 0, 261, 217, 220, 0, 6, 217, 0, 220,
+  217, 0, 0, 223, 220, 0, 9, 0, 0, 9, 223, 0,
+  223, 0, 0, 9, 204, 0, 0, 153, 0, 196, 478, 0,
+  0, 33, 9, 0, 0, 63, 0, 453, 53, 0, 0, 9,
+  76, 63, 204, 0, 9, 121, 9, 0, 0, 9, 0, 6,
+  6, 0, 0, 76, 121, 0, 0, 463, 175, 0, 220, 0,
+  458, 313, 0, 30, 0, 9, 6, 6, 517, 0, 223, 6,
+  204, 0, 0, 0, 236, 0, 0, 0, 520, 0, 6, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 53, 204, 0, 196,
+  0, 9, 0, 261, 217, 0, 53, 121, 0, 9, 121, 0,
+  0, 0, 217, 175, 0, 0, 0, 0, 223, 204, 0, 223,
+  196, 0, 6, 0, 63, 153, 0, 0, 0, 196, 0, 0,
+  0, 0, 541, 0, 204, 217, 468, 0, 0, 0, 15, 204,
+  0, 223, 63, 76, 0, 217, 261, 217, 0, 220, 193, 0,
+  0, 175, 217, 73, 0, 0, 217, 204, 0, 0, 0, 121,
+  9, 153, 0, 0, 9, 0, 12, 0, 15, 0, 0, 0,
+  0, 12, 0, 0, 15, 196, 236, 223, 0, 473, 196, 53,
+  121, 223, 0, 0, 0, 153, 0, 223, 0, 0, 0, 0,
+  0, 121, 0, 73, 63, 121, 53, 0, 121, 76, 0, 121,
+  9, 153, 0, 73, 0, 0, 220, 63, 0, 0, 0, 175,
+  0, 0, 9, 6, 0, 153, 0, 313, 30, 303, 0, 0,
+  63, 196, 0, 121, 76, 9, 9, 0, 0, 0, 328, 0,
+  53, 0, 79, 153, 76, 76, 63, 0, 53, 12, 0, 0,
+  0, 76, 0, 153, 43, 6, 217, 0, 0, 0, 53, 0,
+  0, 0, 121, 0, 9, 15, 0, 0, 53, 223, 223, 0,
+  0, 220, 0, 485, 0, 193, 12, 0, 53, 0, 0, 30,
+  0, 0, 0, 0, 196, 0, 121, 0, 196, 223, 121, 193,
+  73, 15, 121, 0, 0, 271, 0, 53, 0, 0, 0, 492,
+  0, 0, 0, 271, 0, 76, 121, 0, 0, 0, 0, 53,
+  204, 0, 63, 0, 175, 220, 0, 0, 0, 121, 223, 153,
+  175, 0, 53, 153, 223, 0, 0, 0, 204, 63, 121, 0,
+  0, 0, 0, 121, 0, 0, 53, 0, 223, 223, 196, 0,
+  0, 0, 0, 0, 204, 0, 0, 196, 0, 0, 196, 0,
+  0, 0, 546, 0, 196, 517, 193, 63, 0, 9, 0, 121,
+  271, 0, 73, 175, 0, 507, 53, 0, 121, 0, 0, 517,
+  528, 0, 153, 9, 0, 0, 520, 53, 12, 0, 0, 0,
+  76, 153, 0, 175, 53, 9, 0, 9, 0, 175, 0, 0,
+  0, 73, 0, 0, 0, 53, 0, 0, 121, 0, 53, 0,
+  0, 0, 0, 53, 121, 0, 0, 0, 517, 0, 0, 53,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 517, 63, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 175, 0, 0, 220, 0, 0, 0,
+  0, 73, 121, 0, 0, 153, 0, 0, 0, 0, 0, 0,
+  0, 63, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 271, 0, 175, 0, 0, 0, 73, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0,
+  0, 0, 175, 0, 0, 0, 0, 0, 0, 0, 517, 0,
+  0, 0, 0, 0, 0, 0, 563, 0, 0, 9, 0, 193,
+  193, 0, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0,
+  53, 175, 0, 196, 0, 0, 271, 0, 0, 15, 0, 0,
+  0, 0, 0, 6, 6, 53, 0, 0, 0, 0, 0, 73,
+  0, 0, 53, 0, 271, 0, 175, 0, 0, 0, 79, 0,
+  0, 6, 73, 0, 0, 0, 453, 175, 9, 0, 0, 517,
+  0, 0, 175, 0, 520, 0, 0, 0, 0, 153, 76, 0,
+  0, 0, 121, 0, 0, 153, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 568, 0, 0, 175, 0, 0, 0, 0, 517, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 0, 0, 0, 0, 528, 0, 175, 0,
+  0, 0, 0, 0, 153, 15, 0, 0, 520, 0, 0, 0,
+  175, 0, 0, 53, 0, 153, 0, 76, 0, 0, 6, 175,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 53, 63, 0, 223, 0, 0, 0, 0, 0, 0, 0,
+  0, 175, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0,
+  121, 76, 0, 0, 0, 0, 0, 528, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 528,
+  553, 0, 0, 76, 528, 0, 0, 0, 528, 0, 517, 12,
+  0, 0, 0, 12, 0, 0, 528, 0, 223, 76, 0, 0,
+  0, 76, 0, 0, 0, 0, 121, 73, 0, 0, 223, 0,
+  517, 0, 0, 223, 220, 9, 0, 0, 0, 0, 0, 0,
+  0, 0, 175, 0, 0, 517, 0, 76, 0, 223, 357, 0,
+  0, 531, 0, 53, 30, 0, 0, 53, 0, 0, 121, 223,
+  0, 73, 0, 121, 223, 9, 0, 30, 0, 76, 0, 9,
+  0, 153, 517, 0, 0, 30, 9, 0, 121, 76, 9, 220,
+  121, 0, 0, 271, 73, 0, 271, 30, 9, 220, 536, 53,
+  76, 9, 121, 517, 0, 0, 517, 220, 541, 63, 220, 0,
+  121, 76, 175, 0, 0, 0, 0, 153, 0, 0, 520, 153,
+  558, 0, 0, 30, 517, 0, 0, 418, 196, 517, 53, 0,
+  0, 0, 217, 520, 578, 0, 0, 0, 573, 528, 528, 0,
+  517, 175, 520, 121, 0, 196, 528, 73, 6, 0, 0, 0,
+  121, 76, 528, 30, 0, 0, 76, 223, 76, 196, 0, 9,
+  0, 121, 53, 0, 153, 271, 0, 517, 175, 0, 0, 0,
+  271, 0, 528, 517, 0, 0, 0, 153, 121, 0, 9, 0,
+  0, 76, 517, 63, 53, 0, 121, 204, 196, 153, 63, 0,
+  121, 528, 0, 528, 30, 0, 0, 76, 204, 196, 453, 9,
+  0, 583, 313, 0, 9, 0, 520, 53, 0, 528, 520, 175,
+  520, 0, 73, 0, 53, 586, 0, 175, 517, 0, 217, 223,
+  175, 0, 0, 153, 528, 53, 0, 517, 9, 223, 9, 0,
+  9, 0, 0, 220, 73, 0, 175, 196, 0, 76, 271, 0,
+  0, 0, 76, 196, 153, 0, 0, 223, 193, 0, 0, 6,
+  0, 0, 196, 196, 196, 76, 196, 0, 0, 0, 591, 76,
+  0, 9, 121, 73, 204, 0, 0, 196, 0, 175, 204, 357,
+  175, 223, 121, 0, 196, 73, 15, 9, 53, 0, 9, 0,
+  53, 121, 196, 517, 0, 153, 9, 196, 63, 9, 63, 53,
+  153, 0, 76, 53, 220, 0, 223, 520, 223, 217, 175, 596,
+  73, 196, 196, 121, 9, 175, 30, 196, 0, 0, 196, 223,
+  0, 528, 196, 9, 220, 0, 204, 153, 220, 0, 517, 0,
+  220, 121, 196, 0, 357, 217, 196, 0, 0, 0, 220, 0,
+  53, 0, 153, 0, 0, 175, 196, 220, 0, 223, 196, 0,
+  0, 204, 0, 9, 601, 220, 0, 196, 175, 73, 0, 121,
+  0, 0, 220, 223, 153, 183, 220, 0, 9, 220, 196, 175,
+  53, 0, 121, 220, 9, 121, 121, 0, 0, 0, 220, 196,
+  223, 223, 121, 223, 0, 0, 121, 220, 0, 220, 196, 0,
+  528, 0, 0, 196, 0, 0, 175, 121, 0, 9, 0, 223,
+  0, 0, 606, 0, 121, 0, 0, 517, 175, 175, 121, 0,
+  0, 0, 0, 0, 0, 0, 121, 175, 204, 0, 53, 609,
+  223, 0, 0, 0, 0, 153, 220, 0, 204, 9, 0, 0,
+  0, 217, 204, 204, 204, 121, 517, 9, 175, 175, 204, 204,
+  63, 223, 0, 0, 153, 0, 0, 153, 251, 212, 0, 0,
+  0, 223, 0, 121, 175, 614, 220, 0, 606, 63, 0, 223,
+  196, 619, 53, 223, 204, 220, 0, 0, 53, 121, 528, 220,
+  220, 0, 0, 153, 0, 175, 0, 196, 121, 271, 63, 0,
+  9, 53, 73, 175, 0, 223, 624, 517, 0, 121, 0, 121,
+  53, 0, 0, 9, 0, 6, 196, 528, 196, 196, 0, 517,
+  0, 53, 528, 629, 0, 0, 0, 0, 0, 0, 251, 76,
+  175, 528, 0, 0, 619, 30, 175, 634, 220, 53, 517, 271,
+  121, 175, 175, 517, 0, 153, 0, 153, 0, 121, 53, 517,
+  175, 528, 0, 0, 0, 53, 639, 196, 175, 517, 520, 0,
+  193, 0, 220, 0, 121, 528, 0, 53, 121, 271, 175, 223,
+  271, 121, 0, 9, 517, 0, 0, 517, 517, 76, 0, 196,
+  271, 644, 9, 223, 0, 0, 517, 175, 0, 196, 73, 196,
+  223, 220, 0, 121, 204, 196, 654, 528, 649, 0, 0, 528,
+  0, 175, 121, 517, 0, 196, 0, 53, 0, 153, 15, 661,
+  0, 53, 418, 220, 175, 121, 0, 0, 53, 517, 175, 175,
+  0, 73, 175, 0, 76, 73, 6, 583, 0, 76, 666, 0,
+  175, 53, 0, 76, 453, 671, 0, 0, 0, 520, 0, 220,
+  196, 0, 9, 153, 0, 271, 0, 196, 0, 0, 0, 0,
+  175, 223, 0, 121, 175, 53, 175, 0, 53, 175, 0, 175,
+  223, 53, 676, 9, 520, 220, 175, 193, 0, 583, 0, 271,
+  196, 0, 53, 0, 0, 12, 63, 0, 0, 153, 121, 153,
+  0, 121, 0, 0, 153, 175, 517, 328, 53, 153, 0, 153,
+  73, 220, 0, 121, 251, 517, 53, 0, 251, 528, 196, 681,
+  121, 220, 517, 9, 0, 528, 0, 517, 271, 196, 196, 0,
+  0, 204, 196, 0, 220, 0, 9, 15, 153, 196, 175, 223,
+  223, 196, 121, 175, 153, 686, 193, 63, 153, 639, 217, 121,
+  223, 175, 0, 0, 0, 0, 223, 76, 0, 223, 220, 121,
+  0, 153, 220, 76, 0, 217, 9, 121, 671, 121, 0, 223,
+  63, 121, 30, 121, 9, 121, 196, 251, 153, 223, 63, 153,
+  0, 0, 53, 121, 0, 0, 0, 0, 606, 0, 517, 0,
+  9, 0, 30, 223, 0, 517, 207, 591, 517, 121, 517, 606,
+  220, 196, 517, 53, 0, 0, 517, 691, 220, 0, 175, 196,
+  517, 0, 73, 121, 30, 0, 517, 63, 0, 0, 153, 220,
+  196, 73, 0, 9, 136, 9, 121, 223, 76, 175, 196, 0,
+  0, 153, 196, 0, 0, 175, 0, 121, 236, 121, 153, 153,
+  0, 0, 0, 196, 121, 517, 175, 9, 0, 121, 271, 517,
+  0, 30, 696, 0, 0, 153, 0, 0, 0, 220, 0, 63,
+  517, 517, 0, 63, 175, 9, 0, 196, 0, 9, 713, 517,
+  0, 703, 223, 517, 0, 708, 153, 0, 223, 121, 220, 0,
+  0, 591, 0, 204, 0, 606, 121, 153, 0, 517, 0, 528,
+  63, 418, 0, 153, 76, 53, 9, 0, 196, 196, 220, 271,
+  220, 0, 0, 517, 175, 76, 53, 196, 0, 53, 175, 175,
+  520, 0, 196, 212, 73, 175, 0, 73, 0, 53, 0, 0,
+  196, 9, 0, 121, 0, 271, 153, 528, 517, 121, 517, 520,
+  0, 0, 528, 0, 175, 223, 520, 9, 644, 0, 193, 153,
+  9, 196, 196, 153, 583, 528, 30, 520, 0, 0, 196, 0,
+  9, 0, 0, 0, 9, 223, 517, 0, 196, 0, 520, 0,
+  223, 520, 175, 0, 196, 204, 73, 196, 0, 394, 0, 720,
+  9, 207, 0, 73, 223, 0, 196, 220, 220, 223, 0, 271,
+  175, 223, 9, 0, 53, 0, 223, 0, 418, 220, 0, 220,
+  0, 528, 418, 175, 73, 520, 53, 528, 223, 9, 0, 76,
+  0, 223, 0, 196, 606, 0, 153, 0, 0, 220, 0, 223,
+  73, 0, 0, 175, 53, 9, 121, 121, 0, 53, 121, 153,
+  73, 528, 53, 0, 53, 220, 0, 153, 121, 220, 30, 246,
+  271, 153, 0, 517, 0, 0, 725, 528, 0, 9, 0, 0,
+  0, 0, 175, 517, 220, 528, 0, 0, 193, 0, 0, 73,
+  0, 735, 175, 175, 175, 12, 0, 0, 517, 0, 9, 0,
+  175, 175, 63, 0, 730, 0, 196, 175, 53, 517, 53, 520,
+  196, 175, 0, 196, 520, 0, 9, 0, 517, 76, 0, 15,
+  121, 0, 0, 0, 0, 0, 0, 193, 175, 196, 220, 223,
+  0, 0, 121, 196, 175, 0, 0, 0, 0, 9, 0, 520,
+  0, 0, 9, 0, 271, 357, 517, 9, 0, 220, 153, 0,
+  528, 517, 73, 175, 517, 0, 175, 53, 73, 0, 271, 175,
+  220, 223, 220, 220, 0, 520, 223, 63, 0, 0, 0, 0,
+  0, 9, 0, 196, 0, 175, 175, 30, 220, 372, 73, 528,
+  0, 9, 153, 517, 528, 0, 0, 9, 9, 0, 204, 217,
+  606, 220, 231, 196, 223, 223, 0, 153, 196, 223, 0, 175,
+  196, 53, 193, 121, 517, 153, 528, 153, 606, 63, 121, 517,
+  9, 30, 9, 220, 0, 0, 0, 9, 175, 220, 196, 0,
+  175, 121, 0, 53, 0, 0, 223, 220, 121, 497, 0, 53,
+  0, 0, 175, 0, 9, 0, 0, 153, 520, 76, 517, 193,
+  175, 0, 121, 0, 153, 591, 0, 79, 196, 9, 53, 0,
+  0, 220, 175, 76, 220, 0, 121, 0, 6, 0, 0, 153,
+  0, 223, 193, 76, 0, 63, 175, 740, 175, 220, 531, 175,
+  0, 0, 121, 204, 193, 196, 121, 0, 0, 0, 196, 0,
+  193, 0, 220, 0, 0, 193, 73, 0, 220, 9, 0, 713,
+  223, 0, 0, 220, 606, 372, 196, 0, 196, 76, 271, 0,
+  0, 223, 745, 121, 53, 0, 223, 0, 153, 12, 220, 0,
+  0, 9, 271, 196, 9, 0, 0, 0, 0, 0, 153, 121,
+  0, 223, 223, 0, 0, 0, 153, 418, 175, 0, 76, 153,
+  30, 220, 121, 0, 220, 73, 0, 9, 0, 0, 0, 220,
+  0, 0, 121, 121, 0, 196, 196, 220, 223, 9, 0, 220,
+  0, 223, 63, 0, 0, 0, 0, 671, 223, 63, 53, 271,
+  76, 0, 223, 153, 76, 223, 63, 76, 220, 0, 0, 220,
+  220, 0, 76, 9, 223, 0, 591, 30, 6, 63, 121, 0,
+  586, 0, 0, 220, 520, 153, 9, 220, 0, 212, 0, 220,
+  53, 63, 217, 121, 9, 9, 0, 0, 223, 53, 30, 196,
+  0, 175, 0, 9, 153, 220, 0, 9, 0, 0, 76, 121,
+  563, 328, 0, 196, 0, 0, 175, 223, 0, 6, 9, 0,
+  223, 0, 0, 121, 76, 9, 0, 9, 223, 9, 0, 53,
+  175, 0, 0, 196, 0, 0, 520, 0, 30, 520, 389, 0,
+  175, 520, 9, 0, 153, 53, 175, 0, 0, 0, 0, 196,
+  121, 0, 0, 0, 196, 73, 0, 520, 53, 0, 0, 153,
+  12, 9, 0, 63, 0, 528, 520, 0, 220, 0, 53, 175,
+  121, 121, 0, 528, 528, 121, 196, 0, 9, 223, 53, 520,
+  15, 73, 520, 0, 0, 0, 153, 517, 9, 196, 30, 12,
+  9, 750, 175, 9, 528, 196, 196, 0, 0, 0, 0, 0,
+  0, 220, 0, 223, 497, 0, 0, 223, 755, 223, 73, 73,
+  73, 0, 0, 73, 73, 0, 0, 12, 528, 606, 175, 175,
+  175, 121, 76, 0, 0, 9, 0, 220, 0, 121, 204, 0,
+  0, 175, 0, 520, 196, 520, 175, 76, 0, 53, 153, 0,
+  0, 0, 0, 196, 0, 207, 175, 223, 196, 53, 193, 0,
+  0, 175, 204, 0, 196, 0, 63, 63, 0, 121, 0, 9,
+  0, 0, 53, 0, 0, 528, 9, 63, 30, 0, 153, 0,
+  121, 196, 196, 0, 0, 9, 517, 153, 53, 63, 121, 0,
+  223, 175, 153, 0, 9, 0, 0, 223, 0, 6, 0, 175,
+  0, 73, 0, 0, 9, 0, 175, 0, 0, 196, 0, 220,
+  220, 517, 63, 528, 153, 0, 204, 196, 196, 175, 175, 528,
+  175, 76, 196, 30, 223, 175, 76, 520, 0, 0, 223, 0,
+  9, 0, 204, 73, 0, 0, 175, 196, 196, 0, 121, 223,
+  0, 73, 220, 0, 223, 30, 0, 196, 0, 196, 196, 63,
+  220, 9, 223, 0, 0, 223, 609, 223, 175, 223, 0, 73,
+  0, 583, 175, 175, 0, 153, 0, 0, 528, 0, 175, 9,
+  196, 0, 207, 0, 175, 0, 53, 175, 175, 53, 223, 53,
+  220, 0, 9, 175, 196, 0, 193, 223, 0, 223, 223, 0,
+  9, 0, 121, 196, 0, 111, 671, 121, 121, 0, 76, 153,
+  0, 175, 0, 0, 223, 271, 220, 223, 0, 0, 0, 0,
+  760, 223, 0, 196, 0, 0, 0, 196, 528, 0, 520, 0,
+  223, 73, 175, 0, 153, 223, 0, 686, 175, 175, 196, 153,
+  0, 644, 271, 517, 175, 271, 175, 53, 517, 196, 0, 53,
+  73, 196, 116, 76, 212, 0, 0, 520, 63, 528, 0, 220,
+  0, 0, 517, 175, 0, 553, 76, 63, 0, 153, 220, 528,
+  0, 528, 63, 121, 520, 196, 175, 0, 175, 76, 271, 0,
+  0, 193, 204, 0, 528, 53, 0, 528, 223, 76, 223, 0,
+  0, 153, 517, 0, 223, 0, 0, 53, 193, 220, 0, 0,
+  9, 193, 0, 9, 0, 188, 644, 53, 76, 76, 0, 528,
+  204, 175, 0, 765, 175, 196, 606, 0, 196, 0, 271, 528,
+  53, 196, 0, 517, 193, 53, 223, 517, 0, 196, 0, 223,
+  204, 0, 220, 6, 0, 204, 0, 0, 217, 207, 0, 196,
+  220, 0, 217, 73, 196, 223, 0, 63, 0, 153, 193, 76,
+  0, 0, 0, 517, 153, 528, 0, 0, 0, 196, 517, 0,
+  0, 153, 153, 0, 53, 0, 0, 0, 175, 73, 0, 517,
+  0, 0, 0, 0, 175, 153, 517, 0, 517, 53, 0, 153,
+  0, 0, 520, 153, 153, 153, 517, 178, 73, 770, 517, 53,
+  528, 0, 583, 520, 520, 0, 53, 0, 517, 528, 0, 520,
+  0, 9, 0, 76, 0, 517, 0, 175, 583, 517, 528, 0,
+  153, 517, 517, 520, 0, 528, 196, 0, 517, 153, 204, 121,
+  367, 0, 0, 520, 121, 121, 520, 53, 0, 0, 517, 175,
+  520, 153, 175, 0, 520, 0, 0, 30, 153, 30, 175, 0,
+  528, 30, 517, 73, 0, 517, 76, 0, 0, 0, 76, 196,
+  528, 121, 0, 517, 53, 175, 9, 0, 53, 121, 629, 0,
+  606, 0, 0, 53, 0, 153, 0, 0, 520, 175, 73, 193,
+  528, 175, 153, 0, 0, 196, 76, 6, 175, 193, 196, 223,
+  73, 121, 0, 153, 153, 53, 217, 9, 0, 0, 196, 73,
+  0, 0, 9, 217, 53, 0, 76, 175, 9, 53, 153, 220,
+  53, 0, 0, 220, 217, 0, 0, 153, 63, 153, 0, 0,
+  0, 0, 53, 9, 0, 0, 0, 196, 517, 0, 220, 9,
+  9, 204, 9, 0, 0, 0, 0, 0, 0, 73, 517, 0,
+  9, 0, 0, 0, 9, 196, 0, 53, 53, 76, 223, 121,
+  9, 153, 0, 9, 9, 196, 63, 223, 175, 153, 0, 220,
+  217, 0, 53, 220, 0, 223, 121, 53, 517, 220, 9, 9,
+  153, 153, 223, 0, 0, 63, 0, 0, 517, 0, 517, 196,
+  153, 76, 153, 73, 0, 0, 775, 0, 220, 223, 76, 0,
+  0, 517, 0, 196, 12, 76, 0, 9, 121, 0, 196, 0,
+  9, 0, 121, 0, 0, 528, 528, 0, 271, 0, 196, 73,
+  517, 0, 0, 9, 624, 418, 204, 76, 63, 73, 517, 9,
+  0, 9, 220, 220, 517, 0, 0, 220, 53, 175, 63, 0,
+  175, 0, 175, 0, 76, 175, 528, 520, 520, 193, 0, 0,
+  9, 121, 175, 0, 193, 193, 76, 9, 9, 76, 175, 0,
+  196, 0, 271, 153, 153, 196, 153, 0, 175, 0, 0, 73,
+  53, 0, 196, 193, 0, 0, 153, 53, 196, 0, 196, 30,
+  76, 153, 0, 121, 53, 0, 121, 0, 0, 153, 121, 196,
+  271, 0, 121, 0, 0, 0, 520, 0, 0, 0, 0, 0,
+  0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 76,
+  0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 175,
+  0, 0, 9, 0, 0, 0, 0, 153, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 153, 0, 0, 121, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 121, 0, 0, 0, 175, 0, 0, 0, 121, 0, 0,
+  0, 0, 0, 271, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 193, 0, 121, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 328, 0, 153, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0,
+  0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 193,
+  0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0,
+  271, 0, 0, 0, 76, 9, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780, 0,
+  0, 0, 0, 76, 0, 0, 0, 0, 73, 0, 0, 0,
+  0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0,
+  0, 0, 0, 0, 0, 0, 73, 153, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 76, 0, 0, 76, 0, 76, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0,
+  0, 0, 0, 271, 0, 0, 0, 0, 0, 271, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+  0, 0, 76, 0, 175, 0, 0, 76, 0, 780, 0, 76,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0,
+  0, 0, 220, 0, 220, 220, 220, 196, 153, 528, 528, 220,
+  220, 223, 9, 175, 220, 220, 223, 223, 153, 528, 153, 196,
+  785, 528, 0, 153, 223, 220, 220, 220, 586, 788, 9, 0,
+  153, 76, 223, 220, 223, 793, 193, 520, 153, 196, 175, 196,
+  175, 528, 223, 528, 0, 196, 520, 271, 196, 121, 196, 223,
+  53, 196, 796, 520, 220, 220, 0, 0, 76, 0, 73, 153,
+  528, 175, 0, 223, 0, 53, 0, 520, 220, 528, 0, 223,
+  220, 528, 223, 76, 528, 223, 520, 223, 223, 223, 223, 220,
+  223, 153, 223, 0, 0, 196, 223, 153, 528, 220, 223, 153,
+  220, 223, 9, 76, 223, 0, 0, 175, 9, 9, 271, 9,
+  9, 220, 220, 804, 220, 220, 153, 223, 271, 121, 639, 0,
+  799, 9, 223, 193, 220, 796, 175, 0, 175, 153, 175, 153,
+  793, 223, 121, 220, 9, 9, 0, 153, 785, 9, 0, 153,
+  0, 220, 0, 153, 73, 793, 785, 220, 0, 153, 793, 193,
+  220, 223, 0, 0, 121, 793, 796, 121, 528, 785, 785, 0,
+  121, 76, 223, 796, 121, 153, 785, 121, 223, 73, 796, 121,
+  809, 9, 796, 220, 76, 175, 73, 0, 497, 517, 0, 220,
+  175, 196, 153, 220, 528, 785, 196, 53, 220, 196, 793, 175,
+  793, 0, 0, 121, 0, 271, 814, 196, 121, 220, 0, 541,
+  793, 196, 220, 76, 793, 223, 153, 220, 0, 76, 223, 0,
+  785, 153, 9, 153, 220, 121, 9, 153, 121, 73, 153, 785,
+  528, 153, 73, 9, 121, 517, 76, 785, 0, 0, 517, 528,
+  517, 517, 517, 0, 223, 517, 223, 223, 796, 196, 528, 220,
+  517, 220, 819, 520, 0, 0, 153, 0, 220, 175, 53, 220,
+  0, 0, 223, 520, 586, 223, 223, 819, 0, 196, 520, 220,
+  220, 223, 0, 220, 220, 220, 0, 824, 796, 220, 517, 0,
+  223, 0, 220, 528, 220, 220, 223, 0, 220, 223, 517, 0,
+  523, 220, 220, 220, 0, 121, 517, 517, 220, 520, 785, 223,
+  73, 196, 520, 220, 153, 517, 121, 829, 223, 220, 796, 0,
+  223, 785, 520, 0, 220, 223, 9, 796, 196, 785, 223, 121,
+  220, 220, 220, 796, 223, 0, 153, 0, 0, 0, 0, 528,
+  223, 220, 223, 196, 0, 207, 53, 520, 223, 528, 175, 193,
+  9, 220, 220, 0, 528, 0, 220, 223, 223, 76, 220, 528,
+  220, 528, 223, 175, 153, 73, 223, 76, 220, 223, 153, 193,
+  76, 528, 520, 271, 796, 809, 223, 520, 796, 220, 121, 0,
+  9, 0, 271, 9, 220, 528, 76, 76, 220, 153, 76, 196,
+  9, 796, 785, 153, 796, 220, 520, 196, 220, 175, 223, 153,
+  220, 271, 76, 153, 220, 785, 0, 793, 0, 73, 9, 796,
+  0, 775, 9, 73, 223, 9, 0, 0, 153, 220, 76, 9,
+  73, 0, 9, 76, 9, 196, 175, 121, 0, 0, 0, 528,
+  53, 121, 528, 153, 73, 9, 193, 153, 220, 153, 528, 0,
+  220, 121, 196, 153, 517, 517, 0, 223, 220, 517, 517, 0,
+  220, 220, 223, 591, 223, 121, 220, 220, 153, 520, 9, 785,
+  153, 220, 220, 223, 73, 517, 153, 153, 223, 220, 528, 153,
+  223, 0, 196, 0, 53, 0, 0, 0, 0, 153, 223, 0,
+  220, 0, 528, 220, 223, 0, 9, 0, 153, 196, 0, 121,
+  796, 220, 121, 0, 223, 0, 153, 53, 836, 223, 0, 196,
+  53, 196, 220, 9, 223, 196, 223, 223, 9, 517, 517, 223,
+  528, 223, 819, 220, 788, 528, 796, 0, 520, 9, 121, 0,
+  785, 220, 153, 824, 9, 9, 0, 796, 196, 0, 76, 785,
+  196, 220, 796, 0, 196, 196, 0, 796, 196, 785, 0, 153,
+  196, 9, 121, 121, 528, 0, 0, 223, 0, 121, 153, 793,
+  220, 121, 841, 796, 0, 220, 76, 53, 220, 0, 271, 73,
+  528, 153, 153, 796, 0, 0, 121, 271, 9, 0, 223, 153,
+  9, 220, 819, 796, 153, 220, 0, 223, 9, 153, 9, 153,
+  223, 9, 528, 793, 121, 528, 220, 0, 220, 121, 793, 0,
+  153, 0, 775, 517, 9, 0, 153, 153, 73, 223, 53, 0,
+  785, 0, 153, 223, 271, 121, 220, 53, 0, 220, 220, 639,
+  76, 517, 0, 193, 0, 223, 53, 153, 0, 223, 220, 121,
+  9, 517, 528, 528, 76, 212, 0, 793, 0, 0, 520, 528,
+  196, 796, 793, 520, 153, 9, 76, 223, 517, 520, 528, 121,
+  223, 0, 793, 9, 153, 0, 175, 53, 0, 846, 528, 520,
+  520, 0, 819, 121, 9, 76, 223, 73, 0, 220, 9, 223,
+  775, 775, 517, 0, 796, 528, 220, 9, 220, 528, 0, 0,
+  0, 121, 223, 220, 517, 0, 0, 793, 220, 520, 520, 175,
+  53, 223, 220, 223, 528, 528, 175, 0, 223, 0, 223, 0,
+  223, 0, 0, 223, 223, 528, 9, 220, 0, 196, 271, 793,
+  271, 53, 793, 0, 223, 0, 223, 53, 517, 528, 153, 223,
+  0, 223, 528, 223, 528, 223, 0, 0, 223, 153, 0, 0,
+  223, 223, 520, 220, 76, 121, 53, 0, 0, 223, 223, 220,
+  223, 220, 0, 220, 223, 520, 796, 73, 196, 220, 153, 0,
+  520, 9, 153, 9, 0, 220, 175, 0, 0, 53, 175, 9,
+  0, 517, 196, 0, 121, 0, 220, 76, 517, 271, 220, 220,
+  121, 196, 220, 196, 793, 0, 220, 0, 796, 153, 76, 175,
+  153, 796, 76, 0, 796, 175, 0, 9, 520, 121, 153, 463,
+  0, 73, 520, 73, 0, 0, 153, 121, 0, 175, 793, 9,
+  121, 153, 0, 76, 220, 785, 220, 528, 121, 0, 121, 0,
+  223, 0, 196, 220, 793, 196, 9, 9, 624, 220, 0, 0,
+  9, 223, 153, 121, 0, 0, 220, 196, 0, 0, 223, 196,
+  223, 220, 196, 153, 223, 207, 121, 220, 0, 223, 796, 196,
+  0, 153, 796, 153, 9, 796, 76, 0, 836, 223, 153, 0,
+  121, 121, 153, 220, 223, 196, 220, 796, 220, 9, 121, 9,
+  0, 0, 223, 121, 0, 153, 196, 563, 220, 528, 223, 9,
+  9, 153, 220, 53, 175, 517, 73, 220, 517, 175, 0, 121,
+  76, 175, 796, 121, 9, 856, 9, 796, 528, 528, 517, 53,
+  220, 851, 220, 793, 785, 196, 785, 785, 725, 0, 153, 528,
+  76, 785, 785, 121, 193, 271, 796, 271, 220, 639, 796, 793,
+  220, 196, 220, 223, 220, 0, 175, 793, 528, 517, 0, 76,
+  9, 220, 175, 796, 796, 0, 0, 528, 76, 528, 223, 796,
+  796, 73, 796, 793, 220, 517, 517, 153, 0, 153, 223, 0,
+  220, 0, 9, 193, 785, 0, 0, 0, 175, 0, 520, 0,
+  220, 196, 517, 9, 0, 0, 153, 793, 121, 220, 76, 785,
+  220, 220, 223, 153, 121, 796, 121, 220, 0, 153, 196, 0,
+  0, 0, 793, 0, 0, 793, 223, 528, 0, 0, 76, 223,
+  223, 153, 0, 0, 223, 153, 53, 0, 76, 0, 196, 0,
+  586, 520, 223, 223, 121, 0, 528, 517, 153, 785, 121, 9,
+  785, 121, 220, 9, 796, 223, 0, 207, 223, 153, 220, 196,
+  193, 819, 153, 76, 220, 196, 121, 0, 196, 223, 76, 153,
+  196, 0, 0, 0, 196, 153, 153, 223, 196, 196, 220, 153,
+  0, 175, 0, 520, 0, 223, 220, 0, 0, 121, 220, 528,
+  121, 796, 121, 793, 0, 9, 153, 121, 796, 220, 121, 220,
+  796, 517, 785, 520, 121, 9, 0, 0, 517, 193, 809, 796,
+  220, 220, 0, 796, 220, 841, 53, 0, 175, 271, 223, 0,
+  223, 520, 0, 220, 0, 0, 0, 0, 196, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 0,
+  0, 0, 76, 0, 0, 0, 271, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0,
+  0, 0, 0, 9, 0, 0, 9, 0, 153, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 271, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 523, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 153, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 153, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 528, 0,
+  0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  686, 0, 0, 785, 775, 785, 0, 528, 785, 796, 796, 528,
+  0, 0, 517, 153, 220, 528, 271, 528, 220, 196, 523, 528,
+  153, 861, 861, 861, 861, 220, 0, 196, 153, 517, 76, 528,
+  517, 785, 0, 861, 528, 775, 153, 0, 785, 0, 528, 528,
+  76, 528, 153, 528, 528, 220, 9, 864, 864, 528, 0, 785,
+  785, 9, 785, 528, 528, 528, 864, 864, 271, 796, 153, 153,
+  861, 0, 0, 0, 528, 0, 785, 785, 220, 0, 153, 517,
+  220, 153, 796, 861, 220, 76, 196, 153, 0, 0, 9, 785,
+  861, 864, 864, 864, 864, 53, 196, 220, 861, 528, 0, 861,
+  796, 196, 196, 271, 153, 517, 796, 0, 153, 861, 0, 864,
+  0, 220, 861, 196, 528, 788, 796, 220, 196, 220, 528, 0,
+  76, 196, 528, 0, 0, 796, 0, 0, 196, 867, 517, 76,
+  528, 153, 528, 0, 0, 0, 528, 861, 153, 528, 153, 796,
+  864, 528, 528, 864, 9, 175, 796, 528, 0, 220, 220, 528,
+  517, 528, 153, 153, 153, 528, 528, 153, 196, 861, 196, 517,
+  528, 528, 153, 220, 153, 196, 0, 53, 220, 528, 153, 0,
+  796, 517, 874, 220, 796, 220, 785, 220, 220, 220, 76, 861,
+  528, 175, 53, 53, 861, 196, 220, 196, 76, 528, 528, 0,
+  220, 153, 861, 153, 0, 196, 153, 9, 861, 861, 796, 153,
+  196, 528, 9, 220, 220, 220, 220, 517, 196, 0, 76, 666,
+  220, 220, 271, 528, 0, 220, 220, 220, 175, 0, 0, 0,
+  0, 153, 0, 517, 271, 153, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 879, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 879, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 879, 0, 0, 0, 0, 0, 271, 0, 0, 879,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  879, 0, 0, 0, 0, 0, 0, 879, 879, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 879, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 879, 0, 0, 0, 0, 0, 0,
+  879, 888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 888, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 897,
+  528, 0, 0, 0, 0, 0, 0, 0, 0, 897, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 888, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 879, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 897, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 153, 888, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 879,
+  0, 879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 861, 0, 0, 788, 0,
+  0, 0, 0, 0, 0, 796, 0, 906, 796, 153, 796, 796,
+  861, 528, 0, 796, 76, 796, 0, 220, 153, 906, 528, 76,
+  528, 220, 796, 906, 528, 528, 906, 0, 0, 796, 906, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 920, 0, 0, 0, 0, 0, 0, 0,
+  0, 909, 0, 0, 0, 909, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 909,
+  909, 0, 0, 920, 0, 0, 920, 0, 931, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0,
+  0, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 909, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 920, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 909, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 942, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  909, 0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 942, 0, 909, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 953, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 909, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 931, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 942, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 909, 0,
+  0, 0, 0, 0, 0, 909, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 909, 909, 0, 0,
+  0, 0, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 964, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 931, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 909, 0, 0, 0, 0, 909, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 909, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0, 0,
+  0, 0, 0, 942, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 942, 0, 0, 942, 0, 0, 0, 0, 0, 0,
+  0, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 931, 0, 909, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 909, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 920, 909, 0, 0, 0, 0, 0,
+  0, 0, 931, 0, 909, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931,
+  909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 920, 0, 931, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 909, 0, 0, 0,
+  0, 0, 0, 0, 920, 0, 0, 0, 909, 0, 0, 920,
+  909, 0, 920, 0, 0, 0, 0, 931, 0, 0, 0, 0,
+  0, 0, 0, 909, 0, 0, 909, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  920, 0, 920, 0, 0, 0, 0, 906, 975, 861, 975, 796,
+  0, 861, 978, 0, 991, 0, 0, 0, 1004, 1004, 0, 0,
+  0, 0, 0, 0, 978, 1017, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1030, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1043, 1043, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 991,
+  1043, 0, 0, 0, 1043, 1030, 0, 1043, 1043, 0, 0, 0,
+  0, 0, 0, 0, 0, 1043, 1056, 1056, 1069, 0, 991, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 1043, 0,
+  991, 1069, 991, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1030, 0, 0, 0, 0, 0, 0, 991, 0, 0,
+  0, 0, 1030, 0, 0, 0, 0, 0, 0, 0, 0, 1043,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 991,
+  0, 0, 0, 0, 991, 0, 0, 0, 0, 991, 0, 0,
+  1082, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 991, 1043, 0, 0, 0, 0, 0,
+  1030, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 1056, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 991, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  1043, 0, 0, 0, 0, 0, 0, 0, 0, 1095, 0, 0,
+  0, 0, 991, 0, 0, 0, 0, 1043, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1095, 0, 1108, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1030, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1004, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 1043, 991, 0, 0, 0, 1004, 1069, 0, 0, 0,
+  1121, 0, 991, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  991, 0, 0, 1108, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 991, 0, 0, 1069, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 991, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 991, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 991, 0,
+  0, 0, 0, 0, 0, 0, 1043, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1043, 0, 0, 1043, 0, 0, 0, 991, 0, 1108,
+  0, 0, 0, 0, 0, 0, 0, 1043, 0, 0, 1095, 0,
+  0, 1043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 991,
+  0, 1121, 0, 0, 0, 0, 0, 1043, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1004, 0, 0, 0, 0, 0,
+  1043, 0, 0, 0, 0, 0, 991, 0, 0, 0, 0, 0,
+  991, 0, 0, 1134, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1108, 0, 0, 1043, 0,
+  0, 0, 0, 1069, 0, 0, 0, 0, 1043, 1069, 0, 0,
+  0, 978, 0, 0, 1069, 0, 991, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1004, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1030,
+  0, 0, 1030, 0, 0, 0, 0, 0, 0, 0, 1030, 991,
+  0, 1043, 0, 1030, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1069, 0, 0, 991, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1043, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1069, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 0,
+  978, 991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1043, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1043, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 991, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 991,
+  0, 0, 1043, 0, 0, 0, 0, 0, 0, 1043, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1043, 0, 0, 991, 991, 0, 0, 991,
+  1043, 0, 1043, 0, 0, 0, 0, 0, 0, 991, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1069, 0, 1069, 0, 0, 0, 1043, 1147, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1162, 1177, 0,
+  0, 0, 0, 0, 1177, 0, 0, 0, 0, 0, 0, 1192,
+  0, 0, 0, 0, 0, 1207, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1222, 0, 0, 0, 0, 0, 0, 0, 1237,
+  0, 0, 0, 1222, 0, 1252, 0, 0, 1267, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1207, 0, 0, 0, 0,
+  1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1147, 0,
+  0, 0, 1237, 0, 0, 0, 0, 0, 0, 0, 1282, 0,
+  1282, 1147, 0, 0, 0, 0, 0, 1177, 1177, 0, 1147, 0,
+  0, 0, 0, 1297, 1177, 0, 1312, 1192, 1147, 0, 0, 0,
+  0, 1237, 0, 0, 0, 1297, 1147, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1147, 1147, 0, 0, 0, 0, 1222, 1222, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1282, 0, 1192, 0, 0,
+  0, 1267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1147, 0, 0, 0, 0, 0, 0, 1192, 0,
+  0, 0, 0, 1147, 1147, 0, 0, 0, 0, 0, 0, 1297,
+  0, 0, 0, 0, 1282, 0, 0, 1147, 0, 0, 0, 0,
+  1147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1177, 0,
+  0, 0, 1147, 0, 0, 1282, 0, 1282, 1147, 0, 0, 0,
+  0, 0, 0, 1147, 0, 0, 0, 0, 0, 0, 1327, 0,
+  0, 0, 0, 1237, 0, 1327, 1327, 1177, 1147, 0, 0, 1177,
+  0, 0, 0, 0, 0, 0, 1327, 1177, 1147, 1267, 0, 0,
+  0, 1342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1177, 0, 0, 0, 0, 0, 0, 0, 1222, 1327, 1177, 1357,
+  1357, 0, 1192, 0, 0, 0, 0, 0, 0, 0, 1147, 0,
+  0, 0, 0, 0, 0, 0, 1177, 0, 0, 0, 0, 0,
+  0, 0, 0, 1192, 0, 0, 0, 1147, 0, 0, 0, 1147,
+  0, 0, 0, 0, 0, 1282, 0, 0, 1222, 0, 0, 0,
+  0, 0, 0, 1342, 1147, 0, 0, 1372, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1222, 0, 0, 1192, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1147, 0, 0, 1192, 0, 1282, 0, 0, 1327, 0, 1177,
+  0, 0, 0, 0, 1147, 1237, 0, 0, 1147, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1222, 0, 0, 1222, 0, 0, 0, 0,
+  0, 0, 0, 1342, 0, 0, 0, 0, 1327, 1147, 0, 0,
+  1147, 1147, 1147, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1222, 0, 1207, 1342, 0, 1297, 0, 1282,
+  0, 0, 1147, 1222, 0, 0, 0, 0, 1147, 0, 0, 1222,
+  1342, 0, 0, 1282, 0, 0, 0, 0, 0, 0, 0, 0,
+  1282, 0, 1147, 0, 0, 1282, 0, 0, 1327, 0, 0, 0,
+  1147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1222, 0, 0, 0, 0, 1147, 0, 0, 1282, 1282, 0, 0,
+  0, 0, 0, 0, 1192, 1147, 0, 0, 0, 0, 1147, 1147,
+  0, 1282, 0, 0, 0, 1222, 0, 0, 0, 0, 1297, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1327, 0, 0, 0,
+  0, 1177, 0, 0, 0, 0, 0, 1282, 0, 0, 0, 1327,
+  0, 0, 0, 0, 0, 0, 0, 0, 1177, 0, 0, 1297,
+  1147, 1192, 0, 1177, 1282, 0, 1147, 0, 1387, 0, 0, 0,
+  0, 1207, 0, 0, 1402, 0, 0, 0, 1327, 1342, 0, 0,
+  0, 0, 0, 0, 1327, 0, 0, 0, 0, 0, 0, 1282,
+  0, 1312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1312, 0, 0, 1147, 0, 0, 0, 0, 0, 1282, 0, 0,
+  0, 0, 0, 0, 1147, 0, 0, 0, 0, 1282, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1147, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1417, 0, 0, 0,
+  0, 0, 0, 0, 0, 1342, 0, 1327, 1297, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1192, 0, 0,
+  0, 0, 0, 1177, 0, 0, 0, 1237, 0, 0, 1237, 0,
+  0, 1177, 0, 1192, 0, 0, 0, 0, 0, 1222, 1147, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1387, 1177,
+  0, 0, 0, 1222, 0, 0, 1147, 0, 0, 0, 1282, 0,
+  0, 0, 1267, 0, 1147, 0, 0, 1147, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1192, 1282, 1177,
+  1177, 0, 0, 1177, 0, 1177, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1342, 0, 0, 1282, 0, 0, 0,
+  0, 1327, 1177, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1147, 0, 1147, 0, 0, 0, 0, 0, 0, 1222,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1432, 0, 0, 1147, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1147, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1342, 0, 0, 0, 0, 0, 1147, 0,
+  0, 0, 0, 0, 0, 0, 0, 1387, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1147, 0, 1147,
+  0, 0, 1177, 0, 0, 0, 0, 0, 1417, 0, 1147, 1447,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1464, 0,
+  1481, 0, 0, 0, 1498, 0, 0, 0, 1515, 0, 1532, 0,
+  1447, 0, 0, 0, 0, 0, 0, 1549, 0, 0, 1498, 1566,
+  0, 0, 0, 1566, 0, 1566, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1566, 0, 1532, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1498, 0, 0, 0, 0, 1583, 0, 0,
+  0, 0, 0, 0, 0, 0, 1464, 0, 0, 0, 0, 1498,
+  1566, 1600, 1498, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1464, 0, 0, 1583, 0, 0, 1617, 1464, 0, 0, 1617, 0,
+  1634, 0, 1600, 1651, 0, 1464, 1668, 0, 1481, 0, 0, 0,
+  0, 1617, 0, 0, 1668, 1498, 0, 0, 1600, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1651, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1685,
+  0, 0, 0, 1498, 1566, 1617, 0, 0, 1447, 0, 1617, 0,
+  1464, 1498, 0, 1600, 0, 0, 1532, 0, 1617, 0, 0, 0,
+  1600, 1464, 1464, 0, 1464, 0, 0, 0, 0, 1600, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1702, 1600, 0,
+  0, 0, 0, 0, 0, 0, 1719, 0, 0, 0, 1447, 1736,
+  1736, 0, 1600, 1600, 1447, 0, 1447, 1600, 0, 0, 0, 0,
+  0, 1498, 0, 0, 1515, 0, 1651, 0, 0, 1481, 0, 1566,
+  1464, 0, 0, 1464, 0, 0, 0, 0, 1600, 0, 0, 0,
+  0, 1617, 1753, 1464, 0, 1770, 0, 1600, 0, 0, 1447, 0,
+  0, 0, 0, 0, 0, 1617, 0, 0, 1787, 1651, 0, 1532,
+  0, 1600, 0, 0, 0, 0, 1617, 1464, 1464, 1481, 0, 1617,
+  0, 0, 0, 1617, 0, 0, 0, 1464, 0, 1464, 1464, 0,
+  1464, 0, 0, 1600, 1651, 0, 0, 0, 0, 0, 0, 0,
+  0, 1600, 0, 0, 1464, 0, 1464, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1498, 0, 0, 0, 0, 0, 0, 0, 1804, 1498,
+  0, 0, 1634, 0, 0, 0, 0, 0, 0, 0, 0, 1770,
+  0, 1481, 1600, 1685, 1651, 0, 1617, 1719, 1702, 0, 1464, 0,
+  1464, 1600, 0, 0, 1651, 1651, 0, 1719, 1651, 0, 1464, 1464,
+  0, 0, 1702, 0, 1566, 0, 1464, 1566, 0, 0, 0, 0,
+  1821, 1481, 0, 0, 1685, 1600, 0, 0, 0, 0, 0, 0,
+  0, 1838, 1464, 1464, 0, 0, 1838, 0, 1464, 0, 0, 0,
+  0, 0, 1464, 0, 1464, 0, 0, 0, 1481, 1481, 0, 0,
+  1481, 0, 1481, 0, 0, 1498, 0, 0, 1651, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1600, 0, 1651, 1600, 1651,
+  1583, 1668, 0, 0, 0, 1464, 1464, 0, 0, 0, 0, 0,
+  0, 0, 1600, 0, 0, 0, 1617, 1464, 1464, 0, 1702, 1464,
+  1617, 1651, 0, 0, 0, 0, 1464, 0, 0, 0, 0, 1702,
+  0, 0, 0, 0, 1702, 0, 0, 0, 0, 0, 0, 0,
+  0, 1600, 0, 0, 0, 1617, 1464, 0, 0, 0, 1855, 0,
+  1464, 1668, 0, 0, 0, 0, 1481, 0, 0, 1464, 1464, 0,
+  0, 0, 0, 1651, 0, 0, 1651, 0, 0, 0, 1872, 0,
+  1566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1719, 1464, 0, 0, 1617, 0, 1481, 0, 0, 0, 1634, 0,
+  0, 0, 0, 1481, 1651, 0, 0, 1702, 0, 0, 1600, 1702,
+  1838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1447, 0, 0, 0, 1447, 1600, 0, 0, 0,
+  0, 1702, 0, 1770, 1600, 0, 0, 0, 1464, 0, 0, 0,
+  0, 0, 0, 0, 0, 1481, 0, 1617, 0, 0, 0, 0,
+  0, 0, 1770, 0, 0, 0, 1481, 1719, 0, 0, 0, 0,
+  0, 0, 0, 0, 1838, 1464, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1889, 1600, 1498, 0, 0, 0,
+  0, 1498, 0, 0, 0, 0, 1889, 0, 1889, 1804, 0, 0,
+  0, 0, 0, 1889, 1617, 0, 0, 0, 0, 0, 0, 1651,
+  0, 1651, 0, 0, 0, 0, 0, 0, 0, 1719, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1668, 0,
+  0, 0, 0, 1464, 0, 0, 1600, 1702, 0, 0, 0, 1617,
+  0, 1464, 1464, 0, 0, 0, 0, 0, 0, 1532, 1651, 1770,
+  0, 0, 0, 0, 1617, 1719, 0, 0, 1617, 0, 1464, 0,
+  0, 0, 0, 0, 0, 0, 1719, 0, 0, 0, 0, 0,
+  0, 0, 0, 1906, 0, 0, 0, 1600, 0, 0, 1617, 0,
+  1702, 0, 0, 0, 0, 1617, 1651, 0, 0, 1464, 0, 0,
+  0, 0, 0, 0, 1447, 0, 1600, 1600, 0, 0, 0, 0,
+  0, 0, 0, 1600, 1464, 1464, 0, 0, 0, 0, 1464, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1600, 0, 0, 1719,
+  1770, 0, 0, 0, 0, 0, 0, 0, 1719, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1600, 0, 0, 1464, 1464, 0,
+  1464, 0, 1464, 1617, 0, 0, 0, 1464, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1464, 1923, 0,
+  0, 0, 0, 0, 0, 1942, 0, 0, 1961, 0, 0, 0,
+  1961, 1980, 0, 0, 0, 0, 0, 0, 0, 1999, 0, 2018,
+  0, 0, 2037, 0, 2056, 0, 2056, 0, 2075, 1980, 0, 0,
+  0, 0, 0, 2094, 1980, 0, 0, 0, 0, 0, 2018, 2113,
+  2132, 2151, 2018, 0, 2170, 2151, 2151, 2094, 0, 1980, 2018, 1923,
+  0, 0, 0, 2037, 0, 0, 0, 0, 0, 2189, 0, 2189,
+  0, 0, 0, 0, 0, 0, 0, 2151, 0, 2018, 1980, 2208,
+  0, 0, 2227, 0, 0, 0, 2246, 2265, 0, 2037, 2189, 0,
+  0, 1942, 0, 2265, 0, 0, 2284, 0, 2265, 0, 0, 1942,
+  0, 0, 2303, 0, 0, 0, 2322, 2341, 2360, 2113, 0, 2113,
+  0, 0, 0, 2113, 0, 0, 2246, 2246, 2227, 0, 2246, 0,
+  1923, 0, 0, 0, 0, 1942, 2379, 1942, 2398, 2113, 0, 2113,
+  0, 0, 0, 0, 0, 0, 1980, 0, 0, 2265, 2018, 0,
+  0, 0, 0, 0, 0, 0, 2018, 0, 0, 2037, 2075, 0,
+  0, 0, 2417, 0, 2037, 0, 0, 2113, 2113, 0, 2246, 0,
+  0, 0, 0, 2246, 0, 2113, 2436, 0, 0, 0, 0, 0,
+  1923, 2455, 2379, 2113, 1980, 0, 2094, 0, 0, 0, 0, 0,
+  0, 0, 1999, 2474, 1980, 0, 0, 0, 0, 2398, 2265, 0,
+  2474, 0, 0, 0, 2474, 0, 0, 1942, 0, 2265, 2341, 2493,
+  2113, 0, 0, 0, 0, 2246, 1923, 0, 0, 0, 1942, 0,
+  0, 2341, 1942, 2512, 0, 2265, 0, 0, 2265, 0, 0, 2113,
+  2493, 1942, 1980, 1980, 1999, 0, 2531, 0, 0, 0, 0, 2170,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2265, 0, 0, 0, 1980, 0, 0, 2094, 2550, 0, 1999,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2246, 0,
+  0, 2265, 0, 2227, 2303, 0, 2474, 2189, 2455, 2493, 0, 2265,
+  2493, 0, 0, 0, 2265, 0, 0, 0, 0, 2075, 2265, 0,
+  2246, 0, 0, 0, 0, 2322, 0, 2455, 0, 2037, 0, 0,
+  2037, 0, 0, 0, 2265, 2265, 0, 0, 0, 2398, 2151, 1980,
+  0, 0, 0, 0, 0, 0, 0, 0, 2493, 0, 0, 0,
+  2265, 0, 0, 0, 2265, 2265, 0, 2037, 0, 0, 0, 0,
+  0, 0, 0, 0, 2037, 2113, 0, 0, 0, 2265, 2455, 0,
+  0, 0, 2246, 0, 0, 0, 0, 0, 2113, 0, 0, 0,
+  2018, 2569, 0, 1961, 0, 0, 2265, 0, 0, 0, 1942, 0,
+  0, 2455, 0, 0, 0, 0, 2189, 0, 0, 2037, 2265, 0,
+  0, 0, 0, 0, 0, 0, 0, 2588, 0, 0, 0, 0,
+  0, 2208, 0, 0, 0, 0, 2189, 0, 2512, 0, 2455, 0,
+  0, 2455, 0, 0, 2037, 2037, 0, 2189, 0, 0, 0, 0,
+  2398, 0, 0, 2398, 2265, 0, 0, 0, 0, 2227, 2607, 0,
+  0, 2113, 2246, 0, 0, 0, 2398, 0, 2113, 0, 2113, 0,
+  2569, 0, 0, 2246, 2113, 0, 0, 2607, 2113, 0, 2227, 0,
+  0, 2398, 0, 0, 2398, 1980, 2151, 0, 2246, 2398, 2398, 2398,
+  0, 0, 0, 0, 0, 0, 2493, 0, 0, 0, 0, 0,
+  0, 0, 0, 2227, 2360, 2018, 0, 0, 0, 0, 0, 0,
+  2360, 0, 2113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1923, 2018, 0, 0, 2626, 2246, 0, 0, 2265, 1942, 1942,
+  1942, 1942, 2607, 2493, 0, 1942, 0, 0, 0, 0, 2303, 0,
+  0, 0, 0, 0, 0, 0, 0, 2322, 0, 2398, 0, 0,
+  0, 2455, 0, 2265, 2189, 0, 1942, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2227, 2113, 1942, 0, 2455, 2493, 0, 2512,
+  0, 0, 0, 0, 2189, 2341, 2341, 0, 0, 1942, 0, 0,
+  2113, 0, 0, 2284, 0, 0, 2246, 2341, 0, 0, 1961, 2645,
+  1942, 2341, 0, 0, 2569, 0, 0, 0, 2189, 0, 0, 0,
+  1980, 2113, 2398, 0, 2265, 0, 0, 0, 0, 0, 2265, 0,
+  2265, 0, 2246, 0, 0, 0, 0, 2455, 1942, 0, 2113, 0,
+  0, 0, 0, 2398, 2265, 2170, 2094, 0, 2664, 0, 0, 0,
+  1942, 2246, 0, 2037, 0, 0, 0, 0, 1942, 2265, 1942, 0,
+  2265, 2265, 0, 2246, 0, 1942, 1942, 0, 1942, 2265, 2246, 0,
+  2265, 2265, 1942, 2265, 0, 0, 2265, 2265, 2683, 2113, 0, 2702,
+  0, 2723, 0, 0, 2744, 2765, 2786, 0, 2807, 2849, 0, 2765,
+  0, 0, 0, 0, 0, 2828, 0, 0, 0, 0, 2870, 0,
+  2765, 0, 0, 2891, 0, 2912, 2933, 2786, 0, 2786, 2954, 0,
+  0, 0, 0, 0, 0, 2891, 0, 0, 0, 0, 2975, 0,
+  0, 2702, 2996, 0, 0, 0, 3017, 2975, 0, 0, 0, 2786,
+  2912, 0, 3038, 2933, 3059, 0, 0, 0, 2975, 2723, 0, 0,
+  0, 0, 2723, 0, 3080, 0, 2723, 0, 0, 0, 0, 2723,
+  0, 0, 3101, 0, 0, 0, 0, 0, 2765, 0, 0, 2912,
+  0, 3122, 0, 0, 2933, 3143, 3143, 3164, 0, 2891, 0, 3185,
+  3206, 0, 0, 2723, 0, 2723, 0, 2723, 0, 0, 0, 0,
+  2975, 2933, 3227, 2912, 0, 0, 0, 2954, 3248, 0, 0, 0,
+  2975, 0, 0, 0, 2786, 2975, 0, 3269, 0, 2807, 3269, 3290,
+  2996, 0, 3269, 0, 0, 3311, 2702, 2702, 0, 0, 3332, 2975,
+  0, 3332, 3353, 3374, 0, 0, 2912, 0, 2828, 0, 3332, 0,
+  3395, 3395, 2786, 3416, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3353, 0, 2702, 3437, 0, 0, 0, 0,
+  0, 2828, 2849, 2849, 3458, 0, 0, 0, 0, 3479, 2975, 3500,
+  0, 0, 3521, 2702, 3269, 0, 3227, 3542, 0, 0, 3563, 3206,
+  0, 0, 0, 0, 3206, 3584, 0, 0, 0, 0, 0, 0,
+  2954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2702, 3269, 3605, 0, 0, 0, 0, 0, 0, 3332, 2933, 0,
+  0, 0, 3269, 3269, 3269, 0, 0, 2975, 0, 3500, 0, 0,
+  0, 3500, 0, 0, 0, 0, 2765, 0, 0, 3143, 0, 0,
+  0, 0, 0, 3080, 3416, 2996, 0, 3353, 0, 0, 0, 3626,
+  0, 0, 0, 3647, 3206, 0, 3500, 0, 0, 0, 2996, 0,
+  0, 0, 0, 0, 0, 3521, 0, 3647, 3332, 2933, 2765, 0,
+  3206, 0, 2786, 3269, 0, 0, 2975, 2975, 3269, 0, 2723, 3395,
+  0, 0, 2996, 0, 0, 0, 0, 0, 2723, 0, 3017, 3416,
+  0, 0, 0, 2765, 2765, 0, 0, 3668, 3689, 0, 0, 0,
+  0, 2765, 0, 0, 0, 3521, 0, 0, 0, 0, 0, 0,
+  3437, 3332, 3143, 0, 3143, 3710, 0, 3416, 0, 3353, 0, 0,
+  3164, 3731, 0, 2933, 3101, 3164, 0, 3332, 3269, 2702, 2702, 0,
+  0, 0, 0, 0, 0, 3395, 2807, 3332, 0, 0, 2807, 0,
+  3752, 3647, 0, 0, 0, 3269, 0, 3269, 2975, 2765, 3395, 0,
+  0, 0, 0, 3773, 0, 2702, 2702, 3395, 0, 3395, 3752, 3626,
+  0, 0, 0, 3752, 2702, 0, 3080, 0, 2786, 0, 0, 0,
+  0, 3668, 0, 2765, 2723, 2723, 2723, 2891, 2870, 3647, 0, 0,
+  0, 3353, 0, 0, 0, 2702, 0, 0, 3332, 0, 3794, 0,
+  3395, 3269, 0, 0, 0, 3164, 0, 2975, 0, 2702, 2702, 2975,
+  0, 0, 3269, 0, 0, 0, 0, 3269, 0, 3269, 0, 0,
+  3815, 0, 0, 3838, 3861, 0, 0, 3884, 0, 0, 3907, 3907,
+  3930, 0, 0, 0, 3953, 0, 3884, 0, 0, 3976, 3999, 0,
+  3953, 3953, 0, 0, 0, 0, 0, 0, 0, 4022, 0, 4045,
+  3953, 4068, 4091, 0, 0, 0, 4045, 0, 0, 0, 0, 4114,
+  0, 0, 3953, 0, 0, 0, 0, 3838, 4137, 4160, 0, 4183,
+  3815, 4068, 0, 4206, 3884, 4229, 4114, 0, 0, 3976, 4252, 4275,
+  4298, 0, 0, 3815, 3953, 0, 0, 0, 0, 4068, 4321, 0,
+  4344, 0, 4367, 4045, 0, 4390, 0, 3953, 3838, 4413, 4436, 0,
+  4068, 0, 0, 0, 0, 4459, 0, 4459, 3861, 0, 0, 4482,
+  0, 4114, 4505, 0, 4528, 4551, 0, 4574, 4459, 0, 0, 0,
+  0, 0, 4597, 0, 4298, 4298, 0, 4620, 0, 4643, 4666, 0,
+  4045, 4689, 4643, 0, 0, 4712, 4528, 4735, 0, 0, 3861, 4022,
+  0, 0, 4045, 0, 0, 0, 4758, 0, 4160, 4781, 0, 4413,
+  4804, 0, 4298, 4827, 0, 0, 0, 4045, 0, 0, 0, 0,
+  3976, 0, 4643, 4850, 0, 4873, 0, 0, 3838, 4896, 0, 0,
+  4068, 0, 0, 0, 0, 4321, 0, 0, 0, 0, 0, 4919,
+  0, 0, 4873, 0, 4804, 4413, 0, 0, 4643, 0, 0, 4942,
+  4758, 3976, 0, 0, 4712, 0, 4942, 0, 0, 0, 0, 4942,
+  4965, 0, 4022, 0, 0, 0, 0, 0, 4988, 0, 0, 4528,
+  0, 0, 0, 0, 5011, 5034, 0, 5057, 5080, 5103, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4827, 4321, 0,
+  4551, 0, 0, 0, 4344, 0, 5126, 4551, 0, 4390, 0, 0,
+  0, 3861, 0, 3976, 5011, 5149, 0, 5149, 0, 0, 0, 0,
+  4160, 0, 0, 0, 0, 5172, 4804, 4804, 0, 0, 5195, 4597,
+  0, 0, 0, 0, 5126, 5218, 5243, 5268, 0, 5293, 5318, 5343,
+  0, 0, 0, 0, 5368, 0, 5393, 0, 0, 5418, 0, 0,
+  0, 0, 0, 0, 5443, 0, 0, 5468, 5368, 5493, 0, 0,
+  0, 5518, 0, 0, 5543, 5568, 5593, 0, 5618, 5643, 0, 0,
+  0, 5668, 0, 5693, 0, 0, 5718, 5518, 0, 0, 0, 0,
+  5443, 0, 0, 5743, 5768, 5793, 5718, 5443, 5693, 5818, 0, 5843,
+  0, 0, 0, 5868, 0, 0, 0, 5893, 5518, 5918, 5218, 5943,
+  5968, 0, 5818, 0, 5393, 5993, 0, 0, 5918, 0, 5643, 0,
+  6018, 6043, 0, 6068, 0, 5493, 5493, 0, 6093, 5893, 0, 0,
+  0, 0, 6118, 0, 0, 0, 5443, 0, 0, 5393, 6143, 0,
+  6168, 0, 0, 5393, 0, 0, 6193, 0, 0, 0, 6168, 6218,
+  0, 6243, 6218, 6268, 6018, 6293, 0, 0, 6318, 0, 0, 0,
+  5818, 0, 6343, 6368, 6393, 6418, 0, 0, 5218, 0, 5643, 6443,
+  0, 0, 6468, 0, 6493, 6468, 0, 0, 0, 6143, 0, 6468,
+  0, 6518, 0, 0, 5493, 6218, 6543, 5393, 0, 0, 0, 0,
+  5918, 6568, 6593, 0, 0, 5468, 0, 0, 6618, 0, 0, 0,
+  0, 6645, 0, 0, 0, 0, 6672, 6672, 6699, 6726, 0, 0,
+  6753, 6780, 0, 0, 0, 0, 6807, 0, 6834, 6861, 6888, 0,
+  0, 0, 0, 0, 0, 0, 6915, 6942, 6969, 0, 0, 0,
+  6996, 0, 0, 0, 7023, 0, 7050, 7077, 7104, 0, 0, 7131,
+  7023, 7158, 0, 6996, 0, 7185, 0, 0, 0, 0, 0, 7212,
+  0, 0, 0, 7239, 0, 6672, 6672, 7266, 0, 7293, 0, 0,
+  0, 6969, 0, 7320, 7347, 7347, 0, 7266, 0, 0, 7374, 7401,
+  7428, 0, 0, 0, 0, 0, 0, 6969, 0, 0, 7455, 7482,
+  0, 7509, 7538, 0, 7567, 0, 7596, 7625, 0, 7654, 0, 0,
+  0, 0, 7683, 7567, 7712, 7741, 0, 0, 0, 0, 7770, 7799,
+  7828, 0, 7857, 7886, 0, 0, 7915, 7944, 0, 0, 7973, 8002,
+  8031, 8060, 0, 0, 8089, 0, 0, 8118, 0, 8147, 8176, 0,
+  8205, 0, 8234, 0, 8263, 8292, 8321, 0, 8350, 0, 0, 0,
+  0, 8379, 0, 8410, 8441, 0, 0, 0, 0, 0, 0, 8472,
+  8503, 8534, 0, 0, 0, 0, 8565, 0, 0, 0, 0, 0,
+  0, 8596, 8627, 0, 0, 8658, 8689, 0, 0, 8720, 8753, 8786,
+  8819, 0, 8852, 0, 8885, 0, 0, 8918, 8918, 0, 0, 8951,
+  8984, 0, 0, 9017, 0, 9052, 0, 0, 9087, 9122, 0, 9157,
+  9192, 0, 9229, 9266, 0, 0, 0, 0, 0, 0, 9303, 0,
+  0, 9346, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0
+  };
+
+static const unsigned char hyph_en_values[9397] =
+  {
+  0, 2, 2, 2, 1, 2, 1, 1, 2, 1, 2, 4,
+  1, 1, 1, 1, 0, 2, 2, 2, 2, 1, 1, 3,
+  2, 2, 1, 5, 0, 2, 1, 2, 2, 2, 2, 4,
+  1, 1, 2, 2, 4, 1, 3, 2, 2, 4, 1, 5,
+  2, 1, 2, 0, 2, 1, 0, 4, 3, 2, 1, 1,
+  4, 0, 4, 1, 2, 1, 3, 2, 4, 1, 3, 0,
+  2, 1, 1, 3, 1, 1, 5, 1, 0, 1, 2, 2,
+  1, 1, 2, 3, 2, 2, 1, 1, 0, 2, 3, 2,
+  4, 1, 1, 0, 4, 2, 1, 1, 0, 4, 2, 1,
+  1, 0, 2, 2, 1, 5, 0, 2, 2, 2, 2, 1,
+  3, 1, 2, 3, 2, 1, 4, 0, 2, 3, 2, 4,
+  1, 1, 0, 2, 2, 2, 4, 0, 4, 2, 2, 2,
+  0, 4, 3, 2, 4, 1, 5, 0, 4, 1, 2, 5,
+  2, 2, 4, 0, 2, 3, 2, 1, 1, 2, 0, 2,
+  3, 2, 2, 1, 3, 0, 2, 1, 1, 4, 2, 2,
+  2, 0, 2, 2, 2, 1, 0, 2, 2, 1, 3, 0,
+  2, 1, 0, 3, 1, 3, 4, 2, 3, 4, 2, 2,
+  1, 3, 2, 2, 3, 4, 1, 4, 2, 2, 4, 1,
+  4, 1, 3, 1, 1, 3, 5, 1, 3, 3, 2, 3,
+  4, 1, 2, 2, 3, 4, 1, 5, 2, 3, 4, 0,
+  4, 2, 3, 2, 2, 3, 2, 3, 5, 0, 4, 2,
+  3, 2, 2, 5, 2, 3, 3, 0, 2, 2, 3, 2,
+  2, 1, 2, 3, 3, 2, 4, 1, 0, 5, 3, 3,
+  2, 2, 3, 1, 4, 3, 3, 1, 2, 4, 1, 3,
+  2, 3, 1, 1, 1, 2, 3, 4, 2, 5, 2, 2,
+  1, 1, 1, 2, 2, 1, 1, 4, 2, 3, 2, 2,
+  2, 2, 3, 4, 1, 3, 2, 1, 2, 0, 4, 2,
+  1, 4, 0, 1, 2, 1, 3, 0, 4, 2, 2, 2,
+  0, 5, 2, 3, 1, 1, 4, 3, 3, 3, 2, 4,
+  1, 4, 3, 3, 2, 2, 5, 1, 3, 2, 3, 4,
+  2, 1, 2, 3, 2, 1, 1, 2, 3, 4, 1, 1,
+  2, 3, 5, 2, 2, 2, 3, 1, 2, 2, 3, 3,
+  4, 2, 4, 1, 4, 2, 3, 4, 2, 4, 2, 3,
+  2, 0, 4, 2, 1, 2, 0, 1, 3, 3, 2, 2,
+  1, 1, 2, 3, 3, 4, 2, 3, 1, 2, 2, 3,
+  3, 1, 4, 2, 3, 3, 1, 1, 2, 3, 1, 2,
+  4, 2, 3, 5, 1, 4, 2, 2, 1, 0, 4, 2,
+  2, 3, 0, 4, 2, 1, 4, 0, 4, 2, 2, 2,
+  1, 5, 2, 1, 2, 0, 3, 2, 1, 4, 0, 3,
+  2, 3, 2, 1, 2, 2, 3, 5, 1, 3, 3, 3,
+  4, 2, 1, 1, 2, 3, 3, 2, 2, 1, 1, 4,
+  2, 2, 4, 1, 2, 2, 2, 5, 1, 4, 2, 3,
+  3, 0, 4, 2, 2, 3, 1, 2, 2, 2, 5, 1,
+  2, 1, 4, 4, 1, 4, 3, 2, 3, 5, 1, 5,
+  1, 4, 5, 2, 2, 3, 1, 3, 2, 2, 5, 0,
+  4, 2, 2, 5, 1, 5, 3, 4, 5, 3, 5, 1,
+  4, 2, 4, 4, 3, 1, 2, 4, 2, 1, 4, 2,
+  3, 5, 2, 4, 2, 4, 4, 2, 3, 2, 4, 4,
+  2, 1, 2, 4, 5, 2, 3, 1, 4, 1, 2, 4,
+  4, 3, 5, 2, 3, 4, 2, 3, 2, 3, 5, 0,
+  5, 2, 3, 3, 0, 3, 1, 4, 2, 2, 3, 1,
+  0, 4, 2, 4, 4, 2, 2, 2, 1, 2, 0, 5,
+  2, 4, 4, 2, 4, 2, 4, 2, 3, 3, 2, 3,
+  1, 1, 3, 2, 1, 5, 0, 4, 2, 4, 3, 3,
+  4, 2, 4, 5, 3, 4, 3, 4, 4, 3, 3, 2,
+  3, 2, 4, 5, 1, 5, 2, 2, 5, 0, 5, 2,
+  2, 3, 1, 4, 2, 4, 3, 1, 4, 2, 4, 4,
+  1, 4, 2, 4, 5, 2, 5, 2, 4, 2, 2, 4,
+  3, 4, 5, 3, 5, 2, 2, 2, 4, 4, 1, 5,
+  2, 4, 4, 3, 2, 3, 3, 2, 2, 5, 1, 5,
+  2, 4, 1, 3, 4, 2, 1, 4, 0, 5, 2, 3,
+  5, 2, 5, 2, 1, 1, 0, 3, 2, 4, 3, 2,
+  3, 2, 4, 1, 3, 1, 2, 2, 3, 0, 5, 2,
+  4, 5, 1, 4, 2, 1, 3, 0, 3, 2, 4, 2,
+  3, 5, 2, 4, 5, 1, 3, 2, 4, 5, 3, 5,
+  2, 1, 5, 0, 5, 1, 5, 4, 2, 5, 5, 4,
+  5, 1, 5, 3, 1, 5, 5, 2, 5, 3, 3, 3,
+  2, 5, 3, 2, 5, 2, 5, 4, 4, 3, 2, 5,
+  4, 4, 5, 2, 4, 4, 3, 3, 2, 3, 3, 2,
+  3, 3, 4, 4, 3, 3, 1, 3, 2, 3, 3, 1,
+  3, 2, 4, 3, 3, 3, 2, 2, 3, 0, 3, 2,
+  5, 5, 3, 3, 2, 5, 5, 1, 4, 1, 6, 5,
+  1, 6, 4, 3, 6, 5, 3, 5, 2, 5, 2, 5,
+  5, 3, 5, 4, 5, 10, 4, 10, 3, 10, 2, 10,
+  4, 5, 10, 4, 10, 3, 11, 2, 10, 4, 5, 10,
+  4, 11, 3, 10, 2, 10, 1, 7, 5, 5, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 5, 6, 10, 5,
+  10, 4, 10, 3, 10, 2, 10, 5, 6, 10, 5, 10,
+  4, 10, 3, 11, 2, 10, 5, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 5, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 11, 5, 6, 10, 5, 11, 4, 10, 3,
+  11, 2, 10, 1, 8, 5, 6, 7, 10, 6, 10, 5,
+  10, 4, 11, 3, 11, 2, 10, 6, 7, 10, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 6, 7, 10, 6,
+  10, 5, 11, 4, 11, 3, 10, 2, 10, 6, 7, 10,
+  6, 11, 5, 11, 4, 10, 3, 10, 2, 10, 6, 7,
+  10, 6, 11, 5, 10, 4, 10, 3, 10, 2, 10, 6,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  6, 7, 10, 6, 10, 5, 10, 4, 10, 3, 11, 2,
+  10, 6, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 6, 7, 10, 6, 11, 5, 10, 4, 11, 3,
+  11, 2, 10, 6, 7, 10, 6, 11, 5, 10, 4, 10,
+  3, 11, 2, 10, 6, 7, 10, 6, 11, 5, 10, 4,
+  11, 3, 10, 2, 10, 6, 7, 10, 6, 10, 5, 11,
+  4, 10, 3, 11, 2, 10, 6, 7, 10, 6, 11, 5,
+  10, 4, 10, 3, 11, 2, 11, 7, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 7, 8,
+  10, 7, 11, 6, 11, 5, 10, 4, 10, 3, 10, 2,
+  10, 7, 8, 10, 7, 10, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 10, 7, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 10, 2, 10, 7, 8, 10, 7, 11,
+  6, 10, 5, 10, 4, 11, 3, 11, 2, 10, 7, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2,
+  10, 7, 8, 10, 7, 11, 6, 10, 5, 10, 4, 10,
+  3, 10, 2, 10, 7, 8, 11, 7, 10, 6, 10, 5,
+  10, 4, 10, 3, 11, 2, 10, 7, 8, 10, 7, 11,
+  6, 10, 5, 10, 4, 10, 3, 11, 2, 10, 7, 8,
+  10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10, 2,
+  10, 7, 8, 10, 7, 10, 6, 11, 5, 11, 4, 10,
+  3, 10, 2, 10, 7, 8, 10, 7, 10, 6, 10, 5,
+  10, 4, 10, 3, 10, 2, 10, 7, 8, 10, 7, 10,
+  6, 11, 5, 10, 4, 11, 3, 10, 2, 10, 7, 8,
+  10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 11, 2,
+  10, 7, 8, 10, 7, 11, 6, 11, 5, 10, 4, 10,
+  3, 11, 2, 10, 7, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 11, 2, 10, 7, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 11, 2, 10, 7, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 11, 2,
+  11, 7, 8, 10, 7, 10, 6, 10, 5, 10, 4, 10,
+  3, 11, 2, 10, 7, 8, 10, 7, 10, 6, 10, 5,
+  11, 4, 11, 3, 10, 2, 10, 8, 9, 10, 8, 10,
+  7, 10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10,
+  8, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 8, 9, 10, 8, 10, 7, 10,
+  6, 11, 5, 10, 4, 11, 3, 10, 2, 10, 8, 9,
+  10, 8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 8, 9, 10, 8, 11, 7, 10, 6, 11,
+  5, 10, 4, 10, 3, 11, 2, 10, 8, 9, 10, 8,
+  11, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10, 2,
+  10, 8, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11,
+  4, 10, 3, 10, 2, 10, 8, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 8,
+  9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4, 11,
+  3, 10, 2, 10, 8, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 8, 9, 10,
+  8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10,
+  2, 10, 8, 9, 10, 8, 11, 7, 10, 6, 10, 5,
+  10, 4, 11, 3, 11, 2, 10, 8, 9, 10, 8, 10,
+  7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  8, 9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 8, 9, 10, 8, 11, 7, 10,
+  6, 11, 5, 10, 4, 11, 3, 10, 2, 10, 8, 9,
+  10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 10, 3,
+  10, 2, 10, 8, 9, 10, 8, 10, 7, 10, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 8, 9, 10, 8,
+  11, 7, 10, 6, 11, 5, 11, 4, 10, 3, 10, 2,
+  10, 8, 9, 10, 8, 10, 7, 10, 6, 11, 5, 11,
+  4, 11, 3, 10, 2, 10, 8, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 11, 2, 10, 8,
+  9, 10, 8, 10, 7, 11, 6, 10, 5, 11, 4, 11,
+  3, 10, 2, 10, 8, 9, 10, 8, 11, 7, 10, 6,
+  10, 5, 10, 4, 10, 3, 11, 2, 10, 8, 9, 10,
+  8, 10, 7, 11, 6, 11, 5, 10, 4, 11, 3, 10,
+  2, 10, 8, 9, 10, 8, 10, 7, 10, 6, 11, 5,
+  10, 4, 10, 3, 11, 2, 10, 8, 9, 10, 8, 10,
+  7, 11, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10,
+  8, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 11, 2, 10, 8, 9, 10, 8, 11, 7, 10,
+  6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 8, 9,
+  10, 8, 10, 7, 10, 6, 10, 5, 11, 4, 11, 3,
+  10, 2, 10, 9, 10, 10, 9, 11, 8, 10, 7, 11,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 9, 10,
+  10, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 10,
+  7, 10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10,
+  9, 10, 10, 9, 11, 8, 10, 7, 10, 6, 11, 5,
+  10, 4, 10, 3, 10, 2, 10, 9, 10, 10, 9, 11,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3, 10,
+  2, 10, 9, 10, 10, 9, 11, 8, 10, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 9, 10, 10,
+  9, 11, 8, 10, 7, 10, 6, 11, 5, 11, 4, 10,
+  3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 11, 4, 11, 3, 10, 2, 10, 9,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 10,
+  4, 11, 3, 10, 2, 10, 9, 10, 10, 9, 11, 8,
+  10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 11, 2,
+  10, 9, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 9, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 10, 5, 11, 4, 11, 3,
+  10, 2, 10, 9, 10, 10, 9, 11, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 11, 3, 10, 2, 10, 9, 10,
+  10, 9, 11, 8, 10, 7, 11, 6, 10, 5, 10, 4,
+  10, 3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 10,
+  7, 11, 6, 10, 5, 10, 4, 10, 3, 11, 2, 10,
+  9, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10, 5,
+  11, 4, 11, 3, 10, 2, 10, 9, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 9, 10, 10, 9, 10, 8, 11, 7, 10, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 9, 10, 10,
+  9, 10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 10,
+  3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 9,
+  10, 10, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10,
+  4, 11, 3, 10, 2, 10, 9, 10, 10, 9, 10, 8,
+  11, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10, 2,
+  10, 9, 10, 10, 9, 10, 8, 10, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 9, 10, 10, 9,
+  11, 8, 10, 7, 10, 6, 10, 5, 10, 4, 10, 3,
+  10, 2, 10, 9, 10, 10, 9, 10, 8, 10, 7, 11,
+  6, 11, 5, 10, 4, 10, 3, 10, 2, 10, 9, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 11,
+  7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  9, 10, 10, 9, 11, 8, 10, 7, 11, 6, 11, 5,
+  10, 4, 10, 3, 10, 2, 10, 9, 10, 10, 9, 10,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3, 10,
+  2, 10, 9, 10, 10, 9, 10, 8, 11, 7, 10, 6,
+  11, 5, 10, 4, 11, 3, 10, 2, 10, 9, 10, 10,
+  9, 10, 8, 11, 7, 10, 6, 11, 5, 10, 4, 10,
+  3, 10, 2, 10, 9, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 9,
+  10, 10, 9, 11, 8, 10, 7, 11, 6, 10, 5, 10,
+  4, 10, 3, 11, 2, 10, 9, 10, 10, 9, 11, 8,
+  10, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10, 2,
+  10, 9, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10,
+  5, 10, 4, 10, 3, 11, 2, 10, 9, 10, 10, 9,
+  10, 8, 10, 7, 11, 6, 11, 5, 10, 4, 10, 3,
+  11, 2, 10, 9, 10, 10, 9, 10, 8, 11, 7, 10,
+  6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 9, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 11, 2, 10, 9, 10, 10, 9, 10, 8, 10,
+  7, 10, 6, 10, 5, 10, 4, 11, 3, 11, 2, 10,
+  9, 10, 10, 9, 11, 8, 10, 7, 10, 6, 10, 5,
+  10, 4, 10, 3, 11, 2, 10, 9, 10, 10, 9, 10,
+  8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3, 11,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 10, 8, 10, 7, 11, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 10, 4,
+  10, 3, 11, 2, 10, 10, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 10,
+  11, 10, 10, 11, 9, 10, 8, 10, 7, 11, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 10, 4,
+  11, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3, 11,
+  2, 10, 10, 11, 10, 10, 10, 9, 11, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 11, 2, 10, 10,
+  11, 10, 10, 11, 9, 10, 8, 10, 7, 10, 6, 10,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 10, 4,
+  11, 3, 10, 2, 10, 10, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10, 10,
+  11, 10, 10, 11, 9, 10, 8, 10, 7, 10, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 11, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 11, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 11, 5, 10, 4, 10, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 10, 8, 11, 7, 11, 6, 10,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  11, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 10, 4, 11, 3, 10, 2, 10, 10,
+  11, 10, 10, 11, 9, 11, 8, 10, 7, 10, 6, 10,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 10, 5, 10, 4,
+  11, 3, 10, 2, 10, 10, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 11, 4, 11, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 10, 8, 10, 7, 10, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  11, 3, 10, 2, 10, 10, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 11, 5, 10, 4, 11, 3, 10,
+  2, 10, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 11, 5, 10, 4, 11, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 10, 8, 11, 7, 10, 6, 11,
+  5, 10, 4, 11, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 11, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 10,
+  11, 10, 10, 10, 9, 11, 8, 11, 7, 10, 6, 10,
+  5, 10, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 11, 6, 10, 5, 11, 4, 11, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 10, 3, 11, 2, 10, 10,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 11, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 11, 2, 10, 10, 11, 10, 10, 11, 9, 10,
+  8, 10, 7, 10, 6, 11, 5, 11, 4, 10, 3, 11,
+  2, 10, 10, 11, 10, 10, 10, 9, 11, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 11, 3, 11, 2, 10, 10,
+  11, 10, 10, 11, 9, 10, 8, 10, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 10, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 10, 11, 10, 10, 10, 9, 11, 8, 10, 7,
+  10, 6, 10, 5, 11, 4, 11, 3, 10, 2, 10, 11,
+  12, 10, 11, 11, 10, 10, 9, 10, 8, 11, 7, 10,
+  6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 11, 12,
+  10, 11, 11, 10, 10, 9, 11, 8, 10, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 11, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 11, 12, 10, 11,
+  11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 10, 2, 10, 11, 12, 10, 11, 11,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11,
+  4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 10,
+  9, 11, 8, 10, 7, 10, 6, 10, 5, 11, 4, 10,
+  3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9, 11,
+  8, 10, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10,
+  2, 10, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 11, 4, 11, 3, 10, 2,
+  10, 11, 12, 10, 11, 10, 10, 10, 9, 10, 8, 11,
+  7, 10, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  11, 12, 10, 11, 11, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 11,
+  12, 10, 11, 10, 10, 11, 9, 11, 8, 10, 7, 10,
+  6, 10, 5, 10, 4, 10, 3, 11, 2, 10, 11, 12,
+  10, 11, 10, 10, 11, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 11, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 11, 12, 10, 11,
+  10, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10, 5,
+  10, 4, 10, 3, 10, 2, 10, 11, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 11,
+  4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 11,
+  9, 11, 8, 10, 7, 11, 6, 10, 5, 10, 4, 10,
+  3, 11, 2, 10, 11, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 10, 5, 10, 4, 10, 3,
+  11, 2, 10, 11, 12, 10, 11, 10, 10, 11, 9, 10,
+  8, 10, 7, 10, 6, 11, 5, 11, 4, 10, 3, 10,
+  2, 10, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10, 2,
+  10, 11, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10,
+  11, 12, 10, 11, 10, 10, 10, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 11,
+  12, 10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 11,
+  6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 11, 12,
+  10, 11, 10, 10, 10, 9, 10, 8, 10, 7, 10, 6,
+  11, 5, 10, 4, 10, 3, 10, 2, 10, 11, 12, 10,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 10, 6, 11,
+  5, 10, 4, 11, 3, 10, 2, 10, 11, 12, 10, 11,
+  10, 10, 11, 9, 10, 8, 11, 7, 10, 6, 11, 5,
+  10, 4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 11,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 10, 5, 10,
+  4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 11, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11, 4,
+  11, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 10,
+  9, 11, 8, 11, 7, 10, 6, 10, 5, 10, 4, 10,
+  3, 11, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9,
+  11, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9, 10,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 11, 12, 10, 11, 11, 10, 10, 9, 11, 8,
+  10, 7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2,
+  10, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8, 10,
+  7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  11, 12, 10, 11, 10, 10, 11, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 11,
+  12, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7, 10,
+  6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 11, 12,
+  10, 11, 10, 10, 10, 9, 11, 8, 11, 7, 10, 6,
+  10, 5, 10, 4, 10, 3, 10, 2, 10, 11, 12, 10,
+  11, 10, 10, 11, 9, 11, 8, 10, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 11, 12, 10, 11,
+  10, 10, 10, 9, 11, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 10, 2, 10, 11, 12, 10, 11, 10,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11,
+  4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10,
+  11, 9, 10, 8, 10, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 10,
+  9, 11, 8, 10, 7, 10, 6, 10, 5, 10, 4, 10,
+  3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9,
+  10, 8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 11, 12, 10, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10,
+  2, 10, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 11, 2,
+  10, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8, 10,
+  7, 11, 6, 11, 5, 10, 4, 10, 3, 10, 2, 10,
+  11, 12, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 11,
+  12, 10, 11, 10, 10, 10, 9, 11, 8, 11, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 11, 12,
+  10, 11, 10, 10, 10, 9, 11, 8, 10, 7, 11, 6,
+  10, 5, 10, 4, 10, 3, 10, 2, 10, 11, 12, 10,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 11, 6, 10,
+  5, 10, 4, 10, 3, 11, 2, 10, 11, 12, 10, 11,
+  10, 10, 11, 9, 10, 8, 11, 7, 10, 6, 10, 5,
+  10, 4, 11, 3, 10, 2, 10, 11, 12, 10, 11, 11,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10,
+  4, 10, 3, 10, 2, 10, 11, 12, 10, 11, 11, 10,
+  10, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 11, 12, 10, 11, 10, 10, 11,
+  9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4, 10,
+  3, 11, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9,
+  11, 8, 11, 7, 10, 6, 10, 5, 11, 4, 11, 3,
+  10, 2, 10, 11, 12, 10, 11, 10, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 11,
+  2, 10, 11, 12, 10, 11, 10, 10, 10, 9, 10, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 11, 2,
+  10, 11, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  11, 12, 10, 11, 10, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 11, 4, 10, 3, 11, 2, 10, 11,
+  12, 10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 11, 2, 10, 12, 13,
+  10, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10, 7,
+  10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 12,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 10,
+  7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  12, 13, 10, 12, 11, 11, 10, 10, 10, 9, 11, 8,
+  10, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10, 2,
+  10, 12, 13, 10, 12, 11, 11, 10, 10, 11, 9, 10,
+  8, 10, 7, 11, 6, 11, 5, 10, 4, 10, 3, 11,
+  2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 10, 9,
+  11, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 12, 13, 10, 12, 11, 11, 10, 10, 11,
+  9, 10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 10,
+  3, 10, 2, 10, 12, 13, 10, 12, 11, 11, 10, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 10,
+  4, 11, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11,
+  10, 10, 11, 9, 10, 8, 10, 7, 10, 6, 10, 5,
+  10, 4, 10, 3, 10, 2, 10, 12, 13, 10, 12, 11,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 10, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 12, 13, 10, 12,
+  10, 11, 10, 10, 10, 9, 10, 8, 11, 7, 10, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 12, 13, 10,
+  12, 10, 11, 11, 10, 10, 9, 11, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 12, 13,
+  10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 12,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 10,
+  7, 10, 6, 11, 5, 10, 4, 11, 3, 10, 2, 10,
+  12, 13, 10, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  10, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2,
+  10, 12, 13, 10, 12, 11, 11, 10, 10, 11, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10,
+  2, 10, 12, 13, 10, 12, 11, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 10,
+  9, 11, 8, 10, 7, 10, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 10, 12, 13, 10, 12, 11, 11, 10, 10,
+  10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 11,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10,
+  4, 10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11,
+  11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 10, 2, 10, 12, 13, 10, 12, 11,
+  11, 10, 10, 11, 9, 10, 8, 10, 7, 11, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 12, 13, 10, 12,
+  11, 11, 10, 10, 10, 9, 11, 8, 10, 7, 11, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 12, 13, 10,
+  12, 10, 11, 10, 10, 10, 9, 11, 8, 10, 7, 11,
+  6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 12, 13,
+  10, 12, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 12,
+  13, 10, 12, 11, 11, 10, 10, 10, 9, 11, 8, 11,
+  7, 10, 6, 10, 5, 11, 4, 11, 3, 10, 2, 10,
+  12, 13, 10, 12, 11, 11, 10, 10, 10, 9, 11, 8,
+  10, 7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2,
+  10, 12, 13, 10, 12, 10, 11, 11, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10,
+  2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 10, 9,
+  11, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 11,
+  9, 11, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10,
+  3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 10, 10,
+  11, 9, 11, 8, 10, 7, 11, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 11,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 11,
+  4, 10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11,
+  10, 10, 11, 9, 10, 8, 10, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 10, 2, 10, 12, 13, 10, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 10,
+  5, 10, 4, 10, 3, 11, 2, 10, 12, 13, 10, 12,
+  10, 11, 10, 10, 11, 9, 10, 8, 11, 7, 10, 6,
+  11, 5, 10, 4, 10, 3, 10, 2, 10, 12, 13, 10,
+  12, 10, 11, 11, 10, 10, 9, 11, 8, 10, 7, 10,
+  6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 12, 13,
+  10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 11, 7,
+  11, 6, 10, 5, 11, 4, 10, 3, 11, 2, 10, 12,
+  13, 10, 12, 10, 11, 10, 10, 10, 9, 10, 8, 11,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  12, 13, 10, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10, 2,
+  10, 12, 13, 10, 12, 10, 11, 11, 10, 10, 9, 10,
+  8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10,
+  2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 11, 7, 10, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 12, 13, 10, 12, 10, 11, 11, 10, 10,
+  9, 10, 8, 11, 7, 11, 6, 10, 5, 10, 4, 10,
+  3, 11, 2, 10, 12, 13, 10, 12, 10, 11, 11, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11,
+  4, 10, 3, 11, 2, 10, 12, 13, 10, 12, 10, 11,
+  11, 10, 10, 9, 11, 8, 10, 7, 10, 6, 10, 5,
+  10, 4, 11, 3, 10, 2, 10, 12, 13, 10, 12, 11,
+  11, 10, 10, 10, 9, 11, 8, 10, 7, 10, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 12, 13, 10, 12,
+  11, 11, 10, 10, 10, 9, 10, 8, 10, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 12, 13, 10,
+  12, 10, 11, 11, 10, 11, 9, 10, 8, 10, 7, 10,
+  6, 11, 5, 11, 4, 10, 3, 10, 2, 10, 12, 13,
+  10, 12, 11, 11, 10, 10, 10, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 12,
+  13, 10, 12, 10, 11, 10, 10, 10, 9, 11, 8, 11,
+  7, 10, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10,
+  12, 13, 10, 12, 10, 11, 10, 10, 10, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10, 2,
+  10, 12, 13, 10, 12, 10, 11, 10, 10, 10, 9, 10,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 10, 9,
+  10, 8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3,
+  11, 2, 10, 12, 13, 10, 12, 10, 11, 10, 10, 11,
+  9, 10, 8, 10, 7, 10, 6, 10, 5, 11, 4, 11,
+  3, 10, 2, 10, 12, 13, 10, 12, 10, 11, 11, 10,
+  10, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 12, 13, 10, 12, 11, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 10, 6, 10, 5, 10,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 10, 12,
+  10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 10, 6,
+  11, 5, 11, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 11, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 11, 5, 10, 4, 10, 3, 10, 2, 10,
+  13, 14, 10, 13, 10, 12, 10, 11, 11, 10, 10, 9,
+  11, 8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 11,
+  10, 10, 9, 10, 8, 10, 7, 10, 6, 10, 5, 10,
+  4, 11, 3, 10, 2, 10, 13, 14, 10, 13, 11, 12,
+  10, 11, 10, 10, 11, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 11, 11, 10, 10, 10, 9, 10, 8, 11,
+  7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  13, 14, 10, 13, 10, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 11, 5, 11, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 10,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 11, 12,
+  10, 11, 11, 10, 10, 9, 11, 8, 10, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 11, 5, 10, 4, 11, 3, 10, 2, 10,
+  13, 14, 10, 13, 10, 12, 10, 11, 11, 10, 10, 9,
+  10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 11, 11, 10,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10,
+  4, 10, 3, 11, 2, 10, 13, 14, 10, 13, 11, 12,
+  10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 11,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  13, 14, 10, 13, 11, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 10,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 10, 12,
+  10, 11, 11, 10, 11, 9, 10, 8, 11, 7, 10, 6,
+  11, 5, 10, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 10,
+  7, 11, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10,
+  13, 14, 10, 13, 10, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 11,
+  10, 10, 9, 11, 8, 10, 7, 11, 6, 10, 5, 11,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 10, 12,
+  10, 11, 10, 10, 11, 9, 10, 8, 10, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 11, 11, 10, 10, 11, 9, 11, 8, 10,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  13, 14, 10, 13, 10, 12, 11, 11, 10, 10, 11, 9,
+  10, 8, 11, 7, 10, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 11, 7, 11, 6, 10, 5, 11,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 10, 12,
+  10, 11, 11, 10, 10, 9, 11, 8, 10, 7, 11, 6,
+  10, 5, 10, 4, 10, 3, 11, 2, 10, 13, 14, 10,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 11, 5, 10, 4, 11, 3, 10, 2, 10,
+  13, 14, 10, 13, 11, 12, 10, 11, 10, 10, 10, 9,
+  10, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 10,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 10,
+  4, 11, 3, 10, 2, 10, 13, 14, 10, 13, 10, 12,
+  11, 11, 10, 10, 11, 9, 10, 8, 10, 7, 10, 6,
+  11, 5, 11, 4, 10, 3, 10, 2, 10, 13, 14, 10,
+  13, 10, 12, 11, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  13, 14, 10, 13, 10, 12, 11, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3,
+  10, 2, 10, 13, 14, 10, 13, 10, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 11, 6, 10, 5, 11,
+  4, 10, 3, 10, 2, 10, 13, 14, 10, 13, 11, 12,
+  10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 11, 4, 10, 3, 11, 2, 10, 14, 15, 10,
+  14, 11, 13, 10, 12, 10, 11, 11, 10, 10, 9, 10,
+  8, 10, 7, 11, 6, 11, 5, 10, 4, 10, 3, 11,
+  2, 10, 14, 15, 10, 14, 10, 13, 10, 12, 11, 11,
+  10, 10, 10, 9, 10, 8, 10, 7, 11, 6, 11, 5,
+  10, 4, 10, 3, 10, 2, 10, 14, 15, 10, 14, 10,
+  13, 10, 12, 11, 11, 10, 10, 10, 9, 10, 8, 11,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  14, 15, 10, 14, 10, 13, 11, 12, 10, 11, 11, 10,
+  11, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  11, 3, 10, 2, 10, 14, 15, 10, 14, 10, 13, 10,
+  12, 11, 11, 10, 10, 11, 9, 10, 8, 11, 7, 10,
+  6, 10, 5, 10, 4, 11, 3, 10, 2, 10, 14, 15,
+  10, 14, 10, 13, 11, 12, 10, 11, 10, 10, 11, 9,
+  10, 8, 10, 7, 10, 6, 10, 5, 11, 4, 11, 3,
+  10, 2, 10, 14, 15, 10, 14, 10, 13, 10, 12, 11,
+  11, 10, 10, 10, 9, 10, 8, 10, 7, 10, 6, 11,
+  5, 10, 4, 10, 3, 10, 2, 10, 14, 15, 10, 14,
+  11, 13, 10, 12, 10, 11, 10, 10, 10, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10, 2,
+  10, 14, 15, 10, 14, 10, 13, 10, 12, 11, 11, 10,
+  10, 10, 9, 11, 8, 10, 7, 10, 6, 11, 5, 10,
+  4, 11, 3, 10, 2, 10, 14, 15, 10, 14, 10, 13,
+  10, 12, 11, 11, 10, 10, 10, 9, 11, 8, 10, 7,
+  10, 6, 11, 5, 10, 4, 10, 3, 11, 2, 10, 14,
+  15, 10, 14, 11, 13, 10, 12, 10, 11, 11, 10, 10,
+  9, 10, 8, 11, 7, 10, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 10, 14, 15, 10, 14, 11, 13, 10, 12,
+  10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 14, 15, 10,
+  14, 11, 13, 10, 12, 10, 11, 11, 10, 10, 9, 10,
+  8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 14, 15, 10, 14, 10, 13, 10, 12, 11, 11,
+  10, 10, 11, 9, 10, 8, 10, 7, 10, 6, 11, 5,
+  11, 4, 10, 3, 10, 2, 10, 14, 15, 10, 14, 10,
+  13, 10, 12, 10, 11, 11, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 11, 5, 10, 4, 10, 3, 10, 2, 10,
+  14, 15, 10, 14, 10, 13, 11, 12, 10, 11, 10, 10,
+  10, 9, 11, 8, 10, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 14, 15, 10, 14, 10, 13, 10,
+  12, 10, 11, 11, 10, 10, 9, 10, 8, 10, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 14, 15,
+  10, 14, 10, 13, 11, 12, 10, 11, 10, 10, 10, 9,
+  11, 8, 10, 7, 10, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 14, 15, 10, 14, 11, 13, 10, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 11, 7, 11, 6, 10,
+  5, 10, 4, 11, 3, 10, 2, 10, 14, 15, 10, 14,
+  11, 13, 10, 12, 10, 11, 11, 10, 11, 9, 10, 8,
+  10, 7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2,
+  10, 14, 15, 10, 14, 10, 13, 11, 12, 10, 11, 10,
+  10, 11, 9, 10, 8, 10, 7, 10, 6, 10, 5, 10,
+  4, 10, 3, 10, 2, 10, 14, 15, 10, 14, 10, 13,
+  11, 12, 10, 11, 11, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 11, 5, 11, 4, 10, 3, 10, 2, 10, 14,
+  15, 10, 14, 10, 13, 11, 12, 10, 11, 11, 10, 10,
+  9, 11, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 10, 14, 15, 10, 14, 10, 13, 11, 12,
+  10, 11, 11, 10, 10, 9, 10, 8, 11, 7, 10, 6,
+  10, 5, 10, 4, 11, 3, 10, 2, 10, 14, 15, 10,
+  14, 10, 13, 11, 12, 10, 11, 11, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 11, 5, 10, 4, 11, 3, 10,
+  2, 10, 14, 15, 10, 14, 10, 13, 10, 12, 10, 11,
+  11, 10, 10, 9, 10, 8, 11, 7, 10, 6, 10, 5,
+  10, 4, 11, 3, 10, 2, 10, 14, 15, 10, 14, 10,
+  13, 11, 12, 10, 11, 11, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 10, 5, 11, 4, 11, 3, 10, 2, 10,
+  14, 15, 10, 14, 10, 13, 11, 12, 10, 11, 11, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 14, 15, 10, 14, 10, 13, 11,
+  12, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7, 11,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 14, 15,
+  10, 14, 10, 13, 10, 12, 10, 11, 11, 10, 10, 9,
+  10, 8, 10, 7, 11, 6, 10, 5, 11, 4, 10, 3,
+  10, 2, 10, 15, 16, 10, 15, 11, 14, 10, 13, 10,
+  12, 10, 11, 11, 10, 10, 9, 10, 8, 11, 7, 10,
+  6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 15, 16,
+  10, 15, 10, 14, 11, 13, 11, 12, 10, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 15, 16, 10, 15, 10, 14, 11,
+  13, 10, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 11, 6, 10, 5, 10, 4, 11, 3, 10, 2, 10,
+  15, 16, 10, 15, 11, 14, 10, 13, 11, 12, 10, 11,
+  11, 10, 10, 9, 10, 8, 11, 7, 11, 6, 10, 5,
+  11, 4, 10, 3, 11, 2, 10, 15, 16, 10, 15, 10,
+  14, 10, 13, 10, 12, 11, 11, 10, 10, 11, 9, 10,
+  8, 10, 7, 11, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 15, 16, 10, 15, 10, 14, 11, 13, 10, 12,
+  10, 11, 10, 10, 10, 9, 10, 8, 11, 7, 10, 6,
+  10, 5, 11, 4, 10, 3, 10, 2, 10, 15, 16, 10,
+  15, 10, 14, 11, 13, 10, 12, 11, 11, 10, 10, 10,
+  9, 10, 8, 10, 7, 11, 6, 11, 5, 10, 4, 10,
+  3, 10, 2, 10, 15, 16, 10, 15, 11, 14, 10, 13,
+  10, 12, 10, 11, 10, 10, 11, 9, 10, 8, 10, 7,
+  11, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10, 15,
+  16, 10, 15, 10, 14, 10, 13, 10, 12, 11, 11, 10,
+  10, 10, 9, 10, 8, 11, 7, 10, 6, 11, 5, 10,
+  4, 10, 3, 10, 2, 10, 15, 16, 10, 15, 10, 14,
+  11, 13, 10, 12, 10, 11, 11, 10, 10, 9, 11, 8,
+  10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10, 2,
+  10, 15, 16, 10, 15, 10, 14, 11, 13, 10, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 10, 7, 10, 6, 10,
+  5, 11, 4, 10, 3, 10, 2, 10, 16, 17, 10, 16,
+  10, 15, 10, 14, 11, 13, 10, 12, 10, 11, 11, 10,
+  11, 9, 10, 8, 11, 7, 10, 6, 10, 5, 10, 4,
+  11, 3, 10, 2, 10, 16, 17, 10, 16, 10, 15, 11,
+  14, 10, 13, 11, 12, 10, 11, 11, 10, 10, 9, 11,
+  8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 16, 17, 10, 16, 10, 15, 10, 14, 10, 13,
+  10, 12, 10, 11, 11, 10, 10, 9, 10, 8, 10, 7,
+  10, 6, 10, 5, 11, 4, 11, 3, 10, 2, 10, 16,
+  17, 10, 16, 10, 15, 10, 14, 11, 13, 10, 12, 10,
+  11, 11, 10, 10, 9, 10, 8, 10, 7, 11, 6, 11,
+  5, 10, 4, 10, 3, 11, 2, 10, 16, 17, 10, 16,
+  11, 15, 10, 14, 10, 13, 11, 12, 10, 11, 10, 10,
+  11, 9, 10, 8, 11, 7, 10, 6, 10, 5, 11, 4,
+  10, 3, 10, 2, 10, 16, 17, 10, 16, 10, 15, 10,
+  14, 10, 13, 11, 12, 10, 11, 10, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 16, 17, 10, 16, 10, 15, 10, 14, 11, 13,
+  10, 12, 10, 11, 10, 10, 10, 9, 10, 8, 11, 7,
+  10, 6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 16,
+  17, 10, 16, 10, 15, 11, 14, 10, 13, 11, 12, 10,
+  11, 10, 10, 10, 9, 10, 8, 11, 7, 11, 6, 10,
+  5, 10, 4, 10, 3, 10, 2, 10, 16, 17, 10, 16,
+  10, 15, 10, 14, 10, 13, 10, 12, 11, 11, 10, 10,
+  10, 9, 10, 8, 10, 7, 10, 6, 11, 5, 10, 4,
+  10, 3, 10, 2, 10, 17, 18, 10, 17, 10, 16, 11,
+  15, 10, 14, 10, 13, 10, 12, 10, 11, 10, 10, 10,
+  9, 11, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11,
+  3, 10, 2, 10, 17, 18, 10, 17, 10, 16, 10, 15,
+  11, 14, 10, 13, 10, 12, 10, 11, 11, 10, 10, 9,
+  10, 8, 10, 7, 11, 6, 10, 5, 10, 4, 11, 3,
+  10, 2, 10, 17, 18, 10, 17, 11, 16, 10, 15, 10,
+  14, 11, 13, 10, 12, 10, 11, 10, 10, 11, 9, 10,
+  8, 10, 7, 10, 6, 11, 5, 10, 4, 10, 3, 10,
+  2, 10, 17, 18, 10, 17, 10, 16, 10, 15, 11, 14,
+  10, 13, 11, 12, 10, 11, 10, 10, 11, 9, 10, 8,
+  10, 7, 11, 6, 10, 5, 11, 4, 10, 3, 10, 2,
+  10, 17, 18, 10, 17, 10, 16, 10, 15, 10, 14, 11,
+  13, 10, 12, 10, 11, 10, 10, 10, 9, 11, 8, 10,
+  7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2, 10,
+  18, 19, 10, 18, 10, 17, 10, 16, 11, 15, 10, 14,
+  10, 13, 10, 12, 11, 11, 10, 10, 10, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 11, 4, 10, 3, 10, 2,
+  10, 18, 19, 10, 18, 10, 17, 10, 16, 11, 15, 10,
+  14, 11, 13, 10, 12, 10, 11, 10, 10, 10, 9, 10,
+  8, 11, 7, 10, 6, 10, 5, 10, 4, 10, 3, 10,
+  2, 10, 18, 19, 10, 18, 10, 17, 10, 16, 11, 15,
+  10, 14, 10, 13, 11, 12, 10, 11, 11, 10, 10, 9,
+  11, 8, 11, 7, 10, 6, 10, 5, 11, 4, 11, 3,
+  10, 2, 10, 21, 22, 10, 21, 10, 20, 10, 19, 10,
+  18, 10, 17, 10, 16, 11, 15, 10, 14, 10, 13, 10,
+  12, 10, 11, 10, 10, 10, 9, 11, 8, 10, 7, 10,
+  6, 10, 5, 10, 4, 10, 3, 10, 2, 10, 25, 26,
+  10, 25, 10, 24, 10, 23, 11, 22, 10, 21, 10, 20,
+  10, 19, 10, 18, 10, 17, 11, 16, 10, 15, 10, 14,
+  10, 13, 11, 12, 10, 11, 10, 10, 10, 9, 10, 8,
+  11, 7, 10, 6, 10, 5, 10, 4, 11, 3, 10, 2,
+  10
+  };
+
+static const char *const hyph_en_languages[] =
+  { "en", "eng", NULL };
+
+// fr: 1208 patterns, 39 letters, 3257 slots
+static const uint32_t hyph_fr_chars[76] =
+  {
+  39, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+  76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+  106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 122, 192, 194, 199, 200, 201, 202, 206,
+  207, 212, 219, 224, 226, 231, 232, 233, 234, 238, 239, 244,
+  251, 338, 339, 8217
+  };
+
+static const unsigned char hyph_fr_codes[76] =
+  {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+  11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+  23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+  35, 36, 37, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+  37, 38, 38, 39
+  };
+
+static const uint32_t hyph_fr_trie[3257] =
+  {
+  0, 9985, 18434, 27395, 32260, 41477, 51206, 16391, 60424, 68873, 77322, 83723,
+  19212, 87821, 96270, 104719, 113168, 122385, 127506, 1811, 136724, 145941, 155414, 33559,
+  163864, 41753, 7194, 9499, 172316, 142103, 5406, 823583, 5664, 174881, 154375, 166159,
+  175887, 8229, 163595, 171779, 179496, 187651, 21252, 27909, 38662, 12039, 188687, 10761,
+  212999, 21003, 823562, 10509, 15630, 57615, 12304, 19729, 191762, 171285, 25876, 193813,
+  45590, 823575, 224784, 211459, 218897, 823579, 238095, 823562, 823582, 209431, 823584, 13345,
+  823586, 823587, 198147, 823589, 823590, 97283, 20487, 69904, 245264, 102663, 27659, 63764,
+  74005, 195843, 62999, 823565, 48401, 66330, 214281, 247555, 227088, 221451, 823575, 242960,
+  251403, 227856, 823579, 225303, 224280, 823582, 239639, 823584, 823585, 823586, 823587, 231175,
+  823589, 823590, 46852, 38917, 14854, 247055, 252431, 16649, 241673, 25355, 193290, 196363,
+  35598, 22799, 60944, 244752, 34066, 223761, 33300, 49429, 823555, 25623, 22040, 203543,
+  53255, 236833, 250117, 139525, 823563, 134663, 34592, 36110, 249606, 247299, 39441, 247813,
+  251151, 55828, 141328, 255495, 823575, 248081, 249106, 139029, 823579, 204035, 149528, 823582,
+  246789, 823584, 823585, 823586, 823587, 223499, 823589, 823590, 59907, 159235, 45061, 205329,
+  66823, 162311, 243475, 202762, 45323, 823563, 208397, 56078, 252183, 204315, 89361, 823569,
+  237059, 53524, 823572, 225569, 43543, 823575, 255755, 823562, 50971, 260116, 255246, 823582,
+  823562, 823584, 823585, 823586, 823587, 237588, 823589, 823590, 823591, 823554, 55299, 246293,
+  243728, 62726, 70919, 251919, 823553, 66058, 75275, 245527, 245016, 60686, 249366, 267527,
+  823569, 244515, 259860, 61204, 823573, 258307, 823575, 249872, 256007, 260871, 823579, 228867,
+  254997, 823582, 262927, 823584, 62241, 823586, 823587, 216587, 823589, 823590, 69635, 823592,
+  252695, 217361, 81159, 266247, 246023, 271111, 78603, 271365, 248587, 80142, 250897, 254226,
+  823569, 250388, 823562, 77588, 823573, 229153, 70679, 248854, 262403, 823553, 823579, 270863,
+  267286, 823582, 269077, 823584, 72481, 823586, 823587, 823555, 823589, 823590, 263441, 88583,
+  252944, 823553, 128010, 73227, 269846, 257301, 79374, 265739, 80400, 823569, 273679, 272645,
+  81684, 823573, 276495, 80919, 262672, 271877, 268054, 823579, 265475, 265237, 823582, 275470,
+  823584, 823585, 823586, 823587, 823555, 823589, 823590, 266766, 93959, 277511, 270614, 274181,
+  84747, 272395, 268565, 273411, 279047, 823553, 823569, 277255, 279559, 276227, 281607, 279311,
+  79127, 280583, 273172, 281364, 86299, 95235, 78852, 823582, 270096, 823584, 85537, 823586,
+  823587, 275733, 823589, 823590, 88846, 91151, 105744, 94481, 278798, 823555, 823553, 97045,
+  282383, 111623, 90648, 262147, 100618, 823563, 282130, 264455, 288259, 257545, 98080, 823569,
+  823566, 273936, 823572, 254735, 264976, 823575, 278549, 823553, 259604, 823579, 284687, 287747,
+  823582, 281874, 823584, 823585, 823586, 823587, 94979, 823589, 823590, 823585, 112391, 289029,
+  290309, 279822, 98315, 280341, 286214, 103438, 101647, 277780, 823569, 823553, 283162, 288537,
+  96789, 290574, 823575, 823574, 289558, 823553, 823579, 291335, 823581, 823582, 292613, 823584,
+  823585, 823586, 823587, 823555, 823589, 823590, 290827, 110087, 286736, 284421, 285190, 116747,
+  283912, 292373, 291104, 293409, 100112, 111121, 290071, 295184, 284176, 823573, 823553, 105495,
+  294678, 284949, 286998, 823579, 823553, 293891, 823582, 823553, 823584, 102945, 823586, 823587,
+  823555, 823589, 823590, 823591, 133639, 291856, 294421, 287248, 823563, 295694, 288784, 298007,
+  292885, 296721, 823569, 293141, 294939, 823566, 111381, 299279, 105239, 296470, 295952, 823578,
+  823579, 292110, 294159, 823582, 301339, 823584, 823585, 823586, 823587, 289302, 823589, 823590,
+  823591, 112644, 113669, 114694, 301078, 298246, 115465, 296206, 112907, 303636, 301571, 299538,
+  137743, 308507, 311307, 110866, 306439, 114964, 118549, 302087, 121347, 291598, 823555, 114202,
+  137991, 314635, 823559, 145674, 120331, 122912, 823563, 125454, 303895, 126224, 124945, 316942,
+  823569, 157460, 119573, 131606, 154135, 327690, 823553, 823566, 823579, 823585, 823579, 823582,
+  316438, 823584, 136225, 823586, 823587, 328974, 823589, 823590, 156163, 293648, 123909, 823553,
+  165895, 295428, 297493, 145162, 144139, 304160, 305185, 306704, 126735, 336664, 823569, 305684,
+  297231, 297744, 296976, 334347, 128535, 308995, 300308, 302869, 129819, 311047, 335371, 823582,
+  331798, 823584, 163105, 823586, 823587, 823553, 823589, 823590, 823555, 316679, 166661, 303367,
+  177671, 316175, 315152, 180746, 823563, 319747, 302606, 148238, 823568, 300049, 823569, 173074,
+  303124, 823573, 304406, 210454, 192791, 315675, 336395, 318993, 823579, 340999, 331022, 823582,
+  331535, 823584, 823585, 823586, 823587, 329748, 823589, 823590, 823591, 170499, 306953, 131077,
+  823553, 211207, 337166, 310790, 214026, 823563, 338960, 308754, 310539, 307975, 309525, 150033,
+  312847, 302347, 217876, 337936, 130582, 186903, 338697, 304657, 336149, 823579, 823553, 823581,
+  823582, 307479, 823584, 133153, 823586, 823587, 182787, 823589, 823590, 317449, 156679, 305441,
+  823553, 336912, 182027, 317711, 339470, 314883, 341525, 340231, 149777, 311829, 317206, 151316,
+  319498, 313870, 823575, 309776, 312078, 314130, 823579, 318225, 315925, 823582, 328709, 823584,
+  153889, 823586, 823587, 823555, 823589, 823590, 318723, 200711, 329231, 329488, 320519, 823563,
+  334862, 320266, 321803, 181509, 210950, 823569, 339734, 339221, 321041, 341255, 823553, 823575,
+  218126, 179215, 188432, 823579, 183826, 178963, 187924, 219395, 823584, 823585, 823553, 198407,
+  317967, 315408, 344331, 201739, 320007, 319252, 321557, 341767, 338182, 205841, 337413, 342283,
+  823567, 346647, 318481, 823575, 338446, 823572, 823573, 823579, 345355, 337680, 823582, 342807,
+  823584, 823585, 823586, 823587, 188164, 823589, 823590, 189447, 345095, 194313, 344583, 345863,
+  334095, 333072, 344843, 193039, 206864, 334612, 194578, 230147, 220436, 195605, 347156, 227591,
+  325380, 328197, 229642, 232707, 354581, 235525, 226062, 233223, 352779, 231441, 823562, 327951,
+  228628, 228117, 328466, 234519, 323860, 232977, 355344, 354827, 353041, 236548, 238614, 238871,
+  237831, 232225, 239369, 236059, 823553, 358422, 355104, 359701, 239119, 241424, 349456, 239890,
+  823553, 242196, 237333, 823556, 348681, 348183, 257799, 339984, 823561, 357893, 256523, 352272,
+  342037, 258062, 823567, 823568, 823566, 823570, 350979, 258580, 823573, 823574, 823553, 360718,
+  823577, 823556, 362517, 352016, 260359, 823560, 823561, 823562, 322563, 823553, 354071, 352536,
+  324359, 354326, 343047, 823570, 320779, 340490, 823573, 823574, 823553, 362772, 326161, 326927,
+  326416, 323348, 333319, 344084, 330260, 332565, 361999, 367894, 324635, 823566, 823567, 823568,
+  363536, 330499, 322849, 331284, 823573, 333575, 342535, 364046, 346116, 332811, 343563, 345607,
+  371216, 347401, 355590, 358147, 343313, 356873, 372752, 348943, 347920, 333847, 347666, 360963,
+  349972, 346901, 357138, 358663, 823555, 358929, 373251, 823555, 343841, 359189, 373771, 823575,
+  357647, 356368, 357393, 359947, 363267, 346389, 823569, 372233, 365831, 823569, 371461, 375811,
+  367371, 364309, 367625, 371721, 374288, 376599, 369425, 374542, 379412, 380177, 363797, 366358,
+  370455, 364820, 377616, 375061, 373014, 381979, 378900, 377104, 376854, 382470, 370977, 385813,
+  377365, 384033, 380692, 381443, 385300, 823562, 386324, 382983, 384791, 386071, 389379, 382219,
+  391428, 390672, 392459, 391694, 383499, 823569, 388363, 385556, 392971, 390403, 381206, 379159,
+  397334, 394005, 394768, 823555, 391956, 391185, 395785, 397588, 383776, 823585, 395267, 396304,
+  392713, 400643, 396807, 396050, 393238, 823569, 398347, 397067, 398599, 403471, 401415, 401927,
+  398865, 402967, 400913, 403715, 395029, 397846, 398103, 404238, 404750, 402197, 406027, 401686,
+  402449, 405519, 405770, 404999, 400161, 402709, 405255, 403979, 406791, 406292, 407828, 406542,
+  823553, 409622, 823553, 409359, 823553, 410383, 407575, 408331, 410630, 823553, 408598, 823553,
+  410887, 413206, 823566, 409890, 409106, 407056, 413959, 407312, 414983, 823553, 410133, 823553,
+  411413, 414480, 408848, 414223, 411153, 417291, 411665, 413717, 415749, 823558, 411928, 415250,
+  412176, 412679, 412432, 418324, 823553, 415509, 823566, 416277, 823560, 823570, 416008, 823572,
+  412949, 823553, 823575, 421142, 823568, 823578, 416784, 420119, 420363, 418053, 419346, 417552,
+  417046, 413463, 823578, 823553, 416528, 419608, 422403, 421652, 421383, 418837, 423188, 423435,
+  421895, 420629, 420886, 823562, 424470, 424980, 418576, 422919, 426006, 823553, 422161, 422677,
+  423690, 424719, 423951, 823553, 823553, 425494, 426247, 425751, 823553, 823566, 823553, 428310,
+  823553, 427535, 429072, 823553, 823553, 429319, 424208, 425232, 823553, 431369, 823566, 427285,
+  427797, 426512, 430614, 426768, 429575, 431627, 428565, 427024, 428821, 430091, 431875, 428048,
+  429845, 432401, 431121, 430353, 430869, 434187, 432139, 432919, 434443, 432657, 437521, 436231,
+  435205, 435473, 433681, 436747, 823579, 435715, 436502, 435975, 434711, 439828, 438282, 438542,
+  437767, 441878, 823553, 442134, 823553, 823553, 440852, 441615, 823566, 442646, 823553, 442902,
+  439057, 438032, 442382, 440327, 438801, 823573, 441351, 443409, 439567, 440086, 823553, 443659,
+  444423, 456987, 443157, 445191, 445974, 446230, 444180, 443921, 444945, 446475, 445456, 447239,
+  445719, 446734, 446979, 823555, 449803, 447510, 823562, 823553, 447764, 823553, 448267, 450063,
+  450311, 449313, 454151, 451843, 449041, 450582, 451094, 452372, 452875, 823553, 451605, 450827,
+  448528, 454927, 823575, 823553, 456728, 448789, 456198, 823572, 444705, 457989, 453397, 823572,
+  451344, 457493, 459280, 823553, 457227, 454421, 452624, 458251, 458519, 459791, 454689, 455701,
+  459531, 456481, 457761, 461839, 460039, 460814, 455440, 465430, 460551, 462087, 823553, 463125,
+  461067, 823553, 461574, 465929, 463895, 462855, 463630, 464643, 463367, 464138, 464391, 466706,
+  823553, 466955, 823553, 464929, 466187, 470038, 469255, 468745, 823553, 465685, 823567, 461335,
+  823570, 471305, 467214, 469767, 469010, 466448, 469526, 474115, 823573, 823576, 471061, 467988,
+  823576, 468244, 465171, 471568, 470548, 470283, 472069, 472337, 470804, 473870, 467488, 467745,
+  473102, 472599, 472837, 473351, 471823, 468487, 475403, 823573, 474887, 473610, 475154, 474633,
+  476950, 474401, 475913, 823553, 479495, 477447, 823553, 823553, 476683, 480262, 476432, 479252,
+  477957, 478729, 479748, 478471, 480003, 823553, 485398, 823572, 486921, 482593, 477712, 481550,
+  477206, 476180, 478229, 481045, 475671, 482315, 481297, 482830, 483595, 484107, 478987, 484619,
+  823553, 483857, 823553, 823566, 823553, 487958, 823568, 823566, 823563, 484374, 487173, 486161,
+  484880, 488726, 480534, 483088, 485136, 490006, 485648, 489231, 482069, 489743, 490507, 486416,
+  490767, 491279, 490254, 485907, 491527, 492547, 823562, 488976, 492043, 491028, 489488, 823555,
+  491798, 492821, 493077, 487444, 494096, 492299, 493585, 495113, 496662, 495632, 494595, 496916,
+  493334, 823569, 497159, 496137, 495378, 499971, 495883, 499211, 500257, 502277, 500483, 501013,
+  498705, 500752, 504587, 501511, 493845, 498454, 499735, 501269, 501767, 503047, 823555, 823557,
+  823555, 823555, 505621, 497667, 499489, 505358, 502552, 506127, 823573, 503318, 505861, 506887,
+  823568, 502036, 823555, 823555, 823574, 823575, 823569, 507662, 506639, 508419, 823563, 823557,
+  508687, 509447, 823563, 506390, 823569, 513291, 508944, 519182, 509960, 512007, 823575, 514321,
+  823570, 509207, 515606, 510983, 823574, 507159, 509714, 510725, 823572, 510479, 823578, 517136,
+  823585, 823571, 508186, 507937, 823574, 512523, 511248, 520707, 823566, 823591, 511758, 823565,
+  518416, 518915, 521489, 519683, 520209, 516615, 515348, 518663, 523537, 516875, 520465, 823563,
+  523799, 523267, 524551, 519953, 521237, 528398, 526595, 528150, 823555, 522251, 524039, 519447,
+  823559, 520970, 526868, 522001, 823563, 526089, 528662, 528918, 529925, 529419, 823569, 529158,
+  535304, 533013, 527619, 535822, 823575, 529685, 823559, 530711, 534804, 823566, 823563, 532229,
+  531223, 544272, 823585, 823572, 823569, 823585, 823572, 537615, 823573, 538126, 823575, 537871,
+  532754, 530195, 538392, 534037, 536086, 536585, 537358, 538627, 823585, 536835, 541193, 542723,
+  541703, 541959, 545569, 539147, 823562, 539659, 538894, 544517, 542979, 543765, 547339, 542225,
+  544021, 542481, 543504, 536343, 543239, 545799, 823555, 823555, 551703, 548616, 823563, 547600,
+  548103, 539937, 546053, 823585, 551446, 548363, 547863, 545298, 823566, 823572, 548879, 552469,
+  549648, 549904, 823571, 546842, 546574, 823574, 552208, 550155, 823585, 549137, 550407, 550672,
+  552971, 550928, 823573, 552713, 553233, 555273, 553479, 554766, 554518, 555528, 553750, 551179,
+  556052, 554256, 555024, 823559, 823553, 823566, 823553, 823569, 555792, 556295, 556555, 823553,
+  557582, 556807, 558087, 557846, 558358, 823574, 823553, 557327, 823553, 823553, 559126, 558859,
+  560144, 823553, 561423, 823553, 559623, 561940, 823553, 562192, 823557, 559371, 560417, 563222,
+  563734, 559893, 564500, 562955, 823553, 561685, 558603, 561163, 562439, 562709, 823571, 563982,
+  563479, 823553, 823558, 564234, 566038, 565265, 565001, 823553, 567830, 565771, 564747, 567046,
+  568342, 566283, 823572, 566791, 567299, 565520, 569603, 566544, 823553, 568583, 823570, 567568,
+  568847, 823553, 569871, 823553, 570123, 823553, 823553, 823553, 571662, 568087, 569366, 823553,
+  569104, 572166, 571158, 823553, 572687, 0, 823555, 573718, 573974, 574998, 823559, 570634,
+  570384, 575254, 823563, 823563, 577286, 575508, 570898, 573198, 823569, 577542, 575760, 576016,
+  823573, 577801, 823575, 578318, 576789, 576532, 577046, 574734, 823585, 578821, 579342, 578059,
+  823585, 578574, 572944, 579079, 580111, 823574, 581643, 823574, 823559, 579600, 823553, 823553,
+  823559, 823553, 823568, 580359, 582422, 823569, 579847, 580624, 580871, 582168, 576276, 581136,
+  581384, 823563, 823553, 823553, 823585, 582667, 583686, 581904, 823553, 583440, 823563, 584455,
+  582927, 823553, 584208, 823559, 585236, 823574, 583957, 823553, 585987, 584978, 584720, 583189,
+  823573, 823567, 823573, 823574, 823567, 585475, 587022, 585745, 586763, 587798, 823553, 823553,
+  586257, 586507, 587278, 588053, 823553, 823573, 588302, 588551, 591894, 588822, 587523, 823555,
+  590343, 592662, 590607, 823559, 592918, 590855, 591125, 823563, 594947, 592399, 823562, 593166,
+  594454, 823569, 591367, 593422, 823566, 823573, 823571, 823575, 591640, 823553, 593671, 595729,
+  593936, 823566, 594192, 595471, 823584, 823585, 823553, 823553, 594704, 823572, 823572, 595216,
+  823566, 596240, 595975, 596495, 597253, 596752, 597008, 598292, 823562, 823553, 597518, 823572,
+  823553, 598023, 598535, 598807, 823553, 599313, 823567, 599062, 600587, 823572, 823572, 602118,
+  823566, 602388, 600069, 599831, 823568, 597781, 592145, 823567, 823565, 823559, 601355, 599569,
+  602887, 823562, 601106, 823553, 601616, 603911, 604419, 602639, 823553, 600855, 601872, 600353,
+  603408, 823553, 604175, 605966, 603163, 823572, 605191, 823553, 604688, 609045, 606471, 823553,
+  605456, 608271, 823562, 606230, 603681, 607255, 823573, 823559, 823553, 605717, 823566, 823563,
+  607767, 608526, 610051, 823566, 823578, 610833, 608782, 823576, 609294, 823573, 823553, 611343,
+  613910, 823553, 611093, 609812, 823563, 823567, 823553, 614422, 614934, 611847, 615446, 612103,
+  616471, 616214, 823559, 612871, 612630, 613127, 823561, 614663, 823566, 612357, 617221, 619030,
+  615171, 619286, 611603, 613392, 619553, 620299, 615696, 613650, 618503, 618759, 823555, 823555,
+  615957, 617752, 823563, 620560, 616725, 619784, 623638, 620815, 617989, 620039, 618263, 823571,
+  823555, 624910, 823574, 617490, 623127, 823572, 621067, 622608, 621326, 823566, 623888, 616986,
+  823585, 621585, 604949, 823562, 624657, 823555, 622352, 622864, 823574, 622087, 621846, 625174,
+  623376, 624391, 625940, 625671, 628235, 627476, 628747, 626203, 823558, 823563, 626437, 823573,
+  629769, 631303, 626961, 625424, 823568, 631049, 630283, 632072, 823567, 631569, 823558, 823585,
+  631819, 627216, 626709, 629526, 823585, 627732, 823558, 633104, 823574, 629001, 590086, 627994,
+  634627, 632855, 629262, 636436, 630032, 636695, 823566, 823574, 823572, 628501, 630802, 633347,
+  630548, 632337, 637707, 632599, 634886, 823568, 635408, 823557, 823558, 635147, 639499, 823555,
+  823557, 823562, 635671, 823559, 823570, 823568, 823573, 823563, 637188, 823573, 823576, 823560,
+  637959, 823569, 635925, 823575, 640786, 823573, 634383, 823575, 823573, 641029, 638224, 642324,
+  638480, 823555, 640259, 823585, 643851, 823585, 644368, 640007, 639780, 637445, 645902, 823562,
+  641291, 823573, 643590, 642570, 823566, 643331, 823569, 823575, 641809, 823572, 823573, 647431,
+  642069, 642827, 823575, 644107, 646407, 646935, 647694, 643089, 648963, 646161, 645652, 823559,
+  823578, 823563, 823573, 649995, 647179, 651281, 648711, 650247, 823559, 650759, 649489, 823568,
+  823566, 649748, 823572, 652043, 823575, 647950, 823574, 649219, 823579, 823568, 823567, 651792,
+  823557, 823560, 648225, 823575, 823572, 655888, 652814, 651536, 653575, 823555, 823568, 823568,
+  823562, 653328, 823574, 656145, 823555, 823574, 823574, 823578, 653831, 653078, 657686, 654096,
+  654601, 654347, 657928, 823574, 655121, 823558, 655371, 655639, 658435, 660247, 823573, 656899,
+  659988, 657159, 823557, 823574, 660752, 657424, 658183, 823575, 662038, 823563, 823585, 660995,
+  663062, 663574, 823566, 656650, 660487, 658960, 662279, 823553, 823566, 823553, 823572, 664583,
+  823553, 659489, 665878, 663822, 661520, 666390, 662544, 823566, 666646, 666118, 823553, 663312,
+  664078, 667907, 823553, 665351, 823553, 664848, 823553, 668433, 669446, 669720, 668182, 669968,
+  823556, 665111, 668950, 823553, 666896, 669191, 670222, 671750, 823566, 672534, 823553, 670478,
+  823553, 670727, 672777, 672276, 823553, 823570, 672015, 664353, 671239, 823557, 674070, 823553,
+  673031, 674319, 674838, 823563, 670992, 823574, 675350, 673543, 673294, 823553, 823553, 673799,
+  675606, 674571, 823553, 823553, 823572, 676118, 823555, 823574, 823566, 677897, 823559, 675079,
+  675847, 676613, 823563, 679958, 676359, 676871, 677127, 677383, 823569, 677639, 678159, 678407,
+  823573, 678663, 823575, 679438, 679687, 679182, 823555, 823553, 681219, 678928, 823553, 0,
+  823585, 682251, 680208, 682529, 680720, 680470, 823574, 823561, 823569, 682006, 683535, 823563,
+  823558, 681489, 683286, 682757, 823553, 823553, 681744, 624158, 823573, 680977, 823569, 683798,
+  685072, 684054, 685326, 685840, 671510, 823553, 823573, 823566, 823553, 685571, 683024, 823553,
+  687382, 686347, 684291, 686100, 823585, 684560, 823553, 686608, 686859, 687632, 823585, 687108,
+  823557, 823555, 823566, 823566, 688391, 823573, 687888, 823553, 688647, 823585, 689927, 690439,
+  823553, 689174, 690966, 688144, 691222, 692489, 691478, 823566, 823555, 694027, 691734, 689424,
+  692758, 689680, 690691, 693775, 694286, 823562, 823555, 0, 694798, 692241, 823573, 694543,
+  693003, 691990, 823553, 823557, 823553, 823569, 693264, 696598, 697110, 823573, 693520, 696847,
+  695057, 697364, 823574, 695312, 823566, 698371, 696071, 698134, 695568, 698894, 699670, 699918,
+  823562, 823556, 823566, 823566, 697611, 699150, 699399, 823569, 698642, 697871, 823553, 700173,
+  823553, 823575, 823553, 823570, 823553, 695824, 700432, 823553, 701969, 700688, 701456, 700951,
+  823572, 702225, 701191, 703235, 701712, 702998, 823553, 823553, 823562, 703505, 823555, 704777,
+  823574, 823555, 705297, 702486, 705032, 704007, 703766, 702736, 704272, 823574, 704523, 705547,
+  705815, 823558, 707587, 706307, 708103, 710164, 708355, 823573, 823555, 708624, 823561, 823574,
+  823572, 707863, 823575, 706823, 711446, 712719, 712214, 823585, 712982, 709895, 823570, 709136,
+  823559, 823558, 713233, 823567, 714006, 713479, 823572, 710919, 823563, 710678, 713749, 716291,
+  823568, 823574, 714251, 823575, 823574, 823567, 711688, 823572, 823570, 712464, 823556, 823574,
+  711960, 823566, 716820, 714519, 823555, 715542, 717845, 714757, 823559, 715028, 718614, 716549,
+  823563, 823567, 717064, 718868, 717315, 696341, 823569, 823574, 715270, 720150, 823573, 715792,
+  823575, 823573, 823585, 823555, 823562, 719882, 721686, 721942, 717584, 823555, 823585, 718339,
+  823568, 823574, 823585, 823562, 823574, 823555, 722705, 823573, 823573, 723478, 823570, 722197,
+  823563, 719109, 823575, 823572, 720391, 723211, 823556, 720656, 719632, 823557, 823567, 823561,
+  722951, 823570, 823555, 823568, 721419, 723728, 720912, 823572, 823574, 823560, 823570, 723984,
+  823574, 724240, 823575, 823573, 823574, 724495, 823568, 823566, 724739, 725763, 726038, 823574,
+  725008, 726800, 823572, 823555, 727811, 727318, 823566, 823556, 727574, 823574, 728340, 726295,
+  823555, 725526, 727056, 726533, 823559, 728084, 823553, 728839, 823563, 729878, 823553, 730389,
+  823553, 730898, 823569, 731670, 729359, 728609, 823573, 729620, 823575, 823553, 729104, 823553,
+  823553, 732182, 823566, 823566, 731143, 733974, 823585, 730128, 734230, 823557, 730640, 823557,
+  823574, 823572, 734742, 731399, 823563, 731911, 732423, 732679, 733191, 735241, 737302, 823553,
+  735491, 732944, 734983, 735751, 823566, 823553, 736007, 733712, 823553, 736272, 823553, 823553,
+  736519, 823553, 737814, 823566, 736784, 823575, 737040, 737552, 734478, 738823, 0, 740099,
+  738064, 0, 740359, 738320, 823553, 738576, 823553, 739088, 739344, 739600, 739856, 741131,
+  823553, 740624, 740880, 823566, 743939, 745989, 741392, 823553, 823553, 741910, 745486, 744199,
+  744455, 745232, 745750, 823555, 746518, 747030, 747271, 823559, 748822, 747527, 823559, 823563,
+  746774, 749078, 747782, 748046, 823553, 746257, 823574, 750358, 748560, 750094, 749328, 823553,
+  823553, 823553, 823553, 750614, 748304, 749584, 823553, 752150, 752406, 752662, 749840, 750855,
+  751120, 823555, 752918, 753174, 751623, 754708, 751879, 753415, 753671, 823553, 755216, 823553,
+  823573, 823575, 754179, 823553, 754951, 753942, 754454, 755715, 755461, 823553, 756752, 823573,
+  756487, 756246, 757014, 758038, 757511, 757771, 758290, 823570, 823559, 823563, 823553, 757264,
+  0, 755990, 762627, 823555, 823585, 0, 758800, 0, 763651, 758550, 759062, 760338,
+  761870, 823574, 759318, 823572, 761622, 760080, 759574, 823556, 765448, 760837, 823566, 823557,
+  759830, 823574, 764180, 760599, 823555, 762390, 761108, 823553, 823559, 761360, 823553, 764944,
+  823563, 823553, 763139, 766735, 823555, 823553, 823569, 765206, 823568, 766485, 823573, 823572,
+  823575, 823569, 767243, 823572, 764430, 823556, 823555, 823566, 768278, 823563, 823585, 823553,
+  823557, 767499, 823572, 768779, 768532, 768022, 765703, 823555, 823567, 769302, 823559, 823553,
+  823553, 823558, 766981, 764693, 823569, 767747, 823585, 769046, 823555, 769808, 823574, 823563,
+  769558, 823568, 770059, 823573, 823553, 823569, 823566, 823557, 770827, 823553, 823553, 823584,
+  823563, 0, 823556, 823555, 770326, 770582, 771862, 823553, 771094, 772118, 771344, 772359,
+  823572, 772869, 823553, 772630, 823553, 774166, 771600, 773140, 773647, 773899, 773397, 823553,
+  823553, 774934, 823553, 774416, 774672, 775446, 775184, 775702, 775952, 776208, 776455, 776720,
+  823553, 777225, 823553, 796691, 777494, 733457, 776976, 777750, 0, 778000, 778256, 0,
+  778768, 0, 0, 0, 0, 778518, 823553, 779286, 779542, 779024, 781078, 784393,
+  781846, 782614, 782870, 779792, 783126, 783894, 784662, 784918, 823574, 823553, 785430, 785686,
+  823553, 786198, 783367, 823566, 783623, 823563, 781328, 781584, 784135, 823553, 823553, 782347,
+  786439, 823567, 786951, 823553, 823553, 787207, 785168, 785936, 823559, 786705, 823553, 823553,
+  823553, 823553, 823553, 809251, 788246, 823553, 0, 823553, 787472, 788502, 788758, 787728,
+  787984, 823558, 823553, 789014, 790023, 823553, 789264, 789520, 790287, 823553, 0, 823553,
+  789776, 823553, 823553, 823553, 823553, 0, 790800, 790548, 823574, 823573, 791056, 823568,
+  823559, 791574, 791313, 792342, 823573, 791815, 792071, 823557, 792848, 792598, 823556, 823555,
+  823563, 823553, 823572, 793355, 794900, 793622, 823559, 796950, 793095, 744707, 823557, 823566,
+  823556, 823553, 823555, 795910, 823555, 823553, 823553, 797189, 823574, 823553, 823553, 823573,
+  823558, 823562, 823568, 823553, 823553, 823574, 0, 823559, 823555, 823562, 823555, 823568,
+  823553, 794375, 823568, 823553, 794631, 823553, 823553, 823563, 793872, 0, 0, 797974,
+  0, 823553, 823553, 0, 0, 823553, 0, 823573, 823553, 823553, 798998, 799510,
+  795152, 799766, 800527, 823553, 800022, 800278, 823553, 800790, 801046, 823553, 823553, 823553,
+  801302, 801558, 823553, 801814, 802582, 823553, 823553, 802838, 823553, 823553, 799239, 823553,
+  802321, 803350, 804118, 798224, 798480, 803589, 802064, 823553, 823553, 823553, 823553, 0,
+  0, 0, 0, 803088, 804374, 804880, 805136, 804630, 823553, 806151, 807431, 823553,
+  823553, 805654, 805910, 806422, 803868, 805392, 823555, 823559, 806678, 806934, 807190, 823555,
+  808464, 808720, 807702, 807958, 808214, 823553, 823568, 823559, 809475, 823553, 809744, 810000,
+  808983, 823553, 811030, 823553, 823553, 823553, 823553, 811798, 823553, 823553, 823553, 823553,
+  823553, 810503, 810775, 823553, 823553, 810256, 823553, 812054, 812566, 823553, 823553, 823553,
+  0, 812295, 813319, 823553, 823553, 823568, 823553, 823553, 823553, 823553, 812822, 823553,
+  823553, 0, 813078, 0, 0, 0, 0, 813831, 811280, 813590, 815894, 816406,
+  823553, 811536, 814859, 823553, 823553, 815367, 823553, 823553, 823553, 0, 823553, 817430,
+  817942, 814352, 814102, 823574, 818454, 818710, 819478, 823553, 814608, 823553, 820246, 820758,
+  815120, 823553, 815632, 823553, 818190, 823553, 823553, 819732, 816656, 823553, 821782, 822294,
+  823553, 822550, 823553, 822806, 823559, 821518, 823553, 823318, 823553, 823553, 823553, 823559,
+  823553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0
+  };
+
+static const unsigned short hyph_fr_ops[3257] =
+  {
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 9, 0, 0, 0, 9, 0, 0,
+  0, 9, 9, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 9, 0, 28, 9, 0, 9, 9,
+  9, 9, 9, 9, 9, 0, 9, 0, 0, 0, 9, 0,
+  0, 0, 0, 25, 9, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 9, 0, 0, 9, 0, 9, 9, 9, 9, 0,
+  9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+  17, 0, 0, 0, 17, 0, 0, 12, 0, 0, 17, 0,
+  0, 12, 0, 0, 17, 0, 0, 0, 17, 0, 0, 17,
+  0, 17, 17, 17, 17, 0, 17, 17, 17, 17, 0, 0,
+  17, 17, 0, 12, 17, 17, 12, 12, 0, 0, 17, 17,
+  0, 12, 12, 0, 17, 17, 0, 9, 17, 0, 0, 17,
+  28, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0,
+  0, 0, 17, 0, 31, 0, 17, 0, 0, 0, 0, 0,
+  17, 0, 0, 12, 20, 0, 17, 0, 0, 0, 17, 0,
+  0, 17, 0, 17, 17, 17, 17, 0, 17, 17, 17, 17,
+  0, 0, 17, 0, 0, 0, 17, 0, 0, 12, 0, 0,
+  17, 0, 12, 12, 20, 0, 17, 0, 0, 31, 17, 0,
+  0, 17, 0, 17, 17, 17, 17, 17, 17, 17, 0, 17,
+  0, 31, 0, 17, 0, 0, 12, 0, 12, 17, 0, 0,
+  12, 20, 0, 17, 0, 0, 0, 17, 0, 0, 17, 0,
+  17, 17, 17, 17, 17, 17, 17, 0, 17, 0, 0, 0,
+  17, 0, 0, 0, 0, 31, 17, 0, 0, 0, 0, 0,
+  17, 0, 0, 0, 17, 0, 0, 17, 0, 17, 17, 17,
+  17, 0, 17, 17, 0, 0, 0, 0, 0, 17, 31, 0,
+  0, 17, 0, 0, 12, 17, 0, 0, 0, 0, 0, 17,
+  28, 0, 12, 0, 0, 17, 0, 31, 0, 17, 0, 0,
+  17, 0, 17, 17, 17, 17, 17, 17, 17, 20, 17, 0,
+  0, 0, 17, 0, 0, 0, 0, 0, 17, 31, 0, 0,
+  0, 0, 17, 12, 0, 31, 17, 0, 17, 17, 0, 17,
+  17, 17, 17, 17, 17, 17, 0, 17, 0, 0, 0, 17,
+  0, 0, 0, 0, 0, 17, 0, 0, 0, 20, 31, 17,
+  0, 0, 0, 17, 31, 0, 17, 31, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 0, 0, 0, 17, 0, 0, 0,
+  0, 0, 17, 0, 0, 12, 0, 0, 17, 0, 0, 6,
+  17, 0, 0, 17, 0, 17, 17, 17, 17, 0, 17, 17,
+  17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 42, 0,
+  17, 0, 42, 12, 17, 0, 42, 12, 0, 0, 17, 0,
+  42, 12, 0, 0, 17, 0, 31, 12, 17, 42, 42, 17,
+  0, 17, 17, 17, 17, 0, 17, 17, 17, 0, 0, 31,
+  17, 0, 0, 12, 17, 0, 0, 0, 0, 0, 17, 0,
+  0, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 17,
+  0, 17, 17, 17, 17, 31, 17, 17, 17, 0, 0, 0,
+  17, 0, 0, 12, 17, 0, 28, 0, 34, 0, 17, 0,
+  28, 34, 34, 0, 17, 0, 0, 0, 17, 0, 0, 17,
+  0, 17, 17, 17, 17, 0, 17, 17, 17, 17, 0, 0,
+  31, 17, 0, 0, 12, 17, 0, 0, 0, 0, 0, 17,
+  0, 0, 12, 0, 0, 17, 0, 0, 0, 17, 31, 17,
+  17, 0, 17, 17, 17, 17, 17, 17, 17, 0, 17, 0,
+  31, 0, 17, 0, 0, 0, 0, 0, 17, 0, 0, 12,
+  42, 0, 17, 0, 0, 0, 17, 0, 0, 17, 0, 17,
+  17, 17, 17, 17, 17, 17, 0, 17, 0, 0, 0, 17,
+  0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 31, 17,
+  0, 0, 0, 17, 0, 0, 0, 9, 17, 17, 31, 9,
+  0, 0, 0, 9, 0, 0, 0, 0, 0, 9, 0, 0,
+  34, 0, 0, 9, 0, 34, 34, 9, 0, 0, 9, 0,
+  9, 9, 9, 9, 0, 9, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0,
+  31, 0, 0, 34, 0, 0, 0, 0, 34, 0, 0, 0,
+  0, 28, 34, 34, 9, 34, 0, 28, 34, 34, 31, 0,
+  34, 34, 47, 0, 0, 34, 34, 37, 0, 31, 0, 0,
+  0, 0, 0, 34, 0, 0, 34, 34, 31, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34,
+  0, 0, 0, 28, 34, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 20, 0, 0, 20, 0, 0, 0, 20,
+  0, 9, 20, 0, 20, 0, 20, 0, 20, 20, 0, 0,
+  20, 28, 0, 0, 0, 0, 20, 0, 52, 0, 0, 0,
+  20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20,
+  0, 0, 0, 20, 0, 9, 0, 20, 0, 0, 0, 20,
+  0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 55,
+  0, 0, 0, 20, 0, 0, 0, 0, 0, 20, 20, 0,
+  0, 0, 20, 0, 0, 20, 20, 0, 0, 0, 0, 0,
+  20, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0,
+  58, 0, 58, 0, 58, 0, 0, 0, 0, 58, 0, 58,
+  0, 0, 61, 0, 0, 0, 0, 0, 0, 58, 0, 58,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0,
+  0, 0, 0, 0, 58, 0, 64, 0, 17, 17, 0, 17,
+  0, 58, 17, 0, 17, 17, 0, 0, 0, 0, 0, 0,
+  0, 0, 17, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 69, 0, 0, 0, 0, 0, 58, 0, 0,
+  0, 0, 0, 58, 58, 0, 0, 0, 58, 61, 58, 0,
+  58, 0, 0, 58, 58, 0, 0, 0, 58, 0, 61, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 58, 0, 58, 58, 0, 0, 61, 0, 58, 0,
+  0, 0, 61, 0, 0, 77, 0, 0, 0, 0, 58, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 20, 0, 0, 61, 58, 0, 58, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0,
+  0, 0, 77, 58, 0, 0, 0, 77, 0, 0, 0, 77,
+  0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0,
+  0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  58, 0, 58, 0, 0, 0, 0, 0, 58, 0, 85, 0,
+  77, 0, 0, 0, 0, 0, 0, 0, 82, 77, 0, 0,
+  77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0,
+  0, 0, 0, 58, 0, 0, 58, 58, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 58, 0, 69, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  58, 0, 58, 61, 58, 0, 90, 61, 25, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0,
+  0, 20, 20, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+  20, 0, 0, 0, 0, 0, 20, 0, 0, 0, 25, 12,
+  20, 95, 0, 0, 20, 0, 0, 0, 9, 0, 0, 0,
+  12, 0, 95, 95, 12, 17, 17, 0, 0, 0, 95, 107,
+  0, 0, 69, 0, 95, 95, 0, 0, 0, 0, 95, 0,
+  107, 0, 0, 0, 107, 0, 0, 0, 25, 0, 102, 0,
+  69, 90, 0, 95, 90, 0, 0, 0, 90, 102, 0, 90,
+  0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 102,
+  0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+  20, 0, 0, 0, 20, 0, 0, 0, 0, 0, 20, 0,
+  0, 0, 20, 0, 20, 0, 20, 0, 0, 25, 20, 0,
+  0, 0, 20, 25, 20, 20, 25, 0, 20, 0, 20, 0,
+  0, 0, 0, 90, 90, 0, 0, 95, 20, 95, 0, 0,
+  0, 95, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 25, 95, 0, 0, 69, 0,
+  0, 95, 0, 95, 0, 0, 0, 0, 90, 25, 0, 0,
+  0, 0, 90, 0, 0, 90, 0, 0, 69, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 77, 112, 52, 115, 85, 0, 0, 0, 115,
+  0, 0, 0, 0, 0, 118, 112, 0, 115, 115, 0, 0,
+  0, 115, 0, 115, 0, 0, 115, 0, 74, 0, 0, 0,
+  0, 0, 0, 0, 115, 0, 0, 0, 0, 0, 74, 0,
+  0, 112, 125, 0, 0, 0, 0, 115, 0, 0, 0, 0,
+  0, 0, 130, 0, 0, 0, 137, 0, 112, 0, 85, 0,
+  0, 115, 0, 115, 0, 112, 115, 115, 0, 0, 0, 115,
+  0, 0, 0, 115, 0, 0, 20, 0, 0, 0, 20, 0,
+  0, 0, 20, 145, 0, 140, 0, 0, 20, 0, 0, 0,
+  20, 0, 20, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+  20, 0, 0, 0, 0, 42, 0, 77, 77, 0, 112, 112,
+  69, 112, 148, 0, 0, 151, 0, 0, 0, 0, 0, 0,
+  0, 151, 112, 64, 85, 0, 0, 0, 112, 0, 145, 0,
+  0, 115, 0, 77, 0, 156, 0, 115, 0, 0, 0, 0,
+  20, 77, 77, 77, 77, 0, 0, 0, 0, 0, 115, 115,
+  0, 0, 0, 0, 115, 159, 0, 0, 0, 0, 0, 20,
+  0, 0, 0, 20, 0, 0, 0, 20, 0, 0, 151, 0,
+  0, 20, 0, 0, 34, 20, 164, 20, 0, 115, 0, 0,
+  0, 52, 0, 0, 20, 20, 112, 115, 0, 171, 171, 0,
+  52, 0, 0, 0, 0, 0, 0, 0, 151, 115, 0, 151,
+  112, 0, 0, 0, 115, 0, 151, 0, 0, 151, 151, 0,
+  151, 140, 0, 0, 151, 0, 0, 151, 151, 151, 0, 0,
+  0, 176, 0, 112, 0, 0, 0, 0, 115, 0, 0, 0,
+  0, 115, 0, 0, 0, 171, 0, 115, 0, 0, 0, 115,
+  0, 0, 145, 0, 0, 0, 47, 20, 112, 0, 52, 20,
+  0, 0, 0, 52, 12, 0, 0, 12, 0, 20, 112, 0,
+  0, 112, 0, 0, 145, 77, 112, 0, 0, 0, 0, 0,
+  0, 0, 151, 0, 0, 0, 151, 0, 52, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 95,
+  0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 90,
+  181, 0, 90, 0, 0, 25, 0, 0, 0, 90, 0, 0,
+  69, 0, 0, 184, 0, 20, 0, 0, 85, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 74, 42, 0, 20,
+  0, 0, 0, 0, 196, 0, 0, 0, 90, 0, 34, 20,
+  0, 0, 0, 0, 42, 0, 189, 0, 34, 0, 0, 0,
+  0, 0, 0, 203, 0, 0, 189, 34, 189, 0, 0, 0,
+  0, 0, 0, 0, 0, 208, 0, 208, 196, 0, 0, 20,
+  12, 208, 0, 20, 208, 181, 208, 20, 0, 196, 196, 196,
+  0, 20, 0, 17, 0, 20, 0, 20, 208, 0, 0, 0,
+  0, 25, 0, 69, 0, 20, 0, 0, 0, 0, 0, 90,
+  0, 20, 0, 0, 12, 0, 95, 25, 0, 90, 20, 0,
+  20, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 69,
+  34, 69, 34, 0, 0, 0, 0, 0, 25, 0, 0, 90,
+  61, 184, 208, 0, 184, 0, 189, 0, 184, 208, 196, 0,
+  12, 208, 0, 69, 189, 0, 0, 0, 0, 181, 12, 12,
+  184, 0, 176, 0, 20, 12, 85, 208, 20, 0, 0, 0,
+  0, 0, 0, 34, 0, 34, 0, 0, 0, 0, 20, 0,
+  203, 0, 12, 34, 0, 0, 0, 17, 0, 213, 20, 0,
+  0, 0, 218, 0, 0, 0, 0, 224, 221, 224, 69, 0,
+  224, 0, 0, 0, 0, 0, 0, 61, 0, 0, 227, 0,
+  0, 0, 227, 0, 224, 0, 224, 0, 0, 0, 0, 0,
+  82, 0, 0, 224, 0, 0, 0, 0, 61, 0, 224, 0,
+  224, 0, 0, 0, 224, 85, 0, 0, 0, 28, 0, 224,
+  0, 0, 0, 28, 0, 77, 0, 0, 0, 224, 224, 0,
+  0, 0, 224, 224, 156, 0, 55, 12, 61, 0, 55, 0,
+  0, 0, 55, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+  55, 0, 55, 0, 0, 0, 171, 112, 0, 0, 125, 0,
+  55, 0, 0, 0, 0, 0, 31, 171, 171, 0, 0, 171,
+  151, 0, 0, 0, 224, 227, 0, 0, 47, 0, 151, 0,
+  0, 0, 0, 0, 0, 227, 20, 61, 224, 0, 0, 224,
+  0, 0, 0, 0, 20, 0, 224, 0, 0, 0, 230, 0,
+  85, 20, 61, 61, 0, 235, 0, 227, 0, 253, 0, 0,
+  224, 0, 0, 0, 0, 0, 0, 52, 235, 0, 0, 0,
+  0, 0, 0, 0, 0, 235, 20, 0, 0, 0, 235, 0,
+  0, 0, 227, 12, 224, 55, 0, 0, 0, 55, 0, 0,
+  0, 0, 240, 0, 61, 95, 0, 0, 0, 0, 0, 0,
+  90, 12, 52, 52, 0, 0, 0, 95, 90, 0, 224, 0,
+  112, 95, 112, 12, 245, 0, 0, 245, 0, 0, 0, 0,
+  235, 0, 0, 0, 0, 0, 245, 112, 184, 0, 181, 0,
+  85, 20, 0, 0, 0, 20, 0, 0, 0, 34, 0, 0,
+  0, 34, 0, 0, 0, 203, 0, 20, 69, 0, 196, 34,
+  184, 0, 17, 0, 0, 0, 0, 20, 0, 0, 248, 0,
+  85, 77, 0, 77, 0, 0, 253, 0, 253, 0, 0, 0,
+  253, 64, 0, 64, 64, 64, 0, 253, 64, 0, 77, 85,
+  0, 85, 0, 0, 55, 0, 0, 0, 55, 0, 0, 0,
+  55, 85, 0, 0, 0, 0, 55, 248, 0, 0, 55, 0,
+  55, 248, 130, 130, 130, 0, 0, 0, 0, 6, 55, 0,
+  208, 34, 42, 107, 248, 69, 0, 17, 90, 0, 85, 0,
+  85, 0, 85, 85, 0, 0, 260, 0, 0, 260, 260, 260,
+  0, 260, 20, 260, 0, 0, 0, 260, 64, 248, 260, 0,
+  260, 0, 64, 85, 85, 0, 85, 64, 0, 0, 0, 248,
+  0, 0, 184, 69, 0, 0, 85, 77, 0, 85, 0, 0,
+  55, 0, 0, 0, 55, 0, 245, 0, 55, 0, 245, 0,
+  112, 0, 55, 0, 0, 0, 55, 0, 55, 112, 0, 112,
+  112, 0, 61, 52, 0, 0, 55, 0, 0, 265, 0, 156,
+  265, 156, 0, 0, 171, 0, 0, 0, 0, 0, 0, 112,
+  0, 0, 0, 0, 61, 112, 0, 0, 245, 0, 112, 112,
+  0, 112, 0, 61, 0, 235, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 245, 0, 245, 0, 0, 0, 0, 0,
+  112, 0, 0, 61, 0, 0, 0, 112, 112, 0, 0, 0,
+  0, 0, 0, 272, 0, 0, 0, 272, 0, 0, 156, 272,
+  0, 0, 0, 0, 112, 0, 85, 0, 0, 0, 0, 245,
+  245, 112, 245, 0, 0, 0, 245, 0, 0, 0, 0, 0,
+  0, 20, 0, 0, 0, 0, 0, 0, 0, 112, 0, 112,
+  20, 275, 0, 112, 0, 0, 0, 0, 0, 112, 0, 20,
+  0, 0, 0, 0, 0, 0, 0, 248, 275, 42, 280, 0,
+  0, 0, 0, 69, 213, 0, 0, 0, 0, 0, 0, 85,
+  0, 275, 0, 184, 0, 0, 0, 77, 0, 0, 85, 12,
+  0, 85, 0, 0, 55, 0, 0, 245, 55, 0, 245, 0,
+  55, 245, 0, 0, 20, 245, 55, 0, 283, 0, 55, 125,
+  55, 125, 0, 125, 0, 112, 112, 283, 0, 171, 55, 245,
+  12, 0, 112, 0, 0, 0, 0, 42, 17, 0, 290, 245,
+  245, 297, 0, 0, 290, 0, 42, 0, 69, 0, 171, 171,
+  0, 302, 0, 171, 245, 171, 171, 12, 0, 245, 245, 290,
+  171, 0, 112, 112, 0, 0, 0, 112, 0, 0, 0, 0,
+  112, 0, 112, 0, 112, 0, 0, 0, 0, 0, 0, 112,
+  245, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  245, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 245, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 307, 112, 0, 0,
+  245, 0, 0, 171, 0, 310, 0, 0, 0, 245, 112, 0,
+  0, 181, 0, 245, 245, 0, 0, 0, 315, 0, 112, 245,
+  245, 245, 245, 0, 0, 245, 0, 245, 0, 0, 0, 0,
+  0, 320, 245, 0, 0, 245, 0, 0, 0, 112, 0, 112,
+  0, 112, 245, 245, 245, 0, 0, 0, 64, 64, 0, 181,
+  297, 0, 0, 0, 181, 0, 0, 12, 0, 0, 112, 112,
+  171, 245, 112, 0, 0, 0, 82, 0, 0, 0, 12, 325,
+  332, 112, 315, 0, 315, 280, 245, 0, 107, 245, 245, 337,
+  315, 171, 12, 245, 245, 344, 0, 82, 315, 171, 315, 344,
+  280, 0, 315, 245, 0, 112, 112, 349, 0, 0, 0, 0,
+  0, 245, 245, 0, 0, 112, 0, 77, 112, 245, 0, 0,
+  0, 0, 0, 112, 0, 0, 245, 0, 0, 245, 245, 245,
+  0, 0, 245, 0, 0, 245, 245, 0, 245, 245, 0, 112,
+  0, 0, 0, 0, 0, 0, 0, 112, 112, 245, 245, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 112,
+  280, 0, 0, 0, 0, 0, 315, 82, 0, 0, 0, 315,
+  0, 0, 0, 0, 0, 280, 354, 310, 0, 245, 0, 0,
+  0, 245, 0, 245, 245, 245, 245, 0, 245, 245, 245, 245,
+  245, 0, 0, 115, 245, 0, 245, 0, 0, 245, 245, 245,
+  0, 0, 0, 245, 112, 349, 115, 112, 245, 245, 0, 245,
+  245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  112, 0, 0, 245, 245, 0, 245, 245, 245, 0, 245, 0,
+  0, 0, 0, 359, 0, 0, 0, 245, 0, 245, 0, 0,
+  0, 245, 0, 115, 0, 115, 245, 0, 0, 245, 0, 0,
+  245, 0, 245, 0, 280, 0, 112, 0, 245, 245, 245, 364,
+  280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0
+  };
+
+static const unsigned char hyph_fr_values[369] =
+  {
+  0, 2, 1, 2, 0, 2, 1, 1, 1, 1, 0, 4,
+  2, 2, 1, 1, 2, 1, 2, 1, 2, 1, 1, 0,
+  2, 1, 2, 2, 1, 1, 2, 1, 3, 4, 1, 3,
+  2, 2, 3, 2, 1, 3, 2, 3, 1, 2, 2, 2,
+  1, 2, 0, 3, 1, 1, 4, 1, 0, 2, 1, 4,
+  4, 1, 1, 3, 2, 4, 3, 3, 2, 2, 3, 2,
+  2, 3, 1, 3, 1, 2, 4, 1, 3, 2, 1, 4,
+  2, 2, 4, 2, 3, 3, 2, 2, 2, 1, 3, 3,
+  2, 2, 1, 1, 0, 2, 2, 2, 2, 1, 1, 2,
+  2, 3, 1, 2, 1, 5, 2, 1, 5, 4, 3, 3,
+  3, 1, 3, 0, 2, 2, 5, 3, 4, 2, 3, 4,
+  2, 3, 1, 2, 2, 1, 0, 1, 2, 1, 4, 0,
+  1, 1, 4, 1, 1, 4, 3, 2, 5, 1, 4, 2,
+  1, 5, 1, 2, 5, 3, 3, 2, 3, 3, 1, 2,
+  2, 1, 2, 2, 5, 2, 4, 3, 2, 3, 3, 2,
+  2, 1, 3, 3, 2, 3, 3, 2, 4, 3, 3, 3,
+  2, 2, 1, 3, 3, 3, 2, 2, 1, 1, 2, 2,
+  1, 4, 0, 3, 2, 3, 2, 2, 1, 2, 5, 2,
+  4, 1, 1, 6, 1, 1, 1, 5, 1, 6, 2, 1,
+  6, 4, 2, 6, 3, 4, 2, 2, 6, 1, 5, 2,
+  2, 1, 3, 0, 2, 1, 5, 3, 2, 4, 2, 3,
+  1, 3, 4, 3, 3, 2, 2, 3, 2, 4, 3, 3,
+  4, 3, 3, 2, 2, 3, 1, 2, 1, 2, 3, 2,
+  7, 1, 6, 2, 1, 6, 3, 3, 5, 3, 4, 2,
+  3, 3, 3, 5, 2, 4, 1, 3, 2, 2, 5, 3,
+  4, 4, 2, 5, 4, 4, 5, 1, 8, 1, 2, 7,
+  2, 6, 3, 2, 6, 2, 5, 3, 2, 8, 1, 7,
+  2, 3, 6, 3, 5, 2, 4, 3, 2, 6, 3, 5,
+  2, 3, 6, 2, 5, 1, 4, 2, 2, 6, 4, 5,
+  5, 2, 9, 1, 8, 2, 2, 6, 2, 4, 3, 2,
+  8, 2, 7, 3, 2, 10, 2, 7, 3
+  };
+
+static const char *const hyph_fr_languages[] =
+  { "fr", "fra", "fre", NULL };
+
+static const HyphPatterns hyph_patterns[] =
+  {
+  { hyph_de_languages, 2, 2, 83, hyph_de_chars, hyph_de_codes, 1, hyph_de_trie, hyph_de_ops, hyph_de_values },
+  { hyph_en_languages, 2, 3, 52, hyph_en_chars, hyph_en_codes, 1, hyph_en_trie, hyph_en_ops, hyph_en_values },
+  { hyph_fr_languages, 2, 3, 76, hyph_fr_chars, hyph_fr_codes, 1, hyph_fr_trie, hyph_fr_ops, hyph_fr_values }
+  };
@@ -16,19 +16,26 @@
 #include <pthread.h>
 #include "list.h" 
 
-typedef struct _ListItem
-  {
-  struct _ListItem *next;
-  void *data;
-  } ListItem;
+// The smallest array that a list grows to
+#define LIST_MIN_SIZE 8
 
+// The items are kept in an array, which at least doubles each time it 
+//   grows. Only a list made with list_create_concurrent() is locked.
 struct _List
   {
   pthread_mutex_t mutex;
+  BOOL concurrent;
   ListItemFreeFn free_fn; 
-  ListItem *head;
+  void **items;
+  int length;
+  int size;
   };
 
+#define LIST_LOCK(self) \
+  do { if ((self)->concurrent) pthread_mutex_lock (&(self)->mutex); } while (0)
+#define LIST_UNLOCK(self) \
+  do { if ((self)->concurrent) pthread_mutex_unlock (&(self)->mutex); } while (0)
+
 /*==========================================================================
 list_create
 *==========================================================================*/
@@ -37,6 +44,19 @@ List *list_create (ListItemFreeFn free_fn)
   List *list = malloc (sizeof (List));
   memset (list, 0, sizeof (List));
   list->free_fn = free_fn;
+  return list;
+  }
+
+/*==========================================================================
+list_create_concurrent
+A list that more than one thread can use at the same time. Every 
+operation takes the list's mutex. Items that list_get() returns are not
+protected, once it has returned.
+*==========================================================================*/
+List *list_create_concurrent (ListItemFreeFn free_fn)
+  {
+  List *list = list_create (free_fn);
+  list->concurrent = TRUE;
   pthread_mutex_init (&list->mutex, NULL);
   return list;
   }
@@ -56,23 +76,33 @@ void list_destroy (List *self)
   {
   if (!self) return;
 
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
-  while (l)
+  LIST_LOCK (self);
+  int i;
+  if (self->free_fn)
     {
-    if (self->free_fn)
-      self->free_fn (l->data);
-    ListItem *temp = l;
-    l = l->next;
-    free (temp);
+    for (i = 0; i < self->length; i++)
+      self->free_fn (self->items[i]);
     }
-
-  pthread_mutex_unlock (&self->mutex);
-  pthread_mutex_destroy (&self->mutex);
+  free (self->items);
+  LIST_UNLOCK (self);
+  if (self->concurrent) pthread_mutex_destroy (&self->mutex);
   free (self);
   }
 
 
+/*==========================================================================
+list_reserve
+Make room for one more item. Called with the list locked.
+*==========================================================================*/
+static void list_reserve (List *self)
+  {
+  if (self->length < self->size) return;
+  int size = self->size ? self->size * 2 : LIST_MIN_SIZE;
+  self->items = realloc (self->items, size * sizeof (void *));
+  self->size = size;
+  }
+
+
 /*==========================================================================
 list_prepend
 Note that the caller must not modify or free the item added to the list. It
@@ -81,21 +111,12 @@ the supplied free function
 *==========================================================================*/
 void list_prepend (List *self, void *item)
   {
-  pthread_mutex_lock (&self->mutex);
-  ListItem *i = malloc (sizeof (ListItem));
-  i->data = item;
-  i->next = NULL;
-
-  if (self->head)
-    {
-    i->next = self->head;
-    self->head = i;
-    }
-  else
-    {
-    self->head = i;
-    }
-  pthread_mutex_unlock (&self->mutex);
+  LIST_LOCK (self);
+  list_reserve (self);
+  memmove (self->items + 1, self->items, self->length * sizeof (void *));
+  self->items[0] = item;
+  self->length++;
+  LIST_UNLOCK (self);
   }
 
 
@@ -107,23 +128,10 @@ the supplied free function
 *==========================================================================*/
 void list_append (List *self, void *item)
   {
-  pthread_mutex_lock (&self->mutex);
-  ListItem *i = malloc (sizeof (ListItem));
-  i->data = item;
-  i->next = NULL;
-
-  if (self->head)
-    {
-    ListItem *l = self->head;
-    while (l->next)
-      l = l->next;
-    l->next = i;
-    }
-  else
-    {
-    self->head = i;
-    }
-  pthread_mutex_unlock (&self->mutex);
+  LIST_LOCK (self);
+  list_reserve (self);
+  self->items[self->length++] = item;
+  LIST_UNLOCK (self);
   }
 
 
@@ -134,37 +142,25 @@ int list_length (List *self)
   {
   if (!self) return 0;
 
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
-  int i = 0;
-  while (l != NULL)
-    {
-    l = l->next;
-    i++;
-    }
-
-  pthread_mutex_unlock (&self->mutex);
-  return i;
+  LIST_LOCK (self);
+  int l = self->length;
+  LIST_UNLOCK (self);
+  return l;
   }
 
 /*==========================================================================
 list_get
+Returns NULL if index is out of range
 *==========================================================================*/
 void *list_get (List *self, int index)
   {
   if (!self) return NULL;
 
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
-  int i = 0;
-  while (l != NULL && i != index)
-    {
-    l = l->next;
-    i++;
-    }
-  pthread_mutex_unlock (&self->mutex);
+  LIST_LOCK (self);
+  void *item = index >= 0 && index < self->length ? self->items[index] : NULL;
+  LIST_UNLOCK (self);
 
-  return l->data;
+  return item;
   }
 
 
@@ -188,15 +184,14 @@ list_contains
 BOOL list_contains (List *self, const void *item, ListCompareFn fn)
   {
   if (!self) return FALSE;
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
+  LIST_LOCK (self);
   BOOL found = FALSE;
-  while (l != NULL && !found)
+  int i;
+  for (i = 0; i < self->length && !found; i++)
     {
-    if (fn (l->data, item) == 0) found = TRUE; 
-    l = l->next;
+    if (fn (self->items[i], item) == 0) found = TRUE; 
     }
-  pthread_mutex_unlock (&self->mutex);
+  LIST_UNLOCK (self);
   return found; 
   }
 
@@ -221,33 +216,21 @@ to copy the item first.
 void list_remove (List *self, const void *item, ListCompareFn fn)
   {
   if (!self) return;
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
-  ListItem *last_good = NULL;
-  while (l != NULL)
+  LIST_LOCK (self);
+  // The items that are kept are moved down over the ones that are not,
+  //   in order
+  int i, kept = 0;
+  for (i = 0; i < self->length; i++)
     {
-    if (fn (l->data, item) == 0)
-      {
-      if (l == self->head)
-        {
-        self->head = l->next; // l-> next might be null
-        }
-      else
-        {
-        if (last_good) last_good->next = l->next;
-        }
-      self->free_fn (l->data);  
-      ListItem *temp = l->next;
-      free (l);
-      l = temp;
-      } 
-    else
+    if (fn (self->items[i], item) == 0)
       {
-      last_good = l;
-      l = l->next;
+      if (self->free_fn) self->free_fn (self->items[i]);  
       }
+    else
+      self->items[kept++] = self->items[i];
     }
-  pthread_mutex_unlock (&self->mutex);
+  self->length = kept;
+  LIST_UNLOCK (self);
   }
 
 /*==========================================================================
@@ -261,21 +244,19 @@ void list_remove_string (List *self, const char *item)
 
 /*==========================================================================
 list_clone
+The clone is concurrent if the original is
 *==========================================================================*/
 List *list_clone (List *self, ListCopyFn copyFn)
   {
   ListItemFreeFn free_fn = self->free_fn; 
-  List *new = list_create (free_fn);
-
-  pthread_mutex_lock (&self->mutex);
-  ListItem *l = self->head;
-  while (l != NULL)
-    {
-    void *data = copyFn (l->data);
-    list_append (new, data);
-    l = l->next;
-    }
-  pthread_mutex_unlock (&self->mutex);
+  List *new = self->concurrent 
+    ? list_create_concurrent (free_fn) : list_create (free_fn);
+
+  LIST_LOCK (self);
+  int i;
+  for (i = 0; i < self->length; i++)
+    list_append (new, copyFn (self->items[i]));
+  LIST_UNLOCK (self);
 
   return new;
   }
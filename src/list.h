@@ -16,7 +16,10 @@ typedef int (*ListCompareFn) (const void *i1, const void *i2);
 typedef void* (*ListCopyFn) (const void *orig);
 typedef void (*ListItemFreeFn) (void *);
 
+// A list is not locked, and must not be used by more than one thread at
+//   a time; list_create_concurrent() makes one that can be
 List   *list_create (ListItemFreeFn free_fn);
+List   *list_create_concurrent (ListItemFreeFn free_fn);
 void    list_destroy (List *);
 void    list_append (List *self, void *item);
 void    list_prepend (List *self, void *item);
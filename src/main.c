@@ -16,6 +16,7 @@
 #include "epub2txt.h" 
 #include "defs.h" 
 #include "log.h" 
+#include "metaexport.h" 
 
 /*============================================================================
   sig_handler 
@@ -41,7 +42,13 @@ int main (int argc, char **argv)
   BOOL meta = FALSE;
   BOOL notext = FALSE;
   BOOL calibre = FALSE;
+  BOOL all_items = FALSE;
+  BOOL linear_only = FALSE;
+  BOOL hyphenate = FALSE;
   char *section_separator = NULL;
+  char *select = NULL;
+  MetaFormat meta_format = META_FORMAT_TEXT;
+  WrapMode wrap = WRAP_GREEDY;
   int width = 80;
 
   static struct option long_options[] =
@@ -55,6 +62,12 @@ int main (int argc, char **argv)
      {"width", required_argument, NULL, 'w'},
      {"log", required_argument, NULL, 'l'},
      {"separator", required_argument, NULL, 's'},
+     {"select", required_argument, NULL, 'S'},
+     {"meta-format", required_argument, NULL, 'M'},
+     {"all-items", no_argument, NULL, 'A'},
+     {"linear-only", no_argument, NULL, 'L'},
+     {"wrap", required_argument, NULL, 'W'},
+     {"hyphenate", no_argument, NULL, 'H'},
      {"help", no_argument, NULL, 'h'},
      {"notext", no_argument, NULL, 0},
      {0, 0, 0, 0}
@@ -148,6 +161,40 @@ int main (int argc, char **argv)
         width = atoi (optarg); break;
       case 's':
         section_separator = strdup (optarg); break;
+      case 'S':
+        select = strdup (optarg); break;
+      case 'A':
+        all_items = TRUE; break;
+      case 'L':
+        linear_only = TRUE; break;
+      case 'H':
+        hyphenate = TRUE; break;
+      case 'M':
+        if (strcmp (optarg, "ndjson") == 0)
+          meta_format = META_FORMAT_NDJSON;
+        else if (strcmp (optarg, "csv") == 0)
+          meta_format = META_FORMAT_CSV;
+        else if (strcmp (optarg, "text") == 0)
+          meta_format = META_FORMAT_TEXT;
+        else
+          {
+          fprintf (stderr, "%s: unknown metadata format '%s'\n", 
+            argv[0], optarg); 
+          exit (-1);
+          }
+        break;
+      case 'W':
+        if (strcmp (optarg, "optimal") == 0)
+          wrap = WRAP_OPTIMAL;
+        else if (strcmp (optarg, "greedy") == 0)
+          wrap = WRAP_GREEDY;
+        else
+          {
+          fprintf (stderr, "%s: unknown wrap mode '%s'\n", 
+            argv[0], optarg); 
+          exit (-1);
+          }
+        break;
       }
     }
 
@@ -163,16 +210,22 @@ int main (int argc, char **argv)
     {
     printf ("Usage: %s [options] {files...}\n", argv[0]);
     printf ("  -a,--ascii          try to output ASCII only\n");
+    printf ("     --all-items      extract spine items that are not XHTML\n");
     printf ("  -c,--calibre        show Calibre metadata (with -m)\n");
     printf ("  -h,--help           show this message\n");
+    printf ("     --hyphenate      hyphenate words at the ends of lines\n");
     printf ("  -l,--log=N          set log level, 0-4\n");
+    printf ("     --linear-only    skip spine items marked non-linear\n");
     printf ("  -m,--meta           dump document metadata\n");
+    printf ("     --meta-format=f  export metadata only, as ndjson or csv\n");
     printf ("  -n,--noansi         don't output ANSI terminal codes\n");
     printf ("     --notext         don't output document body\n");
     printf ("  -r,--raw            no formatting at all\n");
     printf ("  -s,--separator=text section separator text\n");
+    printf ("     --select=expr    output only the text of matching elements\n");
     printf ("  -v,--version        show version\n");
     printf ("  -w,--width=N        set output width\n");
+    printf ("     --wrap=mode      break lines greedy (default) or optimal\n");
     exit (0);
     }
 
@@ -191,6 +244,12 @@ int main (int argc, char **argv)
   options.notext = notext;
   options.calibre = calibre;
   options.section_separator = section_separator;
+  options.select = select;
+  options.meta_format = meta_format;
+  options.all_items = all_items;
+  options.linear_only = linear_only;
+  options.wrap = wrap;
+  options.hyphenate = hyphenate;
 
   if (is_a_tty)
     options.ansi = TRUE;
@@ -204,6 +263,15 @@ int main (int argc, char **argv)
   signal (SIGINT, sig_handler);
   signal (SIGHUP, sig_handler);
 
+  if (meta_format != META_FORMAT_TEXT)
+    {
+    // Batch export of metadata: one record per file, and no text
+    metaexport_files (argv + optind, argc - optind, &options);
+    if (section_separator) free (section_separator);
+    if (select) free (select);
+    exit (0);
+    }
+
   int i;
   for (i = optind; i < argc; i++)
     {
@@ -217,7 +285,9 @@ int main (int argc, char **argv)
       }
     }
 
+  epub2txt_finish ();
   if (section_separator) free (section_separator);
+  if (select) free (select);
   exit (0);
   }
 
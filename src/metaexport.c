@@ -0,0 +1,439 @@
+/*============================================================================
+  epub2txt v2
+  metaexport.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "metaexport.h"
+#include "log.h"
+#include "list.h"
+#include "string.h"
+#include "sxmlc.h"
+#include "atoms.h"
+#include "xhtml.h"
+
+// The Dublin Core elements, in the order they are written. Every record
+//   has all of them, even if empty, so that CSV columns and JSON keys do
+//   not depend on the book
+static const struct
+  {
+  Atom atom;
+  const char *name;
+  } metaexport_dc[] =
+  {
+  { ATOM_TITLE, "title" },
+  { ATOM_CREATOR, "creator" },
+  { ATOM_CONTRIBUTOR, "contributor" },
+  { ATOM_PUBLISHER, "publisher" },
+  { ATOM_SUBJECT, "subject" },
+  { ATOM_DESCRIPTION, "description" },
+  { ATOM_DATE, "date" },
+  { ATOM_LANGUAGE, "language" },
+  { ATOM_IDENTIFIER, "identifier" },
+  { ATOM_RIGHTS, "rights" },
+  { ATOM_SOURCE, "source" },
+  { ATOM_TYPE, "type" },
+  { ATOM_FORMAT, "format" },
+  { ATOM_RELATION, "relation" },
+  { ATOM_COVERAGE, "coverage" },
+  };
+
+#define METAEXPORT_DC_COUNT \
+  ((int)(sizeof (metaexport_dc) / sizeof (metaexport_dc[0])))
+
+// NDJSON records have every calibre:* entry in the OPF, but CSV needs
+//   fixed columns, so it has only these
+static const char *const metaexport_calibre_csv[] =
+  {
+  "calibre:series", "calibre:series_index", "calibre:title_sort", NULL
+  };
+
+typedef struct _MetaRecord
+  {
+  List *dc[METAEXPORT_DC_COUNT];
+  List *calibre_names; // Parallel lists, in document order
+  List *calibre_values;
+  } MetaRecord;
+
+typedef struct _MetaExportJob
+  {
+  char *const *files;
+  int count;
+  const Epub2TxtOptions *options;
+  pthread_mutex_t mutex;
+  pthread_cond_t ready;
+  int next; // Next file for a worker to take
+  char **records; // Formatted records, NULL until ready
+  } MetaExportJob;
+
+/*============================================================================
+  metaexport_record_create
+============================================================================*/
+static MetaRecord *metaexport_record_create (void)
+  {
+  MetaRecord *self = malloc (sizeof (MetaRecord));
+  int i;
+  for (i = 0; i < METAEXPORT_DC_COUNT; i++)
+    self->dc[i] = list_create_strings();
+  self->calibre_names = list_create_strings();
+  self->calibre_values = list_create_strings();
+  return self;
+  }
+
+/*============================================================================
+  metaexport_record_destroy
+============================================================================*/
+static void metaexport_record_destroy (MetaRecord *self)
+  {
+  int i;
+  for (i = 0; i < METAEXPORT_DC_COUNT; i++)
+    list_destroy (self->dc[i]);
+  list_destroy (self->calibre_names);
+  list_destroy (self->calibre_values);
+  free (self);
+  }
+
+/*============================================================================
+  metaexport_plain
+  Metadata values are XHTML escaped into plain text, so there may be two
+    levels of markup to remove, as epub2txt_format_meta() does
+============================================================================*/
+static char *metaexport_plain (const char *s)
+  {
+  char *unescaped = xhtml_utf8_to_plain (s);
+  char *ret = xhtml_utf8_to_plain (unescaped);
+  free (unescaped);
+  return ret;
+  }
+
+/*============================================================================
+  metaexport_collect
+  Fill the record from the text of the OPF file, which is parsed in-situ
+============================================================================*/
+static BOOL metaexport_collect (MetaRecord *record, String *opf)
+  {
+  XMLDoc doc;
+  XMLDoc_init (&doc);
+  doc.atom_fn = atoms_xml;
+  if (!XMLDoc_parse_buffer_DOM_in_situ (string_cstr_mutable (opf),
+       APPNAME, &doc))
+    return FALSE;
+
+  XMLNode *root = XMLDoc_root (&doc);
+  int i, l = root ? root->n_children : 0;
+  for (i = 0; i < l; i++)
+    {
+    XMLNode *metadata = root->children[i];
+    if (metadata->tag_atom != ATOM_METADATA) continue;
+    int j;
+    for (j = 0; j < metadata->n_children; j++)
+      {
+      XMLNode *r2 = metadata->children[j];
+      if (r2->tag_atom == ATOM_META)
+        {
+        const char *name = NULL, *content = NULL;
+        int k;
+        for (k = 0; k < r2->n_attributes; k++)
+          {
+          if (r2->attributes[k].name_atom == ATOM_NAME)
+            name = r2->attributes[k].value;
+          else if (r2->attributes[k].name_atom == ATOM_CONTENT)
+            content = r2->attributes[k].value;
+          }
+        if (name && content && strncmp (name, "calibre:", 8) == 0)
+          {
+          list_append (record->calibre_names, strdup (name));
+          list_append (record->calibre_values, metaexport_plain (content));
+          }
+        }
+      else if (r2->text)
+        {
+        int k;
+        for (k = 0; k < METAEXPORT_DC_COUNT; k++)
+          {
+          if (metaexport_dc[k].atom == r2->tag_atom)
+            {
+            list_append (record->dc[k], metaexport_plain (r2->text));
+            break;
+            }
+          }
+        }
+      }
+    }
+  XMLDoc_free (&doc);
+  return TRUE;
+  }
+
+/*============================================================================
+  metaexport_json_string
+============================================================================*/
+static void metaexport_json_string (String *out, const char *s)
+  {
+  string_append_byte (out, '"');
+  for (; *s; s++)
+    {
+    unsigned char c = (unsigned char)*s;
+    if (c == '"' || c == '\\')
+      {
+      string_append_byte (out, '\\');
+      string_append_byte (out, c);
+      }
+    else if (c < 0x20)
+      string_append_printf (out, "\\u%04x", c);
+    else
+      string_append_byte (out, c);
+    }
+  string_append_byte (out, '"');
+  }
+
+/*============================================================================
+  metaexport_json_array
+  Write the values of list, or those values whose name in names matches
+    name if names is not NULL
+============================================================================*/
+static void metaexport_json_array (String *out, List *values, List *names,
+     const char *name)
+  {
+  BOOL first = TRUE;
+  int i, l = list_length (values);
+  string_append_byte (out, '[');
+  for (i = 0; i < l; i++)
+    {
+    if (names && strcmp (list_get (names, i), name) != 0) continue;
+    if (!first) string_append_byte (out, ',');
+    metaexport_json_string (out, list_get (values, i));
+    first = FALSE;
+    }
+  string_append_byte (out, ']');
+  }
+
+/*============================================================================
+  metaexport_format_ndjson
+============================================================================*/
+static char *metaexport_format_ndjson (const char *file,
+     const MetaRecord *record, const char *error)
+  {
+  String *out = string_create ("{\"file\":");
+  metaexport_json_string (out, file);
+  if (error)
+    {
+    string_append (out, ",\"error\":");
+    metaexport_json_string (out, error);
+    }
+  else
+    {
+    int i;
+    for (i = 0; i < METAEXPORT_DC_COUNT; i++)
+      {
+      string_append_printf (out, ",\"%s\":", metaexport_dc[i].name);
+      metaexport_json_array (out, record->dc[i], NULL, NULL);
+      }
+    int l = list_length (record->calibre_names);
+    for (i = 0; i < l; i++)
+      {
+      const char *name = list_get (record->calibre_names, i);
+      int j;
+      for (j = 0; j < i; j++)
+        if (strcmp (list_get (record->calibre_names, j), name) == 0) break;
+      if (j < i) continue; // Already written, with the first
+      string_append_byte (out, ',');
+      metaexport_json_string (out, name);
+      string_append_byte (out, ':');
+      metaexport_json_array (out, record->calibre_values,
+        record->calibre_names, name);
+      }
+    }
+  string_append (out, "}\n");
+  char *ret = strdup (string_cstr (out));
+  string_destroy (out);
+  return ret;
+  }
+
+/*============================================================================
+  metaexport_csv_field
+  Write a quoted CSV field (RFC 4180). Multiple values go in the same
+    field, one per line; values never contain line breaks themselves
+============================================================================*/
+static void metaexport_csv_field (String *out, List *values, List *names,
+     const char *name)
+  {
+  BOOL first = TRUE;
+  int i, l = values ? list_length (values) : 0;
+  string_append_byte (out, '"');
+  for (i = 0; i < l; i++)
+    {
+    if (names && strcmp (list_get (names, i), name) != 0) continue;
+    if (!first) string_append_byte (out, '\n');
+    const char *s;
+    for (s = list_get (values, i); *s; s++)
+      {
+      if (*s == '"') string_append_byte (out, '"');
+      string_append_byte (out, *s);
+      }
+    first = FALSE;
+    }
+  string_append_byte (out, '"');
+  }
+
+/*============================================================================
+  metaexport_csv_header
+============================================================================*/
+static void metaexport_csv_header (void)
+  {
+  int i;
+  printf ("file");
+  for (i = 0; i < METAEXPORT_DC_COUNT; i++)
+    printf (",%s", metaexport_dc[i].name);
+  for (i = 0; metaexport_calibre_csv[i]; i++)
+    printf (",%s", metaexport_calibre_csv[i]);
+  printf (",error\r\n");
+  }
+
+/*============================================================================
+  metaexport_format_csv
+============================================================================*/
+static char *metaexport_format_csv (const char *file,
+     const MetaRecord *record, const char *error)
+  {
+  String *out = string_create_empty();
+  List *one = list_create_strings();
+  list_append (one, strdup (file));
+  metaexport_csv_field (out, one, NULL, NULL);
+  int i;
+  for (i = 0; i < METAEXPORT_DC_COUNT; i++)
+    {
+    string_append_byte (out, ',');
+    metaexport_csv_field (out, error ? NULL : record->dc[i], NULL, NULL);
+    }
+  for (i = 0; metaexport_calibre_csv[i]; i++)
+    {
+    string_append_byte (out, ',');
+    metaexport_csv_field (out, error ? NULL : record->calibre_values,
+      record->calibre_names, metaexport_calibre_csv[i]);
+    }
+  list_destroy (one);
+  one = list_create_strings();
+  if (error) list_append (one, strdup (error));
+  string_append_byte (out, ',');
+  metaexport_csv_field (out, one, NULL, NULL);
+  list_destroy (one);
+  string_append (out, "\r\n");
+  char *ret = strdup (string_cstr (out));
+  string_destroy (out);
+  return ret;
+  }
+
+/*============================================================================
+  metaexport_file
+  Read the metadata of one EPUB and format it as a record
+============================================================================*/
+static char *metaexport_file (const char *file,
+     const Epub2TxtOptions *options)
+  {
+  IN
+  char *error = NULL;
+  MetaRecord *record = metaexport_record_create();
+  if (access (file, R_OK) != 0)
+    asprintf (&error, "File not found: %s", file);
+  else
+    {
+    String *opf = epub2txt_read_opf (file, &error);
+    if (opf)
+      {
+      if (!metaexport_collect (record, opf))
+        asprintf (&error, "Can't parse OPF XML");
+      string_destroy (opf);
+      }
+    }
+
+  char *ret;
+  if (options->meta_format == META_FORMAT_CSV)
+    ret = metaexport_format_csv (file, record, error);
+  else
+    ret = metaexport_format_ndjson (file, record, error);
+
+  if (error) free (error);
+  metaexport_record_destroy (record);
+  OUT
+  return ret;
+  }
+
+/*============================================================================
+  metaexport_worker
+============================================================================*/
+static void *metaexport_worker (void *arg)
+  {
+  MetaExportJob *job = arg;
+  while (1)
+    {
+    pthread_mutex_lock (&job->mutex);
+    int i = job->next++;
+    pthread_mutex_unlock (&job->mutex);
+    if (i >= job->count) break;
+
+    char *record = metaexport_file (job->files[i], job->options);
+
+    pthread_mutex_lock (&job->mutex);
+    job->records[i] = record;
+    pthread_cond_signal (&job->ready);
+    pthread_mutex_unlock (&job->mutex);
+    }
+  return NULL;
+  }
+
+/*============================================================================
+  metaexport_files
+============================================================================*/
+void metaexport_files (char *const files[], int count,
+       const Epub2TxtOptions *options)
+  {
+  IN
+  MetaExportJob job;
+  memset (&job, 0, sizeof (job));
+  job.files = files;
+  job.count = count;
+  job.options = options;
+  job.records = calloc (count, sizeof (char *));
+  pthread_mutex_init (&job.mutex, NULL);
+  pthread_cond_init (&job.ready, NULL);
+
+  int n_threads = (int)sysconf (_SC_NPROCESSORS_ONLN);
+  if (n_threads < 1) n_threads = 1;
+  if (n_threads > count) n_threads = count;
+  log_debug ("Exporting metadata with %d threads", n_threads);
+  pthread_t *threads = malloc (n_threads * sizeof (pthread_t));
+  int i;
+  for (i = 0; i < n_threads; i++)
+    pthread_create (&threads[i], NULL, metaexport_worker, &job);
+
+  if (options->meta_format == META_FORMAT_CSV)
+    metaexport_csv_header();
+
+  // Write each record as soon as it, and all that precede it, are ready
+  for (i = 0; i < count; i++)
+    {
+    pthread_mutex_lock (&job.mutex);
+    while (job.records[i] == NULL)
+      pthread_cond_wait (&job.ready, &job.mutex);
+    char *record = job.records[i];
+    job.records[i] = NULL;
+    pthread_mutex_unlock (&job.mutex);
+    fputs (record, stdout);
+    free (record);
+    }
+  fflush (stdout);
+
+  for (i = 0; i < n_threads; i++)
+    pthread_join (threads[i], NULL);
+  free (threads);
+  free (job.records);
+  pthread_cond_destroy (&job.ready);
+  pthread_mutex_destroy (&job.mutex);
+  OUT
+  }
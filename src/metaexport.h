@@ -0,0 +1,19 @@
+/*============================================================================
+  epub2txt v2
+  metaexport.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Batch export of EPUB metadata (--meta-format) as NDJSON or CSV, one
+  record per input file. Only the container and OPF files are read from
+  each EPUB. Files are processed by a pool of worker threads, but the
+  records are written by a single writer, in the order of the input
+  files, as soon as each is ready.
+============================================================================*/
+
+#pragma once
+
+#include "defs.h"
+#include "epub2txt.h"
+
+void metaexport_files (char *const files[], int count,
+       const Epub2TxtOptions *options);
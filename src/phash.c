@@ -0,0 +1,55 @@
+/*============================================================================
+  epub2txt v2 
+  phash.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include "phash.h"
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
+/*============================================================================
+  phash_final
+  FNV-1a has weak low bits, and the tables index with a mask, so mix the
+  high bits down
+============================================================================*/
+static uint32_t phash_final (uint32_t h)
+  {
+  h ^= h >> 16;
+  h *= 0x45d9f3bu;
+  h ^= h >> 16;
+  return h;
+  }
+
+/*============================================================================
+  phash 
+============================================================================*/
+uint32_t phash (uint32_t seed, const char *s, int len)
+  {
+  uint32_t h = FNV_OFFSET ^ seed;
+  int i;
+  for (i = 0; i < len; i++)
+    {
+    h ^= (unsigned char)s[i];
+    h *= FNV_PRIME;
+    }
+  return phash_final (h);
+  }
+
+/*============================================================================
+  phash_fold 
+============================================================================*/
+uint32_t phash_fold (uint32_t seed, const char *s, int len)
+  {
+  uint32_t h = FNV_OFFSET ^ seed;
+  int i;
+  for (i = 0; i < len; i++)
+    {
+    unsigned char c = (unsigned char)s[i];
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+    h ^= c;
+    h *= FNV_PRIME;
+    }
+  return phash_final (h);
+  }
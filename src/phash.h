@@ -0,0 +1,21 @@
+/*============================================================================
+  epub2txt v2 
+  phash.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  The hash function used by the static, generated perfect-hash tables
+  (see tools/mkphash.py). The generator implements exactly the same
+  function, so the two must be changed together. 
+============================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+/** Seeded FNV-1a hash of the first len bytes of s. */
+uint32_t phash (uint32_t seed, const char *s, int len);
+
+/** As phash(), but ASCII letters are folded to lower case first, so that
+    names differing only in case hash to the same value. */
+uint32_t phash_fold (uint32_t seed, const char *s, int len);
@@ -0,0 +1,128 @@
+/*============================================================================
+  epub2txt v2 
+  scan.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <stdint.h>
+#include "scan.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__x86_64__) && defined(__GNUC__) && defined(__SSE2__)
+#include <immintrin.h>
+#define SCAN_AVX2 1
+#endif
+
+/*============================================================================
+  scan_plain_scalar
+  The byte-at-a-time version, for the end of the text and for CPUs we 
+    have no vector code for. 
+============================================================================*/
+static int scan_plain_scalar (const BYTE *s, const BYTE *end, int prev)
+  {
+  const BYTE *p = s;
+  while (p < end)
+    {
+    BYTE c = *p;
+    if (c < 0x20 || c >= 0x80 || c == '<' || c == '&') break;
+    if (c == ' ' && prev == ' ') break;
+    prev = c;
+    p++;
+    }
+  return p - s;
+  }
+
+#if defined(__SSE2__)
+/*============================================================================
+  scan_plain_sse2
+  Adding 0x60 moves the printable ASCII range to 0x80-0xDF, which is 
+    everything less than -32 in a signed compare; so one compare finds 
+    all the control and non-ASCII bytes. A space is a problem only if 
+    the previous byte is a space too, which is a shift of the bit mask.
+============================================================================*/
+static int scan_plain_sse2 (const BYTE *s, const BYTE *end, int prev)
+  {
+  const BYTE *p = s;
+  const __m128i bias = _mm_set1_epi8 (0x60);
+  const __m128i limit = _mm_set1_epi8 (-33);
+  const __m128i lt = _mm_set1_epi8 ('<');
+  const __m128i amp = _mm_set1_epi8 ('&');
+  const __m128i space = _mm_set1_epi8 (' ');
+  unsigned int prev_space = (prev == ' ');
+
+  while (end - p >= 16)
+    {
+    __m128i v = _mm_loadu_si128 ((const __m128i *)p);
+    __m128i bad = _mm_cmpgt_epi8 (_mm_add_epi8 (v, bias), limit);
+    bad = _mm_or_si128 (bad, _mm_cmpeq_epi8 (v, lt));
+    bad = _mm_or_si128 (bad, _mm_cmpeq_epi8 (v, amp));
+    unsigned int sp = (unsigned int)_mm_movemask_epi8 
+      (_mm_cmpeq_epi8 (v, space));
+    unsigned int mask = (unsigned int)_mm_movemask_epi8 (bad) 
+      | (sp & ((sp << 1) | prev_space));
+    if (mask)
+      return (p - s) + __builtin_ctz (mask);
+    prev_space = sp >> 15;
+    p += 16;
+    }
+  return (p - s) + scan_plain_scalar (p, end, p > s ? p[-1] : prev);
+  }
+#endif
+
+#if defined(SCAN_AVX2)
+/*============================================================================
+  scan_plain_avx2
+  As scan_plain_sse2, but thirty-two bytes at a time
+============================================================================*/
+__attribute__ ((target ("avx2")))
+static int scan_plain_avx2 (const BYTE *s, const BYTE *end, int prev)
+  {
+  const BYTE *p = s;
+  const __m256i bias = _mm256_set1_epi8 (0x60);
+  const __m256i limit = _mm256_set1_epi8 (-33);
+  const __m256i lt = _mm256_set1_epi8 ('<');
+  const __m256i amp = _mm256_set1_epi8 ('&');
+  const __m256i space = _mm256_set1_epi8 (' ');
+  uint32_t prev_space = (prev == ' ');
+
+  while (end - p >= 32)
+    {
+    __m256i v = _mm256_loadu_si256 ((const __m256i *)p);
+    __m256i bad = _mm256_cmpgt_epi8 (_mm256_add_epi8 (v, bias), limit);
+    bad = _mm256_or_si256 (bad, _mm256_cmpeq_epi8 (v, lt));
+    bad = _mm256_or_si256 (bad, _mm256_cmpeq_epi8 (v, amp));
+    uint32_t sp = (uint32_t)_mm256_movemask_epi8 
+      (_mm256_cmpeq_epi8 (v, space));
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8 (bad) 
+      | (sp & ((sp << 1) | prev_space));
+    if (mask)
+      return (p - s) + __builtin_ctz (mask);
+    prev_space = sp >> 31;
+    p += 32;
+    }
+  return (p - s) + scan_plain_sse2 (p, end, p > s ? p[-1] : prev);
+  }
+#endif
+
+/*============================================================================
+  scan_plain_text
+============================================================================*/
+int scan_plain_text (const char *s, const char *end, int prev)
+  {
+#if defined(SCAN_AVX2)
+  // 0 = not yet known. Working it out more than once is harmless.
+  static int have_avx2 = 0;
+  if (have_avx2 == 0)
+    have_avx2 = __builtin_cpu_supports ("avx2") ? 1 : -1;
+  if (have_avx2 > 0)
+    return scan_plain_avx2 ((const BYTE *)s, (const BYTE *)end, prev);
+#endif
+#if defined(__SSE2__)
+  return scan_plain_sse2 ((const BYTE *)s, (const BYTE *)end, prev);
+#else
+  return scan_plain_scalar ((const BYTE *)s, (const BYTE *)end, prev);
+#endif
+  }
+
@@ -0,0 +1,19 @@
+/*============================================================================
+  epub2txt v2 
+  scan.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Fast scanning of UTF-8 text for the XHTML tokenizer. On x86 this uses
+  SSE2 or, if the CPU has it, AVX2, sixteen or thirty-two bytes at a 
+  time; elsewhere it falls back to plain C.
+============================================================================*/
+
+#pragma once
+
+#include "defs.h"
+
+/** Returns the length of the run of plain text at s, which ends at or
+    before end. Plain text is printable ASCII other than < and &, with
+    no space that follows another space; prev is the byte before s. */
+int scan_plain_text (const char *s, const char *end, int prev);
+
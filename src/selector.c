@@ -0,0 +1,351 @@
+/*============================================================================
+  epub2txt v2
+  selector.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
+#include "selector.h"
+#include "log.h"
+#include "string.h"
+#include "sxmlc.h"
+#include "sxmlsearch.h"
+#include "atoms.h"
+#include "xhtml.h"
+
+struct _Selector
+  {
+  int n_searches;
+  XMLSearch *searches; // One per '|'-separated alternative
+  };
+
+typedef struct _SelectorContext
+  {
+  const Selector *selector;
+  const char *name; // Spine item, for messages
+  XMLNode **stack; // Copies of the open elements, innermost last
+  int depth;
+  int size;
+  int match_depth; // Depth of the element being extracted, or -1
+  int skip_depth; // Depth of the enclosing script or style, or -1
+  String *text; // Raw text of the element being extracted
+  BOOL opened; // The file could be opened
+  int error_line; // Line of the last parse error, or 0
+  } SelectorContext;
+
+/*============================================================================
+  selector_fold
+  XHTML element names are case-insensitive, so they are matched in
+    lower case, both in the expression and in the document
+============================================================================*/
+static void selector_fold (char *s)
+  {
+  if (s)
+    for (; *s; s++) *s = tolower ((BYTE)*s);
+  }
+
+/*============================================================================
+  selector_split
+  Returns the end of the alternative that starts at s: the first '|' that
+    is not inside brackets or quotes, as in a[@href="x|y"], or the end of
+    the expression
+============================================================================*/
+static const char *selector_split (const char *s)
+  {
+  int depth = 0;
+  char quote = 0;
+  for (; *s; s++)
+    {
+    if (quote)
+      {
+      if (*s == quote) quote = 0;
+      }
+    else if (*s == '"' || *s == '\'')
+      quote = *s;
+    else if (*s == '[')
+      depth++;
+    else if (*s == ']')
+      {
+      if (depth > 0) depth--;
+      }
+    else if (*s == '|' && depth == 0)
+      break;
+    }
+  return s;
+  }
+
+/*============================================================================
+  selector_create
+============================================================================*/
+Selector *selector_create (const char *expr, char **error)
+  {
+  IN
+  Selector *self = malloc (sizeof (Selector));
+  self->n_searches = 1;
+  const char *p;
+  for (p = selector_split (expr); *p; p = selector_split (p + 1))
+    self->n_searches++;
+  self->searches = calloc (self->n_searches, sizeof (XMLSearch));
+
+  int i;
+  const char *start = expr;
+  for (i = 0; i < self->n_searches; i++)
+    {
+    const char *end = selector_split (start);
+    char *xpath = strndup (start, end - start);
+    if (*xpath == 0 || !XMLSearch_init_from_XPath (xpath, &self->searches[i]))
+      {
+      asprintf (error, "Bad selector \"%s\"", xpath);
+      free (xpath);
+      self->n_searches = i;
+      selector_destroy (self);
+      OUT
+      return NULL;
+      }
+    XMLSearch *search;
+    for (search = &self->searches[i]; search; search = search->next)
+      selector_fold (search->tag);
+    free (xpath);
+    start = end + 1;
+    }
+
+  OUT
+  return self;
+  }
+
+/*============================================================================
+  selector_destroy
+============================================================================*/
+void selector_destroy (Selector *self)
+  {
+  IN
+  if (self)
+    {
+    int i;
+    for (i = 0; i < self->n_searches; i++)
+      XMLSearch_free (&self->searches[i], TRUE);
+    free (self->searches);
+    free (self);
+    }
+  OUT
+  }
+
+/*============================================================================
+  selector_matches
+  XMLSearch_node_matches() tests a node against the last step of a path,
+    and its ancestors against the earlier steps
+============================================================================*/
+static BOOL selector_matches (const Selector *self, const XMLNode *node)
+  {
+  int i;
+  for (i = 0; i < self->n_searches; i++)
+    {
+    const XMLSearch *search = &self->searches[i];
+    while (search->next) search = search->next;
+    if (XMLSearch_node_matches (node, search)) return TRUE;
+    }
+  return FALSE;
+  }
+
+/*============================================================================
+  selector_is_break
+  Elements whose boundaries separate words, even when there is no
+    whitespace in the source
+============================================================================*/
+static BOOL selector_is_break (const XMLNode *node)
+  {
+  switch (node->tag_atom)
+    {
+    case ATOM_BR: case ATOM_P: case ATOM_DIV: case ATOM_LI:
+    case ATOM_TD: case ATOM_TH: case ATOM_TR: case ATOM_BLOCKQUOTE:
+    case ATOM_H1: case ATOM_H2: case ATOM_H3: case ATOM_H4: case ATOM_H5:
+    case ATOM_H6: case ATOM_SECTION: case ATOM_ASIDE: case ATOM_FIGCAPTION:
+      return TRUE;
+    default:
+      return FALSE;
+    }
+  }
+
+/*============================================================================
+  selector_emit
+  Write the text of the extracted element as one line
+============================================================================*/
+static void selector_emit (const String *text)
+  {
+  char *s = xhtml_utf8_to_plain (string_cstr (text));
+  if (*s) printf ("%s\n", s);
+  free (s);
+  }
+
+/*============================================================================
+  selector_start_node
+============================================================================*/
+static int selector_start_node (const XMLNode *node, SAX_Data *sd)
+  {
+  SelectorContext *context = sd->user;
+  if (node->tag_type != TAG_FATHER && node->tag_type != TAG_SELF)
+    {
+    if (context->match_depth >= 0 && node->tag_type == TAG_CDATA)
+      string_append (context->text, node->tag);
+    return TRUE;
+    }
+
+  XMLNode *copy = XMLNode_dup (node, FALSE);
+  if (!copy) return FALSE;
+  selector_fold (copy->tag);
+  copy->father = context->depth > 0
+    ? context->stack[context->depth - 1] : NULL;
+  if (context->depth == context->size)
+    {
+    context->size = context->size ? 2 * context->size : 32;
+    context->stack = realloc (context->stack,
+      context->size * sizeof (XMLNode *));
+    }
+  context->stack[context->depth++] = copy;
+
+  // Scripts often contain markup in strings, which is not part of the
+  //   document
+  if (context->skip_depth >= 0) return TRUE;
+  if (copy->tag_atom == ATOM_SCRIPT || copy->tag_atom == ATOM_STYLE)
+    {
+    if (node->tag_type == TAG_FATHER) context->skip_depth = context->depth;
+    return TRUE;
+    }
+
+  if (context->match_depth < 0)
+    {
+    if (selector_matches (context->selector, copy))
+      {
+      context->match_depth = context->depth;
+      string_destroy (context->text);
+      context->text = string_create_empty();
+      }
+    }
+  else if (selector_is_break (copy))
+    string_append_c (context->text, ' ');
+  return TRUE;
+  }
+
+/*============================================================================
+  selector_end_node
+  Called with the end tag of a TAG_FATHER element, and straight after
+    selector_start_node() for a TAG_SELF element. The end tag is not
+    checked against the open element: XHTML documents are often sloppy
+============================================================================*/
+static int selector_end_node (const XMLNode *node, SAX_Data *sd)
+  {
+  SelectorContext *context = sd->user;
+  if (node->tag_type != TAG_END && node->tag_type != TAG_SELF) return TRUE;
+  if (context->depth == 0) return TRUE;
+
+  XMLNode *top = context->stack[context->depth - 1];
+  if (context->skip_depth >= 0)
+    {
+    if (context->skip_depth == context->depth) context->skip_depth = -1;
+    }
+  else if (context->match_depth == context->depth)
+    {
+    selector_emit (context->text);
+    context->match_depth = -1;
+    }
+  else if (context->match_depth >= 0 && selector_is_break (top))
+    string_append_c (context->text, ' ');
+
+  XMLNode_free (top);
+  free (top);
+  context->depth--;
+  return TRUE;
+  }
+
+/*============================================================================
+  selector_new_text
+============================================================================*/
+static int selector_new_text (SXML_CHAR *text, SAX_Data *sd)
+  {
+  SelectorContext *context = sd->user;
+  if (context->match_depth >= 0 && context->skip_depth < 0)
+    string_append (context->text, text);
+  return TRUE;
+  }
+
+/*============================================================================
+  selector_start_doc
+============================================================================*/
+static int selector_start_doc (SAX_Data *sd)
+  {
+  SelectorContext *context = sd->user;
+  context->opened = TRUE;
+  return TRUE;
+  }
+
+/*============================================================================
+  selector_on_error
+  The parser skips the malformed tag and goes on, as the XHTML parser
+    does, so that one stray '<' does not lose the rest of the document
+============================================================================*/
+static int selector_on_error (ParseError error_num, int line_number,
+     SAX_Data *sd)
+  {
+  (void)error_num;
+  SelectorContext *context = sd->user;
+  context->error_line = line_number;
+  log_warning ("Skipping malformed markup in \"%s\" at line %d",
+    context->name, line_number);
+  return TRUE;
+  }
+
+/*============================================================================
+  selector_file_to_stdout
+  file is the unpacked spine document; name is the spine item, which is
+    what messages refer to. *error is set when the file can't be read to
+    the end
+============================================================================*/
+void selector_file_to_stdout (const Selector *self, const char *file,
+     const char *name, const Epub2TxtOptions *options, char **error)
+  {
+  IN
+  (void)options;
+  SelectorContext context;
+  memset (&context, 0, sizeof (context));
+  context.selector = self;
+  context.name = name;
+  context.match_depth = -1;
+  context.skip_depth = -1;
+  context.text = string_create_empty();
+
+  SAX_Callbacks sax;
+  SAX_Callbacks_init (&sax);
+  sax.start_doc = selector_start_doc;
+  sax.start_node = selector_start_node;
+  sax.end_node = selector_end_node;
+  sax.new_text = selector_new_text;
+  sax.on_error = selector_on_error;
+  sax.atom_fn = atoms_xml_fold;
+
+  if (!XMLDoc_parse_file_SAX (file, &sax, &context))
+    {
+    if (!context.opened)
+      asprintf (error, "Can't open file '%s' for reading: %s",
+        file, strerror (errno));
+    else if (context.error_line > 0)
+      asprintf (error, "Can't parse \"%s\" after line %d", name,
+        context.error_line);
+    else
+      asprintf (error, "Can't parse \"%s\"", name);
+    }
+
+  while (context.depth > 0)
+    {
+    XMLNode *top = context.stack[--context.depth];
+    XMLNode_free (top);
+    free (top);
+    }
+  free (context.stack);
+  string_destroy (context.text);
+  OUT
+  }
@@ -0,0 +1,34 @@
+/*============================================================================
+  epub2txt v2
+  selector.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  Extraction of selected elements (--select). The selector is compiled
+  once from an XPath-like expression, using the syntax of sxmlsearch,
+  with alternatives separated by '|'. For example
+
+    h1|h2
+    aside[@epub:type="footnote"]
+    section/h?
+
+  Element names are matched case-insensitively; attribute names and
+  values are matched as written.
+
+  Each spine document is then streamed through the SAX parser, and the
+  text of each matching element is written to stdout as a single line.
+  No XHTML formatting or wrapping is done.
+============================================================================*/
+
+#pragma once
+
+#include "defs.h"
+#include "epub2txt.h"
+
+struct _Selector;
+typedef struct _Selector Selector;
+
+Selector *selector_create (const char *expr, char **error);
+void      selector_destroy (Selector *self);
+void      selector_file_to_stdout (const Selector *self, const char *file,
+             const char *name, const Epub2TxtOptions *options,
+             char **error);
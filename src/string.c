@@ -25,13 +25,36 @@
 #include "string.h" 
 #include "defs.h" 
 #include "log.h" 
+#include "encode.h" 
 
+// The smallest buffer that a string grows to
+#define STRING_MIN_SIZE 16
+
+// str is always terminated with a zero, which is not counted in length,
+//   but is in size
 struct _String
   {
   char *str;
+  int length;
+  int size;
   }; 
 
 
+/*==========================================================================
+string_reserve
+Make room for n more bytes, and the terminator. The buffer at least 
+doubles each time it grows, so that appending is amortized constant time
+*==========================================================================*/
+static void string_reserve (String *self, int n)
+  {
+  if (self->length + n + 1 <= self->size) return;
+  int size = self->size < STRING_MIN_SIZE ? STRING_MIN_SIZE : self->size;
+  while (size < self->length + n + 1) size *= 2;
+  self->str = realloc (self->str, size);
+  self->size = size;
+  }
+
+
 /*==========================================================================
 string_create_empty 
 *==========================================================================*/
@@ -45,9 +68,24 @@ String *string_create_empty (void)
 string_create
 *==========================================================================*/
 String *string_create (const char *s)
+  {
+  return string_create_from_bytes (s, strlen (s));
+  }
+
+
+/*==========================================================================
+string_create_from_bytes
+Create a String from len bytes of s, which need not be terminated. Any
+zeros among them are kept, and counted in the length
+*==========================================================================*/
+String *string_create_from_bytes (const char *s, int len)
   {
   String *self = malloc (sizeof (String));
-  self->str = strdup (s);
+  self->length = len;
+  self->size = len + 1 < STRING_MIN_SIZE ? STRING_MIN_SIZE : len + 1;
+  self->str = malloc (self->size);
+  memcpy (self->str, s, len);
+  self->str[len] = 0;
   return self;
   }
 
@@ -74,6 +112,18 @@ const char *string_cstr (const String *self)
   }
 
 
+/*==========================================================================
+string_cstr_mutable
+Returns the underlying buffer, for callers that modify it in place, like
+the in-situ XML parser. Such a caller may overwrite characters with
+zeros, after which the String should only be passed to string_destroy()
+*==========================================================================*/
+char *string_cstr_mutable (String *self)
+  {
+  return self->str;
+  }
+
+
 /*==========================================================================
 string_cstr_safe
 *==========================================================================*/
@@ -91,16 +141,26 @@ const char *string_cstr_safe (const String *self)
   }
 
 
+/*==========================================================================
+string_append_bytes
+Append len bytes of s, which should not include a zero
+*==========================================================================*/
+void string_append_bytes (String *self, const char *s, int len) 
+  {
+  string_reserve (self, len);
+  memcpy (self->str + self->length, s, len);
+  self->length += len;
+  self->str[self->length] = 0;
+  }
+
+
 /*==========================================================================
 string_append
 *==========================================================================*/
 void string_append (String *self, const char *s) 
   {
   if (!s) return;
-  if (self->str == NULL) self->str = strdup ("");
-  int newlen = strlen (self->str) + strlen (s) + 2;
-  self->str = realloc (self->str, newlen);
-  strcat (self->str, s);
+  string_append_bytes (self, s, strlen (s));
   }
 
 
@@ -110,14 +170,7 @@ string_prepend
 void string_prepend (String *self, const char *s) 
   {
   if (!s) return;
-  if (self->str == NULL) self->str = strdup ("");
-  int newlen = strlen (self->str) + strlen (s) + 2;
-  char *temp = strdup (self->str); 
-  free (self->str);
-  self->str = malloc (newlen);
-  strcpy (self->str, s);
-  strcat (self->str, temp);
-  free (temp);
+  string_insert (self, 0, s);
   }
 
 
@@ -126,12 +179,11 @@ string_append_printf
 *==========================================================================*/
 void string_append_printf (String *self, const char *fmt,...) 
   {
-  if (self->str == NULL) self->str = strdup ("");
   va_list ap;
   va_start (ap, fmt);
   char *s;
-  vasprintf (&s, fmt, ap);
-  string_append (self, s);
+  int n = vasprintf (&s, fmt, ap);
+  if (n > 0) string_append_bytes (self, s, n);
   free (s);
   va_end (ap);
   }
@@ -143,8 +195,7 @@ string_length
 int string_length (const String *self)
   {
   if (self == NULL) return 0;
-  if (self->str == NULL) return 0;
-  return strlen (self->str);
+  return self->length;
   }
 
 
@@ -154,7 +205,6 @@ string_clone
 String *string_clone (const String *self)
   {
   if (!self) return NULL;
-  if (!self->str) return string_create_empty();
   return string_create (string_cstr (self));
   }
 
@@ -179,16 +229,13 @@ string_delete
 *==========================================================================*/
 void string_delete (String *self, const int pos, const int len)
   {
-  char *str = self->str;
-  if (pos + len > strlen (str))
-    string_delete (self, pos, strlen(str) - len);
+  if (pos + len > self->length)
+    string_delete (self, pos, self->length - len);
   else
     {
-    char *buff = malloc (strlen (str) - len + 2);
-    strncpy (buff, str, pos); 
-    strcpy (buff + pos, str + pos + len);
-    free (self->str);
-    self->str = buff;
+    memmove (self->str + pos, self->str + pos + len, 
+      self->length - pos - len + 1);
+    self->length -= len;
     }
   }
 
@@ -199,14 +246,11 @@ string_insert
 void string_insert (String *self, const int pos, 
     const char *replace)
   {
-  char *buff = malloc (strlen (self->str) + strlen (replace) + 2);
-  char *str = self->str;
-  strncpy (buff, str, pos);
-  buff[pos] = 0;
-  strcat (buff, replace);
-  strcat (buff, str + pos); 
-  free (self->str);
-  self->str = buff;
+  int n = strlen (replace);
+  string_reserve (self, n);
+  memmove (self->str + pos + n, self->str + pos, self->length - pos + 1);
+  memcpy (self->str + pos, replace, n);
+  self->length += n;
   }
 
 
@@ -251,6 +295,7 @@ BOOL string_create_from_utf8_file (const char *filename,
     int64_t size = sb.st_size;
     char *buff = malloc (size + 2);
     self->str = buff; 
+    self->size = size + 2;
 
     // Read the first three characters, to check for a UTF-8 byte-order-mark
     read (f, buff, 3);
@@ -264,6 +309,7 @@ BOOL string_create_from_utf8_file (const char *filename,
       read (f, buff + 3, size - 3);
       self->str[size] = 0;
       }
+    self->length = strlen (buff);
 
     *result = self;
     ok = TRUE;
@@ -318,10 +364,24 @@ String *string_encode_url (const char *str)
 *==========================================================================*/
 void string_append_byte (String *self, const BYTE byte)
   {
-  char buff[2];
-  buff[0] = byte;
-  buff[1] = 0;
-  string_append (self, buff);
+  // A zero would end the string, so it can't be part of it
+  if (byte == 0) return;
+  if (self->length + 1 >= self->size)
+    string_reserve (self, 1);
+  self->str[self->length++] = byte;
+  self->str[self->length] = 0;
+  }
+
+
+/*==========================================================================
+  string_append_utf32_span
+  Append len code points as UTF-8, encoded all at once
+*==========================================================================*/
+void string_append_utf32_span (String *self, const uint32_t *s, int len)
+  {
+  string_reserve (self, len * ENCODE_UTF8_MAX);
+  self->length += encode_utf8 (s, len, self->str + self->length);
+  self->str[self->length] = 0;
   }
 
 
@@ -331,29 +391,20 @@ void string_append_byte (String *self, const BYTE byte)
 void string_append_c (String *self, const uint32_t ch)
   {
   if (ch < 0x80) 
-    {
     string_append_byte (self, (BYTE)ch);
-    }
-  else if (ch < 0x0800) 
-    {
-    string_append_byte (self, (BYTE)((ch >> 6) | 0xC0));
-    string_append_byte (self, (BYTE)((ch & 0x3F) | 0x80));
-    }
-  else if (ch < 0x10000) 
-    {
-    string_append_byte (self, (BYTE)((ch >> 12) | 0xE0));
-    string_append_byte (self, (BYTE)((ch >> 6 & 0x3F) | 0x80));
-    string_append_byte (self, (BYTE)((ch & 0x3F) | 0x80));
-    }
-  else 
-    {
-    string_append_byte (self, (BYTE)((ch >> 18) | 0xF0));
-    string_append_byte (self, (BYTE)(((ch >> 12) & 0x3F) | 0x80));
-    string_append_byte (self, (BYTE)(((ch >> 6) & 0x3F) | 0x80));
-    string_append_byte (self, (BYTE)((ch & 0x3F) | 0x80));
-    }
+  else
+    string_append_utf32_span (self, &ch, 1);
   }
 
 
+/*==========================================================================
+  string_clear
+  The buffer is kept, for the next text
+*==========================================================================*/
+void string_clear (String *self)
+  {
+  self->length = 0;
+  self->str[0] = 0;
+  }
 
 
@@ -200,6 +200,36 @@ int XML_get_registered_user_tag(TagType tag_type)
 	return -1;
 }
 
+/*
+ Set '*atom' to the atom given by 'fn' to the local part of qualified 'name' and '*ns_atom'
+ to the atom of its prefix ('XML_ATOM_NONE' when there is none).
+ */
+static void _atomize(const SXML_CHAR* name, XML_ATOM_FN fn, int* atom, int* ns_atom)
+{
+	const SXML_CHAR* colon;
+
+	*atom = *ns_atom = XML_ATOM_NONE;
+	if (fn == NULL || name == NULL)
+		return;
+	colon = sx_strchr(name, C2SX(':'));
+	if (colon == NULL) {
+		*atom = fn(name, sx_strlen(name));
+	} else {
+		*ns_atom = fn(name, colon - name);
+		*atom = fn(colon + 1, sx_strlen(colon + 1));
+	}
+}
+
+/* Set the atoms given by 'fn' to the tag and to all attributes of 'node'. */
+static void _XMLNode_atomize(XMLNode* node, XML_ATOM_FN fn)
+{
+	int i;
+
+	_atomize(node->tag, fn, &node->tag_atom, &node->ns_atom);
+	for (i = 0; i < node->n_attributes; i++)
+		_atomize(node->attributes[i].name, fn, &node->attributes[i].name_atom, &node->attributes[i].ns_atom);
+}
+
 /* --- XMLNode methods --- */
 
 /*
@@ -240,6 +270,8 @@ int XMLNode_init(XMLNode* node)
 	
 	node->tag_type = TAG_NONE;
 	node->active = true;
+	node->borrowed = 0;
+	node->tag_atom = node->ns_atom = XML_ATOM_NONE;
 
 	node->init_value = XML_INIT_DONE;
 
@@ -306,7 +338,8 @@ int XMLNode_free(XMLNode* node)
 	CHECK_NODE(node, false);
 	
 	if (node->tag != NULL) {
-		__free(node->tag);
+		if (!(node->borrowed & XML_BORROWED_TAG))
+			__free(node->tag);
 		node->tag = NULL;
 	}
 
@@ -315,6 +348,8 @@ int XMLNode_free(XMLNode* node)
 	XMLNode_remove_children(node);
 	
 	node->tag_type = TAG_NONE;
+	node->borrowed = 0;
+	node->tag_atom = node->ns_atom = XML_ATOM_NONE;
 
 	return true;
 }
@@ -337,6 +372,8 @@ int XMLNode_copy(XMLNode* dst, const XMLNode* src, int copy_children)
 		dst->tag = sx_strdup(src->tag);
 		if (dst->tag == NULL) goto copy_err;
 	}
+	dst->tag_atom = src->tag_atom;
+	dst->ns_atom = src->ns_atom;
 
 	/* Text */
 	if (dst->text != NULL) {
@@ -354,6 +391,8 @@ int XMLNode_copy(XMLNode* dst, const XMLNode* src, int copy_children)
 			dst->attributes[i].value = sx_strdup(src->attributes[i].value);
 			if (dst->attributes[i].name == NULL || dst->attributes[i].value == NULL) goto copy_err;
 			dst->attributes[i].active = src->attributes[i].active;
+			dst->attributes[i].name_atom = src->attributes[i].name_atom;
+			dst->attributes[i].ns_atom = src->attributes[i].ns_atom;
 		}
 	}
 
@@ -398,8 +437,10 @@ int XMLNode_set_tag(XMLNode* node, const SXML_CHAR* tag)
 	newtag = sx_strdup(tag);
 	if (newtag == NULL)
 		return false;
-	if (node->tag != NULL) __free(node->tag);
+	if (node->tag != NULL && !(node->borrowed & XML_BORROWED_TAG)) __free(node->tag);
 	node->tag = newtag;
+	node->borrowed &= ~XML_BORROWED_TAG;
+	node->tag_atom = node->ns_atom = XML_ATOM_NONE; /* There is no atom function outside of a parse */
 
 	return true;
 }
@@ -421,6 +462,37 @@ int XMLNode_set_type(XMLNode* node, const TagType tag_type)
 	}
 }
 
+/*
+ Take a private copy of attribute names and values that are slices of an in-situ parsed
+ buffer, so they can be freed individually.
+ Return 'false' for memory error.
+ */
+static int _XMLNode_own_attributes(XMLNode* node)
+{
+	int i;
+
+	if (!(node->borrowed & XML_BORROWED_ATTRS))
+		return true;
+
+	for (i = 0; i < node->n_attributes; i++) {
+		SXML_CHAR* name = sx_strdup(node->attributes[i].name);
+		SXML_CHAR* value = (node->attributes[i].value == NULL ? NULL : sx_strdup(node->attributes[i].value));
+		if (name == NULL || (value == NULL && node->attributes[i].value != NULL)) {
+			if (name != NULL)
+				__free(name);
+			/* Attributes [0..i[ are already owned: drop the others */
+			node->n_attributes = i;
+			node->borrowed &= ~XML_BORROWED_ATTRS;
+			return false;
+		}
+		node->attributes[i].name = name;
+		node->attributes[i].value = value;
+	}
+	node->borrowed &= ~XML_BORROWED_ATTRS;
+
+	return true;
+}
+
 int XMLNode_set_attribute(XMLNode* node, const SXML_CHAR* attr_name, const SXML_CHAR* attr_value)
 {
 	XMLAttribute* pt;
@@ -429,6 +501,9 @@ int XMLNode_set_attribute(XMLNode* node, const SXML_CHAR* attr_name, const SXML_
 	if (node == NULL || attr_name == NULL || attr_name[0] == NULC || node->init_value != XML_INIT_DONE)
 		return -1;
 	
+	if (!_XMLNode_own_attributes(node))
+		return -1;
+
 	i = XMLNode_search_attribute(node, attr_name, 0);
 	if (i >= 0) { /* Attribute found: update it */
 		SXML_CHAR* value = NULL;
@@ -460,6 +535,7 @@ int XMLNode_set_attribute(XMLNode* node, const SXML_CHAR* attr_name, const SXML_
 		pt[i].name = name;
 		pt[i].value = value;
 		pt[i].active = true;
+		pt[i].name_atom = pt[i].ns_atom = XML_ATOM_NONE;
 		node->attributes = pt;
 		node->n_attributes = i + 1;
 	}
@@ -526,6 +602,9 @@ int XMLNode_remove_attribute(XMLNode* node, int i_attr)
 	if (node == NULL || node->init_value != XML_INIT_DONE || i_attr < 0 || i_attr >= node->n_attributes)
 		return -1;
 	
+	if (!_XMLNode_own_attributes(node))
+		return -1;
+
 	/* Before modifying first see if we run out of memory */
 	if (node->n_attributes == 1)
 		pt = NULL;
@@ -558,7 +637,7 @@ int XMLNode_remove_all_attributes(XMLNode* node)
 	CHECK_NODE(node, false);
 
 	if (node->attributes != NULL) {
-		for (i = 0; i < node->n_attributes; i++) {
+		for (i = 0; i < node->n_attributes && !(node->borrowed & XML_BORROWED_ATTRS); i++) {
 			if (node->attributes[i].name != NULL)
 				__free(node->attributes[i].name);
 			if (node->attributes[i].value != NULL)
@@ -568,6 +647,7 @@ int XMLNode_remove_all_attributes(XMLNode* node)
 		node->attributes = NULL;
 	}
 	node->n_attributes = 0;
+	node->borrowed &= ~XML_BORROWED_ATTRS;
 
 	return true;
 }
@@ -579,9 +659,11 @@ int XMLNode_set_text(XMLNode* node, const SXML_CHAR* text)
 
 	if (text == NULL) { /* We want to remove it => free node text */
 		if (node->text != NULL) {
-			__free(node->text);
+			if (!(node->borrowed & XML_BORROWED_TEXT))
+				__free(node->text);
 			node->text = NULL;
 		}
+		node->borrowed &= ~XML_BORROWED_TEXT;
 
 		return true;
 	}
@@ -589,9 +671,10 @@ int XMLNode_set_text(XMLNode* node, const SXML_CHAR* text)
 	p = sx_strdup(text);
 	if (p == NULL)
 		return false;
-	if (node->text != NULL)
+	if (node->text != NULL && !(node->borrowed & XML_BORROWED_TEXT))
 		__free(node->text);
 	node->text = p;
+	node->borrowed &= ~XML_BORROWED_TEXT;
 
 	return true;
 }
@@ -872,6 +955,7 @@ int XMLDoc_init(XMLDoc* doc)
 	doc->nodes = NULL;
 	doc->n_nodes = 0;
 	doc->i_root = -1;
+	doc->atom_fn = NULL;
 	doc->init_value = XML_INIT_DONE;
 
 	return true;
@@ -1174,6 +1258,7 @@ int XML_parse_attribute_to(const SXML_CHAR* str, int to, XMLAttribute* xmlattr)
 		/* Copy name */
 		sx_strncpy(xmlattr->name, str, n0);
 		xmlattr->name[n0] = NULC;
+		xmlattr->name_atom = xmlattr->ns_atom = XML_ATOM_NONE; /* Set by the parse, from its atom function */
 		/* (void)str_unescape(xmlattr->name); do not unescape the name */
 		/* Copy value (p starts after the quote (if any) and stops at the end of 'str'
 		  (skipping the quote if any, hence the '*(p+remQ)') */
@@ -1287,6 +1372,7 @@ TagType XML_parse_1string(const SXML_CHAR* str, XMLNode* xmlnode)
 		return TAG_ERROR;
 	sx_strncpy(xmlnode->tag, &str[1 + tag_end], n - 1 - tag_end);
 	xmlnode->tag[n - 1 - tag_end] = NULC;
+	xmlnode->tag_atom = xmlnode->ns_atom = XML_ATOM_NONE; /* Set by the parse, from its atom function */
 	if (tag_end) {
 		xmlnode->tag_type = TAG_END;
 		return TAG_END;
@@ -1317,6 +1403,7 @@ TagType XML_parse_1string(const SXML_CHAR* str, XMLNode* xmlnode)
 		pt[xmlnode->n_attributes].name = NULL;
 		pt[xmlnode->n_attributes].value = NULL;
 		pt[xmlnode->n_attributes].active = false;
+		pt[xmlnode->n_attributes].name_atom = pt[xmlnode->n_attributes].ns_atom = XML_ATOM_NONE;
 		xmlnode->n_attributes++;
 		xmlnode->attributes = pt;
 		while (*++p != NULC && sx_isspace(*p)) ; /* Skip spaces */
@@ -1354,11 +1441,33 @@ parse_err:
 	return TAG_ERROR;
 }
 
+/*
+ Called when the 'on_error()' callback asked to go on after the malformed tag 'str' (e.g. an unescaped '<' in text).
+ Passes what comes before the last '<' in 'str' on as text, and returns that '<' so the tag is parsed again from there.
+ Returns NULL when there is no other '<' (the malformed tag is skipped) or when a callback asked to stop ('*exit' is set).
+ */
+static SXML_CHAR* _SAX_recover_tag(SXML_CHAR* str, XMLNode* node, const SAX_Callbacks* sax, SAX_Data* sd, int* exit)
+{
+	SXML_CHAR* p = sx_strrchr(str + 1, C2SX('<'));
+
+	(void)XMLNode_free(node);
+	if (p == NULL)
+		return NULL;
+	*p = NULC;
+	if (sax->new_text != NULL && !sax->new_text(str, sd))
+		*exit = true;
+	else if (sax->all_event != NULL && !sax->all_event(XML_EVENT_TEXT, NULL, str, sd->line_num, sd))
+		*exit = true;
+	*p = C2SX('<');
+
+	return *exit ? NULL : p;
+}
+
 static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Callbacks* sax, SAX_Data* sd)
 {
 	SXML_CHAR *line = NULL, *txt_end, *p;
 	XMLNode node;
-	int ret, exit, sz, n0, ncr;
+	int ret, exit, sz, n0, ncr, tag_pos;
 	TagType tag_type;
 	int (*meos)(void* ds) = (in_type == DATA_SOURCE_BUFFER ? (int(*)(void*))_beob : (int(*)(void*))sx_feof);
 
@@ -1420,6 +1529,8 @@ static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Cal
 		}
 		*txt_end = '<'; /* Restores tag start */
 
+parse_tag:
+		tag_pos = (int)(txt_end - line);
 		switch (tag_type = XML_parse_1string(txt_end, &node)) {
 			case TAG_ERROR: /* Memory error */
 				ret = false;
@@ -1430,6 +1541,12 @@ static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Cal
 						break;
 					if (sax->all_event != NULL && (exit = !sax->all_event(XML_EVENT_ERROR, NULL, (SXML_CHAR*)sd->name, PARSE_ERR_MEMORY, sd)))
 						break;
+					/* 'on_error()' asked to go on: a malformed tag is also reported here */
+					if (sax->on_error != NULL) {
+						ret = true;
+						if ((txt_end = _SAX_recover_tag(txt_end, &node, sax, sd, &exit)) != NULL)
+							goto parse_tag;
+					}
 				}
 				break;
 		
@@ -1443,14 +1560,22 @@ static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Cal
 					if (p != NULL)
 						*p = C2SX('\n');
 				} else {
+					if (p != NULL)
+						*p = C2SX('\n');
 					if (sax->on_error != NULL && (exit = !sax->on_error(PARSE_ERR_SYNTAX, sd->line_num, sd)))
 						break;
 					if (sax->all_event != NULL && (exit = !sax->all_event(XML_EVENT_ERROR, NULL, (SXML_CHAR*)sd->name, PARSE_ERR_SYNTAX, sd)))
 						break;
+					if (sax->on_error != NULL) {
+						ret = true;
+						if ((txt_end = _SAX_recover_tag(txt_end, &node, sax, sd, &exit)) != NULL)
+							goto parse_tag;
+					}
 				}
 				break;
 
 			case TAG_END:
+				_XMLNode_atomize(&node, sax->atom_fn);
 				if (sax->end_node != NULL || sax->all_event != NULL) {
 					if (sax->end_node != NULL && (exit = !sax->end_node(&node, sd)))
 						break;
@@ -1477,7 +1602,7 @@ static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Cal
 						break;
 					}
 					n0 = n1;
-					txt_end = sx_strchr(line, C2SX('<')); /* In case 'line' has been moved by the '__realloc' in 'read_line_alloc' */
+					txt_end = line + tag_pos; /* In case 'line' has been moved by the '__realloc' in 'read_line_alloc' */
 					tag_type = XML_parse_1string(txt_end, &node);
 					if (tag_type == TAG_ERROR) {
 						ret = false;
@@ -1494,6 +1619,7 @@ static int _parse_data_SAX(void* in, const DataSourceType in_type, const SAX_Cal
 				}
 				if (ret == false)
 					break;
+				_XMLNode_atomize(&node, sax->atom_fn);
 				if (sax->start_node != NULL && (exit = !sax->start_node(&node, sd)))
 					break;
 				if (sax->all_event != NULL && (exit = !sax->all_event(XML_EVENT_START_NODE, &node, NULL, sd->line_num, sd)))
@@ -1534,6 +1660,7 @@ int SAX_Callbacks_init(SAX_Callbacks* sax)
 	sax->on_error = NULL;
 	sax->end_doc = NULL;
 	sax->all_event = NULL;
+	sax->atom_fn = NULL;
 
 	return true;
 }
@@ -1707,6 +1834,7 @@ int SAX_Callbacks_init_DOM(SAX_Callbacks* sax)
 	sax->on_error = DOMXMLDoc_parse_error;
 	sax->end_doc = DOMXMLDoc_doc_end;
 	sax->all_event = NULL;
+	sax->atom_fn = NULL;
 
 	return true;
 }
@@ -1813,6 +1941,7 @@ int XMLDoc_parse_file_DOM_text_as_nodes(const SXML_CHAR* filename, XMLDoc* doc,
 	dom.current = NULL;
 	dom.text_as_nodes = text_as_nodes;
 	SAX_Callbacks_init_DOM(&sax);
+	sax.atom_fn = doc->atom_fn;
 
 	ret = XMLDoc_parse_file_SAX(filename, &sax, &dom);
 	if (!ret) {
@@ -1838,6 +1967,7 @@ int XMLDoc_parse_buffer_DOM_text_as_nodes(const SXML_CHAR* buffer, const SXML_CH
 	dom.current = NULL;
 	dom.text_as_nodes = text_as_nodes;
 	SAX_Callbacks_init_DOM(&sax);
+	sax.atom_fn = doc->atom_fn;
 
 	ret = XMLDoc_parse_buffer_SAX(buffer, name, &sax, &dom);
 	if (!ret) {
@@ -1850,6 +1980,315 @@ int XMLDoc_parse_buffer_DOM_text_as_nodes(const SXML_CHAR* buffer, const SXML_CH
 }
 
 
+/*
+ Count lines up to 'p', for error messages of the in-situ parser. As some
+ characters might have been overwritten by '\0' already, this is approximate.
+ */
+static int _in_situ_line(const SXML_CHAR* buffer, const SXML_CHAR* p)
+{
+	int n = 1;
+
+	for (; buffer < p; buffer++)
+		if (*buffer == C2SX('\n')) n++;
+
+	return n;
+}
+
+/*
+ Add 'node' to the document being built in-situ, as a child of 'dom->current' or as a
+ document node. Return 'false' for memory error.
+ */
+static int _in_situ_add_node(DOM_through_SAX* dom, XMLNode* node)
+{
+	int i;
+
+	if (dom->current == NULL) {
+		if ((i = _add_node(&dom->doc->nodes, &dom->doc->n_nodes, node)) < 0)
+			return false;
+		if (dom->doc->i_root < 0 && (node->tag_type == TAG_FATHER || node->tag_type == TAG_SELF))
+			dom->doc->i_root = i;
+	} else {
+		if (_add_node(&dom->current->children, &dom->current->n_children, node) < 0)
+			return false;
+	}
+	node->father = dom->current;
+
+	return true;
+}
+
+/*
+ Add 'text' (a slice of the buffer) to the current node text. The first text of a node
+ is kept in-situ, further ones are concatenated into an allocated string as
+ 'DOMXMLDoc_node_text()' does.
+ */
+static int _in_situ_text(DOM_through_SAX* dom, SXML_CHAR* text)
+{
+	XMLNode* node = dom->current;
+	SXML_CHAR* p;
+	int l0, l1;
+
+	if (node == NULL) {
+		for (p = text; *p != NULC && sx_isspace(*p); p++) ;
+		if (*p == NULC) /* Only spaces => probably pretty-printing */
+			return true;
+		dom->error = PARSE_ERR_TEXT_OUTSIDE_NODE;
+		return false;
+	}
+
+	if (node->text == NULL) {
+		node->text = text;
+		node->borrowed |= XML_BORROWED_TEXT;
+		return true;
+	}
+
+	l0 = sx_strlen(node->text);
+	l1 = sx_strlen(text);
+	if (node->borrowed & XML_BORROWED_TEXT) {
+		p = __malloc((l0 + l1 + 1)*sizeof(SXML_CHAR));
+		if (p != NULL)
+			memcpy(p, node->text, l0*sizeof(SXML_CHAR));
+	} else
+		p = __realloc(node->text, (l0 + l1 + 1)*sizeof(SXML_CHAR));
+	if (p == NULL) {
+		dom->error = PARSE_ERR_MEMORY;
+		return false;
+	}
+	memcpy(p + l0, text, (l1 + 1)*sizeof(SXML_CHAR));
+	node->text = p;
+	node->borrowed &= ~XML_BORROWED_TEXT;
+
+	return true;
+}
+
+/*
+ Parse the special tag starting at 's' (just after its '<'), whose start string is 'len_start'
+ characters long and which ends with 'end'. Return a pointer after its end, or NULL if the end
+ could not be found.
+ */
+static SXML_CHAR* _in_situ_special(DOM_through_SAX* dom, SXML_CHAR* s, int len_start, const SXML_CHAR* end, TagType tag_type)
+{
+	SXML_CHAR* e = sx_strstr(s + len_start, end);
+	XMLNode* node;
+
+	if (e == NULL) {
+		dom->error = PARSE_ERR_EOF;
+		return NULL;
+	}
+	if ((node = XMLNode_alloc()) == NULL) {
+		dom->error = PARSE_ERR_MEMORY;
+		return NULL;
+	}
+	*e = NULC;
+	node->tag = s + len_start;
+	node->tag_type = tag_type;
+	node->borrowed = XML_BORROWED_TAG;
+	if (!_in_situ_add_node(dom, node)) {
+		(void)XMLNode_free(node);
+		__free(node);
+		dom->error = PARSE_ERR_MEMORY;
+		return NULL;
+	}
+
+	return e + sx_strlen(end);
+}
+
+/*
+ Parse the element tag starting at 's' (just after its '<'): '<tag (attribName="attribValue")* [/]>'.
+ Return a pointer after its '>', or NULL on error.
+ */
+static SXML_CHAR* _in_situ_element(DOM_through_SAX* dom, SXML_CHAR* s)
+{
+	SXML_CHAR *q, *name, *value, *pending = NULL;
+	SXML_CHAR quote;
+	XMLAttribute* pt;
+	XMLNode* node;
+	int i;
+
+	if ((node = XMLNode_alloc()) == NULL) {
+		dom->error = PARSE_ERR_MEMORY;
+		return NULL;
+	}
+	node->tag = s;
+	node->borrowed = XML_BORROWED_TAG | XML_BORROWED_ATTRS;
+
+	/* Names and values are terminated as soon as their end has been passed, except when
+	   their end is the '>' or '/' closing the tag, which are terminated afterwards ('pending') */
+	for (q = s; *q != NULC && *q != C2SX('>') && *q != C2SX('/') && !sx_isspace(*q); q++) ;
+	if (sx_isspace(*q))
+		*q++ = NULC;
+	else
+		pending = q;
+
+	for (;;) {
+		while (sx_isspace(*q)) q++;
+		if (*q == C2SX('>')) {
+			node->tag_type = TAG_FATHER;
+			break;
+		}
+		if (*q == C2SX('/')) {
+			for (q++; sx_isspace(*q); q++) ;
+			if (*q != C2SX('>')) goto syntax_err;
+			node->tag_type = TAG_SELF;
+			break;
+		}
+		if (*q == NULC) goto eof_err;
+
+		/* New attribute: 'name[ ]=[ ]["]value["]' */
+		name = q;
+		while (*q != NULC && *q != C2SX('=') && *q != C2SX('>') && *q != C2SX('/') && !sx_isspace(*q)) q++;
+		value = q;
+		while (sx_isspace(*q)) q++;
+		if (*q != C2SX('=')) goto syntax_err;
+		for (q++; sx_isspace(*q); q++) ;
+		*value = NULC; /* Terminate name */
+		if (isquote(*q)) {
+			quote = *q++;
+			value = q;
+			if ((q = sx_strchr(q, quote)) == NULL) goto eof_err;
+			*q++ = NULC;
+		} else {
+			value = q;
+			while (*q != NULC && *q != C2SX('>') && *q != C2SX('/') && !sx_isspace(*q)) q++;
+			if (*q == NULC) goto eof_err;
+			if (sx_isspace(*q))
+				*q++ = NULC;
+			else
+				pending = q;
+		}
+
+		pt = __realloc(node->attributes, (node->n_attributes + 1) * sizeof(XMLAttribute));
+		if (pt == NULL) {
+			dom->error = PARSE_ERR_MEMORY;
+			goto err;
+		}
+		pt[node->n_attributes].name = name;
+		pt[node->n_attributes].value = value;
+		pt[node->n_attributes].active = true;
+		node->attributes = pt;
+		node->n_attributes++;
+	}
+	if (pending != NULL)
+		*pending = NULC;
+	*q++ = NULC; /* Skip '>' */
+	_XMLNode_atomize(node, dom->doc->atom_fn);
+
+	/* Convert HTML escape sequences, only when there are some */
+	for (i = 0; i < node->n_attributes; i++)
+		if (sx_strchr(node->attributes[i].value, C2SX('&')) != NULL)
+			(void)html2str(node->attributes[i].value, NULL);
+
+	if (!_in_situ_add_node(dom, node)) {
+		dom->error = PARSE_ERR_MEMORY;
+		goto err;
+	}
+	if (node->tag_type == TAG_FATHER)
+		dom->current = node;
+
+	return q;
+
+eof_err:
+	dom->error = PARSE_ERR_EOF;
+	goto err;
+syntax_err:
+	dom->error = PARSE_ERR_SYNTAX;
+err:
+	(void)XMLNode_free(node);
+	__free(node);
+
+	return NULL;
+}
+
+/*
+ Parse the end tag starting at 's' (just after its '</'). Return a pointer after its '>',
+ or NULL on error.
+ */
+static SXML_CHAR* _in_situ_end(DOM_through_SAX* dom, SXML_CHAR* s, SAX_Data* sd)
+{
+	SXML_CHAR* q;
+	XMLNode node;
+
+	for (q = s; *q != NULC && *q != C2SX('>') && !sx_isspace(*q); q++) ;
+	if (*q != C2SX('>')) {
+		*q++ = NULC;
+		if ((q = sx_strchr(q, C2SX('>'))) == NULL) {
+			dom->error = PARSE_ERR_EOF;
+			return NULL;
+		}
+	}
+	*q++ = NULC;
+
+	/* Let the DOM callback check that the end tag matches the current node */
+	node.init_value = 0;
+	(void)XMLNode_init(&node);
+	node.tag = s;
+	node.tag_type = TAG_END;
+	return DOMXMLDoc_node_end(&node, sd) ? q : NULL;
+}
+
+int XMLDoc_parse_buffer_DOM_in_situ(SXML_CHAR* buffer, const SXML_CHAR* name, XMLDoc* doc)
+{
+	DOM_through_SAX dom;
+	SAX_Data sd;
+	SXML_CHAR *p, *tag, *q;
+
+	if (doc == NULL || buffer == NULL || doc->init_value != XML_INIT_DONE)
+		return false;
+
+	dom.doc = doc;
+	dom.text_as_nodes = false;
+	sd.name = name;
+	sd.user = &dom;
+	sd.type = DATA_SOURCE_BUFFER;
+	sd.src = (void*)buffer;
+	sd.line_num = 1;
+	(void)DOMXMLDoc_doc_start(&sd);
+
+	for (p = buffer; *p != NULC; ) {
+		/* Text for the current node is what is before '<' */
+		if ((tag = sx_strchr(p, C2SX('<'))) == NULL) {
+			(void)_in_situ_text(&dom, p);
+			break;
+		}
+		if (tag > p) {
+			*tag = NULC;
+			if (!_in_situ_text(&dom, p))
+				break;
+		}
+		p = ++tag;
+
+		if (*tag == C2SX('/')) {
+			sd.line_num = _in_situ_line(buffer, tag);
+			p = _in_situ_end(&dom, tag + 1, &sd);
+		} else if (*tag == C2SX('?'))
+			p = _in_situ_special(&dom, tag, 1, C2SX("?>"), TAG_INSTR);
+		else if (!sx_strncmp(tag, C2SX("!--"), 3))
+			p = _in_situ_special(&dom, tag, 3, C2SX("-->"), TAG_COMMENT);
+		else if (!sx_strncmp(tag, C2SX("![CDATA["), 8))
+			p = _in_situ_special(&dom, tag, 8, C2SX("]]>"), TAG_CDATA);
+		else if (!sx_strncmp(tag, C2SX("!DOCTYPE"), 8)) {
+			/* A '[' inside the DOCTYPE means that it ends with "]>" */
+			for (q = tag + 8; *q != NULC && *q != C2SX('>') && *q != C2SX('['); q++) ;
+			p = _in_situ_special(&dom, tag, 8, *q == C2SX('[') ? C2SX("]>") : C2SX(">"), TAG_DOCTYPE);
+		} else
+			p = _in_situ_element(&dom, tag);
+
+		if (p == NULL) {
+			p = tag;
+			break;
+		}
+	}
+
+	if (dom.error != PARSE_ERR_NONE) {
+		if (dom.line_error == 0)
+			dom.line_error = _in_situ_line(buffer, p);
+		(void)DOMXMLDoc_doc_end(&sd); /* Reports the error and frees 'doc' */
+		return false;
+	}
+
+	/* TODO: Check there is no unfinished root nodes */
+	return true;
+}
+
 
 /* --- Utility functions (ex sxmlutils.c) --- */
 
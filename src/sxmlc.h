@@ -53,6 +53,7 @@ extern "C" {
 	#define sx_strlen wcslen
 	#define sx_strdup wcsdup
 	#define sx_strchr wcschr
+	#define sx_strstr wcsstr
 	#define sx_strrchr wcsrchr
 	#define sx_strcpy wcscpy
 	#define sx_strncpy wcsncpy
@@ -81,6 +82,7 @@ extern "C" {
 	#define sx_strlen strlen
 	#define sx_strdup __sx_strdup
 	#define sx_strchr strchr
+	#define sx_strstr strstr
 	#define sx_strrchr strrchr
 	#define sx_strcpy strcpy
 	#define sx_strncpy strncpy
@@ -191,8 +193,32 @@ typedef struct _XMLAttribute {
 	SXML_CHAR* name;	/**< The attribute name. */
 	SXML_CHAR* value;	/**< The attribute value. */
 	int active;			/**< `true` if the attribute is active. */
+	int name_atom;		/**< Atom of the name without its namespace prefix (see `XML_ATOM_FN`). */
+	int ns_atom;		/**< Atom of the namespace prefix, `XML_ATOM_NONE` if there is none. */
 } XMLAttribute;
 
+/**
+ * \brief Flags for `XMLNode.borrowed`, telling which strings of a node point into a buffer
+ * parsed in-situ (see `XMLDoc_parse_buffer_DOM_in_situ()`) and must not be freed.
+ */
+#define XML_BORROWED_TAG	0x01	/**< `node->tag` is a slice of the parsed buffer. */
+#define XML_BORROWED_TEXT	0x02	/**< `node->text` is a slice of the parsed buffer. */
+#define XML_BORROWED_ATTRS	0x04	/**< All attribute names and values are slices of the parsed buffer. */
+
+/**
+ * \brief Function mapping a name (not NUL-terminated) to a non-zero "atom" integer,
+ * or `XML_ATOM_NONE` when the name is not part of the application vocabulary.
+ *
+ * Given as the `atom_fn` member of the `XMLDoc` or `SAX_Callbacks` of a parse, it sets the
+ * `tag_atom` and `ns_atom` members of the nodes parsed (and those of their attributes), so
+ * that applications can dispatch on integers rather than on strings. Qualified names
+ * (`prefix:name`) are split, so that `opf:spine` and `spine` share the same `tag_atom`.
+ * Nodes and attributes named by `XMLNode_set_tag()` or `XMLNode_set_attribute()` have no atoms.
+ */
+typedef int (*XML_ATOM_FN)(const SXML_CHAR* name, int len);
+
+#define XML_ATOM_NONE 0	/**< Atom of names the atom function does not know. */
+
 /* Constant to know whether a struct has been initialized (XMLNode or XMLDoc)
  * TODO: Find a better way. */
 #define XML_INIT_DONE 0x19770522 /* Happy Birthday ;) */
@@ -228,6 +254,9 @@ typedef struct _XMLNode {
 	
 	TagType tag_type;			/**< Node type. */
 	int active;					/**< 'true' to tell that node is active and should be displayed by 'XMLDoc_print_*()'. */
+	int borrowed;				/**< `XML_BORROWED_*` flags for strings not owned by the node. */
+	int tag_atom;				/**< Atom of the tag without its namespace prefix (see `XML_ATOM_FN`). */
+	int ns_atom;				/**< Atom of the tag namespace prefix, `XML_ATOM_NONE` if there is none. */
 
 	void* user;	/**< Pointer for user data associated to the node. */
 
@@ -270,6 +299,7 @@ typedef struct _XMLDoc {
 	XMLNode** nodes;		/* Nodes of the document, including prolog, comments and root nodes */
 	int n_nodes;			/* Number of nodes in 'nodes' */
 	int i_root;				/* Index of first root node in 'nodes', -1 if document is empty */
+	XML_ATOM_FN atom_fn;	/**< Atom function for the nodes parsed, `NULL` (the default) for none. */
 
 	/* Keep 'init_value' as the last member */
 	int init_value;	/* Initialized to 'XML_INIT_DONE' to indicate that document has been initialized properly */
@@ -400,6 +430,9 @@ typedef struct _SAX_Callbacks {
 	 * \brief Callback called when an error occurs during parsing.
 	 * \param error_num is the error number
 	 * \param line_number is the line number in the stream being read (file or buffer).
+	 *
+	 * Parsing stops when it returns 0. Otherwise a malformed tag is skipped: what comes before
+	 * its last '<' (e.g. an unescaped '<' in text) is passed on as text, and parsing goes on from there.
 	 */
 	int (*on_error)(ParseError error_num, int line_number, SAX_Data* sd);
 
@@ -433,6 +466,11 @@ typedef struct _SAX_Callbacks {
 	 	 	 - `n` is the number of lines parsed.
 	 */
 	int (*all_event)(XMLEvent event, const XMLNode* node, SXML_CHAR* text, const int n, SAX_Data* sd);
+
+	/**
+	 * \brief Atom function for the nodes given to the callbacks (see `XML_ATOM_FN`), `NULL` for none.
+	 */
+	XML_ATOM_FN atom_fn;
 } SAX_Callbacks;
 
 /**
@@ -897,6 +935,22 @@ int XMLDoc_parse_buffer_DOM_text_as_nodes(const SXML_CHAR* buffer, const SXML_CH
  */
 #define XMLDoc_parse_buffer_DOM(buffer, name, doc) XMLDoc_parse_buffer_DOM_text_as_nodes(buffer, name, doc, 0)
 
+/**
+ * \brief Parse a memory buffer into an initialized document (DOM mode), *in-situ*.
+ *
+ * Unlike `XMLDoc_parse_buffer_DOM()`, no string is copied: tag names, attribute names and values
+ * and texts are null-terminated slices of `buffer`, which is modified during parsing and must
+ * therefore outlive `doc`. Attribute values are unescaped in place, and only when they contain
+ * a `&`. Texts are not unescaped, as with `XMLDoc_parse_buffer_DOM()`.
+ * Nodes of the resulting document can still be modified with the `XMLNode_set_*()` functions,
+ * which take a private copy of the strings they replace when needed.
+ * \param buffer The memory buffer to parse. It is modified.
+ * \param name The buffer name (to identify several buffers if run concurrently).
+ * \param doc The document to parse into.
+ * \return `false` in case of error (memory or malformed document), `true` otherwise.
+ */
+int XMLDoc_parse_buffer_DOM_in_situ(SXML_CHAR* buffer, const SXML_CHAR* name, XMLDoc* doc);
+
 /**
  * \brief Parse an XML file, calling SAX callbacks.
  * \param filename The file to parse.
@@ -33,6 +33,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include "sxmlc.h"
 #include "sxmlsearch.h"
 
@@ -322,7 +323,9 @@ static int _init_search_from_1XPath(SXML_CHAR* xpath, XMLSearch* search)
 	XMLSearch_init(search);
 
 	/* Look for tag name */
-	for (p = xpath; *p != NULC && *p != C2SX('['); p++) ;
+	for (p = xpath; *p != NULC && *p != C2SX('[') && *p != C2SX(']'); p++) ;
+	if (*p == C2SX(']')) /* ']' without '[' */
+		return false;
 	c = *p; /* Either '[' or '\0' */
 	*p = NULC;
 	ret = XMLSearch_search_set_tag(search, xpath);
@@ -335,6 +338,8 @@ static int _init_search_from_1XPath(SXML_CHAR* xpath, XMLSearch* search)
 
 	/* Here, '*p' is '[', we have to parse either text or attribute names/values until ']' */
 	for (p++; *p && *p != C2SX(']'); p++) {
+		if (sx_isspace(*p))
+			continue; /* Spaces before a predicate */
 		for (q = p; *q && *q != C2SX(',') && *q != C2SX(']'); q++) ; /* Look for potential ',' separator to null it */
 		cc = *q;
 		if (*q == C2SX(',') || *q == C2SX(']'))
@@ -348,7 +353,6 @@ static int _init_search_from_1XPath(SXML_CHAR* xpath, XMLSearch* search)
 				p[r1+1] = NULC;
 				ret = XMLSearch_search_set_text(search, &p[r0]);
 				p[r1+1] = c;
-				p += r1+1;
 				break;
 
 			/* Attribute name, possibly '@attrib[[ ]=[ ]"value"]' */
@@ -362,17 +366,24 @@ static int _init_search_from_1XPath(SXML_CHAR* xpath, XMLSearch* search)
 				ret = (XMLSearch_search_add_attribute(search, &p[l0], (is < 0 ? NULL : &p[r0]), true) < 0 ? false : true); /* 'is' < 0 when there is no '=' (i.e. check for attribute presence only */
 				p[l1+1] = c;
 				p[r1+1] = c1;
-				p += r1-1; /* Jump to next value */
 				break;
 
 			default: /* Not implemented */
+				ret = false;
 				break;
 		}
 		*q = cc; /* Restore ',' separator if any */
 		if (!ret)
 			return false;
+		p = q; /* Jump to next value, if the predicate ends with ',' */
+		if (*p != C2SX(','))
+			break;
 	}
 
+	/* Missing ']', or something after it */
+	if (*p != C2SX(']') || p[1] != NULC)
+		return false;
+
 	return true;
 }
 
@@ -405,7 +416,10 @@ int XMLSearch_init_from_XPath(const SXML_CHAR* xpath, XMLSearch* search)
 		/* Skip all first '/' */
 		for (; *tag != NULC && *tag == C2SX('/'); tag++) ;
 		if (*tag == NULC) {
+			if (search2 != search)
+				__free(search2);
 			__free(tag0);
+			(void)XMLSearch_free(search, true);
 			return false;
 		}
 
@@ -417,6 +431,10 @@ int XMLSearch_init_from_XPath(const SXML_CHAR* xpath, XMLSearch* search)
 		c = *p; /* Backup character before nulling it */
 		*p = NULC;
 		if (!_init_search_from_1XPath(tag, search2)) {
+			if (search2 != search) { /* Not linked to 'search' yet */
+				(void)XMLSearch_free(search2, false);
+				__free(search2);
+			}
 			__free(tag0);
 			(void)XMLSearch_free(search, true);
 			return false;
@@ -0,0 +1,25 @@
+/*============================================================================
+  epub2txt v2 
+  translit.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include <stddef.h>
+#include "translit.h"
+#include "translit_table.h"
+
+#define TRANSLIT_BLOCK_MASK ((1u << TRANSLIT_BLOCK_BITS) - 1)
+
+/*============================================================================
+  translit_ascii
+  Most blocks of the BMP have no replacements, and share an empty block
+    of the table
+============================================================================*/
+const char *translit_ascii (uint32_t c)
+  {
+  if (c >= 0x10000) return NULL;
+  unsigned short offset = translit_blocks
+    [translit_index[c >> TRANSLIT_BLOCK_BITS]][c & TRANSLIT_BLOCK_MASK];
+  return offset ? translit_pool + offset : NULL;
+  }
+
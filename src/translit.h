@@ -0,0 +1,19 @@
+/*============================================================================
+  epub2txt v2 
+  translit.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  ASCII replacements for non-ASCII characters, for --ascii. The table
+  is generated by tools/mktranslit.py, into translit_table.h, and covers
+  the Latin letters, punctuation, ligatures and common symbols. 
+============================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+/** The ASCII text that should replace c, which may be empty, or NULL if
+    there is no replacement. The result is static. */
+const char *translit_ascii (uint32_t c);
+
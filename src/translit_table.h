@@ -0,0 +1,388 @@
+/* Generated by tools/mktranslit.py -- do not edit */
+
+#pragma once
+
+#define TRANSLIT_BLOCK_BITS 7
+#define TRANSLIT_BLOCKS 15
+
+// (Code point >> TRANSLIT_BLOCK_BITS) -> block, for the BMP
+static const unsigned char translit_index[512] =
+  {
+  0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0,
+  9, 10, 11, 12, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  };
+
+// Block, low bits -> offset in translit_pool, 0 for none
+static const unsigned short translit_blocks[15][128] =
+  {
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 4, 385, 233, 0, 262, 537, 309, 1, 46, 370, 173, 60, 1, 37, 60,
+  397, 54, 122, 132, 20, 506, 300, 65, 58, 80, 476, 191, 98, 90, 134, 194,
+  202, 202, 202, 202, 202, 202, 204, 209, 219, 219, 219, 219, 242, 242, 242, 242,
+  211, 278, 289, 289, 289, 289, 289, 524, 289, 326, 326, 326, 326, 353, 323, 495,
+  370, 370, 370, 370, 370, 370, 380, 385, 414, 414, 414, 414, 442, 442, 442, 442,
+  395, 471, 476, 476, 476, 476, 476, 74, 476, 506, 506, 506, 506, 533, 503, 533
+  },
+  {
+  202, 370, 202, 370, 202, 370, 209, 385, 209, 385, 209, 385, 209, 385, 211, 395,
+  211, 395, 219, 414, 219, 414, 219, 414, 219, 414, 219, 414, 231, 435, 231, 435,
+  231, 435, 231, 435, 237, 437, 237, 437, 242, 442, 242, 442, 242, 442, 242, 442,
+  242, 442, 251, 451, 260, 460, 266, 462, 462, 268, 464, 268, 464, 268, 464, 268,
+  464, 268, 464, 278, 471, 278, 471, 278, 471, 34, 278, 471, 289, 476, 289, 476,
+  289, 476, 291, 478, 304, 491, 304, 491, 304, 491, 309, 493, 309, 493, 309, 493,
+  309, 493, 317, 501, 317, 501, 317, 501, 326, 506, 326, 506, 326, 506, 326, 506,
+  326, 506, 326, 506, 342, 522, 353, 533, 353, 355, 535, 355, 535, 355, 535, 493
+  },
+  {
+  383, 207, 207, 383, 0, 0, 0, 209, 385, 0, 211, 211, 395, 0, 0, 0,
+  0, 225, 416, 231, 0, 439, 0, 242, 266, 462, 464, 0, 0, 278, 471, 289,
+  289, 476, 294, 481, 300, 487, 0, 0, 0, 0, 0, 501, 317, 501, 317, 326,
+  506, 0, 328, 353, 533, 355, 535, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 213, 216, 411, 270, 273, 466, 280, 283, 473, 202, 370, 242,
+  442, 289, 476, 326, 506, 326, 506, 326, 506, 326, 506, 326, 506, 0, 202, 370,
+  202, 370, 204, 380, 231, 435, 231, 435, 266, 462, 289, 476, 289, 476, 0, 0,
+  460, 213, 216, 411, 231, 435, 239, 342, 278, 471, 202, 370, 204, 380, 289, 476
+  },
+  {
+  202, 370, 202, 370, 219, 414, 219, 414, 242, 442, 242, 442, 289, 476, 289, 476,
+  304, 491, 304, 491, 326, 506, 326, 506, 309, 493, 317, 501, 353, 533, 237, 437,
+  278, 395, 297, 484, 355, 535, 202, 370, 219, 414, 289, 476, 289, 476, 289, 476,
+  289, 476, 353, 533, 464, 471, 501, 460, 0, 0, 202, 209, 385, 268, 317, 493,
+  535, 0, 0, 207, 0, 0, 219, 414, 260, 460, 0, 489, 304, 491, 353, 533,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  437, 437, 460, 491, 0, 0, 0, 522, 533, 20, 15, 20, 20, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 357, 0, 20, 0, 0, 361, 0, 359, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 542, 2, 0, 0,
+  0, 464, 493, 524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  202, 370, 207, 383, 207, 383, 207, 383, 209, 385, 211, 395, 211, 395, 211, 395,
+  211, 395, 211, 395, 219, 414, 219, 414, 219, 414, 219, 414, 219, 414, 225, 416,
+  231, 435, 237, 437, 237, 437, 237, 437, 237, 437, 237, 437, 242, 442, 242, 442,
+  266, 462, 266, 462, 266, 462, 268, 464, 268, 464, 268, 464, 268, 464, 276, 469,
+  276, 469, 276, 469, 278, 471, 278, 471, 278, 471, 278, 471, 289, 476, 289, 476,
+  289, 476, 289, 476, 300, 487, 300, 487, 304, 491, 304, 491, 304, 491, 304, 491,
+  309, 493, 309, 493, 309, 493, 309, 493, 309, 493, 317, 501, 317, 501, 317, 501,
+  317, 501, 326, 506, 326, 506, 326, 506, 326, 506, 326, 506, 328, 508, 328, 508
+  },
+  {
+  342, 522, 342, 522, 342, 522, 342, 522, 342, 522, 344, 524, 344, 524, 353, 533,
+  355, 535, 355, 535, 355, 535, 437, 501, 522, 533, 370, 493, 0, 0, 314, 0,
+  202, 370, 202, 370, 202, 370, 202, 370, 202, 370, 202, 370, 202, 370, 202, 370,
+  202, 370, 202, 370, 202, 370, 202, 370, 219, 414, 219, 414, 219, 414, 219, 414,
+  219, 414, 219, 414, 219, 414, 219, 414, 242, 442, 242, 442, 289, 476, 289, 476,
+  289, 476, 289, 476, 289, 476, 289, 476, 289, 476, 289, 476, 289, 476, 289, 476,
+  289, 476, 289, 476, 326, 506, 326, 506, 326, 506, 326, 506, 326, 506, 326, 506,
+  326, 506, 353, 533, 353, 533, 353, 533, 353, 533, 0, 0, 0, 0, 353, 533
+  },
+  {
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+  60, 60, 60, 60, 60, 60, 539, 2, 20, 20, 58, 20, 15, 15, 15, 15,
+  52, 0, 65, 186, 65, 67, 70, 60, 2, 2, 0, 0, 0, 0, 0, 2,
+  17, 0, 20, 22, 25, 361, 363, 366, 0, 164, 186, 0, 6, 0, 2, 0,
+  0, 0, 0, 60, 74, 0, 0, 199, 196, 12, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 2,
+  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 306, 0, 0, 0, 221, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  372, 376, 209, 401, 0, 387, 391, 0, 0, 406, 435, 237, 237, 237, 437, 437,
+  242, 242, 268, 464, 0, 278, 286, 0, 0, 300, 302, 304, 304, 304, 0, 0,
+  311, 319, 41, 0, 355, 0, 0, 0, 355, 0, 266, 202, 207, 209, 0, 414,
+  219, 225, 0, 276, 476, 0, 0, 0, 0, 442, 0, 227, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 211, 395, 414, 442, 460, 0, 0, 0, 0, 0, 0,
+  110, 118, 85, 94, 124, 102, 128, 138, 146, 106, 150, 114, 142, 154, 158, 82,
+  242, 244, 247, 254, 328, 330, 333, 337, 257, 344, 346, 349, 268, 209, 211, 276,
+  442, 444, 447, 454, 508, 510, 513, 517, 457, 524, 526, 529, 464, 385, 395, 469
+  },
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0,
+  166, 0, 62, 0, 169, 0, 0, 0, 0, 0, 166, 62, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 179, 183,
+  176, 0, 183, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 60, 0, 0, 74, 0, 50, 0, 65, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 537, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 542, 0, 0, 0,
+  0, 542, 0, 0, 0, 0, 0, 0, 542, 542, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 176, 188, 0, 0, 0, 0, 0, 0, 0, 0, 164, 186,
+  176, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+  418, 429, 432, 421, 425, 498, 498, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  }
+  };
+
+static const char translit_pool[544] =
+  "\0"
+  "\0"
+  " \0"
+  "!\0"
+  "!!\0"
+  "!=\0"
+  "!?\0"
+  "\"\0"
+  "%o\0"
+  "'\0"
+  "''\0"
+  "'''\0"
+  "''''\0"
+  "'n\0"
+  "(R)\0"
+  "(TM)\0"
+  "(c)\0"
+  "*\0"
+  "+\0"
+  "+/-\0"
+  ",\0"
+  "-\0"
+  "->\0"
+  ".\0"
+  "..\0"
+  "...\0"
+  "/\0"
+  "0/3\0"
+  "1\0"
+  "1/\0"
+  "1/10\0"
+  "1/2\0"
+  "1/3\0"
+  "1/4\0"
+  "1/5\0"
+  "1/6\0"
+  "1/7\0"
+  "1/8\0"
+  "1/9\0"
+  "2\0"
+  "2/3\0"
+  "2/5\0"
+  "3\0"
+  "3/4\0"
+  "3/5\0"
+  "3/8\0"
+  "4/5\0"
+  "5/6\0"
+  "5/8\0"
+  "7/8\0"
+  ":\0"
+  "<\0"
+  "<-\0"
+  "<->\0"
+  "<<\0"
+  "<=\0"
+  "<=>\0"
+  "=>\0"
+  ">\0"
+  ">=\0"
+  ">>\0"
+  "?\0"
+  "?!\0"
+  "??\0"
+  "A\0"
+  "AE\0"
+  "B\0"
+  "C\0"
+  "D\0"
+  "DZ\0"
+  "Dz\0"
+  "E\0"
+  "EUR\0"
+  "F\0"
+  "FAX\0"
+  "G\0"
+  "GBP\0"
+  "H\0"
+  "Hw\0"
+  "I\0"
+  "II\0"
+  "III\0"
+  "IJ\0"
+  "IV\0"
+  "IX\0"
+  "J\0"
+  "JPY\0"
+  "K\0"
+  "L\0"
+  "LJ\0"
+  "Lj\0"
+  "M\0"
+  "N\0"
+  "NJ\0"
+  "Nj\0"
+  "No\0"
+  "O\0"
+  "OE\0"
+  "OI\0"
+  "OU\0"
+  "P\0"
+  "Q\0"
+  "R\0"
+  "Rs\0"
+  "S\0"
+  "SM\0"
+  "SS\0"
+  "T\0"
+  "TEL\0"
+  "Th\0"
+  "U\0"
+  "V\0"
+  "VI\0"
+  "VII\0"
+  "VIII\0"
+  "W\0"
+  "X\0"
+  "XI\0"
+  "XII\0"
+  "Y\0"
+  "Z\0"
+  "^\0"
+  "_\0"
+  "`\0"
+  "``\0"
+  "```\0"
+  "a\0"
+  "a/c\0"
+  "a/s\0"
+  "ae\0"
+  "b\0"
+  "c\0"
+  "c/o\0"
+  "c/u\0"
+  "d\0"
+  "deg\0"
+  "degC\0"
+  "degF\0"
+  "dz\0"
+  "e\0"
+  "f\0"
+  "ff\0"
+  "ffi\0"
+  "ffl\0"
+  "fi\0"
+  "fl\0"
+  "g\0"
+  "h\0"
+  "hv\0"
+  "i\0"
+  "ii\0"
+  "iii\0"
+  "ij\0"
+  "iv\0"
+  "ix\0"
+  "j\0"
+  "k\0"
+  "l\0"
+  "lj\0"
+  "m\0"
+  "n\0"
+  "nj\0"
+  "o\0"
+  "oe\0"
+  "oi\0"
+  "ou\0"
+  "p\0"
+  "q\0"
+  "r\0"
+  "s\0"
+  "ss\0"
+  "st\0"
+  "t\0"
+  "th\0"
+  "u\0"
+  "v\0"
+  "vi\0"
+  "vii\0"
+  "viii\0"
+  "w\0"
+  "x\0"
+  "xi\0"
+  "xii\0"
+  "y\0"
+  "z\0"
+  "|\0"
+  "||\0"
+  "~\0";
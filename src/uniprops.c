@@ -0,0 +1,9 @@
+/*============================================================================
+  epub2txt v2 
+  uniprops.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+============================================================================*/
+
+#include "uniprops.h"
+#include "uniprops_table.h"
+
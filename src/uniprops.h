@@ -0,0 +1,102 @@
+/*============================================================================
+  epub2txt v2 
+  uniprops.h
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  The Unicode properties of a character that the text wrapper needs: 
+  its line break class (UAX #14), how many columns it takes up, and 
+  whether it is whitespace or a newline. They come from a two-stage 
+  table, generated by tools/mkuniprops.py into uniprops_table.h, so 
+  each lookup is two loads. The same script generates the UAX #14 pair
+  table, of where the text can be broken between two classes.
+============================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// Must match the table, which checks it
+#define UNIPROPS_BLOCK_BITS 7
+
+// Line break classes. Must be in the same order as LB_CLASSES in 
+//   tools/mkuniprops.py
+typedef enum { UNIPROPS_LB_XX = 0, 
+  UNIPROPS_LB_BK, UNIPROPS_LB_CR, UNIPROPS_LB_LF, UNIPROPS_LB_NL, 
+  UNIPROPS_LB_CM, UNIPROPS_LB_ZWJ, UNIPROPS_LB_SG, UNIPROPS_LB_WJ, 
+  UNIPROPS_LB_ZW, UNIPROPS_LB_GL, UNIPROPS_LB_SP, UNIPROPS_LB_B2, 
+  UNIPROPS_LB_BA, UNIPROPS_LB_BB, UNIPROPS_LB_HY, UNIPROPS_LB_CB, 
+  UNIPROPS_LB_CL, UNIPROPS_LB_CP, UNIPROPS_LB_EX, UNIPROPS_LB_IN, 
+  UNIPROPS_LB_NS, UNIPROPS_LB_OP, UNIPROPS_LB_QU, UNIPROPS_LB_IS, 
+  UNIPROPS_LB_NU, UNIPROPS_LB_PO, UNIPROPS_LB_PR, UNIPROPS_LB_SY, 
+  UNIPROPS_LB_AI, UNIPROPS_LB_AL, UNIPROPS_LB_CJ, UNIPROPS_LB_EB, 
+  UNIPROPS_LB_EM, UNIPROPS_LB_H2, UNIPROPS_LB_H3, UNIPROPS_LB_HL, 
+  UNIPROPS_LB_ID, UNIPROPS_LB_JL, UNIPROPS_LB_JV, UNIPROPS_LB_JT, 
+  UNIPROPS_LB_RI, UNIPROPS_LB_SA, 
+  UNIPROPS_LB_COUNT } UnipropsLb;
+
+// What the pair table says about a possible break between two 
+//   characters. Must match tools/mkuniprops.py
+typedef enum { UNIPROPS_BREAK_DIRECT = 0,   // Break allowed
+               UNIPROPS_BREAK_INDIRECT,     // Break allowed only at spaces
+               UNIPROPS_BREAK_PROHIBITED,   // No break, even at spaces
+               UNIPROPS_BREAK_COMBINING     // The second is a combining mark
+             } UnipropsBreak;
+
+// The layout of a table entry
+#define UNIPROPS_LB_MASK     0x3F
+#define UNIPROPS_WIDTH_SHIFT 6
+#define UNIPROPS_WIDTH_MASK  0x3
+#define UNIPROPS_WHITE       0x100  // Whitespace, other than newlines
+#define UNIPROPS_NEWLINE     0x200
+
+extern const unsigned char uniprops_stage1[];
+extern const unsigned short uniprops_stage2[];
+extern const unsigned char uniprops_lb_pairs[UNIPROPS_LB_COUNT]
+  [UNIPROPS_LB_COUNT];
+
+/** All the properties of c, packed as above. Anything that is not a 
+    valid code point has the properties of an unassigned one. */
+static inline unsigned int uniprops_get (uint32_t c)
+  {
+  if (c > 0x10FFFF) c = 0x10FFFF;
+  return uniprops_stage2[(uniprops_stage1[c >> UNIPROPS_BLOCK_BITS] 
+    << UNIPROPS_BLOCK_BITS) | (c & ((1u << UNIPROPS_BLOCK_BITS) - 1))];
+  }
+
+/** The line break class of c. */
+static inline UnipropsLb uniprops_lb (uint32_t c)
+  {
+  return (UnipropsLb)(uniprops_get (c) & UNIPROPS_LB_MASK);
+  }
+
+/** The number of columns that c takes up on a terminal: 0, 1 or 2. */
+static inline int uniprops_width (uint32_t c)
+  {
+  return (uniprops_get (c) >> UNIPROPS_WIDTH_SHIFT) & UNIPROPS_WIDTH_MASK;
+  }
+
+/** Whether c is whitespace other than a newline, including no-break
+    spaces. */
+static inline BOOL uniprops_is_white (uint32_t c)
+  {
+  return (uniprops_get (c) & UNIPROPS_WHITE) != 0;
+  }
+
+/** Whether c ends a line: LF, VT, FF, CR, NEL, and the line and 
+    paragraph separators. */
+static inline BOOL uniprops_is_newline (uint32_t c)
+  {
+  return (uniprops_get (c) & UNIPROPS_NEWLINE) != 0;
+  }
+
+/** Whether the text can be broken between a character of class before
+    and one of class after, or before and after are the classes either
+    side of some spaces. A combining mark takes the class of the 
+    character it follows. */
+static inline UnipropsBreak uniprops_lb_break (UnipropsLb before, 
+    UnipropsLb after)
+  {
+  return (UnipropsBreak)uniprops_lb_pairs[before][after];
+  }
+
@@ -4,9 +4,11 @@
   Copyright (c)2022 Marco Bonelli, Kevin Boone, GPL v3.0
 ============================================================================*/
 
+#define _GNU_SOURCE
 #include <errno.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <signal.h>
@@ -43,6 +45,73 @@ int run_command (const char *const argv[], BOOL abort_on_error)
   return status;
   }
 
+/*==========================================================================
+run_command_output
+Run an helper command as run_command does, with its standard output 
+redirected to a pipe that we read to the end. The pipe is close-on-exec,
+so that commands run at the same time by other threads do not inherit
+it. Other threads might hold locks, such as the logger's, so the child
+calls nothing but dup2, close and exec, and exits with 127 if exec 
+fails, which we report here
+*==========================================================================*/
+char *run_command_output (const char *const argv[], int *length)
+  {
+  int fds[2];
+  if (pipe2 (fds, O_CLOEXEC) == -1)
+    {
+    log_error ("Can't create pipe: %s", strerror (errno));
+    return NULL;
+    }
+
+  int pid = fork();
+  if (pid == -1)
+    {
+    log_error ("Can't fork: %s", strerror (errno));
+    close (fds[0]);
+    close (fds[1]);
+    return NULL;
+    }
+  if (pid == 0)
+    {
+    close (fds[0]);
+    dup2 (fds[1], STDOUT_FILENO);
+    close (fds[1]);
+    execvp(argv[0], (char **const)argv);
+    _exit (127);
+    }
+
+  close (fds[1]);
+  int size = 4096, len = 0;
+  char *buff = malloc (size);
+  for (;;)
+    {
+    ssize_t n = read (fds[0], buff + len, size - len - 1);
+    if (n == -1 && errno == EINTR) continue;
+    if (n <= 0) break;
+    len += n;
+    if (len == size - 1)
+      {
+      size *= 2;
+      buff = realloc (buff, size);
+      }
+    }
+  close (fds[0]);
+  buff[len] = 0;
+
+  int status;
+  while (waitpid (pid, &status, 0) == -1 && errno == EINTR)
+    ;
+  if (!WIFEXITED (status) || WEXITSTATUS (status) != 0)
+    {
+    if (WIFEXITED (status) && WEXITSTATUS (status) == 127)
+      log_error ("Can't execute command \"%s\"", argv[0]);
+    free (buff);
+    return NULL;
+    }
+  *length = len;
+  return buff;
+  }
+
 /*==========================================================================
   Decode %xx in URL-type strings. The caller must free the resulting
   string, which will be no longer than the input. 
@@ -10,6 +10,12 @@
 
 int run_command (const char *const argv[], BOOL abort_on_error);
 
+/** Run a helper command as run_command() does, but collect its standard
+    output. Returns a NUL-terminated buffer that the caller must free, and
+    sets *length to the number of bytes read; or returns NULL if the command
+    fails. */
+char *run_command_output (const char *const argv[], int *length);
+
 /** Decode %xx in URL-type strings. The caller must free the resulting
     string, which will be no longer than the input. */
 char *decode_url (const char *url);
@@ -19,13 +19,28 @@
 #include <stdlib.h>
 #include "defs.h" 
 #include "wrap.h"
-#include "convertutf.h"
+#include "encode.h"
+#include "uniprops.h"
+#include "hyph.h"
 #include "xhtml.h"
 
 #define WT_STATE_START 0
 #define WT_STATE_WORD 1
 #define WT_STATE_WHITE 2
 
+// A word of a paragraph that is being laid out as a whole
+typedef struct _WrapTextBox
+  {
+  int start;         // Offset of the text in the paragraph buffer
+  int len;
+  int width;         // Columns
+  int space;         // 1 if the word is followed by a space, else 0
+  int hyphen;        // 1 if the word is part of one that can be 
+                     //   hyphenated here, else 0
+  int esc;           // Where the escapes that come before the word end
+  unsigned int fmt;  // Formatting in effect when the word began
+  } WrapTextBox;
+
 typedef struct _WrapTextContextPriv 
   {
   WrapTextOutputFn outputFn;
@@ -39,121 +54,512 @@ typedef struct _WrapTextContextPriv
   void *app_data;
   BOOL blank_line;
   WT_UTF32 last;
+  Hyphenator *hyph;  // May be NULL, for no hyphenation
+  // The word being collected. The buffer is kept from one word to the
+  //   next, and only grows.
   WT_UTF32 *token;
+  int token_len;
+  int token_size;
+  int token_width;   // Columns, which may not be the same as token_len
+  UnipropsLb lb_last; // Line break class at the end of the token
+  // The output line, as UTF-8, which is written all at once when it 
+  //   is complete. Not used if there is an output function.
+  char *line;
+  int line_len;
+  int line_size;
+  // With WT_FLAG_OPTIMAL, the words of the paragraph so far, their 
+  //   text, and any escapes that came between them. The other arrays
+  //   are work space for the layout, and all have box_size + 1 elements.
+  WrapTextBox *boxes;
+  int box_count;
+  int box_size;
+  int box_column;    // Where a greedy layout of the words would be
+  WT_UTF32 *para;
+  int para_len;
+  int para_size;
+  char *esc;
+  int esc_len;
+  int esc_size;
+  long *offsets;
+  double *minima;
+  int *breaks;
+  int *cands;
+  int *froms;
   } WrapTextContextPriv;
 
 
-/** Convert a single UTF32 character to a UTF8 representation, where
- * the UTF8 is an array of characters terminated with a zero. The 
- * utf8 parameter must be a pointed to an array of WT_UTF8 (aka char)
- * of at least WT_UTF8_MAX_BYTES size. */
-void wraptext_context_utf32_char_to_utf8 (const uint32_t c, WT_UTF8* utf8)
+/** Write the line buffer to stdout, and empty it. */
+static void _wraptext_flush_line (WrapTextContext *context)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  if (priv->line_len > 0)
+    {
+    fwrite (priv->line, 1, priv->line_len, stdout);
+    priv->line_len = 0;
+    }
+  }
+
+
+/** Make room for n more bytes in the line buffer. */
+static void _wraptext_line_reserve (WrapTextContextPriv *priv, int n)
+  {
+  if (priv->line_len + n > priv->line_size)
+    {
+    int size = priv->line_size ? priv->line_size : 256;
+    while (priv->line_len + n > size) size *= 2;
+    priv->line = realloc (priv->line, size);
+    priv->line_size = size;
+    }
+  }
+
+
+/** Output len characters: to the output function, if there is one, 
+ * or else to the line buffer, as UTF-8. */
+static void _wraptext_output (WrapTextContext *context, const WT_UTF32 *s,
+     int len)
   {
-  WT_UTF32 _in = c;
-  const UTF32* in = (const UTF32 *) &_in;
-  int max_out = WT_UTF8_MAX_BYTES;
-  UTF8 *out = (UTF8 *)utf8;
-  memset (out, 0, max_out * sizeof (UTF8));
-  UTF8 *out_temp = out;
+  WrapTextContextPriv *priv = context->priv;
+  if (priv->outputFn)
+    {
+    priv->outputFn (priv->app_data, s, len);
+    return;
+    }
 
-  ConvertUTF32toUTF8 (&in, in + 1,
-      //&out_temp, out + max_out * 4, 0);
-      &out_temp, out + max_out, 0);
-  int len = out_temp - out;
-  utf8[len] = 0;
+  _wraptext_line_reserve (priv, len * ENCODE_UTF8_MAX);
+  priv->line_len += encode_utf8 (s, len, priv->line + priv->line_len);
   }
 
 
-void _stdout_output_fn (void *app_data, WT_UTF32 c)
+/** Output n bytes that take up no columns, straight away. */
+static void _wraptext_emit_raw (WrapTextContext *context, const char *s, 
+     int n)
   {
-  WT_UTF8 buff [WT_UTF8_MAX_BYTES];  
-  wraptext_context_utf32_char_to_utf8 (c, buff);
-  fputs (buff, stdout); 
+  WrapTextContextPriv *priv = context->priv;
+  if (n <= 0) return;
+  if (priv->outputFn)
+    {
+    fwrite (s, 1, n, stdout);
+    return;
+    }
+  _wraptext_line_reserve (priv, n);
+  memcpy (priv->line + priv->line_len, s, n);
+  priv->line_len += n;
   }
 
 
-static void _wraptext_append_token (WrapTextContext *context, const WT_UTF32 c)
+/** Output bytes that take up no columns, such as terminal escapes, in 
+ * their place among the characters. */
+void wraptext_emit_bytes (WrapTextContext *context, const char *s)
   {
-  WT_UTF32 *token = context->priv->token;
-  if (!token)
+  WrapTextContextPriv *priv = context->priv;
+  int n = strlen (s);
+  if (priv->box_count > 0)
     {
-    token = malloc (sizeof (WT_UTF32));
-    token[0] = 0;
+    // Part way through a paragraph that has not been laid out yet
+    if (priv->esc_len + n > priv->esc_size)
+      {
+      while (priv->esc_len + n > priv->esc_size)
+        priv->esc_size = priv->esc_size ? priv->esc_size * 2 : 64;
+      priv->esc = realloc (priv->esc, priv->esc_size);
+      }
+    memcpy (priv->esc + priv->esc_len, s, n);
+    priv->esc_len += n;
+    return;
     }
-   
-  int l = wraptext_utf32_length (token);
-   
-  token = realloc (token, (l+2) * sizeof (WT_UTF32));
+  _wraptext_emit_raw (context, s, n);
+  }
 
-  token [l] = c;
-  token [l+1] = 0;
 
-  context->priv->token = token;
+// Add c, which takes up width columns, to the current word
+static void _wraptext_append_token (WrapTextContext *context, const WT_UTF32 c,
+     int width)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  // Leave room for a terminating zero
+  if (priv->token_len + 2 > priv->token_size)
+    {
+    priv->token_size = priv->token_size ? priv->token_size * 2 : 64;
+    priv->token = realloc (priv->token, 
+      priv->token_size * sizeof (WT_UTF32));
+    }
+  priv->token[priv->token_len++] = c;
+  priv->token[priv->token_len] = 0;
+  priv->token_width += width;
   }
 
 
-// Whitespace other than newline
+// Whitespace other than newline, including nbsp
 BOOL _wraptext_is_white (WT_UTF32 c)
   {
-  if (c == 160) return TRUE; // nbsp
-  if (c == 32) return TRUE;
-  if (c == 9) return TRUE;
-  //TODO -- other unicode whitespace chars
-  return FALSE;
+  return uniprops_is_white (c);
   }
 
 // Whitespace other than newline
-BOOL _wraptext_is_all_white (const WT_UTF32 *s)
+BOOL _wraptext_is_all_white (const WT_UTF32 *s, int len)
   {
-  while (*s)
+  int i;
+  for (i = 0; i < len; i++)
     {
-    if (!_wraptext_is_white (*s)) return FALSE;
-    s++;
+    if (!_wraptext_is_white (s[i])) return FALSE;
     }
   return TRUE;
   }
 
 
-// TODO -- detect other newline characters 
 BOOL _wraptext_is_newline (WT_UTF32 c)
   {
-  if (c == 10) return TRUE;
-  return FALSE;
+  return uniprops_is_newline (c);
   }
 
 
 void _wraptext_emit_newline (WrapTextContext *context)
   {
-  context->priv->outputFn (context->priv->app_data, (WT_UTF32)'\n'); 
+  static const WT_UTF32 nl = '\n';
+  _wraptext_output (context, &nl, 1); 
+  _wraptext_flush_line (context);
+  }
+
+
+/** The cost of a line of len columns, when there is room for fit. The
+ * square of the space left over, as in TeX; a line that is too long
+ * costs more than any that fits, and more the longer it is, so that the
+ * cost is convex in len. */
+static double _wraptext_line_cost (long len, long fit)
+  {
+  if (len <= fit)
+    return (double)(fit - len) * (fit - len);
+  return 1e10 * (len - fit);
+  }
+
+
+/** The cost of the best layout of the first j words of the paragraph,
+ * with the last line starting at word i. A line that ends with a 
+ * hyphen costs as much more as one that is a quarter empty. */
+static double _wraptext_cost (const WrapTextContextPriv *priv, int i, 
+     int j, long fit)
+  {
+  const WrapTextBox *last = &priv->boxes[j - 1];
+  long len = priv->offsets[j] - priv->offsets[i] - last->space + last->hyphen;
+  double cost = priv->minima[i] + _wraptext_line_cost (len, fit);
+  if (last->hyphen)
+    cost += (double)fit * fit / 16;
+  return cost;
+  }
+
+
+/** Choose where to break the lines of a paragraph of n words, so as 
+ * to minimize the total cost of its lines, other than the last. 
+ * Returns the number of lines, and leaves the word that starts each 
+ * one in froms[]. 
+ *
+ * Because the cost of a line is convex in its length, the cost matrix
+ * is totally monotone: once a later start for the last line beats an 
+ * earlier one, it does so for every longer paragraph. So the starts 
+ * that are still worth considering are kept in a queue, each with the 
+ * first j at which it is best, and a new one displaces from the back
+ * of the queue those that it beats, and searches for where it 
+ * overtakes the rest. That is O(n log n), rather than the O(n^2) of
+ * trying every start for every j. */
+static int _wraptext_para_breaks (WrapTextContextPriv *priv, int n, 
+     long fit)
+  {
+  int *cands = priv->cands, *froms = priv->froms;
+  int head = 0, tail = 0, i, j;
+
+  priv->offsets[0] = 0;
+  for (i = 0; i < n; i++)
+    priv->offsets[i + 1] = priv->offsets[i] + priv->boxes[i].width 
+      + priv->boxes[i].space;
+
+  priv->minima[0] = 0;
+  cands[tail] = 0; froms[tail] = 1; tail++;
+  for (j = 1; j <= n; j++)
+    {
+    while (tail - head > 1 && froms[head + 1] <= j) head++;
+    priv->breaks[j] = cands[head];
+    priv->minima[j] = _wraptext_cost (priv, cands[head], j, fit);
+    if (j == n) break;
+
+    // Word j as the start of a line, for paragraphs of more than j words
+    while (tail > head)
+      {
+      int t = froms[tail - 1] > j + 1 ? froms[tail - 1] : j + 1;
+      if (_wraptext_cost (priv, j, t, fit) 
+            > _wraptext_cost (priv, cands[tail - 1], t, fit)) 
+        break;
+      tail--;
+      }
+    if (tail == head)
+      {
+      cands[tail] = j; froms[tail] = j + 1; tail++;
+      }
+    else
+      {
+      // The crossing is usually within a line or two, so look for it
+      //   in steps that double, before the binary search
+      int lose = froms[tail - 1] > j + 1 ? froms[tail - 1] : j + 1;
+      int win = n + 1, step = 1;
+      while (lose + step <= n)
+        {
+        if (_wraptext_cost (priv, j, lose + step, fit) 
+              <= _wraptext_cost (priv, cands[tail - 1], lose + step, fit))
+          {
+          win = lose + step;
+          break;
+          }
+        lose += step;
+        step *= 2;
+        }
+      while (win - lose > 1)
+        {
+        int mid = lose + (win - lose) / 2;
+        if (_wraptext_cost (priv, j, mid, fit) 
+              <= _wraptext_cost (priv, cands[tail - 1], mid, fit))
+          win = mid;
+        else
+          lose = mid;
+        }
+      if (win <= n)
+        {
+        cands[tail] = j; froms[tail] = win; tail++;
+        }
+      }
+    }
+
+  // The last line costs nothing, if it fits, so choose its start 
+  //   separately
+  int last = priv->breaks[n];
+  double best = priv->minima[n];
+  for (i = n - 1; i >= 0; i--)
+    {
+    if (priv->offsets[n] - priv->offsets[i] - priv->boxes[n - 1].space > fit)
+      break;
+    if (priv->minima[i] <= best)
+      {
+      best = priv->minima[i];
+      last = i;
+      }
+    }
+
+  int lines = 0;
+  for (j = n, i = last; j > 0; j = i, i = priv->breaks[i])
+    froms[lines++] = i;
+  for (i = 0; i < lines / 2; i++)
+    {
+    int t = froms[i]; froms[i] = froms[lines - 1 - i]; 
+    froms[lines - 1 - i] = t;
+    }
+  return lines;
+  }
+
+
+/** Output the words of the paragraph, with the line breaks that make
+ * it least ragged, and empty it. */
+static void _wraptext_para_layout (WrapTextContext *context)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  int n = priv->box_count;
+  priv->box_column = 0;
+  if (n == 0) return;
+  // From here on, escapes are output straight away
+  priv->box_count = 0;
+
+  // The same room as _wraptext_flush_string allows
+  long fit = priv->width - 2;
+  if (fit < 1) fit = 1;
+  int lines = _wraptext_para_breaks (priv, n, fit);
+
+  // Each line is output as runs of text between escapes, which the
+  //   words and their spaces are, in the paragraph buffer
+  unsigned int fmt = priv->fmt;
+  int esc = 0, line, k;
+  for (line = 0; line < lines; line++)
+    {
+    int first = priv->froms[line];
+    int end = line + 1 < lines ? priv->froms[line + 1] : n;
+    int run = priv->boxes[first].start;
+    for (k = first; k < end; k++)
+      {
+      WrapTextBox *box = &priv->boxes[k];
+      if (box->esc != esc)
+        {
+        _wraptext_output (context, priv->para + run, box->start - run);
+        _wraptext_emit_raw (context, priv->esc + esc, box->esc - esc);
+        esc = box->esc;
+        run = box->start;
+        }
+      if (k == first && line > 0)
+        {
+        // Formatting is turned off and on again as it was at this
+        //   point in the text
+        priv->fmt = box->fmt;
+        xhtml_emit_fmt_eol_pre (context);
+        _wraptext_emit_newline (context);
+        xhtml_emit_fmt_eol_post (context);
+        priv->fmt = fmt;
+        priv->column = 0;
+        }
+      priv->column += box->width + box->space;
+      }
+    WrapTextBox *last = &priv->boxes[end - 1];
+    _wraptext_output (context, priv->para + run, 
+      last->start + last->len + last->space - run);
+    if (last->hyphen && end < n)
+      {
+      static const WT_UTF32 hyphen = '-';
+      _wraptext_output (context, &hyphen, 1);
+      priv->column++;
+      }
+    }
+  _wraptext_emit_raw (context, priv->esc + esc, priv->esc_len - esc);
+  priv->esc_len = 0;
+  priv->para_len = 0;
+  }
+
+
+/** Add len characters to the paragraph, as a word, or part of one. */
+static void _wraptext_para_add_box (WrapTextContext *context, 
+     const WT_UTF32 *s, int len, int width, int space, int hyphen)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  if (priv->box_count == priv->box_size)
+    {
+    int size = priv->box_size ? priv->box_size * 2 : 256;
+    priv->boxes = realloc (priv->boxes, size * sizeof (WrapTextBox));
+    priv->offsets = realloc (priv->offsets, (size + 1) * sizeof (long));
+    priv->minima = realloc (priv->minima, (size + 1) * sizeof (double));
+    priv->breaks = realloc (priv->breaks, (size + 1) * sizeof (int));
+    priv->cands = realloc (priv->cands, (size + 1) * sizeof (int));
+    priv->froms = realloc (priv->froms, (size + 1) * sizeof (int));
+    priv->box_size = size;
+    }
+  // The word is stored with its space, if it has one
+  if (priv->para_len + len + 1 > priv->para_size)
+    {
+    int size = priv->para_size ? priv->para_size : 1024;
+    while (priv->para_len + len + 1 > size) size *= 2;
+    priv->para = realloc (priv->para, size * sizeof (WT_UTF32));
+    priv->para_size = size;
+    }
+
+  WrapTextBox *box = &priv->boxes[priv->box_count++];
+  box->start = priv->para_len;
+  box->len = len;
+  box->width = width;
+  box->space = space;
+  box->hyphen = hyphen;
+  box->esc = priv->esc_len;
+  box->fmt = priv->fmt;
+  memcpy (priv->para + priv->para_len, s, len * sizeof (WT_UTF32));
+  priv->para_len += len;
+  if (space)
+    priv->para[priv->para_len++] = ' ';
+  }
+
+
+/** Add the token to the paragraph, to be laid out when it ends. If
+ * it can be hyphenated, each part is a separate word, which the line
+ * can be broken after. Hyphenating every word would make the layout
+ * slower for little gain, so only a word that overflows a greedy 
+ * layout of the paragraph is, and then only if that would leave the 
+ * line more than a quarter empty: a hyphen costs as much as that 
+ * (see _wraptext_cost), so it can seldom pay for itself otherwise. */
+static void _wraptext_para_add (WrapTextContext *context, BOOL space)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  const WT_UTF32 *s = priv->token;
+  int len = priv->token_len, width = priv->token_width;
+  long fit = priv->width - 2;
+  BOOL hyphenate = FALSE;
+  if (priv->box_column + width > fit)
+    {
+    hyphenate = (fit - priv->box_column) * 4 > fit;
+    priv->box_column = 0;
+    }
+  priv->box_column += width + (space ? 1 : 0);
+  if (priv->hyph && hyphenate)
+    {
+    int points[HYPH_WORD_MAX];
+    int i, n = hyph_points (priv->hyph, s, len, points);
+    for (i = 0; i < n; i++)
+      {
+      int k, head = points[i] - (s - priv->token), head_width = 0;
+      for (k = 0; k < head; k++)
+        head_width += uniprops_width (s[k]);
+      _wraptext_para_add_box (context, s, head, head_width, 0, 1);
+      s += head;
+      len -= head;
+      width -= head_width;
+      }
+    }
+  _wraptext_para_add_box (context, s, len, width, space ? 1 : 0, 0);
   }
 
 
 void _wraptext_new_line (WrapTextContext *context)
   {
+  _wraptext_para_layout (context);
   _wraptext_emit_newline (context);
   context->priv->column = 0;
   }
 
 
-void _wraptext_flush_string (WrapTextContext *context, WT_UTF32 *s)
+/** How many characters of s to put on the line, before a hyphen, 
+ * so that they and the hyphen take up no more than room columns; 0 if
+ * there is no hyphenation point that near the start. */
+static int _wraptext_hyphen_fit (WrapTextContext *context, 
+     const WT_UTF32 *s, int l, int room, int *head_width)
   {
-  int i, l = wraptext_utf32_length (s);
+  int points[HYPH_WORD_MAX];
+  int i, k = 0, width = 0, head = 0;
+  int n = hyph_points (context->priv->hyph, s, l, points);
+  *head_width = 0;
+  for (i = 0; i < n; i++)
+    {
+    while (k < points[i]) width += uniprops_width (s[k++]);
+    if (width + 1 > room) break;
+    head = points[i];
+    *head_width = width;
+    }
+  return head;
+  }
 
-  if (l + context->priv->column + 1 >= context->priv->width)
+
+// Output l characters, which take up width columns
+void _wraptext_flush_string (WrapTextContext *context, const WT_UTF32 *s,
+     int l, int width)
+  {
+  WrapTextContextPriv *priv = context->priv;
+  while (width + priv->column + 1 >= priv->width)
     {
+    // With hyphenation, as much of the word as will fit goes on this
+    //   line, and the rest, which may be hyphenated again, on the next
+    int head = 0, head_width = 0;
+    if (priv->hyph)
+      {
+      head = _wraptext_hyphen_fit (context, s, l, 
+        priv->width - priv->column - 2, &head_width);
+      if (head == 0 && priv->column == 0) 
+        break; // It won't fit on any line
+      }
+    if (head > 0)
+      {
+      static const WT_UTF32 hyphen = '-';
+      _wraptext_output (context, s, head);
+      _wraptext_output (context, &hyphen, 1);
+      s += head;
+      l -= head;
+      width -= head_width;
+      }
     xhtml_emit_fmt_eol_pre (context);    /* upcall: turn-off all ANSI highlghting before EOL */
     _wraptext_emit_newline (context);
     xhtml_emit_fmt_eol_post (context);   /* upcall: restore ANSI highlighting after EOL */
-    context->priv->column = 0;
+    priv->column = 0;
+    if (!priv->hyph) break;
     }
  
-  for (i = 0; i < l; i++)
-    {
-    WT_UTF32 c = s[i];
-    context->priv->outputFn (context->priv->app_data, c); 
-    }
-
-  context->priv->column += l;
+  _wraptext_output (context, s, l);
+  priv->column += width;
   }
 
 
@@ -161,31 +567,39 @@ void _wraptext_flush_space (WrapTextContext *context, BOOL allowAtStart)
   {
   if ((context->priv->column > 0) || allowAtStart)
     {
-    context->priv->outputFn (context->priv->app_data, ' '); 
+    static const WT_UTF32 space = ' ';
+    _wraptext_output (context, &space, 1); 
     context->priv->column++;
     }
   }
 
 
-void _wraptext_flush_token (WrapTextContext *context)
+/** Output the token, and then a space, unless the token ends at a
+    line break opportunity that is not a space. */
+void _wraptext_flush_token (WrapTextContext *context, BOOL space)
   {
-  WT_UTF32 *token = context->priv->token;
+  WrapTextContextPriv *priv = context->priv;
   // Don't flush anything -- even a space -- if the token is
-  //  null. This will only happen at end-of-line or end-of-file
+  //  empty. This will only happen at end-of-line or end-of-file
   //  states (hopefully)
-  if (token)
+  if (priv->token_len > 0)
     {
-    if (token[0])
+    if (!_wraptext_is_all_white (priv->token, priv->token_len))
+      priv->blank_line = FALSE;
+    if (priv->flags & WT_FLAG_OPTIMAL)
       {
-      if (!_wraptext_is_all_white (token))
-        context->priv->blank_line = FALSE;
+      _wraptext_para_add (context, space);
+      priv->token_len = 0;
+      priv->token_width = 0;
+      return;
       }
-    _wraptext_flush_string (context, token);
-    _wraptext_flush_space (context, FALSE);
-    free (context->priv->token);
+    _wraptext_flush_string (context, priv->token, priv->token_len, 
+      priv->token_width);
+    if (space)
+      _wraptext_flush_space (context, FALSE);
+    priv->token_len = 0;
+    priv->token_width = 0;
     }
-
-  context->priv->token = NULL;
   }
 
 
@@ -194,16 +608,26 @@ void _wraptext_wrap_next (WrapTextContext *context, const WT_UTF32 c)
   WT_UTF32 last = context->priv->last;
 
   int state = context->priv->state;
+  // One table lookup answers all the questions about c
+  unsigned int props = uniprops_get (c);
+  BOOL newline = (props & UNIPROPS_NEWLINE) != 0;
+  int width = (props >> UNIPROPS_WIDTH_SHIFT) & UNIPROPS_WIDTH_MASK;
+  UnipropsLb lb = (UnipropsLb)(props & UNIPROPS_LB_MASK);
+  // No-break spaces are part of the word they are in
+  BOOL white = (props & UNIPROPS_WHITE) != 0 && lb != UNIPROPS_LB_GL;
+  // A combining mark that does not follow a word is a letter (LB10)
+  UnipropsLb lb_start = (lb == UNIPROPS_LB_CM || lb == UNIPROPS_LB_ZWJ) 
+    ? UNIPROPS_LB_AL : lb;
 
   // This logic counts spaces at the ends of lines, so MD-style
   //   double-space linebreaks can be respected.
   // NB -- not used in epub2txt
-  if (_wraptext_is_newline (c))
+  if (newline)
     {
     }
   else
     {
-    if (_wraptext_is_white (c))
+    if (white)
       context->priv->white_count++;
     else
       context->priv->white_count = 0;
@@ -211,7 +635,7 @@ void _wraptext_wrap_next (WrapTextContext *context, const WT_UTF32 c)
   
   // STATE_START
 
-  if (state == WT_STATE_START && _wraptext_is_newline (c))
+  if (state == WT_STATE_START && newline)
      {
      //printf ("!");
      // Double blank line -- respect this as a para separator
@@ -226,14 +650,15 @@ void _wraptext_wrap_next (WrapTextContext *context, const WT_UTF32 c)
        }
      state = WT_STATE_WHITE;
      }
-  else if (state == WT_STATE_START && _wraptext_is_white (c))
+  else if (state == WT_STATE_START && white)
      {
      // Space at the beginning of the line
      // Do nothing yet TODO
      }
   else if (state == WT_STATE_START)
      {
-     _wraptext_append_token (context, c);
+     _wraptext_append_token (context, c, width);
+     context->priv->lb_last = lb_start;
      state = WT_STATE_WORD;
      }
 
@@ -241,40 +666,58 @@ void _wraptext_wrap_next (WrapTextContext *context, const WT_UTF32 c)
 
   else if (state == WT_STATE_WORD && c == WT_HARD_LINE_BREAK)
      {
-     _wraptext_flush_token (context);
+     _wraptext_flush_token (context, TRUE);
      _wraptext_new_line (context);
      state = WT_STATE_START;
      }
-  else if (state == WT_STATE_WORD && _wraptext_is_newline (c))
+  else if (state == WT_STATE_WORD && newline)
      {
-     _wraptext_flush_token (context);
+     _wraptext_flush_token (context, TRUE);
      state = WT_STATE_START;
      }
-  else if (state == WT_STATE_WORD && _wraptext_is_white (c))
+  else if (state == WT_STATE_WORD && white)
      {
-     _wraptext_flush_token (context);
+     // Whether the line can break at these spaces depends on what
+     //   follows them, so the token is kept until then
      state = WT_STATE_WHITE;
      }
   else if (state == WT_STATE_WORD)
      {
-     _wraptext_append_token (context, c);
+     // UAX #14: the line can also break where there is no space, such
+     //   as after a hyphen, or between two CJK ideographs
+     UnipropsBreak action = uniprops_lb_break (context->priv->lb_last, lb);
+     if (action == UNIPROPS_BREAK_DIRECT)
+       _wraptext_flush_token (context, FALSE);
+     _wraptext_append_token (context, c, width);
+     if (action != UNIPROPS_BREAK_COMBINING)
+       context->priv->lb_last = lb;
      state = WT_STATE_WORD;
      }
   
   // STATE_WHITE
 
-  else if (state == WT_STATE_WHITE && _wraptext_is_newline (c))
+  else if (state == WT_STATE_WHITE && newline)
      {
-     _wraptext_flush_token (context);
+     _wraptext_flush_token (context, TRUE);
      state = WT_STATE_START;
      }
-  else if (state == WT_STATE_WHITE && _wraptext_is_white (c))
+  else if (state == WT_STATE_WHITE && white)
      {
      state = WT_STATE_WHITE;
      }
   else if (state == WT_STATE_WHITE)
      {
-     _wraptext_append_token (context, c);
+     if (context->priv->token_len > 0 && uniprops_lb_break 
+           (context->priv->lb_last, lb) == UNIPROPS_BREAK_PROHIBITED)
+       {
+       // No break at these spaces, as before "!" or after "(", so
+       //   they become part of the token, as one space
+       _wraptext_append_token (context, ' ', 1);
+       }
+     else
+       _wraptext_flush_token (context, TRUE);
+     _wraptext_append_token (context, c, width);
+     context->priv->lb_last = lb_start;
      state = WT_STATE_WORD;
      }
   
@@ -292,8 +735,20 @@ void _wraptext_wrap_next (WrapTextContext *context, const WT_UTF32 c)
 
 void wraptext_eof (WrapTextContext *context)
   {
-  // Handle any input that has not been handled already
-  _wraptext_flush_token (context);
+  // Handle any input that has not been handled already, and write out
+  //   what there is of the line, so that it is in order with anything 
+  //   the caller writes directly
+  _wraptext_flush_token (context, TRUE);
+  _wraptext_flush_line (context);
+  }
+
+
+void wraptext_finish (WrapTextContext *context)
+  {
+  // As wraptext_eof, but the end of the paragraph as well
+  _wraptext_flush_token (context, TRUE);
+  _wraptext_para_layout (context);
+  _wraptext_flush_line (context);
   }
 
 
@@ -312,7 +767,6 @@ void wraptext_easy_stdout_utf32 (const int width, const WT_UTF32 *utf32,
      int flags)
   {
   WrapTextContext *context = wraptext_context_new();
-  wraptext_context_set_output_fn (context, _stdout_output_fn);
   wraptext_context_set_flags (context, flags);
   wraptext_context_set_width (context, width);
   wraptext_wrap_utf32 (context, utf32);
@@ -330,7 +784,7 @@ WrapTextContext *wraptext_context_new (void)
   self->priv = priv;
   self->priv->width = 80;
   self->priv->blank_line = TRUE; // Assume that we are starting on a new line
-  self->priv->outputFn = _stdout_output_fn;
+  self->priv->outputFn = NULL; // Line-buffered stdout
   wraptext_context_reset (self);
   return self;
   }
@@ -344,8 +798,14 @@ void wraptext_context_reset (WrapTextContext *self)
   self->priv->white_count = 0;
   self->priv->fmt = 0;
   self->priv->blank_line = TRUE;
-  if (self->priv->token) free (self->priv->token);
-  self->priv->token = NULL;
+  self->priv->token_len = 0;
+  self->priv->token_width = 0;
+  self->priv->lb_last = UNIPROPS_LB_XX;
+  self->priv->line_len = 0;
+  self->priv->box_count = 0;
+  self->priv->box_column = 0;
+  self->priv->para_len = 0;
+  self->priv->esc_len = 0;
   }
 
 
@@ -361,6 +821,12 @@ void wraptext_context_set_width (WrapTextContext *self, int width)
   self->priv->width = width;
   }
 
+void wraptext_context_set_hyphenator (WrapTextContext *self, 
+    struct _Hyphenator *hyph)
+  {
+  self->priv->hyph = hyph;
+  }
+
 void wraptext_context_set_flags (WrapTextContext *self, int flags)
   {
   self->priv->flags = flags;
@@ -406,6 +872,16 @@ void wraptext_context_free (WrapTextContext *self)
   if (!self) return;
   if (self->priv)
     {
+    free (self->priv->token);
+    free (self->priv->line);
+    free (self->priv->boxes);
+    free (self->priv->para);
+    free (self->priv->esc);
+    free (self->priv->offsets);
+    free (self->priv->minima);
+    free (self->priv->breaks);
+    free (self->priv->cands);
+    free (self->priv->froms);
     free (self->priv);
     self->priv = NULL;
     }
@@ -16,12 +16,21 @@
 // Hard line break should be an unusued code point
 #define WT_HARD_LINE_BREAK 9999
 
+// Flags for wraptext_context_set_flags
+// Lay out each paragraph as a whole, to make the lines as even as 
+//   possible, rather than filling each line in turn
+#define WT_FLAG_OPTIMAL 0x0001
+
 typedef uint32_t WT_UTF32;
 typedef char WT_UTF8;
 
-typedef void (*WrapTextOutputFn) (void *app_data, WT_UTF32 c);
+// Called with each run of characters to output, if set; the default 
+//   is to write whole lines to stdout
+typedef void (*WrapTextOutputFn) (void *app_data, const WT_UTF32 *s, 
+  int len);
 
 struct _WrapTextContextPriv;
+struct _Hyphenator;
 
 typedef struct _WrapTextContext
   {
@@ -52,12 +61,21 @@ void wraptext_context_set_flags (WrapTextContext *self, int flags);
 
 void wraptext_context_set_width (WrapTextContext *self, int width);
 
+// Words that won't fit on a line are hyphenated, if hyph is not NULL. 
+//   The caller still owns it.
+void wraptext_context_set_hyphenator (WrapTextContext *self, 
+  struct _Hyphenator *hyph);
+
 void wraptext_context_set_app_data (WrapTextContext *self, void *app_data);
 
 void wraptext_context_reset (WrapTextContext *self);
 
 void wraptext_eof (WrapTextContext *context);
 
+void wraptext_finish (WrapTextContext *context);
+
+void wraptext_emit_bytes (WrapTextContext *context, const char *s);
+
 WT_UTF32 *wraptext_convert_utf8_to_utf32 (const WT_UTF8 *utf8);
 
 const int wraptext_utf32_length (const WT_UTF32 *s);
@@ -15,16 +15,54 @@
 #include <errno.h> 
 #include <string.h> 
 #include "wstring.h"
-#include "string.h"
 #include "convertutf.h"
+#include "encode.h"
 #include "log.h"
 
+// The smallest buffer, in characters, that a string grows to
+#define WSTRING_MIN_SIZE 16
+
+// str is always terminated with a zero, which is not counted in length,
+//   but is in size
 struct _WString
   {
   uint32_t *str;
+  int length;
+  int size;
   }; 
 
 
+/*============================================================================
+  wstring_reserve
+  Make room for n more characters, and the terminator. The buffer at 
+    least doubles each time it grows, so that appending is amortized 
+    constant time
+============================================================================*/
+static void wstring_reserve (WString *self, int n)
+  {
+  if (self->length + n + 1 <= self->size) return;
+  int size = self->size < WSTRING_MIN_SIZE ? WSTRING_MIN_SIZE : self->size;
+  while (size < self->length + n + 1) size *= 2;
+  self->str = realloc (self->str, size * sizeof (uint32_t));
+  self->size = size;
+  }
+
+
+/*============================================================================
+  wstring_take_utf32
+  Make self's text the UTF-32 buffer s, of which size characters were 
+    allocated
+============================================================================*/
+static void wstring_take_utf32 (WString *self, uint32_t *s, int size)
+  {
+  int l = 0;
+  while (s[l]) l++;
+  self->str = s;
+  self->length = l;
+  self->size = size;
+  }
+
+
 /*============================================================================
   wstring_convert_utf8_to_utf32
 ===========================================================================*/
@@ -53,8 +91,10 @@ uint32_t *wstring_convert_utf8_to_utf32 (const char *_in)
 WString *wstring_create_empty (void)
   {
   WString *self = malloc (sizeof (WString));
-  self->str = malloc (sizeof (uint32_t));
+  self->str = malloc (WSTRING_MIN_SIZE * sizeof (uint32_t));
   self->str[0] = 0;
+  self->length = 0;
+  self->size = WSTRING_MIN_SIZE;
   return self;
   }
 
@@ -66,7 +106,8 @@ WString *wstring_create_empty (void)
 WString *wstring_create_from_utf8 (const char *s)
   {
   WString *self = malloc (sizeof (WString));
-  self->str = wstring_convert_utf8_to_utf32 (s);
+  wstring_take_utf32 (self, wstring_convert_utf8_to_utf32 (s), 
+    strlen (s) + 1);
   return self;
   }
 
@@ -93,10 +134,11 @@ BOOL wstring_create_from_utf8_file (const char *filename,
     buff[n] = 0;
 
     // Might need to skip a UTF-8 BOM when reading file
+    const char *text = buff;
     if (buff[0] == (char)0xEF && buff[1] == (char)0xBB && buff[2] == (char)0xBF)
-      self->str = wstring_convert_utf8_to_utf32 (buff + 3);
-    else
-      self->str = wstring_convert_utf8_to_utf32 (buff);
+      text += 3;
+    wstring_take_utf32 (self, wstring_convert_utf8_to_utf32 (text), 
+      strlen (text) + 1);
 
     free (buff);
 
@@ -120,23 +162,8 @@ BOOL wstring_create_from_utf8_file (const char *filename,
 ============================================================================*/
 const int wstring_length (const WString *self)
   {
-  IN
-  if (!self) 
-    {
-    OUT
-    return 0;
-    }
-  uint32_t *s = self->str;
-  int i = 0;
-  uint32_t c = 0;
-  do
-    {
-    c = s[i];
-    i++;
-    } while (c != 0);
-  int ret = i - 1;
-  return ret;
-  OUT
+  if (!self) return 0;
+  return self->length;
   }
 
 
@@ -169,14 +196,9 @@ const uint32_t *wstring_wstr (const WString *self)
 ============================================================================*/
 char *wstring_to_utf8 (const WString *self)
   {
-  const uint32_t *s = self->str;
-  String *temp = string_create_empty();
-  int i, l = wstring_length (self);
-  for (i = 0; i < l; i++)
-     string_append_c (temp, s[i]);
-
-  char *ret = strdup (string_cstr (temp));
-  string_destroy (temp);
+  int l = self->length;
+  char *ret = malloc (l * ENCODE_UTF8_MAX + 1);
+  ret[encode_utf8 (self->str, l, ret)] = 0;
   return ret;
   }
 
@@ -186,10 +208,12 @@ char *wstring_to_utf8 (const WString *self)
 ============================================================================*/
 void wstring_append_c (WString *self, const uint32_t c)
   {
-  int l = wstring_length (self);
-  self->str = realloc (self->str, (l + 2) * sizeof (uint32_t));
-  self->str[l] = c;
-  self->str[l+1] = 0; 
+  // A zero would end the string, so it can't be part of it
+  if (c == 0) return;
+  if (self->length + 1 >= self->size)
+    wstring_reserve (self, 1);
+  self->str[self->length++] = c;
+  self->str[self->length] = 0; 
   }
 
 
@@ -198,23 +222,40 @@ void wstring_append_c (WString *self, const uint32_t c)
 ============================================================================*/
 void wstring_append (WString *self, const WString *other)
   {
-  int mylen = wstring_length (self);
-  int otherlen = wstring_length (other);
-  self->str = realloc (self->str, (mylen + otherlen + 1) * sizeof (uint32_t));
+  int otherlen = other->length;
+  wstring_reserve (self, otherlen);
+  // other may be self, so it is read only after the realloc
+  memcpy (self->str + self->length, other->str, 
+    otherlen * sizeof (uint32_t));
+  self->length += otherlen;
+  self->str[self->length] = 0; 
+  }
+
+
+/*============================================================================
+  wstring_append_ascii
+  Append len bytes of ASCII text, which need no decoding
+============================================================================*/
+void wstring_append_ascii (WString *self, const char *s, int len)
+  {
+  wstring_reserve (self, len);
+  uint32_t *d = self->str + self->length;
   int i;
-  for (i = 0; i < otherlen; i++)
-    self->str[mylen+i] = other->str[i];
-  self->str[mylen+i] = 0; 
+  for (i = 0; i < len; i++)
+    d[i] = (BYTE)s[i];
+  self->length += len;
+  self->str[self->length] = 0; 
   }
 
 
 /*============================================================================
   wstring_clear
+  The buffer is kept, for the next text, which is likely to be about as
+    long
 ============================================================================*/
 void  wstring_clear (WString *self)
   {
-  free (self->str);
-  self->str = malloc (sizeof (uint32_t));
+  self->length = 0;
   self->str[0] = 0;
   }
 
@@ -224,7 +265,7 @@ void  wstring_clear (WString *self)
 ============================================================================*/
 BOOL wstring_is_whitespace (const WString *self)
   {
-  int l = wstring_length (self);
+  int l = self->length;
   uint32_t *s = self->str;
   int i;
   for (i = 0; i < l; i++)
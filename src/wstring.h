@@ -22,6 +22,7 @@ const uint32_t *wstring_wstr (const WString *self);
 char           *wstring_to_utf8 (const WString *self);
 void            wstring_append_c (WString *self, const uint32_t c);
 void            wstring_append (WString *self, const WString *other);
+void            wstring_append_ascii (WString *self, const char *s, int len);
 void            wstring_clear (WString *self);
 // Note the an empty string is _not_ whitespace
 BOOL            wstring_is_whitespace (const WString *self);
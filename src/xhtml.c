@@ -9,7 +9,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
 #include <limits.h>
+#include <ctype.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #ifndef __APPLE__
@@ -20,8 +23,23 @@
 #include "string.h"
 #include "wstring.h"
 #include "wrap.h"
+#include "atoms.h"
+#include "entities.h"
+#include "scan.h"
+#include "translit.h"
+#include "encode.h"
 #include "xhtml.h"
 
+// Longest entity name we will try to translate, 
+//   e.g., &CounterClockwiseContourIntegral;
+#define XHTML_MAX_ENTITY 32
+
+// Longest tag, including its attributes, that we will try to interpret
+#define XHTML_MAX_TAG 1000
+
+// Size of the chunks in which an XHTML file is read
+#define XHTML_CHUNK 65536
+
 /*============================================================================
   Format definition stuff 
 ============================================================================*/
@@ -40,136 +58,68 @@ enum { FMT_BOLD = 1 << 0,
        FMT_ITAL = 1 << 1 };
 
 /*============================================================================
-  xhtml_is_start_format_tag
-============================================================================*/
-BOOL xhtml_is_start_format_tag (const char *tag, Format *format)
-  {
-  if (strcasecmp (tag, "b") == 0) 
-     {
-     *format = FORMAT_BOLD_ON;
-     return TRUE;
-     }
-  if (strcasecmp (tag, "i") == 0) 
-     {
-     *format = FORMAT_ITALIC_ON;
-     return TRUE;
-     }
-  return FALSE;
-  }
-
-
-/*============================================================================
-  xhtml_is_end_breaking_tag
-============================================================================*/
-BOOL xhtml_is_end_breaking_tag (const char *tag, Format *format)
-  {
-  if (strcasecmp (tag, "/h1") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/h2") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/h3") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/h4") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/h5") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/div") == 0) 
-    {
-    *format = FORMAT_NONE;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/blockquote") == 0) 
-    {
-    *format = FORMAT_NONE;
-    return TRUE;
-    }
-  return FALSE;
-  }
-
-
-/*============================================================================
-  xhtml_is_end_format_tag
+  Tag classification
+  What the formatter does for the start, end, and empty (<tag/>) forms 
+    of the elements that it knows about, indexed by the atom for the tag
+    name. Any other element does nothing.
 ============================================================================*/
-BOOL xhtml_is_end_format_tag (const char *tag, Format *format)
+typedef enum { TAG_NONE = 0, 
+               TAG_BODY, TAG_UNBODY,      // Start and end of body text
+               TAG_PARA,                  // End of paragraph
+               TAG_LINE,                  // Line break
+               TAG_FORMAT,                // Inline format change 
+               TAG_BLOCK, TAG_UNBLOCK,    // Start and end of heading, etc
+               TAG_RUBY, TAG_UNRUBY,      
+               TAG_RT, TAG_UNRT,
+               TAG_SKIP,                  // Ignore everything inside
+               TAG_HIDE } TagAction;      // Ignore the text inside
+
+typedef struct 
   {
-  if (strcasecmp (tag, "/b") == 0) 
-    {
-    *format = FORMAT_BOLD_OFF;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "/i") == 0) 
-    {
-    *format = FORMAT_ITALIC_OFF;
-    return TRUE;
-    }
-  return FALSE;
-  }
-
-
-/*============================================================================
-  xhtml_is_start_breaking_tag
-============================================================================*/
-BOOL xhtml_is_start_breaking_tag (const char *tag, Format *format)
+  BYTE start;         // TagAction
+  BYTE end;
+  BYTE empty;
+  BYTE start_format;  // Format
+  BYTE end_format;
+  } XhtmlTag;
+
+static const XhtmlTag xhtml_tags[ATOM_COUNT] =
   {
-  if (strcasecmp (tag, "h1") == 0) 
-    {
-    *format = FORMAT_BOLD_ON;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "h2") == 0) 
-    {
-    *format = FORMAT_BOLD_ON;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "h3") == 0) 
-    {
-    *format = FORMAT_BOLD_ON;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "h4") == 0) 
-    {
-    *format = FORMAT_BOLD_ON;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "h5") == 0) 
-    {
-    *format = FORMAT_BOLD_ON;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "div") == 0) 
-    {
-    *format = FORMAT_NONE;
-    return TRUE;
-    }
-  if (strcasecmp (tag, "blockquote") == 0) 
-    {
-    *format = FORMAT_NONE;
-    return TRUE;
-    }
-  return FALSE;
-  }
-
+  [ATOM_BODY] = { TAG_BODY, TAG_UNBODY, TAG_NONE, 0, 0 },
+  [ATOM_P] = { TAG_NONE, TAG_PARA, TAG_PARA, 0, 0 },
+  [ATOM_BR] = { TAG_LINE, TAG_NONE, TAG_LINE, 0, 0 },
+  [ATOM_B] = { TAG_FORMAT, TAG_FORMAT, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_I] = { TAG_FORMAT, TAG_FORMAT, TAG_NONE, 
+       FORMAT_ITALIC_ON, FORMAT_ITALIC_OFF },
+  [ATOM_H1] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_H2] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_H3] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_H4] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_H5] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_BOLD_ON, FORMAT_BOLD_OFF },
+  [ATOM_DIV] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_NONE, FORMAT_NONE },
+  [ATOM_BLOCKQUOTE] = { TAG_BLOCK, TAG_UNBLOCK, TAG_NONE, 
+       FORMAT_NONE, FORMAT_NONE },
+  [ATOM_RUBY] = { TAG_RUBY, TAG_UNRUBY, TAG_NONE, 0, 0 },
+  [ATOM_RT] = { TAG_RT, TAG_UNRT, TAG_NONE, 0, 0 },
+  [ATOM_SCRIPT] = { TAG_SKIP, TAG_NONE, TAG_NONE, 0, 0 },
+  [ATOM_STYLE] = { TAG_SKIP, TAG_NONE, TAG_NONE, 0, 0 },
+  [ATOM_SVG] = { TAG_HIDE, TAG_NONE, TAG_NONE, 0, 0 },
+  [ATOM_MATH] = { TAG_HIDE, TAG_NONE, TAG_NONE, 0, 0 },
+  };
 
 
 /*============================================================================
   xhtml_emit_format
 ============================================================================*/
-void xhtml_emit_format (const Epub2TxtOptions *options, Format format)
+void xhtml_emit_format (WrapTextContext *context, 
+      const Epub2TxtOptions *options, Format format)
   {
   IN
   
@@ -178,16 +128,16 @@ void xhtml_emit_format (const Epub2TxtOptions *options, Format format)
     switch (format)
       {
       case FORMAT_BOLD_ON:
-	 printf ("\x1B[1m"); break;
+	 wraptext_emit_bytes (context, "\x1B[1m"); break;
 
       case FORMAT_BOLD_OFF:
-	 printf ("\x1B[0m"); break;
+	 wraptext_emit_bytes (context, "\x1B[0m"); break;
 
       case FORMAT_ITALIC_ON:
-	printf ("\x1B[3m"); break;
+	wraptext_emit_bytes (context, "\x1B[3m"); break;
 
       case FORMAT_ITALIC_OFF:
-	 printf ("\x1B[0m"); break;
+	 wraptext_emit_bytes (context, "\x1B[0m"); break;
 
       case FORMAT_NONE:
 	 break;
@@ -197,14 +147,14 @@ void xhtml_emit_format (const Epub2TxtOptions *options, Format format)
       case FORMAT_H3_ON:
       case FORMAT_H4_ON:
       case FORMAT_H5_ON:
-	 printf ("\x1B[1m"); break;
+	 wraptext_emit_bytes (context, "\x1B[1m"); break;
 
       case FORMAT_H1_OFF:
       case FORMAT_H2_OFF:
       case FORMAT_H3_OFF:
       case FORMAT_H4_OFF:
       case FORMAT_H5_OFF:
-	 printf ("\x1B[0m"); break;
+	 wraptext_emit_bytes (context, "\x1B[0m"); break;
 
       }
     }
@@ -224,7 +174,7 @@ void xhtml_emit_fmt_eol_pre (WrapTextContext *context)
   if (options->ansi && !options->raw && fmt)
     {
     /* reset ANSI escape-sequence at EOL. */
-    xhtml_emit_format (options, FORMAT_BOLD_OFF);
+    xhtml_emit_format (context, options, FORMAT_BOLD_OFF);
     }
   OUT
   }
@@ -243,10 +193,10 @@ void xhtml_emit_fmt_eol_post (WrapTextContext *context)
     {
     /* turn those set, back on at BOL. */
     if (fmt & FMT_BOLD)
-      xhtml_emit_format (options, FORMAT_BOLD_ON);
+      xhtml_emit_format (context, options, FORMAT_BOLD_ON);
     if (fmt & FMT_ITAL)
       {
-      xhtml_emit_format (options, FORMAT_ITALIC_ON);
+      xhtml_emit_format (context, options, FORMAT_ITALIC_ON);
       }
     }
   OUT
@@ -308,286 +258,164 @@ void xhtml_set_format (const Epub2TxtOptions *options, Format format, WrapTextCo
 
 
 /*============================================================================
-  xhtml_transform_char
+  xhtml_append_char
+  Append a character of the text to dest or, with --ascii, its ASCII
+    replacement, if it has one
 ============================================================================*/
-WString *xhtml_transform_char (uint32_t c, BOOL to_ascii)
+static void xhtml_append_char (WString *dest, uint32_t c, BOOL to_ascii)
   {
-  WString *ret = wstring_create_empty();
   if (to_ascii && c > 127) // No ASCII chars will need transforming
     {
-    if (c == 0x00B4) return wstring_create_from_utf8 ("\'");
-    if (c == 0x0304) return wstring_create_from_utf8 ("-");
-    if (c == 0x2010) return wstring_create_from_utf8 ("-");
-    if (c == 0x2013) return wstring_create_from_utf8 ("-");
-    if (c == 0x2014) return wstring_create_from_utf8 ("-");
-    if (c == 0x2018) return wstring_create_from_utf8 ("'");
-    if (c == 0x2019) return wstring_create_from_utf8 ("\'");
-    if (c == 0x201C) return wstring_create_from_utf8 ("\"");
-    if (c == 0x201D) return wstring_create_from_utf8 ("\"");
-    if (c == 0xC2A0) return wstring_create_from_utf8 ("(c)"); // copyright 
-    if (c == 0x00A9) return wstring_create_from_utf8 ("(c)"); // ditto
-    if (c == 0xC2A9) return wstring_create_from_utf8 (" "); // nbsp
-    if (c == 0x00A0) return wstring_create_from_utf8 (" "); // nbsp
-    if (c == 0x2026) return wstring_create_from_utf8 (",,,"); // elipsis 
-    if (c == 0x2022) return wstring_create_from_utf8 ("."); // dot
-    if (c == 0x00B5) return wstring_create_from_utf8 ("u"); // mu
-    if (c == 0x00C0) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C1) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C2) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C3) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C4) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C5) return wstring_create_from_utf8 ("A"); // accented A 
-    if (c == 0x00C6) return wstring_create_from_utf8 ("AE"); // accented A 
-    if (c == 0x00C7) return wstring_create_from_utf8 ("C"); // cedilla 
-    if (c == 0x00C8) return wstring_create_from_utf8 ("E"); // accented E
-    if (c == 0x00C9) return wstring_create_from_utf8 ("E"); // accented E
-    if (c == 0x00CA) return wstring_create_from_utf8 ("E"); // accented E
-    if (c == 0x00CB) return wstring_create_from_utf8 ("E"); // accented E
-    if (c == 0x00CC) return wstring_create_from_utf8 ("I"); // accented I
-    if (c == 0x00CD) return wstring_create_from_utf8 ("I"); // accented I
-    if (c == 0x00CE) return wstring_create_from_utf8 ("I"); // accented I
-    if (c == 0x00CF) return wstring_create_from_utf8 ("I"); // accented I
-    if (c == 0x00D0) return wstring_create_from_utf8 ("D"); // accented D
-    if (c == 0x00D1) return wstring_create_from_utf8 ("N"); // accented N
-    if (c == 0x00D2) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D3) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D4) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D5) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D6) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D7) return wstring_create_from_utf8 ("x"); // Multiply 
-    if (c == 0x00D8) return wstring_create_from_utf8 ("O"); // accented O
-    if (c == 0x00D9) return wstring_create_from_utf8 ("U"); // accented U
-    if (c == 0x00DA) return wstring_create_from_utf8 ("U"); // accented U
-    if (c == 0x00DB) return wstring_create_from_utf8 ("U"); // accented U
-    if (c == 0x00DC) return wstring_create_from_utf8 ("U"); // accented U
-    if (c == 0x00DD) return wstring_create_from_utf8 ("Y"); // accented Y
-    if (c == 0x00DE) return wstring_create_from_utf8 ("Y"); // thorn 
-    if (c == 0x00DF) return wstring_create_from_utf8 ("sz"); // esszet 
-    if (c == 0x00E0) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E1) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E2) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E3) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E4) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E5) return wstring_create_from_utf8 ("a"); // accepted a 
-    if (c == 0x00E6) return wstring_create_from_utf8 ("ae"); // ae
-    if (c == 0x00E7) return wstring_create_from_utf8 ("c"); // cedilla
-    if (c == 0x00E8) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x00E9) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x00EA) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x00EB) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x00EC) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x00ED) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x00EE) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x00EF) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x00F0) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F1) return wstring_create_from_utf8 ("n"); //a ceepnted n 
-    if (c == 0x00F2) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F3) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F4) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F5) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F6) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F7) return wstring_create_from_utf8 ("/"); // divide
-    if (c == 0x00F8) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x00F9) return wstring_create_from_utf8 ("u"); //a ceepnted u 
-    if (c == 0x00FA) return wstring_create_from_utf8 ("u"); //a ceepnted u 
-    if (c == 0x00FB) return wstring_create_from_utf8 ("u"); //a ceepnted u 
-    if (c == 0x00FC) return wstring_create_from_utf8 ("u"); //a ceepnted u 
-    if (c == 0x00FD) return wstring_create_from_utf8 ("y"); //a ceepnted y 
-    if (c == 0x00FE) return wstring_create_from_utf8 ("y"); //a thorn 
-    if (c == 0x00FF) return wstring_create_from_utf8 ("y"); //a ceepnted y 
-    if (c == 0x0100) return wstring_create_from_utf8 ("A"); //a ceepnted A 
-    if (c == 0x0101) return wstring_create_from_utf8 ("a"); //a ceepnted a 
-    if (c == 0x0102) return wstring_create_from_utf8 ("A"); //a ceepnted A 
-    if (c == 0x0103) return wstring_create_from_utf8 ("a"); //a ceepnted a 
-    if (c == 0x0104) return wstring_create_from_utf8 ("A"); //a ceepnted A 
-    if (c == 0x0105) return wstring_create_from_utf8 ("a"); //a ceepnted a 
-    if (c == 0x0106) return wstring_create_from_utf8 ("C"); //a ceepnted C 
-    if (c == 0x0107) return wstring_create_from_utf8 ("c"); //a ceepnted c 
-    if (c == 0x0108) return wstring_create_from_utf8 ("C"); //a ceepnted C 
-    if (c == 0x0109) return wstring_create_from_utf8 ("c"); //a ceepnted c 
-    if (c == 0x010A) return wstring_create_from_utf8 ("C"); //a ceepnted C 
-    if (c == 0x010B) return wstring_create_from_utf8 ("c"); //a ceepnted c 
-    if (c == 0x010C) return wstring_create_from_utf8 ("C"); //a ceepnted C 
-    if (c == 0x010D) return wstring_create_from_utf8 ("c"); //a ceepnted c 
-    if (c == 0x010E) return wstring_create_from_utf8 ("D"); //a ceepnted D 
-    if (c == 0x010F) return wstring_create_from_utf8 ("d"); //a ceepnted d 
-    if (c == 0x0110) return wstring_create_from_utf8 ("D"); //a ceepnted D 
-    if (c == 0x0111) return wstring_create_from_utf8 ("d"); //a ceepnted d 
-    if (c == 0x0112) return wstring_create_from_utf8 ("E"); //a ceepnted E 
-    if (c == 0x0113) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x0114) return wstring_create_from_utf8 ("E"); //a ceepnted E 
-    if (c == 0x0115) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x0116) return wstring_create_from_utf8 ("E"); //a ceepnted E 
-    if (c == 0x0117) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x0118) return wstring_create_from_utf8 ("E"); //a ceepnted E 
-    if (c == 0x0119) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x011A) return wstring_create_from_utf8 ("E"); //a ceepnted E 
-    if (c == 0x011B) return wstring_create_from_utf8 ("e"); //a ceepnted e 
-    if (c == 0x011C) return wstring_create_from_utf8 ("G"); //a ceepnted G 
-    if (c == 0x011D) return wstring_create_from_utf8 ("g"); //a ceepnted g 
-    if (c == 0x011E) return wstring_create_from_utf8 ("G"); //a ceepnted G 
-    if (c == 0x011F) return wstring_create_from_utf8 ("g"); //a ceepnted g 
-    if (c == 0x0120) return wstring_create_from_utf8 ("G"); //a ceepnted G 
-    if (c == 0x0121) return wstring_create_from_utf8 ("g"); //a ceepnted g 
-    if (c == 0x0122) return wstring_create_from_utf8 ("G"); //a ceepnted G 
-    if (c == 0x0123) return wstring_create_from_utf8 ("g"); //a ceepnted g 
-    if (c == 0x0124) return wstring_create_from_utf8 ("H"); //a ceepnted H 
-    if (c == 0x0125) return wstring_create_from_utf8 ("h"); //a ceepnted h 
-    if (c == 0x0126) return wstring_create_from_utf8 ("H"); //a ceepnted H 
-    if (c == 0x0127) return wstring_create_from_utf8 ("h"); //a ceepnted h 
-    if (c == 0x0128) return wstring_create_from_utf8 ("I"); //a ceepnted I 
-    if (c == 0x0129) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x012A) return wstring_create_from_utf8 ("I"); //a ceepnted I 
-    if (c == 0x012B) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x012C) return wstring_create_from_utf8 ("I"); //a ceepnted I 
-    if (c == 0x012D) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x012E) return wstring_create_from_utf8 ("I"); //a ceepnted I 
-    if (c == 0x012F) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x0130) return wstring_create_from_utf8 ("I"); //a ceepnted I 
-    if (c == 0x0131) return wstring_create_from_utf8 ("i"); //a ceepnted i 
-    if (c == 0x0132) return wstring_create_from_utf8 ("IJ"); 
-    if (c == 0x0133) return wstring_create_from_utf8 ("ij"); 
-    if (c == 0x0134) return wstring_create_from_utf8 ("J"); //a ceepnted J 
-    if (c == 0x0135) return wstring_create_from_utf8 ("j"); //a ceepnted j 
-    if (c == 0x0136) return wstring_create_from_utf8 ("K"); //a ceepnted K 
-    if (c == 0x0138) return wstring_create_from_utf8 ("K"); //a ceepnted K 
-    if (c == 0x0138) return wstring_create_from_utf8 ("k"); //a ceepnted k 
-    if (c == 0x0139) return wstring_create_from_utf8 ("L"); //a ceepnted L 
-    if (c == 0x013A) return wstring_create_from_utf8 ("l"); //a ceepnted l 
-    if (c == 0x013B) return wstring_create_from_utf8 ("L"); //a ceepnted L 
-    if (c == 0x013C) return wstring_create_from_utf8 ("l"); //a ceepnted l 
-    if (c == 0x013D) return wstring_create_from_utf8 ("L"); //a ceepnted L 
-    if (c == 0x013E) return wstring_create_from_utf8 ("l"); //a ceepnted l 
-    if (c == 0x013F) return wstring_create_from_utf8 ("L"); //a ceepnted L 
-    if (c == 0x0140) return wstring_create_from_utf8 ("l"); //a ceepnted l 
-    if (c == 0x0141) return wstring_create_from_utf8 ("L"); //a ceepnted L 
-    if (c == 0x0142) return wstring_create_from_utf8 ("l"); //a ceepnted l 
-    if (c == 0x0143) return wstring_create_from_utf8 ("N"); //a ceepnted N 
-    if (c == 0x0144) return wstring_create_from_utf8 ("n"); //a ceepnted N 
-    if (c == 0x0145) return wstring_create_from_utf8 ("N"); //a ceepnted N 
-    if (c == 0x0146) return wstring_create_from_utf8 ("n"); //a ceepnted N 
-    if (c == 0x0147) return wstring_create_from_utf8 ("N"); //a ceepnted N 
-    if (c == 0x0148) return wstring_create_from_utf8 ("n"); //a ceepnted N 
-    if (c == 0x0149) return wstring_create_from_utf8 ("N"); //a ceepnted N 
-    if (c == 0x014A) return wstring_create_from_utf8 ("n"); //a ceepnted N 
-    if (c == 0x014B) return wstring_create_from_utf8 ("n"); //a ceepnted n 
-    if (c == 0x014C) return wstring_create_from_utf8 ("O"); //a ceepnted O 
-    if (c == 0x014D) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x014E) return wstring_create_from_utf8 ("O"); //a ceepnted O 
-    if (c == 0x014F) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x0150) return wstring_create_from_utf8 ("O"); //a ceepnted O 
-    if (c == 0x0151) return wstring_create_from_utf8 ("o"); //a ceepnted o 
-    if (c == 0x0152) return wstring_create_from_utf8 ("OE"); 
-    if (c == 0x0153) return wstring_create_from_utf8 ("oe"); 
-    if (c == 0x0154) return wstring_create_from_utf8 ("R"); // accepted R
-    if (c == 0x0155) return wstring_create_from_utf8 ("r"); // accepted r
-    if (c == 0x0156) return wstring_create_from_utf8 ("R"); // accepted R
-    if (c == 0x0157) return wstring_create_from_utf8 ("r"); // accepted r
-    if (c == 0x0158) return wstring_create_from_utf8 ("R"); // accepted R
-    if (c == 0x0159) return wstring_create_from_utf8 ("r"); // accepted r
-    if (c == 0x015A) return wstring_create_from_utf8 ("S"); // accepted S
-    if (c == 0x015B) return wstring_create_from_utf8 ("s"); // accepted s
-    if (c == 0x015C) return wstring_create_from_utf8 ("S"); // accepted S
-    if (c == 0x015D) return wstring_create_from_utf8 ("s"); // accepted s
-    if (c == 0x015E) return wstring_create_from_utf8 ("S"); // accepted S
-    if (c == 0x015F) return wstring_create_from_utf8 ("s"); // accepted s
-    if (c == 0x0160) return wstring_create_from_utf8 ("S"); // accepted S
-    if (c == 0x0161) return wstring_create_from_utf8 ("s"); // accepted s
-    if (c == 0x0162) return wstring_create_from_utf8 ("T"); // accepted T
-    if (c == 0x0163) return wstring_create_from_utf8 ("t"); // accepted t
-    if (c == 0x0164) return wstring_create_from_utf8 ("T"); // accepted T
-    if (c == 0x0165) return wstring_create_from_utf8 ("t"); // accepted t
-    if (c == 0x0166) return wstring_create_from_utf8 ("T"); // accepted T
-    if (c == 0x0167) return wstring_create_from_utf8 ("t"); // accepted t
-    if (c == 0x0168) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x0169) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x016A) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x016B) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x016C) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x016D) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x016E) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x016F) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x0170) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x0171) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x0172) return wstring_create_from_utf8 ("U"); // accepted U
-    if (c == 0x0173) return wstring_create_from_utf8 ("u"); // accepted u
-    if (c == 0x0174) return wstring_create_from_utf8 ("W"); // accepted W
-    if (c == 0x0175) return wstring_create_from_utf8 ("w"); // accepted w
-    if (c == 0x0176) return wstring_create_from_utf8 ("Y"); // accepted Y
-    if (c == 0x0177) return wstring_create_from_utf8 ("y"); // accepted y
-    if (c == 0x0178) return wstring_create_from_utf8 ("Y"); // accepted Y
-    if (c == 0x00) return wstring_create_from_utf8 (""); // 
-    wstring_append_c (ret, c);
+    const char *r = translit_ascii (c);
+    if (r)
+      {
+      wstring_append_ascii (dest, r, strlen (r));
+      return;
+      }
     }
-  else
-    wstring_append_c (ret, c);
-  return ret; 
+  wstring_append_c (dest, c);
   }
 
 
+/*============================================================================
+  xhtml_c1
+  Numeric references to the C1 controls are taken to be Windows-1252, 
+    as they are by browsers. 0 means no change.
+============================================================================*/
+static const uint16_t xhtml_c1[32] =
+  {
+  0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+  0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178
+  };
+
+/*============================================================================
+  xhtml_translate_numeric
+  Translate a decimal (#8212) or hex (#x2014) reference. 
+============================================================================*/
+static int xhtml_translate_numeric (const char *name, int len, uint32_t *out)
+  {
+  int i = 1;
+  int base = 10;
+  uint32_t v = 0;
+  if (len > 1 && (name[1] == 'x' || name[1] == 'X'))
+    {
+    base = 16;
+    i = 2;
+    }
+  if (i >= len) return 0;
+  for (; i < len; i++)
+    {
+    int c = (BYTE)name[i];
+    int d;
+    if (c >= '0' && c <= '9')
+      d = c - '0';
+    else if (base == 16 && isxdigit (c))
+      d = tolower (c) - 'a' + 10;
+    else
+      return 0;
+    // Stop accumulating once out of range, so as not to overflow
+    if (v <= 0x10FFFF) v = v * base + d;
+    }
+  if (v == 0 || v > 0x10FFFF || (v >= 0xD800 && v <= 0xDFFF))
+    v = 0xFFFD;
+  else if (v >= 0x80 && v <= 0x9F && xhtml_c1[v - 0x80])
+    v = xhtml_c1[v - 0x80];
+  out[0] = v;
+  return 1;
+  }
+
 /*============================================================================
   xhtml_translate_entity
+  Translate the entity name, of len bytes and without the & and ;, into
+    the characters it stands for. Returns how many there are, at most 
+    ENTITIES_MAX_CHARS, or 0 if the name is not an entity; the caller
+    should then keep the original text.
 ============================================================================*/
-WString *xhtml_translate_entity (const WString *entity)
+int xhtml_translate_entity (const char *name, int len, uint32_t *out)
   {
-  /* Program flow in this function is very ugly, and prone to memory
-     leaks when modified. The whole thing needs to be rewritten */
-  char out[20];
-  IN
-  char *in = wstring_to_utf8 (entity);
-  if (strcasecmp (in, "amp") == 0) 
-    strcpy (out, "&");
-  else if (strcasecmp (in, "nbsp") == 0) 
-    strcpy (out, " ");
-  else if (strcasecmp (in, "lt") == 0) 
-    strcpy (out, "<");
-  else if (strcasecmp (in, "gt") == 0) 
-    strcpy (out, ">");
-  else if (strcasecmp (in, "cent") == 0) 
-    strcpy (out, "¢");
-  else if (strcasecmp (in, "pound") == 0) 
-    strcpy (out, "£");
-  else if (strcasecmp (in, "yen") == 0) 
-    strcpy (out, "£");
-  else if (strcasecmp (in, "euro") == 0) 
-    strcpy (out, "€");
-  else if (strcasecmp (in, "sect") == 0) 
-    strcpy (out, "§");
-  else if (strcasecmp (in, "copy") == 0) 
-    strcpy (out, "©");
-  else if (strcasecmp (in, "reg") == 0) 
-    strcpy (out, "®");
-  else if (strcasecmp (in, "trade") == 0) 
-    strcpy (out, "™");
-  else if (strcasecmp (in, "quot") == 0) 
-    strcpy (out, "\"");
-  else if (in[0] == '#')
-    {
-    char *s = strdup (in);
-    s[0] = '0';
-    int v = 0;
-    if (sscanf (s, "%d", &v) == 1)
-      {
-      WString *ret = wstring_create_empty();
-      wstring_append_c (ret, (uint32_t)v);
-      OUT
-      free (s);
-      free (in);
-      return ret; 
-      } 
-    free (s);
+  if (len > 1 && name[0] == '#')
+    return xhtml_translate_numeric (name, len, out);
+
+  int n = entities_lookup (name, len, out);
+  if (n == 0 && len <= XHTML_MAX_ENTITY)
+    {
+    // Names are case-sensitive, but we have always accepted &NBSP; and
+    //   the like, so try again in lower case
+    char lower[XHTML_MAX_ENTITY];
+    int i;
+    for (i = 0; i < len; i++) lower[i] = tolower ((BYTE)name[i]);
+    n = entities_lookup (lower, len, out);
     }
-  else 
+  return n;
+  }
+
+
+/*============================================================================
+  xhtml_utf8_to_plain
+  Reduce a fragment of XHTML to a single line of plain text: entities are
+    translated, tags are removed, and runs of whitespace are collapsed to 
+    a single space. The caller must free the result.
+============================================================================*/
+char *xhtml_utf8_to_plain (const char *s)
+  {
+  IN
+  String *out = string_create_empty();
+  BOOL space = FALSE;
+  while (*s)
     {
-    strncpy (out, in, sizeof (out) - 1);
-    out[sizeof (out) - 1] = 0;
+    if (*s == '<' && (isalpha ((unsigned char)s[1]) || s[1] == '/' 
+          || s[1] == '!' || s[1] == '?'))
+      {
+      // A tag separates words, like whitespace
+      const char *gt = strchr (s, '>');
+      if (gt)
+        {
+        space = string_length (out) > 0;
+        s = gt + 1;
+        continue;
+        }
+      }
+    if (isspace ((unsigned char)*s))
+      {
+      space = string_length (out) > 0;
+      s++;
+      continue;
+      }
+    if (space) string_append_byte (out, ' ');
+    space = FALSE;
+    const char *semi = NULL;
+    if (*s == '&')
+      {
+      const char *p;
+      for (p = s + 1; *p && p - s <= XHTML_MAX_ENTITY; p++)
+        {
+        if (*p == ';') { semi = p; break; }
+        if (!isalnum ((unsigned char)*p) && *p != '#') break;
+        }
+      }
+    uint32_t chars[ENTITIES_MAX_CHARS];
+    int n = 0;
+    if (semi && semi > s + 1)
+      n = xhtml_translate_entity (s + 1, semi - s - 1, chars);
+    if (n > 0)
+      {
+      string_append_utf32_span (out, chars, n);
+      s = semi + 1;
+      }
+    else
+      {
+      string_append_byte (out, (BYTE)*s);
+      s++;
+      }
     }
-  free (in);
+  char *ret = strdup (string_cstr (out));
+  string_destroy (out);
   OUT
-  return wstring_create_from_utf8 (out);
+  return ret;
   }
 
-
 /*============================================================================
   xhtml_flush_line
 ============================================================================*/
@@ -598,9 +426,7 @@ void xhtml_flush_line (const WString *para, const Epub2TxtOptions *options,
 
   if (options->raw)
     {
-    char *s = wstring_to_utf8 (para);
-    fputs (s, stdout); 
-    free (s);
+    encode_utf8_write (wstring_wstr (para), wstring_length (para), stdout);
     }
   else
     {
@@ -673,310 +499,942 @@ BOOL xhtml_all_white (WString *s)
 
 
 /*============================================================================
-  xhtml_utf8_to_stdout
+  XhtmlParser
+  The state of the tokenizer, between one chunk of input and the next.
+    A tag or entity, or a multi-byte UTF-8 sequence, may be split 
+    across chunks.
 ============================================================================*/
-void xhtml_utf8_to_stdout (const char *s, const Epub2TxtOptions *options, 
-       char **error)
+typedef enum {MODE_ANY=0, MODE_INTAG = 1, MODE_ENTITY = 2, 
+              MODE_SKIP = 3, 
+              MODE_TAGOPEN = 4,     // Just after a <, which may not be a tag
+              MODE_COUNT} Mode;
+
+/*============================================================================
+  Byte classes
+  The tokenizer only needs to tell apart the bytes that can change its
+    state, so it looks each byte up in this table once, and then looks
+    up what to do in xhtml_actions, by mode and class. 
+============================================================================*/
+typedef enum { C_TEXT = 0,   // Anything not listed below
+               C_CTRL,       // Other ASCII control characters
+               C_NUL,        // Ends the document
+               C_TAB,
+               C_NL,
+               C_CR,
+               C_LT,         // <
+               C_GT,         // >
+               C_AMP,        // &
+               C_SEMI,       // ;
+               C_HASH,       // #
+               C_MARK,       // / ! ?, which may follow < 
+               C_DIGIT,
+               C_ALPHA,
+               C_HIGH,       // Part of a multi-byte UTF-8 sequence
+               C_COUNT } ByteClass;
+
+#define T C_TEXT 
+#define X C_CTRL
+#define D C_DIGIT
+#define A C_ALPHA
+#define H C_HIGH
+static const BYTE xhtml_classes[256] =
+  {
+  C_NUL, X, X, X, X, X, X, X, X, C_TAB, C_NL, X, X, C_CR, X, X, 
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, 
+  T, C_MARK, T, C_HASH, T, T, C_AMP, T, T, T, T, T, T, T, T, C_MARK, 
+  D, D, D, D, D, D, D, D, D, D, T, C_SEMI, C_LT, T, C_GT, C_MARK, 
+  T, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, 
+  A, A, A, A, A, A, A, A, A, A, A, T, T, T, T, T, 
+  T, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, 
+  A, A, A, A, A, A, A, A, A, A, A, T, T, T, T, T, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, 
+  H, H, H, H, H, H, H, H, H, H, H, H, H, H, H, H 
+  };
+#undef T
+#undef X
+#undef D
+#undef A
+#undef H
+
+/*============================================================================
+  Actions
+  What the tokenizer does with a byte of each class, in each mode. 
+    MODE_SKIP is handled separately, a run of input at a time, so it
+    has no entries.
+============================================================================*/
+typedef enum { A_ERROR = 0, 
+               A_END,          // End of document
+               A_IGNORE,       // Drop the byte
+               A_TEXT,         // Body text
+               A_NEWLINE,      // Line break in the source: a space
+               A_UTF8,         // Start of a multi-byte character
+               A_OPEN_TAG,     // <
+               A_OPEN_ENTITY,  // &
+               A_TAG_CHAR,     // Part of the tag name or attributes 
+               A_TAG_END,      // >
+               A_NOT_TAG,      // A < that was just text
+               A_ENTITY_CHAR,  // Part of the entity name
+               A_ENTITY_END,   // ;
+               A_NOT_ENTITY    // An & that was just text
+             } Action;
+
+// The classes of the bytes that scan_plain_text() accepts
+#define XHTML_PLAIN ((1 << C_TEXT) | (1 << C_GT) | (1 << C_SEMI) \
+  | (1 << C_HASH) | (1 << C_MARK) | (1 << C_DIGIT) | (1 << C_ALPHA))
+
+static const BYTE xhtml_actions[MODE_COUNT][C_COUNT] =
+  {
+  [MODE_ANY] = 
+    {
+    [C_TEXT] = A_TEXT, [C_CTRL] = A_TEXT, [C_NUL] = A_END, [C_TAB] = A_TEXT, 
+    [C_NL] = A_NEWLINE, [C_CR] = A_IGNORE, [C_LT] = A_OPEN_TAG, 
+    [C_GT] = A_TEXT, [C_AMP] = A_OPEN_ENTITY, [C_SEMI] = A_TEXT, 
+    [C_HASH] = A_TEXT, [C_MARK] = A_TEXT, [C_DIGIT] = A_TEXT, 
+    [C_ALPHA] = A_TEXT, [C_HIGH] = A_UTF8
+    },
+  [MODE_INTAG] = 
+    {
+    [C_TEXT] = A_TAG_CHAR, [C_CTRL] = A_TAG_CHAR, [C_NUL] = A_END, [C_TAB] = A_TAG_CHAR, 
+    [C_NL] = A_TAG_CHAR, [C_CR] = A_IGNORE, [C_LT] = A_TAG_CHAR, 
+    [C_GT] = A_TAG_END, [C_AMP] = A_TAG_CHAR, [C_SEMI] = A_TAG_CHAR, 
+    [C_HASH] = A_TAG_CHAR, [C_MARK] = A_TAG_CHAR, [C_DIGIT] = A_TAG_CHAR, 
+    [C_ALPHA] = A_TAG_CHAR, [C_HIGH] = A_TAG_CHAR
+    },
+  [MODE_ENTITY] = 
+    {
+    [C_TEXT] = A_NOT_ENTITY, [C_CTRL] = A_NOT_ENTITY, [C_NUL] = A_END, [C_TAB] = A_NOT_ENTITY, 
+    [C_NL] = A_NOT_ENTITY, [C_CR] = A_IGNORE, [C_LT] = A_NOT_ENTITY, 
+    [C_GT] = A_NOT_ENTITY, [C_AMP] = A_NOT_ENTITY, 
+    [C_SEMI] = A_ENTITY_END, [C_HASH] = A_ENTITY_CHAR, 
+    [C_MARK] = A_NOT_ENTITY, [C_DIGIT] = A_ENTITY_CHAR, 
+    [C_ALPHA] = A_ENTITY_CHAR, [C_HIGH] = A_NOT_ENTITY
+    },
+  [MODE_TAGOPEN] = 
+    {
+    [C_TEXT] = A_NOT_TAG, [C_CTRL] = A_NOT_TAG, [C_NUL] = A_END, [C_TAB] = A_NOT_TAG, 
+    [C_NL] = A_NOT_TAG, [C_CR] = A_IGNORE, [C_LT] = A_NOT_TAG, 
+    [C_GT] = A_NOT_TAG, [C_AMP] = A_NOT_TAG, [C_SEMI] = A_NOT_TAG, 
+    [C_HASH] = A_NOT_TAG, [C_MARK] = A_TAG_CHAR, [C_DIGIT] = A_NOT_TAG, 
+    [C_ALPHA] = A_TAG_CHAR, [C_HIGH] = A_NOT_TAG
+    }
+  };
+
+// Longest text that ends a skipped part of the document
+#define XHTML_MAX_SKIP 16
+
+struct _XhtmlParser
+  {
+  const Epub2TxtOptions *options;
+  WrapTextContext *context;
+  char *buff;        // For reading files, XHTML_CHUNK bytes at a time
+  Mode mode;
+  BOOL inbody;
+  BOOL inruby;
+  BOOL done;         // Ignore the rest of the input
+  char tag[XHTML_MAX_TAG];
+  int taglen;
+  // In MODE_SKIP, the text that ends the skip, and how much of it has 
+  //   been seen. Letters must be lower case, and match either case. 
+  char skip[XHTML_MAX_SKIP];
+  int skip_len;
+  int skip_matched;
+  // Inside an svg or math element, whose text is not for us: its atom,
+  //   how deeply it is nested in itself, and whether it is in the body
+  Atom hide_atom;
+  int hide_depth;
+  BOOL hide_inbody;
+  char entity[XHTML_MAX_ENTITY];
+  int entitylen;
+  WString *para;
+  WString *ruby;
+  uint32_t last_c;
+  // A UTF-8 sequence in the body text that is not yet complete
+  uint32_t utf8_c;   // Code point so far
+  int utf8_len;      // Bytes so far; 0 if there is no sequence 
+  int utf8_need;     // Bytes in the whole sequence
+  BYTE utf8_lo;      // Range of the next byte, if the sequence is legal
+  BYTE utf8_hi;
+  };
+
+/*============================================================================
+  xhtml_parser_create
+============================================================================*/
+XhtmlParser *xhtml_parser_create (const Epub2TxtOptions *options)
   {
   IN
-  char *ss;
-  // This is all a bit ugly. The entity translation is in 
-  //  xhtml_to_stdout, which expects something that looks like a viable
-  //  XHTML file. There's no guarantee that the input to this function
-  //  will actually be a full XHTML file, so we must wrap it in a body
-  //  to fool xhtml_to_stdout. Ugh.
-  asprintf (&ss, "<body>%s</body>", s);
-  WString *sw = wstring_create_from_utf8 (ss); 
-  xhtml_to_stdout (sw, options, error);
-  wstring_destroy (sw);
-  free (ss);
+  XhtmlParser *self = malloc (sizeof (XhtmlParser));
+  memset (self, 0, sizeof (XhtmlParser));
+  self->context = wraptext_context_new();
+  self->para = wstring_create_empty();
+  self->ruby = wstring_create_empty();
+  xhtml_parser_reset (self, options);
   OUT
+  return self;
   }
 
 /*============================================================================
-  xhtml_file_to_stdout
+  xhtml_parser_reset
+  Make the parser ready for a new document, which may have different
+    options. The buffers that the parser and its wrap context have 
+    grown are kept, so a parser that is reused for every document does 
+    not have to allocate any more memory, once it has seen a few.
 ============================================================================*/
-void xhtml_file_to_stdout (const char *filename, const Epub2TxtOptions *options, 
-             char **error)
+void xhtml_parser_reset (XhtmlParser *self, const Epub2TxtOptions *options)
   {
   IN
-  log_debug ("Process XHTML file %s", filename);
-
-  WString *s;
-  wstring_create_from_utf8_file (filename, &s, error); 
-  if (*error == NULL)
-     {
-     xhtml_to_stdout (s, options, error);
-     wstring_destroy (s);
-     }
+  WrapTextContext *context = self->context;
+  WString *para = self->para;
+  WString *ruby = self->ruby;
+  char *buff = self->buff;
+  memset (self, 0, sizeof (XhtmlParser));
+  self->context = context;
+  self->para = para;
+  self->ruby = ruby;
+  self->buff = buff;
+  wstring_clear (para);
+  wstring_clear (ruby);
+
+  int width;
+  if (options->width <= 0)
+    width = INT_MAX;
+  else
+    width = options->width - 1;
+
+  self->options = options;
+  wraptext_context_reset (context);
+  wraptext_context_set_width (context, width);
+  wraptext_context_set_app_opts (context, (void *)options);
+  wraptext_context_set_flags (context, 
+    options->wrap == WRAP_OPTIMAL && options->width > 0 
+      ? WT_FLAG_OPTIMAL : 0);
+  wraptext_context_set_hyphenator (context, 
+    options->width > 0 && !options->raw ? options->hyphenator : NULL);
+
+  self->mode = MODE_ANY;
+  OUT
+  }
 
+/*============================================================================
+  xhtml_parser_release
+  Forget the options of the last document, and the hyphenator and 
+    other things that they point to, which the caller may be about to 
+    free. The parser must be reset before it is used again.
+============================================================================*/
+void xhtml_parser_release (XhtmlParser *self)
+  {
+  IN
+  self->options = NULL;
+  wraptext_context_set_app_opts (self->context, NULL);
+  wraptext_context_set_hyphenator (self->context, NULL);
   OUT
   }
 
 /*============================================================================
-  xhtml_to_stdout
+  xhtml_parser_destroy
 ============================================================================*/
-void xhtml_to_stdout (const WString *s, const Epub2TxtOptions *options, 
-             char **error)
+void xhtml_parser_destroy (XhtmlParser *self)
   {
   IN
-  log_debug ("Process XHTML string");
+  if (self)
+    {
+    wstring_destroy (self->para);
+    wstring_destroy (self->ruby);
+    wraptext_context_free (self->context);
+    free (self->buff);
+    free (self);
+    }
+  OUT
+  }
 
-  typedef enum {MODE_ANY=0, MODE_INTAG = 1, MODE_ENTITY = 2} Mode;
-
-  if (TRUE)
-     {
-     int width;
-     if (options->width <= 0)
-       width = INT_MAX;
-     else
-       width = options->width - 1;
-
-     WrapTextContext *context = wraptext_context_new();
-     wraptext_context_set_width (context, width);
-     wraptext_context_set_app_opts (context, (void *)options);
-
-     Mode mode = MODE_ANY;
-     BOOL inbody = FALSE;
-     BOOL can_newline = FALSE;
-     WString *tag = wstring_create_empty();
-     WString *entity = wstring_create_empty();
-     WString *para = wstring_create_empty();
-     WString *ruby = wstring_create_empty();
-     BOOL inruby = FALSE;
-     int i, l = wstring_length (s);
-     uint32_t last_c = 0;
-     int taglen = 0;
-
-     const uint32_t *text = wstring_wstr (s);
-     for (i = 0; i < l; i++)
-       {
-       uint32_t c = text[i];  
-       if (c == 13) // DOS EOL
-         continue;
-
-        if (c == 9) // Tab
-            c = ' ';
-
-	//printf ("c=%c %04x\n", (char)c, c);
-	if (mode == MODE_ANY && c == '<')
-	  {
-          taglen = 0;
-	  mode = MODE_INTAG;
-	  }
-	else if (mode == MODE_ANY && c == '\n')
-	  {
-	  if (inbody)
-	    {
-	    if (last_c != ' ')
-	      {
-	      wstring_append_c (para, ' ');
-	      }
-	    }
-	  }
-	else if (mode == MODE_ANY && c == '&')
-	  {
-	  mode = MODE_ENTITY;
-	  }
-	else if (mode == MODE_ANY)
-	  {
-	  if (inbody)
-	    {
-	    if (c == ' ' && last_c == ' ')
-	      {
-	      }
-	    else
-	      {
-	      WString *s = xhtml_transform_char (c, options->ascii);
-	      wstring_append (inruby ? ruby : para, s);
-	      wstring_destroy (s);
-	      }
-	    }
-	  }
-	else if (mode == MODE_ENTITY && c == ';')
-	  {
-	  if (inbody)
-	    {
-	    WString *trans = xhtml_translate_entity (entity);
-	    wstring_append (inruby ? ruby : para, trans);
-	    wstring_destroy (trans);
-	    }
-	  wstring_clear (entity);
-	  mode = MODE_ANY;
-	  }
-	else if (mode == MODE_ENTITY)
-	  {
-	  wstring_append_c (entity, c);
-	  }
-	else if (mode == MODE_INTAG && c == '>')
-	  {
-          taglen = 0;
-          Format format = FORMAT_NONE;
-	  char *ss_tag = wstring_to_utf8 (tag);
-	  char *p = strchr (ss_tag, ' ');
-	  if (p) *p = 0;
-	  if (strcasecmp (ss_tag, "body") == 0) 
-	    {
-	    inbody = TRUE;
-	    }
-	  else if (strcasecmp (ss_tag, "/body") == 0) 
-	    {
-	    if (xhtml_all_white (para))
-	      can_newline = FALSE; 
-	    else
-	      can_newline = TRUE; 
-	    xhtml_flush_para (para, options, context); 
-	    wstring_clear (para);
-	    if (can_newline)
-	      {
-	      xhtml_para_break (context, options);
-	      can_newline = FALSE;
-	      }
-	    inbody = FALSE;
-	    }
-	  else if ((strcasecmp (ss_tag, "p/") == 0) 
-	      || (strcasecmp (ss_tag, "/p") == 0))
-	    {
-	    if (inbody)
-	      {
-	      if (xhtml_all_white (para))
-		can_newline = FALSE; 
-	      else
-		{
-		can_newline = TRUE; 
-		}
-	      xhtml_flush_para (para, options, context);
-	      wstring_clear (para);
-	      if (can_newline)
-		{
-		xhtml_para_break (context, options);
-		can_newline = FALSE;
-		}
-	      }
-	    }
-	  else if ((strcasecmp (ss_tag, "br/") == 0) 
-	      || (strcasecmp (ss_tag, "br") == 0)
-	      || (strcasecmp (ss_tag, "br /") == 0))
-	    {
-	    if (inbody)
-	      {
-	      if (xhtml_all_white (para))
-		can_newline = FALSE; 
-	      else
-		can_newline = TRUE; 
-	      xhtml_flush_para (para, options, context);
-	      wstring_clear (para);
-	      if (can_newline)
-		{
-		xhtml_line_break (context);
-		can_newline = FALSE;
-		}
-	      }
-	    }
-	  else if (xhtml_is_start_format_tag (ss_tag, &format))
-	    {
-	    if (inbody)
-	      {
-	      xhtml_flush_line (para, options, context); 
-	      wstring_clear (para);
-              xhtml_emit_format (options, format);
-              xhtml_set_format (options, format, context);
-	      }
-	    }
-	  else if (xhtml_is_end_format_tag (ss_tag, &format))
-	    {
-	    if (inbody)
-	      {
-	      xhtml_flush_line (para, options, context); 
-              xhtml_emit_format (options, format);
-	      xhtml_set_format (options, format, context);
-	      wstring_clear (para);
-	      }
-            }
-	  else if (xhtml_is_end_breaking_tag (ss_tag, &format))
-	    {
-            xhtml_flush_line (para, options, context);
-            xhtml_emit_format (options, format);
-            xhtml_set_format (options, format, context);
-	    wstring_clear (para);
-	    xhtml_para_break (context, options);
-            }
+/*============================================================================
+  xhtml_parser_text
+  Add a character of body text to the paragraph, or to the ruby 
+    annotation
+============================================================================*/
+static void xhtml_parser_text (XhtmlParser *self, uint32_t c)
+  {
+  if (c == ' ' && self->last_c == ' ')
+    {
+    }
+  else
+    {
+    xhtml_append_char (self->inruby ? self->ruby : self->para, c, 
+      self->options->ascii);
+    }
+  self->last_c = c;
+  }
 
-	  else if (xhtml_is_start_breaking_tag (ss_tag, &format))
-	    {
-            xhtml_flush_line (para, options, context);
-	    wstring_clear (para);
-            xhtml_emit_format (options, format);
-            xhtml_set_format (options, format, context);
-            }
+/*============================================================================
+  xhtml_parser_utf8_start
+  Start a multi-byte UTF-8 sequence in the body text, with lead byte b. 
+    The allowed range of the second byte excludes overlong forms, 
+    surrogates, and code points above U+10FFFF. 
+============================================================================*/
+static void xhtml_parser_utf8_start (XhtmlParser *self, BYTE b)
+  {
+  self->utf8_lo = 0x80;
+  self->utf8_hi = 0xBF;
+  if (b >= 0xC2 && b <= 0xDF)
+    {
+    self->utf8_need = 2;
+    self->utf8_c = b & 0x1F;
+    }
+  else if (b >= 0xE0 && b <= 0xEF)
+    {
+    self->utf8_need = 3;
+    self->utf8_c = b & 0x0F;
+    if (b == 0xE0) self->utf8_lo = 0xA0;
+    if (b == 0xED) self->utf8_hi = 0x9F;
+    }
+  else if (b >= 0xF0 && b <= 0xF4)
+    {
+    self->utf8_need = 4;
+    self->utf8_c = b & 0x07;
+    if (b == 0xF0) self->utf8_lo = 0x90;
+    if (b == 0xF4) self->utf8_hi = 0x8F;
+    }
+  else
+    {
+    xhtml_parser_text (self, 0xFFFD);
+    return;
+    }
+  self->utf8_len = 1;
+  }
+
+/*============================================================================
+  xhtml_parser_utf8_abandon
+  An incomplete UTF-8 sequence is illegal. Its bytes so far are a
+    maximal subpart, as Unicode calls it, which stands for a single
+    U+FFFD; the byte that ended it is read afresh
+============================================================================*/
+static void xhtml_parser_utf8_abandon (XhtmlParser *self)
+  {
+  if (self->utf8_len > 0)
+    {
+    xhtml_parser_text (self, 0xFFFD);
+    self->utf8_len = 0;
+    }
+  }
 
-    else if (strcasecmp(ss_tag, "ruby") == 0)
+/*============================================================================
+  xhtml_parser_literal
+  Add the text of an & and what followed it, which turned out not to be 
+    an entity, as a browser would
+============================================================================*/
+static void xhtml_parser_literal (XhtmlParser *self, BOOL semicolon)
+  {
+  int i;
+  xhtml_parser_text (self, '&');
+  for (i = 0; i < self->entitylen; i++)
+    xhtml_parser_text (self, (BYTE)self->entity[i]);
+  if (semicolon)
+    xhtml_parser_text (self, ';');
+  self->entitylen = 0;
+  }
+
+/*============================================================================
+  xhtml_parser_entity
+  Add the entity that has been collected to the text 
+============================================================================*/
+static void xhtml_parser_entity (XhtmlParser *self)
+  {
+  uint32_t chars[ENTITIES_MAX_CHARS];
+  WString *dest = self->inruby ? self->ruby : self->para;
+  int i, n = xhtml_translate_entity (self->entity, self->entitylen, chars);
+  if (n > 0)
+    {
+    for (i = 0; i < n; i++)
+      xhtml_append_char (dest, chars[i], self->options->ascii);
+    }
+  else
+    xhtml_parser_literal (self, TRUE);
+  self->entitylen = 0;
+  }
+
+/*============================================================================
+  xhtml_parser_start_skip
+  Ignore everything up to and including the text end, which is the 
+    end of a comment or CDATA section, or the start of the end tag of 
+    a script or style element
+============================================================================*/
+static void xhtml_parser_start_skip (XhtmlParser *self, const char *end)
+  {
+  self->skip_len = strlen (end);
+  memcpy (self->skip, end, self->skip_len);
+  self->skip_matched = 0;
+  self->mode = MODE_SKIP;
+  }
+
+/*============================================================================
+  xhtml_parser_skip
+  Skip as much of the input from p to end as we can, and return where
+    to carry on. The end of the skip may be split between chunks, so 
+    the state of the match is kept in the parser. To jump ahead, the 
+    next place the end could start is found with memchr(), which the C
+    library vectorizes. The start of an end tag only ends the skip if 
+    the name ends there, so that </scriptx does not end a script; as 
+    the byte that shows this may be in the next chunk, the match is 
+    kept as complete until then.
+============================================================================*/
+static const BYTE *xhtml_parser_skip (XhtmlParser *self, const BYTE *p, 
+    const BYTE *end)
+  {
+  const char *pat = self->skip;
+  int len = self->skip_len;
+  int m = self->skip_matched;
+  BOOL tag = (pat[0] == '<');
+  BOOL found = FALSE;
+
+  while (p < end)
+    {
+    if (m == len)
       {
-      wstring_clear (ruby);
+      // The byte after the name is left for the tag
+      if (isspace (*p) || *p == '/' || *p == '>')
+        {
+        found = TRUE;
+        break;
+        }
+      m = 0;
+      }
+    if (m == 0)
+      {
+      const BYTE *q = memchr (p, pat[0], end - p);
+      if (!q) 
+        {
+        p = end;
+        break;
+        }
+      p = q + 1;
+      m = 1;
+      continue;
+      }
+    BYTE c = tolower (*p++);
+    if (c == pat[m])
+      {
+      if (++m == len && !tag)
+        {
+        found = TRUE;
+        break;
+        }
+      continue;
       }
-    else if (strcasecmp(ss_tag, "/ruby") == 0)
+    // Mismatch: find the longest start of pat that the text seen so far,
+    //   plus c, ends with. The patterns are short, so brute force does.
+    int k;
+    for (k = m; k > 0; k--)
       {
-        // Append concatenated ruby annotations
+      if (pat[k - 1] == c && memcmp (pat, pat + m - k + 1, k - 1) == 0)
+        break;
+      }
+    m = k;
+    }
+
+  self->skip_matched = m;
+  if (found)
+    {
+    self->skip_matched = 0;
+    self->last_c = pat[len - 1];
+    if (tag)
+      {
+      // The start of an end tag: let the tag be read in the usual way
+      self->taglen = len - 1;
+      memcpy (self->tag, pat + 1, len - 1);
+      self->mode = MODE_INTAG;
+      }
+    else
+      self->mode = MODE_ANY;
+    }
+  return p;
+  }
+
+/*============================================================================
+  xhtml_parser_end_tag
+  Act on the tag that has been collected, when its closing > is seen.
+    The name is looked up where it stands in the tag buffer. 
+============================================================================*/
+static void xhtml_parser_end_tag (XhtmlParser *self)
+  {
+  const Epub2TxtOptions *options = self->options;
+  WrapTextContext *context = self->context;
+  WString *para = self->para;
+  WString *ruby = self->ruby;
+  BOOL can_newline = FALSE;
+
+  const char *t = self->tag;
+  int len = self->taglen;
+  BOOL end = FALSE;
+  BOOL empty = FALSE;
+  self->taglen = 0;
+
+  if (len > 0 && t[0] == '/')
+    {
+    end = TRUE;
+    t++;
+    len--;
+    }
+  int n = 0;
+  while (n < len && t[n] != '/' && !isspace ((BYTE)t[n])) n++;
+  if (!end)
+    {
+    int k = len;
+    while (k > n && isspace ((BYTE)t[k - 1])) k--;
+    empty = (k > n && t[k - 1] == '/');
+    }
+
+  Atom atom = atoms_lookup_fold (t, n);
+  if (atom == ATOM_NONE) return;
+  if (self->hide_depth > 0)
+    {
+    // Only the hidden element's own tags count, so that one nested in 
+    //   it, as an svg may be, does not end it early
+    if (atom == self->hide_atom && !empty)
+      {
+      self->hide_depth += end ? -1 : 1;
+      if (self->hide_depth == 0) self->inbody = self->hide_inbody;
+      }
+    return;
+    }
+  const XhtmlTag *info = &xhtml_tags[atom];
+  TagAction action;
+  Format format; 
+  if (end)
+    {
+    action = info->end;
+    format = info->end_format;
+    }
+  else if (empty)
+    {
+    action = info->empty;
+    format = FORMAT_NONE;
+    }
+  else
+    {
+    action = info->start;
+    format = info->start_format;
+    }
+
+  switch (action)
+    {
+    case TAG_NONE:
+      break;
+
+    case TAG_BODY:
+      self->inbody = TRUE;
+      break;
+
+    case TAG_UNBODY:
+      if (xhtml_all_white (para))
+        can_newline = FALSE; 
+      else
+        can_newline = TRUE; 
+      xhtml_flush_para (para, options, context); 
+      wstring_clear (para);
+      if (can_newline)
+        {
+        xhtml_para_break (context, options);
+        can_newline = FALSE;
+        }
+      self->inbody = FALSE;
+      break;
+
+    case TAG_PARA:
+      if (self->inbody)
+        {
+        if (xhtml_all_white (para))
+          can_newline = FALSE; 
+        else
+          can_newline = TRUE; 
+        xhtml_flush_para (para, options, context);
+        wstring_clear (para);
+        if (can_newline)
+          {
+          xhtml_para_break (context, options);
+          can_newline = FALSE;
+          }
+        }
+      break;
+
+    case TAG_LINE:
+      if (self->inbody)
+        {
+        if (xhtml_all_white (para))
+          can_newline = FALSE; 
+        else
+          can_newline = TRUE; 
+        xhtml_flush_para (para, options, context);
+        wstring_clear (para);
+        if (can_newline)
+          {
+          xhtml_line_break (context);
+          can_newline = FALSE;
+          }
+        }
+      break;
+
+    case TAG_FORMAT:
+      if (self->inbody)
+        {
+        xhtml_flush_line (para, options, context); 
+        wstring_clear (para);
+        xhtml_emit_format (context, options, format);
+        xhtml_set_format (options, format, context);
+        }
+      break;
+
+    case TAG_BLOCK:
+      xhtml_flush_line (para, options, context);
+      wstring_clear (para);
+      xhtml_emit_format (context, options, format);
+      xhtml_set_format (options, format, context);
+      break;
+
+    case TAG_UNBLOCK:
+      xhtml_flush_line (para, options, context);
+      xhtml_emit_format (context, options, format);
+      xhtml_set_format (options, format, context);
+      wstring_clear (para);
+      xhtml_para_break (context, options);
+      break;
+
+    case TAG_RUBY:
+      wstring_clear (ruby);
+      break;
+
+    case TAG_UNRUBY:
+      // Append concatenated ruby annotations
       wstring_append_c (para, '(');
       wstring_append (para, ruby);
       wstring_append_c (para, ')');
       wstring_clear (ruby);
+      break;
+
+    case TAG_RT:
+      // Start accumulating ruby annotations
+      self->inruby = TRUE;
+      break;
+
+    case TAG_UNRT:
+      self->inruby = FALSE;
+      break;
+
+    case TAG_SKIP:
+      {
+      char close[XHTML_MAX_SKIP];
+      snprintf (close, sizeof (close), "</%s", atoms_name (atom));
+      xhtml_parser_start_skip (self, close);
+      }
+      break;
+
+    case TAG_HIDE:
+      // The element is markup, which is tokenized as usual, but it is 
+      //   out of the body text until it ends
+      self->hide_atom = atom;
+      self->hide_depth = 1;
+      self->hide_inbody = self->inbody;
+      self->inbody = FALSE;
+      break;
+    }
+  }
+
+/*============================================================================
+  xhtml_parser_feed
+  Tokenize the next length bytes of a UTF-8 XHTML document. The chunks 
+    can be of any size, and split the document anywhere. The tokenizer 
+    works on bytes: all the markup characters are ASCII, and can't occur 
+    inside a multi-byte sequence, so a sequence is only decoded when it 
+    is part of the body text. 
+============================================================================*/
+void xhtml_parser_feed (XhtmlParser *self, const char *s, int length)
+  {
+  IN
+  const BYTE *p = (const BYTE *)s;
+  const BYTE *end = p + length;
+
+  while (p < end && !self->done)
+    {
+    if (self->mode == MODE_SKIP)
+      {
+      p = xhtml_parser_skip (self, p, end);
+      continue;
       }
-    else if (strcasecmp(ss_tag, "rt") == 0)
+
+    if (self->mode == MODE_ANY && !self->inbody)
       {
-          // Start accumulating ruby annotations
-        inruby = TRUE;
+      // Text outside the body is ignored, so go straight to the next tag
+      const BYTE *q = memchr (p, '<', end - p);
+      if (!q) break;
+      p = q;
       }
-    else if (strcasecmp(ss_tag, "/rt") == 0)
+
+    if (self->mode == MODE_ANY && self->inbody && self->utf8_len == 0
+        && (XHTML_PLAIN & (1 << xhtml_classes[*p])))
       {
-        inruby = FALSE;
+      // Most body text is long runs of characters that need no special
+      //   handling, which can be added to the paragraph all at once
+      int n = scan_plain_text ((const char *)p, (const char *)end, 
+        self->last_c);
+      if (n > 0)
+        {
+        wstring_append_ascii (self->inruby ? self->ruby : self->para, 
+          (const char *)p, n);
+        self->last_c = p[n - 1];
+        p += n;
+        continue;
+        }
       }
 
-	  free (ss_tag);
-	  wstring_clear (tag);
-	  mode = MODE_ANY;
-	  }
-	else if (mode == MODE_INTAG)
-	 {
-         taglen++;
-         // Bug #5 -- Added support to abort tag reading if tag > 1000 
-         //   characters. This is an arbitrary number, but it's larger than
-         //   any tag that we can handle. 
-         if (taglen > 1000)
-           {
-           while (i < l)
-             {
-             uint32_t c = text[i];  
-             if (c == (uint32_t)'>')
-               {
-               wstring_clear (tag);
-               }
-             i++;
-             }
-           }
-	 wstring_append_c (tag, c);
-	 }
-	else
-	  log_error ("Unexpected character %d in mode %d", c, mode);
-	last_c = c;
+    uint32_t c = *p++;
+
+    if (self->utf8_len > 0)
+      {
+      if (c >= self->utf8_lo && c <= self->utf8_hi)
+        {
+        self->utf8_c = (self->utf8_c << 6) | (c & 0x3F);
+        self->utf8_lo = 0x80;
+        self->utf8_hi = 0xBF;
+        if (++self->utf8_len == self->utf8_need)
+          {
+          self->utf8_len = 0;
+          xhtml_parser_text (self, self->utf8_c);
+          }
+        continue;
         }
-     if (wstring_length (para) > 0)
-      xhtml_flush_para (para, options, context); 
+      xhtml_parser_utf8_abandon (self);
+      }
+
+    BYTE cls = xhtml_classes[c];
+    if (cls == C_TAB) 
+      c = ' ';
+
+    switch (xhtml_actions[self->mode][cls])
+      {
+      case A_TEXT:
+        if (self->inbody)
+          xhtml_parser_text (self, c);
+        break;
+
+      case A_NEWLINE:
+        if (self->inbody && self->last_c != ' ')
+          wstring_append_c (self->para, ' ');
+        break;
+
+      case A_UTF8:
+        if (self->inbody)
+          {
+          // last_c is updated when the sequence is complete
+          xhtml_parser_utf8_start (self, (BYTE)c);
+          continue;
+          }
+        break;
+
+      case A_OPEN_TAG:
+        self->taglen = 0;
+        self->mode = MODE_TAGOPEN;
+        break;
+
+      case A_NOT_TAG:
+        // A < that can't start a tag is just text, as in "a < b", rather
+        //   than the start of a tag that swallows the text up to the next >
+        if (self->inbody)
+          xhtml_parser_text (self, '<');
+        self->mode = MODE_ANY;
+        p--;
+        continue;
+
+      case A_TAG_CHAR:
+        self->mode = MODE_INTAG;
+        // The rest of the tag is collected here, up to the first byte
+        //   that needs the main loop, usually the >
+        for (;;)
+          {
+          // Bug #5 -- A tag longer than we can handle, such as an image 
+          //   with its data in an attribute, is truncated. Its name is 
+          //   still at the start, and the rest is read without being kept.
+          if (self->taglen < XHTML_MAX_TAG)
+            self->tag[self->taglen++] = (char)c;
+          // Comments and CDATA sections are ignored; the text they 
+          //   contain may look like tags
+          if (self->taglen == 3 && memcmp (self->tag, "!--", 3) == 0)
+            {
+            xhtml_parser_start_skip (self, "-->");
+            break;
+            }
+          if (self->taglen == 8 && memcmp (self->tag, "![CDATA[", 8) == 0)
+            {
+            xhtml_parser_start_skip (self, "]]>");
+            break;
+            }
+          if (p == end) 
+            break;
+          cls = xhtml_classes[*p];
+          if (xhtml_actions[MODE_INTAG][cls] != A_TAG_CHAR) 
+            break;
+          c = (cls == C_TAB) ? ' ' : *p;
+          p++;
+          }
+        break;
+
+      case A_TAG_END:
+        // The tag may start a skip, which changes the mode again
+        self->mode = MODE_ANY;
+        xhtml_parser_end_tag (self);
+        break;
+
+      case A_OPEN_ENTITY:
+        self->mode = MODE_ENTITY;
+        break;
+
+      case A_ENTITY_CHAR:
+        if (self->entitylen < XHTML_MAX_ENTITY)
+          {
+          self->entity[self->entitylen++] = (char)c;
+          break;
+          }
+        // Fall through
+
+      case A_NOT_ENTITY:
+        // Not an entity after all, so the & is just text, and c is 
+        //   looked at again. This bounds the work for a stray & 
+        if (self->inbody)
+          xhtml_parser_literal (self, FALSE);
+        self->entitylen = 0;
+        self->mode = MODE_ANY;
+        p--;
+        continue;
+
+      case A_ENTITY_END:
+        if (self->inbody)
+          xhtml_parser_entity (self);
+        self->entitylen = 0;
+        self->mode = MODE_ANY;
+        break;
+
+      case A_IGNORE: // DOS EOL
+        continue;
 
-     wstring_destroy (tag);
-     wstring_destroy (entity);
-     wstring_destroy (para);
-     wstring_destroy (ruby);
+      case A_END: // A zero byte ends the document
+        self->done = TRUE;
+        continue;
 
-     wraptext_eof (context);
-     wraptext_context_free (context);
-     }
+      default:
+        log_error ("Unexpected character %d in mode %d", c, self->mode);
+      }
+    self->last_c = c;
+    }
   OUT
   }
 
+/*============================================================================
+  xhtml_parser_finish
+  Output whatever is left at the end of the document 
+============================================================================*/
+void xhtml_parser_finish (XhtmlParser *self)
+  {
+  IN
+  xhtml_parser_utf8_abandon (self);
+  if (self->mode == MODE_ENTITY && self->inbody)
+    xhtml_parser_literal (self, FALSE);
+  self->mode = MODE_ANY;
+  if (wstring_length (self->para) > 0)
+    xhtml_flush_para (self->para, self->options, self->context); 
+  wstring_clear (self->para);
+  wraptext_finish (self->context);
+  self->done = TRUE;
+  OUT
+  }
 
+/*============================================================================
+  xhtml_to_stdout
+============================================================================*/
+void xhtml_to_stdout (const char *s, const Epub2TxtOptions *options, 
+             char **error)
+  {
+  IN
+  log_debug ("Process XHTML string");
+  XhtmlParser *parser = xhtml_parser_create (options);
+  xhtml_parser_feed (parser, s, strlen (s));
+  xhtml_parser_finish (parser);
+  xhtml_parser_destroy (parser);
+  OUT
+  }
 
+/*============================================================================
+  xhtml_utf8_to_stdout
+============================================================================*/
+void xhtml_utf8_to_stdout (const char *s, const Epub2TxtOptions *options, 
+       char **error)
+  {
+  IN
+  char *ss;
+  // This is all a bit ugly. The entity translation is in 
+  //  xhtml_to_stdout, which expects something that looks like a viable
+  //  XHTML file. There's no guarantee that the input to this function
+  //  will actually be a full XHTML file, so we must wrap it in a body
+  //  to fool xhtml_to_stdout. Ugh.
+  asprintf (&ss, "<body>%s</body>", s);
+  xhtml_to_stdout (ss, options, error);
+  free (ss);
+  OUT
+  }
 
+/*============================================================================
+  xhtml_parser_read_file
+  The file is fed to the tokenizer in chunks, so it never has to be 
+    in memory all at once
+============================================================================*/
+void xhtml_parser_read_file (XhtmlParser *self, const char *filename, 
+             char **error)
+  {
+  IN
+  log_debug ("Process XHTML file %s", filename);
 
+  int f = open (filename, O_RDONLY);
+  if (f >= 0)
+    {
+    if (!self->buff) self->buff = malloc (XHTML_CHUNK);
+    char *buff = self->buff;
+    BOOL first = TRUE;
+    int n;
+    while ((n = read (f, buff, XHTML_CHUNK)) > 0)
+      {
+      const char *s = buff;
+      // Might need to skip a UTF-8 BOM at the start of the file
+      if (first && n >= 3 && memcmp (buff, "\xEF\xBB\xBF", 3) == 0)
+        {
+        s += 3;
+        n -= 3;
+        }
+      first = FALSE;
+      xhtml_parser_feed (self, s, n);
+      }
+    xhtml_parser_finish (self);
+    close (f);
+    }
+  else
+    {
+    asprintf (error, "Can't open file '%s' for reading: %s", 
+      filename, strerror (errno));
+    }
 
+  OUT
+  }
 
+/*============================================================================
+  xhtml_file_to_stdout
+============================================================================*/
+void xhtml_file_to_stdout (const char *filename, const Epub2TxtOptions *options, 
+             char **error)
+  {
+  IN
+  XhtmlParser *parser = xhtml_parser_create (options);
+  xhtml_parser_read_file (parser, filename, error);
+  xhtml_parser_destroy (parser);
+  OUT
+  }
@@ -11,13 +11,27 @@
 
 struct _WrapTextContext;
 
-void     xhtml_to_stdout (const WString *s, const Epub2TxtOptions *options, 
+struct _XhtmlParser;
+typedef struct _XhtmlParser XhtmlParser;
+
+XhtmlParser *xhtml_parser_create (const Epub2TxtOptions *options);
+void     xhtml_parser_destroy (XhtmlParser *self);
+void     xhtml_parser_feed (XhtmlParser *self, const char *s, int length);
+void     xhtml_parser_finish (XhtmlParser *self);
+void     xhtml_parser_reset (XhtmlParser *self, 
+             const Epub2TxtOptions *options);
+void     xhtml_parser_release (XhtmlParser *self);
+void     xhtml_parser_read_file (XhtmlParser *self, const char *file, 
+             char **error);
+
+void     xhtml_to_stdout (const char *s, const Epub2TxtOptions *options, 
              char **error);
 void     xhtml_utf8_to_stdout (const char *s, const Epub2TxtOptions *options, 
              char **error);
 void     xhtml_file_to_stdout (const char *file, 
              const Epub2TxtOptions *options, char **error);
-WString *xhtml_translate_entity (const WString *entity);
+int      xhtml_translate_entity (const char *name, int len, uint32_t *out);
+char    *xhtml_utf8_to_plain (const char *s);
 void     xhtml_emit_fmt_eol_pre (struct _WrapTextContext *context);
 void     xhtml_emit_fmt_eol_post (struct _WrapTextContext *context);
 
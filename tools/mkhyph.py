@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+# mkhyph.py
+# Copyright (c)2024 Kevin Boone, GPL v3.0
+#
+# Generates src/hyph_table.h, the hyphenation patterns of each language
+# in tools/hyph, packed into tries for Liang's algorithm. The output is
+# committed to the source tree, so this script is only needed to add a
+# language, or change the patterns.
+#
+#   tools/mkhyph.py
+#
+# Each tools/hyph/*.txt has one TeX pattern per line, such as "hy3ph",
+# or an exception, with its hyphens, such as "ta-ble" or "project".
+# Lines that start with "%" are comments, except for these settings:
+#
+#   % languages en eng         -- dc:language codes, without any region
+#   % lefthyphenmin 2          -- the fewest letters before a hyphen
+#   % righthyphenmin 3         -- and after it
+#
+# An exception becomes a pattern of the whole word, with 11 where there
+# is a hyphen, and 10 where there is not, which overrides every other
+# pattern.
+#
+# Letters are numbered from 1, and the "." at each end of a word is 0.
+# Each node of the trie is the base of a run of slots, one for each
+# letter that can follow; the slot for letter c is trie[base + c], and
+# it is (base of the next node) << 8 | (c + 1), so that a slot that
+# belongs to another node, or no node, does not match. Bases are packed
+# first-fit, and are all different. ops[] has, for the same slot, the
+# offset in values[] of the pattern that ends there, if any: a count,
+# and then (distance from the end, value) pairs.
+
+import glob
+import os
+import re
+
+TOOLS = os.path.dirname (os.path.abspath (__file__))
+SRC = os.path.join (TOOLS, "..", "src")
+
+
+def read_patterns (path):
+    settings = {}
+    patterns = {}
+    for line in open (path, encoding="utf-8"):
+        line = line.strip ()
+        if line.startswith ("%"):
+            words = line[1:].split ()
+            if words and words[0] in ("languages", "lefthyphenmin",
+                                      "righthyphenmin"):
+                settings[words[0]] = words[1:]
+            continue
+        if not line:
+            continue
+        if not re.search (r"\d", line):
+            # An exception, which may have no hyphens at all
+            letters = line.replace ("-", "")
+            hyphens = set ()
+            k = 0
+            for ch in line:
+                if ch == "-":
+                    hyphens.add (k)
+                else:
+                    k += 1
+            # Position p of the pattern is before its letter p, and the
+            #   first letter is the "."
+            values = [0] * (len (letters) + 3)
+            for k in range (1, len (letters)):
+                values[k + 1] = 11 if k in hyphens else 10
+            patterns["." + letters + "."] = values
+            continue
+        letters = re.sub (r"\d", "", line)
+        values = [0] * (len (letters) + 1)
+        k = 0
+        for digits, ch in re.findall (r"(\d*)(\D|$)", line):
+            if digits:
+                values[k] = int (digits)
+            if ch:
+                k += 1
+        patterns[letters] = values
+    return settings, patterns
+
+
+def pack (patterns, codes):
+    # Build the trie as dicts, with the pattern values at each node
+    root = {"next": {}, "values": None}
+    for letters, values in patterns.items ():
+        node = root
+        for ch in letters:
+            node = node["next"].setdefault (codes[ch],
+                                            {"next": {}, "values": None})
+        node["values"] = values
+
+    pool = [0]   # Offset 0 means no pattern
+    pool_index = {}
+
+    def values_op (values):
+        if values is None:
+            return 0
+        n = len (values) - 1
+        pairs = [(n - i, v) for i, v in enumerate (values) if v]
+        key = tuple (pairs)
+        if key not in pool_index:
+            pool_index[key] = len (pool)
+            pool.append (len (pairs))
+            for d, v in pairs:
+                pool.extend ((d, v))
+        return pool_index[key]
+
+    # Place the nodes with children, breadth first
+    trie = []
+    ops = []
+    used_bases = set ()
+    free_from = 1
+    order = [root]
+    bases = {}
+    i = 0
+    while i < len (order):
+        node = order[i]
+        i += 1
+        if not node["next"]:
+            continue
+        cs = sorted (node["next"])
+        base = max (free_from - cs[0], 1)
+        while True:
+            if base not in used_bases and all (
+                    base + c >= len (trie) or trie[base + c] == 0
+                    for c in cs):
+                break
+            base += 1
+        used_bases.add (base)
+        need = base + cs[-1] + 1
+        if need > len (trie):
+            trie.extend ([0] * (need - len (trie)))
+            ops.extend ([0] * (need - len (ops)))
+        for c in cs:
+            trie[base + c] = -1   # Taken; filled in below
+        bases[id (node)] = base
+        while free_from < len (trie) and trie[free_from] != 0:
+            free_from += 1
+        order.extend (node["next"][c] for c in cs)
+
+    # Leaves all share a base, past the end, where no slot matches
+    leaf = len (trie)
+    while leaf in used_bases:
+        leaf += 1
+    size = leaf + max (codes.values ()) + 1
+    trie.extend ([0] * (size - len (trie)))
+    ops.extend ([0] * (size - len (ops)))
+
+    for node in order:
+        if id (node) not in bases:
+            continue
+        base = bases[id (node)]
+        for c, child in node["next"].items ():
+            trie[base + c] = (bases.get (id (child), leaf) << 8) | (c + 1)
+            ops[base + c] = values_op (child["values"])
+
+    assert max (ops) < 65536 and max (pool) < 256
+    return bases[id (root)], trie, ops, pool
+
+
+def rows (values):
+    return ",\n".join ("  " + ", ".join (str (v) for v in values[i:i + 12])
+                       for i in range (0, len (values), 12))
+
+
+def main ():
+    out = ["/* Generated by tools/mkhyph.py -- do not edit */", "",
+           "#pragma once", ""]
+    entries = []
+    for path in sorted (glob.glob (os.path.join (TOOLS, "hyph", "*.txt"))):
+        name = os.path.splitext (os.path.basename (path))[0]
+        settings, patterns = read_patterns (path)
+        letters = sorted (set ("".join (patterns)) - {"."})
+        codes = {ch: i + 1 for i, ch in enumerate (letters)}
+        codes["."] = 0
+        assert len (letters) < 255
+        root, trie, ops, pool = pack (patterns, codes)
+
+        # Upper case letters have the same codes as lower case
+        alphabet = {}
+        for ch in letters:
+            alphabet[ord (ch)] = codes[ch]
+            up = ch.upper ()
+            if len (up) == 1 and up != ch:
+                alphabet.setdefault (ord (up), codes[ch])
+        chars = sorted (alphabet)
+
+        out.append ("// %s: %d patterns, %d letters, %d slots"
+                    % (name, len (patterns), len (letters), len (trie)))
+        out.append ("static const uint32_t hyph_%s_chars[%d] =\n  {\n%s\n  };\n"
+                    % (name, len (chars), rows (chars)))
+        out.append ("static const unsigned char hyph_%s_codes[%d] =\n  {\n%s\n  };\n"
+                    % (name, len (chars), rows ([alphabet[c] for c in chars])))
+        out.append ("static const uint32_t hyph_%s_trie[%d] =\n  {\n%s\n  };\n"
+                    % (name, len (trie), rows (trie)))
+        out.append ("static const unsigned short hyph_%s_ops[%d] =\n  {\n%s\n  };\n"
+                    % (name, len (ops), rows (ops)))
+        out.append ("static const unsigned char hyph_%s_values[%d] =\n  {\n%s\n  };\n"
+                    % (name, len (pool), rows (pool)))
+        out.append ("static const char *const hyph_%s_languages[] =\n  { %s, NULL };\n"
+                    % (name, ", ".join ('"%s"' % l for l in settings["languages"])))
+        entries.append ("  { hyph_%s_languages, %s, %s, %d, hyph_%s_chars, "
+                        "hyph_%s_codes, %d, hyph_%s_trie, hyph_%s_ops, "
+                        "hyph_%s_values }"
+                        % (name, settings["lefthyphenmin"][0],
+                           settings["righthyphenmin"][0], len (chars), name,
+                           name, root, name, name, name))
+        print ("hyph: %s, %d patterns, %d slots, %d bytes of values"
+               % (name, len (patterns), len (trie), len (pool)))
+
+    out.append ("static const HyphPatterns hyph_patterns[] =\n  {\n%s\n  };\n"
+                % ",\n".join (entries))
+    with open (os.path.join (SRC, "hyph_table.h"), "w", encoding="utf-8") as f:
+        f.write ("\n".join (out))
+
+
+if __name__ == "__main__":
+    main ()
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#
+# mkphash.py
+# Copyright (c)2024 Kevin Boone, GPL v3.0
+#
+# Generates the static perfect-hash tables used by epub2txt. The output
+# is committed to the source tree, so this script is only needed when a
+# vocabulary changes; building epub2txt does not need Python.
+#
+#   tools/mkphash.py atoms     -- src/atoms_hash.h, from the ATOM_LIST
+#                                 in src/atoms.h
+#   tools/mkphash.py entities  -- src/entities_hash.h, from the WHATWG
+#                                 named character references, as built
+#                                 into Python's html.entities
+#
+# The hash function must match phash() and phash_fold() in src/phash.c.
+
+import os
+import re
+import sys
+
+SRC = os.path.join (os.path.dirname (os.path.abspath (__file__)), "..", "src")
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+M32 = 0xffffffff
+
+
+def phash (seed, key, fold=False):
+    h = FNV_OFFSET ^ seed
+    for c in key.encode ("utf-8"):
+        if fold and ord ('A') <= c <= ord ('Z'):
+            c += 32
+        h ^= c
+        h = (h * FNV_PRIME) & M32
+    h ^= h >> 16
+    h = (h * 0x45d9f3b) & M32
+    h ^= h >> 16
+    return h
+
+
+def find_seed (keys, bits, fold):
+    """Find a seed for which every key lands in its own slot of a table
+    of 2^bits entries"""
+    mask = (1 << bits) - 1
+    for seed in range (1, 1000000):
+        slots = set ()
+        for k in keys:
+            s = phash (seed, k, fold) & mask
+            if s in slots:
+                break
+            slots.add (s)
+        else:
+            return seed
+    return None
+
+
+def find_displacements (keys, bucket_bits, bits):
+    """Two-level hash and displace, for key sets too large to find a
+    single seed for. The first-level seed splits the keys into buckets;
+    each bucket, largest first, gets a second-level seed (displacement)
+    that puts its keys into free slots of a table of 2^bits entries"""
+    nbuckets = 1 << bucket_bits
+    mask = (1 << bits) - 1
+    for seed in range (1, 1000):
+        buckets = [[] for _ in range (nbuckets)]
+        for k in keys:
+            buckets[phash (seed, k) & (nbuckets - 1)].append (k)
+        order = sorted (range (nbuckets), key=lambda b: -len (buckets[b]))
+        used = set ()
+        disp = [0] * nbuckets
+        ok = True
+        for b in order:
+            if not buckets[b]:
+                break
+            for d in range (1, 65536):
+                slots = [phash (d, k) & mask for k in buckets[b]]
+                if len (set (slots)) == len (slots) and not used.intersection (slots):
+                    break
+            else:
+                ok = False
+                break
+            disp[b] = d
+            used.update (slots)
+        if ok:
+            return seed, disp
+    return None, None
+
+
+def c_array (values, per_line=16):
+    lines = []
+    for i in range (0, len (values), per_line):
+        lines.append ("  " + ", ".join (str (v) for v in values[i:i + per_line]))
+    return ",\n".join (lines)
+
+
+def gen_atoms ():
+    with open (os.path.join (SRC, "atoms.h")) as f:
+        names = re.findall (r'^\s*X \(\w+, "([^"]+)"\)', f.read (), re.M)
+    folded = [n.lower () for n in names]
+    if len (set (folded)) != len (folded):
+        sys.exit ("atoms.h: names may not differ only in case")
+    bits = max (1, (2 * len (names) - 1).bit_length ())
+    seed = None
+    while seed is None:
+        seed = find_seed (names, bits, True)
+        if seed is None:
+            bits += 1
+    slots = [0] * (1 << bits)
+    for i, n in enumerate (names):
+        slots[phash (seed, n, True) & ((1 << bits) - 1)] = i + 1
+    ctype = "unsigned char" if len (names) < 256 else "unsigned short"
+    with open (os.path.join (SRC, "atoms_hash.h"), "w") as f:
+        f.write ("/* Generated by tools/mkphash.py from atoms.h -- do not edit */\n\n")
+        f.write ("#pragma once\n\n")
+        f.write ("#define ATOMS_HASH_SEED %du\n" % seed)
+        f.write ("#define ATOMS_HASH_BITS %d\n\n" % bits)
+        f.write ("// Slot -> atom, ATOM_NONE for an empty slot\n")
+        f.write ("static const %s atoms_hash_slots[%d] =\n  {\n" % (ctype, 1 << bits))
+        f.write (c_array (slots))
+        f.write ("\n  };\n")
+    print ("atoms: %d names, %d slots, seed %d" % (len (names), 1 << bits, seed))
+
+
+def gen_entities ():
+    import html.entities
+    ents = {}
+    for name, text in html.entities.html5.items ():
+        # Only the forms with a semicolon; the tokenizer needs one anyway
+        if name.endswith (";"):
+            cps = [ord (c) for c in text]
+            # Plain text has no use for a non-breaking space
+            if cps == [0xA0]:
+                cps = [0x20]
+            ents[name[:-1]] = cps
+    names = sorted (ents)
+    if max (len (ents[n]) for n in names) > 2:
+        sys.exit ("entities: more than two code points in an entity")
+    # Half-full; the displacements make a denser table practical
+    bits = max (1, (len (names) - 1).bit_length ())
+    bucket_bits = bits - 2
+    seed, disp = find_displacements (names, bucket_bits, bits)
+    if seed is None:
+        sys.exit ("entities: no perfect hash found")
+    slots = [0] * (1 << bits)
+    for i, n in enumerate (names):
+        slots[phash (disp[phash (seed, n) & ((1 << bucket_bits) - 1)], n)
+              & ((1 << bits) - 1)] = i + 1
+    with open (os.path.join (SRC, "entities_hash.h"), "w") as f:
+        f.write ("/* Generated by tools/mkphash.py from the WHATWG entity list"
+                 " -- do not edit */\n\n")
+        f.write ("#pragma once\n\n")
+        f.write ("#define ENTITIES_COUNT %d\n" % (len (names) + 1))
+        f.write ("#define ENTITIES_HASH_SEED %du\n" % seed)
+        f.write ("#define ENTITIES_BUCKET_BITS %d\n" % bucket_bits)
+        f.write ("#define ENTITIES_HASH_BITS %d\n\n" % bits)
+        f.write ("// Bucket -> seed for the second-level hash\n")
+        f.write ("static const unsigned short entities_hash_disp[%d] =\n  {\n"
+                 % (1 << bucket_bits))
+        f.write (c_array (disp))
+        f.write ("\n  };\n\n")
+        f.write ("// Slot -> entity, 0 for an empty slot\n")
+        f.write ("static const unsigned short entities_hash_slots[%d] =\n  {\n"
+                 % (1 << bits))
+        f.write (c_array (slots))
+        f.write ("\n  };\n\n")
+        f.write ("static const char *const entities_names[ENTITIES_COUNT] =\n  {\n")
+        f.write (c_array (['""'] + ['"%s"' % n for n in names], 8))
+        f.write ("\n  };\n\n")
+        f.write ("static const unsigned char entities_lengths[ENTITIES_COUNT] =\n  {\n")
+        f.write (c_array ([0] + [len (n) for n in names]))
+        f.write ("\n  };\n\n")
+        f.write ("static const uint32_t entities_chars[ENTITIES_COUNT][2] =\n  {\n")
+        f.write (c_array (["{ 0, 0 }"] + ["{ 0x%04X, 0x%04X }" 
+                 % tuple ((ents[n] + [0])[:2]) for n in names], 6))
+        f.write ("\n  };\n")
+    print ("entities: %d names, %d buckets, %d slots, seed %d"
+           % (len (names), 1 << bucket_bits, 1 << bits, seed))
+
+
+if __name__ == "__main__":
+    targets = {"atoms": gen_atoms, "entities": gen_entities}
+    if len (sys.argv) < 2 or any (a not in targets for a in sys.argv[1:]):
+        sys.exit ("Usage: %s {%s}..." % (sys.argv[0], "|".join (targets)))
+    for a in sys.argv[1:]:
+        targets[a] ()
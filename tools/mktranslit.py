@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# mktranslit.py
+# Copyright (c)2024 Kevin Boone, GPL v3.0
+#
+# Generates src/translit_table.h, the table that --ascii uses to replace
+# non-ASCII characters with ASCII text. The output is committed to the
+# source tree, so this script is only needed to change the table.
+#
+#   tools/mktranslit.py
+#
+# A character's replacement is, in order of preference: an entry in
+# OVERRIDES; its compatibility decomposition (NFKD), without combining
+# marks, if every part of that has a replacement; or, for a Latin letter
+# whose Unicode name is "LATIN ... LETTER X WITH ...", just the letter.
+# Characters with none of these are left as they are.
+
+import os
+import re
+import sys
+import unicodedata
+
+SRC = os.path.join (os.path.dirname (os.path.abspath (__file__)), "..", "src")
+
+# The blocks the table covers
+RANGES = [
+    (0x00A0, 0x024F),   # Latin-1 Supplement, Latin Extended-A and -B
+    (0x02B0, 0x02FF),   # Spacing modifier letters
+    (0x0300, 0x036F),   # Combining diacritical marks
+    (0x1E00, 0x1EFF),   # Latin Extended Additional
+    (0x2000, 0x206F),   # General Punctuation
+    (0x20A0, 0x20CF),   # Currency symbols
+    (0x2100, 0x218F),   # Letterlike symbols, number forms
+    (0x2190, 0x21FF),   # Arrows
+    (0x2200, 0x22FF),   # Mathematical operators
+    (0xFB00, 0xFB06),   # Latin ligatures
+]
+
+OVERRIDES = {
+    0x00A0: " ", 0x00A1: "!", 0x00A2: "c", 0x00A3: "GBP", 0x00A5: "JPY",
+    0x00A6: "|", 0x00A7: "S", 0x00A8: "", 0x00A9: "(c)", 0x00AB: "<<",
+    0x00AC: "-", 0x00AD: "", 0x00AE: "(R)", 0x00AF: "-", 0x00B0: "deg",
+    0x00B1: "+/-", 0x00B4: "'", 0x00B5: "u", 0x00B6: "P", 0x00B7: ".",
+    0x00B8: ",", 0x00BB: ">>", 0x00BF: "?", 0x00C6: "AE", 0x00D0: "D",
+    0x00D7: "x", 0x00DE: "Th", 0x00DF: "ss", 0x00E6: "ae", 0x00F0: "d",
+    0x00F7: "/", 0x00FE: "th", 0x0131: "i", 0x0138: "k", 0x013F: "L",
+    0x0140: "l", 0x014A: "N", 0x014B: "n", 0x0152: "OE", 0x0153: "oe",
+    0x01F6: "Hw", 0x01F7: "W", 0x021C: "Y", 0x021D: "y",
+    0x02B9: "'", 0x02BA: "\"", 0x02BB: "'", 0x02BC: "'", 0x02BD: "'",
+    0x02C6: "^", 0x02C8: "'", 0x02CB: "`", 0x02CD: "_", 0x02DC: "~",
+    0x1E9E: "SS",
+    0x200B: "", 0x200C: "", 0x200D: "", 0x200E: "", 0x200F: "",
+    0x2010: "-", 0x2012: "-", 0x2013: "-", 0x2014: "-", 0x2015: "-",
+    0x2016: "||", 0x2018: "'", 0x2019: "'", 0x201A: ",", 0x201B: "'",
+    0x201C: "\"", 0x201D: "\"", 0x201E: "\"", 0x201F: "\"", 0x2020: "+",
+    0x2022: ".", 0x2023: ">", 0x2027: "-", 0x2028: " ", 0x2029: " ",
+    0x2030: "%o", 0x2032: "'", 0x2035: "`", 0x2039: "<", 0x203A: ">",
+    0x2043: "-", 0x2044: "/", 0x2060: "", 0x2061: "", 0x2062: "",
+    0x2063: "", 0x2064: "",
+    0x20AC: "EUR", 0x2122: "(TM)", 0x2190: "<-", 0x2192: "->",
+    0x2194: "<->", 0x21D0: "<=", 0x21D2: "=>", 0x21D4: "<=>",
+    0x2212: "-", 0x2215: "/", 0x2217: "*", 0x2219: ".", 0x2223: "|",
+    0x2236: ":", 0x223C: "~", 0x2248: "~", 0x2260: "!=", 0x2264: "<=",
+    0x2265: ">=",
+}
+
+LATIN = re.compile (r"^LATIN (CAPITAL|SMALL) LETTER (?:DOTLESS )?([A-Z]{1,2})(?: WITH .*)?$")
+
+
+def translit (cp, depth=0):
+    if cp < 0x80:
+        return chr (cp)
+    if cp in OVERRIDES:
+        return OVERRIDES[cp]
+    if depth > 4:
+        return None
+    ch = chr (cp)
+    if unicodedata.category (ch) == "Mn":
+        return ""
+    decomp = unicodedata.normalize ("NFKD", ch)
+    if decomp != ch:
+        parts = [translit (ord (c), depth + 1) for c in decomp
+                 if unicodedata.category (c) != "Mn"]
+        if parts and all (p is not None for p in parts):
+            return "".join (parts)
+    m = LATIN.match (unicodedata.name (ch, ""))
+    if m:
+        return m.group (2) if m.group (1) == "CAPITAL" else m.group (2).lower ()
+    return None
+
+
+def c_string (s):
+    return '"' + s.replace ("\\", "\\\\").replace ('"', '\\"') + '\\0"'
+
+
+def main ():
+    BLOCK = 128
+    maps = {}
+    for lo, hi in RANGES:
+        for cp in range (lo, hi + 1):
+            t = translit (cp)
+            if t is not None and t != chr (cp):
+                maps[cp] = t
+    # String pool: offset 0 is never used, so that 0 can mean "no entry"
+    pool = ["\0"]
+    offsets = {}
+    size = 1
+    for t in sorted (set (maps.values ())):
+        offsets[t] = size
+        pool.append (t)
+        size += len (t) + 1
+    if size > 0xFFFF:
+        sys.exit ("translit: string pool too large")
+    # Block 0 is all zeros, and serves every block that has no entries
+    blocks = [[0] * BLOCK]
+    index = [0] * (0x10000 // BLOCK)
+    for b in range (0x10000 // BLOCK):
+        entries = [offsets.get (maps.get (b * BLOCK + i), 0)
+                   if (b * BLOCK + i) in maps else 0 for i in range (BLOCK)]
+        if any (entries):
+            index[b] = len (blocks)
+            blocks.append (entries)
+    if len (blocks) > 255:
+        sys.exit ("translit: too many blocks")
+
+    with open (os.path.join (SRC, "translit_table.h"), "w") as f:
+        f.write ("/* Generated by tools/mktranslit.py -- do not edit */\n\n")
+        f.write ("#pragma once\n\n")
+        f.write ("#define TRANSLIT_BLOCK_BITS 7\n")
+        f.write ("#define TRANSLIT_BLOCKS %d\n\n" % len (blocks))
+        f.write ("// (Code point >> TRANSLIT_BLOCK_BITS) -> block, for the BMP\n")
+        f.write ("static const unsigned char translit_index[%d] =\n  {\n" % len (index))
+        f.write (",\n".join ("  " + ", ".join (str (v) for v in index[i:i + 16])
+                             for i in range (0, len (index), 16)))
+        f.write ("\n  };\n\n")
+        f.write ("// Block, low bits -> offset in translit_pool, 0 for none\n")
+        f.write ("static const unsigned short translit_blocks[%d][%d] =\n  {\n"
+                 % (len (blocks), BLOCK))
+        rows = []
+        for blk in blocks:
+            rows.append ("  {\n" + ",\n".join ("  " + ", ".join (str (v) for v in blk[i:i + 16])
+                                             for i in range (0, BLOCK, 16)) + "\n  }")
+        f.write (",\n".join (rows))
+        f.write ("\n  };\n\n")
+        f.write ("static const char translit_pool[%d] =\n" % size)
+        f.write ("  \"\\0\"\n")
+        f.write ("\n".join ("  " + c_string (t) for t in pool[1:]))
+        f.write (";\n")
+    print ("translit: %d characters, %d blocks, %d bytes of text"
+           % (len (maps), len (blocks), size))
+
+
+if __name__ == "__main__":
+    main ()
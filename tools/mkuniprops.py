@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+#
+# mkuniprops.py
+# Copyright (c)2024 Kevin Boone, GPL v3.0
+#
+# Generates src/uniprops_table.h, the two-stage table of the Unicode
+# properties that the text wrapper needs: line break class (UAX #14),
+# display width, and whether a character is whitespace or a newline.
+# The output is committed to the source tree, so this script is only
+# needed to change the table, or to move to a new version of Unicode.
+#
+#   tools/mkuniprops.py [LineBreak.txt]
+#
+# Widths and general categories come from Python's unicodedata module.
+# Line break classes come from LineBreak.txt, if it is given, or else
+# from Perl's Unicode::UCD; use the same Unicode version as Python.
+#
+# The pair table, of what to do between two line break classes, is
+# worked out from the rules LB6 to LB31 of UAX #14, taking each rule
+# that can be decided from the classes either side of the break, with or
+# without spaces in between. The classes are first resolved as LB1 says,
+# without the dictionary that Thai and similar scripts (SA) would need:
+# AI, SG, SA and XX are taken as AL, and CJ as NS. Rules that need more
+# context, such as LB21a, LB25 in full, and LB30a, are approximated.
+#
+# Width is 0 for combining marks, format and control characters, and
+# Hangul medial vowels and final consonants; 2 for East Asian wide and
+# fullwidth characters, including the unassigned code points that
+# EastAsianWidth.txt makes wide by default; and 1 for everything else.
+
+import os
+import subprocess
+import sys
+import unicodedata
+
+SRC = os.path.join (os.path.dirname (os.path.abspath (__file__)), "..", "src")
+
+# Must be in the same order as UnipropsLb in src/uniprops.h
+LB_CLASSES = [
+    "XX", "BK", "CR", "LF", "NL", "CM", "ZWJ", "SG", "WJ", "ZW", "GL", "SP",
+    "B2", "BA", "BB", "HY", "CB", "CL", "CP", "EX", "IN", "NS", "OP", "QU",
+    "IS", "NU", "PO", "PR", "SY", "AI", "AL", "CJ", "EB", "EM", "H2", "H3",
+    "HL", "ID", "JL", "JV", "JT", "RI", "SA",
+]
+
+WIDTH_SHIFT = 6
+WHITE = 1 << 8
+NEWLINE = 1 << 9
+
+NEWLINES = {0x0A, 0x0B, 0x0C, 0x0D, 0x85, 0x2028, 0x2029}
+WHITESPACE = ({0x09, 0x20, 0xA0, 0x1680, 0x202F, 0x205F, 0x3000}
+              | set (range (0x2000, 0x200B)))
+
+# Unassigned code points that EastAsianWidth.txt defaults to W
+WIDE_RANGES = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+               (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+
+def line_break_classes (path):
+    lb = ["XX"] * 0x110000
+    if path:
+        with open (path) as f:
+            for line in f:
+                line = line.split ("#")[0].strip ()
+                if not line:
+                    continue
+                cps, cls = [x.strip () for x in line.split (";")]
+                lo, _, hi = cps.partition ("..")
+                for cp in range (int (lo, 16), int (hi or lo, 16) + 1):
+                    lb[cp] = cls
+        return lb
+    out = subprocess.run (["perl", "-MUnicode::UCD=prop_invmap", "-e",
+        'my ($l, $m) = prop_invmap ("Line_Break"); '
+        'print "$l->[$_] $m->[$_]\\n" for 0 .. $#$l;'],
+        capture_output=True, text=True, check=True).stdout.split ("\n")
+    starts = []
+    for line in out:
+        if line:
+            start, cls = line.split ()
+            starts.append ((int (start), "XX" if cls == "Unknown" else cls))
+    for i, (start, cls) in enumerate (starts):
+        end = starts[i + 1][0] if i + 1 < len (starts) else 0x110000
+        for cp in range (start, min (end, 0x110000)):
+            lb[cp] = cls
+    return lb
+
+
+# Pair table actions. Must match UnipropsBreak in src/uniprops.h
+DIRECT = 0       # a ÷ b: a break is allowed between them
+INDIRECT = 1     # a × b, but a SP+ ÷ b: a break is allowed only at spaces
+PROHIBITED = 2   # a SP* × b: no break, even at spaces
+COMBINING = 3    # b is a combining mark, which belongs with a
+
+RESOLVE = {"AI": "AL", "SG": "AL", "SA": "AL", "XX": "AL", "CJ": "NS"}
+
+
+def no_break (a, b, spaces):
+    """Whether a rule forbids a break between a and b, with or without
+    spaces in between. a and b are resolved classes. """
+    # LB6, LB7 -- these are handled by the wrapper itself, but say 
+    #   something sensible
+    if b in ("BK", "CR", "LF", "NL", "SP", "ZW"):
+        return True
+    # LB8
+    if a == "ZW":
+        return False
+    # LB8a
+    if a == "ZWJ" and not spaces:
+        return True
+    # LB11
+    if b == "WJ" or (a == "WJ" and not spaces):
+        return True
+    # LB12, LB12a
+    if a == "GL" and not spaces:
+        return True
+    if b == "GL" and not spaces and a not in ("BA", "HY"):
+        return True
+    # LB13
+    if b in ("CL", "CP", "EX", "IS", "SY"):
+        return True
+    # LB14 -- LB17
+    if a == "OP":
+        return True
+    if a == "QU" and b == "OP":
+        return True
+    if a in ("CL", "CP") and b == "NS":
+        return True
+    if a == "B2" and b == "B2":
+        return True
+    # LB18
+    if spaces:
+        return False
+    # LB19, LB20
+    if a == "QU" or b == "QU":
+        return True
+    if a == "CB" or b == "CB":
+        return False
+    # LB21, LB21b, LB22
+    if b in ("BA", "HY", "NS") or a == "BB":
+        return True
+    if a == "SY" and b == "HL":
+        return True
+    if b == "IN":
+        return True
+    # LB23, LB23a, LB24
+    alpha = ("AL", "HL")
+    if (a in alpha and b == "NU") or (a == "NU" and b in alpha):
+        return True
+    if (a == "PR" and b in ("ID", "EB", "EM")) or \
+       (a in ("ID", "EB", "EM") and b == "PO"):
+        return True
+    if (a in ("PR", "PO") and b in alpha) or (a in alpha and b in ("PR", "PO")):
+        return True
+    # LB25, as the pairs that it allows
+    if (a, b) in (("CL", "PO"), ("CP", "PO"), ("CL", "PR"), ("CP", "PR"),
+                  ("NU", "PO"), ("NU", "PR"), ("PO", "OP"), ("PO", "NU"),
+                  ("PR", "OP"), ("PR", "NU"), ("HY", "NU"), ("IS", "NU"),
+                  ("NU", "NU"), ("SY", "NU")):
+        return True
+    # LB26, LB27
+    if (a == "JL" and b in ("JL", "JV", "H2", "H3")) or \
+       (a in ("JV", "H2") and b in ("JV", "JT")) or \
+       (a in ("JT", "H3") and b == "JT"):
+        return True
+    korean = ("JL", "JV", "JT", "H2", "H3")
+    if (a in korean and b == "PO") or (a == "PR" and b in korean):
+        return True
+    # LB28, LB29, LB30
+    if a in alpha and b in alpha:
+        return True
+    if a == "IS" and b in alpha:
+        return True
+    if (a in alpha + ("NU",) and b == "OP") or (a == "CP" and b in alpha + ("NU",)):
+        return True
+    # LB30a, taking every pair of regional indicators as a flag; LB30b
+    if a == "RI" and b == "RI":
+        return True
+    if a == "EB" and b == "EM":
+        return True
+    # LB31
+    return False
+
+
+def pair_action (a, b):
+    a = RESOLVE.get (a, a)
+    b = RESOLVE.get (b, b)
+    # LB9, LB10
+    if b in ("CM", "ZWJ"):
+        return COMBINING
+    if a in ("CM", "ZWJ"):
+        a = "AL"
+    if not no_break (a, b, False):
+        return DIRECT
+    if not no_break (a, b, True):
+        return INDIRECT
+    return PROHIBITED
+
+
+def width (cp):
+    ch = chr (cp)
+    cat = unicodedata.category (ch)
+    if cat in ("Mn", "Me", "Cf", "Cc"):
+        return 0
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+        return 0
+    if cat == "Cn":
+        # unicodedata's widths for unassigned code points aren't reliable
+        return 2 if any (lo <= cp <= hi for lo, hi in WIDE_RANGES) else 1
+    if unicodedata.east_asian_width (ch) in ("W", "F"):
+        return 2
+    return 1
+
+
+def main ():
+    lb = line_break_classes (sys.argv[1] if len (sys.argv) > 1 else None)
+    index = {c: i for i, c in enumerate (LB_CLASSES)}
+    props = []
+    for cp in range (0x110000):
+        v = index[lb[cp]] | (width (cp) << WIDTH_SHIFT)
+        if cp in WHITESPACE:
+            v |= WHITE
+        if cp in NEWLINES:
+            v |= NEWLINE
+        props.append (v)
+
+    # Choose the block size that makes the two stages smallest, with no
+    #   more than 256 distinct blocks, so that stage 1 is bytes
+    best = None
+    for bits in range (5, 11):
+        size = 1 << bits
+        blocks = {}
+        stage1 = []
+        for b in range (0x110000 >> bits):
+            blk = tuple (props[b * size:(b + 1) * size])
+            stage1.append (blocks.setdefault (blk, len (blocks)))
+        total = len (stage1) + len (blocks) * size * 2
+        if len (blocks) <= 256 and (best is None or total < best[0]):
+            best = (total, bits, stage1, blocks)
+    total, bits, stage1, blocks = best
+    stage2 = [v for blk in sorted (blocks, key=blocks.get) for v in blk]
+
+    def rows (values):
+        return ",\n".join ("  " + ", ".join (str (v) for v in values[i:i + 16])
+                           for i in range (0, len (values), 16))
+
+    with open (os.path.join (SRC, "uniprops_table.h"), "w") as f:
+        f.write ("/* Generated by tools/mkuniprops.py -- do not edit */\n")
+        f.write ("/* Unicode %s */\n\n" % unicodedata.unidata_version)
+        f.write ("#pragma once\n\n")
+        f.write ("#if UNIPROPS_BLOCK_BITS != %d\n" % bits)
+        f.write ("#error \"UNIPROPS_BLOCK_BITS does not match the table\"\n")
+        f.write ("#endif\n\n")
+        f.write ("// (Code point >> UNIPROPS_BLOCK_BITS) -> block\n")
+        f.write ("const unsigned char uniprops_stage1[%d] =\n  {\n" % len (stage1))
+        f.write (rows (stage1))
+        f.write ("\n  };\n\n")
+        f.write ("// Block * block size + low bits -> properties\n")
+        f.write ("const unsigned short uniprops_stage2[%d] =\n  {\n" % len (stage2))
+        f.write (rows (stage2))
+        f.write ("\n  };\n\n")
+        f.write ("// Line break class before, class after -> UnipropsBreak\n")
+        f.write ("const unsigned char uniprops_lb_pairs[%d][%d] =\n  {\n"
+                 % (len (LB_CLASSES), len (LB_CLASSES)))
+        f.write (",\n".join ("  /* %-3s */ { %s }" % (a, ", ".join (
+            str (pair_action (a, b)) for b in LB_CLASSES)) for a in LB_CLASSES))
+        f.write ("\n  };\n")
+    print ("uniprops: %d-bit blocks, %d blocks, %d bytes"
+           % (bits, len (blocks), total))
+
+
+if __name__ == "__main__":
+    main ()
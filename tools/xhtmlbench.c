@@ -0,0 +1,133 @@
+/*============================================================================
+  epub2txt v2
+  xhtmlbench.c
+  Copyright (c)2024 Kevin Boone, GPL v3.0
+
+  A micro-benchmark for the XHTML tokenizer and formatter. The XHTML
+  files named on the command line -- typically the chapters unpacked
+  from some real EPUBs -- are read into memory, and then converted
+  repeatedly, with the output going to /dev/null. Unzipping and file
+  I/O are not included in the time. Build with "make xhtmlbench".
+
+    unzip -d /tmp/book book.epub
+    ./xhtmlbench -n 20 -w 80 $(find /tmp/book -name '*.xhtml')
+============================================================================*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "epub2txt.h"
+#include "defs.h"
+#include "xhtml.h"
+#include "hyph.h"
+
+/*============================================================================
+  bench_read_file
+============================================================================*/
+static char *bench_read_file (const char *file, size_t *length)
+  {
+  FILE *f = fopen (file, "rb");
+  if (!f) return NULL;
+  fseek (f, 0, SEEK_END);
+  long n = ftell (f);
+  fseek (f, 0, SEEK_SET);
+  char *s = malloc (n);
+  *length = fread (s, 1, n, f);
+  fclose (f);
+  return s;
+  }
+
+/*============================================================================
+  bench_now
+============================================================================*/
+static double bench_now (void)
+  {
+  struct timespec ts;
+  clock_gettime (CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+  }
+
+/*============================================================================
+  main
+============================================================================*/
+int main (int argc, char **argv)
+  {
+  Epub2TxtOptions options;
+  memset (&options, 0, sizeof (options));
+  options.width = 80;
+  int iterations = 10;
+
+  int opt;
+  while ((opt = getopt (argc, argv, "ahorw:n:")) != -1)
+    {
+    switch (opt)
+      {
+      case 'a': options.ascii = TRUE; break;
+      case 'h': options.hyphenator = hyph_create ("en"); break;
+      case 'o': options.wrap = WRAP_OPTIMAL; break;
+      case 'r': options.raw = TRUE; break;
+      case 'w': options.width = atoi (optarg); break;
+      case 'n': iterations = atoi (optarg); break;
+      default:
+        fprintf (stderr, "Usage: %s [-a] [-h] [-o] [-r] [-w width] [-n iterations] "
+          "{files...}\n", argv[0]);
+        exit (-1);
+      }
+    }
+
+  int count = argc - optind;
+  if (count <= 0)
+    {
+    fprintf (stderr, "%s: no files selected\n", argv[0]);
+    exit (-1);
+    }
+
+  char **docs = malloc (count * sizeof (char *));
+  size_t *lengths = malloc (count * sizeof (size_t));
+  size_t total = 0;
+  int i, j;
+  for (i = 0; i < count; i++)
+    {
+    docs[i] = bench_read_file (argv[optind + i], &lengths[i]);
+    if (!docs[i])
+      {
+      fprintf (stderr, "%s: can't read %s\n", argv[0], argv[optind + i]);
+      exit (-1);
+      }
+    total += lengths[i];
+    }
+
+  if (!freopen ("/dev/null", "w", stdout))
+    exit (-1);
+
+  // As in epub2txt_do_file, one parser is reset for each document
+  XhtmlParser *parser = xhtml_parser_create (&options);
+  double best = 0;
+  for (j = 0; j < iterations; j++)
+    {
+    double start = bench_now ();
+    for (i = 0; i < count; i++)
+      {
+      xhtml_parser_reset (parser, &options);
+      xhtml_parser_feed (parser, docs[i], (int)lengths[i]);
+      xhtml_parser_finish (parser);
+      }
+    double t = bench_now () - start;
+    if (j == 0 || t < best) best = t;
+    }
+
+  fprintf (stderr, "%d files, %zu bytes: best of %d %.2f ms, %.1f MB/s\n",
+    count, total, iterations, best * 1000, total / best / 1e6);
+
+  xhtml_parser_destroy (parser);
+  for (i = 0; i < count; i++)
+    free (docs[i]);
+  free (docs);
+  free (lengths);
+  hyph_destroy (options.hyphenator);
+  return 0;
+  }
+